@@ -4,6 +4,7 @@
 #include "time/rtc_alarm.h"
 #include "storage/flash_logger.h"
 #include "storage/sd_logger.h"
+#include "storage/carry_forward.h"
 #include "system/pins.h"
 #include <esp_now.h>
 #include <WiFi.h>
@@ -95,7 +96,8 @@ static void sendSnapshotAck(const uint8_t* mac, const node_snapshot_t& snap, boo
 
 // Send a SNAPSHOT_ACK that echoes the decoded snapshot's protocolVersion
 // (so V2 nodes receive a V2 ack, V1 nodes receive the legacy version).
-static void sendDecodedSnapshotAck(const uint8_t* mac, const DecodedSnapshot& decoded, bool persisted) {
+static void sendDecodedSnapshotAck(const uint8_t* mac, const DecodedSnapshot& decoded, bool persisted,
+                                   bool sendFull) {
   if (!mac) return;
 
   snapshot_ack_t ack{};
@@ -104,48 +106,48 @@ static void sendDecodedSnapshotAck(const uint8_t* mac, const DecodedSnapshot& de
   ack.seqNum = decoded.seqNum;
   ack.persisted = persisted ? 1 : 0;
   ack.protocolVersion = decoded.protocolVersion;
+  ack.flags = sendFull ? SNAPSHOT_ACK_SEND_FULL : 0;
 
   ensurePeerOnChannel(mac, ESPNOW_CHANNEL);
   esp_err_t res = esp_now_send(mac, reinterpret_cast<const uint8_t*>(&ack), sizeof(ack));
-  Serial.printf("[SNAP-ACK] %.15s seq=%lu persisted=%u proto=%u send=%s\n",
+  Serial.printf("[SNAP-ACK] %.15s seq=%lu persisted=%u proto=%u flags=0x%02X send=%s\n",
                 ack.nodeId, static_cast<unsigned long>(ack.seqNum),
                 static_cast<unsigned>(ack.persisted),
-                (unsigned)ack.protocolVersion,
+                (unsigned)ack.protocolVersion, (unsigned)ack.flags,
                 res == ESP_OK ? "OK" : esp_err_to_name(res));
 }
 
 // Common processing for V1 and V2 snapshots once decoded.
 // Updates the node registry, logs to CSV, and sends SNAPSHOT_ACK.
-static void processDecodedSnapshot(const DecodedSnapshot& decoded, const uint8_t* mac) {
+static void processDecodedSnapshot(DecodedSnapshot& decoded, const uint8_t* mac) {
   if (!mac) return;
 
   registerNode(mac, decoded.nodeId, "MULTI_ENV", DEPLOYED);
 
-  for (auto& n : registeredNodes) {
-    if (n.nodeId == String(decoded.nodeId)) {
-      if (decoded.nodeTimestamp > 0 && decoded.nodeTimestamp > n.lastNodeTimestamp) {
-        n.lastNodeTimestamp = decoded.nodeTimestamp;
-      }
-      if (decoded.configVersion > 0 && decoded.configVersion > n.configVersionApplied) {
-        n.configVersionApplied = decoded.configVersion;
-      }
-      const float* batV = decoded.find(SENSOR_ID_BAT_V);
-      if (batV && !isnan(*batV)) {
-        n.lastReportedBatV = *batV;
-      }
-      break;
+  if (NodeInfo* n = registeredNodes.findById(decoded.nodeId)) {
+    if (decoded.nodeTimestamp > 0 && decoded.nodeTimestamp > n->lastNodeTimestamp) {
+      n->lastNodeTimestamp = decoded.nodeTimestamp;
+    }
+    if (decoded.configVersion > 0 && decoded.configVersion > n->configVersionApplied) {
+      n->configVersionApplied = decoded.configVersion;
+    }
+    const float* batV = decoded.find(SENSOR_ID_BAT_V);
+    if (batV && !isnan(*batV)) {
+      n->lastReportedBatV = *batV;
     }
   }
 
   // Config-mode receive path — must stamp exactly like the sync-window path in
   // main.cpp, or snapshots collected while the AP portal is open would upload
-  // unattributed. `decoded` is const; stamp a copy.
-  DecodedSnapshot stamped = decoded;
-  stamped.deploymentEpoch = resolveEpochForSample(stamped.nodeId, stamped.nodeTimestamp);
+  // unattributed. The caller's decode buffer is stamped in place.
+  stampDeploymentEpoch(decoded);
+  const bool merged = carryForwardApply(decoded);
+  // Config mode has no end-of-window commit; snapshots here are rare.
+  carryForwardCommit();
 
   bool persisted = false;
   if (flashIsReady()) {
-    const bool flashSaved = logDecodedSnapshot(stamped);
+    const bool flashSaved = logDecodedSnapshot(decoded);
     persisted = persisted || flashSaved;
     if (!flashSaved) {
       Serial.println("[SNAP] Flash logging failed");
@@ -153,14 +155,14 @@ static void processDecodedSnapshot(const DecodedSnapshot& decoded, const uint8_t
   }
   if (sdIsReady()) {
     String archiveRow;
-    const bool sdSaved = formatDecodedSnapshotCSVRow(stamped, archiveRow) &&
+    const bool sdSaved = formatDecodedSnapshotCSVRow(decoded, archiveRow) &&
                          sdLogCSVRow(archiveRow);
     persisted = persisted || sdSaved;
   }
   if (!persisted) {
     Serial.println("[SNAP] No storage accepted the snapshot");
   }
-  sendDecodedSnapshotAck(mac, decoded, persisted);
+  sendDecodedSnapshotAck(mac, decoded, persisted, !merged);
   Serial.printf("[SNAP] %.15s seq=%lu present=0x%04X proto=%u readings=%u\n",
                 decoded.nodeId, (unsigned long)decoded.seqNum,
                 (unsigned)decoded.sensorPresent,
@@ -303,25 +305,22 @@ static void onEspNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
       memcpy(&st, data, sizeof(st));
       NodeState reported = (st.state <= (uint8_t)DEPLOYED) ? (NodeState)st.state : UNPAIRED;
       registerNode(mac, st.nodeId, "status", reported);
-      for (auto& n : registeredNodes) {
-        if (memcmp(n.mac, mac, 6) == 0 || n.nodeId == String(st.nodeId)) {
-          noteNodeContact(n);
-          n.lastRescueMode = (st.rescueMode != 0);
-          const bool reportsUndeployed = reported != DEPLOYED || st.deployed == 0;
-          if (reportsUndeployed && shouldRecoverKnownDeployedNode(n)) {
-            // A transient/corrupt node-side NVS record must not downgrade the
-            // FieldHub's authoritative deployment record. Expose it as pending
-            // and arrange a re-deploy from normal (non-callback) context.
-            n.deployPending = true;
-            queueKnownNodeRecovery(n.nodeId);
-            Serial.printf("[RECOVERY] known deployed node %.15s reported unpaired; preserving state and re-deploying\n",
-                          n.nodeId.c_str());
-          } else {
-            n.state = reported;
-          }
-          savePairedNodes();
-          break;
+      if (NodeInfo* n = registeredNodes.findByMacOrId(mac, st.nodeId)) {
+        noteNodeContact(*n);
+        n->lastRescueMode = (st.rescueMode != 0);
+        const bool reportsUndeployed = reported != DEPLOYED || st.deployed == 0;
+        if (reportsUndeployed && shouldRecoverKnownDeployedNode(*n)) {
+          // A transient/corrupt node-side NVS record must not downgrade the
+          // FieldHub's authoritative deployment record. Expose it as pending
+          // and arrange a re-deploy from normal (non-callback) context.
+          n->deployPending = true;
+          queueKnownNodeRecovery(n->nodeId);
+          Serial.printf("[RECOVERY] known deployed node %.15s reported unpaired; preserving state and re-deploying\n",
+                        n->nodeId.c_str());
+        } else {
+          n->state = reported;
         }
+        savePairedNodes();
       }
       Serial.printf("[STATUS] %s state=%u rtcUnix=%lu\n",
                     st.nodeId, (unsigned)st.state, (unsigned long)st.rtcUnix);
@@ -338,25 +337,16 @@ static void onEspNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
       memcpy(&discovery, data, sizeof(discovery));
       Serial.printf("[DISCOVERY] from %s (%s) MAC=%s\n",
                     discovery.nodeId, discovery.nodeType, macStr);
-      NodeState keep = UNPAIRED;
-      for (const auto& n : registeredNodes) {
-        if (memcmp(n.mac, mac, 6) == 0 || n.nodeId == String(discovery.nodeId)) {
-          keep = n.state;
-          break;
-        }
-      }
+      const NodeInfo* prior = registeredNodes.findByMacOrId(mac, discovery.nodeId);
+      const NodeState keep = prior ? prior->state : UNPAIRED;
       registerNode(mac, discovery.nodeId, discovery.nodeType, keep);
-      for (auto& n : registeredNodes) {
-        if (memcmp(n.mac, mac, 6) == 0 || n.nodeId == String(discovery.nodeId)) {
-          if (shouldRecoverKnownDeployedNode(n)) {
-            n.deployPending = true;
-            queueKnownNodeRecovery(n.nodeId);
-            savePairedNodes();
-            Serial.printf("[RECOVERY] known deployed node %.15s sent discovery; re-deploy queued\n",
-                          n.nodeId.c_str());
-          }
-          break;
-        }
+      NodeInfo* n = registeredNodes.findByMacOrId(mac, discovery.nodeId);
+      if (n && shouldRecoverKnownDeployedNode(*n)) {
+        n->deployPending = true;
+        queueKnownNodeRecovery(n->nodeId);
+        savePairedNodes();
+        Serial.printf("[RECOVERY] known deployed node %.15s sent discovery; re-deploy queued\n",
+                      n->nodeId.c_str());
       }
 
       discovery_response_t response{};
@@ -376,13 +366,8 @@ static void onEspNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
       pairing_request_t request{};
       memcpy(&request, data, sizeof(request));
       Serial.printf("[PAIR-POLL] from %s MAC=%s\n", request.nodeId, macStr);
-      NodeState keep = UNPAIRED;
-      for (const auto& n : registeredNodes) {
-        if (memcmp(n.mac, mac, 6) == 0 || n.nodeId == String(request.nodeId)) {
-          keep = n.state;
-          break;
-        }
-      }
+      const NodeInfo* prior = registeredNodes.findByMacOrId(mac, request.nodeId);
+      const NodeState keep = prior ? prior->state : UNPAIRED;
       registerNode(mac, request.nodeId, "unknown", keep);
 
       NodeState current = getNodeState(request.nodeId);
@@ -419,14 +404,11 @@ static void onEspNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
       if (ack.deployed == 1) {
         Serial.printf("[DEPLOY-ACK] %s rtcUnix=%lu\n", ack.nodeId, (unsigned long)ack.rtcUnix);
         registerNode(mac, ack.nodeId, "unknown", DEPLOYED);
-        for (auto& n : registeredNodes) {
-          if (n.nodeId == String(ack.nodeId) || memcmp(n.mac, mac, 6) == 0) {
-            if (n.deployPending) n.deployPending = false;
-            NodeDesiredConfig desired = getDesiredConfig(ack.nodeId);
-            if (desired.configVersion > 0 && n.configVersionApplied < desired.configVersion) {
-              n.configVersionApplied = desired.configVersion;
-            }
-            break;
+        if (NodeInfo* n = registeredNodes.findByMacOrId(mac, ack.nodeId)) {
+          if (n->deployPending) n->deployPending = false;
+          NodeDesiredConfig desired = getDesiredConfig(ack.nodeId);
+          if (desired.configVersion > 0 && n->configVersionApplied < desired.configVersion) {
+            n->configVersionApplied = desired.configVersion;
           }
         }
         savePairedNodes();
@@ -443,12 +425,8 @@ static void onEspNowRecv(const uint8_t* mac, const uint8_t* data, int len) {
       config_apply_ack_message_t ack{};
       memcpy(&ack, data, sizeof(ack));
       Serial.printf("[CONFIG-ACK] %s v=%u ok=%u\n", ack.nodeId, (unsigned)ack.appliedVersion, (unsigned)ack.ok);
-      for (auto& n : registeredNodes) {
-        if (n.nodeId == String(ack.nodeId)) {
-          if (ack.ok) n.configVersionApplied = ack.appliedVersion;
-          break;
-        }
-      }
+      NodeInfo* n = registeredNodes.findById(ack.nodeId);
+      if (n && ack.ok) n->configVersionApplied = ack.appliedVersion;
     } else {
       Serial.printf("[ESPNOW-CFG] CONFIG_ACK too short: %d < %u\n", len, (unsigned)sizeof(config_apply_ack_message_t));
     }
@@ -522,23 +500,22 @@ void espnowConfigPoll() {
   String nodeId;
   if (!takeKnownNodeRecovery(nodeId)) return;
 
-  for (auto& node : registeredNodes) {
-    if (node.nodeId != nodeId) continue;
-    if (!shouldRecoverKnownDeployedNode(node)) {
-      Serial.printf("[RECOVERY] %s skipped: no longer an authoritative deployed node\n",
-                    nodeId.c_str());
-      return;
-    }
-
-    node.deployPending = true;
-    savePairedNodes();
-    const bool sent = deploySelectedNodes(std::vector<String>{nodeId});
-    Serial.printf("[RECOVERY] config-mode DEPLOY_NODE -> %s: %s\n",
-                  nodeId.c_str(), sent ? "sent" : "failed");
+  NodeInfo* node = registeredNodes.findById(nodeId.c_str());
+  if (!node) {
+    Serial.printf("[RECOVERY] %s skipped: registry entry disappeared\n", nodeId.c_str());
+    return;
+  }
+  if (!shouldRecoverKnownDeployedNode(*node)) {
+    Serial.printf("[RECOVERY] %s skipped: no longer an authoritative deployed node\n",
+                  nodeId.c_str());
     return;
   }
 
-  Serial.printf("[RECOVERY] %s skipped: registry entry disappeared\n", nodeId.c_str());
+  node->deployPending = true;
+  savePairedNodes();
+  const bool sent = deploySelectedNodes(std::vector<String>{nodeId});
+  Serial.printf("[RECOVERY] config-mode DEPLOY_NODE -> %s: %s\n",
+                nodeId.c_str(), sent ? "sent" : "failed");
 }
 
 // -----------------------------------------------------------------------------
@@ -785,11 +762,8 @@ bool sendTimeSync(const uint8_t* mac, const char* nodeId) {
 
   esp_err_t r = esp_now_send(mac, (uint8_t*)&resp, sizeof(resp));
   if (r == ESP_OK) {
-    for (auto& n : registeredNodes) {
-      if (memcmp(n.mac, mac, 6) == 0 || n.nodeId == String(nodeId)) {
-        n.lastTimeSyncMs = millis();
-        break;
-      }
+    if (NodeInfo* n = registeredNodes.findByMacOrId(mac, nodeId)) {
+      n->lastTimeSyncMs = millis();
     }
     Serial.printf("[TIME-SYNC] -> %s (%s) OK\n", nodeId, macToStr(mac).c_str());
     return true;
@@ -894,12 +868,11 @@ bool sendConfigSnapshot(const uint8_t* mac, const char* nodeId) {
   NodeDesiredConfig desired = getDesiredConfig(nodeId);
   if (desired.configVersion == 0) return false;
 
-  for (auto& n : registeredNodes) {
-    if (n.nodeId == String(nodeId) && n.configVersionApplied >= desired.configVersion) {
-      Serial.printf("[CFG-SNAP] %s up-to-date (v%u <= v%u)\n",
-                    nodeId, (unsigned)n.configVersionApplied, (unsigned)desired.configVersion);
-      return false;
-    }
+  const NodeInfo* n = registeredNodes.findById(nodeId);
+  if (n && n->configVersionApplied >= desired.configVersion) {
+    Serial.printf("[CFG-SNAP] %s up-to-date (v%u <= v%u)\n",
+                  nodeId, (unsigned)n->configVersionApplied, (unsigned)desired.configVersion);
+    return false;
   }
 
   config_snapshot_message_t snap{};
@@ -955,26 +928,19 @@ void handleNodeHello(const uint8_t* senderMac, const node_hello_message_t& hello
   maybePushTimeSyncOnHello(senderMac, hello);
 
   NodeState helloState = DEPLOYED;
-  for (const auto& n : registeredNodes) {
-    if (n.nodeId == String(hello.nodeId) || memcmp(n.mac, senderMac, 6) == 0) {
-      if (n.state == UNPAIRED) helloState = n.state;
-      break;
-    }
-  }
+  const NodeInfo* prior = registeredNodes.findByMacOrId(senderMac, hello.nodeId);
+  if (prior && prior->state == UNPAIRED) helloState = UNPAIRED;
   registerNode(senderMac, hello.nodeId, hello.nodeType, helloState);
 
-  for (auto& n : registeredNodes) {
-    if (n.nodeId == String(hello.nodeId)) {
-      n.wakeIntervalMin = hello.wakeIntervalMin;
-      n.lastReportedQueueDepth = hello.queueDepth;
-      if (hello.configVersion > n.configVersionApplied) {
-        n.configVersionApplied = hello.configVersion;
-      }
-      if (n.deployPending) {
-        n.deployPending = false;
-        savePairedNodes();
-      }
-      break;
+  if (NodeInfo* n = registeredNodes.findById(hello.nodeId)) {
+    n->wakeIntervalMin = hello.wakeIntervalMin;
+    n->lastReportedQueueDepth = hello.queueDepth;
+    if (hello.configVersion > n->configVersionApplied) {
+      n->configVersionApplied = hello.configVersion;
+    }
+    if (n->deployPending) {
+      n->deployPending = false;
+      savePairedNodes();
     }
   }
 
@@ -1,6 +1,7 @@
 #include "comms/espnow_sync.h"
 #include "storage/flash_logger.h"  // DecodedSnapshot, decodeV2, decodedToV1
 #include "system/pins.h"
+#include "time/rtc_alarm.h"  // rtcUnixMsAt() for CLOCK_REPLY t3
 #include <WiFi.h>
 #include <esp_wifi.h>
 #include <freertos/FreeRTOS.h>
@@ -24,6 +25,10 @@ static QueueHandle_t gStatusQueue = nullptr;
 static QueueHandle_t gDeployAckQueue = nullptr;
 static QueueHandle_t gDoneQueue = nullptr;
 static QueueHandle_t gReleaseAckQueue = nullptr;
+static QueueHandle_t gOtaNeedQueue = nullptr;
+static QueueHandle_t gOtaResultQueue = nullptr;
+static QueueHandle_t gClockProbeQueue = nullptr;
+static QueueHandle_t gConfigPullQueue = nullptr;
 static constexpr int kControlQueueDepth = 32;
 
 static volatile bool gControlSendActive = false;
@@ -51,24 +56,30 @@ static bool ensureSyncPeer(const uint8_t* mac) {
   return added == ESP_OK || added == ESP_ERR_ESPNOW_EXIST;
 }
 
+// One esp_now_send() that waits up to timeoutMs for its send callback.
+static bool sendControlOnce(const uint8_t* mac, const void* packet, size_t len,
+                            uint32_t timeoutMs) {
+  memcpy(gControlExpectedMac, mac, 6);
+  gControlSendComplete = false;
+  gControlSendStatus = ESP_NOW_SEND_FAIL;
+  gControlSendActive = true;
+  esp_err_t queued = esp_now_send(mac, reinterpret_cast<const uint8_t*>(packet), len);
+  if (queued == ESP_OK) {
+    const uint32_t started = millis();
+    while (!gControlSendComplete && (uint32_t)(millis() - started) < timeoutMs) {
+      delay(1);
+    }
+  }
+  const bool delivered = queued == ESP_OK && gControlSendComplete &&
+                         gControlSendStatus == ESP_NOW_SEND_SUCCESS;
+  gControlSendActive = false;
+  return delivered;
+}
+
 static bool sendControlPacket(const uint8_t* mac, const void* packet, size_t len) {
   if (!mac || !packet || len == 0 || !ensureSyncPeer(mac)) return false;
   for (uint8_t attempt = 1; attempt <= 3; ++attempt) {
-    memcpy(gControlExpectedMac, mac, 6);
-    gControlSendComplete = false;
-    gControlSendStatus = ESP_NOW_SEND_FAIL;
-    gControlSendActive = true;
-    esp_err_t queued = esp_now_send(mac, reinterpret_cast<const uint8_t*>(packet), len);
-    if (queued == ESP_OK) {
-      const uint32_t started = millis();
-      while (!gControlSendComplete && (uint32_t)(millis() - started) < 350UL) {
-        delay(1);
-      }
-    }
-    const bool delivered = queued == ESP_OK && gControlSendComplete &&
-                           gControlSendStatus == ESP_NOW_SEND_SUCCESS;
-    gControlSendActive = false;
-    if (delivered) return true;
+    if (sendControlOnce(mac, packet, len, 350UL)) return true;
     delay(25UL * attempt);
   }
   return false;
@@ -76,6 +87,18 @@ static bool sendControlPacket(const uint8_t* mac, const void* packet, size_t len
 
 // Internal receive handler (ESP-IDF 4.4 API: mac_addr, data, len)
 static void onEspNowRecv(const uint8_t* mac_addr, const uint8_t* data, int len) {
+  // CLOCK_PROBE first: its receive time is t2, so take it before anything else.
+  if (gClockProbeQueue && mac_addr && data &&
+      len == static_cast<int>(sizeof(clock_probe_message_t)) &&
+      strncmp(reinterpret_cast<const char*>(data), "CLOCK_PROBE", 12) == 0) {
+    SyncClockProbeSlot slot{};
+    slot.rxMillis = millis();
+    memcpy(slot.mac, mac_addr, sizeof(slot.mac));
+    memcpy(&slot.probe, data, sizeof(slot.probe));
+    xQueueSendToBack(gClockProbeQueue, &slot, 0);
+    return;
+  }
+
   if (gHelloQueue && mac_addr && data &&
       len == static_cast<int>(sizeof(node_hello_message_t)) &&
       strncmp(reinterpret_cast<const char*>(data), "NODE_HELLO", 10) == 0) {
@@ -143,6 +166,36 @@ static void onEspNowRecv(const uint8_t* mac_addr, const uint8_t* data, int len)
     return;
   }
 
+  if (gOtaNeedQueue && mac_addr && data &&
+      len == static_cast<int>(sizeof(fota_need_message_t)) &&
+      strncmp(reinterpret_cast<const char*>(data), "OTA_NEED", 9) == 0) {
+    SyncOtaNeedSlot slot{};
+    memcpy(slot.mac, mac_addr, sizeof(slot.mac));
+    memcpy(&slot.need, data, sizeof(slot.need));
+    xQueueSendToBack(gOtaNeedQueue, &slot, 0);
+    return;
+  }
+
+  if (gOtaResultQueue && mac_addr && data &&
+      len == static_cast<int>(sizeof(fota_result_message_t)) &&
+      strncmp(reinterpret_cast<const char*>(data), "OTA_RESULT", 11) == 0) {
+    SyncOtaResultSlot slot{};
+    memcpy(slot.mac, mac_addr, sizeof(slot.mac));
+    memcpy(&slot.result, data, sizeof(slot.result));
+    xQueueSendToBack(gOtaResultQueue, &slot, 0);
+    return;
+  }
+
+  if (gConfigPullQueue && mac_addr && data &&
+      len == static_cast<int>(sizeof(config_pull_message_t)) &&
+      strncmp(reinterpret_cast<const char*>(data), "CONFIG_PULL", 12) == 0) {
+    SyncConfigPullSlot slot{};
+    memcpy(slot.mac, mac_addr, sizeof(slot.mac));
+    memcpy(&slot.pull, data, sizeof(slot.pull));
+    xQueueSendToBack(gConfigPullQueue, &slot, 0);
+    return;
+  }
+
   if (gReleaseAckQueue && mac_addr && data &&
       len == static_cast<int>(sizeof(sync_release_ack_message_t)) &&
       strncmp(reinterpret_cast<const char*>(data), "RELEASE_ACK", 12) == 0) {
@@ -324,14 +377,68 @@ void broadcastWakeIntervalNow(int intervalMinutes) {
                 intervalMinutes, result ? "OK" : "FAIL");
 }
 
-void broadcastNodeConfigNow(const node_config_message_t& cfg) {
-  // Broadcast the target node's desired state over the broadcast peer. Only the
-  // addressed node (cfg.nodeId) acts on it; others validate the target and drop.
-  const bool result = sendControlPacket(kBroadcastAddr, &cfg, sizeof(cfg));
-  Serial.printf("[ESP-NOW] NODE_CONFIG -> %.15s v%u target=%u wake=%u syncMin=%u -> %s\n",
+// The frame is cut back to the shortest size that carries every field in use:
+// node firmware older than the aggregation (64), report-by-exception (68) or
+// urgent-threshold (76) fields accepts only the sizes it knows.
+static size_t nodeConfigWireLen(const node_config_message_t& cfg) {
+  return cfg.urgentFlags != 0           ? sizeof(cfg)
+         : cfg.rbeMaxSilenceMin > 0     ? NODE_CONFIG_RBE_SIZE
+         : cfg.aggSamplesPerReport >= 2 ? NODE_CONFIG_AGG_SIZE
+                                        : NODE_CONFIG_LEGACY_SIZE;
+}
+
+bool sendNodeConfigNow(const uint8_t* mac, const node_config_message_t& cfg) {
+  if (!mac) return false;
+  const bool result = sendControlPacket(mac, &cfg, nodeConfigWireLen(cfg));
+  Serial.printf("[ESP-NOW] NODE_CONFIG -> %.15s v%u target=%u wake=%u syncMin=%u agg=%u "
+                "rbe=%u urgent=0x%02X -> %s\n",
                 cfg.nodeId, (unsigned)cfg.configVersion, (unsigned)cfg.targetState,
                 (unsigned)cfg.wakeIntervalMin, (unsigned)cfg.syncIntervalMin,
-                result ? "OK" : "FAIL");
+                (unsigned)cfg.aggSamplesPerReport, (unsigned)cfg.rbeMaxSilenceMin,
+                (unsigned)cfg.urgentFlags, result ? "OK" : "FAIL");
+  return result;
+}
+
+bool broadcastConfigDigest(const config_digest_entry_t* entries, size_t count) {
+  const size_t pages = count == 0 ? 1
+      : (count + CONFIG_DIGEST_MAX_ENTRIES - 1) / CONFIG_DIGEST_MAX_ENTRIES;
+  if (pages > UINT8_MAX) return false;
+  bool allSent = true;
+  for (size_t page = 0; page < pages; ++page) {
+    config_digest_message_t digest{};
+    strncpy(digest.command, "CONFIG_DIGEST", sizeof(digest.command) - 1);
+    const size_t first = page * CONFIG_DIGEST_MAX_ENTRIES;
+    const size_t n = min(count - first, (size_t)CONFIG_DIGEST_MAX_ENTRIES);
+    digest.page = (uint8_t)page;
+    digest.pages = (uint8_t)pages;
+    digest.count = (uint8_t)n;
+    if (n > 0) memcpy(digest.entries, entries + first, n * sizeof(config_digest_entry_t));
+    allSent = sendControlPacket(kBroadcastAddr, &digest,
+                                CONFIG_DIGEST_HEADER_SIZE + n * sizeof(config_digest_entry_t)) &&
+              allSent;
+  }
+  Serial.printf("[ESP-NOW] CONFIG_DIGEST %u node(s) in %u frame(s) -> %s\n",
+                (unsigned)count, (unsigned)pages, allSent ? "OK" : "FAIL");
+  return allSent;
+}
+
+bool broadcastOtaOffer(const fota_offer_message_t& offer) {
+  return sendControlPacket(kBroadcastAddr, &offer, sizeof(offer));
+}
+
+bool broadcastOtaChunk(const fota_chunk_message_t& chunk) {
+  return sendControlOnce(kBroadcastAddr, &chunk, sizeof(chunk), 50UL);
+}
+
+bool sendClockReply(const uint8_t* mac, clock_reply_message_t& reply) {
+  if (!mac || !ensureSyncPeer(mac)) return false;
+  // Two short attempts: the node gives up on a probe after a few hundred ms
+  // and sends the next one, which is worth more than a late reply.
+  for (uint8_t attempt = 1; attempt <= 2; ++attempt) {
+    reply.t3Ms = rtcUnixMsAt(millis());
+    if (sendControlOnce(mac, &reply, sizeof(reply), 120UL)) return true;
+  }
+  return false;
 }
 
 void registerReceiveCallback(EspNowRecvCallback cb) {
@@ -376,14 +483,23 @@ void initSnapQueue(int depth) {
   if (gDeployAckQueue) vQueueDelete(gDeployAckQueue);
   if (gDoneQueue) vQueueDelete(gDoneQueue);
   if (gReleaseAckQueue) vQueueDelete(gReleaseAckQueue);
+  if (gOtaNeedQueue) vQueueDelete(gOtaNeedQueue);
+  if (gOtaResultQueue) vQueueDelete(gOtaResultQueue);
+  if (gClockProbeQueue) vQueueDelete(gClockProbeQueue);
+  if (gConfigPullQueue) vQueueDelete(gConfigPullQueue);
   gHelloQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncHelloSlot));
   gCapsQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncCapsSlot));
   gStatusQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncStatusSlot));
   gDeployAckQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncDeployAckSlot));
   gDoneQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncDoneSlot));
   gReleaseAckQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncReleaseAckSlot));
+  gOtaNeedQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncOtaNeedSlot));
+  gOtaResultQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncOtaResultSlot));
+  gClockProbeQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncClockProbeSlot));
+  gConfigPullQueue = xQueueCreate(kControlQueueDepth, sizeof(SyncConfigPullSlot));
   if (!gHelloQueue || !gCapsQueue || !gStatusQueue || !gDeployAckQueue ||
-      !gDoneQueue || !gReleaseAckQueue) {
+      !gDoneQueue || !gReleaseAckQueue || !gOtaNeedQueue || !gOtaResultQueue ||
+      !gClockProbeQueue || !gConfigPullQueue) {
     Serial.println("[ESP-NOW] coordinated sync queue allocation failed");
   }
 }
@@ -430,6 +546,34 @@ int drainReleaseAcks(SyncReleaseAckSlot* out, int maxItems) {
   return count;
 }
 
+int drainOtaNeeds(SyncOtaNeedSlot* out, int maxItems) {
+  if (!gOtaNeedQueue || !out || maxItems <= 0) return 0;
+  int count = 0;
+  while (count < maxItems && xQueueReceive(gOtaNeedQueue, &out[count], 0) == pdTRUE) ++count;
+  return count;
+}
+
+int drainOtaResults(SyncOtaResultSlot* out, int maxItems) {
+  if (!gOtaResultQueue || !out || maxItems <= 0) return 0;
+  int count = 0;
+  while (count < maxItems && xQueueReceive(gOtaResultQueue, &out[count], 0) == pdTRUE) ++count;
+  return count;
+}
+
+int drainClockProbes(SyncClockProbeSlot* out, int maxItems) {
+  if (!gClockProbeQueue || !out || maxItems <= 0) return 0;
+  int count = 0;
+  while (count < maxItems && xQueueReceive(gClockProbeQueue, &out[count], 0) == pdTRUE) ++count;
+  return count;
+}
+
+int drainConfigPulls(SyncConfigPullSlot* out, int maxItems) {
+  if (!gConfigPullQueue || !out || maxItems <= 0) return 0;
+  int count = 0;
+  while (count < maxItems && xQueueReceive(gConfigPullQueue, &out[count], 0) == pdTRUE) ++count;
+  return count;
+}
+
 int drainConfigAcks(config_apply_ack_message_t* out, int maxAcks) {
   if (!gAckQueue || !out || maxAcks <= 0) return 0;
   int drained = 0;
@@ -490,6 +634,22 @@ void deinitEspNowSync() {
     vQueueDelete(gReleaseAckQueue);
     gReleaseAckQueue = nullptr;
   }
+  if (gOtaNeedQueue) {
+    vQueueDelete(gOtaNeedQueue);
+    gOtaNeedQueue = nullptr;
+  }
+  if (gOtaResultQueue) {
+    vQueueDelete(gOtaResultQueue);
+    gOtaResultQueue = nullptr;
+  }
+  if (gClockProbeQueue) {
+    vQueueDelete(gClockProbeQueue);
+    gClockProbeQueue = nullptr;
+  }
+  if (gConfigPullQueue) {
+    vQueueDelete(gConfigPullQueue);
+    gConfigPullQueue = nullptr;
+  }
   gRecvCallback = nullptr;
   gSyncWindowOpen = false;
   Serial.printf("[ESP-NOW] Sync deinitialized (dropped=%lu)\n",
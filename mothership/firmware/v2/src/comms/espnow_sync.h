@@ -38,31 +38,57 @@ struct SyncReleaseAckSlot {
   sync_release_ack_message_t ack;
 };
 
-struct SyncCapsSlot {
-  uint8_t mac[6];
-  fw_caps_message_t caps;
-};
-
-// An unpaired node emits NODE_STATUS while it stays awake for recovery. The
-// main sync loop validates its stable MAC + nodeId against the registry before
-// sending a recovery DEPLOY_NODE.
-struct SyncStatusSlot {
-  uint8_t mac[6];
-  node_status_message_t status;
-};
-
-struct SyncDeployAckSlot {
-  uint8_t mac[6];
-  deployment_ack_message_t ack;
-};
+struct SyncCapsSlot {
+  uint8_t mac[6];
+  fw_caps_message_t caps;
+};
+
+// An unpaired node emits NODE_STATUS while it stays awake for recovery. The
+// main sync loop validates its stable MAC + nodeId against the registry before
+// sending a recovery DEPLOY_NODE.
+struct SyncStatusSlot {
+  uint8_t mac[6];
+  node_status_message_t status;
+};
+
+struct SyncDeployAckSlot {
+  uint8_t mac[6];
+  deployment_ack_message_t ack;
+};
+
+// Fleet firmware distribution (fleet_ota.h): a node's missing-chunk report and
+// its final armed/installed/failed outcome.
+struct SyncOtaNeedSlot {
+  uint8_t mac[6];
+  fota_need_message_t need;
+};
+
+struct SyncOtaResultSlot {
+  uint8_t mac[6];
+  fota_result_message_t result;
+};
+
+// Two-way clock exchange. rxMillis is millis() in the receive callback, i.e.
+// t2 before it is mapped onto the RTC's millisecond clock.
+struct SyncClockProbeSlot {
+  uint8_t  mac[6];
+  uint32_t rxMillis;
+  clock_probe_message_t probe;
+};
+
+// A node asking for the NODE_CONFIG a CONFIG_DIGEST advertised.
+struct SyncConfigPullSlot {
+  uint8_t mac[6];
+  config_pull_message_t pull;
+};
 
 bool initEspNowSyncOnly(int channel);
 void broadcastSyncWindowOpen();
 bool broadcastSyncSessionOpen(const sync_session_open_message_t& open);
 bool sendDumpGrant(const uint8_t* mac, const dump_grant_message_t& grant);
-bool sendSyncRelease(const uint8_t* mac, const sync_release_message_t& release);
-bool sendSnapshotAckNow(const uint8_t* mac, const snapshot_ack_t& ack);
-bool sendDeploymentNow(const uint8_t* mac, const deployment_command_t& deploy);
+bool sendSyncRelease(const uint8_t* mac, const sync_release_message_t& release);
+bool sendSnapshotAckNow(const uint8_t* mac, const snapshot_ack_t& ack);
+bool sendDeploymentNow(const uint8_t* mac, const deployment_command_t& deploy);
 // Announce a new sync schedule (SET_SYNC_SCHED) to the fleet over the
 // broadcast peer during a sync window. Used to hand a changed schedule to
 // sleeping nodes at the moment they are awake on the OLD schedule.
@@ -75,12 +101,29 @@ void broadcastSyncScheduleNow(int syncIntervalMinutes, uint32_t phaseUnix);
 // is safe to broadcast every window.
 void broadcastWakeIntervalNow(int intervalMinutes);
 
-// Unified declarative NODE_CONFIG broadcast (server -> node). Carries the
+// Unified declarative NODE_CONFIG (server -> node), unicast. Carries the
 // target node's desired state (schedule + targetState + monotonic version).
-// Broadcast every sync window per node; nodes apply only a strictly newer
-// version and ACK via CONFIG_ACK. Supersedes SET_SCHEDULE + SET_SYNC_SCHED +
-// UNPAIR_NODE for deployed nodes.
-void broadcastNodeConfigNow(const node_config_message_t& cfg);
+// Sent to a node whose NODE_HELLO or CONFIG_PULL shows it behind; nodes apply
+// only a strictly newer version and ACK via CONFIG_ACK. Supersedes
+// SET_SCHEDULE + SET_SYNC_SCHED + UNPAIR_NODE for deployed nodes.
+bool sendNodeConfigNow(const uint8_t* mac, const node_config_message_t& cfg);
+
+// Fleet (shortId, configVersion) digest, split over as many CONFIG_DIGEST
+// frames as it needs (CONFIG_DIGEST_MAX_ENTRIES each). Replaces the per-node
+// NODE_CONFIG broadcast in the sync window: its size barely grows with the
+// fleet, and only nodes that are behind cost a full frame.
+bool broadcastConfigDigest(const config_digest_entry_t* entries, size_t count);
+
+// Fleet firmware distribution. The offer goes out like any control broadcast;
+// a chunk is sent once and only waits for its own send callback, which paces
+// the burst at the radio's rate. Lost chunks are repaired by the next OTA_NEED
+// round, not by retrying here.
+bool broadcastOtaOffer(const fota_offer_message_t& offer);
+bool broadcastOtaChunk(const fota_chunk_message_t& chunk);
+
+// Answer a CLOCK_PROBE. t3Ms is stamped from the RTC millisecond clock just
+// before each transmit attempt, so a retry does not report a stale t3.
+bool sendClockReply(const uint8_t* mac, clock_reply_message_t& reply);
 
 void registerReceiveCallback(EspNowRecvCallback cb);
 void espnowSyncLoop();
@@ -90,11 +133,15 @@ uint32_t getSnapDropCount();
 int drainSyncHellos(SyncHelloSlot* out, int maxItems);
 // FW_CAPS collection — nodes report firmware/OTA identity after NODE_HELLO. The
 // receive callback enqueues them; handleSyncWake drains and updates the registry.
-int drainSyncCaps(SyncCapsSlot* out, int maxItems);
-int drainSyncStatuses(SyncStatusSlot* out, int maxItems);
-int drainDeployAcks(SyncDeployAckSlot* out, int maxItems);
-int drainDumpDone(SyncDoneSlot* out, int maxItems);
+int drainSyncCaps(SyncCapsSlot* out, int maxItems);
+int drainSyncStatuses(SyncStatusSlot* out, int maxItems);
+int drainDeployAcks(SyncDeployAckSlot* out, int maxItems);
+int drainDumpDone(SyncDoneSlot* out, int maxItems);
 int drainReleaseAcks(SyncReleaseAckSlot* out, int maxItems);
+int drainOtaNeeds(SyncOtaNeedSlot* out, int maxItems);
+int drainOtaResults(SyncOtaResultSlot* out, int maxItems);
+int drainClockProbes(SyncClockProbeSlot* out, int maxItems);
+int drainConfigPulls(SyncConfigPullSlot* out, int maxItems);
 
 // CONFIG_ACK collection — nodes ACK an applied/UNPAIRED NODE_CONFIG during the
 // sync window. The receive callback enqueues them; handleSyncWake drains and
@@ -68,15 +68,17 @@ bool decodeChunked(const String& encoded, String& decoded, String& error) {
 }  // namespace
 
 bool extractA7670CchPayload(const String& uartBytes, String& httpBytes,
-                           uint32_t& declaredBytes, String& error) {
-  static constexpr const char* kMarker = "+CCHRECV: DATA,0,";
+                           uint32_t& declaredBytes, String& error,
+                           uint8_t session) {
+  char frameMarker[24];
+  snprintf(frameMarker, sizeof(frameMarker), "+CCHRECV: DATA,%u,", (unsigned)session);
   httpBytes = "";
   declaredBytes = 0;
   error = "";
   size_t cursor = 0;
   bool found = false;
   while (cursor < uartBytes.length()) {
-    const int marker = uartBytes.indexOf(kMarker, cursor);
+    const int marker = uartBytes.indexOf(frameMarker, cursor);
     if (marker < 0) break;
     found = true;
     const int lineEnd = uartBytes.indexOf('\n', marker);
@@ -85,7 +87,7 @@ bool extractA7670CchPayload(const String& uartBytes, String& httpBytes,
       return false;
     }
     String lengthText = uartBytes.substring(
-        marker + static_cast<int>(strlen(kMarker)), lineEnd);
+        marker + static_cast<int>(strlen(frameMarker)), lineEnd);
     lengthText.trim();
     if (lengthText.length() == 0) {
       error = "CCHRECV length missing";
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <stdint.h>
+
+// Link-quality upload planning for the mothership's modem session.
+//
+// Pure arithmetic — no Arduino — so the mothership and the native host
+// simulation (tests/test_link_planner_sim.cpp) run the same code.
+//
+// The session used to push the whole backlog whatever the cell looked like.
+// On a marginal cell every POST times out, so the modem stays on for the
+// whole session budget and delivers little or nothing. The planner scores the
+// link measured after registration (RSRP/RSRQ on LTE, RSSI otherwise, how
+// long registration took) against the last kHistoryLen wakes, and picks:
+//   kPlanFull       the backlog, and a staged OTA download if the link is good;
+//   kPlanFreshOnly  status plus the freshest rows only; the backlog and any
+//                   OTA wait for a wake with a better link.
+// Deferral is bounded: after kMaxDeferredWakes in a row, with flash filling
+// up, or with a backlog too small to matter, the backlog goes anyway. An OTA
+// waits at most kMaxOtaDeferredWakes.
+//
+// Each wake is recorded with its modem on-time and the bytes it delivered, so
+// the history also gives modem on-time per delivered kilobyte.
+
+namespace link_planner {
+
+constexpr uint8_t  kHistoryLen = 8;
+constexpr uint8_t  kGoodScore = 55;            // full, no questions asked
+constexpr uint8_t  kPoorScore = 25;            // fresh only
+constexpr uint8_t  kOtaMinScore = 45;
+constexpr uint8_t  kMaxDeferredWakes = 6;
+constexpr uint8_t  kMaxOtaDeferredWakes = 24;     // six hours at 15 min
+constexpr uint8_t  kFlashPressurePct = 55;     // below the 65 % retention mark
+constexpr uint32_t kSmallBacklogBytes = 16384; // about what the fresh lane sends
+constexpr uint32_t kSlowRegistrationMs = 30000;
+// A band whose wakes cost this many times the modem on-time per KB of the
+// best band is not worth a bulk transfer, if a better wake is likely.
+constexpr uint8_t  kCostRatio = 3;
+
+enum Tech : uint8_t { kTechUnknown, kTechGsm, kTechUtran, kTechLte };
+
+struct LinkSample {
+  int16_t  rssiDbm;   // 0 = unknown
+  int16_t  rsrpDbm;   // 0 = unknown (not LTE)
+  int8_t   rsrqDb;    // 0 = unknown
+  uint8_t  tech;      // Tech
+  uint32_t regMs;     // network registration time
+};
+
+inline uint8_t scale(int v, int lo, int hi) {
+  if (v <= lo) return 0;
+  if (v >= hi) return 100;
+  return (uint8_t)((v - lo) * 100 / (hi - lo));
+}
+
+// 0 (no usable link) .. 100.
+inline uint8_t scoreLink(const LinkSample& s) {
+  int score;
+  if (s.rsrpDbm != 0) {
+    const int rsrp = scale(s.rsrpDbm, -125, -85);
+    const int rsrq = s.rsrqDb != 0 ? scale(s.rsrqDb, -20, -8) : rsrp;
+    score = (rsrp * 7 + rsrq * 3) / 10;
+  } else if (s.rssiDbm != 0) {
+    score = scale(s.rssiDbm, -111, -65);
+  } else {
+    score = 0;
+  }
+  // 2G moves a 32 KB body in minutes; treat it as a poor link at best.
+  if (s.tech == kTechGsm && score > kPoorScore + 10) score = kPoorScore + 10;
+  if (s.regMs > kSlowRegistrationMs) score = score > 15 ? score - 15 : 0;
+  return (uint8_t)score;
+}
+
+// One wake, as recorded.
+enum WakeFlags : uint8_t {
+  kWakeDeferred   = 1 << 0,   // backlog held back
+  kWakeFailed     = 1 << 1,   // nothing accepted
+  kWakeNoRegister = 1 << 2,   // never registered (score 0)
+};
+
+struct WakeRecord {
+  uint8_t  score;
+  uint8_t  flags;
+  uint16_t modemOnSec;
+  uint32_t deliveredBytes;
+};
+
+// Persisted with the upload cursor (the hub cold-boots every wake).
+struct History {
+  WakeRecord wakes[kHistoryLen];   // ring, oldest first from `head`
+  uint8_t  count;
+  uint8_t  head;
+  uint8_t  deferredWakes;          // consecutive wakes that held the backlog
+  uint8_t  otaDeferredWakes;       // consecutive wakes that held a staged OTA
+  uint32_t totalModemOnSec;        // lifetime, for the on-time per KB figure
+  uint32_t totalDeliveredKb;
+};
+
+inline const WakeRecord& wakeAt(const History& h, uint8_t i) {
+  return h.wakes[(h.head + i) % kHistoryLen];
+}
+
+inline void record(History& h, const WakeRecord& w) {
+  if (h.count < kHistoryLen) {
+    h.wakes[(h.head + h.count) % kHistoryLen] = w;
+    ++h.count;
+  } else {
+    h.wakes[h.head] = w;
+    h.head = (uint8_t)((h.head + 1) % kHistoryLen);
+  }
+  h.totalModemOnSec += w.modemOnSec;
+  h.totalDeliveredKb += w.deliveredBytes / 1024;
+}
+
+// Modem on-time per delivered KB over the history: ms/KB, 0 = nothing
+// delivered yet.
+inline uint32_t msPerKb(const History& h) {
+  uint64_t onMs = 0, bytes = 0;
+  for (uint8_t i = 0; i < h.count; ++i) {
+    onMs += (uint64_t)wakeAt(h, i).modemOnSec * 1000ULL;
+    bytes += wakeAt(h, i).deliveredBytes;
+  }
+  return bytes >= 1024 ? (uint32_t)(onMs * 1024ULL / bytes) : 0;
+}
+
+enum Plan : uint8_t { kPlanFull, kPlanFreshOnly };
+
+enum Reason : uint8_t {
+  kReasonGoodLink,        // score >= kGoodScore
+  kReasonPoorLink,        // score < kPoorScore
+  kReasonHistoryFails,    // wakes at this score mostly failed
+  kReasonHistoryCostly,   // wakes at this score cost kCostRatio x the best
+  kReasonFairLink,        // in between, history has nothing against it
+  kReasonDeferredTooLong, // kMaxDeferredWakes reached
+  kReasonFlashPressure,   // flash past kFlashPressurePct
+  kReasonSmallBacklog,    // nothing worth holding back
+};
+
+inline const char* reasonStr(Reason r) {
+  switch (r) {
+    case kReasonGoodLink:        return "good-link";
+    case kReasonPoorLink:        return "poor-link";
+    case kReasonHistoryFails:    return "history-fails";
+    case kReasonHistoryCostly:   return "history-costly";
+    case kReasonFairLink:        return "fair-link";
+    case kReasonDeferredTooLong: return "deferred-too-long";
+    case kReasonFlashPressure:   return "flash-pressure";
+    case kReasonSmallBacklog:    return "small-backlog";
+  }
+  return "?";
+}
+
+struct Inputs {
+  uint8_t  score;
+  uint32_t pendingBytes;   // backlog behind the cursor
+  uint8_t  flashPct;
+  bool     otaPending;     // a release is staged for download
+};
+
+struct Decision {
+  Plan   plan;
+  Reason reason;
+  bool   allowOta;
+};
+
+// What the history says about links no better than `score`: wakes in that
+// band mostly failed, or cost kCostRatio x the modem time per KB of wakes
+// clearly better than it.
+inline Reason historyVerdict(const History& h, uint8_t score) {
+  uint8_t band = 0, bandFailed = 0, better = 0;
+  uint64_t bandMs = 0, bandBytes = 0, betterMs = 0, betterBytes = 0;
+  for (uint8_t i = 0; i < h.count; ++i) {
+    const WakeRecord& w = wakeAt(h, i);
+    if (w.flags & (kWakeDeferred | kWakeNoRegister)) continue;
+    if (w.score <= score + 5) {
+      ++band;
+      if (w.flags & kWakeFailed) ++bandFailed;
+      bandMs += (uint64_t)w.modemOnSec * 1000ULL;
+      bandBytes += w.deliveredBytes;
+    } else if (w.score >= score + 15) {
+      ++better;
+      betterMs += (uint64_t)w.modemOnSec * 1000ULL;
+      betterBytes += w.deliveredBytes;
+    }
+  }
+  // Only worth waiting if a better wake has actually happened lately.
+  if (better == 0 || band == 0) return kReasonFairLink;
+  if (band >= 2 && bandFailed * 2 >= band) return kReasonHistoryFails;
+  if (bandBytes >= 1024 && betterBytes >= 1024 &&
+      bandMs * betterBytes > (uint64_t)kCostRatio * betterMs * bandBytes) {
+    return kReasonHistoryCostly;
+  }
+  if (bandBytes < 1024 && bandFailed > 0) return kReasonHistoryFails;
+  return kReasonFairLink;
+}
+
+inline Decision decide(const History& h, const Inputs& in) {
+  Decision d{kPlanFull, kReasonGoodLink, false};
+  if (in.score >= kGoodScore) {
+    d.reason = kReasonGoodLink;
+  } else if (in.score < kPoorScore) {
+    d.plan = kPlanFreshOnly;
+    d.reason = kReasonPoorLink;
+  } else {
+    d.reason = historyVerdict(h, in.score);
+    if (d.reason != kReasonFairLink) d.plan = kPlanFreshOnly;
+  }
+  // Bounded deferral.
+  if (d.plan == kPlanFreshOnly) {
+    if (in.pendingBytes <= kSmallBacklogBytes) {
+      d.plan = kPlanFull;
+      d.reason = kReasonSmallBacklog;
+    } else if (in.flashPct >= kFlashPressurePct) {
+      d.plan = kPlanFull;
+      d.reason = kReasonFlashPressure;
+    } else if (h.deferredWakes >= kMaxDeferredWakes) {
+      d.plan = kPlanFull;
+      d.reason = kReasonDeferredTooLong;
+    }
+  }
+  d.allowOta = in.otaPending &&
+      ((d.plan == kPlanFull && in.score >= kOtaMinScore) ||
+       h.otaDeferredWakes >= kMaxOtaDeferredWakes);
+  return d;
+}
+
+// Close a wake: record it and update the deferral streaks.
+inline void finishWake(History& h, const Decision& d, bool otaPending,
+                       const WakeRecord& w) {
+  record(h, w);
+  h.deferredWakes = d.plan == kPlanFreshOnly && h.deferredWakes < 255
+      ? (uint8_t)(h.deferredWakes + 1) : 0;
+  if (!otaPending || d.allowOta) {
+    h.otaDeferredWakes = 0;
+  } else if (h.otaDeferredWakes < 255) {
+    ++h.otaDeferredWakes;
+  }
+}
+
+}  // namespace link_planner
@@ -7,6 +7,7 @@
 #include "modem_driver.h"
 #include "comms/http_response_parser.h"
 #include "comms/cch_stream_reader.h"
+#include "comms/registration_hint.h"
 
 // ---------------------------------------------------------------------------
 // Constructor
@@ -317,10 +318,84 @@ bool ModemDriver::powerOn() {
 // waitForNetwork()
 // ---------------------------------------------------------------------------
 
+void ModemDriver::setRegistrationHint(const char* plmn, uint8_t act, uint32_t windowMs) {
+  m_hintPlmn = plmn ? plmn : "";
+  m_hintAct = act;
+  m_hintWindowMs = windowMs;
+}
+
 bool ModemDriver::waitForNetwork(uint32_t timeoutMs) {
   Serial.printf("=== ModemDriver::waitForNetwork(%lu ms) ===\n",
                 (unsigned long)timeoutMs);
 
+  const unsigned long start = millis();
+  m_regCpsi = "";
+  m_regPath = reg_hint::kPathScan;
+  const bool hinted = m_hintPlmn.length() > 0 &&
+      (m_hintAct == reg_hint::kActLte || m_hintAct == reg_hint::kActGsm);
+  bool registered = false;
+  if (hinted) {
+    // Both settings persist in module NVM. Every waitForNetwork() that scans
+    // puts automatic selection back first, so a hint only ever steers the
+    // attach it was set for.
+    String resp;
+    Serial.printf("[Modem] registration hint: PLMN %s, %s only, %lu ms window\n",
+                  m_hintPlmn.c_str(), m_hintAct == reg_hint::kActLte ? "LTE" : "GSM",
+                  (unsigned long)m_hintWindowMs);
+    sendAT(m_hintAct == reg_hint::kActLte ? "AT+CNMP=38" : "AT+CNMP=13", resp, 3000);
+    // Answers only once the attempt is over; pollRegistration() flushes the
+    // late OK, and a CREG?/CEREG? the modem defers meanwhile just times out.
+    const String cops = "AT+COPS=4,2,\"" + m_hintPlmn + "\"," + String((unsigned)m_hintAct);
+    sendAT(cops.c_str(), resp, 2000);
+    m_regPath = reg_hint::kPathHint;
+    registered = pollRegistration(m_hintWindowMs < timeoutMs ? m_hintWindowMs : timeoutMs);
+    if (!registered) {
+      Serial.printf("[Modem] not registered on the hint after %lu ms — full scan\n",
+                    (unsigned long)(millis() - start));
+      m_regPath = reg_hint::kPathFallback;
+    }
+  }
+  if (!registered) {
+    restoreAutomaticSelection();
+    const uint32_t elapsed = millis() - start;
+    registered = elapsed < timeoutMs && pollRegistration(timeoutMs - elapsed);
+  }
+  // One wake, one hint.
+  m_hintPlmn = "";
+  m_hintAct = 0xFF;
+  if (!registered) {
+    m_regPath = reg_hint::kPathFailed;
+    Serial.println("[Modem] waitForNetwork() — timeout, not registered");
+    return false;
+  }
+  String resp;
+  if (sendAT("AT+CPSI?", resp, 2000)) {
+    const int idx = resp.indexOf("+CPSI:");
+    if (idx >= 0) {
+      const int end = resp.indexOf('\r', idx);
+      m_regCpsi = end > idx ? resp.substring(idx + 6, end) : resp.substring(idx + 6);
+      m_regCpsi.trim();
+    }
+  }
+  Serial.printf("[Modem] registered via %s in %lu ms: %s\n",
+                reg_hint::pathStr(m_regPath), (unsigned long)(millis() - start),
+                m_regCpsi.c_str());
+  return true;
+}
+
+void ModemDriver::restoreAutomaticSelection() {
+  String resp;
+  if (!sendAT("AT+CNMP?", resp, 2000) || resp.indexOf("+CNMP: 2") < 0) {
+    sendAT("AT+CNMP=2", resp, 3000);
+  }
+  if (!sendAT("AT+COPS?", resp, 2000) || resp.indexOf("+COPS: 0") < 0) {
+    // Starts the automatic search; like the manual form it may only answer
+    // once that is over.
+    sendAT("AT+COPS=0", resp, 2000);
+  }
+}
+
+bool ModemDriver::pollRegistration(uint32_t timeoutMs) {
   unsigned long start = millis();
   while (millis() - start < timeoutMs) {
     String resp;
@@ -346,8 +421,6 @@ bool ModemDriver::waitForNetwork(uint32_t timeoutMs) {
 
     delay(2000);  // poll every 2 seconds
   }
-
-  Serial.println("[Modem] waitForNetwork() — timeout, not registered");
   return false;
 }
 
@@ -468,13 +541,15 @@ HttpsPostResult ModemDriver::httpsPost(const String& url,
 // reliable across firmware versions.
 // ---------------------------------------------------------------------------
 
-static bool chunkedCchSend(const String& data, uint32_t chunkSize = 1024) {
+static bool chunkedCchSend(const String& data, uint32_t chunkSize = 1024,
+                           uint8_t session = 0) {
   uint32_t offset = 0;
   uint32_t total = data.length();
+  const String dataMarker = "+CCHRECV: DATA," + String(session);
 
   while (offset < total) {
     uint32_t thisChunk = (total - offset < chunkSize) ? (total - offset) : chunkSize;
-    String sendCmd = "AT+CCHSEND=0," + String(thisChunk);
+    String sendCmd = "AT+CCHSEND=" + String(session) + "," + String(thisChunk);
 
     // Flush RX
     while (Serial2.available()) { Serial2.read(); }
@@ -521,8 +596,9 @@ static bool chunkedCchSend(const String& data, uint32_t chunkSize = 1024) {
         char c = (char)Serial2.read();
         resp += c;
         if (resp.indexOf("OK\r\n") >= 0) { gotOk = true; break; }
-        // Detect early server response (error during send)
-        if (resp.indexOf("+CCHRECV") >= 0 || resp.indexOf("HTTP/1.") >= 0) {
+        // Detect early server response (error during send). Only this
+        // session's data: with upload sessions the other one may be answering.
+        if (resp.indexOf(dataMarker) >= 0 || resp.indexOf("HTTP/1.") >= 0) {
           Serial.printf("[Modem] CCHSEND chunk %u-%u: early server response detected\n",
                         (unsigned)offset, (unsigned)(offset + thisChunk));
           Serial.println(resp);
@@ -911,6 +987,241 @@ bool ModemDriver::httpsPostSSL(const String& host, int port,
   return result.success;
 }
 
+// ---------------------------------------------------------------------------
+// Upload sessions — pipelined POSTs on CCH sessions 0 and 1
+//
+// Same transport as httpsPostSSL(), set up once: PDP, NETOPEN, NTP and the SSL
+// context happen in beginUploadSessions(), not per POST. Receive is manual
+// (AT+CCHSET=0,1): the modem caches each session's response until we pull it
+// with AT+CCHRECV=<session>,<n>, so no DATA frame for one session can arrive
+// in the middle of a CCHSEND on the other, and the RX flushes in sendAT() and
+// chunkedCchSend() cannot eat a response.
+// ---------------------------------------------------------------------------
+
+bool ModemDriver::cchOpenSession(uint8_t session, const String& host, int port,
+                                 String& error) {
+  const String openCmd = "AT+CCHOPEN=" + String(session) + ",\"" + host + "\"," +
+                         String(port) + ",2";
+  const String urc = "+CCHOPEN: " + String(session) + ",";
+  Serial.printf("[Modem] CCHOPEN: %s\n", openCmd.c_str());
+
+  while (Serial2.available()) { Serial2.read(); }
+  Serial2.print(openCmd);
+  Serial2.print("\r\n");
+  Serial2.flush();
+
+  String resp = "";
+  const unsigned long start = millis();
+  while (millis() - start < 30000) {
+    while (Serial2.available()) {
+      resp += (char)Serial2.read();
+    }
+    const int urcIdx = resp.indexOf(urc);
+    if (urcIdx >= 0 && urcIdx + (int)urc.length() < (int)resp.length()) {
+      const char code = resp.charAt(urcIdx + urc.length());
+      if (code == '0') return true;
+      if (code >= '1' && code <= '9') break;
+    }
+    delay(10);
+  }
+  error = "CCHOPEN " + String(session) + " failed: " + resp;
+  return false;
+}
+
+bool ModemDriver::beginUploadSessions(const String& url) {
+  if (!url.startsWith("https://")) {
+    Serial.println("[Modem] upload sessions: HTTPS only");
+    return false;
+  }
+  String host = url.substring(8);
+  String path = "/";
+  int port = 443;
+  const int slashIdx = host.indexOf('/');
+  if (slashIdx >= 0) {
+    path = host.substring(slashIdx);
+    host = host.substring(0, slashIdx);
+  }
+  const int colonIdx = host.indexOf(':');
+  if (colonIdx >= 0) {
+    port = host.substring(colonIdx + 1).toInt();
+    host = host.substring(0, colonIdx);
+  }
+  Serial.printf("[Modem] === upload sessions: host=%s port=%d path=%s ===\n",
+                host.c_str(), port, path.c_str());
+
+  configurePdpContext();
+  String resp;
+  if (!sendAT("AT+NETOPEN", resp, 15000)) {
+    Serial.println("[Modem] upload sessions: AT+NETOPEN failed: " + resp);
+    return false;
+  }
+  delay(3000);
+  m_state = ModemState::TRANSPORT_OPEN;
+
+  // NTP + SSL context, as httpsPostSSL() does per POST.
+  sendAT("AT+CNTP=\"pool.ntp.org\",32", resp, 5000);
+  sendAT("AT+CNTP", resp, 15000);
+  delay(3000);
+  sendAT("AT+CSSLCFG=\"sslversion\",0,4", resp, 2000);
+  sendAT("AT+CSSLCFG=\"authmode\",0,0", resp, 2000);
+  sendAT("AT+CSSLCFG=\"ignorelocaltime\",0,1", resp, 2000);
+  sendAT("AT+CSSLCFG=\"enableSNI\",0,1", resp, 2000);
+  sendAT("AT+CSSLCFG=\"negotiatetime\",0,300", resp, 2000);
+
+  if (!sendAT("AT+CCHSTART", resp, 30000)) {
+    Serial.println("[Modem] upload sessions: AT+CCHSTART failed: " + resp);
+    sendAT("AT+NETCLOSE", resp, 5000);
+    m_state = ModemState::REGISTERED;
+    return false;
+  }
+  // Both sessions use SSL context 0; manual receive, no send-result URC.
+  sendAT("AT+CCHSSLCFG=0,0", resp, 5000);
+  sendAT("AT+CCHSSLCFG=1,0", resp, 5000);
+  if (!sendAT("AT+CCHSET=0,1", resp, 2000)) {
+    Serial.println("[Modem] upload sessions: manual receive not accepted: " + resp);
+    sendAT("AT+CCHSTOP", resp, 5000);
+    sendAT("AT+NETCLOSE", resp, 5000);
+    m_state = ModemState::REGISTERED;
+    return false;
+  }
+
+  m_uploadHost = host;
+  m_uploadPort = port;
+  m_uploadPath = path;
+  m_sessionOpen[0] = m_sessionOpen[1] = false;
+  m_uploadSessions = true;
+  m_state = ModemState::UPLOAD_ACTIVE;
+  return true;
+}
+
+bool ModemDriver::uploadSend(uint8_t session, const String& payload,
+                             const String& contentType, const String& authToken) {
+  if (!m_uploadSessions || session > 1 || m_sessionOpen[session]) return false;
+
+  String httpReq = "POST " + m_uploadPath + " HTTP/1.1\r\n";
+  httpReq += "Host: " + m_uploadHost + "\r\n";
+  httpReq += "Content-Type: " + contentType + "\r\n";
+  httpReq += "Content-Length: " + String(payload.length()) + "\r\n";
+  if (authToken.length() > 0) {
+    httpReq += "Authorization: Bearer " + authToken + "\r\n";
+  }
+  httpReq += "Connection: close\r\n";
+  httpReq += "\r\n";
+  httpReq += payload;
+
+  String error;
+  if (!cchOpenSession(session, m_uploadHost, m_uploadPort, error)) {
+    Serial.println("[Modem] " + error);
+    return false;
+  }
+  m_sessionOpen[session] = true;
+  delay(1000);
+
+  if (!chunkedCchSend(httpReq, 1024, session)) {
+    Serial.printf("[Modem] session %u: CCHSEND chunked send failed\n", (unsigned)session);
+    String resp;
+    const String closeCmd = "AT+CCHCLOSE=" + String(session);
+    sendAT(closeCmd.c_str(), resp, 2000);
+    m_sessionOpen[session] = false;
+    return false;
+  }
+  Serial.printf("[Modem] session %u: %u request bytes sent\n",
+                (unsigned)session, (unsigned)httpReq.length());
+  return true;
+}
+
+HttpsPostResult ModemDriver::uploadCollect(uint8_t session, uint32_t timeoutMs) {
+  HttpsPostResult result;
+  if (!m_uploadSessions || session > 1 || !m_sessionOpen[session]) {
+    result.errorDetail = "upload session not open";
+    return result;
+  }
+
+  const String pullCmd = "AT+CCHRECV=" + String(session) + ",1400";
+  const String closedUrc = "+CCH_PEER_CLOSED: " + String(session);
+  String resp;
+  String http;
+  String frameError;
+  uint32_t declared = 0;
+  bool peerClosed = false;
+  HttpResponseParseResult parsed;
+  const unsigned long start = millis();
+  unsigned long lastDataAt = start;
+
+  while (millis() - start < timeoutMs) {
+    Serial2.print(pullCmd);
+    Serial2.print("\r\n");
+    Serial2.flush();
+    // The inter-byte gap delimits this pull's response, as in the streaming GET.
+    unsigned long lastRx = millis();
+    bool sawAny = false;
+    while (true) {
+      while (Serial2.available()) {
+        resp += (char)Serial2.read();
+        sawAny = true;
+        lastRx = millis();
+      }
+      if (sawAny && millis() - lastRx > 60) break;
+      if (!sawAny && millis() - lastRx > 3000) break;
+      delay(2);
+    }
+    if (resp.indexOf(closedUrc) >= 0) peerClosed = true;
+    const size_t httpBefore = http.length();
+    if (extractA7670CchPayload(resp, http, declared, frameError, session)) {
+      parsed = parseHttpResponseBytes(http, peerClosed);
+      if (parsed.headersComplete && parsed.bodyComplete) break;
+    }
+    if (http.length() > httpBefore) lastDataAt = millis();
+    if (resp.length() > 20 * 1024) {
+      frameError = "response too large";
+      break;
+    }
+    if (peerClosed && millis() - lastDataAt > 1000) break;
+    // Nothing cached yet: the server is still working on it.
+    if (http.length() == httpBefore) delay(200);
+  }
+
+  result.responseWireBytes = resp.length();
+  result.responseHttpBytes = http.length();
+  result.responseComplete = parsed.headersComplete && parsed.bodyComplete;
+  if (result.responseComplete) {
+    result.httpStatus = parsed.statusCode;
+    result.responseBody = parsed.body;
+    result.success = (result.httpStatus == 200 || result.httpStatus == 302);
+    if (!result.success) result.errorDetail = "HTTP status " + String(result.httpStatus);
+  } else {
+    result.errorDetail = "Incomplete SSL HTTP response on session " + String(session) + ": " +
+        (frameError.length() > 0 ? frameError
+         : parsed.error.length() > 0 ? parsed.error : String("timeout"));
+  }
+  Serial.printf("[Modem] session %u: HTTP %d complete=%d wireBytes=%u bodyBytes=%u in %lu ms\n",
+                (unsigned)session, result.httpStatus, result.responseComplete ? 1 : 0,
+                (unsigned)result.responseWireBytes, (unsigned)result.responseBody.length(),
+                (unsigned long)(millis() - start));
+
+  String closeResp;
+  const String closeCmd = "AT+CCHCLOSE=" + String(session);
+  sendAT(closeCmd.c_str(), closeResp, 2000);
+  m_sessionOpen[session] = false;
+  return result;
+}
+
+void ModemDriver::endUploadSessions() {
+  if (!m_uploadSessions) return;
+  String resp;
+  for (uint8_t s = 0; s < 2; ++s) {
+    if (!m_sessionOpen[s]) continue;
+    const String closeCmd = "AT+CCHCLOSE=" + String(s);
+    sendAT(closeCmd.c_str(), resp, 2000);
+    m_sessionOpen[s] = false;
+  }
+  sendAT("AT+CCHSTOP", resp, 5000);
+  sendAT("AT+NETCLOSE", resp, 5000);
+  m_uploadSessions = false;
+  m_state = ModemState::REGISTERED;
+  Serial.println("[Modem] === upload sessions closed ===");
+}
+
 // ---------------------------------------------------------------------------
 // httpsPostTCP — TCP POST via CIP* API
 // ---------------------------------------------------------------------------
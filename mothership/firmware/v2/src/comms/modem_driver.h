@@ -113,8 +113,22 @@ class ModemDriver {
 
   // Poll AT+CREG? and AT+CEREG? for registration (1=home, 5=roaming).
   // Returns false on timeout. MUST NOT block forever.
+  // With a registration hint set, the first windowMs of the timeout prefer
+  // the hinted PLMN and system mode; after that, and without a hint, the
+  // modem is in automatic selection (AT+CNMP=2, AT+COPS=0) for a full scan.
   bool waitForNetwork(uint32_t timeoutMs);
 
+  // Prefer this cell on the next waitForNetwork() (comms/registration_hint.h):
+  // AT+CNMP to its system mode only, then AT+COPS=4 (manual, automatic on
+  // failure) on its PLMN. plmn = MCC+MNC digits; act = 3GPP AcT, 0 GSM or
+  // 7 LTE. Undone after windowMs without registration.
+  void setRegistrationHint(const char* plmn, uint8_t act, uint32_t windowMs);
+
+  // How the last waitForNetwork() registered, as a reg_hint::Path, and the
+  // +CPSI: serving-cell line read right after it did ("" if not registered).
+  uint8_t registrationPath() const { return m_regPath; }
+  const String& registeredCpsi() const { return m_regCpsi; }
+
   // HTTP/HTTPS POST via the A7670G socket API.
   // HTTPS uses CCH* API (CCHSTART/CCHOPEN/CCHSEND) with NTP sync + SNI.
   // Explicit HTTP URLs use CIP* API (CIPOPEN/CIPSEND); HTTPS never downgrades.
@@ -140,6 +154,29 @@ class ModemDriver {
                                       const String& authToken = "",
                                       const String& rangeHeader = "");
 
+  // --- Pipelined HTTPS uploads (two CCH sessions) ---------------------------
+  // httpsPost() brings the data path up and down around every request: PDP,
+  // NETOPEN, NTP, CCHSTART, one session, then all of it torn down again. For a
+  // backlog of many chunks that fixed cost dominates, and the UART idles while
+  // the server processes each one. An upload session keeps the TLS service up
+  // across POSTs and runs them on CCH sessions 0 and 1 in manual-receive mode:
+  // a response waits in the modem until uploadCollect() pulls it, so the next
+  // request can be sent on the other session meanwhile. Each request is still
+  // its own "Connection: close" TLS connection. HTTPS only.
+  //
+  // beginUploadSessions() -> { uploadSend(s) ... uploadCollect(s) }* ->
+  // endUploadSessions(). Collect in send order (comms/upload_pipeline.h).
+  bool beginUploadSessions(const String& url);
+  // Open session `session` and send one POST on it. False = nothing (or not
+  // all of it) went out; the session is closed again.
+  bool uploadSend(uint8_t session, const String& payload,
+                  const String& contentType, const String& authToken);
+  // Pull the response to the POST on `session` and close the session. Only a
+  // complete HTTP response counts; anything else is httpStatus -1.
+  HttpsPostResult uploadCollect(uint8_t session, uint32_t timeoutMs = 30000);
+  // Close whatever is still open, CCHSTOP, NETCLOSE.
+  void endUploadSessions();
+
   // AT+CPOF -> wait STATUS LOW -> PWRKEY 2.5s fallback -> rail off.
   void gracefulShutdown();
 
@@ -175,6 +212,19 @@ class ModemDriver {
   String m_apnUser;
   String m_apnPass;
 
+  // Registration hint (setRegistrationHint()) and how the last attach went.
+  String   m_hintPlmn;
+  uint8_t  m_hintAct = 0xFF;
+  uint32_t m_hintWindowMs = 0;
+  uint8_t  m_regPath = 0;
+  String   m_regCpsi;
+
+  // Poll AT+CREG?/AT+CEREG? until registered or timeoutMs.
+  bool pollRegistration(uint32_t timeoutMs);
+
+  // AT+CNMP=2 and AT+COPS=0, each only if not already set.
+  void restoreAutomaticSelection();
+
   // AT+CGDCONT (+ AT+CGAUTH when credentials are set) then AT+CGACT. Shared by
   // httpsPost() and httpsGetStream(), which each carried their own copy of this
   // block with the APN hardcoded into it.
@@ -204,6 +254,16 @@ class ModemDriver {
   // Serial2.begin if not already started. Flush RX buffer.
   void startUart();
 
+  // Upload sessions (beginUploadSessions()).
+  bool   m_uploadSessions = false;
+  bool   m_sessionOpen[2] = {false, false};
+  String m_uploadHost;
+  int    m_uploadPort = 443;
+  String m_uploadPath;
+
+  // AT+CCHOPEN=<session>,... and wait for its result URC.
+  bool cchOpenSession(uint8_t session, const String& host, int port, String& error);
+
   // SSL/TLS POST via CCH* API (internal helpers)
   bool httpsPostSSL(const String& host, int port,
                     const String& httpReq, HttpsPostResult& result);
@@ -0,0 +1,98 @@
+#include "comms/registration_cache.h"
+
+#include <Preferences.h>
+
+#include "comms/registration_hint.h"
+
+using namespace reg_hint;
+
+namespace {
+
+constexpr const char* kNamespace = "reghint";
+constexpr const char* kKeyState  = "state";
+constexpr uint8_t     kStoredVersion = 1;
+
+struct Stored {
+  uint8_t version;
+  State   state;
+};
+
+Stored gStored{};
+bool   gLoaded = false;
+bool   gHintTried = false;
+
+void load() {
+  if (gLoaded) return;
+  gLoaded = true;
+  gStored = Stored{};
+  gStored.state.cell.act = kActUnknown;
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return;
+  Stored s{};
+  const bool ok = prefs.getBytesLength(kKeyState) == sizeof(s) &&
+                  prefs.getBytes(kKeyState, &s, sizeof(s)) == sizeof(s) &&
+                  s.version == kStoredVersion &&
+                  memchr(s.state.cell.plmn, '\0', sizeof(s.state.cell.plmn)) != nullptr;
+  prefs.end();
+  if (ok) gStored = s;
+}
+
+void save() {
+  gStored.version = kStoredVersion;
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  prefs.putBytes(kKeyState, &gStored, sizeof(gStored));
+  prefs.end();
+}
+
+}  // namespace
+
+void registrationCacheApply(ModemDriver& modem) {
+  load();
+  const State& s = gStored.state;
+  gHintTried = hasHint(s);
+  if (!gHintTried) {
+    Serial.printf("[REG] no registration hint (%s) — full scan\n",
+                  s.cell.plmn[0] == '\0' ? "no cell cached" : "too many misses");
+    return;
+  }
+  modem.setRegistrationHint(s.cell.plmn, s.cell.act, hintWindowMs(s));
+}
+
+void registrationCacheRegistered(const ModemDriver& modem, uint32_t regTimeMs) {
+  load();
+  Cell cell{};
+  const bool haveCell = parseCpsi(modem.registeredCpsi().c_str(), cell);
+  recordRegistered(gStored.state, modem.registrationPath(), regTimeMs,
+                   haveCell ? &cell : nullptr);
+  save();
+  const State& s = gStored.state;
+  Serial.printf("[REG] %s attach in %lu ms (hinted avg %lu ms over %u, scan avg %lu ms "
+                "over %u); cell %s band %u earfcn %lu\n",
+                pathStr(s.lastPath), (unsigned long)regTimeMs,
+                (unsigned long)s.hintAvgMs, (unsigned)s.hintWakes,
+                (unsigned long)s.scanAvgMs, (unsigned)s.scanWakes,
+                s.cell.plmn, (unsigned)s.cell.band, (unsigned long)s.cell.earfcn);
+}
+
+void registrationCacheFailed(uint32_t regTimeMs) {
+  load();
+  recordFailed(gStored.state, gHintTried, regTimeMs);
+  save();
+}
+
+String registrationCacheDiagJson() {
+  load();
+  const State& s = gStored.state;
+  if (s.hintWakes == 0 && s.scanWakes == 0) return String("{}");
+  return String("{\"path\":\"") + pathStr(s.lastPath) +
+         "\",\"regMs\":" + String((unsigned long)s.lastRegMs) +
+         ",\"hintAvgMs\":" + String((unsigned long)s.hintAvgMs) +
+         ",\"scanAvgMs\":" + String((unsigned long)s.scanAvgMs) +
+         ",\"hintWakes\":" + String((unsigned)s.hintWakes) +
+         ",\"scanWakes\":" + String((unsigned)s.scanWakes) +
+         ",\"plmn\":\"" + s.cell.plmn +
+         "\",\"band\":" + String((unsigned)s.cell.band) +
+         ",\"earfcn\":" + String((unsigned long)s.cell.earfcn) +
+         ",\"misses\":" + String((unsigned)s.misses) + "}";
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "comms/modem_driver.h"
+
+// ---------------------------------------------------------------------------
+// Registration cache (comms/registration_hint.h)
+// ---------------------------------------------------------------------------
+// Each wake cold-boots the modem, and automatic selection scans every band of
+// GSM and LTE before it registers. The serving cell of the last registration
+// (+CPSI: PLMN, system mode, band, EARFCN) is kept in NVS namespace "reghint"
+// and handed to ModemDriver::setRegistrationHint() before the next attach, so
+// the modem starts on that PLMN and system mode and only falls back to the
+// full scan when it does not register there in time. Hint misses in a row
+// drop the hint for a while.
+//
+// Registration time is averaged separately for hinted and scanned attaches;
+// status.diagnostics.reg reports both next to this wake's regTimeMs, which is
+// the gain.
+//
+// PSM/eDRX re-attach is not used: the board removes power from the modem
+// between wakes (releasePwrHold()), so there is no context for it to keep.
+
+// Load the cached cell and, if it is still trusted, set it as the hint for
+// the next modem.waitForNetwork(). Call before it, once per attach.
+void registrationCacheApply(ModemDriver& modem);
+
+// The attach registered after regTimeMs: record how (modem.registrationPath())
+// and the cell it registered on (modem.registeredCpsi()).
+void registrationCacheRegistered(const ModemDriver& modem, uint32_t regTimeMs);
+
+// The attach never registered.
+void registrationCacheFailed(uint32_t regTimeMs);
+
+// {"path","regMs","hintAvgMs","scanAvgMs","hintWakes","scanWakes","plmn",
+//  "band","earfcn","misses"} for status.diagnostics. "{}" before an attach.
+String registrationCacheDiagJson();
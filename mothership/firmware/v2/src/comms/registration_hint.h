@@ -0,0 +1,190 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Registration hint for the mothership's cellular modem.
+//
+// Pure parsing and bookkeeping — no Arduino — so the mothership and the
+// native host test (tests/test_registration_hint_sim.cpp) run the same code.
+//
+// Every sync wake cold-boots the A7670G (the board drops all power between
+// wakes), and with automatic selection it scans every band of every access
+// technology before it registers. The serving cell of the last good session
+// is in AT+CPSI? — PLMN, system mode, band, EARFCN — and a hub that does not
+// move almost always lands on it again. The mothership keeps that cell here
+// and, on the next power-on, starts with a preference for it:
+//   AT+CNMP=<that mode only>    no GSM scan when the last cell was LTE;
+//   AT+COPS=4,2,"<plmn>",<AcT>  manual selection of that PLMN, which the
+//                               modem itself falls back from to automatic.
+// If nothing registers within hintWindowMs() the preferences are undone
+// (AT+CNMP=2, AT+COPS=0) and the rest of the budget is a full scan. Hint
+// misses are counted; kMaxMisses in a row drop the hint until a full scan
+// learns a new cell, or for kRetryAfterScans wakes.
+//
+// Band locking is deliberately not applied: the A7670's band mask persists in
+// module NVM, and a stale lock after a cell change would outlive this code's
+// fallback. The band and EARFCN are kept to notice a cell change and for the
+// diagnostics.
+
+namespace reg_hint {
+
+constexpr uint8_t  kMaxMisses = 3;
+constexpr uint8_t  kRetryAfterScans = 8;   // then try a dropped hint again
+constexpr uint32_t kMinWindowMs = 12000;
+constexpr uint32_t kMaxWindowMs = 30000;
+
+// 3GPP AcT (AT+COPS) values this modem can register on.
+constexpr uint8_t kActGsm = 0;
+constexpr uint8_t kActLte = 7;
+constexpr uint8_t kActUnknown = 0xFF;
+
+// How the last registration went.
+enum Path : uint8_t {
+  kPathScan,       // no hint: automatic selection from the start
+  kPathHint,       // registered inside the hint window
+  kPathFallback,   // hint window missed, registered on the full scan
+  kPathFailed,     // never registered
+};
+
+inline const char* pathStr(uint8_t p) {
+  switch (p) {
+    case kPathScan:     return "scan";
+    case kPathHint:     return "hint";
+    case kPathFallback: return "fallback";
+    case kPathFailed:   return "failed";
+  }
+  return "?";
+}
+
+struct Cell {
+  char     plmn[7];   // MCC+MNC digits, e.g. "50501"; "" = unknown
+  uint8_t  act;       // kActGsm / kActLte / kActUnknown
+  uint16_t band;      // LTE band number or GSM band in MHz; 0 = unknown
+  uint32_t earfcn;    // LTE EARFCN or GSM ARFCN; 0 = unknown
+};
+
+// Leading decimal digits of s[0..n), after any spaces.
+inline int32_t atoiN(const char* s, size_t n) {
+  size_t i = 0;
+  while (i < n && s[i] == ' ') ++i;
+  int32_t v = 0;
+  for (; i < n && s[i] >= '0' && s[i] <= '9'; ++i) v = v * 10 + (s[i] - '0');
+  return v;
+}
+
+// Parse the text after "+CPSI:" (ModemDiagnostics::cpsi), e.g.
+//   LTE,Online,505-01,0x30D4,135402508,349,EUTRAN-BAND3,1275,5,5,-94,-1052,-727,15
+//   GSM,Online,460-00,0x182d,12401,27 EGSM900,-64,2110,42-42
+// False for "NO SERVICE" and anything without a usable PLMN.
+inline bool parseCpsi(const char* line, Cell& out) {
+  out = Cell{};
+  out.act = kActUnknown;
+  if (!line) return false;
+  while (*line == ' ') ++line;
+  // Split into up to 8 fields.
+  const char* f[8] = {};
+  size_t len[8] = {};
+  uint8_t n = 0;
+  const char* p = line;
+  while (n < 8) {
+    f[n] = p;
+    const char* c = strchr(p, ',');
+    len[n] = c ? (size_t)(c - p) : strlen(p);
+    ++n;
+    if (!c) break;
+    p = c + 1;
+  }
+  if (n < 3) return false;
+  if (len[0] == 3 && strncmp(f[0], "LTE", 3) == 0) out.act = kActLte;
+  else if (len[0] == 3 && strncmp(f[0], "GSM", 3) == 0) out.act = kActGsm;
+  else return false;
+  // MCC-MNC: 3 digits, '-', 2 or 3 digits.
+  const char* m = f[2];
+  if (len[2] < 6 || len[2] > 7 || m[3] != '-') return false;
+  uint8_t d = 0;
+  for (size_t i = 0; i < len[2]; ++i) {
+    if (i == 3) continue;
+    if (m[i] < '0' || m[i] > '9') return false;
+    out.plmn[d++] = m[i];
+  }
+  out.plmn[d] = '\0';
+  if (out.act == kActLte && n >= 8) {
+    // EUTRAN-BAND<n>,<earfcn>
+    const char* b = strstr(f[6], "BAND");
+    if (b && b < f[6] + len[6]) out.band = (uint16_t)atoiN(b + 4, f[6] + len[6] - (b + 4));
+    out.earfcn = (uint32_t)atoiN(f[7], len[7]);
+  } else if (out.act == kActGsm && n >= 6) {
+    // <arfcn> <band name>, e.g. "27 EGSM900"
+    out.earfcn = (uint32_t)atoiN(f[5], len[5]);
+    const char* s = f[5];
+    const char* e = f[5] + len[5];
+    while (s < e && (*s < '0' || *s > '9')) ++s;   // skip to ARFCN
+    while (s < e && *s >= '0' && *s <= '9') ++s;   // past it
+    while (s < e && (*s < '0' || *s > '9')) ++s;   // to the band's MHz
+    out.band = (uint16_t)atoiN(s, (size_t)(e - s));
+  }
+  return true;
+}
+
+// Persisted between wakes (the hub cold-boots every wake).
+struct State {
+  Cell     cell;           // last cell registered on; plmn "" = no hint
+  uint8_t  misses;         // hint windows missed in a row
+  uint8_t  lastPath;       // Path of the last wake
+  uint32_t lastRegMs;
+  uint32_t hintAvgMs;      // EWMA (1/4) of registrations on the hint; 0 = none
+  uint32_t scanAvgMs;      // EWMA of scans and fallbacks; 0 = none
+  uint16_t hintWakes;
+  uint16_t scanWakes;
+};
+
+inline bool hasHint(const State& s) {
+  return s.cell.plmn[0] != '\0' && s.cell.act != kActUnknown && s.misses < kMaxMisses;
+}
+
+// How long to give the hinted cell before undoing the preferences: three
+// times what it usually takes, within [kMinWindowMs, kMaxWindowMs].
+inline uint32_t hintWindowMs(const State& s) {
+  const uint32_t w = s.hintAvgMs * 3;
+  return w < kMinWindowMs ? kMinWindowMs : w > kMaxWindowMs ? kMaxWindowMs : w;
+}
+
+inline uint32_t ewma(uint32_t avg, uint32_t sample) {
+  return avg == 0 ? sample : (avg * 3 + sample) / 4;
+}
+
+// A wake registered (path kPathScan / kPathHint / kPathFallback) after regMs;
+// `cell` is what AT+CPSI? reported then (false from parseCpsi: keep the old).
+inline void recordRegistered(State& s, uint8_t path, uint32_t regMs,
+                             const Cell* cell) {
+  s.lastPath = path;
+  s.lastRegMs = regMs;
+  if (path == kPathHint) {
+    s.hintAvgMs = ewma(s.hintAvgMs, regMs);
+    if (s.hintWakes < 0xFFFF) ++s.hintWakes;
+    s.misses = 0;
+  } else {
+    s.scanAvgMs = ewma(s.scanAvgMs, regMs);
+    if (s.scanWakes < 0xFFFF) ++s.scanWakes;
+    if (path == kPathFallback) {
+      ++s.misses;
+    } else if (s.misses >= kMaxMisses && ++s.misses >= kMaxMisses + kRetryAfterScans) {
+      s.misses = 0;
+    }
+  }
+  if (cell && cell->plmn[0] != '\0') {
+    // A different PLMN or system mode is a new cell: start its count afresh.
+    if (strcmp(cell->plmn, s.cell.plmn) != 0 || cell->act != s.cell.act) s.misses = 0;
+    s.cell = *cell;
+  }
+}
+
+// A wake never registered. A miss only if the hint was tried.
+inline void recordFailed(State& s, bool hintTried, uint32_t regMs) {
+  s.lastPath = kPathFailed;
+  s.lastRegMs = regMs;
+  if (hintTried) ++s.misses;
+}
+
+}  // namespace reg_hint
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Upload chunk sizing for the mothership's JSON upload loop.
+//
+// Pure arithmetic — no Arduino — so the mothership and the native host
+// simulation (tests/test_upload_chunk_sim.cpp) run the same code.
+//
+// The loop used a fixed 8 KB CSV chunk, tuned after the 2026-08-01 heap
+// truncation. On a good link with free heap that wastes round trips; on a
+// fragmented heap it can still be too big. Each chunk is now sized from:
+//   - the heap: the JSON body is one contiguous String of ~4x the CSV bytes
+//     (largest free block), the build peaks at ~8x (free heap);
+//   - the link: a fit of POST time against body bytes gives a fixed cost per
+//     POST (TLS, AT round trips, server) and a throughput; a chunk is sized to
+//     finish within kTargetPostMs;
+//   - the session: what is left of it after kSessionReserveMs;
+//   - the backend: maxRows readings per POST.
+// A chunk grows at most 2x per successful POST and halves on a failed one.
+
+namespace upload_sizing {
+
+constexpr uint32_t kMinChunkBytes = 2048;
+constexpr uint32_t kStartChunkBytes = 8192;    // the fixed size it replaces
+constexpr uint32_t kMaxChunkBytes = 32768;
+constexpr uint32_t kBodyPerCsvByte = 4;        // largest single allocation
+constexpr uint32_t kPeakPerCsvByte = 8;        // whole build
+constexpr uint32_t kHeapMarginBytes = 24576;   // TLS, modem buffers, response
+constexpr uint32_t kTargetPostMs = 25000;      // stays well inside modem timeouts
+constexpr uint32_t kSessionReserveMs = 30000;  // control heartbeat + shutdown
+constexpr uint32_t kDefaultOverheadMs = 3000;  // until the fit has two sizes
+constexpr float kDecay = 0.8f;                 // weight kept by older samples
+
+// Persisted between sessions (the hub cold-boots every wake).
+struct State {
+  uint32_t chunkBytes;    // next CSV chunk, before this POST's caps
+  uint32_t rowBytes;      // CSV bytes per row, smoothed (0 = unknown)
+  uint8_t  failures;      // consecutive failed POSTs
+  // Decayed least-squares sums of (body bytes, POST ms).
+  float    w, sx, sy, sxx, sxy;
+};
+
+inline State initialState() {
+  State s{};
+  s.chunkBytes = kStartChunkBytes;
+  return s;
+}
+
+// Link model from the fit: fixed ms per POST, and body bytes per second
+// (0 = no estimate yet).
+struct Link {
+  uint32_t overheadMs;
+  uint32_t bytesPerSec;
+};
+
+inline Link linkModel(const State& s) {
+  Link l{kDefaultOverheadMs, 0};
+  if (s.w <= 0.0f) return l;
+  const float mx = s.sx / s.w;
+  const float my = s.sy / s.w;
+  const float varX = s.sxx / s.w - mx * mx;
+  const float covXY = s.sxy / s.w - mx * my;
+  // A usable fit needs POSTs of different sizes and a positive slope.
+  if (varX > 1.0e6f && covXY > 0.0f) {
+    const float msPerByte = covXY / varX;
+    float intercept = my - msPerByte * mx;
+    if (intercept < 0.0f) intercept = 0.0f;
+    l.overheadMs = (uint32_t)intercept;
+    l.bytesPerSec = (uint32_t)(1000.0f / msPerByte);
+    return l;
+  }
+  // One size so far: keep the default overhead, attribute the rest to bytes.
+  if (my > (float)kDefaultOverheadMs + 1.0f && mx > 0.0f) {
+    l.bytesPerSec = (uint32_t)(mx * 1000.0f / (my - (float)kDefaultOverheadMs));
+  }
+  return l;
+}
+
+// What bound the decision, for the diagnostics log.
+enum Limit : uint8_t {
+  kLimitGrowth,   // 2x growth step (or the halved size after a failure)
+  kLimitLink,     // kTargetPostMs at the measured throughput
+  kLimitSession,  // what is left of the session
+  kLimitBlock,    // largest free heap block
+  kLimitHeap,     // free heap
+  kLimitRows,     // maxRows readings per POST
+  kLimitMax,      // kMaxChunkBytes
+  kLimitFloor,    // raised to kMinChunkBytes
+};
+
+inline const char* limitStr(Limit l) {
+  switch (l) {
+    case kLimitGrowth:  return "growth";
+    case kLimitLink:    return "link";
+    case kLimitSession: return "session";
+    case kLimitBlock:   return "block";
+    case kLimitHeap:    return "heap";
+    case kLimitRows:    return "rows";
+    case kLimitMax:     return "max";
+    case kLimitFloor:   return "floor";
+  }
+  return "?";
+}
+
+struct Inputs {
+  uint32_t freeHeap;
+  uint32_t maxAllocHeap;
+  uint32_t remainingMs;   // session time left
+  uint16_t maxRows;       // backend readings-per-POST cap
+};
+
+struct Decision {
+  uint32_t chunkBytes;
+  Limit limit;
+};
+
+inline Decision decide(const State& s, const Inputs& in) {
+  Decision d{s.chunkBytes ? s.chunkBytes : kStartChunkBytes, kLimitGrowth};
+  auto cap = [&d](uint32_t bytes, Limit why) {
+    if (bytes < d.chunkBytes) {
+      d.chunkBytes = bytes;
+      d.limit = why;
+    }
+  };
+  cap(kMaxChunkBytes, kLimitMax);
+
+  const Link link = linkModel(s);
+  if (link.bytesPerSec > 0) {
+    const uint32_t postMs = kTargetPostMs > link.overheadMs ? kTargetPostMs - link.overheadMs : 0;
+    cap((uint32_t)((uint64_t)postMs * link.bytesPerSec / 1000ULL / kBodyPerCsvByte), kLimitLink);
+    const uint32_t budget = in.remainingMs > kSessionReserveMs + link.overheadMs
+        ? in.remainingMs - kSessionReserveMs - link.overheadMs : 0;
+    cap((uint32_t)((uint64_t)budget * link.bytesPerSec / 1000ULL / kBodyPerCsvByte),
+        kLimitSession);
+  }
+  const uint32_t blockMargin = kHeapMarginBytes / 4;
+  cap(in.maxAllocHeap > blockMargin ? (in.maxAllocHeap - blockMargin) / kBodyPerCsvByte : 0,
+      kLimitBlock);
+  cap(in.freeHeap > kHeapMarginBytes ? (in.freeHeap - kHeapMarginBytes) / kPeakPerCsvByte : 0,
+      kLimitHeap);
+  if (s.rowBytes > 0 && in.maxRows > 0) {
+    cap((uint32_t)in.maxRows * s.rowBytes, kLimitRows);
+  }
+  if (d.chunkBytes < kMinChunkBytes) {
+    d.chunkBytes = kMinChunkBytes;
+    d.limit = kLimitFloor;
+  }
+  return d;
+}
+
+// A POST of bodyBytes carrying rows readings (csvBytes of CSV) took postMs and
+// was accepted. sentChunkBytes is the size decide() gave for it.
+inline void recordSuccess(State& s, uint32_t sentChunkBytes, uint32_t csvBytes,
+                          uint32_t bodyBytes, uint16_t rows, uint32_t postMs) {
+  const float x = (float)bodyBytes;
+  const float y = (float)postMs;
+  s.w = s.w * kDecay + 1.0f;
+  s.sx = s.sx * kDecay + x;
+  s.sy = s.sy * kDecay + y;
+  s.sxx = s.sxx * kDecay + x * x;
+  s.sxy = s.sxy * kDecay + x * y;
+  if (rows > 0 && csvBytes > 0) {
+    const uint32_t perRow = csvBytes / rows;
+    s.rowBytes = s.rowBytes ? (s.rowBytes * 3 + perRow) / 4 : perRow;
+  }
+  s.failures = 0;
+  uint64_t next = (uint64_t)sentChunkBytes * 2ULL;
+  if (next > kMaxChunkBytes) next = kMaxChunkBytes;
+  s.chunkBytes = (uint32_t)next;
+}
+
+// A POST failed in a way a smaller one might not (transport error, timeout,
+// 5xx, JSON build out of heap).
+inline void recordFailure(State& s, uint32_t sentChunkBytes) {
+  if (s.failures < 255) ++s.failures;
+  uint32_t next = sentChunkBytes / 2;
+  if (next < kMinChunkBytes) next = kMinChunkBytes;
+  s.chunkBytes = next;
+}
+
+}  // namespace upload_sizing
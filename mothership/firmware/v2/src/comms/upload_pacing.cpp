@@ -0,0 +1,136 @@
+#include "comms/upload_pacing.h"
+
+#include <Preferences.h>
+
+#include "comms/upload_chunk_sizer.h"
+
+using namespace upload_sizing;
+
+namespace {
+
+constexpr const char* kNamespace = "uppace";
+constexpr const char* kKeyState  = "state";
+constexpr uint8_t     kStoredVersion = 1;
+
+// One session, as reported in status.diagnostics.uplink.
+struct Summary {
+  uint16_t posts;
+  uint16_t failures;
+  uint32_t csvBytes;     // accepted
+  uint32_t postMs;       // all POSTs, accepted or not
+  uint32_t bytesPerSec;  // body bytes, from the fit at session end
+  uint32_t overheadMs;
+  uint32_t chunkBytes;   // last decision
+  uint8_t  limit;        // what bound it (upload_sizing::Limit)
+};
+
+struct Stored {
+  uint8_t version;
+  State   state;
+  Summary last;
+};
+
+Stored   gStored{};
+bool     gLoaded = false;
+Summary  gSession{};
+uint32_t gLastChunk = 0;   // 0 = nothing paced this session
+
+void load() {
+  if (gLoaded) return;
+  gLoaded = true;
+  gStored = Stored{};
+  gStored.state = initialState();
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return;
+  Stored s{};
+  const bool ok = prefs.getBytesLength(kKeyState) == sizeof(s) &&
+                  prefs.getBytes(kKeyState, &s, sizeof(s)) == sizeof(s) &&
+                  s.version == kStoredVersion;
+  prefs.end();
+  if (!ok) return;
+  // A chunk size from a different build's limits would be clamped by decide()
+  // anyway, but a corrupt one must not reach it.
+  if (s.state.chunkBytes < kMinChunkBytes || s.state.chunkBytes > kMaxChunkBytes) {
+    s.state.chunkBytes = kStartChunkBytes;
+  }
+  gStored = s;
+}
+
+}  // namespace
+
+uint32_t uploadPaceNextChunk(uint32_t sessionStartMs, uint32_t sessionLimitMs,
+                             uint16_t maxRows) {
+  load();
+  const uint32_t elapsed = millis() - sessionStartMs;
+  Inputs in{};
+  in.freeHeap = ESP.getFreeHeap();
+  in.maxAllocHeap = ESP.getMaxAllocHeap();
+  in.remainingMs = elapsed < sessionLimitMs ? sessionLimitMs - elapsed : 0;
+  in.maxRows = maxRows;
+  const Decision d = decide(gStored.state, in);
+  const Link link = linkModel(gStored.state);
+  gLastChunk = d.chunkBytes;
+  gSession.chunkBytes = d.chunkBytes;
+  gSession.limit = d.limit;
+  Serial.printf("[UPLOAD] pace: chunk %u B (limit=%s) heap %u free / %u block, "
+                "link %u ms + %u B/s, %u s left\n",
+                (unsigned)d.chunkBytes, limitStr(d.limit),
+                (unsigned)in.freeHeap, (unsigned)in.maxAllocHeap,
+                (unsigned)link.overheadMs, (unsigned)link.bytesPerSec,
+                (unsigned)(in.remainingMs / 1000));
+  return d.chunkBytes;
+}
+
+void uploadPaceSuccess(uint32_t csvBytes, uint32_t bodyBytes, uint16_t rows,
+                       uint32_t postMs) {
+  if (gLastChunk == 0) return;
+  recordSuccess(gStored.state, gLastChunk, csvBytes, bodyBytes, rows, postMs);
+  ++gSession.posts;
+  gSession.csvBytes += csvBytes;
+  gSession.postMs += postMs;
+  Serial.printf("[UPLOAD] pace: %u B body in %u ms (%u B/s), next chunk up to %u B\n",
+                (unsigned)bodyBytes, (unsigned)postMs,
+                (unsigned)(postMs ? (uint64_t)bodyBytes * 1000ULL / postMs : 0),
+                (unsigned)gStored.state.chunkBytes);
+}
+
+void uploadPaceFailure() {
+  if (gLastChunk == 0) return;
+  recordFailure(gStored.state, gLastChunk);
+  ++gSession.posts;
+  ++gSession.failures;
+  Serial.printf("[UPLOAD] pace: failure %u in a row, next chunk %u B\n",
+                (unsigned)gStored.state.failures, (unsigned)gStored.state.chunkBytes);
+}
+
+void uploadPaceFinish() {
+  if (gLastChunk == 0) return;
+  const Link link = linkModel(gStored.state);
+  gSession.bytesPerSec = link.bytesPerSec;
+  gSession.overheadMs = link.overheadMs;
+  gStored.version = kStoredVersion;
+  gStored.last = gSession;
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  prefs.putBytes(kKeyState, &gStored, sizeof(gStored));
+  prefs.end();
+  Serial.printf("[UPLOAD] pace: session %u POSTs (%u failed), %u CSV bytes in %u ms\n",
+                (unsigned)gSession.posts, (unsigned)gSession.failures,
+                (unsigned)gSession.csvBytes, (unsigned)gSession.postMs);
+  gSession = Summary{};
+  gLastChunk = 0;
+}
+
+String uploadPaceDiagJson() {
+  load();
+  const Summary& s = gStored.last;
+  if (s.posts == 0) return String("{}");
+  return String("{\"posts\":") + String((unsigned)s.posts) +
+         ",\"failures\":" + String((unsigned)s.failures) +
+         ",\"csvBytes\":" + String((unsigned long)s.csvBytes) +
+         ",\"postMs\":" + String((unsigned long)s.postMs) +
+         ",\"bytesPerSec\":" + String((unsigned long)s.bytesPerSec) +
+         ",\"overheadMs\":" + String((unsigned long)s.overheadMs) +
+         ",\"chunkBytes\":" + String((unsigned long)s.chunkBytes) +
+         ",\"limit\":\"" + limitStr((Limit)s.limit) + "\"}";
+}
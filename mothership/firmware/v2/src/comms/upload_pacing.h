@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Upload chunk pacing (comms/upload_chunk_sizer.h)
+// ---------------------------------------------------------------------------
+// The JSON upload loop used a fixed 8 KB CSV chunk. Each chunk is now sized
+// from the heap as it stands (free heap, largest free block), the link as the
+// previous POSTs measured it (a fit of POST time against body size: fixed
+// cost per POST plus throughput) and what is left of the sync session,
+// capped at the backend's readings-per-POST. It grows at most 2x per
+// accepted POST and halves on a failed one.
+//
+// The controller state persists in NVS namespace "uppace" so a session starts
+// from what the last one learned; it is written once per session, by
+// uploadPaceFinish(). Each decision is logged with what bound it, and the
+// summary of the previous session is reported in status.diagnostics.uplink.
+
+// CSV bytes for the next chunk. Logs the decision.
+uint32_t uploadPaceNextChunk(uint32_t sessionStartMs, uint32_t sessionLimitMs,
+                             uint16_t maxRows);
+
+// The chunk from the last uploadPaceNextChunk() went out as bodyBytes of JSON
+// (csvBytes of CSV, rows readings) and was accepted after postMs.
+void uploadPaceSuccess(uint32_t csvBytes, uint32_t bodyBytes, uint16_t rows,
+                       uint32_t postMs);
+
+// It failed in a way a smaller chunk might not: transport error, timeout,
+// 5xx, 413, or the JSON build ran out of heap.
+void uploadPaceFailure();
+
+// Persist the controller and this session's summary. Call once, after the
+// upload loop. No-op when nothing was paced this session.
+void uploadPaceFinish();
+
+// The previous session's summary as a JSON object for status.diagnostics:
+// {"posts","failures","csvBytes","postMs","bytesPerSec","overheadMs",
+//  "chunkBytes","limit"}. "{}" before the first paced session.
+String uploadPaceDiagJson();
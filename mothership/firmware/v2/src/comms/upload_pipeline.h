@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdint.h>
+
+// In-order commit window for the mothership's pipelined upload.
+//
+// Pure bookkeeping — no Arduino, no modem — so the mothership's upload loop
+// and the native host simulation (tests/test_upload_pipeline_sim.cpp) run the
+// same code.
+//
+// The A7670G's CCH stack carries more than one TLS session. With two, chunk
+// N+1 is built and sent on one session while the server is still processing
+// chunk N on the other, instead of the UART idling through every response.
+// Responses can only be trusted in send order, though: the upload cursor is a
+// single byte offset, and it must never move past a chunk the backend has not
+// acknowledged. The window enforces that:
+//   - chunks are sent at increasing offsets, alternating sessions;
+//   - responses are collected oldest first;
+//   - a chunk commits (the caller advances the cursor to its end) only when it
+//     was accepted AND every chunk before it committed;
+//   - the first chunk that is not accepted stops the window. Chunks behind it
+//     are still collected (their sessions must be closed) but never committed;
+//     the backend dedupes any of their rows it stored, when they are sent
+//     again.
+
+namespace upload_pipeline {
+
+constexpr uint8_t kSessions = 2;   // CCH session indexes 0 and 1
+
+struct Chunk {
+  uint32_t start;        // byte offset of the chunk's first row
+  uint32_t end;          // one past its last row; the cursor moves here
+  uint16_t rows;
+  uint32_t csvBytes;
+  uint32_t bodyBytes;
+  uint32_t sentAtMs;
+  bool     carriesStatus;
+};
+
+// How the backend answered one chunk.
+enum Outcome : uint8_t {
+  kAccepted,    // stored (or a recognised duplicate)
+  kRetryable,   // transport error, timeout, 408/429/5xx
+  kRejected,    // any other 4xx, or 200 with nothing stored
+};
+
+// What the caller does with a collected chunk.
+enum Action : uint8_t {
+  kCommit,      // advance the cursor to chunk.end
+  kStop,        // first failure: leave the cursor; stopReason() says why
+  kDiscard,     // behind a failure: collected, never committed
+};
+
+class Window {
+ public:
+  explicit Window(uint32_t cursor) : committed_(cursor), next_(cursor) {}
+
+  // Room for another chunk on the air, and nothing has failed.
+  bool canSend() const { return !closed() && count_ < kSessions; }
+  // Session index for the next chunk.
+  uint8_t sendSession() const { return sendSession_; }
+  // Where the next chunk starts: the end of the last one sent.
+  uint32_t nextOffset() const { return next_; }
+
+  void sent(const Chunk& c) {
+    slots_[(head_ + count_) % kSessions] = c;
+    sessions_[(head_ + count_) % kSessions] = sendSession_;
+    ++count_;
+    next_ = c.end;
+    sendSession_ = (uint8_t)((sendSession_ + 1) % kSessions);
+  }
+
+  // Stop sending without a failure (session time, heap, a chunk the builder
+  // could not turn into readings). Chunks on the air still commit.
+  void close() { closed_ = true; }
+
+  bool pending() const { return count_ > 0; }
+  // Session of the oldest chunk on the air: collect this one next.
+  uint8_t collectSession() const { return sessions_[head_]; }
+  const Chunk& oldest() const { return slots_[head_]; }
+
+  Action collected(Outcome o, Chunk& out) {
+    out = slots_[head_];
+    head_ = (uint8_t)((head_ + 1) % kSessions);
+    --count_;
+    if (stopped_) return kDiscard;
+    if (o == kAccepted) {
+      committed_ = out.end;
+      ++commits_;
+      return kCommit;
+    }
+    stopped_ = true;
+    stopReason_ = o;
+    return kStop;
+  }
+
+  bool stopped() const { return stopped_; }
+  bool closed() const { return closed_ || stopped_; }
+  Outcome stopReason() const { return stopReason_; }
+  // Everything below this offset is acknowledged.
+  uint32_t committed() const { return committed_; }
+  uint32_t commits() const { return commits_; }
+
+ private:
+  Chunk    slots_[kSessions]{};
+  uint8_t  sessions_[kSessions]{};
+  uint8_t  head_ = 0;
+  uint8_t  count_ = 0;
+  uint8_t  sendSession_ = 0;
+  bool     stopped_ = false;
+  bool     closed_ = false;
+  Outcome  stopReason_ = kAccepted;
+  uint32_t committed_;
+  uint32_t next_;
+  uint32_t commits_ = 0;
+};
+
+}  // namespace upload_pipeline
@@ -0,0 +1,117 @@
+#include "comms/upload_planner.h"
+
+#include <Preferences.h>
+
+#include "comms/link_planner.h"
+
+using namespace link_planner;
+
+namespace {
+
+// Same namespace as the upload cursor (storage/upload_queue.cpp).
+constexpr const char* kNamespace = "tx";
+constexpr const char* kKeyHistory = "link_hist";
+constexpr uint8_t     kStoredVersion = 1;
+
+struct Stored {
+  uint8_t version;
+  History history;
+};
+
+Stored   gStored{};
+bool     gLoaded = false;
+bool     gPlanned = false;
+uint8_t  gScore = 0;
+Decision gDecision{};
+bool     gOtaPending = false;
+
+void load() {
+  if (gLoaded) return;
+  gLoaded = true;
+  gStored = Stored{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return;
+  Stored s{};
+  const bool ok = prefs.getBytesLength(kKeyHistory) == sizeof(s) &&
+                  prefs.getBytes(kKeyHistory, &s, sizeof(s)) == sizeof(s) &&
+                  s.version == kStoredVersion &&
+                  s.history.count <= kHistoryLen && s.history.head < kHistoryLen;
+  prefs.end();
+  if (ok) gStored = s;
+}
+
+void save() {
+  gStored.version = kStoredVersion;
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  prefs.putBytes(kKeyHistory, &gStored, sizeof(gStored));
+  prefs.end();
+}
+
+uint8_t techFromString(const String& t) {
+  if (t.startsWith("LTE") || t.indexOf("CAT") >= 0) return kTechLte;
+  if (t.startsWith("GSM")) return kTechGsm;
+  if (t.indexOf("UTRAN") >= 0 || t.indexOf("WCDMA") >= 0 ||
+      t.indexOf("HSPA") >= 0) return kTechUtran;
+  return kTechUnknown;
+}
+
+uint16_t toSec(uint32_t ms) {
+  const uint32_t s = ms / 1000;
+  return s > 0xFFFF ? 0xFFFF : (uint16_t)s;
+}
+
+}  // namespace
+
+UploadPlan uploadPlanWake(const ModemDiagnostics& diag, uint32_t regTimeMs,
+                          uint32_t pendingBytes, uint8_t flashPct, bool otaPending) {
+  load();
+  const LinkSample s{(int16_t)diag.rssiDbm, (int16_t)diag.rsrpDbm, (int8_t)diag.rsrqDb,
+                     techFromString(diag.accessTech), regTimeMs};
+  gScore = scoreLink(s);
+  gDecision = decide(gStored.history, {gScore, pendingBytes, flashPct, otaPending});
+  gOtaPending = otaPending;
+  gPlanned = true;
+  Serial.printf("[PLAN] link score %u (rssi %d rsrp %d rsrq %d %s, reg %lu ms): %s (%s), "
+                "%u B pending, deferred %u wakes, OTA %s\n",
+                (unsigned)gScore, diag.rssiDbm, diag.rsrpDbm, diag.rsrqDb,
+                diag.accessTech.c_str(), (unsigned long)regTimeMs,
+                gDecision.plan == kPlanFull ? "full" : "fresh only",
+                reasonStr(gDecision.reason), (unsigned)pendingBytes,
+                (unsigned)gStored.history.deferredWakes,
+                !otaPending ? "none staged" : gDecision.allowOta ? "allowed" : "deferred");
+  return UploadPlan{gDecision.plan == kPlanFreshOnly, gDecision.allowOta};
+}
+
+void uploadPlanFinish(uint32_t modemOnMs, uint32_t deliveredBytes, bool anySuccess) {
+  if (!gPlanned) return;
+  uint8_t flags = 0;
+  if (gDecision.plan == kPlanFreshOnly) flags |= kWakeDeferred;
+  if (!anySuccess) flags |= kWakeFailed;
+  finishWake(gStored.history, gDecision, gOtaPending,
+             {gScore, flags, toSec(modemOnMs), deliveredBytes});
+  save();
+  Serial.printf("[PLAN] wake: %lu ms modem on, %lu B delivered; history %lu ms/KB "
+                "(lifetime %lu s for %lu KB)\n",
+                (unsigned long)modemOnMs, (unsigned long)deliveredBytes,
+                (unsigned long)msPerKb(gStored.history),
+                (unsigned long)gStored.history.totalModemOnSec,
+                (unsigned long)gStored.history.totalDeliveredKb);
+  gPlanned = false;
+}
+
+void uploadPlanNoRegistration(uint32_t modemOnMs) {
+  load();
+  // Not a deferral: the streaks carry on to the next wake that registers.
+  record(gStored.history, {0, kWakeNoRegister | kWakeFailed, toSec(modemOnMs), 0});
+  save();
+}
+
+String uploadPlanDiagJson() {
+  if (!gPlanned) return String("{}");
+  return String("{\"score\":") + String((unsigned)gScore) +
+         ",\"plan\":\"" + (gDecision.plan == kPlanFull ? "full" : "fresh") +
+         "\",\"reason\":\"" + reasonStr(gDecision.reason) +
+         "\",\"msPerKb\":" + String((unsigned long)msPerKb(gStored.history)) +
+         ",\"deferred\":" + String((unsigned)gStored.history.deferredWakes) + "}";
+}
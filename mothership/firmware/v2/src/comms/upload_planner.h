@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "comms/modem_driver.h"
+
+// ---------------------------------------------------------------------------
+// Link-quality upload planning (comms/link_planner.h)
+// ---------------------------------------------------------------------------
+// The JSON session pushed the whole backlog whatever the cell looked like; on
+// a marginal cell every POST timed out and the modem stayed on for the whole
+// session budget. Once registered, the session now scores the link (RSRP and
+// RSRQ on LTE, RSSI otherwise, registration time) against the last few
+// wakes. On a poor link only status and the fresh lane go out; the backlog and
+// a staged OTA download wait for a wake with a better link, for a bounded
+// number of wakes (link_planner::kMaxDeferredWakes / kMaxOtaDeferredWakes),
+// and never while flash is filling.
+//
+// The per-wake history lives next to the upload cursor (NVS namespace "tx",
+// key "link_hist") and records each wake's score, modem on-time and the CSV
+// bytes it delivered. It is written once per wake, by uploadPlanFinish() or
+// uploadPlanNoRegistration(); status.diagnostics.link reports it.
+
+struct UploadPlan {
+  bool deferBacklog;   // status + fresh lane only
+  bool allowOta;       // a staged release may download this wake
+};
+
+// Decide this wake's plan from the live link. Call once, while registered.
+// pendingBytes is the backlog behind the cursor; otaPending whether a release
+// is staged. Logs the decision.
+UploadPlan uploadPlanWake(const ModemDiagnostics& diag, uint32_t regTimeMs,
+                          uint32_t pendingBytes, uint8_t flashPct, bool otaPending);
+
+// Record the wake: modem on-time from power-on, CSV bytes the backend
+// accepted, whether anything was accepted at all.
+void uploadPlanFinish(uint32_t modemOnMs, uint32_t deliveredBytes, bool anySuccess);
+
+// Record a wake that never registered (score 0, nothing delivered).
+void uploadPlanNoRegistration(uint32_t modemOnMs);
+
+// This wake's plan and the history's cost, for status.diagnostics:
+// {"score","plan","reason","msPerKb","deferred"}. "{}" before a plan.
+String uploadPlanDiagJson();
@@ -0,0 +1,165 @@
+#include "comms/urgent_relay.h"
+#include "config/node_registry.h"
+#include "time/rtc_alarm.h"
+#include "urgent_listen.h"
+
+#include <Preferences.h>
+#include <string.h>
+#include <vector>
+
+namespace {
+
+constexpr const char* kNamespace  = "urgent";
+constexpr const char* kKeyListen  = "listen_at";   // armed listen wake, 0 = none
+constexpr const char* kKeySync    = "sync_at";     // the sync wake it displaced
+constexpr const char* kKeyMin     = "listen_min";  // cadence it was armed with
+constexpr const char* kKeySeen    = "seen";
+constexpr const char* kKeyLatN    = "lat_n";
+constexpr const char* kKeyLatMax  = "lat_max";
+// An RTC wake this close to the armed listen wake is that wake (the alarm is
+// exact; this only absorbs a slow boot).
+constexpr uint32_t kListenWakeSlackSec = 60;
+
+struct SeenEntry {
+  char     nodeId[16];  // wire nodeId width; "" = free
+  uint32_t seqNum;
+  uint32_t nodeTimestamp;
+};
+
+struct SeenTable {
+  uint8_t   head;
+  uint8_t   reserved[3];
+  SeenEntry entries[kUrgentSeenLen];
+};
+
+SeenTable gSeen{};
+bool      gSeenLoaded = false;
+
+void loadSeen() {
+  if (gSeenLoaded) return;
+  gSeenLoaded = true;
+  memset(&gSeen, 0, sizeof(gSeen));
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return;
+  const bool ok = prefs.getBytesLength(kKeySeen) == sizeof(gSeen) &&
+                  prefs.getBytes(kKeySeen, &gSeen, sizeof(gSeen)) == sizeof(gSeen);
+  prefs.end();
+  if (!ok || gSeen.head >= kUrgentSeenLen) memset(&gSeen, 0, sizeof(gSeen));
+}
+
+void saveSeen() {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  prefs.putBytes(kKeySeen, &gSeen, sizeof(gSeen));
+  prefs.end();
+}
+
+SeenEntry* findSeen(const char* nodeId, uint32_t seqNum, uint32_t nodeTimestamp) {
+  if (!nodeId || !nodeId[0]) return nullptr;
+  loadSeen();
+  for (auto& e : gSeen.entries) {
+    if (e.nodeId[0] && e.seqNum == seqNum && e.nodeTimestamp == nodeTimestamp &&
+        strncmp(e.nodeId, nodeId, sizeof(e.nodeId)) == 0) {
+      return &e;
+    }
+  }
+  return nullptr;
+}
+
+void saveListen(uint32_t listenAt, uint32_t syncAt, uint32_t listenMin) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  prefs.putULong(kKeyListen, listenAt);
+  prefs.putULong(kKeySync, syncAt);
+  prefs.putULong(kKeyMin, listenMin);
+  prefs.end();
+}
+
+}  // namespace
+
+uint32_t urgentListenIntervalMin(int fleetWakeMin) {
+  std::vector<uint8_t> wakes;
+  for (const auto& n : registeredNodes) {
+    if (n.state != DEPLOYED || n.recordingPaused) continue;
+    const NodeDesiredConfig dc = getDesiredConfig(n.nodeId.c_str());
+    if (dc.urgentFlags == 0) continue;
+    wakes.push_back(dc.wakeIntervalMin ? dc.wakeIntervalMin
+                                       : (uint8_t)(fleetWakeMin > 0 ? fleetWakeMin : 1));
+  }
+  return urgent_listen::listenIntervalMin(wakes.data(), wakes.size());
+}
+
+bool urgentArmListenBefore(uint32_t syncWakeUnix, uint32_t listenMin) {
+  const uint32_t listenWake =
+      urgent_listen::nextListenWake(getRTCTime(), listenMin, syncWakeUnix);
+  if (listenWake == 0) {
+    saveListen(0, 0, 0);
+    return true;
+  }
+  // Persist first: a brown-out between the two writes then wakes at the sync
+  // time with a stale record, which urgentTakeListenWake() ignores.
+  saveListen(listenWake, syncWakeUnix, listenMin);
+  if (armAlarmAtUnix(listenWake)) {
+    Serial.printf("[URGENT] listen window at %lu (every %lu min), sync wake %lu after it\n",
+                  (unsigned long)listenWake, (unsigned long)listenMin,
+                  (unsigned long)syncWakeUnix);
+    return true;
+  }
+  Serial.println("[URGENT] listen alarm arm failed - keeping the sync wake");
+  saveListen(0, 0, 0);
+  return armAlarmAtUnix(syncWakeUnix);
+}
+
+bool urgentTakeListenWake(uint32_t nowUnix, uint32_t& boundaryUnix,
+                          uint32_t& syncWakeUnix, uint32_t& listenMin) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const uint32_t listenAt = prefs.getULong(kKeyListen, 0);
+  syncWakeUnix = prefs.getULong(kKeySync, 0);
+  listenMin = prefs.getULong(kKeyMin, 0);
+  if (listenAt != 0) prefs.putULong(kKeyListen, 0);
+  prefs.end();
+  if (listenAt == 0 || listenMin == 0) return false;
+  if (nowUnix + kListenWakeSlackSec < listenAt ||
+      nowUnix > listenAt + kListenWakeSlackSec) {
+    return false;
+  }
+  boundaryUnix = listenAt + urgent_listen::kListenLeadSec;
+  return true;
+}
+
+void urgentNotePersisted(const char* nodeId, uint32_t seqNum, uint32_t nodeTimestamp) {
+  if (!nodeId || !nodeId[0] || findSeen(nodeId, seqNum, nodeTimestamp)) return;
+  SeenEntry& e = gSeen.entries[gSeen.head];
+  memset(&e, 0, sizeof(e));
+  strncpy(e.nodeId, nodeId, sizeof(e.nodeId));
+  e.seqNum = seqNum;
+  e.nodeTimestamp = nodeTimestamp;
+  gSeen.head = (uint8_t)((gSeen.head + 1) % kUrgentSeenLen);
+  saveSeen();
+}
+
+bool urgentWasPersisted(const char* nodeId, uint32_t seqNum, uint32_t nodeTimestamp,
+                        bool consume) {
+  SeenEntry* e = findSeen(nodeId, seqNum, nodeTimestamp);
+  if (!e) return false;
+  if (consume) {
+    memset(e, 0, sizeof(*e));
+    saveSeen();
+  }
+  return true;
+}
+
+void urgentRecordLatency(uint32_t captureToCloudSec) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  const uint32_t count = prefs.getULong(kKeyLatN, 0) + 1;
+  uint32_t worst = prefs.getULong(kKeyLatMax, 0);
+  if (captureToCloudSec > worst) worst = captureToCloudSec;
+  prefs.putULong(kKeyLatN, count);
+  prefs.putULong(kKeyLatMax, worst);
+  prefs.end();
+  Serial.printf("[URGENT] capture->cloud %lu s (worst %lu s over %lu)\n",
+                (unsigned long)captureToCloudSec, (unsigned long)worst,
+                (unsigned long)count);
+}
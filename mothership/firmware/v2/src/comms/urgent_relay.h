@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Low-latency listening (shared/urgent_listen.h)
+// ---------------------------------------------------------------------------
+// While a deployed node has urgent thresholds the mothership also wakes
+// between sync slots, for a short listen window around the nodes' wake
+// boundaries, and pushes the URGENT snapshots it hears in one short POST.
+// The DS3231 has one wake alarm, so a listen window displaces the sync alarm:
+// the sync wake it displaced is kept in NVS ("urgent") and re-armed after the
+// window. Small, and written at most twice per wake.
+
+// Listen cadence in minutes for the deployed nodes with urgent thresholds
+// (their desired config; a node without its own wake interval runs at
+// fleetWakeMin). 0 = nobody to listen for. Call after loadPairedNodes().
+uint32_t urgentListenIntervalMin(int fleetWakeMin);
+
+// Alarm 1 has just been armed for the sync wake at syncWakeUnix. When a listen
+// window comes first, re-arm it for the window and remember the sync wake.
+// Returns false only when Alarm 1 could be left unarmed (the window failed to
+// arm and the sync wake could not be restored either).
+bool urgentArmListenBefore(uint32_t syncWakeUnix, uint32_t listenMin);
+
+// True when this RTC wake is the listen window armed last time: boundaryUnix
+// is the wake boundary it is centred on, syncWakeUnix the sync wake still due
+// and listenMin the cadence it was armed with. Consumes the record, so a
+// second alarm at the same time falls through to a sync wake.
+bool urgentTakeListenWake(uint32_t nowUnix, uint32_t& boundaryUnix,
+                          uint32_t& syncWakeUnix, uint32_t& listenMin);
+
+// Urgent samples persisted ahead of the node's queue. The node still queues
+// the sample and sends it again at its sync slot; that copy is ACKed as
+// persisted without a second row. Kept for the last kUrgentSeenLen samples.
+constexpr size_t kUrgentSeenLen = 32;
+void urgentNotePersisted(const char* nodeId, uint32_t seqNum, uint32_t nodeTimestamp);
+// `consume` drops the record (the queued copy has now been seen).
+bool urgentWasPersisted(const char* nodeId, uint32_t seqNum, uint32_t nodeTimestamp,
+                        bool consume);
+
+// End-to-end latency, node capture to the end of the urgent POST. Logged with
+// the running worst case so a bench run can read it off the serial log.
+void urgentRecordLatency(uint32_t captureToCloudSec);
@@ -3,6 +3,8 @@
 // modules.
 
 #include "config/config_server.h"
+#include "config/page_stream.h"
+#include "config/portal_assets.h"
 #include "config/node_registry.h"
 #include "config/transmission_settings.h"
 #include "config/sim_settings.h"
@@ -19,8 +21,11 @@
 #include "system/pins.h"
 #include "system/hardware_identity.h"
 #include "protocol.h"
+#include "urgent_listen.h"
 #include "firmware_identity.h"
 #include "ota/mothership_selfupdate.h"
+#include "ota/node_image_cache.h"
+#include "ota/fleet_ota_distributor.h"
 #include "command_dispatcher.h"
 #include "control/backend_command_ingest.h"
 #include "control/node_config_control.h"
@@ -116,14 +121,33 @@ struct RecordingIntervalPlan {
   uint32_t checksum;
 };
 
+// Version 1 was sized for the original 16-node dispatcher table. Read once so
+// an in-flight interval change survives the upgrade.
+static constexpr uint8_t kRecordingPlanV1Members = 16;
+struct RecordingIntervalPlanV1 {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t generation;
+  char commandId[CMD_ID_LEN];
+  uint32_t dispatcherRevision;
+  uint32_t syncPhaseUnix;
+  uint16_t syncIntervalMin;
+  uint8_t wakeIntervalMin;
+  uint8_t memberCount;
+  RecordingIntervalMember members[kRecordingPlanV1Members];
+  uint32_t checksum;
+};
+
 static constexpr uint32_t kRecordingPlanMagic = 0x464D5249UL;  // FMRI
-static constexpr uint16_t kRecordingPlanVersion = 1;
+static constexpr uint16_t kRecordingPlanVersion = 2;
 static constexpr const char* kRecordingPlanNs = "rec_interval";
 static constexpr const char* kRecordingPlanA = "plan_a";
 static constexpr const char* kRecordingPlanB = "plan_b";
 static RecordingIntervalPlan gRecordingPlan{};
 
-static uint32_t recordingPlanChecksum(RecordingIntervalPlan plan) {
+template <typename Plan>
+static uint32_t recordingPlanChecksum(Plan plan) {
   plan.checksum = 0;
   const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&plan);
   uint32_t hash = 2166136261UL;
@@ -141,9 +165,35 @@ static bool recordingPlanValid(const RecordingIntervalPlan& plan) {
          plan.checksum == recordingPlanChecksum(plan);
 }
 
+static bool readRecordingPlanV1(Preferences& prefs, const char* key,
+                                RecordingIntervalPlan& plan) {
+  RecordingIntervalPlanV1 old{};
+  if (prefs.getBytes(key, &old, sizeof(old)) != sizeof(old) ||
+      old.magic != kRecordingPlanMagic || old.version != 1 ||
+      old.size != sizeof(old) || old.memberCount > kRecordingPlanV1Members ||
+      old.checksum != recordingPlanChecksum(old)) return false;
+  plan = {};
+  plan.magic = kRecordingPlanMagic;
+  plan.version = kRecordingPlanVersion;
+  plan.size = sizeof(plan);
+  plan.generation = old.generation;
+  memcpy(plan.commandId, old.commandId, CMD_ID_LEN);
+  plan.dispatcherRevision = old.dispatcherRevision;
+  plan.syncPhaseUnix = old.syncPhaseUnix;
+  plan.syncIntervalMin = old.syncIntervalMin;
+  plan.wakeIntervalMin = old.wakeIntervalMin;
+  plan.memberCount = old.memberCount;
+  memcpy(plan.members, old.members, sizeof(old.members));
+  plan.checksum = recordingPlanChecksum(plan);
+  return true;
+}
+
 static bool readRecordingPlan(Preferences& prefs, const char* key,
                               RecordingIntervalPlan& plan) {
-  return prefs.getBytesLength(key) == sizeof(plan) &&
+  const size_t length = prefs.getBytesLength(key);
+  if (length == sizeof(RecordingIntervalPlanV1))
+    return readRecordingPlanV1(prefs, key, plan);
+  return length == sizeof(plan) &&
          prefs.getBytes(key, &plan, sizeof(plan)) == sizeof(plan) &&
          recordingPlanValid(plan);
 }
@@ -393,12 +443,24 @@ static void ingestBackendResponseFromUi(const String& responseBody) {
 
 static NodeConfigApplyResult applyLocalDesiredConfig(
     const String& nodeId, const NodeDesiredConfig& desired,
-    bool overrideSyncSchedule = false, bool allowUnpair = false) {
+    bool overrideSyncSchedule = false, bool allowUnpair = false,
+    bool overrideAggregation = false, bool overrideRbe = false,
+    bool overrideUrgent = false) {
   NodeConfigApplyOptions options{};
   options.allowUnpair = allowUnpair;
   options.overrideSyncSchedule = overrideSyncSchedule;
   options.syncIntervalMin = desired.syncIntervalMin;
   options.syncPhaseUnix = desired.syncPhaseUnix;
+  options.overrideAggregation = overrideAggregation;
+  options.aggSamplesPerReport = desired.aggSamplesPerReport;
+  options.aggStatsMask = desired.aggStatsMask;
+  options.overrideRbe = overrideRbe;
+  options.rbeMaxSilenceMin = desired.rbeMaxSilenceMin;
+  options.rbeDeadbandTenths = desired.rbeDeadbandTenths;
+  options.overrideUrgent = overrideUrgent;
+  options.urgentFlags = desired.urgentFlags;
+  options.urgentAirBelowCenti = desired.urgentAirBelowCenti;
+  options.urgentSoilAboveMv = desired.urgentSoilAboveMv;
   // Compare-and-set against the shared dispatcher revision. ESP-NOW RX runs on
   // the WiFi task, so a node's NODE_HELLO/CONFIG_ACK can bump the revision
   // between the read and our submit, yielding OUT_REVISION_CONFLICT — a normal,
@@ -1311,756 +1373,31 @@ static String renderQrSvg(const String& text, int modulepx = 6) {
 }
 
 // ---------------------------------------------------------------------------
-// CSS / JS (copied verbatim from production main.cpp)
+// CSS / JS (web/portal.css, web/portal.js -> config/portal_assets.h)
 // ---------------------------------------------------------------------------
-const char COMMON_CSS[] PROGMEM = R"CSS(
-:root{
-  --bg:#faf8f4; --panel:#ffffff; --text:#4a4640; --sub:#6b665e; --border:#e8e4dc;
-  --primary:#5b7553; --success:#7a9b70; --warn:#c47a5a; --danger:#c45a4a;
-  --btn-solid:#5b7553;
-  --input-bg:#f5f3ee;
-  --input-bg-active:#ede9e2;
-  --radius:10px; --sp-1:8px; --sp-2:12px; --sp-3:16px; --sp-4:20px;
-  --shadow:0 2px 10px rgba(74,74,72,.12);
-}
-*{box-sizing:border-box;-webkit-tap-highlight-color:transparent}
-html{scroll-behavior:smooth}
-html,body{margin:0;padding:0;background:linear-gradient(180deg,#faf8f4 0%, #e8e4dc 100%);color:var(--text);
-  font:16px/1.5 -apple-system,BlinkMacSystemFont,"Segoe UI",Roboto,system-ui,sans-serif}
-a{color:var(--primary);text-decoration:none}
-:focus-visible{outline:3px solid rgba(33,150,243,.35);outline-offset:2px}
-
-/* Layout */
-.container{max-width:600px;margin:0 auto;padding:var(--sp-3)}
-.header{padding:var(--sp-3) 0;text-align:center}
-.header-top{display:flex;align-items:center;justify-content:space-between;gap:10px}
-.header-actions{display:flex;align-items:center;gap:8px}
-.h1{font-size:24px;font-weight:700;margin:0}
-.top-time{display:flex;align-items:center;justify-content:space-between;gap:10px;background:var(--panel);border:1px solid var(--border);border-radius:10px;padding:14px 16px;margin-bottom:12px;min-height:62px}
-.top-time__label{color:var(--sub);font-size:.95rem;font-weight:600}
-.top-time__value{font-weight:700;color:#566246;font-size:1.25rem}
-.section{background:var(--panel);border:1px solid var(--border);border-radius:var(--radius);
-  padding:var(--sp-3);box-shadow:var(--shadow);margin:var(--sp-3) 0}
-.section h3{margin:0 0 var(--sp-2);font-size:18px}
-.section-head{display:flex;align-items:center;justify-content:space-between;gap:10px;margin:0 0 var(--sp-2)}
-.section-head h3{margin:0}
-.muted{color:var(--sub);font-size:.95rem}
-
-/* Stats */
-.stats{display:grid;grid-template-columns:1fr 1fr 1fr;gap:var(--sp-1);text-align:center}
-.stats--kpi{grid-template-columns:1fr 1fr}
-.stat{background:#fafafa;border:1px solid var(--border);border-radius:8px;padding:10px}
-.stat strong{display:block;font-size:13px;color:var(--sub);margin-bottom:2px}
-.stat .num{font-size:18px;font-weight:700}
-.stats--kpi .stat{padding:14px}
-.stats--kpi .stat strong{font-size:12px;letter-spacing:.02em;text-transform:uppercase}
-.stats--kpi .stat .num{font-size:24px}
-.stats--kpi .stat--deployed-active{background:rgba(122,155,112,.25);border-color:#7a9b70}
-.stats--kpi .stat--paired-active{background:rgba(196,122,90,.25);border-color:#c47a5a}
-.stats--kpi .stat--unpaired-active{background:rgba(196,90,74,.20);border-color:#c45a4a}
-
-/* Lists/cards */
-.list{display:grid;gap:var(--sp-1)}
-.item{background:var(--panel);border:1px solid var(--border);border-radius:8px;padding:12px;display:block;color:inherit}
-.item-row{display:flex;align-items:center;justify-content:space-between;gap:12px}
-.item--node{
-  padding:14px 12px;
-  min-height:86px;
-  cursor:pointer;
-  border-width:2px;
-  border-color:#c9d0c3;
-  background:linear-gradient(180deg,#ffffff 0%, #f4f7ef 100%);
-  box-shadow:0 4px 12px rgba(74,74,72,.12);
-  transition:transform .12s ease, box-shadow .12s ease, border-color .12s ease, background .12s ease;
-}
-.item--node:hover{
-  border-color:#9faf97;
-  box-shadow:0 8px 18px rgba(74,74,72,.18);
-  background:linear-gradient(180deg,#ffffff 0%, #eef3e5 100%);
-}
-.item--node:focus-visible{
-  outline:3px solid rgba(79,109,122,.35);
-  outline-offset:2px;
-}
-.item--node:active{
-  transform:translateY(1px) scale(.995);
-  box-shadow:0 3px 9px rgba(74,74,72,.14);
-}
-.node-row{display:grid;grid-template-columns:minmax(0,1fr) auto auto;align-items:center;gap:12px}
-.node-main{min-width:0;overflow:hidden;text-overflow:ellipsis;white-space:nowrap}
-.node-name{margin-left:10px}
-.node-timing{display:grid;grid-template-columns:auto auto;gap:10px}
-.node-timing-cell{display:flex;flex-direction:column;align-items:flex-start;gap:3px;min-width:86px}
-.node-timing-label{font-size:.72rem;color:var(--sub);font-weight:700;letter-spacing:.02em;text-transform:uppercase}
-.node-timing-value{font-size:.86rem}
-.node-status{display:grid;grid-template-columns:auto auto;gap:10px}
-.node-status-cell{display:flex;flex-direction:column;align-items:flex-start;gap:3px;min-width:86px}
-.item--node .chip{font-weight:600}
-.item--node .chip{white-space:nowrap}
-/* Per-node checkboxes are opt-in, exactly like the action bar they feed. The
-   list is read one node at a time far more often than it is acted on in bulk,
-   and a permanent checkbox column costs 44px of width on a phone plus a
-   selection affordance on every row for a mode the operator is usually not in.
-   body.batch-mode is set by showBatchBar(). */
-.node-select-wrap{display:grid;grid-template-columns:minmax(0,1fr);gap:8px;align-items:stretch}
-.node-select-control{display:none;align-items:center;justify-content:center;border:2px solid #c9d0c3;
-  border-radius:8px;background:#f7f8f4;cursor:pointer;min-height:86px}
-body.batch-mode .node-select-wrap{grid-template-columns:44px minmax(0,1fr)}
-body.batch-mode .node-select-control{display:flex}
-.node-select-control input{width:22px;height:22px;margin:0;accent-color:var(--primary)}
-.node-select-wrap.is-selected .node-select-control{border-color:var(--primary);background:rgba(122,155,112,.20)}
-.node-select-wrap.is-selected .item--node{border-color:var(--primary)}
-.batch-actions{position:sticky;top:74px;z-index:8;margin:0 0 12px;padding:12px;border:1px solid var(--border);
-  border-radius:10px;background:rgba(255,255,255,.96);box-shadow:var(--shadow);backdrop-filter:blur(5px)}
-.batch-actions__head{display:flex;align-items:center;justify-content:space-between;gap:10px;margin-bottom:8px}
-.batch-actions__buttons{display:grid;grid-template-columns:repeat(3,minmax(0,1fr));gap:8px}
-.batch-actions__buttons .btn{margin:0;padding:10px 8px;min-height:44px}
-.batch-actions__buttons .btn--remove{background:#fff;color:#7a2a20;border-color:#c45a4a}
-
-/* Chips */
-.chip{display:inline-block;padding:2px 8px;border-radius:999px;border:1px solid var(--border);font-size:.85rem;color:var(--sub)}
-.chip--state-deployed{border-color:#7a9b70;background:rgba(122,155,112,.25);color:#3d5e35}
-.chip--state-paused{border-color:#5a7fc4;background:rgba(90,127,196,.20);color:#233a6b}
-.chip--state-paired{border-color:#c47a5a;background:rgba(196,122,90,.25);color:#8a4a2e}
-.chip--state-unpaired{border-color:#c45a4a;background:rgba(196,90,74,.20);color:#7a2a20}
-.chip--link-awake{border-color:#b3e5fc;background:#e1f5fe;color:#01579b}
-.chip--link-asleep{border-color:#e1bee7;background:#f3e5f5;color:#4a148c}
-.chip--link-offline{border-color:#ffcdd2;background:#ffebee;color:#b71c1c}
-.chip--cfg-pending{border-color:#ffe0b2;background:#fff8e1;color:#8a4b00}
-.chip--cfg-ok{border-color:#c8e6c9;background:#f1f8e9;color:#256029}
-.chip--bat-ok{border-color:#7a9b70;background:rgba(122,155,112,.25);color:#3d5e35}
-.chip--bat-med{border-color:#c47a5a;background:rgba(196,122,90,.25);color:#8a4a2e}
-.chip--bat-low{border-color:#c45a4a;background:rgba(196,90,74,.20);color:#7a2a20}
-
-/* Forms */
-.label{display:block;margin:8px 0 6px;color:var(--sub);font-size:.95rem}
-.input, input[type="text"], input[type="number"], select{
-  width:100%;padding:12px;border:1px solid var(--border);border-radius:8px;background:var(--input-bg)
-}
-.input:focus, input[type="text"]:focus, input[type="number"]:focus, select:focus{
-  background:var(--input-bg-active)
-}
-.help{color:var(--sub);font-size:.85rem;margin-top:6px}
-/* Identifiers meant to be copied by hand. user-select:all makes the value
-   select as one complete unit rather than word-by-word; it does not guarantee
-   a single tap selects it on every browser, so a copy button is still offered
-   alongside. This is the zero-JS backstop. */
-.mono-id{font-family:monospace;user-select:all;-webkit-user-select:all;word-break:break-all}
-.mono-id--lg{display:block;font-size:20px;font-weight:700;letter-spacing:.5px;margin:6px 0}
-.row{display:flex;gap:var(--sp-1);flex-wrap:wrap}
-.col{flex:1 1 220px;min-width:0}
-.subpanel{display:none;margin-top:12px;padding:10px;border:1px solid var(--border);border-radius:8px;background:#fafafa}
-.action-stack .btn{padding:14px 16px;min-height:52px;font-size:1rem}
-
-/* Buttons */
-.btn{display:inline-flex;align-items:center;justify-content:center;gap:8px;
-  padding:12px 16px;border-radius:8px;border:1px solid var(--border);background:#fff;color:var(--text);
-  cursor:pointer;width:100%;margin-top:8px;text-decoration:none}
-.btn--primary,.btn--success,.btn--warn{background:var(--btn-solid);color:#fff;border-color:transparent}
-.btn--sm{width:auto;min-height:36px;padding:8px 12px;margin-top:0;font-size:.9rem}
-.btn--action{padding:14px 16px;min-height:52px;font-size:1rem}
-.btn:disabled{opacity:.6;cursor:not-allowed}
-.action-choices{display:grid;gap:8px;margin-top:10px}
-.action-choice input{position:absolute;opacity:0;pointer-events:none}
-.action-choice span{display:flex;align-items:center;justify-content:center;min-height:46px;padding:10px 12px;border-radius:8px;border:1px solid var(--border);font-weight:700;cursor:pointer;transition:filter .12s ease, transform .12s ease, box-shadow .12s ease}
-.action-choice--start span{border-color:#7a9b70;background:#fff;color:#3d5e35}
-.action-choice--stop span{border-color:#c47a5a;background:#fff;color:#8a4a2e}
-.action-choice--unpair span{border-color:#c45a4a;background:#fff;color:#7a2a20}
-.action-choice span:hover{filter:brightness(.98)}
-.action-choice input:checked + span{box-shadow:0 0 0 2px rgba(79,109,122,.35) inset;transform:translateY(1px)}
-.action-choice--start input:checked + span{background:rgba(122,155,112,.25)}
-.action-choice--stop input:checked + span{background:rgba(196,122,90,.25)}
-.action-choice--unpair input:checked + span{background:rgba(196,90,74,.20)}
-button.action-choice{display:block;width:100%;padding:0;border:0;background:transparent;
-  color:inherit;font:inherit;text-align:inherit}
-button.action-choice:focus-visible{outline:none}
-button.action-choice:focus-visible span{outline:2px solid var(--primary);outline-offset:2px}
-/* Two-line variant: action name plus ONE line of consequence. A modifier rather
-   than a change to .action-choice span, because the recording-interval picker
-   reuses the base class and must stay a single centred line. */
-.action-choice--why span{flex-direction:column;align-items:flex-start;justify-content:center;gap:3px;text-align:left}
-.action-choice--why em{font-style:normal;font-weight:400;font-size:12px;line-height:1.3;opacity:.8}
-.icon{width:1.2em;height:1.2em;display:inline-block;vertical-align:-0.12em;fill:currentColor}
-.quick-row{display:grid;grid-template-columns:repeat(3,minmax(0,1fr));gap:8px;margin:0 0 12px}
-.quick-row .btn{margin-top:0;min-height:52px}
-.quick-row .subpanel{grid-column:2 / 3;margin-top:0}
-.quick-row form{margin:0}
-.quick-row form .btn{width:100%}
-
-/* Utility */
-.center{text-align:center}
-.badge{display:inline-block;padding:2px 8px;border:1px solid var(--border);border-radius:999px;color:var(--sub);font-size:.85rem}
-
-/* Time health pills in Node Manager */
-.time-health{
-  display:flex;
-  flex-direction:column;
-  align-items:flex-start;
-  gap:2px;
-  font-size:.85rem;
-}
-.health-pill{
-  display:inline-flex;
-  align-items:center;
-  justify-content:center;
-  padding:2px 8px;
-  border-radius:999px;
-  font-size:.75rem;
-  font-weight:600;
-  color:#ffffff;
-  white-space:nowrap;
-}
-.health-fresh{background:#16a34a;}
-.health-ok{background:#f97316;}
-.health-stale{background:#dc2626;}
-.health-unknown{background:#6b7280;}
-.health-subtext{
-  font-size:.7rem;
-  color:#6b7280;
-}
-
-@media(max-width:480px){
-  /* Prevent horizontal scroll from any wide content */
-  body{overflow-x:hidden}
-
-  /* Quick-action grid: 2 columns on phones instead of 3 */
-  .quick-row{grid-template-columns:1fr 1fr}
-  .quick-row .subpanel{grid-column:1 / -1}
-
-  /* Node cards: stack name above timing/status */
-  .node-row{grid-template-columns:1fr;gap:8px}
-  .node-timing,.node-status{grid-template-columns:1fr 1fr;gap:6px}
-  .node-timing-cell,.node-status-cell{min-width:0}
-  .node-select-wrap{grid-template-columns:minmax(0,1fr);gap:6px}
-  body.batch-mode .node-select-wrap{grid-template-columns:42px minmax(0,1fr)}
-  .batch-actions{top:66px}
-  .batch-actions__buttons{grid-template-columns:1fr}
-
-  /* Small buttons: meet 44px touch target minimum */
-  .btn--sm{min-height:44px;padding:10px 14px}
-
-  /* Reduce section spacing to reduce vertical scrolling */
-  .section{margin:10px 0;padding:12px}
-
-  /* Sticky header so navigation stays visible while scrolling */
-  .header{position:sticky;top:0;z-index:10;background:var(--bg);padding:10px 0}
-
-  /* KPI stat numbers: prevent text overflow on narrow screens */
-  .stats--kpi .stat .num{overflow:hidden;text-overflow:ellipsis}
-
-  /* Top time bar: slightly smaller on phones */
-  .top-time{padding:10px 12px;min-height:52px}
-  .top-time__value{font-size:1.1rem}
-}
-
-@media(min-width:768px){.container{max-width:720px}}
-
-/* --- Responsiveness layer: spinner, loading, discovery, connection --- */
-/* Kept tiny and CSS-only — no images, no external assets (ESP32 flash). */
-.spinner{display:inline-block;width:1em;height:1em;border:2px solid rgba(120,120,120,.3);
-  border-top-color:currentColor;border-radius:50%;animation:fmspin .7s linear infinite;
-  vertical-align:-.15em;margin-right:6px}
-@keyframes fmspin{to{transform:rotate(360deg)}}
-.btn.is-loading{opacity:.9;cursor:progress}
-.btn.is-ok{box-shadow:0 0 0 2px rgba(122,155,112,.6) inset}
-.btn.is-err{box-shadow:0 0 0 2px rgba(196,90,74,.6) inset}
-
-#ui-status.s-ok{border-color:#7a9b70;color:#3d5e35;background:rgba(122,155,112,.12)}
-#ui-status.s-warn{border-color:#c47a5a;color:#8a4b00;background:#fff8e1}
-#ui-status.s-err{border-color:#c45a4a;color:#7a2a20;background:rgba(196,90,74,.10)}
-#ui-status.s-progress{border-color:#4f6d7a;color:#33525c;background:#eef5f8}
-
-.discovery-panel{margin:10px 0;padding:12px;border:1px solid #b3e5fc;border-radius:8px;background:#e8f6fe}
-.discovery-panel .dp-row{display:flex;align-items:center;justify-content:space-between;gap:10px;font-size:.9rem;margin:2px 0}
-.discovery-panel strong{display:inline-flex;align-items:center;color:#01579b}
-.discovery-panel .dp-msg{color:var(--sub);font-size:.82rem;margin-top:6px}
-
-.node-new{animation:fmflash 1.6s ease-out 1}
-@keyframes fmflash{0%{box-shadow:0 0 0 3px #f6d365;background:#fffbe6}70%{background:#fffef6}100%{box-shadow:none}}
-
-.conn-dot{display:inline-flex;align-items:center;gap:5px;font-size:.76rem;color:var(--sub)}
-.conn-dot::before{content:'';width:8px;height:8px;border-radius:50%;background:#7a9b70;flex:none}
-.conn-dot.c-updating::before{background:#4f9bd6}
-.conn-dot.c-warn::before{background:#c47a5a}
-.conn-dot.c-err::before{background:#c45a4a}
-
-/* Full-screen loading overlay — shown during page navigation + form submits */
-.fm-load-overlay{position:fixed;inset:0;background:rgba(250,249,246,.6);display:none;
-  align-items:center;justify-content:center;z-index:9999}
-.fm-load-overlay.show{display:flex}
-.fm-load-box{display:flex;flex-direction:column;align-items:center;gap:12px;padding:20px 26px;
-  background:#fff;border:1px solid var(--border);border-radius:14px;box-shadow:0 10px 34px rgba(0,0,0,.16);
-  color:var(--sub);font-size:.92rem}
-.fm-load-box .spinner{width:2em;height:2em;border-width:3px;margin:0;color:#7a9b70}
-
-/* --- Persistent navigation: fixed bottom bar (phone) / static row (desktop) --- */
-/* Content clears the fixed bar; desktop override below zeroes this. */
-body{padding-bottom:calc(70px + env(safe-area-inset-bottom))}
-.tabbar{position:fixed;left:0;right:0;bottom:0;z-index:20;display:grid;grid-template-columns:repeat(4,1fr);
-  background:var(--panel);border-top:1px solid var(--border);box-shadow:0 -2px 10px rgba(74,74,72,.10);
-  padding-bottom:env(safe-area-inset-bottom)}
-.tabbar a{display:flex;flex-direction:column;align-items:center;justify-content:center;gap:3px;
-  min-height:56px;padding:6px 4px;color:var(--sub);font-size:.72rem;font-weight:600;
-  border-top:3px solid transparent;text-decoration:none}
-.tabbar a .icon{width:22px;height:22px}
-.tabbar a[aria-current="page"]{color:var(--primary);border-top-color:var(--primary);background:rgba(91,117,83,.08)}
-@media(hover:hover){.tabbar a:hover{color:var(--text);background:rgba(91,117,83,.06)}}
-
-/* Flat secondary section — border only. Shadow is reserved for primary surfaces. */
-.section--flat{box-shadow:none}
-
-/* Primary action card at the end of the page flow (shadowed to stand out from
-   the flat secondary sections). Not floating — the fixed tab bar owns the bottom. */
-.sticky-action{margin:16px 0;padding:12px;background:var(--panel);border:1px solid var(--border);
-  border-radius:var(--radius);box-shadow:var(--shadow)}
-.sticky-action .btn{margin-top:0}
-
-/* Tabular numerals so readings/voltage/time/percent don't jitter as they update. */
-.num,.top-time__value,.chip--bat-ok,.chip--bat-med,.chip--bat-low{font-variant-numeric:tabular-nums}
-
-@media(min-width:768px){
-  .tabbar{position:static;box-shadow:none;border-top:none;border-bottom:1px solid var(--border);
-    max-width:720px;margin:0 auto 8px}
-  .tabbar a{flex-direction:row;gap:8px;min-height:48px;font-size:.9rem;
-    border-top:none;border-bottom:3px solid transparent}
-  .tabbar a[aria-current="page"]{border-top-color:transparent;border-bottom-color:var(--primary)}
-  body{padding-bottom:0}
-}
-
-@media(prefers-reduced-motion:reduce){
-  html{scroll-behavior:auto}
-  .spinner{animation:none}
-  .node-new{animation:none}
-  .item--node,.action-choice span,.btn{transition:none}
-}
-)CSS";
-
-const char COMMON_JS[] PROGMEM = R"JS(
-// Full-screen loading overlay for page navigations + (non-async) form submits.
-// Makes the ESP32's page-render/transfer gap feel responsive instead of relying
-// on the browser's tiny built-in spinner. Async forms manage their own UI.
-(function(){
-  function ov(){ return document.getElementById('fm-load'); }
-  function show(msg){ var o=ov(); if(!o) return; var m=document.getElementById('fm-load-msg');
-    if(m && msg) m.textContent=msg; o.classList.add('show'); }
-  function hide(){ var o=ov(); if(o) o.classList.remove('show'); }
-  window.fmShowLoading=show; window.fmHideLoading=hide;
-  document.addEventListener('click', function(e){
-    var t=e.target; while(t && t.nodeType!==1) t=t.parentNode;
-    var a = (t && t.closest) ? t.closest('a') : null;
-    if(!a) return;
-    if(a.target==='_blank' || a.hasAttribute('download')) return;
-    if(e.metaKey||e.ctrlKey||e.shiftKey||e.button) return;
-    var href=a.getAttribute('href')||'';
-    if(!href || href.charAt(0)==='#' || href.lastIndexOf('javascript:',0)===0) return;
-    show('Loading…');
-  }, true);
-  document.addEventListener('submit', function(e){
-    var f=e.target;
-    if(f && f.classList && f.classList.contains('async-form')) return;  // handles own UI
-    show('Working…');
-  }, true);
-  window.addEventListener('pageshow', hide);   // incl. bfcache back/forward
-  document.addEventListener('DOMContentLoaded', hide);
-})();
-
-// Status messages: kind = 'ok' | 'warn' | 'err' | 'progress'. ARIA-live region.
-// Transient (ok/progress) auto-clear; errors persist until replaced.
-function showUiStatus(message, kind){
-  var box = document.getElementById('ui-status');
-  if (!box) return;
-  box.className = 'help s-' + (kind || 'ok');
-  box.style.display = 'block';
-  box.setAttribute('role','status');
-  box.textContent = message;
-  if (box._t){ clearTimeout(box._t); box._t = null; }
-  if (kind === 'ok' || kind === 'progress'){
-    box._t = setTimeout(function(){ box.style.display = 'none'; }, 4000);
-  }
-}
-
-function asFormBody(form){
-  var data = new FormData(form);
-  data.append('ajax', '1');
-  return new URLSearchParams(data);
-}
-
-// AbortController may be absent in very old captive-portal webviews — guard it
-// so polling/fetch still works (just without a hard timeout) on those.
-function fmAbort(){ return (typeof AbortController !== 'undefined') ? new AbortController() : null; }
-
-// Restrained connection indicator.
-function setConnection(state){
-  var el = document.getElementById('conn-status');
-  if (!el) return;
-  el.className = 'conn-dot' + (state==='updating' ? ' c-updating'
-                            : state==='warn' ? ' c-warn'
-                            : state==='err' ? ' c-err' : '');
-  el.textContent = state==='updating' ? 'Updating…'
-                 : state==='warn' ? 'Connection interrupted'
-                 : state==='err' ? 'Reconnecting…' : 'Connected';
-}
-
-// --- Async button loading states (contextual labels + inline spinner) ---
-function btnLabelFor(form, btn){
-  if (btn && btn.getAttribute('data-loading-label')) return btn.getAttribute('data-loading-label');
-  var a = (form && form.getAttribute('action')) || '';
-  if (a.indexOf('find-stations')>=0 || a.indexOf('discover')>=0) return 'Searching…';
-  if (a.indexOf('save')>=0 || a.indexOf('transmission')>=0) return 'Saving…';
-  if (a.indexOf('recording-interval')>=0 || a.indexOf('wake-interval')>=0) return 'Applying…';
-  if (a.indexOf('sync')>=0) return 'Updating…';
-  if (a.indexOf('manual-upload')>=0) return 'Uploading…';
-  if (a.indexOf('start')>=0 || a.indexOf('shutdown')>=0) return 'Starting…';
-  if (a.indexOf('set-time')>=0) return 'Setting time…';
-  return 'Working…';
-}
-function setBtnLoading(btn, label){
-  if (!btn) return;
-  if (btn._orig == null) btn._orig = (btn.tagName==='INPUT') ? btn.value : btn.innerHTML;
-  btn.disabled = true;
-  btn.setAttribute('aria-busy','true');
-  btn.classList.add('is-loading');
-  if (btn.tagName==='INPUT') btn.value = label || 'Working…';
-  else btn.innerHTML = '<span class="spinner" aria-hidden="true"></span>' + (label || 'Working…');
-}
-function clearBtnLoading(btn){
-  if (!btn) return;
-  btn.disabled = false;
-  btn.removeAttribute('aria-busy');
-  btn.classList.remove('is-loading','is-ok','is-err');
-  if (btn._orig != null){
-    if (btn.tagName==='INPUT') btn.value = btn._orig; else btn.innerHTML = btn._orig;
-    btn._orig = null;
-  }
-}
-function flashBtn(btn, ok){
-  if (!btn) return;
-  btn.classList.remove('is-loading');
-  btn.classList.add(ok ? 'is-ok' : 'is-err');
-}
-
-// --- Node cards: incremental, XSS-safe (textContent for device strings) ---
-function chipState(state, paused, pending, desiredTarget, ended, reportedPaused, deployUnconfirmed){
-  if (pending && Number(desiredTarget)===0) return ['chip chip--state-unpaired','Remove queued'];
-  // Ended outranks paused, matching the server-rendered chips. End queues
-  // STANDBY and keeps the node DEPLOYED, so every test below would otherwise
-  // call an archived deployment "Paused".
-  if (ended) return ['chip chip--bat-low','Ended'];
-  // An unconfirmed deploy outranks every queued-config label below it: the node
-  // has never acknowledged the deploy, so it is not hearing us at all and
-  // "Pause queued" / "Update queued" would imply a link that does not exist.
-  if (state==='DEPLOYED' && deployUnconfirmed) return ['chip chip--bat-low','Not confirmed'];
-  if (state==='DEPLOYED' && pending && Number(desiredTarget)===3) return ['chip chip--state-paused','Pause queued'];
-  // Only a node that is actually paused is resuming. A settings change leaves a
-  // pending desired config at targetState 2 as well, and calling that "Resume
-  // queued" reports a recovery from a pause that never happened.
-  if (state==='DEPLOYED' && pending && Number(desiredTarget)===2)
-    return reportedPaused ? ['chip chip--state-deployed','Resume queued']
-                          : ['chip chip--state-deployed','Update queued'];
-  if (state==='DEPLOYED') return paused ? ['chip chip--state-paused','Paused']
-                                        : ['chip chip--state-deployed','Active'];
-  if (state==='PAIRED')   return ['chip chip--state-paired','Connected'];
-  return ['chip chip--state-unpaired','New'];
-}
-function chipBatt(v){
-  if (v===null || v===undefined) return ['chip','n/a'];
-  var c = v>=3.9 ? 'chip chip--bat-ok' : v>=3.5 ? 'chip chip--bat-med' : 'chip chip--bat-low';
-  return [c, v.toFixed(2)+'V'];
-}
-function lastSeenTxt(sec){
-  if (sec===null || sec===undefined || sec<0) return 'n/a';
-  return Math.floor(sec/60) + ' min ago';
-}
-function nodeCell(parentClass, labelText, fieldName){
-  var d=document.createElement('div'); d.className=parentClass;
-  var l=document.createElement('span'); l.className='node-timing-label'; l.textContent=labelText;
-  var v=document.createElement('span'); v.setAttribute('data-f', fieldName);
-  d.appendChild(l); d.appendChild(v); return d;
-}
-function applyNodeFields(card, n){
-  if (card && card.dataset){ card.dataset.state=n.state||''; card.dataset.paused=n.paused?'1':'0'; }
-  var st=chipState(n.state, n.paused, n.pending, n.desiredTarget, n.deploymentEnded, n.reportedPaused, n.deployUnconfirmed), s=card.querySelector('[data-f="status"]');
-  if (s){ s.className=st[0]; s.textContent=st[1]; }
-  var bt=chipBatt(n.batV), b=card.querySelector('[data-f="batt"]');
-  if (b){ b.className=bt[0]; b.textContent=bt[1]; }
-  var r=card.querySelector('[data-f="rec"]'); if (r){ r.className='chip node-timing-value'; r.textContent=(n.recMin||0)+' min'; }
-  var ls=card.querySelector('[data-f="lastseen"]'); if (ls){ ls.className='chip node-timing-value'; ls.textContent=lastSeenTxt(n.lastSeenSec); }
-  var lbl=card.querySelector('[data-f="label"]'); if (lbl) lbl.textContent = n.label || n.id;
-}
-function nodeCardEl(n){
-  var wrap=document.createElement('div'); wrap.className='node-select-wrap node-new';
-  wrap.setAttribute('data-node-id', n.id);
-  var pick=document.createElement('label'); pick.className='node-select-control'; pick.title='Select node';
-  var cb=document.createElement('input'); cb.type='checkbox'; cb.name='node_id'; cb.value=n.id;
-  cb.className='node-select'; cb.setAttribute('form','batch-node-actions'); cb.setAttribute('aria-label','Select '+(n.label||n.id));
-  cb.addEventListener('change',function(){ if(window.updateBatchSelection) window.updateBatchSelection(cb); });
-  pick.appendChild(cb); wrap.appendChild(pick);
-  var a=document.createElement('a');
-  a.className='item item--node';
-  a.href='/station?id=' + encodeURIComponent(n.id);
-  var row=document.createElement('div'); row.className='node-row';
-  var main=document.createElement('div'); main.className='node-main';
-  var strong=document.createElement('strong'); strong.setAttribute('data-f','label'); main.appendChild(strong);
-  var status=document.createElement('div'); status.className='node-status';
-  status.appendChild(nodeCell('node-status-cell','Status','status'));
-  status.appendChild(nodeCell('node-status-cell','Battery','batt'));
-  var timing=document.createElement('div'); timing.className='node-timing';
-  timing.appendChild(nodeCell('node-timing-cell','Recording','rec'));
-  timing.appendChild(nodeCell('node-timing-cell','Last seen','lastseen'));
-  row.appendChild(main); row.appendChild(status); row.appendChild(timing);
-  a.appendChild(row); wrap.appendChild(a); applyNodeFields(wrap, n); return wrap;
-}
-function findCard(list, id){
-  var k=list.children;
-  for (var i=0;i<k.length;i++){ if (k[i].getAttribute && k[i].getAttribute('data-node-id')===id) return k[i]; }
-  return null;
-}
-// Update existing cards in place; append new ones (highlighted). We do NOT
-// remove cards that drop out of a poll — a node going briefly silent should not
-// make its card vanish; explicit unpair reloads the page.
-function reconcileNodes(nodes){
-  var list=document.getElementById('node-list');
-  if (!list || !nodes) return;
-  for (var i=0;i<nodes.length;i++){
-    var n=nodes[i], card=findCard(list, n.id);
-    if (!card) list.appendChild(nodeCardEl(n));
-    else applyNodeFields(card, n);
-  }
-  var empty=document.getElementById('node-empty');
-  if (empty) empty.style.display = nodes.length ? 'none' : '';
-}
-function updateKpis(f){
-  var set=function(id,v){ var e=document.getElementById(id); if (e && v!=null) e.textContent=String(v); };
-  set('kpi-deployed-num', f.active);
-  set('kpi-unpaired-num', f.new);
-}
-function setText(id,v){ var e=document.getElementById(id); if (e) e.textContent=v; }
-
-// --- Live poller: one timer, visibility-aware, failure backoff, no overlap ---
-// Polls the RAM-only /api/live endpoint. Cadence adapts: fast during discovery
-// or just after an action, slow when idle, paused when the tab is hidden. This
-// keeps steady-state load on the ESP32 low.
-var FM = {
-  timer:null, inFlight:false, fails:0, lastVersion:-1, discActive:false, fastUntil:0, started:false,
-  IDLE:4000, FAST:650, BUSY_WINDOW:4000,
-  start:function(){
-    if (this.started) return;
-    // Only poll on pages that actually display live data — keeps idle load off
-    // the ESP32 on static form-result pages.
-    if (!document.getElementById('conn-status') && !document.getElementById('node-list') &&
-        !document.getElementById('discovery-panel') && !document.getElementById('kpi-deployed-num')) return;
-    this.started=true;
-    document.addEventListener('visibilitychange', function(){
-      if (document.hidden) FM.clear(); else FM.bump();
-    });
-    this.tick();
-  },
-  clear:function(){ if (this.timer){ clearTimeout(this.timer); this.timer=null; } },
-  delay:function(){
-    if (document.hidden) return 0;
-    if (this.fails>0) return Math.min(8000, 1000*Math.pow(2, this.fails-1));
-    return (this.discActive || Date.now()<this.fastUntil) ? this.FAST : this.IDLE;
-  },
-  schedule:function(){ this.clear(); var d=this.delay(); if (d>0) this.timer=setTimeout(function(){FM.tick();}, d); },
-  bump:function(){ this.fastUntil=Date.now()+this.BUSY_WINDOW; this.clear(); this.tick(); },
-  startDiscoveryUi:function(){ this.discActive=true; var p=document.getElementById('discovery-panel'); if(p) p.hidden=false; this.bump(); },
-  tick:function(){
-    if (this.inFlight || document.hidden){ this.schedule(); return; }
-    this.inFlight=true;
-    if (this.fails===0) setConnection('updating');
-    var ctrl=fmAbort(); var to=ctrl?setTimeout(function(){ctrl.abort();},4000):null;
-    fetch('/api/live', {cache:'no-store', signal:ctrl?ctrl.signal:undefined})
-      .then(function(r){ if(!r.ok) throw new Error('HTTP '+r.status); return r.json(); })
-      .then(function(d){ if(to)clearTimeout(to); FM.fails=0; setConnection('ok'); FM.apply(d); })
-      .catch(function(_){ if(to)clearTimeout(to); FM.fails++; setConnection(FM.fails>2?'err':'warn'); })
-      .then(function(){ FM.inFlight=false; FM.schedule(); });
-  },
-  apply:function(d){
-    var disc = d.discovery || {};
-    if (disc.active){
-      this.discActive=true;
-      var p=document.getElementById('discovery-panel'); if(p){ p.hidden=false; if(p._h){clearTimeout(p._h);p._h=null;} }
-      setText('dp-state','Searching');
-      setText('dp-elapsed', Math.floor((disc.elapsedMs||0)/1000)+'s');
-      setText('dp-found', String(disc.foundThisScan||0));
-      var fb=document.getElementById('find-btn');
-      if (fb && !fb.classList.contains('is-loading')) setBtnLoading(fb,'Searching for nodes…');
-    } else if (this.discActive){
-      this.discActive=false;
-      this.onDiscoveryDone(disc);
-    }
-    if (d.version !== this.lastVersion){
-      this.lastVersion = d.version;
-      if (d.fleet) updateKpis(d.fleet);
-      if (d.nodes) reconcileNodes(d.nodes);
-    }
-  },
-  onDiscoveryDone:function(disc){
-    var found = disc ? (disc.foundThisScan||0) : 0, res = disc ? disc.result : 0;
-    var msg = res===1 ? (found+' new node'+(found===1?'':'s')+' found')
-            : res===2 ? 'No new nodes found'
-            : res===3 ? 'Discovery failed'
-            : res===4 ? 'Discovery timed out' : 'Discovery complete';
-    showUiStatus(msg, res===1?'ok':'warn');
-    setText('dp-state', msg);
-    var fb=document.getElementById('find-btn'); if (fb) clearBtnLoading(fb);
-    var p=document.getElementById('discovery-panel');
-    if (p){ if (p._h) clearTimeout(p._h); p._h=setTimeout(function(){p.hidden=true;p._h=null;}, 4500); }
-    this.lastVersion = -1;  // force one more KPI/node refresh after the scan
-  }
-};
-
-function wireAsyncForms(){
-  var forms = document.querySelectorAll('form.async-form');
-  for (var i=0;i<forms.length;i++){
-    (function(form){
-      if (form._wired) return; form._wired = true;
-      form.addEventListener('submit', function(e){
-        e.preventDefault();
-        var btn = form.querySelector('button[type="submit"],input[type="submit"]');
-        if (btn && btn.disabled) return;  // prevent duplicate submission
-        var action = form.getAttribute('action') || '';
-        var isFind = action.indexOf('find-stations')>=0 || action.indexOf('discover')>=0;
-        var isStart = action.indexOf('/start')>=0;
-        setBtnLoading(btn, btnLabelFor(form, btn));
-        if (isFind) FM.startDiscoveryUi();  // immediate panel + fast polling
-        if (isStart) showUiStatus('Syncing to dashboard… this takes 30-60s', 'progress');
-
-        var ctrl = fmAbort();
-        // /start runs a blocking modem upload (30-60s) before responding — the
-        // default 15s timeout would abort it mid-upload. Give it 120s.
-        var timeoutMs = isStart ? 120000 : 15000;
-        var to = ctrl ? setTimeout(function(){ ctrl.abort(); }, timeoutMs) : null;
-        fetch(form.action, {method:'POST', body:asFormBody(form),
-              headers:{'Content-Type':'application/x-www-form-urlencoded'},
-              signal: ctrl?ctrl.signal:undefined})
-          .then(function(r){ return r.text().then(function(t){ return {ok:r.ok, t:t}; }); })
-          .then(function(res){
-            if (to) clearTimeout(to);
-            var ok = res.ok, msg = res.t;
-            try { var j = JSON.parse(res.t); ok = !!j.ok; msg = j.message || (ok?'Done':'Request failed'); } catch(_){}
-            if (isFind){
-              // Discovery now runs server-side; the live poller owns the button,
-              // panel and node list. No full-page reload.
-              showUiStatus(ok ? 'Searching for nodes…' : ('Discovery failed: '+msg), ok?'progress':'err');
-              if (!ok) clearBtnLoading(btn);
-              FM.bump();
-            } else if (isStart) {
-              // Finish & Start Recording: the upload + shutdown is done. Show a
-              // persistent "Finished" state on the button so the operator knows
-              // the board is about to power down, and a clear status message.
-              showUiStatus(msg, ok?'ok':'err');
-              if (btn){
-                btn.classList.remove('is-loading');
-                btn.classList.add(ok ? 'is-ok' : 'is-err');
-                btn.textContent = ok ? '✓ Finished — powering down' : '✗ Sync failed — powering down';
-                btn.disabled = true;  // stay disabled — the board is shutting down
-              }
-              FM.bump();
-            } else {
-              showUiStatus(msg, ok?'ok':'err');
-              flashBtn(btn, ok);
-              setTimeout(function(){ clearBtnLoading(btn); }, ok?700:1200);
-              FM.bump();  // promptly refresh KPIs/nodes after the action
-            }
-          })
-          .catch(function(err){
-            if (to) clearTimeout(to);
-            var aborted = err && err.name==='AbortError';
-            showUiStatus(aborted ? 'Request timed out — check connection' : ('Request failed: '+err), 'err');
-            if (btn && !isFind){ flashBtn(btn,false); setTimeout(function(){clearBtnLoading(btn);},1200); }
-            else if (isFind) clearBtnLoading(btn);
-          });
-      });
-    })(forms[i]);
-  }
-}
-
-function setCurrentTime(){
-  const n=new Date();
-  const z=n=>String(n).padStart(2,'0');
-  const s=`${z(n.getUTCHours())}:${z(n.getUTCMinutes())}:${z(n.getUTCSeconds())} ${z(n.getUTCDate())}-${z(n.getUTCMonth()+1)}-${n.getUTCFullYear()}`;
-  const el=document.getElementById('datetime'); if(el) el.value=s;
-}
-const MONTH_SHORT=['Jan','Feb','Mar','Apr','May','Jun','Jul','Aug','Sep','Oct','Nov','Dec'];
-function formatHubClock(ms){
-  const dt=new Date(ms);
-  return `${String(dt.getUTCHours()).padStart(2,'0')}:${String(dt.getUTCMinutes()).padStart(2,'0')} · ${String(dt.getUTCDate()).padStart(2,'0')} ${MONTH_SHORT[dt.getUTCMonth()]} ${dt.getUTCFullYear()}`;
-}
-function toggleSettings(){
-  const panel=document.getElementById('settings-panel');
-  if(!panel) return;
-  const showing=panel.style.display==='block';
-  panel.style.display = showing ? 'none' : 'block';
-}
-function toggleGlobalInterval(){
-  const panel=document.getElementById('global-interval-panel');
-  if(!panel) return;
-  const showing=panel.style.display==='block';
-  panel.style.display = showing ? 'none' : 'block';
-}
-function toggleInfoPanel(){
-  const panel=document.getElementById('info-panel');
-  if(!panel) return;
-  const showing=panel.style.display==='block';
-  panel.style.display = showing ? 'none' : 'block';
-}
-// Silently tell the hub what the browser's local UTC offset is, so
-// getRTCTimeString()/formatDateTimeDisplay() render local time. Display-only:
-// the RTC itself is never touched here (that's the separate /set-time flow).
-// Fires on every load so a DST change corrects itself on the next visit.
-function syncLocalDisplayOffset(){
-  const offsetMin = -(new Date().getTimezoneOffset());
-  const b = 'offset=' + encodeURIComponent(offsetMin) + '&ajax=1';
-  fetch('/set-utc-offset', {method:'POST', headers:{'Content-Type':'application/x-www-form-urlencoded'}, body:b})
-    .catch(function(){});
-}
-window.addEventListener('DOMContentLoaded', () => {
-  setCurrentTime();
-  syncLocalDisplayOffset();
-  wireAsyncForms();
-  FM.start();   // begin adaptive /api/live polling (drives KPIs, nodes, discovery, connection)
-});
-
-(function(){
-  function parseHubClock(str){
-    if (!str) return NaN;
-    // Accept "HH:MM · DD Mon YYYY" or legacy "HH:MM:SS DD-MM-YYYY"
-    const m = str.match(/^(\d{2}):(\d{2})(?::(\d{2}))?\s*[\u00b7\-]\s*(\d{1,2})\s+([A-Za-z]{3})\s+(\d{4})$/);
-    if (m){
-      const mon = MONTH_SHORT.indexOf(m[5]);
-      if (mon < 0) return NaN;
-      const value = Date.UTC(+m[6], mon, +m[4], +m[1], +m[2], m[3] ? +m[3] : 0);
-      return isNaN(value) ? NaN : value;
-    }
-    if (str.length >= 19){
-      const H = +str.slice(0,2), M = +str.slice(3,5), S = +str.slice(6,8);
-      const d = +str.slice(9,11), mo = +str.slice(12,14), y = +str.slice(15,19);
-      const value = Date.UTC(y, mo-1, d, H, M, S);
-      return isNaN(value) ? NaN : value;
-    }
-    return NaN;
-  }
-  function startClock(){
-    const el = document.getElementById('rtc-now');
-    if (!el) return;
-    const initial = (el.textContent || '').trim();
-    const rtcMs   = parseHubClock(initial);
-    const offset  = isNaN(rtcMs) ? 0 : (rtcMs - Date.now());
-    function draw(){
-      const nowMs = Date.now() + offset;
-      el.textContent = formatHubClock(nowMs);
-    }
-    draw();
-    setInterval(draw, 1000);
+// Served once per release instead of inlined into every page: gzipped from
+// flash (38 KB of text goes out as about 12 KB), under a ?v=<hash> URL with a
+// year-long immutable Cache-Control, so a phone that has seen the portal
+// fetches neither again. A reflash that changes either file changes its hash,
+// and with it the URL, so the stale-UI problem headCommon()'s no-store
+// guards against cannot come back through the assets. ETag/If-None-Match
+// covers browsers that revalidate anyway.
+static void sendPortalAsset(const char* contentType, const char* text, size_t textLen,
+                            const uint8_t* gz, size_t gzLen, const char* etag) {
+  server.sendHeader("Cache-Control", "public, max-age=31536000, immutable");
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (server.header("If-None-Match") == etag) {
+    server.send(304);
+    return;
   }
-  if (document.readyState === 'loading'){
-    document.addEventListener('DOMContentLoaded', startClock);
+  if (server.header("Accept-Encoding").indexOf("gzip") >= 0) {
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, contentType, reinterpret_cast<const char*>(gz), gzLen);
   } else {
-    startClock();
+    server.send_P(200, contentType, text, textLen);
   }
-})();
-)JS";
+}
 
 // ---------------------------------------------------------------------------
 // Page frame helpers
@@ -2211,9 +1548,10 @@ static String headCommon(const String& title,
   h += F("<meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1'>");
   h += F("<meta http-equiv='Cache-Control' content='no-cache, no-store, must-revalidate'>"
          "<meta http-equiv='Pragma' content='no-cache'><meta http-equiv='Expires' content='0'>");
-  h += F("<style>"); h += FPSTR(COMMON_CSS); h += F("</style>");
+  h += F("<link rel='stylesheet' href='/fm.css?v="); h += PORTAL_CSS_VER; h += F("'>");
   if (includeCommonJs) {
-    h += F("<script>"); h += FPSTR(COMMON_JS); h += F("</script>");
+    // Blocking, like the inline block it replaces: page scripts below may use it.
+    h += F("<script src='/fm.js?v="); h += PORTAL_JS_VER; h += F("'></script>");
   }
   h += F("</head><body>");
   h += F("<div id='fm-load' class='fm-load-overlay'><div class='fm-load-box'>"
@@ -2256,9 +1594,8 @@ static inline String footCommon() {
 // rejecting. Both are handled: the fallback is driven by promise REJECTION, not
 // merely by feature detection.
 //
-// This cannot live in COMMON_JS — the setup wizard deliberately omits that block
-// (includeCommonJs=false) to stop its own trailing controller script being
-// truncated on a fragmented heap — so it is emitted per page instead. The guard
+// This cannot live in web/portal.js — the setup wizard deliberately omits that
+// script (includeCommonJs=false), so it is emitted per page instead. The guard
 // makes a double include harmless.
 static String copyHelperJs() {
   return String(F(
@@ -2302,7 +1639,7 @@ static String copyHelperJs() {
 // Status JSON (renamed from buildBleStatusDataJson)
 // ---------------------------------------------------------------------------
 static String buildStatusJson() {
-  auto allNodes = getRegisteredNodes();
+  const auto& allNodes = getRegisteredNodes();
 
   size_t deployedCount = 0;
   size_t pendingCount = 0;
@@ -2454,7 +1791,9 @@ static uint32_t gLiveVersion = 1;
 static uint32_t gLiveFingerprint = 0;
 
 static String buildLiveJson() {
-  const std::vector<NodeInfo> nodes = getRegisteredNodes();  // snapshot copy (safe read)
+  // By reference: the registry is a fixed table, so records never move under
+  // this read even if the ESP-NOW callback registers a node meanwhile.
+  const NodeRegistry& nodes = getRegisteredNodes();
   const uint32_t now = millis();
   // One RTC read per poll (not per node) for the lastSeenUnix fallback below.
   // Still honours this endpoint's contract: no LittleFS, NVS or upload-queue access.
@@ -2516,7 +1855,8 @@ static String buildLiveJson() {
   for (const auto& n : nodes) {
     if (!first) j += ",";
     first = false;
-    const String disp = n.name.length() ? n.name : (n.userId.length() ? n.userId : n.nodeId);
+    const String disp = n.name.length() ? n.name.c_str()
+                      : (n.userId.length() ? n.userId.c_str() : n.nodeId.c_str());
     const DispatchNodeConfig* mirrored = dispatcherNodeConfig(n.nodeId.c_str());
     const uint8_t obs = (n.wakeIntervalMin > 0) ? n.wakeIntervalMin : n.inferredWakeIntervalMin;
     const int recMin = mirrored && mirrored->wakeIntervalMin > 0
@@ -2755,7 +2095,8 @@ static void handleRoot() {
     }
   }
 
-  String html = headCommon("fieldMesh",
+  PageStream html(server);
+  html += headCommon("fieldMesh",
     F("<span id='conn-status' class='conn-dot'>Connected</span>"), 0);
 
   // Stays at the top of the page for as long as the marker is set.
@@ -2764,8 +2105,8 @@ static void handleRoot() {
   char currentTime[24];
   getRTCTimeString(currentTime, sizeof(currentTime));
 
-  auto allNodes      = getRegisteredNodes();
-  auto unpairedNodes = getUnpairedNodes();
+  const auto& allNodes = getRegisteredNodes();
+  auto unpairedNodes   = getUnpairedNodes();
 
   int deployedNodes = 0;
   for (const auto& node : allNodes) {
@@ -3012,7 +2353,7 @@ static void handleRoot() {
 
   html += copyHelperJs();
   html += footCommon();
-  server.send(200, "text/html", html);
+  html.end();
 }
 
 static void handleSetTime() {
@@ -3563,9 +2904,12 @@ static void handleRevertNode() {
 }
 
 static void handleStationsPage() {
-  String html = headCommon("Nodes",
+  const uint32_t renderStartMs = millis();
+  const uint32_t metaReadsBefore = nodeMetaNvsReadCount();
+  PageStream html(server);
+  html += headCommon("Nodes",
     "<span id='conn-status' class='conn-dot'>Connected</span><a href='/stations' class='btn btn--sm'>Refresh</a>", 1);
-  auto allNodes = getRegisteredNodes();
+  const auto& allNodes = getRegisteredNodes();
 
   html += F("<div id='ui-status' class='help' style='display:none;margin-bottom:10px;border:1px solid var(--border);border-radius:8px;padding:8px 10px'></div>");
   html += F("<div id='discovery-panel' class='discovery-panel' hidden>"
@@ -3617,7 +2961,7 @@ static void handleStationsPage() {
           ? gWakeIntervalMin
           : ((observedWakeMin > 0) ? (int)observedWakeMin : 5));
 
-    String displayId = name.length() ? name : (userId.length() ? userId : node.nodeId);
+    String displayId = name.length() ? name : (userId.length() ? userId : String(node.nodeId));
 
     const bool desiredPending = node.stateChangePending &&
         nodeDesired.configVersion > node.configVersionApplied;
@@ -3822,7 +3166,11 @@ static void handleStationsPage() {
             "</div>");
 
   html += footCommon();
-  server.send(200, "text/html", html);
+  Serial.printf("[WEB] /stations: %u nodes rendered in %lu ms, %lu NVS meta reads, %u B\n",
+                (unsigned)allNodes.size(), (unsigned long)(millis() - renderStartMs),
+                (unsigned long)(nodeMetaNvsReadCount() - metaReadsBefore),
+                (unsigned)html.length());
+  html.end();
 }
 
 static NodeInfo* registeredNodeForUi(const String& nodeId) {
@@ -4071,7 +3419,8 @@ static void handleStationDetail() {
   String actionsHtml = String("<a href='/stations' class='btn btn--sm'>Back</a><a href='/station?id=")
     + nodeId
     + String("' class='btn btn--sm'>Refresh</a>");
-  String html = headCommon("Node", actionsHtml);
+  PageStream html(server, target ? 200 : 404);
+  html += headCommon("Node", actionsHtml);
   html += F("<div class='section'>");
 
   if (!target) {
@@ -4080,7 +3429,7 @@ static void handleStationDetail() {
               "<a href='/stations' class='btn btn--primary'>Back to Nodes</a>");
     html += F("</div>");
     html += footCommon();
-    server.send(404, "text/html", html);
+    html.end();
     return;
   }
 
@@ -4499,7 +3848,7 @@ static void handleStationDetail() {
             "</form>");
   html += F("</div>");
   html += footCommon();
-  server.send(200, "text/html", html);
+  html.end();
 }
 
 static void handleNodeConfigSave() {
@@ -5404,7 +4753,8 @@ static void handleSettings() {
     ? (uint32_t)((fsUsed * 100ULL) / fsTotal) : 0;
 
   String actionsHtml = String("<a href='/settings' class='btn btn--sm'>Refresh</a>");
-  String html = headCommon("Settings", actionsHtml, 3);
+  PageStream html(server);
+  html += headCommon("Settings", actionsHtml, 3);
 
   html += F("<div id='ui-status' class='help' style='display:none;margin-bottom:10px;border:1px solid var(--border);border-radius:8px;padding:8px 10px'></div>");
 
@@ -5689,7 +5039,7 @@ static void handleSettings() {
 
   html += copyHelperJs();
   html += footCommon();
-  server.send(200, "text/html", html);
+  html.end();
 }
 
 // POST /set-transmission (alias /save-settings) — the general Settings save.
@@ -5874,7 +5224,7 @@ static void performManualUpload(String& resultMsg, bool& ok) {
         const uint32_t flashPct = (fsTotal > 0)
           ? (uint32_t)((fsUsed * 100ULL) / fsTotal) : 0;
         const UploadCursor manCursor = gUploadQueue.getCursor();
-        const auto allNodes = getRegisteredNodes();
+        const auto& allNodes = getRegisteredNodes();
         uint16_t mTotal = 0, mDeployed = 0, mPaired = 0, mUnpaired = 0, mPending = 0, mPaused = 0;
         for (const auto& n : allNodes) {
           mTotal++;
@@ -6298,9 +5648,9 @@ static void handleProvisionPage() {
   // is not exactly "setup" is ignored and the standalone flow is used.
   const bool returnToWizard = (server.arg("return") == "setup");
 
-  // This page owns registration and connection, and uses none of COMMON_JS —
-  // dropping that block frees ~20.9 KB of the single contiguous String this
-  // response has to fit in. navActive = -1: it is a flow, not a tab.
+  // This page owns registration and connection, and uses none of
+  // web/portal.js — no /fm.js fetch before it renders on a phone that has not
+  // cached it yet. navActive = -1: it is a flow, not a tab.
   String html = headCommon("Connect FieldHub",
                            F("<a href='/settings' class='btn btn--sm'>Settings</a>"),
                            -1, false);
@@ -6560,8 +5910,8 @@ static void handleSetupWizard() {
   int startStep = connectedToFieldMesh ? 3 : 1;
 
   // This wizard owns its interactions and does not use the live-dashboard
-  // poller/forms in COMMON_JS. Omitting that unrelated 21 KB block keeps the
-  // final wizard controller in the response on the ESP32's fragmented heap.
+  // poller/forms in web/portal.js; skipping that unrelated script spares a
+  // fresh phone the /fm.js round trip on the first page it sees.
   String html = headCommon("Set up FieldHub",
                            F("<a href='/' class='btn btn--sm'>Exit</a>"),
                            -1, false);
@@ -6973,6 +6323,212 @@ static void handleSetNodeSensors() {
   server.send(200, "application/json", resp);
 }
 
+// POST /set-node-aggregation — on-node statistical aggregation mode.
+//   node_id     registered node
+//   samples     wakes folded into each summary snapshot; 0 or 1 turns it off
+//               (max NODE_AGG_MAX_SAMPLES_PER_REPORT)
+//   stats_mask  optional SNAP_PRESENT_* groups that report min/max/SD on top of
+//               the mean; 0 or omitted = every eligible channel
+// The node keeps waking at its wake interval (now the sampling sub-interval)
+// and queues one summary per `samples` wakes. Delivered in NODE_CONFIG like the
+// sensor mask; see FIELDMESH_NODE_CONFIG_PROTOCOL.md.
+static void handleSetNodeAggregation() {
+  String nodeId = server.arg("node_id");
+  if (nodeId.length() == 0 || !server.hasArg("samples")) {
+    server.send(400, "application/json",
+                "{\"ok\":false,\"error\":\"node_id and samples required\"}");
+    return;
+  }
+  const long samples = server.arg("samples").toInt();
+  if (samples < 0 || samples > NODE_AGG_MAX_SAMPLES_PER_REPORT) {
+    server.send(400, "application/json",
+                "{\"ok\":false,\"error\":\"samples out of range\"}");
+    return;
+  }
+  const uint8_t aggN = samples < 2 ? 0 : (uint8_t)samples;
+  const uint16_t statsMask = aggN
+      ? (uint16_t)((uint32_t)server.arg("stats_mask").toInt() & 0x01FFu)
+      : 0;
+
+  bool known = false;
+  for (const auto& n : registeredNodes) {
+    if (n.nodeId == nodeId) { known = true; break; }
+  }
+  if (!known) {
+    server.send(404, "application/json", "{\"ok\":false,\"error\":\"unknown node\"}");
+    return;
+  }
+
+  NodeDesiredConfig dc = getDesiredConfig(nodeId.c_str());
+  if (dc.aggSamplesPerReport != aggN || dc.aggStatsMask != statsMask) {
+    dc.aggSamplesPerReport = aggN;
+    dc.aggStatsMask = statsMask;
+    const NodeConfigApplyResult applied =
+        applyLocalDesiredConfig(nodeId, dc, false, false, true);
+    if (!applied.durable || !applied.registryApplied ||
+        (applied.command.outcome != OUT_ACCEPTED &&
+         applied.command.outcome != OUT_REPLAY)) {
+      server.send(500, "application/json",
+                  "{\"ok\":false,\"error\":\"config persistence failed\"}");
+      return;
+    }
+    dc = getDesiredConfig(nodeId.c_str());
+  }
+
+  Serial.printf("[CONFIG] %s aggregation -> N=%u statsMask=0x%04X desired v%u\n",
+                nodeId.c_str(), (unsigned)aggN, (unsigned)statsMask,
+                (unsigned)dc.configVersion);
+
+  String resp = String("{\"ok\":true,\"nodeId\":\"") + nodeId +
+                "\",\"aggSamplesPerReport\":" + String((unsigned)aggN) +
+                ",\"aggStatsMask\":" + String((unsigned)statsMask) +
+                ",\"configVersion\":" + String((unsigned)dc.configVersion) + "}";
+  server.send(200, "application/json", resp);
+}
+
+// POST /set-node-report-by-exception — send only channels that moved.
+//   node_id          registered node
+//   max_silence_min  heartbeat: a full snapshot at least this often; 0 turns
+//                    report-by-exception off (max NODE_RBE_MAX_SILENCE_MIN)
+//   deadband_scale   optional scale on the node's built-in per-channel
+//                    deadbands, in tenths (10 = x1.0, 0 or omitted = x1.0)
+// Applies to plain per-wake snapshots only; aggregation summaries are always
+// sent whole. The FieldHub fills the omitted channels back in from the last
+// full snapshot (carry_forward.h). See FIELDMESH_NODE_CONFIG_PROTOCOL.md.
+static void handleSetNodeReportByException() {
+  String nodeId = server.arg("node_id");
+  if (nodeId.length() == 0 || !server.hasArg("max_silence_min")) {
+    server.send(400, "application/json",
+                "{\"ok\":false,\"error\":\"node_id and max_silence_min required\"}");
+    return;
+  }
+  const long silence = server.arg("max_silence_min").toInt();
+  const long scale = server.arg("deadband_scale").toInt();
+  if (silence < 0 || silence > NODE_RBE_MAX_SILENCE_MIN || scale < 0 || scale > 255) {
+    server.send(400, "application/json",
+                "{\"ok\":false,\"error\":\"max_silence_min or deadband_scale out of range\"}");
+    return;
+  }
+  const uint16_t silenceMin = (uint16_t)silence;
+  const uint8_t tenths = silenceMin ? (uint8_t)scale : 0;
+
+  bool known = false;
+  for (const auto& n : registeredNodes) {
+    if (n.nodeId == nodeId) { known = true; break; }
+  }
+  if (!known) {
+    server.send(404, "application/json", "{\"ok\":false,\"error\":\"unknown node\"}");
+    return;
+  }
+
+  NodeDesiredConfig dc = getDesiredConfig(nodeId.c_str());
+  if (dc.rbeMaxSilenceMin != silenceMin || dc.rbeDeadbandTenths != tenths) {
+    dc.rbeMaxSilenceMin = silenceMin;
+    dc.rbeDeadbandTenths = tenths;
+    const NodeConfigApplyResult applied =
+        applyLocalDesiredConfig(nodeId, dc, false, false, false, true);
+    if (!applied.durable || !applied.registryApplied ||
+        (applied.command.outcome != OUT_ACCEPTED &&
+         applied.command.outcome != OUT_REPLAY)) {
+      server.send(500, "application/json",
+                  "{\"ok\":false,\"error\":\"config persistence failed\"}");
+      return;
+    }
+    dc = getDesiredConfig(nodeId.c_str());
+  }
+
+  Serial.printf("[CONFIG] %s report-by-exception -> maxSilence=%umin deadband=%u/10 desired v%u\n",
+                nodeId.c_str(), (unsigned)silenceMin, (unsigned)tenths,
+                (unsigned)dc.configVersion);
+
+  String resp = String("{\"ok\":true,\"nodeId\":\"") + nodeId +
+                "\",\"rbeMaxSilenceMin\":" + String((unsigned)silenceMin) +
+                ",\"rbeDeadbandTenths\":" + String((unsigned)tenths) +
+                ",\"configVersion\":" + String((unsigned)dc.configVersion) + "}";
+  server.send(200, "application/json", resp);
+}
+
+// POST /set-node-urgent-thresholds — send threshold crossings at once.
+//   node_id          registered node
+//   frost_below_c    optional: air temperature (°C) below which a snapshot is
+//                    urgent; omitted or empty = no frost alarm
+//   flood_above_mv   optional: soil 1 probe reading (mV) above which a
+//                    snapshot is urgent; omitted or empty = no flood alarm
+// With neither set the node reports on its normal schedule only. While any
+// deployed node has a threshold the FieldHub wakes for short listen windows on
+// the nodes' wake boundaries and POSTs urgent snapshots straight away (see
+// urgent_listen.h). See FIELDMESH_NODE_CONFIG_PROTOCOL.md.
+static void handleSetNodeUrgentThresholds() {
+  String nodeId = server.arg("node_id");
+  if (nodeId.length() == 0) {
+    server.send(400, "application/json", "{\"ok\":false,\"error\":\"node_id required\"}");
+    return;
+  }
+  uint8_t flags = 0;
+  int16_t airBelowCenti = 0;
+  uint16_t soilAboveMv = 0;
+  const String frost = server.arg("frost_below_c");
+  const String flood = server.arg("flood_above_mv");
+  if (frost.length() > 0) {
+    const float c = frost.toFloat();
+    if (c < -40.0f || c > 40.0f) {
+      server.send(400, "application/json",
+                  "{\"ok\":false,\"error\":\"frost_below_c out of range\"}");
+      return;
+    }
+    flags |= urgent_listen::kFrost;
+    airBelowCenti = (int16_t)lroundf(c * 100.0f);
+  }
+  if (flood.length() > 0) {
+    const long mv = flood.toInt();
+    if (mv <= 0 || mv > 65535) {
+      server.send(400, "application/json",
+                  "{\"ok\":false,\"error\":\"flood_above_mv out of range\"}");
+      return;
+    }
+    flags |= urgent_listen::kFlood;
+    soilAboveMv = (uint16_t)mv;
+  }
+
+  bool known = false;
+  for (const auto& n : registeredNodes) {
+    if (n.nodeId == nodeId) { known = true; break; }
+  }
+  if (!known) {
+    server.send(404, "application/json", "{\"ok\":false,\"error\":\"unknown node\"}");
+    return;
+  }
+
+  NodeDesiredConfig dc = getDesiredConfig(nodeId.c_str());
+  if (dc.urgentFlags != flags || dc.urgentAirBelowCenti != airBelowCenti ||
+      dc.urgentSoilAboveMv != soilAboveMv) {
+    dc.urgentFlags = flags;
+    dc.urgentAirBelowCenti = airBelowCenti;
+    dc.urgentSoilAboveMv = soilAboveMv;
+    const NodeConfigApplyResult applied =
+        applyLocalDesiredConfig(nodeId, dc, false, false, false, false, true);
+    if (!applied.durable || !applied.registryApplied ||
+        (applied.command.outcome != OUT_ACCEPTED &&
+         applied.command.outcome != OUT_REPLAY)) {
+      server.send(500, "application/json",
+                  "{\"ok\":false,\"error\":\"config persistence failed\"}");
+      return;
+    }
+    dc = getDesiredConfig(nodeId.c_str());
+  }
+
+  Serial.printf("[CONFIG] %s urgent thresholds -> flags=0x%02X frost<%.2fC flood>%umV desired v%u\n",
+                nodeId.c_str(), (unsigned)flags, airBelowCenti / 100.0f,
+                (unsigned)soilAboveMv, (unsigned)dc.configVersion);
+
+  String resp = String("{\"ok\":true,\"nodeId\":\"") + nodeId +
+                "\",\"urgentFlags\":" + String((unsigned)flags) +
+                ",\"urgentAirBelowCenti\":" + String((int)airBelowCenti) +
+                ",\"urgentSoilAboveMv\":" + String((unsigned)soilAboveMv) +
+                ",\"configVersion\":" + String((unsigned)dc.configVersion) + "}";
+  server.send(200, "application/json", resp);
+}
+
 // GET /api/control - authoritative revision, cursor, enable flag and results.
 // Uses the backend-control serializer so local and cloud views stay identical.
 static void handleControlStatus() {
@@ -7006,6 +6562,18 @@ static void handleFirmwarePage() {
          "running firmware is left untouched.</p>"
          "<form method=POST action='/firmware/image' enctype='multipart/form-data'>"
          "<input type=file name=fw> <button>Upload &amp; install</button></form>");
+
+  NodeImageCacheStatus n = nodeImageCacheGetStatus();
+  h += "<hr><h3>Node fleet image</h3><p><b>Cached:</b> ";
+  h += (n.present ? "yes" : "no");
+  if (n.present || n.uploading) { h += " &rarr; v"; h += n.version; h += " hw "; h += n.hwTarget;
+                                  h += " ("; h += n.releaseId; h += "), "; h += String(n.size);
+                                  h += " bytes"; }
+  h += "</p><p><b>Last result:</b> "; h += fwReasonStr(n.lastReason); h += "</p>";
+  h += F("<p>Stage the signed manifest at /firmware/node/manifest, then upload node.bin. "
+         "Nodes collect it over ESP-NOW during sync sessions (progress: /api/fleet-ota).</p>"
+         "<form method=POST action='/firmware/node/image' enctype='multipart/form-data'>"
+         "<input type=file name=fw> <button>Upload node image</button></form>");
   server.send(200, "text/html", h);
 }
 
@@ -7066,6 +6634,104 @@ static void handleFirmwareImageDone() {
   }
 }
 
+// ---------------------------------------------------------------------------
+// Node fleet image (/firmware/node) — broadcast to nodes during sync sessions
+// Step 1: POST /firmware/node/manifest  (body = manifest.json, ?sig=<128 hex>)
+// Step 2: POST /firmware/node/image     (multipart file = matching node.bin)
+// POST /firmware/node/clear stops offering it; GET /api/fleet-ota reports progress.
+// ---------------------------------------------------------------------------
+static FwReason gNodeImageUploadReason = FW_NONE;
+
+static void handleNodeFirmwareManifest() {
+  String body = server.arg("plain");
+  String sigHex = server.arg("sig");
+  if (body.length() == 0 || sigHex.length() != 128) {
+    server.send(400, "application/json",
+                "{\"error\":\"POST manifest.json as body, ?sig=<128 hex>\"}");
+    return;
+  }
+  uint8_t sig[64];
+  if (!fwHexToBytes(sigHex.c_str(), sig, 64)) {
+    server.send(400, "application/json", "{\"error\":\"bad signature hex\"}");
+    return;
+  }
+  FwReason r = nodeImageCacheVerifyManifest((const uint8_t*)body.c_str(), body.length(), sig);
+  NodeImageCacheStatus s = nodeImageCacheGetStatus();
+  String resp = String("{\"reason\":\"") + fwReasonStr(r) +
+                "\",\"targetVersion\":\"" + s.version +
+                "\",\"hwTarget\":\"" + s.hwTarget +
+                "\",\"size\":" + String(s.size) + "}";
+  server.send(r == FW_NONE ? 200 : 400, "application/json", resp);
+}
+
+// Streamed like /firmware/image; the first failure sticks so the reply names it.
+static void handleNodeFirmwareImageData() {
+  HTTPUpload& up = server.upload();
+  if (up.status == UPLOAD_FILE_START) {
+    gNodeImageUploadReason = FW_NONE;
+  } else if (up.status == UPLOAD_FILE_WRITE) {
+    if (gNodeImageUploadReason == FW_NONE) {
+      gNodeImageUploadReason = nodeImageCacheWrite(up.buf, up.currentSize);
+    }
+  } else if (up.status == UPLOAD_FILE_ABORTED) {
+    nodeImageCacheAbort();
+  }
+}
+
+static void handleNodeFirmwareImageDone() {
+  FwReason r = gNodeImageUploadReason;
+  if (r == FW_NONE) r = nodeImageCacheFinish();
+  else nodeImageCacheAbort();
+  NodeImageCacheStatus s = nodeImageCacheGetStatus();
+  String resp = String("{\"reason\":\"") + fwReasonStr(r) +
+                "\",\"cached\":" + (s.present ? "true" : "false") +
+                ",\"imageId\":" + String((unsigned long)s.imageId) +
+                ",\"written\":" + String(s.written) + "}";
+  server.send(r == FW_NONE ? 200 : 400, "application/json", resp);
+}
+
+static void handleNodeFirmwareClear() {
+  const bool ok = nodeImageCacheClear();
+  server.send(ok ? 200 : 500, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
+}
+
+// GET /api/fleet-ota - cached node image plus last reported state per node.
+static void handleFleetOtaStatus() {
+  NodeImageCacheStatus img = nodeImageCacheGetStatus();
+  static FleetOtaNodeEntry entries[kFleetOtaMaxEntries];
+  const uint8_t count = fleetOtaGetEntries(entries, kFleetOtaMaxEntries);
+
+  String body;
+  body.reserve(256 + (size_t)count * 112);
+  body += F("{\"image\":{\"present\":");
+  body += img.present ? "true" : "false";
+  body += F(",\"version\":\""); body += img.version;
+  body += F("\",\"hwTarget\":\""); body += img.hwTarget;
+  body += F("\",\"releaseId\":\""); body += img.releaseId;
+  body += F("\",\"imageId\":"); body += String((unsigned long)img.imageId);
+  body += F(",\"size\":"); body += String(img.size);
+  body += F(",\"chunkCount\":"); body += String((unsigned)fotaChunkCountFor(img.size));
+  body += F("},\"nodes\":[");
+  for (uint8_t i = 0; i < count; ++i) {
+    const FleetOtaNodeEntry& e = entries[i];
+    const char* state = e.status == FOTA_RESULT_ARMED     ? "armed"
+                      : e.status == FOTA_RESULT_INSTALLED ? "installed"
+                      : e.status == FOTA_RESULT_FAILED    ? "failed"
+                                                          : "receiving";
+    if (i) body += ',';
+    body += F("{\"nodeId\":\""); body += e.nodeId;
+    body += F("\",\"imageId\":"); body += String((unsigned long)e.imageId);
+    body += F(",\"state\":\""); body += state;
+    body += F("\",\"reason\":\""); body += fwReasonStr((FwReason)e.reason);
+    body += F("\",\"chunksHave\":"); body += String((unsigned)e.chunksHave);
+    body += F(",\"sessionId\":"); body += String((unsigned long)e.sessionId);
+    body += '}';
+  }
+  body += F("]}");
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, "application/json", body);
+}
+
 void startConfigServer() {
   // Load the shared control revision + recent command results from NVS so a
   // reboot mid-session resumes the same authoritative revision.
@@ -7102,8 +6768,20 @@ void startConfigServer() {
   Serial.print("[AP] MAC: ");   Serial.println(WiFi.softAPmacAddress());
   Serial.print("[AP] channel: "); Serial.println(WiFi.channel());
 
+  // Conditional and compressed asset requests (sendPortalAsset()).
+  static const char* kCollectHeaders[] = {"If-None-Match", "Accept-Encoding"};
+  server.collectHeaders(kCollectHeaders, 2);
+
   // Routes
   server.on("/", HTTP_ANY, handleRoot);
+  server.on("/fm.css", HTTP_GET, []() {
+    sendPortalAsset("text/css", PORTAL_CSS, sizeof(PORTAL_CSS) - 1,
+                    PORTAL_CSS_GZ, sizeof(PORTAL_CSS_GZ), PORTAL_CSS_ETAG);
+  });
+  server.on("/fm.js", HTTP_GET, []() {
+    sendPortalAsset("application/javascript", PORTAL_JS, sizeof(PORTAL_JS) - 1,
+                    PORTAL_JS_GZ, sizeof(PORTAL_JS_GZ), PORTAL_JS_ETAG);
+  });
   // OS connectivity checks — answer each with its expected "internet OK"
   // signal so phones stay attached to the AP (see the probe responders above).
   server.on("/generate_204", HTTP_ANY, sendProbeNoContent);        // Android
@@ -7159,6 +6837,9 @@ void startConfigServer() {
   server.on("/station-setup", HTTP_GET, handleStationSetupWizard);
   server.on("/node-sensors", HTTP_GET, handleNodeSensorsPage);
   server.on("/set-node-sensors", HTTP_POST, handleSetNodeSensors);
+  server.on("/set-node-aggregation", HTTP_POST, handleSetNodeAggregation);
+  server.on("/set-node-report-by-exception", HTTP_POST, handleSetNodeReportByException);
+  server.on("/set-node-urgent-thresholds", HTTP_POST, handleSetNodeUrgentThresholds);
   server.on("/revert-node", HTTP_POST, handleRevertNode);
 
   server.on("/settings", HTTP_GET, handleSettings);
@@ -7222,6 +6903,11 @@ void startConfigServer() {
   server.on("/firmware", HTTP_GET, handleFirmwarePage);
   server.on("/firmware/manifest", HTTP_POST, handleFirmwareManifest);
   server.on("/firmware/image", HTTP_POST, handleFirmwareImageDone, handleFirmwareImageData);
+  server.on("/firmware/node/manifest", HTTP_POST, handleNodeFirmwareManifest);
+  server.on("/firmware/node/image", HTTP_POST, handleNodeFirmwareImageDone,
+            handleNodeFirmwareImageData);
+  server.on("/firmware/node/clear", HTTP_POST, handleNodeFirmwareClear);
+  server.on("/api/fleet-ota", HTTP_GET, handleFleetOtaStatus);
 
   server.onNotFound(sendCaptivePortalLanding);
   dnsServer.start(53, "*", WiFi.softAPIP());
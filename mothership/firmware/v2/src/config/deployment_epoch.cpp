@@ -1,5 +1,6 @@
 #include "config/deployment_epoch.h"
 #include "config/node_registry.h"
+#include "storage/flash_logger.h"
 
 #include <string.h>
 
@@ -37,10 +38,7 @@ static bool applyDesiredState(const String& nodeId, uint8_t targetState) {
 // ---------------------------------------------------------------------------
 
 static NodeInfo* findNode(const String& nodeId) {
-  for (auto& n : registeredNodes) {
-    if (n.nodeId == nodeId) return &n;
-  }
-  return nullptr;
+  return registeredNodes.findById(nodeId.c_str());
 }
 
 static DeploymentOpResult makeResult(DeploymentOpStatus status,
@@ -777,7 +775,45 @@ DeploymentBackfillResult deploymentQueueFieldMeshBackfill() {
 // Epoch resolution
 // ---------------------------------------------------------------------------
 
-uint16_t resolveEpochForSample(const char* nodeId, uint32_t sampleUnix) {
+// A backlog drain delivers dozens of consecutive samples from one node that all
+// land in the same boundary interval, and each used to scan the slot table by
+// nodeId and walk the history again. Each resolution now remembers the interval
+// [fromUnix, toUnix) it matched, per node. A later sample inside that interval
+// answers from the cache. Entries are valid only for the store revision they
+// were filled under, so any Start/End/reload invalidates them all.
+//
+// Direct-mapped on fnv1a32(nodeId): a collision just costs a re-resolve.
+static constexpr size_t kEpochCacheSize = 16;
+
+struct EpochCacheEntry {
+  char     nodeId[kDeployNodeIdLen];
+  uint32_t revision;
+  uint32_t fromUnix;
+  uint32_t toUnix;          // exclusive; UINT32_MAX = open-ended
+  uint16_t epoch;
+  bool     clamped;         // hits still count as clamped attributions
+  bool     valid;
+};
+
+static EpochCacheEntry gEpochCache[kEpochCacheSize];
+
+static EpochCacheEntry& epochCacheSlot(const char* nodeId) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < kDeployNodeIdLen && nodeId[i]; ++i) {
+    h ^= (uint8_t)nodeId[i];
+    h *= 16777619UL;
+  }
+  return gEpochCache[h % kEpochCacheSize];
+}
+
+// The full lookup. Also reports the interval around sampleUnix that resolves
+// the same way, so the caller can cache it.
+static uint16_t resolveEpochUncached(const char* nodeId, uint32_t sampleUnix,
+                                     EpochCacheEntry& window) {
+  window.fromUnix = 0;
+  window.toUnix = UINT32_MAX;
+  window.clamped = false;
+
   const DeploymentSlot* s = deploymentFindByNodeId(nodeId);
   if (!s || s->epoch == 0) return 0;   // unknown / never deployed — backend falls back
 
@@ -788,22 +824,66 @@ uint16_t resolveEpochForSample(const char* nodeId, uint32_t sampleUnix) {
   // plausible-but-wrong RTC still lands in the wrong interval and nothing in the
   // current wire format can detect that (qualityFlags is hard-coded to 0 at
   // capture).
-  if (sampleUnix < kPlausibleSampleFloor) return s->epoch;
+  if (sampleUnix < kPlausibleSampleFloor) {
+    window.toUnix = kPlausibleSampleFloor;
+    return s->epoch;
+  }
+  window.fromUnix = kPlausibleSampleFloor;
   if (s->historyCount == 0) return s->epoch;
 
   // history[] is oldest -> newest; the sample belongs to the newest boundary it
   // is at or after. This is why it is an interval lookup and not "epoch - 1":
   // a backlog delivered during epoch 3 may belong to epoch 1.
+  //
+  // The interval ends at the earliest newer boundary, not just the next one, so
+  // it stays exact even if the history is out of order after a clock fix.
+  uint32_t below = UINT32_MAX;
   for (int i = (int)s->historyCount - 1; i >= 0; --i) {
-    if (sampleUnix >= s->history[i].startedUnix) return s->history[i].epoch;
+    const uint32_t start = s->history[i].startedUnix;
+    if (sampleUnix >= start) {
+      if (start > window.fromUnix) window.fromUnix = start;
+      window.toUnix = below;
+      return s->history[i].epoch;
+    }
+    if (start < below) below = start;
   }
 
   // Older than every boundary we retain. Clamp to the oldest known epoch and
   // count it, so the backend can tell approximate attribution from exact.
+  window.toUnix = below;
+  window.clamped = true;
   deploymentNoteEpochClamp();
   return s->history[0].epoch;
 }
 
+uint16_t resolveEpochForSample(const char* nodeId, uint32_t sampleUnix) {
+  if (!nodeId) return 0;
+  EpochCacheEntry& entry = epochCacheSlot(nodeId);
+  const uint32_t revision = deploymentStoreRevision();
+  if (entry.valid && entry.revision == revision &&
+      strncmp(entry.nodeId, nodeId, kDeployNodeIdLen) == 0 &&
+      sampleUnix >= entry.fromUnix && sampleUnix < entry.toUnix) {
+    if (entry.clamped) deploymentNoteEpochClamp();
+    return entry.epoch;
+  }
+
+  EpochCacheEntry window{};
+  const uint16_t epoch = resolveEpochUncached(nodeId, sampleUnix, window);
+  window.epoch = epoch;
+  window.revision = revision;
+  window.valid = true;
+  strncpy(window.nodeId, nodeId, kDeployNodeIdLen);
+  entry = window;
+  return epoch;
+}
+
+void stampDeploymentEpoch(DecodedSnapshot& snap) {
+  char nodeId[kDeployNodeIdLen + 1];
+  memcpy(nodeId, snap.nodeId, kDeployNodeIdLen);
+  nodeId[kDeployNodeIdLen] = '\0';
+  snap.deploymentEpoch = resolveEpochForSample(nodeId, snap.nodeTimestamp);
+}
+
 // ---------------------------------------------------------------------------
 // Registry mirror
 // ---------------------------------------------------------------------------
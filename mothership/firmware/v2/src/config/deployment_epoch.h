@@ -163,8 +163,16 @@ bool deploymentTouchActiveEvent(const String& nodeId);
 //   0                  unknown node / never deployed (backend falls back)
 //   exact epoch        sampleUnix falls inside a retained boundary interval
 //   oldest known epoch sample predates every retained boundary (clamped, counted)
+//
+// Memoised per node on the matched boundary interval and invalidated by
+// deploymentStoreRevision(), so a backlog drain resolves each node once.
 uint16_t resolveEpochForSample(const char* nodeId, uint32_t sampleUnix);
 
+// Stamp snap.deploymentEpoch in place. The ingest paths own their decoded
+// snapshot, so there is no need to copy it just to set one field.
+struct DecodedSnapshot;
+void stampDeploymentEpoch(DecodedSnapshot& snap);
+
 // Mirror the store's per-node fields onto registeredNodes so the UI and
 // status.nodes[] can read them without touching the store.
 void deploymentSyncRegistryMirror();
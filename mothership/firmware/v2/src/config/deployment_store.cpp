@@ -14,6 +14,7 @@ static const char* kDeployTmp    = "/deploy.tmp";
 static const char* kDeployBak    = "/deploy.bak";
 static const char* kDeployV1Bak  = "/deploy.v1";
 static const char* kDeployV1Tmp  = "/deploy.v1.tmp";
+static const char* kDeployJournal = "/deploy.jnl";
 
 static constexpr uint32_t kDeployMagic   = 0x4650444DUL;  // "FPDM"
 static constexpr uint16_t kDeployVersion = 2;
@@ -84,6 +85,73 @@ struct DeploymentRecord {
 static DeploymentRecord gRecord;
 static bool gReady        = false;
 static bool gCreatedFresh = false;
+static uint32_t gRevision = 0;
+
+// ---------------------------------------------------------------------------
+// Commit journal
+// ---------------------------------------------------------------------------
+// A Start or End touches one slot and one outbox event, yet every commit used to
+// rewrite the whole record (64 slots with their archives, ~25 KB) through a
+// temp file and two renames — on every lifecycle transition and every upload
+// ack. Commits now append only what
+// changed to /deploy.jnl as one self-checksummed frame:
+//
+//   frame   JournalFrameHeader | entries | fnv1a32(header + entries)
+//   entry   JournalEntryHeader | whole DeploymentSlot / DeploymentEvent /
+//           JournalScalars at that table index
+//
+// A frame carries every entry of one commit, so it replays all-or-nothing: a
+// torn or corrupt frame is dropped whole, exactly like an interrupted rename
+// used to be. Frames chain by generation — each must be base generation + 1,
+// then + 2, ... — so a journal left over from before a compaction, or one that
+// belongs to a newer base than the one that loaded, never applies.
+//
+// Once the journal passes kJournalCompactBytes, the next commit folds it back
+// into /deploy.bin through the original temp->rename sequence and removes it.
+// The base is always complete on its own, so the journal is purely additive.
+static constexpr uint32_t kJournalMagic = 0x4A50444DUL;  // "JPDM"
+
+enum JournalEntryKind : uint8_t {
+  JOURNAL_ENTRY_SLOT    = 1,
+  JOURNAL_ENTRY_EVENT   = 2,
+  JOURNAL_ENTRY_SCALARS = 3,
+};
+
+struct JournalFrameHeader {
+  uint32_t magic;
+  uint32_t generation;
+  uint16_t entryCount;
+  uint16_t reserved;
+  uint32_t payloadBytes;      // entries only; the trailing checksum is extra
+};
+
+struct JournalEntryHeader {
+  uint8_t  kind;
+  uint8_t  index;
+  uint16_t length;
+};
+
+// The record-level fields outside the two tables.
+struct JournalScalars {
+  uint8_t  outboxCount;
+  uint8_t  reserved[3];
+  uint32_t epochClampCount;
+};
+
+static constexpr size_t kJournalCompactBytes = sizeof(DeploymentRecord) / 2;
+
+// Hash of each table entry as last made durable, so a commit can tell which
+// entries it has to journal. Callers mutate slots through the pointers handed
+// out below, so there is no other dirty signal to hook.
+static uint32_t gSlotHash[kMaxDeployNodes];
+static uint32_t gEventHash[kMaxOutboxEvents];
+static uint32_t gScalarsHash = 0;
+// True while /deploy.bin (or the .bak it recovered from) plus the journal
+// reproduce gRecord. Cleared whenever that chain is in doubt, which forces the
+// next commit to compact.
+static bool   gJournalChained = false;
+static size_t gJournalBytes   = 0;
+static JournalScalars gReplayScalars;
 
 // Pin the size so the outbox/table cannot be grown carelessly into something
 // that strains a 768 KB LittleFS shared with the reading buffer.
@@ -96,8 +164,7 @@ static_assert(sizeof(DeploymentRecordV1) < sizeof(DeploymentRecord),
 // Helpers
 // ---------------------------------------------------------------------------
 
-static uint32_t fnv1a32(const uint8_t* data, size_t len) {
-  uint32_t h = 2166136261UL;
+static uint32_t fnv1a32Update(uint32_t h, const uint8_t* data, size_t len) {
   for (size_t i = 0; i < len; ++i) {
     h ^= data[i];
     h *= 16777619UL;
@@ -105,6 +172,10 @@ static uint32_t fnv1a32(const uint8_t* data, size_t len) {
   return h;
 }
 
+static uint32_t fnv1a32(const uint8_t* data, size_t len) {
+  return fnv1a32Update(2166136261UL, data, len);
+}
+
 // By CONST REFERENCE, and hashing the prefix rather than a zeroed copy.
 //
 // This used to take the record by value to zero the checksum field before
@@ -416,13 +487,197 @@ static String jsonEscape(const char* v) {
   return out;
 }
 
+// ---------------------------------------------------------------------------
+// Journal helpers
+// ---------------------------------------------------------------------------
+
+template <typename T>
+static uint32_t hashOf(const T& value) {
+  return fnv1a32(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+}
+
+static JournalScalars currentScalars() {
+  JournalScalars s{};
+  s.outboxCount     = gRecord.outboxCount;
+  s.epochClampCount = gRecord.epochClampCount;
+  return s;
+}
+
+// Baseline for the next commit's diff: whatever is in gRecord now is durable.
+static void noteRecordDurable() {
+  for (size_t i = 0; i < kMaxDeployNodes; ++i) gSlotHash[i] = hashOf(gRecord.nodes[i]);
+  for (size_t i = 0; i < kMaxOutboxEvents; ++i) gEventHash[i] = hashOf(gRecord.outbox[i]);
+  gScalarsHash = hashOf(currentScalars());
+}
+
+// Where an entry's payload lands in RAM, or nullptr if the header does not
+// describe an entry this build can hold (struct drift, or a corrupt header that
+// happened to pass the frame checksum).
+static uint8_t* journalEntryTarget(const JournalEntryHeader& e) {
+  switch (e.kind) {
+    case JOURNAL_ENTRY_SLOT:
+      if (e.index >= kMaxDeployNodes || e.length != sizeof(DeploymentSlot)) return nullptr;
+      return reinterpret_cast<uint8_t*>(&gRecord.nodes[e.index]);
+    case JOURNAL_ENTRY_EVENT:
+      if (e.index >= kMaxOutboxEvents || e.length != sizeof(DeploymentEvent)) return nullptr;
+      return reinterpret_cast<uint8_t*>(&gRecord.outbox[e.index]);
+    case JOURNAL_ENTRY_SCALARS:
+      if (e.index != 0 || e.length != sizeof(JournalScalars)) return nullptr;
+      return reinterpret_cast<uint8_t*>(&gReplayScalars);
+    default:
+      return nullptr;
+  }
+}
+
+// First pass over one frame, positioned just past its header: every entry
+// header is well formed, the entries fill payloadBytes exactly, and the
+// trailing checksum matches. Nothing is applied, so a frame that fails here
+// leaves gRecord untouched.
+static bool journalFrameValid(File& f, const JournalFrameHeader& hdr) {
+  uint32_t h = fnv1a32(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr));
+  uint32_t left = hdr.payloadBytes;
+  uint8_t  buf[64];
+  for (uint16_t n = 0; n < hdr.entryCount; ++n) {
+    JournalEntryHeader e{};
+    if (left < sizeof(e) ||
+        f.read(reinterpret_cast<uint8_t*>(&e), sizeof(e)) != sizeof(e)) return false;
+    left -= sizeof(e);
+    if (!journalEntryTarget(e) || left < e.length) return false;
+    left -= e.length;
+    h = fnv1a32Update(h, reinterpret_cast<const uint8_t*>(&e), sizeof(e));
+    for (uint16_t done = 0; done < e.length;) {
+      const size_t chunk = min((size_t)(e.length - done), sizeof(buf));
+      if (f.read(buf, chunk) != chunk) return false;
+      h = fnv1a32Update(h, buf, chunk);
+      done += chunk;
+    }
+  }
+  uint32_t stored = 0;
+  if (left != 0 ||
+      f.read(reinterpret_cast<uint8_t*>(&stored), sizeof(stored)) != sizeof(stored)) {
+    return false;
+  }
+  return stored == h;
+}
+
+// Second pass over a frame that journalFrameValid() accepted.
+static bool journalFrameApply(File& f, const JournalFrameHeader& hdr) {
+  gReplayScalars = currentScalars();
+  for (uint16_t n = 0; n < hdr.entryCount; ++n) {
+    JournalEntryHeader e{};
+    if (f.read(reinterpret_cast<uint8_t*>(&e), sizeof(e)) != sizeof(e)) return false;
+    uint8_t* dst = journalEntryTarget(e);
+    if (!dst || f.read(dst, e.length) != e.length) return false;
+  }
+  gRecord.outboxCount     = min(gReplayScalars.outboxCount, (uint8_t)kMaxOutboxEvents);
+  gRecord.epochClampCount = gReplayScalars.epochClampCount;
+  gRecord.generation      = hdr.generation;
+  return true;
+}
+
+// Replays every frame that chains onto the loaded base. Returns false when the
+// journal holds anything that did not apply — a torn tail, a stale frame from
+// before a compaction, a gap — so the caller can clean it up before anything is
+// appended behind it. framesApplied tells the caller whether RAM now holds
+// state that exists only in the journal.
+static bool replayJournal(uint16_t& framesApplied) {
+  framesApplied = 0;
+  gJournalBytes = 0;
+  if (!LittleFS.exists(kDeployJournal)) return true;
+  File f = LittleFS.open(kDeployJournal, "r");
+  if (!f) return false;
+
+  const size_t total = f.size();
+  size_t pos = 0;
+  bool clean = true;
+  while (pos < total) {
+    JournalFrameHeader hdr{};
+    if (!f.seek(pos) ||
+        f.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) != sizeof(hdr) ||
+        hdr.magic != kJournalMagic ||
+        hdr.payloadBytes > total - pos - sizeof(hdr)) {
+      clean = false;
+      break;
+    }
+    const size_t frameBytes = sizeof(hdr) + hdr.payloadBytes + sizeof(uint32_t);
+    if (!journalFrameValid(f, hdr)) { clean = false; break; }
+    if (hdr.generation <= gRecord.generation) {
+      // Already folded into the base by a compaction that was cut short before
+      // it could remove the journal.
+      clean = false;
+      pos += frameBytes;
+      continue;
+    }
+    if (hdr.generation != gRecord.generation + 1) { clean = false; break; }
+    // A frame that validated but cannot be re-read leaves gRecord partly
+    // updated. Treat the store as unusable rather than guess.
+    if (!f.seek(pos + sizeof(hdr)) || !journalFrameApply(f, hdr)) {
+      f.close();
+      return false;
+    }
+    framesApplied++;
+    pos += frameBytes;
+    gJournalBytes = pos;
+  }
+  f.close();
+  return clean;
+}
+
+// Append one frame holding every entry that differs from the durable baseline.
+// Bytes written scale with what the caller changed, not with the table size.
+static bool appendJournalFrame(uint16_t entryCount, uint32_t payloadBytes) {
+  JournalFrameHeader hdr{};
+  hdr.magic        = kJournalMagic;
+  hdr.generation   = gRecord.generation + 1;
+  hdr.entryCount   = entryCount;
+  hdr.payloadBytes = payloadBytes;
+
+  File f = LittleFS.open(kDeployJournal, "a");
+  if (!f) return false;
+  bool ok = f.write(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr)) == sizeof(hdr);
+  uint32_t h = fnv1a32(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr));
+
+  auto put = [&](uint8_t kind, uint8_t index, const void* data, uint16_t length) {
+    const JournalEntryHeader e{kind, index, length};
+    h = fnv1a32Update(h, reinterpret_cast<const uint8_t*>(&e), sizeof(e));
+    h = fnv1a32Update(h, static_cast<const uint8_t*>(data), length);
+    ok = ok &&
+         f.write(reinterpret_cast<const uint8_t*>(&e), sizeof(e)) == sizeof(e) &&
+         f.write(static_cast<const uint8_t*>(data), length) == length;
+  };
+  for (size_t i = 0; i < kMaxDeployNodes; ++i) {
+    if (hashOf(gRecord.nodes[i]) != gSlotHash[i]) {
+      put(JOURNAL_ENTRY_SLOT, (uint8_t)i, &gRecord.nodes[i], sizeof(DeploymentSlot));
+    }
+  }
+  for (size_t i = 0; i < kMaxOutboxEvents; ++i) {
+    if (hashOf(gRecord.outbox[i]) != gEventHash[i]) {
+      put(JOURNAL_ENTRY_EVENT, (uint8_t)i, &gRecord.outbox[i], sizeof(DeploymentEvent));
+    }
+  }
+  const JournalScalars scalars = currentScalars();
+  put(JOURNAL_ENTRY_SCALARS, 0, &scalars, sizeof(scalars));
+
+  ok = ok && f.write(reinterpret_cast<const uint8_t*>(&h), sizeof(h)) == sizeof(h);
+  ok = ok && !f.getWriteError();
+  f.close();
+  if (!ok) return false;
+
+  gRecord.generation = hdr.generation;
+  gJournalBytes += sizeof(hdr) + payloadBytes + sizeof(h);
+  return true;
+}
+
 // ---------------------------------------------------------------------------
 // Lifecycle
 // ---------------------------------------------------------------------------
 
 bool deploymentStoreBegin() {
+  gRevision++;
   gReady = false;
   gCreatedFresh = false;
+  gJournalChained = false;
+  gJournalBytes = 0;
 
   // A commit that was interrupted mid-rename can leave the temp file behind.
   // It is never authoritative — the record is only live once it is at
@@ -458,6 +713,18 @@ bool deploymentStoreBegin() {
     }
   }
 
+  // The journal only means something on top of the base it was written
+  // against. With no current-version base it is an orphan: drop it so the
+  // fresh or migrated record below is not followed by someone else's frames.
+  bool journalClean = true;
+  uint16_t journalFrames = 0;
+  if (loaded) {
+    journalClean = replayJournal(journalFrames);
+    gJournalChained = true;
+  } else {
+    LittleFS.remove(kDeployJournal);
+  }
+
   const bool loadedCurrentVersion = loaded;
   bool migratedV1 = false;
   if (!loaded) {
@@ -477,6 +744,26 @@ bool deploymentStoreBegin() {
   }
 
   gReady = true;
+  noteRecordDurable();
+
+  if (!journalClean) {
+    // Never append behind a frame that did not replay. If nothing applied, the
+    // base alone is the whole story and the journal can simply go; otherwise
+    // fold what did apply into a new base now.
+    if (journalFrames == 0) {
+      LittleFS.remove(kDeployJournal);
+      gJournalBytes = 0;
+    } else {
+      Serial.printf("[DEPLOY] Journal had an unusable tail after %u frame(s) — compacting\n",
+                    (unsigned)journalFrames);
+      gJournalChained = false;
+      if (!deploymentStoreCommit()) {
+        Serial.println("[DEPLOY] Journal compaction failed");
+        gReady = false;
+        return false;
+      }
+    }
+  }
 
   if ((gCreatedFresh || migratedV1) && !deploymentStoreCommit()) {
     Serial.println(migratedV1
@@ -492,10 +779,11 @@ bool deploymentStoreBegin() {
     LittleFS.remove(kDeployV1Bak);
   }
 
-  Serial.printf("[DEPLOY] Store ready (gen=%lu, outbox=%u, fresh=%d)\n",
+  Serial.printf("[DEPLOY] Store ready (gen=%lu, outbox=%u, fresh=%d, journal=%u frames/%u B)\n",
                 (unsigned long)gRecord.generation,
                 (unsigned)gRecord.outboxCount,
-                gCreatedFresh ? 1 : 0);
+                gCreatedFresh ? 1 : 0,
+                (unsigned)journalFrames, (unsigned)gJournalBytes);
   return true;
 }
 
@@ -506,9 +794,11 @@ bool deploymentStoreWasCreatedFresh() { return gCreatedFresh; }
 // Atomic commit
 // ---------------------------------------------------------------------------
 
-bool deploymentStoreCommit() {
-  if (!gReady) return false;
-
+// Rewrite the whole record as the new base and retire the journal. Removing the
+// journal LAST is what keeps this crash-safe: until then, the old base plus the
+// journal still reproduce the same state, and once the new base is in place its
+// generation marks every remaining frame as stale.
+static bool compactRecord() {
   gRecord.magic   = kDeployMagic;
   gRecord.version = kDeployVersion;
   gRecord.size    = sizeof(DeploymentRecord);
@@ -553,9 +843,48 @@ bool deploymentStoreCommit() {
     return false;
   }
   if (hadPrimary) LittleFS.remove(kDeployBak);
+  LittleFS.remove(kDeployJournal);
+  gJournalBytes = 0;
+  gJournalChained = true;
+  noteRecordDurable();
   return true;
 }
 
+bool deploymentStoreCommit() {
+  if (!gReady) return false;
+  // A failed transition restores slots by assignment before committing again.
+  gRevision++;
+
+  uint16_t entries = 1;  // scalars ride in every frame
+  uint32_t payload = sizeof(JournalEntryHeader) + sizeof(JournalScalars);
+  for (size_t i = 0; i < kMaxDeployNodes; ++i) {
+    if (hashOf(gRecord.nodes[i]) == gSlotHash[i]) continue;
+    entries++;
+    payload += sizeof(JournalEntryHeader) + sizeof(DeploymentSlot);
+  }
+  for (size_t i = 0; i < kMaxOutboxEvents; ++i) {
+    if (hashOf(gRecord.outbox[i]) == gEventHash[i]) continue;
+    entries++;
+    payload += sizeof(JournalEntryHeader) + sizeof(DeploymentEvent);
+  }
+  const bool scalarsChanged = hashOf(currentScalars()) != gScalarsHash;
+  if (gJournalChained && entries == 1 && !scalarsChanged) return true;  // nothing new
+
+  const size_t frameBytes = sizeof(JournalFrameHeader) + payload + sizeof(uint32_t);
+  if (gJournalChained && gJournalBytes + frameBytes <= kJournalCompactBytes) {
+    if (appendJournalFrame(entries, payload)) {
+      noteRecordDurable();
+      return true;
+    }
+    // A failed append may have left a partial frame. Replay would stop there
+    // and never reach anything appended after it, so the only safe way on is a
+    // full rewrite that retires the journal.
+    Serial.println("[DEPLOY] commit: journal append failed; compacting");
+    gJournalChained = false;
+  }
+  return compactRecord();
+}
+
 // ---------------------------------------------------------------------------
 // Slot access
 // ---------------------------------------------------------------------------
@@ -578,8 +907,11 @@ const DeploymentSlot* deploymentFindByMac(const uint8_t* mac) {
   return nullptr;
 }
 
+uint32_t deploymentStoreRevision() { return gRevision; }
+
 DeploymentSlot* deploymentSlotFor(const uint8_t* mac, const char* nodeId) {
   if (!gReady) return nullptr;
+  gRevision++;
 
   // MAC first — it is the registry's real identity and survives a nodeId change.
   if (mac) {
@@ -615,6 +947,7 @@ DeploymentSlot* deploymentSlotFor(const uint8_t* mac, const char* nodeId) {
 }
 
 void deploymentPushBoundary(DeploymentSlot& slot, uint16_t epoch, uint32_t startedUnix) {
+  gRevision++;
   // Replace in place if this epoch is already the newest entry (a repeated
   // commit of the same transition must not grow the ring).
   if (slot.historyCount > 0 &&
@@ -830,9 +1163,13 @@ void deploymentNoteEpochClamp() {
 }
 
 void deploymentStoreResetForTest() {
+  gRevision++;
   initFreshRecord();
   gReady = true;
   gCreatedFresh = true;
+  // The flash no longer matches RAM; make the next commit a full rewrite.
+  gJournalChained = false;
+  gJournalBytes = 0;
 }
 
 // Drain deploymentEventAcks[] / deploymentEventConflicts[] from an upload
@@ -35,6 +35,13 @@
 // checksum, so an interrupted commit resolves to the complete previous record or
 // the complete new one — never a mixture.
 //
+// That full rewrite is now the COMPACTION step rather than every commit. An
+// ordinary commit appends one checksummed frame holding just the slots and
+// outbox events it changed to /deploy.jnl; load replays the frames that chain
+// onto the base's generation and drops a torn tail whole. Once the journal
+// reaches half a record, the next commit rewrites /deploy.bin as above and
+// removes the journal last. Either way a commit lands completely or not at all.
+//
 // Nothing here touches NVS; savePairedNodes() is deliberately left alone.
 
 // ---------------------------------------------------------------------------
@@ -208,9 +215,18 @@ const DeploymentSlot* deploymentFindByMac(const uint8_t* mac);
 // Create-or-fetch a mutable slot. Returns nullptr when the table is full.
 DeploymentSlot* deploymentSlotFor(const uint8_t* mac, const char* nodeId);
 
+// Bumped whenever the slot table may have changed: a mutable slot handed out, a
+// boundary pushed, a commit, a reload. Anything derived from a slot (the epoch
+// resolution cache in deployment_epoch.cpp) is valid only while this is
+// unchanged. Callers edit slots through the pointer above, so this is
+// deliberately conservative — it moves on access, not on proven change.
+uint32_t deploymentStoreRevision();
+
 // Commit the current in-RAM record to flash atomically. Every mutation helper
 // below leaves the record dirty; the caller commits once, so a whole lifecycle
-// transition lands in a single atomic write.
+// transition lands in a single atomic journal frame. Only entries that changed
+// since the last commit are written; a commit that changed nothing writes
+// nothing.
 bool deploymentStoreCommit();
 
 // ---------------------------------------------------------------------------
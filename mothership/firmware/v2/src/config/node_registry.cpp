@@ -2,12 +2,14 @@
 #include <Preferences.h>
 #include <WiFi.h>
 #include <esp_now.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include "time/rtc_alarm.h"  // getRTCTime()
 
 // Node registry + NVS persistence for Mothership V1 config mode.
 // Slim extract from production espnow_manager.cpp.
 
-std::vector<NodeInfo> registeredNodes;
+NodeRegistry registeredNodes;
 
 // Device ID used for mothership_id fields in wire messages.
 // Defined here so the config layer is self-contained.
@@ -54,20 +56,140 @@ static void ensurePeerOnChannel(const uint8_t mac[6], uint8_t channel) {
 }
 
 // -----------------------------------------------------------------------------
-// Node meta helpers (NVS namespace "node_meta")
+// Node meta / desired-config cache
 // -----------------------------------------------------------------------------
+//
+// getNodeUserId/Name/Notes and getDesiredConfig are called per CSV row, per
+// node of every status.nodes[] build and per row of the stations page; each
+// used to open "node_meta" or "node_dcfg" and read NVS. Both namespaces are
+// written only through the setters in this file, so the values are cached per
+// registry node on first use (loadPairedNodes() at boot, registerNode() for a
+// new one) and the setters write through: NVS first, then the cache, and a
+// failed write drops the cached copy so the next read goes back to NVS.
+//
+// Only registry members get an entry, and removeRegisteredNode() or a rename
+// frees it, so the table (sized like the registry) cannot fill up with IDs
+// that are gone. Any other ID — a CSV row for a removed node, a stray lookup —
+// reads NVS directly and takes no slot. Fixed table, open-addressed by the
+// same FNV-1a hash as the dcfg keys.
+//
+// Two tasks use the cache: in config mode the ESP-NOW receive callback
+// (registerNode, processDecodedSnapshot -> getCsvNodeId/Name) runs on the WiFi
+// task, while the web handlers call the getters, setters and
+// removeRegisteredNode() from loop(). An entry holds a String and a drop moves
+// entries and rebuilds the index, so every access goes through MetaCacheLock
+// and the getters hand back copies taken under it. It is a mutex rather than a
+// portMUX because a fill reads NVS and the String copies allocate.
+
+static constexpr size_t kMetaCacheEntries = NODE_REGISTRY_CAPACITY;
+static constexpr size_t kMetaCacheSlots   = 128;  // power of two > entries
+static_assert(kMetaCacheEntries < 0xFF && kMetaCacheSlots >= kMetaCacheEntries + kMetaCacheEntries / 4,
+              "meta cache index too small");
+
+struct NodeMetaEntry {
+  NodeText<33>      nodeId;
+  bool              metaLoaded;    // userId + name
+  bool              notesLoaded;
+  bool              dcfgLoaded;
+  NodeText<4>       userId;
+  NodeText<33>      name;
+  String            notes;         // usually empty, so usually no allocation
+  NodeDesiredConfig dcfg;
+};
+
+static NodeMetaEntry gMetaCache[kMetaCacheEntries];
+static uint8_t       gMetaCacheIndex[kMetaCacheSlots];
+static size_t        gMetaCacheCount = 0;
+static bool          gMetaCacheInit  = false;
+static uint32_t      gMetaNvsReads   = 0;
+
+static SemaphoreHandle_t metaCacheMutex() {
+  static SemaphoreHandle_t m = xSemaphoreCreateMutex();
+  return m;
+}
 
-static String loadNodeMeta(const String& nodeId, const char* fieldPrefix) {
-  Preferences prefs;
-  if (!prefs.begin("node_meta", true)) return "";
+struct MetaCacheLock {
+  MetaCacheLock()  { xSemaphoreTake(metaCacheMutex(), portMAX_DELAY); }
+  ~MetaCacheLock() { xSemaphoreGive(metaCacheMutex()); }
+  MetaCacheLock(const MetaCacheLock&) = delete;
+  MetaCacheLock& operator=(const MetaCacheLock&) = delete;
+};
+
+static uint32_t fnv1a32NodeId(const char* s) {
+  if (!s) return 0;
+  uint32_t h = 2166136261u;
+  while (*s) {
+    h ^= (uint8_t)(*s++);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// The cached entry for nodeId; with `create`, a new empty one if there is none.
+// Caller holds MetaCacheLock for as long as it uses the pointer.
+static NodeMetaEntry* metaCacheEntry(const char* nodeId, bool create) {
+  if (!nodeId || !nodeId[0] ||
+      strnlen(nodeId, sizeof(gMetaCache[0].nodeId.buf)) >= sizeof(gMetaCache[0].nodeId.buf)) {
+    return nullptr;
+  }
+  if (!gMetaCacheInit) {
+    memset(gMetaCacheIndex, 0xFF, sizeof(gMetaCacheIndex));
+    gMetaCacheInit = true;
+  }
+  for (size_t h = fnv1a32NodeId(nodeId), probe = 0; probe < kMetaCacheSlots; ++probe, ++h) {
+    uint8_t& slot = gMetaCacheIndex[h & (kMetaCacheSlots - 1)];
+    if (slot == 0xFF) {
+      if (!create || gMetaCacheCount >= kMetaCacheEntries) return nullptr;
+      slot = (uint8_t)gMetaCacheCount++;
+      NodeMetaEntry& e = gMetaCache[slot];
+      e = NodeMetaEntry{};
+      e.nodeId = nodeId;
+      return &e;
+    }
+    if (gMetaCache[slot].nodeId == nodeId) return &gMetaCache[slot];
+  }
+  return nullptr;
+}
+
+// Getters cache only for nodes in the registry.
+static NodeMetaEntry* metaCacheForRead(const char* nodeId) {
+  return metaCacheEntry(nodeId, registeredNodes.findById(nodeId) != nullptr);
+}
 
+// Free nodeId's entry: the last entry moves into its place and the index is
+// rebuilt (at most NODE_REGISTRY_CAPACITY entries, on removal only).
+static void metaCacheDrop(const char* nodeId) {
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheEntry(nodeId, false);
+  if (!e) return;
+  const size_t i = (size_t)(e - gMetaCache);
+  if (i + 1 < gMetaCacheCount) gMetaCache[i] = gMetaCache[gMetaCacheCount - 1];
+  gMetaCache[--gMetaCacheCount] = NodeMetaEntry{};  // releases the notes String
+  memset(gMetaCacheIndex, 0xFF, sizeof(gMetaCacheIndex));
+  for (size_t j = 0; j < gMetaCacheCount; ++j) {
+    for (size_t h = fnv1a32NodeId(gMetaCache[j].nodeId.c_str()); ; ++h) {
+      uint8_t& slot = gMetaCacheIndex[h & (kMetaCacheSlots - 1)];
+      if (slot == 0xFF) { slot = (uint8_t)j; break; }
+    }
+  }
+}
+
+uint32_t nodeMetaNvsReadCount() {
+  return gMetaNvsReads;
+}
+
+// -----------------------------------------------------------------------------
+// Node meta helpers (NVS namespace "node_meta")
+// -----------------------------------------------------------------------------
+
+// Read one node_meta field from an open handle.
+static String readNodeMetaField(Preferences& prefs, const char* nodeId, const char* fieldPrefix) {
   // NVS keys are limited to 15 characters. Build the key in a fixed buffer so
   // an unexpectedly long node ID cannot create an invalid Preferences access.
   char key[16];
-  int keyLen = snprintf(key, sizeof(key), "%s%s", fieldPrefix, nodeId.c_str());
+  int keyLen = snprintf(key, sizeof(key), "%s%s", fieldPrefix, nodeId);
   if (keyLen < 0 || keyLen >= (int)sizeof(key) || prefs.getType(key) != PT_STR) {
-    prefs.end();
-    return "";
+    return String();
   }
 
   // Avoid Preferences::getString(key, String), which allocates a variable-size
@@ -75,28 +197,58 @@ static String loadNodeMeta(const String& nodeId, const char* fieldPrefix) {
   // A malformed length can overflow the stack before application validation.
   char value[256] = {};
   size_t len = prefs.getString(key, value, sizeof(value));
-  prefs.end();
   return (len > 0) ? String(value) : String();
 }
 
-static void storeNodeMeta(const String& nodeId, const char* fieldPrefix, String value) {
+static String loadNodeMeta(const String& nodeId, const char* fieldPrefix) {
+  Preferences prefs;
+  ++gMetaNvsReads;
+  if (!prefs.begin("node_meta", true)) return "";
+  const String value = readNodeMetaField(prefs, nodeId.c_str(), fieldPrefix);
+  prefs.end();
+  return value;
+}
+
+// userId + name in one namespace open.
+static void fillMetaEntry(NodeMetaEntry& e) {
+  e.userId = "";
+  e.name = "";
+  Preferences prefs;
+  ++gMetaNvsReads;
+  if (prefs.begin("node_meta", true)) {
+    e.userId = readNodeMetaField(prefs, e.nodeId.c_str(), "id_");
+    e.name   = readNodeMetaField(prefs, e.nodeId.c_str(), "name_");
+    prefs.end();
+  }
+  e.metaLoaded = true;
+}
+
+// Returns false if NVS could not be opened; `value` is left trimmed, i.e. as
+// stored.
+static bool storeNodeMeta(const String& nodeId, const char* fieldPrefix, String& value) {
   Preferences prefs;
   if (!prefs.begin("node_meta", false)) {
     Serial.println("[REG] storeNodeMeta: NVS begin failed");
-    return;
+    return false;
   }
   String key = String(fieldPrefix) + nodeId;
   value.trim();
+  bool ok = true;
   if (value.length() == 0) {
     prefs.remove(key.c_str());
   } else {
-    prefs.putString(key.c_str(), value);
+    ok = prefs.putString(key.c_str(), value) == value.length();
   }
   prefs.end();
+  return ok;
 }
 
 String getNodeUserId(const String& nodeId) {
-  return loadNodeMeta(nodeId, "id_");
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheForRead(nodeId.c_str());
+  if (!e) return loadNodeMeta(nodeId, "id_");
+  if (!e->metaLoaded) fillMetaEntry(*e);
+  return e->userId;
 }
 
 String normalizeUserId(String userId) {
@@ -116,27 +268,54 @@ String normalizeUserId(String userId) {
 }
 
 void setNodeUserId(const String& nodeId, String userId) {
-  storeNodeMeta(nodeId, "id_", normalizeUserId(userId));
+  String value = normalizeUserId(userId);
+  const bool ok = storeNodeMeta(nodeId, "id_", value);
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheEntry(nodeId.c_str(), false);
+  if (!e || !e->metaLoaded) return;
+  if (ok) e->userId = value;
+  else    e->metaLoaded = false;
 }
 
 String getNodeName(const String& nodeId) {
-  return loadNodeMeta(nodeId, "name_");
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheForRead(nodeId.c_str());
+  if (!e) return loadNodeMeta(nodeId, "name_");
+  if (!e->metaLoaded) fillMetaEntry(*e);
+  return e->name;
 }
 
 void setNodeName(const String& nodeId, String name) {
   const size_t kMaxLen = 32;
   if (name.length() > kMaxLen) name = name.substring(0, kMaxLen);
-  storeNodeMeta(nodeId, "name_", name);
+  const bool ok = storeNodeMeta(nodeId, "name_", name);
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheEntry(nodeId.c_str(), false);
+  if (!e || !e->metaLoaded) return;
+  if (ok) e->name = name;
+  else    e->metaLoaded = false;
 }
 
 String getNodeNotes(const String& nodeId) {
-  return loadNodeMeta(nodeId, "note_");
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheForRead(nodeId.c_str());
+  if (!e) return loadNodeMeta(nodeId, "note_");
+  if (!e->notesLoaded) {
+    e->notes = loadNodeMeta(nodeId, "note_");
+    e->notesLoaded = true;
+  }
+  return e->notes;
 }
 
 void setNodeNotes(const String& nodeId, String notes) {
   const size_t kMaxLen = 180;
   if (notes.length() > kMaxLen) notes = notes.substring(0, kMaxLen);
-  storeNodeMeta(nodeId, "note_", notes);
+  const bool ok = storeNodeMeta(nodeId, "note_", notes);
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheEntry(nodeId.c_str(), false);
+  if (!e || !e->notesLoaded) return;
+  if (ok) e->notes = notes;
+  else    e->notesLoaded = false;
 }
 
 String getCsvNodeId(const String& nodeId) {
@@ -149,34 +328,20 @@ String getCsvNodeName(const String& nodeId) {
   return getNodeName(nodeId);
 }
 
-float getNodeLatitude(const String& nodeId) {
-  for (const auto& n : registeredNodes) {
-    if (n.nodeId == nodeId) return n.latitude;
-  }
-  return NAN;
+float getNodeLatitude(const char* nodeId) {
+  const NodeInfo* n = registeredNodes.findById(nodeId);
+  return n ? n->latitude : NAN;
 }
 
-float getNodeLongitude(const String& nodeId) {
-  for (const auto& n : registeredNodes) {
-    if (n.nodeId == nodeId) return n.longitude;
-  }
-  return NAN;
+float getNodeLongitude(const char* nodeId) {
+  const NodeInfo* n = registeredNodes.findById(nodeId);
+  return n ? n->longitude : NAN;
 }
 
 // -----------------------------------------------------------------------------
 // Desired config (NVS namespace "node_dcfg")
 // -----------------------------------------------------------------------------
 
-static uint32_t fnv1a32NodeId(const char* s) {
-  if (!s) return 0;
-  uint32_t h = 2166136261u;
-  while (*s) {
-    h ^= (uint8_t)(*s++);
-    h *= 16777619u;
-  }
-  return h;
-}
-
 static String desiredConfigKeyPrefix(const char* nodeId) {
   const uint32_t h = fnv1a32NodeId(nodeId);
   char b[10];
@@ -192,7 +357,31 @@ static inline uint16_t sanitizeConfiguredSensorMask(uint16_t mask) {
   return nodeCanonicalConfiguredMask(mask);
 }
 
-NodeDesiredConfig getDesiredConfig(const char* nodeId) {
+// Aggregation, report-by-exception and urgent-listen settings share one blob
+// key ("e") per node. As seven separate scalars they cost ~7 NVS entries each
+// node, which at 64 nodes is most of the 0x5000 partition; the blob is ~3.
+// Records written before the blob existed keep their scalar keys ("a"/"x",
+// "r"/"d", "u"/"f"/"o"); they are read as a fallback and removed on the next
+// setDesiredConfig().
+static constexpr uint8_t kDesiredModesVersion = 1;
+
+struct DesiredModesBlob {
+  uint8_t  version;
+  uint8_t  aggSamplesPerReport;
+  uint16_t aggStatsMask;
+  uint16_t rbeMaxSilenceMin;
+  uint8_t  rbeDeadbandTenths;
+  uint8_t  urgentFlags;
+  int16_t  urgentAirBelowCenti;
+  uint16_t urgentSoilAboveMv;
+};
+static_assert(sizeof(DesiredModesBlob) == 12, "DesiredModesBlob layout is stored in NVS");
+
+static const char* const kLegacyModeKeys[] = {"a", "x", "r", "d", "u", "f", "o"};
+
+// Straight from NVS, bypassing the cache. setDesiredConfig() verifies its
+// writes through this, so the read-back proves what is durable.
+static NodeDesiredConfig readDesiredConfigNvs(const char* nodeId) {
   Preferences prefs;
   NodeDesiredConfig cfg{};
   // Seed the "no stored value" defaults up front so they also apply on the
@@ -206,6 +395,7 @@ NodeDesiredConfig getDesiredConfig(const char* nodeId) {
   cfg.syncIntervalMin = 15;
   cfg.targetState     = 2;
   const String key = desiredConfigKeyPrefix(nodeId);
+  ++gMetaNvsReads;
   if (!prefs.begin("node_dcfg", true)) return cfg;
   cfg.configVersion   = prefs.getUShort((key + "v").c_str(), 0);
   cfg.wakeIntervalMin = prefs.getUChar((key + "w").c_str(), 0);
@@ -214,6 +404,28 @@ NodeDesiredConfig getDesiredConfig(const char* nodeId) {
   // Default DEPLOYED (2) so pre-existing nodes keep running (no accidental unpair).
   cfg.targetState     = prefs.getUChar((key + "t").c_str(), 2);
   cfg.sensorMask      = prefs.getUShort((key + "m").c_str(), 0);  // 0 = auto
+  const String modesKey = key + "e";
+  DesiredModesBlob modes{};
+  if (prefs.getBytesLength(modesKey.c_str()) == sizeof(modes) &&
+      prefs.getBytes(modesKey.c_str(), &modes, sizeof(modes)) == sizeof(modes) &&
+      modes.version == kDesiredModesVersion) {
+    cfg.aggSamplesPerReport = modes.aggSamplesPerReport;
+    cfg.aggStatsMask        = modes.aggStatsMask;
+    cfg.rbeMaxSilenceMin    = modes.rbeMaxSilenceMin;
+    cfg.rbeDeadbandTenths   = modes.rbeDeadbandTenths;
+    cfg.urgentFlags         = modes.urgentFlags;
+    cfg.urgentAirBelowCenti = modes.urgentAirBelowCenti;
+    cfg.urgentSoilAboveMv   = modes.urgentSoilAboveMv;
+  } else {
+    // Legacy scalar keys; absent keys mean the mode is off.
+    cfg.aggSamplesPerReport = prefs.getUChar((key + "a").c_str(), 0);
+    cfg.aggStatsMask        = prefs.getUShort((key + "x").c_str(), 0);
+    cfg.rbeMaxSilenceMin    = prefs.getUShort((key + "r").c_str(), 0);
+    cfg.rbeDeadbandTenths   = prefs.getUChar((key + "d").c_str(), 0);
+    cfg.urgentFlags         = prefs.getUChar((key + "u").c_str(), 0);
+    cfg.urgentAirBelowCenti = prefs.getShort((key + "f").c_str(), 0);
+    cfg.urgentSoilAboveMv   = prefs.getUShort((key + "o").c_str(), 0);
+  }
   prefs.end();
   // Strip the decommissioned ultrasonic-wind selector on the way out, keeping
   // wind itself configured. This is the single chokepoint every consumer reads
@@ -225,6 +437,17 @@ NodeDesiredConfig getDesiredConfig(const char* nodeId) {
   return cfg;
 }
 
+NodeDesiredConfig getDesiredConfig(const char* nodeId) {
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheForRead(nodeId);
+  if (!e) return readDesiredConfigNvs(nodeId);
+  if (!e->dcfgLoaded) {
+    e->dcfg = readDesiredConfigNvs(nodeId);
+    e->dcfgLoaded = true;
+  }
+  return e->dcfg;
+}
+
 void updateStaleNodeStatus(uint32_t nowMs) {
   for (auto& n : registeredNodes) {
     if (!(n.state == PAIRED || n.state == DEPLOYED)) continue;
@@ -268,6 +491,7 @@ void updateStaleNodeStatus(uint32_t nowMs) {
 static bool legacyUltrasonicMaskPending(const char* nodeId) {
   if (!nodeId || !nodeId[0]) return false;
   Preferences prefs;
+  ++gMetaNvsReads;
   if (!prefs.begin("node_dcfg", true)) return false;
   const uint16_t stored =
       prefs.getUShort((desiredConfigKeyPrefix(nodeId) + "m").c_str(), 0);
@@ -290,6 +514,9 @@ static void retireLegacyUltrasonicMask(const char* nodeId) {
                   ok ? "(wind history cleared)" : "— RETIRE FAILED, will retry next boot");
   }
   prefs.end();
+  // The cached copy is already sanitised, but re-read so it matches NVS exactly.
+  MetaCacheLock lock;
+  if (NodeMetaEntry* e = metaCacheEntry(nodeId, false)) e->dcfgLoaded = false;
 }
 
 void noteNodeContact(NodeInfo& node) {
@@ -315,26 +542,23 @@ void noteNodeContact(NodeInfo& node) {
 void setNodeExpectedSensorMask(const char* nodeId, uint16_t capabilityBits) {
   if (!nodeId) return;
   const uint16_t normalized = nodeNormalizeSensorMask(capabilityBits);
-  for (auto& n : registeredNodes) {
-    if (strncmp(n.nodeId.c_str(), nodeId, 16) == 0) {
-      // Forget accumulated evidence for every channel whose configured state
-      // changed. Without this, disabling a sensor mid-debounce and re-enabling it
-      // left sensorMissPrev holding that channel, so its very next absence
-      // latched a fault immediately — one miss, not the two the rule promises.
-      const uint16_t changed = (uint16_t)(n.expectedSensorMask ^ normalized);
-      if (changed) {
-        n.sensorMissPrev    &= (uint16_t)~changed;
-        n.sensorFaultMask   &= (uint16_t)~changed;
-        n.lastSensorPresent &= (uint16_t)~changed;
-      }
-      n.expectedSensorMask = normalized;
-      return;
-    }
+  NodeInfo* n = registeredNodes.findById(nodeId);
+  if (!n) return;
+  // Forget accumulated evidence for every channel whose configured state
+  // changed. Without this, disabling a sensor mid-debounce and re-enabling it
+  // left sensorMissPrev holding that channel, so its very next absence
+  // latched a fault immediately — one miss, not the two the rule promises.
+  const uint16_t changed = (uint16_t)(n->expectedSensorMask ^ normalized);
+  if (changed) {
+    n->sensorMissPrev    &= (uint16_t)~changed;
+    n->sensorFaultMask   &= (uint16_t)~changed;
+    n->lastSensorPresent &= (uint16_t)~changed;
   }
+  n->expectedSensorMask = normalized;
 }
 
 void setNodeFirmwareCaps(const fw_caps_message_t& caps) {
-  // Null-terminate the fixed wire buffers before copying into Strings.
+  // Null-terminate the fixed wire buffers before copying into the record.
   char nid[sizeof(caps.nodeId) + 1];      memcpy(nid, caps.nodeId, sizeof(caps.nodeId));       nid[sizeof(caps.nodeId)] = '\0';
   char ver[sizeof(caps.fwVersion) + 1];   memcpy(ver, caps.fwVersion, sizeof(caps.fwVersion)); ver[sizeof(caps.fwVersion)] = '\0';
   char bld[sizeof(caps.buildId) + 1];     memcpy(bld, caps.buildId, sizeof(caps.buildId));     bld[sizeof(caps.buildId)] = '\0';
@@ -345,24 +569,21 @@ void setNodeFirmwareCaps(const fw_caps_message_t& caps) {
   char over[sizeof(caps.otherVersion) + 1]; memcpy(over, caps.otherVersion, sizeof(caps.otherVersion)); over[sizeof(caps.otherVersion)] = '\0';
   const bool slotInfo = rslot[0] != '\0';
 
-  for (auto& n : registeredNodes) {
-    if (strncmp(n.nodeId.c_str(), nid, 16) == 0) {
-      n.fwVersion          = ver;
-      n.fwBuildId          = bld;
-      n.hwRevision         = hw;
-      n.otaProtocolVersion = (uint8_t)caps.protocolVersion;
-      n.otaMaxImageSize    = caps.maxImageSize;
-      n.rollbackCapable    = caps.rollbackCapable != 0;
-      n.hasFirmwareCaps    = true;
-      if (slotInfo) {
-        n.otaRunningSlot   = rslot;
-        n.otaRunningState  = caps.runningOtaState;
-        n.otaOtherState    = caps.otherSlotState;
-        n.otaOtherVersion  = over;
-        n.hasSlotInfo      = true;
-      }
-      return;
-    }
+  NodeInfo* n = registeredNodes.findById(nid);
+  if (!n) return;
+  n->fwVersion          = ver;
+  n->fwBuildId          = bld;
+  n->hwRevision         = hw;
+  n->otaProtocolVersion = (uint8_t)caps.protocolVersion;
+  n->otaMaxImageSize    = caps.maxImageSize;
+  n->rollbackCapable    = caps.rollbackCapable != 0;
+  n->hasFirmwareCaps    = true;
+  if (slotInfo) {
+    n->otaRunningSlot   = rslot;
+    n->otaRunningState  = caps.runningOtaState;
+    n->otaOtherState    = caps.otherSlotState;
+    n->otaOtherVersion  = over;
+    n->hasSlotInfo      = true;
   }
 }
 
@@ -385,23 +606,56 @@ bool setDesiredConfig(const char* nodeId, const NodeDesiredConfig& cfg) {
   ok = prefs.putULong((key + "p").c_str(), cfg.syncPhaseUnix) == sizeof(uint32_t) && ok;
   ok = prefs.putUChar((key + "t").c_str(), cfg.targetState) == sizeof(uint8_t) && ok;
   ok = prefs.putUShort((key + "m").c_str(), storedSensorMask) == sizeof(uint16_t) && ok;
+  DesiredModesBlob modes{};
+  modes.version             = kDesiredModesVersion;
+  modes.aggSamplesPerReport = cfg.aggSamplesPerReport;
+  modes.aggStatsMask        = cfg.aggStatsMask;
+  modes.rbeMaxSilenceMin    = cfg.rbeMaxSilenceMin;
+  modes.rbeDeadbandTenths   = cfg.rbeDeadbandTenths;
+  modes.urgentFlags         = cfg.urgentFlags;
+  modes.urgentAirBelowCenti = cfg.urgentAirBelowCenti;
+  modes.urgentSoilAboveMv   = cfg.urgentSoilAboveMv;
+  const bool modesOk =
+      prefs.putBytes((key + "e").c_str(), &modes, sizeof(modes)) == sizeof(modes);
+  ok = modesOk && ok;
+  // The blob now wins over the legacy scalars; drop them to free their entries.
+  if (modesOk) {
+    for (const char* suffix : kLegacyModeKeys) {
+      const String legacy = key + suffix;
+      if (prefs.isKey(legacy.c_str())) prefs.remove(legacy.c_str());
+    }
+  }
   prefs.end();
 
+  MetaCacheLock lock;
+  NodeMetaEntry* e = metaCacheEntry(nodeId, false);
+  if (e) e->dcfgLoaded = false;
   if (!ok) return false;
-  const NodeDesiredConfig verify = getDesiredConfig(nodeId);
+  const NodeDesiredConfig verify = readDesiredConfigNvs(nodeId);
+  if (e) {
+    e->dcfg = verify;
+    e->dcfgLoaded = true;
+  }
   return verify.configVersion == cfg.configVersion &&
          verify.wakeIntervalMin == cfg.wakeIntervalMin &&
          verify.syncIntervalMin == cfg.syncIntervalMin &&
          verify.syncPhaseUnix == cfg.syncPhaseUnix &&
          verify.targetState == cfg.targetState &&
-         verify.sensorMask == storedSensorMask;
+         verify.sensorMask == storedSensorMask &&
+         verify.aggSamplesPerReport == cfg.aggSamplesPerReport &&
+         verify.aggStatsMask == cfg.aggStatsMask &&
+         verify.rbeMaxSilenceMin == cfg.rbeMaxSilenceMin &&
+         verify.rbeDeadbandTenths == cfg.rbeDeadbandTenths &&
+         verify.urgentFlags == cfg.urgentFlags &&
+         verify.urgentAirBelowCenti == cfg.urgentAirBelowCenti &&
+         verify.urgentSoilAboveMv == cfg.urgentSoilAboveMv;
 }
 
 // -----------------------------------------------------------------------------
 // Registry queries
 // -----------------------------------------------------------------------------
 
-std::vector<NodeInfo> getRegisteredNodes() {
+const NodeRegistry& getRegisteredNodes() {
   return registeredNodes;
 }
 
@@ -422,9 +676,8 @@ std::vector<NodeInfo> getPairedNodes() {
 }
 
 NodeState getNodeState(const char* nodeId) {
-  for (const auto& node : registeredNodes)
-    if (node.nodeId == String(nodeId)) return node.state;
-  return UNPAIRED;
+  const NodeInfo* node = registeredNodes.findById(nodeId);
+  return node ? node->state : UNPAIRED;
 }
 
 String getMothershipsMAC() {
@@ -435,29 +688,41 @@ String getMothershipsMAC() {
 // Registry mutation
 // -----------------------------------------------------------------------------
 
+// Make room for a new node in a full registry by dropping the UNPAIRED entry
+// heard from longest ago. UNPAIRED records are discovery-list only (never
+// persisted), so the evicted node simply reappears if it is heard again.
+// Paired and deployed nodes are never evicted.
+static bool evictOldestUnpaired() {
+  const uint32_t now = millis();
+  NodeInfo* oldest = nullptr;
+  uint32_t oldestAge = 0;
+  for (NodeInfo& n : registeredNodes) {
+    if (n.state != UNPAIRED) continue;
+    const uint32_t age = n.lastSeen ? now - n.lastSeen : UINT32_MAX;
+    if (!oldest || age > oldestAge) { oldest = &n; oldestAge = age; }
+  }
+  if (!oldest) return false;
+  Serial.printf("[REG] Registry full — evicting UNPAIRED %s (%s)\n",
+                oldest->nodeId.c_str(), macToStr(oldest->mac).c_str());
+  removeRegisteredNode(*oldest);
+  return true;
+}
+
 void registerNode(const uint8_t* mac,
                    const char* nodeId,
                    const char* nodeType,
                    NodeState state)
 {
-  NodeInfo* existing = nullptr;
-  for (auto& node : registeredNodes) {
-    if (memcmp(node.mac, mac, 6) == 0) {
-      existing = &node;
-      break;
-    }
-  }
+  NodeInfo* existing = registeredNodes.findByMac(mac);
 
   if (existing) {
-    if (memcmp(existing->mac, mac, 6) != 0) {
-      memcpy(existing->mac, mac, 6);
-      ensurePeerOnChannel(existing->mac, ESPNOW_CHANNEL);
-    }
     noteNodeContact(*existing);
-    if (nodeId && nodeId[0] != '\0' && existing->nodeId != String(nodeId)) {
-      existing->nodeId = String(nodeId);
+    if (nodeId && nodeId[0] != '\0' && existing->nodeId != nodeId) {
+      metaCacheDrop(existing->nodeId.c_str());
+      existing->nodeId = nodeId;
+      registeredNodes.reindex();
     }
-    existing->nodeType = String(nodeType);
+    existing->nodeType = nodeType;
     if (state > existing->state) {
       if (state == DEPLOYED && existing->state != DEPLOYED) {
         existing->deployedSinceUnix = getRTCTime();
@@ -475,10 +740,16 @@ void registerNode(const uint8_t* mac,
     return;
   }
 
+  if (registeredNodes.full() && !evictOldestUnpaired()) {
+    Serial.printf("[REG] Registry full (%u, all paired) — ignoring new node %s (%s)\n",
+                  (unsigned)NodeRegistry::kCapacity, nodeId, macToStr(mac).c_str());
+    return;
+  }
+
   NodeInfo n{};
   memcpy(n.mac, mac, 6);
-  n.nodeId   = String(nodeId);
-  n.nodeType = String(nodeType);
+  n.nodeId   = nodeId;
+  n.nodeType = nodeType;
   n.lastSeen = millis();
   n.isActive = true;
   n.state    = state;
@@ -508,18 +779,25 @@ void registerNode(const uint8_t* mac,
   n.deploymentStartedUnix = 0;
   n.deploymentEndedUnix   = 0;
   n.deploymentPendingOp   = 0;
+  n.hasClockSkew          = false;
   n.syncStale = false;
   n.staleMissCount = 0;
   n.lastStaleAssistMs = 0;
   n.lastRescueMode = false;
-  n.userId = getNodeUserId(n.nodeId);
-  n.name   = getNodeName(n.nodeId);
 
   // Stamps the absolute contact time too — receiving a packet from a node we had
   // never registered is still genuine contact.
   noteNodeContact(n);
 
-  registeredNodes.push_back(n);
+  if (!registeredNodes.push_back(n)) {
+    Serial.printf("[REG] Registry full — new node %s (%s) not registered\n",
+                  nodeId, macToStr(mac).c_str());
+    return;
+  }
+  // Read once it is a member, so the values land in the meta cache.
+  NodeInfo& added = registeredNodes.back();
+  added.userId = getNodeUserId(added.nodeId);
+  added.name   = getNodeName(added.nodeId);
   ensurePeerOnChannel(mac, ESPNOW_CHANNEL);
   Serial.printf("[REG] New node: %s (%s) state=%s\n",
                 nodeId, macToStr(mac).c_str(), stateToStr(state));
@@ -529,18 +807,21 @@ void registerNode(const uint8_t* mac,
   }
 }
 
+void removeRegisteredNode(NodeInfo& node) {
+  esp_now_del_peer(node.mac);
+  metaCacheDrop(node.nodeId.c_str());
+  registeredNodes.erase(&node);
+}
+
 bool unpairNode(const String& nodeId) {
-  for (auto& n : registeredNodes) {
-    if (n.nodeId == nodeId) {
-      esp_now_del_peer(n.mac);
-      n.state    = UNPAIRED;
-      n.isActive = true;
-      savePairedNodes();
-      Serial.printf("[REG] Unpaired node: %s\n", nodeId.c_str());
-      return true;
-    }
-  }
-  return false;
+  NodeInfo* n = registeredNodes.findById(nodeId.c_str());
+  if (!n) return false;
+  esp_now_del_peer(n->mac);
+  n->state    = UNPAIRED;
+  n->isActive = true;
+  savePairedNodes();
+  Serial.printf("[REG] Unpaired node: %s\n", nodeId.c_str());
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -583,10 +864,10 @@ void savePairedNodes() {
     writeOk = prefs.putString(key, macs) > 0 && writeOk;
 
     snprintf(key, sizeof(key), "id%d", idx);
-    writeOk = prefs.putString(key, n.nodeId) > 0 && writeOk;
+    writeOk = prefs.putString(key, n.nodeId.c_str()) > 0 && writeOk;
 
     snprintf(key, sizeof(key), "typ%d", idx);
-    writeOk = prefs.putString(key, n.nodeType) > 0 && writeOk;
+    writeOk = prefs.putString(key, n.nodeType.c_str()) > 0 && writeOk;
 
     snprintf(key, sizeof(key), "st%d", idx);
     writeOk = prefs.putUChar(key, (uint8_t)n.state) == sizeof(uint8_t) && writeOk;
@@ -948,12 +1229,18 @@ void loadPairedNodes() {
   // Preferences handles interacting and causing a crash.
   prefs.end();
 
-  // Now populate userId/name and add to the live registry.
+  // Now add to the live registry and populate userId/name (members first, so
+  // the reads fill the meta cache).
   // NOTE: Do NOT call ensurePeerOnChannel() here — ESP-NOW is not yet
   // initialized (initEspNowConfig is called later in handleConfigWake).
   // Calling esp_now_add_peer() before esp_now_init() causes a crash.
   // Peers will be added when ESP-NOW is initialized or when nodes send data.
-  for (auto& newNode : validatedNodes) {
+  for (const auto& validated : validatedNodes) {
+    if (!registeredNodes.push_back(validated)) {
+      Serial.printf("[REG] Registry full — %s not restored\n", validated.nodeId.c_str());
+      continue;
+    }
+    NodeInfo& newNode = registeredNodes.back();
     newNode.userId = getNodeUserId(newNode.nodeId);
     newNode.name   = getNodeName(newNode.nodeId);
     // Reconstruct pending state from durable desired-vs-applied truth rather
@@ -989,7 +1276,6 @@ void loadPairedNodes() {
           ? PENDING_TO_UNPAIRED : PENDING_TO_DEPLOYED;
       newNode.pendingSinceMs = millis();
     }
-    registeredNodes.push_back(newNode);
   }
 
   // Complete the retired-ultrasonic migration, in the only safe order: persist
@@ -1156,6 +1442,21 @@ String buildNodesStatusJson(uint32_t nowUnix) {
     out += ",\"deploymentEpoch\":";        out += String((unsigned)n.deploymentEpoch);
     out += ",\"deploymentStartedUnix\":";  out += String(n.deploymentStartedUnix);
     out += ",\"deploymentEndedUnix\":";    out += String(n.deploymentEndedUnix);
+    // Two-way clock exchange: what the node measured against the hub at its
+    // last sync and the drift it has settled on. null until it reports.
+    if (n.hasClockSkew) {
+      out += ",\"clock\":{\"syncUnix\":"; out += String(n.clockSyncUnix);
+      out += ",\"offsetMs\":";    out += String((long)n.clockOffsetMs);
+      out += ",\"rttMs\":";       out += String((unsigned)n.clockRttMs);
+      out += ",\"residualMs\":";  out += String((unsigned)n.clockResidualMs);
+      out += ",\"driftPpm\":";
+      if (n.clockDriftValid) { dtostrf(n.clockDriftCentiPpm / 100.0f, 1, 2, nb); out += nb; }
+      else { out += "null"; }
+      out += ",\"aging\":";       out += String((int)n.clockAging);
+      out += "}";
+    } else {
+      out += ",\"clock\":null";
+    }
     out += ",\"recordingPaused\":";   out += n.recordingPaused ? "true" : "false";
     // Configured-sensor state: which sensors the operator marked installed, what
     // reported this cycle, and which configured sensors are faulted (missing).
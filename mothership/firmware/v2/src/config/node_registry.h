@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include <string.h>
 #include <vector>
 #include "protocol.h"  // ESPNOW_CHANNEL
 
@@ -26,10 +27,54 @@ enum NodePendingState : uint8_t {
   PENDING_TO_DEPLOYED = 3,
 };
 
+// Fixed-capacity text field for NodeInfo. Keeps every record a flat, heap-free
+// value (nine Strings per node used to mean nine small allocations per record,
+// reshuffled on every vector copy) while offering the slice of the String API
+// the call sites use. Input longer than N-1 bytes is truncated. Deliberately
+// no implicit const char* conversion, so `a.nodeId == b` can never silently
+// compare pointers; the String conversion is for cold JSON/UI paths only.
+template <size_t N>
+struct NodeText {
+  char buf[N];
+
+  NodeText() { buf[0] = '\0'; buf[N - 1] = '\0'; }
+  NodeText(const char* s) { assign(s); }
+  NodeText(const String& s) { assign(s.c_str()); }
+  NodeText& operator=(const char* s) { assign(s); return *this; }
+  NodeText& operator=(const String& s) { assign(s.c_str()); return *this; }
+
+  // buf[N-1] stays NUL throughout, so a reader racing a rewrite (the config-
+  // mode ESP-NOW callback registers nodes while the web server reads) can see
+  // mixed text but never run off the end of the field.
+  void assign(const char* s) {
+    if (!s) s = "";
+    const size_t n = strnlen(s, N - 1);
+    buf[N - 1] = '\0';
+    memcpy(buf, s, n);
+    buf[n] = '\0';
+  }
+  const char* c_str() const { return buf; }
+  size_t length() const { return strlen(buf); }
+  bool isEmpty() const { return buf[0] == '\0'; }
+  char operator[](size_t i) const { return buf[i]; }
+  operator String() const { return String(buf); }
+};
+
+template <size_t N> inline bool operator==(const NodeText<N>& a, const char* b) { return strcmp(a.buf, b ? b : "") == 0; }
+template <size_t N> inline bool operator==(const char* a, const NodeText<N>& b) { return b == a; }
+template <size_t N> inline bool operator==(const NodeText<N>& a, const String& b) { return strcmp(a.buf, b.c_str()) == 0; }
+template <size_t N> inline bool operator==(const String& a, const NodeText<N>& b) { return b == a; }
+template <size_t N, size_t M> inline bool operator==(const NodeText<N>& a, const NodeText<M>& b) { return strcmp(a.buf, b.buf) == 0; }
+template <size_t N> inline bool operator!=(const NodeText<N>& a, const char* b) { return !(a == b); }
+template <size_t N> inline bool operator!=(const char* a, const NodeText<N>& b) { return !(b == a); }
+template <size_t N> inline bool operator!=(const NodeText<N>& a, const String& b) { return !(a == b); }
+template <size_t N> inline bool operator!=(const String& a, const NodeText<N>& b) { return !(b == a); }
+template <size_t N, size_t M> inline bool operator!=(const NodeText<N>& a, const NodeText<M>& b) { return !(a == b); }
+
 struct NodeInfo {
   uint8_t   mac[6];
-  String    nodeId;
-  String    nodeType;
+  NodeText<33> nodeId;      // up to 32 chars (the NVS loader's limit); 15 on the wire
+  NodeText<33> nodeType;
   uint32_t  lastSeen;       // millis() of last contact THIS session; 0 = not yet
                             // heard from since boot. Only meaningful within a
                             // session — the FieldHub powers off between wakes.
@@ -40,8 +85,8 @@ struct NodeInfo {
   bool      isActive;
   NodeState state;
   uint8_t   channel;
-  String    userId;
-  String    name;
+  NodeText<4>  userId;      // normalizeUserId(): 3 digits
+  NodeText<33> name;        // setNodeName() caps at 32
 
   uint32_t  lastTimeSyncMs;
   uint8_t   wakeIntervalMin;
@@ -90,20 +135,31 @@ struct NodeInfo {
                                   // node (RAM only, mirrors syncStale's lifecycle)
   // Firmware / OTA capability reported by the node via FW_CAPS (RAM only; empty
   // strings / 0 = not yet reported). Refreshed each sync window a node is heard.
-  String    fwVersion;          // node firmware semver, e.g. "0.1.0"
-  String    fwBuildId;          // node git build id
-  String    hwRevision;         // node hardware target, e.g. "node-v3"
+  NodeText<sizeof(fw_caps_message_t::fwVersion) + 1> fwVersion;   // node firmware semver, e.g. "0.1.0"
+  NodeText<sizeof(fw_caps_message_t::buildId) + 1>   fwBuildId;   // node git build id
+  NodeText<sizeof(fw_caps_message_t::hwTarget) + 1>  hwRevision;  // node hardware target, e.g. "node-v3"
   uint8_t   otaProtocolVersion; // 0 = unknown
   uint32_t  otaMaxImageSize;    // inactive-slot capacity (bytes); 0 = unknown
   bool      rollbackCapable;
   bool      hasFirmwareCaps;    // true once a FW_CAPS has been received
   // OTA A/B slot state from FW_CAPS v2 (empty otaRunningSlot = not reported by
   // this node's firmware, e.g. an older v1 FW_CAPS).
-  String    otaRunningSlot;     // "app0" / "app1"
+  NodeText<sizeof(fw_caps_message_t::runningSlot) + 1> otaRunningSlot;  // "app0" / "app1"
   uint8_t   otaRunningState;    // FwOtaState of the running slot
   uint8_t   otaOtherState;      // FwOtaState of the inactive slot
-  String    otaOtherVersion;    // inactive slot's app-desc version
+  NodeText<sizeof(fw_caps_message_t::otherVersion) + 1> otaOtherVersion;  // inactive slot's app-desc version
   bool      hasSlotInfo;        // true once a FW_CAPS v2 (slot fields) arrived
+  // Clock-exchange mirror. The authority is the skew history
+  // (time/node_clock_skew.h, /clock.bin); refreshed by
+  // nodeClockSkewSyncRegistryMirror() and on each CLOCK_PROBE report. RAM only.
+  bool      hasClockSkew;       // false until the node has reported once
+  uint32_t  clockSyncUnix;      // hub time of the last report
+  int32_t   clockOffsetMs;      // hub minus node, measured before the node stepped
+  uint16_t  clockRttMs;
+  uint16_t  clockResidualMs;    // uncertainty the node was left with
+  bool      clockDriftValid;
+  int16_t   clockDriftCentiPpm; // +ve = node fast
+  int8_t    clockAging;         // node DS3231 aging register
 };
 
 struct NodeDesiredConfig {
@@ -114,6 +170,13 @@ struct NodeDesiredConfig {
   uint8_t  targetState;     // 0=UNPAIRED, 2=DEPLOYED/ACTIVE, 3=STANDBY
   uint16_t sensorMask;      // configured sensors: SNAP_PRESENT_* bits + NODE_SENSOR_MASK_VALID
                             // (0 = unset/auto; the node then auto-detects everything)
+  uint8_t  aggSamplesPerReport;  // aggregation mode: wakes per summary (0 = off)
+  uint16_t aggStatsMask;         // SNAP_PRESENT_* groups with min/max/SD (0 = all)
+  uint16_t rbeMaxSilenceMin;     // report-by-exception heartbeat, minutes (0 = off)
+  uint8_t  rbeDeadbandTenths;    // deadband scale in tenths (0 = built-in x1.0)
+  uint8_t  urgentFlags;          // urgent_listen::kFrost | kFlood (0 = off)
+  int16_t  urgentAirBelowCenti;  // frost line, 0.01 °C
+  uint16_t urgentSoilAboveMv;    // flood line on soil 1, mV
 };
 
 // Update a registered node's cached expected-sensor mask (RAM only) so snapshot
@@ -142,9 +205,169 @@ void setNodeFirmwareCaps(const fw_caps_message_t& caps);
 // Registry queries
 // -----------------------------------------------------------------------------
 
-extern std::vector<NodeInfo> registeredNodes;
+// Registry capacity: kMaxPairedNodes persisted records plus headroom for
+// UNPAIRED nodes heard during discovery. When the table is full, registerNode()
+// evicts the least recently heard UNPAIRED entry; with every slot paired a new
+// node is logged and ignored.
+#ifndef NODE_REGISTRY_CAPACITY
+#define NODE_REGISTRY_CAPACITY 96
+#endif
+
+// The live node table: a fixed array of NodeInfo records (statically sized, so
+// a full fleet never fragments the heap). The cost is fixed .bss whether or not
+// the slots are used: about 30 KiB at the default 96 records (320 bytes per
+// NodeInfo plus two 256-byte indexes). Lower NODE_REGISTRY_CAPACITY on builds
+// that need the RAM. Open-addressed hash indexes by MAC and by nodeId make
+// the per-frame lookups on the snapshot / HELLO / status / FW_CAPS paths O(1)
+// instead of a scan with String compares.
+//
+// Keeps the std::vector surface the call sites already use (range-for, size(),
+// operator[], back(), push_back(), erase(), clear()); records are handed out by
+// reference and stay put until an erase() shifts the ones after it. Non-copyable
+// on purpose: the old by-value getRegisteredNodes() copied the whole fleet.
+//
+// Editing nodeId or mac in place through a reference is allowed (tests and
+// registerNode's rename do it). A probe that misses falls back to a scan and
+// rebuilds the indexes if that finds the node, so a stale index can cost one
+// scan but never a wrong answer; call reindex() after such an edit to keep the
+// next lookup on the fast path.
+class NodeRegistry {
+ public:
+  static constexpr size_t kCapacity = NODE_REGISTRY_CAPACITY;
+
+  NodeRegistry() { clear(); }
+  NodeRegistry(const NodeRegistry&) = delete;
+  NodeRegistry& operator=(const NodeRegistry&) = delete;
+
+  NodeInfo* begin() { return nodes_; }
+  NodeInfo* end() { return nodes_ + count_; }
+  const NodeInfo* begin() const { return nodes_; }
+  const NodeInfo* end() const { return nodes_ + count_; }
+  size_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  bool full() const { return count_ >= kCapacity; }
+  NodeInfo& operator[](size_t i) { return nodes_[i]; }
+  const NodeInfo& operator[](size_t i) const { return nodes_[i]; }
+  NodeInfo& back() { return nodes_[count_ - 1]; }
+  const NodeInfo& back() const { return nodes_[count_ - 1]; }
+  // Slot of a record handed out by this registry (valid until the next erase).
+  size_t indexOf(const NodeInfo& n) const { return (size_t)(&n - nodes_); }
+
+  // False (record dropped) when the table is full.
+  bool push_back(const NodeInfo& n) {
+    if (full()) return false;
+    nodes_[count_] = n;
+    indexInsert(count_);
+    ++count_;
+    return true;
+  }
+
+  NodeInfo* erase(NodeInfo* it) {
+    const size_t i = (size_t)(it - nodes_);
+    if (i >= count_) return end();
+    for (size_t j = i + 1; j < count_; ++j) nodes_[j - 1] = nodes_[j];
+    --count_;
+    reindex();
+    return nodes_ + i;
+  }
+
+  void clear() {
+    count_ = 0;
+    memset(macIndex_, kEmpty, sizeof(macIndex_));
+    memset(idIndex_, kEmpty, sizeof(idIndex_));
+  }
 
-std::vector<NodeInfo> getRegisteredNodes();
+  void reindex() {
+    memset(macIndex_, kEmpty, sizeof(macIndex_));
+    memset(idIndex_, kEmpty, sizeof(idIndex_));
+    for (size_t i = 0; i < count_; ++i) indexInsert(i);
+  }
+
+  NodeInfo* findByMac(const uint8_t* mac) {
+    if (!mac) return nullptr;
+    for (size_t h = hashMac(mac), probe = 0; probe < kIndexSlots; ++probe, ++h) {
+      const uint8_t slot = macIndex_[h & (kIndexSlots - 1)];
+      if (slot == kEmpty) break;
+      if (slot < count_ && memcmp(nodes_[slot].mac, mac, 6) == 0) return &nodes_[slot];
+    }
+    for (size_t i = 0; i < count_; ++i) {
+      if (memcmp(nodes_[i].mac, mac, 6) == 0) { reindex(); return &nodes_[i]; }
+    }
+    return nullptr;
+  }
+
+  NodeInfo* findById(const char* nodeId) {
+    if (!nodeId || !nodeId[0]) return nullptr;
+    for (size_t h = hashId(nodeId), probe = 0; probe < kIndexSlots; ++probe, ++h) {
+      const uint8_t slot = idIndex_[h & (kIndexSlots - 1)];
+      if (slot == kEmpty) break;
+      if (slot < count_ && nodes_[slot].nodeId == nodeId) return &nodes_[slot];
+    }
+    for (size_t i = 0; i < count_; ++i) {
+      if (nodes_[i].nodeId == nodeId) { reindex(); return &nodes_[i]; }
+    }
+    return nullptr;
+  }
+
+  // The record matching either key, earliest first — the old
+  // `memcmp(n.mac, mac, 6) == 0 || n.nodeId == nodeId` scan, in O(1).
+  NodeInfo* findByMacOrId(const uint8_t* mac, const char* nodeId) {
+    NodeInfo* byMac = findByMac(mac);
+    NodeInfo* byId = findById(nodeId);
+    if (!byMac) return byId;
+    if (!byId) return byMac;
+    return byId < byMac ? byId : byMac;
+  }
+
+  const NodeInfo* findByMac(const uint8_t* mac) const {
+    return const_cast<NodeRegistry*>(this)->findByMac(mac);
+  }
+  const NodeInfo* findById(const char* nodeId) const {
+    return const_cast<NodeRegistry*>(this)->findById(nodeId);
+  }
+
+ private:
+  // Power of two, at least twice kCapacity so probe chains stay short.
+  static constexpr size_t  kIndexSlots = 256;
+  static constexpr uint8_t kEmpty = 0xFF;
+  static_assert(kCapacity < kEmpty && kIndexSlots >= 2 * kCapacity,
+                "NODE_REGISTRY_CAPACITY too large for the uint8_t index");
+
+  static size_t hashMac(const uint8_t* mac) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < 6; ++i) { h ^= mac[i]; h *= 16777619u; }
+    return (size_t)(h ^ (h >> 16));
+  }
+  static size_t hashId(const char* s) {
+    uint32_t h = 2166136261u;
+    while (*s) { h ^= (uint8_t)*s++; h *= 16777619u; }
+    return (size_t)(h ^ (h >> 16));
+  }
+
+  // Linear probing; duplicates keep insertion order along the chain, so a
+  // lookup returns the earliest record, as the old front-to-back scan did.
+  void indexInsert(size_t i) {
+    for (size_t h = hashMac(nodes_[i].mac); ; ++h) {
+      uint8_t& slot = macIndex_[h & (kIndexSlots - 1)];
+      if (slot == kEmpty) { slot = (uint8_t)i; break; }
+    }
+    if (nodes_[i].nodeId.isEmpty()) return;
+    for (size_t h = hashId(nodes_[i].nodeId.c_str()); ; ++h) {
+      uint8_t& slot = idIndex_[h & (kIndexSlots - 1)];
+      if (slot == kEmpty) { slot = (uint8_t)i; break; }
+    }
+  }
+
+  NodeInfo nodes_[kCapacity];
+  size_t   count_ = 0;
+  uint8_t  macIndex_[kIndexSlots];
+  uint8_t  idIndex_[kIndexSlots];
+};
+
+extern NodeRegistry registeredNodes;
+
+// The live registry, by reference (no copy). Range-for over it directly.
+const NodeRegistry& getRegisteredNodes();
 std::vector<NodeInfo> getUnpairedNodes();
 std::vector<NodeInfo> getPairedNodes();
 NodeState getNodeState(const char* nodeId);
@@ -193,11 +416,19 @@ void   setNodeNotes(const String& nodeId, String notes);
 String getCsvNodeId(const String& nodeId);
 String getCsvNodeName(const String& nodeId);
 
+// node_meta / node_dcfg are cached per registry node after the first read (see
+// node_registry.cpp); the setters write through. This counts the NVS reads the
+// getters still make — cache fills and IDs not in the registry — so a wake or
+// page render can log what it cost. The cache is locked internally, so the
+// getters and setters may be called from the ESP-NOW receive callback as well
+// as from loop().
+uint32_t nodeMetaNvsReadCount();
+
 // Current registry location for a node (RAM only, mirrors NodeInfo::latitude/
 // longitude). NAN if the node isn't currently registered or has no location
 // set. Used to stamp CSV/upload rows at log time — see csv_schema.h.
-float getNodeLatitude(const String& nodeId);
-float getNodeLongitude(const String& nodeId);
+float getNodeLatitude(const char* nodeId);
+float getNodeLongitude(const char* nodeId);
 
 // -----------------------------------------------------------------------------
 // Registry mutation (used by espnow_config.cpp)
@@ -208,4 +439,9 @@ void registerNode(const uint8_t* mac,
                   const char* nodeType,
                   NodeState state);
 
+// Drop a node from the registry: its ESP-NOW peer, its cached node_meta /
+// node_dcfg values and its record. References into the registry are invalid
+// afterwards (erase shifts the records behind it).
+void removeRegisteredNode(NodeInfo& node);
+
 bool unpairNode(const String& nodeId);
@@ -0,0 +1,80 @@
+#include "config/page_stream.h"
+
+namespace {
+
+// One TCP segment on the ESP32's lwIP (TCP_MSS 1436): a full chunk never
+// splits across two segments, and a page holds no more than this of heap.
+constexpr size_t kChunkBytes = 1436;
+
+// Static, not per-PageStream: handlers run on the loop task, whose stack is
+// better kept for the page's own Strings. One page is rendered at a time.
+char gBuf[kChunkBytes];
+
+}  // namespace
+
+PageStream::PageStream(WebServer& server, int status, const char* contentType)
+    : m_server(server), m_status(status), m_contentType(contentType),
+      m_startMs(millis()), m_heapStart(ESP.getFreeHeap()), m_heapLow(m_heapStart) {}
+
+PageStream::~PageStream() { end(); }
+
+PageStream& PageStream::operator+=(const String& s) {
+  write(s.c_str(), s.length());
+  return *this;
+}
+
+PageStream& PageStream::operator+=(const char* s) {
+  if (s) write(s, strlen(s));
+  return *this;
+}
+
+PageStream& PageStream::operator+=(const __FlashStringHelper* s) {
+  // Flash is byte-addressable through the cache on the ESP32.
+  const char* p = reinterpret_cast<const char*>(s);
+  if (p) write(p, strlen(p));
+  return *this;
+}
+
+PageStream& PageStream::operator+=(char c) {
+  write(&c, 1);
+  return *this;
+}
+
+void PageStream::write(const char* data, size_t len) {
+  if (m_ended) return;
+  m_total += len;
+  while (len > 0) {
+    const size_t n = len < kChunkBytes - m_used ? len : kChunkBytes - m_used;
+    memcpy(gBuf + m_used, data, n);
+    m_used += n;
+    data += n;
+    len -= n;
+    if (m_used == kChunkBytes) flush();
+  }
+}
+
+void PageStream::flush() {
+  const uint32_t heap = ESP.getFreeHeap();
+  if (heap < m_heapLow) m_heapLow = heap;
+  if (!m_started) {
+    m_started = true;
+    m_server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    m_server.send(m_status, m_contentType, "");
+    m_ttfbMs = millis() - m_startMs;
+  }
+  if (m_used == 0) return;
+  m_server.sendContent(gBuf, m_used);
+  m_used = 0;
+  ++m_chunks;
+}
+
+void PageStream::end() {
+  if (m_ended) return;
+  flush();
+  m_server.sendContent("");   // zero-length chunk: end of response
+  m_ended = true;
+  Serial.printf("[WEB] %s: %d, %u B in %u chunks, ttfb %lu ms, %lu ms, heap -%lu B\n",
+                m_server.uri().c_str(), m_status, (unsigned)m_total, (unsigned)m_chunks,
+                (unsigned long)m_ttfbMs, (unsigned long)(millis() - m_startMs),
+                (unsigned long)(m_heapStart - m_heapLow));
+}
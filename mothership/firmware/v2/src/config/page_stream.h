@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// ---------------------------------------------------------------------------
+// Streaming page writer for the config portal
+// ---------------------------------------------------------------------------
+// Portal pages used to be built as one String and sent with server.send(), so
+// the whole page sat in one contiguous heap block before its first byte left
+// over the soft-AP. On a 64-node /stations that block competes with LittleFS
+// and ESP-NOW buffers; when it cannot grow, the page is silently truncated
+// (see footCommon()).
+//
+// PageStream takes the same `html += ...` appends but copies them into one
+// fixed, MSS-sized buffer and sends it as an HTTP/1.1 chunk each time it
+// fills. Status line and headers go out with the first chunk, so headers
+// queued with server.sendHeader() before then (headCommon()) still apply.
+// end() flushes and terminates the response; the destructor ends it too.
+//
+// Each page logs its time to first byte, total bytes and chunks, and how far
+// free heap dipped below where it started while it rendered:
+//   [WEB] /stations: 200, 41230 B in 29 chunks, ttfb 38 ms, 412 ms, heap -6140 B
+//
+// One page at a time: the WebServer is served from one task.
+class PageStream {
+ public:
+  explicit PageStream(WebServer& server, int status = 200,
+                      const char* contentType = "text/html");
+  ~PageStream();
+
+  PageStream& operator+=(const String& s);
+  PageStream& operator+=(const char* s);
+  PageStream& operator+=(const __FlashStringHelper* s);
+  PageStream& operator+=(char c);
+  void write(const char* data, size_t len);
+
+  // Bytes appended so far, sent or buffered.
+  size_t length() const { return m_total; }
+
+  // Flush and terminate the response. Idempotent.
+  void end();
+
+ private:
+  void flush();
+
+  WebServer&  m_server;
+  int         m_status;
+  const char* m_contentType;
+  bool        m_started = false;
+  bool        m_ended = false;
+  size_t      m_used = 0;
+  size_t      m_total = 0;
+  uint16_t    m_chunks = 0;
+  uint32_t    m_startMs;
+  uint32_t    m_ttfbMs = 0;
+  uint32_t    m_heapStart;
+  uint32_t    m_heapLow;
+};
@@ -0,0 +1,1391 @@
+#pragma once
+
+// Generated by scripts/portal_assets.py from web/ — do not edit; edit the
+// source file and rebuild (or run the script).
+
+#include <Arduino.h>
+
+// web/portal.css: 17488 bytes, 5274 gzipped
+static const char PORTAL_CSS_VER[] = "92ebc84140196487";
+static const char PORTAL_CSS_ETAG[] = "\"92ebc84140196487\"";
+static const char PORTAL_CSS[] PROGMEM = R"FMASSET(:root{
+  --bg:#faf8f4; --panel:#ffffff; --text:#4a4640; --sub:#6b665e; --border:#e8e4dc;
+  --primary:#5b7553; --success:#7a9b70; --warn:#c47a5a; --danger:#c45a4a;
+  --btn-solid:#5b7553;
+  --input-bg:#f5f3ee;
+  --input-bg-active:#ede9e2;
+  --radius:10px; --sp-1:8px; --sp-2:12px; --sp-3:16px; --sp-4:20px;
+  --shadow:0 2px 10px rgba(74,74,72,.12);
+}
+*{box-sizing:border-box;-webkit-tap-highlight-color:transparent}
+html{scroll-behavior:smooth}
+html,body{margin:0;padding:0;background:linear-gradient(180deg,#faf8f4 0%, #e8e4dc 100%);color:var(--text);
+  font:16px/1.5 -apple-system,BlinkMacSystemFont,"Segoe UI",Roboto,system-ui,sans-serif}
+a{color:var(--primary);text-decoration:none}
+:focus-visible{outline:3px solid rgba(33,150,243,.35);outline-offset:2px}
+
+/* Layout */
+.container{max-width:600px;margin:0 auto;padding:var(--sp-3)}
+.header{padding:var(--sp-3) 0;text-align:center}
+.header-top{display:flex;align-items:center;justify-content:space-between;gap:10px}
+.header-actions{display:flex;align-items:center;gap:8px}
+.h1{font-size:24px;font-weight:700;margin:0}
+.top-time{display:flex;align-items:center;justify-content:space-between;gap:10px;background:var(--panel);border:1px solid var(--border);border-radius:10px;padding:14px 16px;margin-bottom:12px;min-height:62px}
+.top-time__label{color:var(--sub);font-size:.95rem;font-weight:600}
+.top-time__value{font-weight:700;color:#566246;font-size:1.25rem}
+.section{background:var(--panel);border:1px solid var(--border);border-radius:var(--radius);
+  padding:var(--sp-3);box-shadow:var(--shadow);margin:var(--sp-3) 0}
+.section h3{margin:0 0 var(--sp-2);font-size:18px}
+.section-head{display:flex;align-items:center;justify-content:space-between;gap:10px;margin:0 0 var(--sp-2)}
+.section-head h3{margin:0}
+.muted{color:var(--sub);font-size:.95rem}
+
+/* Stats */
+.stats{display:grid;grid-template-columns:1fr 1fr 1fr;gap:var(--sp-1);text-align:center}
+.stats--kpi{grid-template-columns:1fr 1fr}
+.stat{background:#fafafa;border:1px solid var(--border);border-radius:8px;padding:10px}
+.stat strong{display:block;font-size:13px;color:var(--sub);margin-bottom:2px}
+.stat .num{font-size:18px;font-weight:700}
+.stats--kpi .stat{padding:14px}
+.stats--kpi .stat strong{font-size:12px;letter-spacing:.02em;text-transform:uppercase}
+.stats--kpi .stat .num{font-size:24px}
+.stats--kpi .stat--deployed-active{background:rgba(122,155,112,.25);border-color:#7a9b70}
+.stats--kpi .stat--paired-active{background:rgba(196,122,90,.25);border-color:#c47a5a}
+.stats--kpi .stat--unpaired-active{background:rgba(196,90,74,.20);border-color:#c45a4a}
+
+/* Lists/cards */
+.list{display:grid;gap:var(--sp-1)}
+.item{background:var(--panel);border:1px solid var(--border);border-radius:8px;padding:12px;display:block;color:inherit}
+.item-row{display:flex;align-items:center;justify-content:space-between;gap:12px}
+.item--node{
+  padding:14px 12px;
+  min-height:86px;
+  cursor:pointer;
+  border-width:2px;
+  border-color:#c9d0c3;
+  background:linear-gradient(180deg,#ffffff 0%, #f4f7ef 100%);
+  box-shadow:0 4px 12px rgba(74,74,72,.12);
+  transition:transform .12s ease, box-shadow .12s ease, border-color .12s ease, background .12s ease;
+}
+.item--node:hover{
+  border-color:#9faf97;
+  box-shadow:0 8px 18px rgba(74,74,72,.18);
+  background:linear-gradient(180deg,#ffffff 0%, #eef3e5 100%);
+}
+.item--node:focus-visible{
+  outline:3px solid rgba(79,109,122,.35);
+  outline-offset:2px;
+}
+.item--node:active{
+  transform:translateY(1px) scale(.995);
+  box-shadow:0 3px 9px rgba(74,74,72,.14);
+}
+.node-row{display:grid;grid-template-columns:minmax(0,1fr) auto auto;align-items:center;gap:12px}
+.node-main{min-width:0;overflow:hidden;text-overflow:ellipsis;white-space:nowrap}
+.node-name{margin-left:10px}
+.node-timing{display:grid;grid-template-columns:auto auto;gap:10px}
+.node-timing-cell{display:flex;flex-direction:column;align-items:flex-start;gap:3px;min-width:86px}
+.node-timing-label{font-size:.72rem;color:var(--sub);font-weight:700;letter-spacing:.02em;text-transform:uppercase}
+.node-timing-value{font-size:.86rem}
+.node-status{display:grid;grid-template-columns:auto auto;gap:10px}
+.node-status-cell{display:flex;flex-direction:column;align-items:flex-start;gap:3px;min-width:86px}
+.item--node .chip{font-weight:600}
+.item--node .chip{white-space:nowrap}
+/* Per-node checkboxes are opt-in, exactly like the action bar they feed. The
+   list is read one node at a time far more often than it is acted on in bulk,
+   and a permanent checkbox column costs 44px of width on a phone plus a
+   selection affordance on every row for a mode the operator is usually not in.
+   body.batch-mode is set by showBatchBar(). */
+.node-select-wrap{display:grid;grid-template-columns:minmax(0,1fr);gap:8px;align-items:stretch}
+.node-select-control{display:none;align-items:center;justify-content:center;border:2px solid #c9d0c3;
+  border-radius:8px;background:#f7f8f4;cursor:pointer;min-height:86px}
+body.batch-mode .node-select-wrap{grid-template-columns:44px minmax(0,1fr)}
+body.batch-mode .node-select-control{display:flex}
+.node-select-control input{width:22px;height:22px;margin:0;accent-color:var(--primary)}
+.node-select-wrap.is-selected .node-select-control{border-color:var(--primary);background:rgba(122,155,112,.20)}
+.node-select-wrap.is-selected .item--node{border-color:var(--primary)}
+.batch-actions{position:sticky;top:74px;z-index:8;margin:0 0 12px;padding:12px;border:1px solid var(--border);
+  border-radius:10px;background:rgba(255,255,255,.96);box-shadow:var(--shadow);backdrop-filter:blur(5px)}
+.batch-actions__head{display:flex;align-items:center;justify-content:space-between;gap:10px;margin-bottom:8px}
+.batch-actions__buttons{display:grid;grid-template-columns:repeat(3,minmax(0,1fr));gap:8px}
+.batch-actions__buttons .btn{margin:0;padding:10px 8px;min-height:44px}
+.batch-actions__buttons .btn--remove{background:#fff;color:#7a2a20;border-color:#c45a4a}
+
+/* Chips */
+.chip{display:inline-block;padding:2px 8px;border-radius:999px;border:1px solid var(--border);font-size:.85rem;color:var(--sub)}
+.chip--state-deployed{border-color:#7a9b70;background:rgba(122,155,112,.25);color:#3d5e35}
+.chip--state-paused{border-color:#5a7fc4;background:rgba(90,127,196,.20);color:#233a6b}
+.chip--state-paired{border-color:#c47a5a;background:rgba(196,122,90,.25);color:#8a4a2e}
+.chip--state-unpaired{border-color:#c45a4a;background:rgba(196,90,74,.20);color:#7a2a20}
+.chip--link-awake{border-color:#b3e5fc;background:#e1f5fe;color:#01579b}
+.chip--link-asleep{border-color:#e1bee7;background:#f3e5f5;color:#4a148c}
+.chip--link-offline{border-color:#ffcdd2;background:#ffebee;color:#b71c1c}
+.chip--cfg-pending{border-color:#ffe0b2;background:#fff8e1;color:#8a4b00}
+.chip--cfg-ok{border-color:#c8e6c9;background:#f1f8e9;color:#256029}
+.chip--bat-ok{border-color:#7a9b70;background:rgba(122,155,112,.25);color:#3d5e35}
+.chip--bat-med{border-color:#c47a5a;background:rgba(196,122,90,.25);color:#8a4a2e}
+.chip--bat-low{border-color:#c45a4a;background:rgba(196,90,74,.20);color:#7a2a20}
+
+/* Forms */
+.label{display:block;margin:8px 0 6px;color:var(--sub);font-size:.95rem}
+.input, input[type="text"], input[type="number"], select{
+  width:100%;padding:12px;border:1px solid var(--border);border-radius:8px;background:var(--input-bg)
+}
+.input:focus, input[type="text"]:focus, input[type="number"]:focus, select:focus{
+  background:var(--input-bg-active)
+}
+.help{color:var(--sub);font-size:.85rem;margin-top:6px}
+/* Identifiers meant to be copied by hand. user-select:all makes the value
+   select as one complete unit rather than word-by-word; it does not guarantee
+   a single tap selects it on every browser, so a copy button is still offered
+   alongside. This is the zero-JS backstop. */
+.mono-id{font-family:monospace;user-select:all;-webkit-user-select:all;word-break:break-all}
+.mono-id--lg{display:block;font-size:20px;font-weight:700;letter-spacing:.5px;margin:6px 0}
+.row{display:flex;gap:var(--sp-1);flex-wrap:wrap}
+.col{flex:1 1 220px;min-width:0}
+.subpanel{display:none;margin-top:12px;padding:10px;border:1px solid var(--border);border-radius:8px;background:#fafafa}
+.action-stack .btn{padding:14px 16px;min-height:52px;font-size:1rem}
+
+/* Buttons */
+.btn{display:inline-flex;align-items:center;justify-content:center;gap:8px;
+  padding:12px 16px;border-radius:8px;border:1px solid var(--border);background:#fff;color:var(--text);
+  cursor:pointer;width:100%;margin-top:8px;text-decoration:none}
+.btn--primary,.btn--success,.btn--warn{background:var(--btn-solid);color:#fff;border-color:transparent}
+.btn--sm{width:auto;min-height:36px;padding:8px 12px;margin-top:0;font-size:.9rem}
+.btn--action{padding:14px 16px;min-height:52px;font-size:1rem}
+.btn:disabled{opacity:.6;cursor:not-allowed}
+.action-choices{display:grid;gap:8px;margin-top:10px}
+.action-choice input{position:absolute;opacity:0;pointer-events:none}
+.action-choice span{display:flex;align-items:center;justify-content:center;min-height:46px;padding:10px 12px;border-radius:8px;border:1px solid var(--border);font-weight:700;cursor:pointer;transition:filter .12s ease, transform .12s ease, box-shadow .12s ease}
+.action-choice--start span{border-color:#7a9b70;background:#fff;color:#3d5e35}
+.action-choice--stop span{border-color:#c47a5a;background:#fff;color:#8a4a2e}
+.action-choice--unpair span{border-color:#c45a4a;background:#fff;color:#7a2a20}
+.action-choice span:hover{filter:brightness(.98)}
+.action-choice input:checked + span{box-shadow:0 0 0 2px rgba(79,109,122,.35) inset;transform:translateY(1px)}
+.action-choice--start input:checked + span{background:rgba(122,155,112,.25)}
+.action-choice--stop input:checked + span{background:rgba(196,122,90,.25)}
+.action-choice--unpair input:checked + span{background:rgba(196,90,74,.20)}
+button.action-choice{display:block;width:100%;padding:0;border:0;background:transparent;
+  color:inherit;font:inherit;text-align:inherit}
+button.action-choice:focus-visible{outline:none}
+button.action-choice:focus-visible span{outline:2px solid var(--primary);outline-offset:2px}
+/* Two-line variant: action name plus ONE line of consequence. A modifier rather
+   than a change to .action-choice span, because the recording-interval picker
+   reuses the base class and must stay a single centred line. */
+.action-choice--why span{flex-direction:column;align-items:flex-start;justify-content:center;gap:3px;text-align:left}
+.action-choice--why em{font-style:normal;font-weight:400;font-size:12px;line-height:1.3;opacity:.8}
+.icon{width:1.2em;height:1.2em;display:inline-block;vertical-align:-0.12em;fill:currentColor}
+.quick-row{display:grid;grid-template-columns:repeat(3,minmax(0,1fr));gap:8px;margin:0 0 12px}
+.quick-row .btn{margin-top:0;min-height:52px}
+.quick-row .subpanel{grid-column:2 / 3;margin-top:0}
+.quick-row form{margin:0}
+.quick-row form .btn{width:100%}
+
+/* Utility */
+.center{text-align:center}
+.badge{display:inline-block;padding:2px 8px;border:1px solid var(--border);border-radius:999px;color:var(--sub);font-size:.85rem}
+
+/* Time health pills in Node Manager */
+.time-health{
+  display:flex;
+  flex-direction:column;
+  align-items:flex-start;
+  gap:2px;
+  font-size:.85rem;
+}
+.health-pill{
+  display:inline-flex;
+  align-items:center;
+  justify-content:center;
+  padding:2px 8px;
+  border-radius:999px;
+  font-size:.75rem;
+  font-weight:600;
+  color:#ffffff;
+  white-space:nowrap;
+}
+.health-fresh{background:#16a34a;}
+.health-ok{background:#f97316;}
+.health-stale{background:#dc2626;}
+.health-unknown{background:#6b7280;}
+.health-subtext{
+  font-size:.7rem;
+  color:#6b7280;
+}
+
+@media(max-width:480px){
+  /* Prevent horizontal scroll from any wide content */
+  body{overflow-x:hidden}
+
+  /* Quick-action grid: 2 columns on phones instead of 3 */
+  .quick-row{grid-template-columns:1fr 1fr}
+  .quick-row .subpanel{grid-column:1 / -1}
+
+  /* Node cards: stack name above timing/status */
+  .node-row{grid-template-columns:1fr;gap:8px}
+  .node-timing,.node-status{grid-template-columns:1fr 1fr;gap:6px}
+  .node-timing-cell,.node-status-cell{min-width:0}
+  .node-select-wrap{grid-template-columns:minmax(0,1fr);gap:6px}
+  body.batch-mode .node-select-wrap{grid-template-columns:42px minmax(0,1fr)}
+  .batch-actions{top:66px}
+  .batch-actions__buttons{grid-template-columns:1fr}
+
+  /* Small buttons: meet 44px touch target minimum */
+  .btn--sm{min-height:44px;padding:10px 14px}
+
+  /* Reduce section spacing to reduce vertical scrolling */
+  .section{margin:10px 0;padding:12px}
+
+  /* Sticky header so navigation stays visible while scrolling */
+  .header{position:sticky;top:0;z-index:10;background:var(--bg);padding:10px 0}
+
+  /* KPI stat numbers: prevent text overflow on narrow screens */
+  .stats--kpi .stat .num{overflow:hidden;text-overflow:ellipsis}
+
+  /* Top time bar: slightly smaller on phones */
+  .top-time{padding:10px 12px;min-height:52px}
+  .top-time__value{font-size:1.1rem}
+}
+
+@media(min-width:768px){.container{max-width:720px}}
+
+/* --- Responsiveness layer: spinner, loading, discovery, connection --- */
+/* Kept tiny and CSS-only — no images, no external assets (ESP32 flash). */
+.spinner{display:inline-block;width:1em;height:1em;border:2px solid rgba(120,120,120,.3);
+  border-top-color:currentColor;border-radius:50%;animation:fmspin .7s linear infinite;
+  vertical-align:-.15em;margin-right:6px}
+@keyframes fmspin{to{transform:rotate(360deg)}}
+.btn.is-loading{opacity:.9;cursor:progress}
+.btn.is-ok{box-shadow:0 0 0 2px rgba(122,155,112,.6) inset}
+.btn.is-err{box-shadow:0 0 0 2px rgba(196,90,74,.6) inset}
+
+#ui-status.s-ok{border-color:#7a9b70;color:#3d5e35;background:rgba(122,155,112,.12)}
+#ui-status.s-warn{border-color:#c47a5a;color:#8a4b00;background:#fff8e1}
+#ui-status.s-err{border-color:#c45a4a;color:#7a2a20;background:rgba(196,90,74,.10)}
+#ui-status.s-progress{border-color:#4f6d7a;color:#33525c;background:#eef5f8}
+
+.discovery-panel{margin:10px 0;padding:12px;border:1px solid #b3e5fc;border-radius:8px;background:#e8f6fe}
+.discovery-panel .dp-row{display:flex;align-items:center;justify-content:space-between;gap:10px;font-size:.9rem;margin:2px 0}
+.discovery-panel strong{display:inline-flex;align-items:center;color:#01579b}
+.discovery-panel .dp-msg{color:var(--sub);font-size:.82rem;margin-top:6px}
+
+.node-new{animation:fmflash 1.6s ease-out 1}
+@keyframes fmflash{0%{box-shadow:0 0 0 3px #f6d365;background:#fffbe6}70%{background:#fffef6}100%{box-shadow:none}}
+
+.conn-dot{display:inline-flex;align-items:center;gap:5px;font-size:.76rem;color:var(--sub)}
+.conn-dot::before{content:'';width:8px;height:8px;border-radius:50%;background:#7a9b70;flex:none}
+.conn-dot.c-updating::before{background:#4f9bd6}
+.conn-dot.c-warn::before{background:#c47a5a}
+.conn-dot.c-err::before{background:#c45a4a}
+
+/* Full-screen loading overlay — shown during page navigation + form submits */
+.fm-load-overlay{position:fixed;inset:0;background:rgba(250,249,246,.6);display:none;
+  align-items:center;justify-content:center;z-index:9999}
+.fm-load-overlay.show{display:flex}
+.fm-load-box{display:flex;flex-direction:column;align-items:center;gap:12px;padding:20px 26px;
+  background:#fff;border:1px solid var(--border);border-radius:14px;box-shadow:0 10px 34px rgba(0,0,0,.16);
+  color:var(--sub);font-size:.92rem}
+.fm-load-box .spinner{width:2em;height:2em;border-width:3px;margin:0;color:#7a9b70}
+
+/* --- Persistent navigation: fixed bottom bar (phone) / static row (desktop) --- */
+/* Content clears the fixed bar; desktop override below zeroes this. */
+body{padding-bottom:calc(70px + env(safe-area-inset-bottom))}
+.tabbar{position:fixed;left:0;right:0;bottom:0;z-index:20;display:grid;grid-template-columns:repeat(4,1fr);
+  background:var(--panel);border-top:1px solid var(--border);box-shadow:0 -2px 10px rgba(74,74,72,.10);
+  padding-bottom:env(safe-area-inset-bottom)}
+.tabbar a{display:flex;flex-direction:column;align-items:center;justify-content:center;gap:3px;
+  min-height:56px;padding:6px 4px;color:var(--sub);font-size:.72rem;font-weight:600;
+  border-top:3px solid transparent;text-decoration:none}
+.tabbar a .icon{width:22px;height:22px}
+.tabbar a[aria-current="page"]{color:var(--primary);border-top-color:var(--primary);background:rgba(91,117,83,.08)}
+@media(hover:hover){.tabbar a:hover{color:var(--text);background:rgba(91,117,83,.06)}}
+
+/* Flat secondary section — border only. Shadow is reserved for primary surfaces. */
+.section--flat{box-shadow:none}
+
+/* Primary action card at the end of the page flow (shadowed to stand out from
+   the flat secondary sections). Not floating — the fixed tab bar owns the bottom. */
+.sticky-action{margin:16px 0;padding:12px;background:var(--panel);border:1px solid var(--border);
+  border-radius:var(--radius);box-shadow:var(--shadow)}
+.sticky-action .btn{margin-top:0}
+
+/* Tabular numerals so readings/voltage/time/percent don't jitter as they update. */
+.num,.top-time__value,.chip--bat-ok,.chip--bat-med,.chip--bat-low{font-variant-numeric:tabular-nums}
+
+@media(min-width:768px){
+  .tabbar{position:static;box-shadow:none;border-top:none;border-bottom:1px solid var(--border);
+    max-width:720px;margin:0 auto 8px}
+  .tabbar a{flex-direction:row;gap:8px;min-height:48px;font-size:.9rem;
+    border-top:none;border-bottom:3px solid transparent}
+  .tabbar a[aria-current="page"]{border-top-color:transparent;border-bottom-color:var(--primary)}
+  body{padding-bottom:0}
+}
+
+@media(prefers-reduced-motion:reduce){
+  html{scroll-behavior:auto}
+  .spinner{animation:none}
+  .node-new{animation:none}
+  .item--node,.action-choice span,.btn{transition:none}
+}
+)FMASSET";
+static const uint8_t PORTAL_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x5c,0xff,0x8f,0xab,0x46,0x92,0xff,0x7d,0xfe,
+  0x8a,0xd6,0x1b,0x45,0x19,0x27,0xc6,0x0f,0xb0,0x8d,0x6d,0xac,0x95,0xf6,0x12,0x6d,0xa4,0xdc,0xdd,0xe6,
+  0x72,0xfb,0xb2,0x3f,0x9c,0x56,0xab,0xa8,0x81,0xc6,0x66,0x07,0x03,0x0b,0x78,0x66,0x1c,0x6b,0xa4,0xfb,
+  0x23,0xee,0x2f,0xbc,0xbf,0xe4,0xaa,0xaa,0x1b,0xe8,0x06,0x6c,0xcf,0xbc,0xbc,0xcb,0xcb,0xbc,0x0c,0xd0,
+  0x54,0x57,0x57,0x57,0x57,0x7d,0xea,0x0b,0xf1,0xcb,0x3c,0xaf,0xcf,0x77,0x8c,0x59,0x56,0xb0,0xf3,0xef,
+  0x63,0x1e,0xaf,0xe3,0xc5,0x16,0xae,0x0a,0x9e,0x89,0x14,0x6e,0xd0,0x3f,0x78,0xa3,0x16,0x2f,0xb5,0x7f,
+  0xbf,0xe0,0x0b,0x6f,0x61,0xe3,0x75,0x75,0x0c,0xfc,0x7b,0x2f,0xf0,0xbc,0xa5,0xc0,0xcb,0x20,0x2f,0x23,
+  0x51,0xfa,0xf7,0x62,0x2d,0x16,0x51,0xb8,0x25,0x8a,0x45,0x99,0x1c,0x78,0x79,0xf2,0xef,0x97,0xc1,0x6a,
+  0xb9,0x9c,0xcb,0xb7,0xc2,0x50,0x54,0x95,0x7f,0xbf,0xe2,0x9b,0x60,0x45,0x84,0x9e,0x79,0x99,0xf9,0xf7,
+  0xe1,0x62,0xc5,0x97,0x1c,0xaf,0x23,0x9e,0xed,0x90,0x52,0xb8,0x58,0xf2,0x05,0x97,0x94,0x82,0x3a,0xb3,
+  0xaa,0x3c,0x4d,0xa2,0x96,0x16,0xdd,0x4e,0xb2,0xe2,0x58,0x4b,0xc6,0x97,0xf1,0x5c,0x08,0xf3,0xae,0xc5,
+  0xc3,0x3a,0x79,0x12,0xc0,0x53,0x24,0x36,0xc2,0x95,0x0f,0x4b,0x1e,0x25,0xc7,0xca,0x77,0xec,0xe2,0x85,
+  0xf8,0x29,0x2c,0xc7,0x5f,0xb7,0xbf,0xbb,0xbe,0xe3,0xb6,0x17,0x73,0xdf,0xf1,0xda,0x8b,0x85,0xef,0xe2,
+  0x2b,0x44,0xa3,0xda,0xf3,0x28,0x7f,0xf6,0x6d,0x06,0x63,0x19,0x52,0x62,0xe5,0x2e,0xe0,0x0f,0xab,0xc5,
+  0x14,0xff,0x75,0xa7,0x33,0xc7,0x9d,0x6c,0xef,0x5e,0xef,0xbe,0x39,0x07,0xf9,0x8b,0x55,0x25,0xbf,0x25,
+  0xd9,0xce,0x97,0x02,0x02,0x39,0xbd,0x6c,0xad,0x67,0x11,0x3c,0x26,0xb5,0x55,0xf3,0xc2,0xda,0x27,0xbb,
+  0x7d,0x0a,0x3f,0xb5,0x15,0xe6,0x69,0x5e,0xfa,0x75,0xc9,0xb3,0xaa,0xe0,0xa5,0xc8,0xea,0xd7,0xbb,0x7d,
+  0x7d,0x48,0xcf,0x55,0x58,0xe6,0x69,0x6a,0x05,0x62,0xcf,0x9f,0x12,0x18,0x51,0x1d,0x60,0xcb,0xf6,0xf2,
+  0xe1,0x34,0xc8,0xa3,0xd3,0x19,0x84,0xbc,0x4b,0x32,0xdf,0xde,0x16,0x3c,0x8a,0x70,0x2e,0x7b,0x1b,0xf0,
+  0xf0,0x71,0x57,0xe6,0xc7,0x2c,0xf2,0xd3,0x24,0x13,0xbc,0xb4,0x76,0xb8,0x72,0xa0,0xfa,0xe0,0xac,0xed,
+  0x48,0xec,0xa6,0x6a,0xaf,0x99,0xfd,0xd5,0x94,0xa9,0x5d,0x83,0xb5,0xd8,0x5f,0x4d,0xb6,0x92,0x91,0x27,
+  0x5e,0x3e,0xc8,0x5d,0x9f,0xe0,0xaa,0xe3,0x3c,0xab,0x49,0x1e,0x1f,0x9d,0xd9,0x92,0x59,0xbc,0x28,0x52,
+  0x61,0x55,0xa7,0xaa,0x16,0x87,0xe9,0x77,0x30,0xc5,0xe3,0x9f,0x79,0xf8,0x89,0x2e,0x7f,0x80,0x91,0xd3,
+  0x0f,0x9f,0xc4,0x2e,0x17,0xec,0xaf,0x3f,0x7e,0x98,0xfe,0x25,0x0f,0xf2,0x3a,0x9f,0xca,0xb1,0xd6,0x31,
+  0x99,0x56,0xb0,0x42,0xab,0x12,0x65,0x12,0xbf,0xde,0xf1,0xb3,0x3e,0x9b,0x52,0x98,0xc9,0x16,0xa7,0xb5,
+  0x22,0x11,0xe6,0x25,0xaf,0x93,0x3c,0xf3,0xb3,0x3c,0x13,0xaf,0x77,0x7e,0x9c,0x87,0xc7,0xca,0x7a,0x4a,
+  0xaa,0x24,0x48,0xc5,0x39,0x3f,0xd6,0xb8,0x36,0x7f,0x0e,0x1b,0x40,0xca,0x21,0xb7,0x61,0x3e,0x9f,0x3a,
+  0x4b,0x7b,0xea,0x2e,0xe6,0xd3,0xd9,0x7c,0x39,0xd9,0xaa,0x61,0x56,0x1e,0xc7,0x95,0xa8,0x7d,0xd8,0xb3,
+  0xd7,0xbb,0xbb,0x8f,0xdf,0xb0,0x7f,0xe7,0x27,0x78,0xc4,0xbe,0xf9,0x78,0x37,0x0b,0x81,0x65,0x0e,0x63,
+  0x4a,0x10,0xe5,0x8b,0xf5,0x9c,0x44,0xf5,0xde,0xf7,0x6c,0xdc,0xef,0x46,0xb4,0x8c,0x1f,0xeb,0xbc,0x95,
+  0xaf,0xe4,0x16,0x55,0x64,0xf2,0x7a,0x37,0xdb,0x0b,0x0e,0x3b,0x7b,0x1e,0x79,0xc8,0x6c,0xb9,0x12,0x0e,
+  0x3b,0x9c,0xf9,0x21,0x48,0x5f,0x94,0xed,0x0b,0x56,0x9d,0x17,0xe7,0x28,0xa9,0x8a,0x94,0x9f,0xfc,0x38,
+  0x15,0x2f,0x5b,0x1a,0x66,0x25,0x20,0xa6,0x4a,0x0d,0xde,0xfe,0xe3,0x58,0xd5,0x49,0x7c,0xb2,0x90,0x43,
+  0xb8,0xe3,0x83,0x6a,0x84,0x02,0x74,0xa1,0x7e,0x16,0x22,0xdb,0xee,0x78,0x41,0x9a,0xdc,0xd1,0x44,0x95,
+  0xcf,0xb3,0xea,0x26,0x5d,0x7c,0x73,0x2d,0x5f,0x74,0xce,0xb8,0xb7,0xa8,0xa6,0xc2,0x77,0x17,0xb0,0x66,
+  0xba,0x7c,0x16,0xa8,0x94,0xfe,0xca,0xb6,0x5b,0x19,0xc0,0x60,0x60,0xd9,0xaa,0x93,0x83,0xf8,0x42,0x7c,
+  0xeb,0x6a,0xaa,0x34,0x00,0xcd,0xce,0x64,0xab,0xac,0x89,0xd3,0xee,0xac,0x7c,0x2a,0x6f,0x37,0x8f,0x8d,
+  0xb3,0xdc,0x48,0xdf,0x59,0xe0,0x99,0xf4,0xda,0xad,0x83,0x77,0xea,0x3a,0x3f,0xc8,0x73,0x7d,0x80,0xeb,
+  0xbd,0x5c,0x98,0x47,0x7a,0xd0,0x2e,0xe8,0xd7,0x5f,0x53,0x1e,0x88,0xd4,0xd0,0x46,0xb0,0x70,0x93,0x6d,
+  0x27,0x9b,0xd9,0x66,0x59,0x8a,0x83,0x21,0x1d,0xd0,0x11,0x83,0xc6,0x13,0x4f,0x8f,0xe2,0xdc,0x97,0x9f,
+  0xa4,0x79,0xbf,0xf4,0x3c,0x77,0xe1,0x69,0x04,0x9d,0x99,0x8b,0x14,0x81,0x42,0x25,0x68,0xdb,0xce,0x5f,
+  0x44,0x1c,0xf2,0x99,0xbc,0xa0,0xa3,0x3b,0xa2,0x98,0x5b,0x32,0x4c,0xd2,0x8c,0xa9,0xdb,0x74,0x31,0x69,
+  0x36,0xdb,0x50,0xe2,0x8e,0x43,0xb6,0x9f,0xb7,0xd6,0x86,0xd9,0xac,0x1d,0xe5,0xea,0x82,0x72,0xa4,0x62,
+  0xa9,0x57,0x2c,0xd4,0xcc,0x2f,0xa5,0x2f,0xe3,0x73,0xf7,0x26,0xd3,0x99,0x84,0x47,0x87,0x63,0x2d,0xa2,
+  0xdb,0x1b,0x2b,0x8d,0xc2,0xa7,0x9a,0xd7,0x15,0xd9,0x84,0x0a,0x7f,0x6b,0xf9,0xde,0x95,0x49,0xb4,0xc5,
+  0xbf,0xc0,0x22,0x1e,0xe0,0x4e,0x2d,0xd0,0x5e,0x1f,0x0f,0x19,0xa8,0x5f,0x5c,0x32,0xf5,0x43,0x8c,0xb6,
+  0x8c,0x39,0x93,0xd1,0xd3,0x4f,0x84,0x2d,0xeb,0xb1,0x48,0xce,0x57,0x09,0xaa,0xa1,0xba,0x52,0xa0,0xcd,
+  0x86,0x3f,0xef,0xd3,0x87,0xb5,0x7e,0x3a,0xa4,0xb1,0x40,0xba,0xac,0xaa,0xcb,0x3c,0xdb,0xb5,0x2b,0x0c,
+  0xd2,0x3c,0x7c,0xd4,0x77,0x11,0xcc,0xea,0x76,0x20,0x35,0xf3,0x50,0xb9,0x1d,0xb5,0x59,0x76,0x3c,0x9c,
+  0x4d,0x1d,0xe8,0x1b,0x12,0x63,0xed,0x4c,0x2e,0x4e,0x3f,0xb6,0x23,0xcf,0x1b,0x26,0x35,0xc2,0x78,0x8e,
+  0x53,0x51,0x83,0x2c,0x2d,0x54,0x12,0x7c,0x79,0x66,0xbb,0x70,0x30,0x49,0xd6,0xe4,0x3e,0xe3,0xbc,0x3c,
+  0xf8,0xc7,0xa2,0x10,0x65,0xc8,0x2b,0x31,0x46,0xb6,0xc7,0xad,0x3b,0x3e,0x3b,0x60,0x11,0x51,0xa4,0xf9,
+  0x49,0x44,0x0a,0x4a,0xe8,0x7b,0x41,0xbe,0xc6,0x71,0x5d,0x70,0x36,0xcb,0xa9,0xe3,0x80,0xd7,0x77,0x97,
+  0xad,0xe8,0xd5,0x91,0x97,0x20,0x67,0x94,0x72,0xc1,0x93,0xf2,0x0a,0xdd,0x8d,0x37,0x45,0xda,0x1b,0x7b,
+  0x8c,0xac,0xc4,0x4a,0xa3,0x64,0x8f,0xd9,0x6d,0xc2,0x40,0x14,0x70,0xca,0xcc,0xb5,0x87,0x74,0x11,0x71,
+  0x29,0xef,0x98,0x54,0x75,0xf5,0x31,0xe4,0x65,0x24,0x8f,0x43,0x0a,0xd7,0xbd,0xd3,0x60,0xea,0x3a,0xb0,
+  0x83,0x27,0xfa,0xcb,0xd8,0x30,0x43,0x67,0x71,0xc7,0x4d,0x2d,0x95,0xfc,0x26,0xd9,0x1e,0x40,0x44,0xad,
+  0x26,0xb6,0xca,0xfc,0xf9,0x4b,0x98,0x19,0xa9,0xd3,0x44,0xd1,0xca,0xf2,0x48,0x9c,0x35,0x0b,0x2a,0x9d,
+  0x8b,0x2b,0x71,0xa0,0xe6,0x4c,0xd6,0x9e,0xbc,0x15,0x1e,0xcb,0x0a,0x18,0x2b,0xf2,0x84,0x66,0x83,0x3b,
+  0x6a,0x59,0x12,0x52,0xa8,0x17,0x7b,0x42,0xdf,0x44,0x76,0x48,0x78,0xf6,0x2d,0x98,0x8d,0xfe,0x91,0x98,
+  0x2d,0x5e,0xc4,0x2b,0x11,0x2b,0xcc,0x46,0x64,0x5f,0x3a,0x64,0xda,0x30,0x3a,0x8a,0x4c,0x19,0xa3,0x63,
+  0x92,0x10,0xb4,0x6a,0x4f,0x0c,0x83,0x87,0x15,0x13,0x70,0x62,0xa6,0x1a,0x2d,0xf3,0x6e,0xc7,0xb8,0x71,
+  0xbf,0x65,0xbc,0xbb,0x8b,0xf8,0x57,0x93,0xa2,0xbf,0xcf,0x9f,0x00,0x23,0x0d,0x56,0xbf,0x01,0x7b,0xb6,
+  0x59,0x0d,0xd8,0x5f,0x23,0xfb,0xeb,0x11,0xf6,0xd7,0x93,0xcf,0x90,0x94,0x10,0x10,0x1c,0x2c,0x1b,0x49,
+  0x99,0x7c,0x99,0x90,0x12,0x68,0x5f,0x40,0x95,0xab,0xcd,0xd4,0xb1,0x37,0x74,0x28,0x09,0x55,0x76,0x23,
+  0x35,0x60,0xd9,0x27,0xae,0x0e,0x61,0x23,0x70,0xb2,0x4b,0xf4,0x1b,0xda,0xfb,0xff,0x7a,0x80,0xb3,0x30,
+  0x61,0x55,0xc8,0x53,0xf1,0x30,0xdb,0x6c,0x96,0xc3,0x5d,0x44,0x1e,0x36,0x23,0x52,0x58,0xc8,0x65,0xe0,
+  0x1c,0x86,0xda,0x5f,0xf1,0x52,0xa0,0xad,0x80,0x6d,0x1f,0xec,0x29,0x78,0x96,0x09,0xa1,0x59,0x09,0x69,
+  0x2f,0x60,0x43,0x75,0x0c,0x68,0x86,0x03,0x40,0xe3,0x33,0x6a,0xbb,0xd4,0x62,0x7b,0x8b,0x5b,0x19,0xa7,
+  0xc0,0xe1,0x3e,0x89,0x22,0x38,0x37,0x64,0x79,0xdb,0x9b,0x22,0x4d,0x93,0xa2,0x4a,0xaa,0xed,0xf3,0x1e,
+  0xc8,0x92,0x91,0x16,0x00,0xe0,0x9f,0x4b,0x5e,0x34,0x14,0x33,0x0e,0x10,0x52,0xb9,0x92,0x54,0xc4,0x75,
+  0xe3,0x97,0xe8,0x21,0x40,0xa9,0x44,0xf3,0x4b,0x57,0xd6,0xd4,0xad,0x42,0x03,0xc2,0x1a,0x0d,0x2b,0x04,
+  0x5e,0x4c,0x9b,0x80,0x7f,0x59,0x11,0x58,0x48,0x82,0x0b,0xbe,0xa4,0x64,0x08,0x81,0x46,0x80,0x31,0x2d,
+  0x6b,0xa2,0x3a,0x57,0xb0,0x51,0xae,0x1d,0x0f,0x7a,0x6f,0x0e,0x89,0x1b,0x35,0x34,0xb1,0x72,0x11,0x26,
+  0x8e,0xe3,0x0d,0x0d,0x15,0xbe,0xd7,0x87,0xe9,0x73,0x6a,0x38,0x53,0xce,0xb9,0xf6,0x24,0x90,0xa4,0x41,
+  0xe8,0x09,0x8e,0xd5,0xef,0x13,0xa0,0xa4,0xf1,0xff,0x26,0xc0,0xee,0x8c,0xb0,0x59,0xb8,0x4f,0x8a,0xf3,
+  0x10,0x55,0x0f,0x86,0x8c,0xa9,0x13,0x38,0xaa,0x9f,0x41,0x88,0x34,0x2a,0xdc,0x8b,0xf0,0x11,0x8e,0x8f,
+  0xa8,0x18,0x84,0xcf,0x2c,0x2f,0x6a,0x2b,0xc9,0xa6,0x4c,0xbc,0xc0,0x29,0x4c,0x4f,0x2c,0x4d,0x1e,0x05,
+  0xab,0xf7,0x82,0xc9,0x10,0x09,0x6c,0x48,0x89,0x97,0x27,0x16,0x0b,0x11,0xcd,0xd8,0x2f,0x7b,0x01,0xa7,
+  0x8f,0xa1,0x9b,0x63,0x49,0xc5,0x4a,0xc4,0x91,0x10,0x74,0x32,0x22,0x0d,0x88,0x81,0x33,0x84,0xf8,0x2c,
+  0x86,0xb7,0x0e,0x39,0x92,0x8f,0xc1,0x81,0x00,0x01,0x9e,0xb1,0x84,0xde,0x00,0xb2,0x02,0x5f,0x61,0x09,
+  0xd0,0x3e,0xa6,0x8f,0x53,0x24,0xc7,0xc1,0x24,0x72,0x06,0x9b,0x78,0x00,0x27,0x98,0xd5,0x2d,0x8f,0x4c,
+  0xca,0x0d,0xfe,0x03,0x5e,0x96,0x2d,0xd0,0x5a,0xe7,0x31,0x23,0x11,0x21,0x09,0x78,0x65,0x8f,0x93,0x17,
+  0xe9,0x11,0x08,0x23,0xa1,0x4a,0xa4,0x0a,0x81,0xf3,0x18,0x54,0x23,0xe2,0x59,0x28,0x70,0xa4,0x80,0x53,
+  0x77,0x62,0x60,0x03,0x20,0x40,0x2f,0xe1,0xbd,0x03,0xb2,0x8b,0xab,0xcc,0x61,0x52,0x5e,0xc3,0x3d,0x60,
+  0xed,0x58,0x1d,0x79,0x0a,0x22,0xc8,0x72,0xe0,0x34,0x9b,0x21,0x3d,0xcc,0x1b,0xcc,0x02,0x5e,0x87,0x7b,
+  0x8b,0x5e,0x81,0x51,0x60,0xc3,0x58,0x70,0x62,0xd5,0x3e,0x7f,0xfe,0x0e,0x1f,0x7c,0x07,0xba,0x3b,0x99,
+  0x91,0xf3,0x97,0x2a,0x41,0x2c,0x58,0x28,0xf8,0x77,0x1b,0x9c,0x26,0xde,0x34,0x14,0x05,0xb0,0x9d,0x80,
+  0x79,0x5e,0x4d,0xfa,0xe8,0x9a,0xcb,0xbc,0xd3,0x3a,0x0c,0xfd,0xdf,0xe2,0xca,0xd5,0x6d,0x05,0x33,0xdc,
+  0xd6,0x7a,0xeb,0x0e,0x76,0x80,0x31,0x0c,0x6c,0xbd,0xa2,0xdc,0x57,0xcf,0x87,0xf7,0xbc,0xfc,0xeb,0x5d,
+  0x5f,0x72,0x43,0xe1,0x8c,0xcb,0x83,0x36,0xd9,0x10,0xca,0x0d,0x5a,0x7d,0x41,0xe0,0xb9,0x1a,0x97,0x15,
+  0xa3,0x8c,0xd7,0x59,0x81,0x0c,0xf4,0x43,0x8a,0x63,0xfa,0xbd,0xcd,0x0e,0xf1,0x10,0x65,0x64,0x8d,0x25,
+  0x5c,0x5e,0x87,0x7b,0x3c,0x4b,0x2a,0x75,0x09,0x6a,0x3d,0xca,0x98,0xe1,0xc9,0x7b,0x09,0x9c,0xeb,0x40,
+  0xd9,0xbe,0x3d,0xa1,0x06,0xc0,0xae,0xcc,0x03,0x64,0xa4,0xf8,0x9a,0xbc,0x47,0x91,0x2b,0x58,0x03,0xca,
+  0x11,0x3e,0x9e,0xb6,0x10,0x9b,0xfb,0x2b,0x4c,0x6a,0xfc,0x06,0xc6,0x20,0x12,0x2f,0xfe,0x5a,0x8f,0x21,
+  0x09,0xca,0x19,0x38,0xf3,0x06,0x4a,0x1d,0x28,0x51,0x3f,0x8b,0x41,0x8b,0x75,0x61,0xa1,0xcd,0xcf,0x6c,
+  0xe3,0x5d,0x89,0xb6,0xf1,0xcd,0xa8,0xcc,0x0b,0x2b,0x4e,0x52,0xd0,0x36,0x80,0xb7,0xc7,0xf2,0x61,0x09,
+  0xb0,0xa0,0xbf,0xb0,0x5f,0x7f,0xfd,0xf2,0x61,0x74,0x13,0xc5,0xc9,0x70,0xbd,0x37,0x5d,0x70,0x84,0x67,
+  0xd9,0x9b,0xbc,0x48,0x29,0x0a,0xc1,0xeb,0x87,0xf9,0xd4,0xd0,0xee,0x89,0x96,0x63,0x1a,0xa7,0xcd,0x66,
+  0x41,0x9d,0x0d,0x93,0x97,0x94,0x50,0x5d,0x9b,0xd9,0x9a,0xc5,0xe2,0x16,0x1d,0xcb,0x02,0x0f,0x98,0x9b,
+  0x11,0x0f,0x82,0xc0,0x6d,0x1b,0x8a,0xb9,0xdc,0xb5,0xaf,0x04,0x3c,0xdf,0x83,0x8f,0x91,0xa1,0x0e,0x79,
+  0x9b,0x66,0xdd,0x49,0x46,0x18,0x4f,0xc6,0x1d,0x0d,0x8b,0xae,0xe2,0xd0,0xd4,0x85,0xcd,0x66,0x73,0x5b,
+  0x83,0x74,0xa7,0xbd,0x1c,0x03,0x0a,0xaf,0x92,0x01,0x8b,0x5c,0xb0,0x68,0x23,0xd0,0xf3,0x58,0x64,0xb9,
+  0xbd,0x19,0x8f,0xaa,0xe1,0xf3,0x68,0x29,0xe6,0xcb,0x1e,0xe9,0x82,0x1f,0xab,0x01,0xe1,0x25,0x5f,0xc5,
+  0xe1,0x62,0x40,0x18,0x62,0x46,0xc7,0x5d,0x4d,0x31,0x7c,0xa4,0xc0,0x51,0x8d,0x76,0xe7,0x73,0xee,0x05,
+  0x03,0xba,0x18,0x81,0x9e,0xc7,0x62,0xd6,0xed,0xad,0x40,0x57,0x8d,0x5e,0xc3,0xb6,0xb8,0xa2,0x47,0xb7,
+  0x89,0x6d,0xcf,0x63,0x9b,0xb8,0xbd,0x11,0xe9,0x1a,0x6a,0xd0,0x12,0xc6,0xc4,0xb5,0xc5,0x9f,0xf9,0x63,
+  0xcf,0xca,0xdc,0x07,0x10,0x30,0xc4,0xa1,0xe1,0x1f,0x84,0x13,0x2f,0x63,0xd1,0x10,0xb2,0x9d,0xe5,0x6a,
+  0x13,0xf4,0x08,0x55,0xa9,0x10,0x45,0x8f,0x92,0x70,0x02,0x21,0x56,0xa6,0xa7,0x41,0xe2,0xcb,0x86,0xd2,
+  0x82,0x3b,0x8b,0x75,0x68,0x52,0x82,0x90,0x02,0xd5,0xae,0x47,0x2a,0x8e,0xc3,0x28,0x72,0x4d,0x52,0xb1,
+  0x00,0xf2,0x0d,0xa9,0x60,0xe5,0x84,0x4e,0x47,0x2a,0x8c,0x77,0x56,0x21,0x32,0x54,0xd9,0x01,0x25,0x61,
+  0x07,0x7d,0x4a,0xf1,0x5a,0x38,0xda,0x06,0x04,0xb6,0x6d,0x50,0xca,0x1f,0xfb,0x82,0x5f,0x0b,0x2f,0xdc,
+  0x98,0x44,0x1c,0x20,0xb2,0x69,0xb5,0x63,0xe9,0xd9,0xee,0xa6,0x25,0x02,0xa7,0x77,0x48,0xe4,0xf7,0x29,
+  0x32,0x92,0x3c,0x7c,0x59,0x5d,0x43,0x92,0x10,0xc6,0x7c,0x09,0x25,0x43,0xb3,0xf2,0x03,0xe0,0x78,0x95,
+  0x41,0xa1,0x40,0xc1,0x4c,0x64,0x28,0xe3,0x87,0x91,0xae,0xcd,0xbc,0xb1,0x84,0xdb,0x30,0x4d,0x39,0x23,
+  0x6f,0x3f,0x95,0x4e,0xff,0x6f,0xf5,0xa9,0x10,0x7f,0xf8,0x80,0x71,0xc3,0x87,0xbf,0x9b,0xf7,0xb2,0xe3,
+  0x21,0x10,0x25,0xde,0x95,0x5e,0x15,0xc3,0x50,0x09,0x11,0x30,0x10,0x7e,0x97,0xdb,0xbb,0x0a,0x9c,0xe4,
+  0xd0,0xa6,0xe8,0x36,0xb9,0x6b,0x38,0x94,0xa1,0xf5,0x18,0x9f,0x63,0x4f,0x1a,0x6e,0x9b,0x67,0x92,0x67,
+  0x79,0x75,0x36,0x43,0x7e,0x73,0x42,0x95,0xe9,0xa2,0x79,0xf7,0x22,0x2d,0xae,0x66,0x7a,0xa5,0xc9,0x55,
+  0xee,0x0f,0xb1,0x01,0x41,0x3a,0xd8,0xa6,0x1f,0x21,0x8e,0x05,0xcf,0x99,0x88,0xb2,0x62,0x07,0xc1,0x01,
+  0xaa,0x43,0x64,0x14,0x40,0x50,0x91,0x17,0x09,0xc0,0x11,0xc0,0xc5,0x80,0xf4,0x21,0x4c,0x00,0x8b,0x59,
+  0x2a,0x94,0xe2,0x03,0xa6,0x66,0x07,0x30,0x1d,0x15,0x01,0x6e,0x8a,0xc9,0x3a,0xa8,0xce,0x78,0x45,0xf1,
+  0x43,0x98,0x83,0xb7,0x14,0xb5,0x60,0xc7,0x0c,0xe2,0x04,0x80,0xe4,0x7b,0x51,0xca,0xb0,0xe1,0x19,0x84,
+  0x6a,0x05,0x27,0x0b,0xff,0xbb,0xc5,0x20,0x22,0xca,0x81,0x14,0x62,0xf4,0xdd,0x91,0x43,0x08,0x58,0x0b,
+  0x22,0xc7,0x59,0x05,0xdb,0x94,0x02,0xaa,0xe7,0x85,0xa2,0x5d,0xe1,0xe8,0x16,0xfc,0x07,0x80,0xfe,0x81,
+  0x2b,0x10,0x19,0xc4,0x72,0xc8,0x30,0xdc,0x22,0xc7,0x48,0xa0,0xbe,0x4e,0x80,0x4b,0x30,0x27,0x02,0x0c,
+  0x27,0x91,0x4b,0xf3,0x6c,0x57,0x25,0x91,0xc0,0x90,0x07,0x06,0x24,0x92,0xfb,0xdf,0x44,0x99,0x5b,0xff,
+  0xfa,0x89,0xc4,0x5c,0x81,0x60,0x24,0xee,0x3f,0xe4,0x59,0x6e,0x25,0x91,0x8c,0xce,0x62,0x7e,0x48,0xd2,
+  0x93,0x8f,0xf7,0x08,0x56,0x6c,0x7b,0xb2,0x68,0xcb,0x9a,0xfd,0xfb,0x72,0xa1,0x10,0x51,0x3d,0xfa,0xf4,
+  0xb7,0x05,0x37,0x5f,0x5b,0xe2,0x60,0xf1,0x2e,0x27,0xa1,0xa9,0xe6,0x7a,0x2b,0x72,0x5e,0x76,0x20,0xd7,
+  0xc3,0x83,0x04,0xb4,0x07,0xb9,0xc0,0x7e,0x62,0x9e,0x82,0x54,0x44,0x9d,0xbe,0xca,0x4b,0x80,0xd6,0x9c,
+  0xf1,0xa6,0xef,0x30,0x87,0xb9,0x34,0xaf,0x96,0xf2,0xc0,0x5c,0xeb,0x31,0xa0,0x4c,0xa6,0x19,0x98,0x68,
+  0xaa,0x64,0x82,0x49,0xfb,0x77,0x9e,0x2a,0x95,0xea,0x87,0x89,0x25,0xdc,0x41,0x1f,0x18,0x3e,0x4a,0xc8,
+  0x34,0x52,0xeb,0xea,0xa0,0xd2,0xd2,0x6d,0x44,0x26,0xf3,0xe5,0x6d,0x69,0xe3,0x3b,0x85,0x96,0x70,0x63,
+  0x91,0x4a,0x0f,0xe1,0xbc,0x15,0x52,0x9a,0x05,0x44,0xbd,0xbe,0x44,0xf9,0x46,0x62,0x67,0x64,0x65,0x37,
+  0x44,0x31,0x0a,0xda,0x7a,0x25,0xe8,0x5e,0x64,0xa6,0xd9,0x32,0x6d,0x17,0x70,0xb2,0xf1,0xea,0xb1,0x44,
+  0x89,0x2a,0x72,0x98,0xca,0x2b,0xd5,0x8e,0xa0,0xae,0xb0,0x13,0x61,0x98,0xbf,0x6e,0x7b,0x0f,0x5a,0xfb,
+  0x8e,0x1c,0x1a,0xee,0xc1,0x28,0xda,0x2b,0xca,0x07,0x15,0x8f,0x51,0x7a,0x45,0xdb,0x9f,0xb9,0xa7,0xa9,
+  0xc9,0xba,0xc9,0x27,0x6b,0x2b,0xb0,0x0d,0x9b,0x2f,0x4d,0x3e,0x91,0x94,0x8a,0xf0,0x19,0xbb,0x8f,0xaf,
+  0xfb,0xb0,0xdd,0x3c,0x48,0xc1,0x57,0xe6,0x78,0x6e,0xea,0x93,0x3f,0xf3,0x9a,0x58,0x17,0x6c,0x0e,0x9e,
+  0xc9,0xfc,0x59,0x44,0x9d,0xbe,0x85,0xfb,0x3c,0x01,0xd9,0x0c,0x73,0xfe,0x6b,0x93,0x5d,0x95,0x35,0x32,
+  0xde,0x52,0x01,0x69,0x1b,0x8c,0xf1,0x00,0x04,0x78,0xac,0xc5,0xb6,0x99,0x1b,0xd0,0xbe,0xdc,0x45,0x0b,
+  0x6c,0x58,0x56,0x57,0xcd,0x16,0x99,0x54,0x40,0xa4,0xd9,0xbb,0x43,0x1e,0x75,0x5b,0x0f,0x1e,0xbc,0xde,
+  0xc1,0x64,0x9a,0xcf,0x7b,0x87,0x92,0x0e,0xea,0xba,0xa6,0x3e,0x6a,0x39,0x75,0x19,0xcd,0xe9,0x29,0xf2,
+  0x37,0x67,0xd9,0xfb,0x42,0xb0,0x64,0x2a,0x4d,0xca,0xe2,0x16,0x74,0xd2,0x03,0x9e,0x16,0x29,0x0d,0xc8,
+  0xe5,0xc5,0x18,0xb5,0x21,0x68,0xd2,0xa9,0xb5,0x20,0xa9,0x47,0x4d,0x62,0xf2,0x71,0x7a,0x7d,0xc4,0x34,
+  0x0c,0xc7,0x46,0x77,0x5c,0x95,0x0a,0x9a,0x88,0xb8,0x44,0x79,0x67,0x70,0x48,0x1f,0x66,0x9b,0xf5,0x64,
+  0x5c,0xd3,0x7c,0xca,0xab,0x81,0x9f,0xfe,0xb6,0xe1,0x44,0x4b,0xa2,0xe3,0x9f,0xae,0x12,0x62,0xa6,0xf1,
+  0xe1,0xf5,0x4a,0xd4,0xdb,0x8b,0xd9,0xf9,0x4b,0xbb,0x31,0x3e,0xeb,0x0d,0x0c,0x7b,0x61,0x2f,0xde,0x46,
+  0xcb,0xc4,0xae,0x17,0x37,0xe2,0xcd,0xc4,0x3a,0xd4,0xfa,0x7a,0x27,0xe1,0x82,0x49,0xb1,0xe7,0x92,0x47,
+  0x80,0x63,0x13,0x4c,0x9b,0xdd,0x46,0x9a,0x29,0x24,0x9b,0xad,0x57,0xea,0xe8,0x04,0xb5,0x17,0x5a,0x6d,
+  0xbc,0xad,0xe4,0x8d,0x71,0x72,0xa1,0xeb,0x47,0x5a,0x8c,0xdb,0x2f,0x48,0x11,0x34,0x6f,0xb9,0xbd,0xb3,
+  0xdd,0x26,0xac,0xc6,0xba,0x84,0xc0,0x69,0xfe,0xf2,0x9c,0x63,0x44,0x86,0xf0,0xae,0x4c,0x00,0x93,0xf9,
+  0x4d,0xfa,0x18,0x4b,0x18,0x32,0x3f,0xfb,0x1f,0x3f,0xfd,0x89,0xd1,0x90,0x3c,0x86,0xe5,0x82,0x3e,0xfd,
+  0xf3,0x28,0xb2,0x10,0xf0,0xd5,0xbf,0x60,0x36,0x96,0x30,0xa5,0xc2,0x7d,0x88,0xbf,0x08,0xfa,0x01,0x4c,
+  0xdb,0x63,0x97,0x1b,0x82,0xcc,0x91,0x13,0x00,0x96,0x41,0x84,0x18,0x9c,0x13,0x34,0x2b,0xd1,0x91,0xa1,
+  0xc4,0x2d,0xb2,0x33,0x80,0x33,0x59,0x91,0xc0,0xf6,0x12,0xb9,0x52,0xc0,0x30,0x09,0xe1,0x02,0xb0,0x1e,
+  0x2c,0x4c,0x79,0x55,0x51,0xda,0xf9,0x00,0x76,0x11,0xe0,0x1f,0x3f,0x75,0x08,0x12,0x4d,0x23,0xc0,0x40,
+  0xe2,0x56,0x02,0xbc,0x9e,0x12,0x3d,0xef,0x4f,0x52,0x5c,0xef,0xca,0xf2,0x5f,0x41,0x08,0xf3,0xc6,0x1b,
+  0xcb,0x7d,0xc6,0x5a,0xcf,0xeb,0xe8,0xac,0xa2,0x29,0xc7,0xd7,0xa7,0x14,0xf7,0xb6,0x3c,0xf0,0xd4,0x30,
+  0xb8,0x0b,0x5b,0xf7,0x8b,0xb2,0x0b,0x00,0xf7,0x4b,0xd9,0x78,0x67,0x36,0x6f,0x9d,0xcb,0x6c,0x8d,0x21,
+  0x08,0x70,0xa3,0x3c,0xb0,0x33,0xc3,0xd2,0x4a,0x3b,0x10,0x2f,0x46,0xb3,0x3b,0x60,0x75,0xea,0x24,0xe4,
+  0xa9,0x62,0xd6,0xb2,0xc1,0x28,0x63,0xc3,0x0f,0x20,0x68,0x1f,0x6c,0x3d,0xaa,0xf4,0xf7,0xa8,0xce,0x40,
+  0xfd,0x9f,0x47,0xd8,0x81,0xb7,0x96,0xde,0x6e,0xe4,0xc7,0xfa,0x09,0x49,0x9d,0xbc,0x9e,0x22,0x53,0xe0,
+  0xa0,0xe7,0xec,0xcd,0xd1,0x2d,0x48,0x25,0x4e,0x24,0x03,0xbe,0xcb,0x3e,0xb2,0xb9,0x81,0x30,0x8c,0x97,
+  0xd0,0xee,0xe9,0xfd,0x32,0xe6,0x13,0xc9,0x41,0x77,0xfc,0x25,0x96,0xfc,0x2b,0x84,0x15,0x20,0x6a,0x99,
+  0x2e,0xa3,0xed,0x3e,0x8f,0xb5,0xba,0x04,0x3c,0xda,0x89,0xf7,0xa4,0xd2,0xde,0x88,0x95,0x65,0xa6,0xed,
+  0x66,0xa0,0x27,0x79,0xfd,0x05,0xeb,0x36,0x7b,0xc1,0xd3,0x7a,0x0f,0x07,0x27,0x4d,0x2b,0xac,0xd0,0xfc,
+  0x84,0xe9,0xf6,0x3f,0xf3,0x8c,0xef,0xe0,0x74,0xe2,0x2a,0xb0,0xba,0x63,0xc9,0x51,0x18,0x6e,0x1a,0xa8,
+  0x03,0xdb,0x1f,0x47,0x0f,0xc4,0x1d,0xc6,0x53,0xa3,0x67,0x02,0x9e,0xe0,0xf6,0xaa,0x8a,0xff,0x20,0x02,
+  0x95,0xc1,0x2a,0x4e,0x66,0x21,0x4b,0xfa,0x8c,0x3a,0x1c,0xef,0xd1,0x57,0x07,0x0b,0xee,0x5e,0x38,0x72,
+  0x1a,0x18,0x6f,0xe4,0x3a,0xc8,0x58,0x4b,0xd9,0x99,0x4c,0xad,0x24,0x53,0xea,0x5e,0x57,0x86,0xeb,0x2c,
+  0x78,0xd3,0x08,0x8c,0x39,0x84,0x41,0x1d,0x4e,0x5f,0x4e,0x5c,0x8a,0x6a,0x6f,0x24,0x61,0x1d,0x8f,0xcf,
+  0x01,0x08,0x74,0x43,0x30,0x07,0xa4,0xa3,0x82,0xcd,0x6a,0xee,0x78,0xda,0x73,0x90,0x60,0x6a,0xe6,0x71,
+  0xa3,0xd0,0xf5,0x5c,0x7d,0xc8,0x31,0x7b,0x84,0xa9,0x0d,0xcf,0x76,0xef,0x05,0x2b,0x77,0x6d,0xeb,0x74,
+  0x8e,0x01,0x2a,0xe5,0xb9,0xb7,0x56,0xb5,0x54,0xb5,0x2e,0xf5,0x16,0xac,0xe0,0xee,0x8f,0x07,0x11,0x25,
+  0xfc,0xa1,0x6b,0x01,0x5d,0xac,0x01,0x2c,0x4e,0xf0,0x7d,0xac,0x33,0x96,0x04,0x55,0xd9,0x3e,0x2f,0x93,
+  0xdf,0xb0,0x5f,0x34,0x65,0xb2,0x33,0x97,0xc5,0x65,0x7e,0x00,0x93,0x7b,0xc2,0xec,0x0a,0x06,0xfc,0xb4,
+  0x25,0xa8,0x54,0xb2,0xcc,0x76,0x6e,0x2a,0xe3,0xd6,0x8b,0x2a,0x98,0xc3,0x5c,0x44,0xf2,0x3f,0xe9,0xa4,
+  0x29,0x87,0x82,0x27,0xd6,0x67,0xae,0xaa,0x0c,0x62,0xf2,0x40,0x16,0x01,0x51,0x5d,0xab,0x9a,0xca,0x91,
+  0x31,0x9b,0x4b,0xb2,0x9a,0xfd,0xb9,0xd1,0x42,0xa6,0x8f,0xbd,0x60,0x1e,0x1c,0x30,0x0f,0x96,0xd3,0xf0,
+  0x44,0x07,0x83,0xda,0x7e,0x7c,0x26,0x43,0x4e,0xf2,0x74,0x3c,0x80,0x55,0x30,0x59,0x7e,0xfe,0x28,0x8b,
+  0xc3,0x8a,0x95,0xb6,0x09,0xe1,0x22,0x27,0x5d,0x21,0xa0,0x19,0x2e,0xe9,0x4c,0x8d,0x72,0xf5,0xd5,0x85,
+  0x10,0x09,0x6f,0x48,0x82,0x0a,0xd4,0xd3,0x61,0xc9,0xda,0x08,0xdd,0xd9,0x9b,0x6b,0x74,0xc3,0x9a,0xa5,
+  0x9a,0xf3,0xb3,0x8b,0x7e,0xee,0xb0,0xe8,0x07,0xec,0x98,0x35,0x2b,0xca,0x43,0x35,0x8b,0xbb,0x50,0x86,
+  0xb9,0x28,0x9d,0x66,0xdf,0x3e,0x1d,0x30,0x1d,0xa5,0x86,0xfb,0xec,0x20,0x44,0x2d,0xeb,0xca,0x75,0x7e,
+  0x0c,0xf7,0x0c,0x8c,0xd2,0x0e,0xee,0x00,0x2b,0xc9,0xe1,0x78,0x50,0x5b,0xd7,0x04,0xaa,0xbd,0x42,0x4b,
+  0x2f,0x56,0xa2,0xd2,0x8b,0x9c,0xe4,0x2f,0x22,0x3a,0x22,0x46,0x51,0xa5,0x68,0x95,0x81,0x41,0x14,0x53,
+  0xca,0x27,0x8d,0x0b,0x55,0x47,0x03,0x1f,0xca,0xa9,0x9a,0x0e,0x57,0xe5,0x67,0x88,0xb2,0x6d,0xe4,0x20,
+  0xdb,0x85,0x50,0xe1,0x8e,0xc9,0x7e,0x66,0xcc,0x69,0x65,0xfc,0x29,0xd9,0x71,0x39,0x21,0xc0,0x99,0x8a,
+  0x35,0xc0,0x0e,0x0c,0x11,0xc2,0xbb,0xde,0x4c,0x4d,0x37,0xf6,0x48,0x21,0xd0,0x6e,0xab,0x80,0x8e,0x3d,
+  0xcc,0x60,0x06,0xbb,0x89,0xb9,0x72,0xbb,0x61,0xe9,0xdf,0x7e,0xfe,0x91,0x51,0xdb,0xa0,0x4c,0x52,0x82,
+  0x78,0x0b,0x65,0x0c,0xd0,0xbe,0xb0,0xe6,0x7c,0x33,0x82,0x85,0x25,0x9e,0x34,0x60,0x4a,0x88,0xac,0x39,
+  0x22,0xe3,0xed,0x87,0x6f,0xeb,0xa2,0x69,0x78,0xf8,0x05,0x22,0x05,0xea,0x40,0x08,0x78,0x09,0x27,0x93,
+  0x3e,0x19,0x48,0x01,0xad,0xe1,0xb6,0x83,0x9c,0x3a,0x6b,0x21,0xa7,0x6c,0x1b,0xb5,0x87,0x71,0xef,0x00,
+  0x40,0x68,0xc3,0x8d,0x16,0x66,0xd5,0xa4,0x2c,0x73,0x08,0x9a,0x7d,0x6c,0xcf,0xd6,0xca,0x5b,0xa3,0x7d,
+  0x1c,0x6d,0x9f,0x5f,0x61,0x0a,0xed,0x55,0x7a,0x60,0xcb,0xb2,0x40,0x75,0xaa,0x02,0x34,0x33,0x01,0xb1,
+  0x41,0x2c,0xc7,0xc0,0xd3,0x09,0x5c,0x47,0x91,0x64,0x19,0xe6,0x2e,0xd3,0x9c,0x23,0x9b,0x53,0x74,0x83,
+  0x21,0x0a,0xe1,0x34,0x45,0x4b,0x9a,0x29,0x4d,0x43,0x0a,0xb0,0x30,0xdc,0x0b,0x51,0x80,0xd8,0x13,0xb0,
+  0xb6,0x08,0x72,0xbf,0xff,0xf4,0xc9,0xca,0x33,0x90,0xc3,0xff,0xfe,0xf7,0xff,0xb0,0x2c,0x67,0x00,0xe6,
+  0x77,0xa2,0x9a,0xe2,0xaf,0x20,0x4d,0x51,0x66,0xa0,0x8a,0x00,0x88,0x45,0x5d,0xb1,0x87,0x3f,0x7d,0xfa,
+  0x79,0xee,0x82,0x23,0xe7,0xd5,0x5e,0xb5,0x35,0xa8,0xd9,0xc7,0x01,0x8a,0x82,0x3c,0x1a,0x72,0x84,0x5f,
+  0x07,0xdd,0x05,0x2a,0xd0,0xc3,0xea,0x98,0xfc,0x99,0xcd,0xf5,0x2a,0x31,0xca,0x55,0x3a,0x1a,0x1d,0x40,
+  0xf6,0xd0,0xcc,0x12,0x82,0x2a,0x0e,0xe7,0x52,0x26,0xab,0xe2,0x03,0xb2,0xc5,0x66,0xab,0x8a,0xc9,0xde,
+  0x36,0xb0,0xff,0x31,0x1c,0xdb,0x9a,0xbe,0x6e,0xe9,0x63,0xd4,0x99,0xb3,0xec,0x12,0xda,0xa5,0xf4,0xdb,
+  0xb8,0xa7,0x7f,0x7c,0x14,0xa7,0xb8,0x04,0xcb,0x5d,0x31,0x49,0x10,0xac,0xcc,0xb9,0x0b,0x73,0xcb,0x1c,
+  0x2b,0x6a,0x0f,0x73,0x0f,0x9b,0xe5,0x26,0xaf,0x32,0x45,0x84,0x05,0x78,0xb5,0x0f,0x5d,0x92,0x68,0xd3,
+  0xa6,0x39,0xca,0x7c,0x07,0xbe,0xbd,0xea,0xc6,0x52,0x2d,0xe7,0x52,0xa0,0x6d,0x04,0xbf,0x9e,0x0a,0xb4,
+  0xbb,0x77,0x45,0x59,0x5e,0x7b,0xb9,0x0b,0x50,0xbb,0x57,0xef,0xee,0x8f,0x89,0x32,0xf2,0xb3,0xea,0x62,
+  0x21,0xc9,0xc8,0x7e,0x5c,0x2f,0x2b,0x39,0xd8,0x39,0x6e,0x10,0x95,0x09,0xc0,0xb1,0xb4,0x88,0x51,0x16,
+  0x1b,0xa9,0x9b,0xf5,0x08,0xc9,0xe5,0x8d,0xa4,0x43,0x7a,0xd5,0xe8,0xcb,0x81,0xb9,0x63,0xf7,0x99,0x6b,
+  0x36,0xa0,0x47,0x78,0x11,0x7b,0xd1,0xaa,0x25,0x3c,0x9f,0x2f,0xdd,0x65,0xaf,0x6e,0x29,0xe2,0x65,0x0c,
+  0x21,0xd1,0xdd,0xac,0x3d,0x5b,0xb2,0x27,0xf7,0x8a,0x31,0x1e,0xc2,0xf1,0xb6,0x22,0x7a,0x35,0x69,0x2d,
+  0xd6,0xb1,0x17,0x63,0x9a,0xa8,0x37,0x15,0x9b,0x45,0xc5,0x97,0x6a,0xd0,0xb5,0x8d,0x0c,0x27,0x65,0x48,
+  0x9b,0x10,0xca,0x55,0xe9,0xff,0xfe,0xec,0xbd,0x56,0xf7,0x1b,0x19,0xef,0x7e,0x85,0x77,0x6c,0x2d,0x87,
+  0x6a,0x77,0xbd,0xd0,0xe4,0x8e,0x15,0x9a,0x9a,0xf6,0x47,0xf1,0x7c,0xd6,0x0f,0x3c,0xd9,0x24,0xe6,0xcc,
+  0x3c,0x99,0x02,0xb4,0xf0,0xb3,0x24,0xa7,0x77,0x86,0x69,0xcc,0xd9,0xfe,0x6a,0x78,0x6a,0xb0,0x49,0xf4,
+  0x1e,0x94,0x60,0xee,0x2d,0xfb,0x8a,0x19,0x08,0xef,0x75,0x85,0xef,0x98,0xb7,0x45,0xec,0xbd,0x62,0x2c,
+  0xa7,0xd3,0xa2,0x74,0x0a,0x72,0x88,0x56,0xd7,0x8a,0xf2,0xfa,0xad,0xd2,0xc2,0x3d,0x59,0x9a,0x5b,0xb2,
+  0xf2,0x2e,0x35,0x36,0x28,0xda,0xbe,0x1f,0x08,0xb0,0x43,0xe2,0xdc,0x6c,0xf3,0xd7,0x5f,0x2b,0x7b,0xbb,
+  0xee,0x9a,0x97,0x86,0x0d,0x16,0x68,0x28,0xf5,0xa5,0xa8,0x23,0x4f,0x65,0x1b,0x95,0x40,0x6e,0x66,0x98,
+  0x85,0xd6,0xb1,0x88,0x40,0xc0,0xa0,0xd0,0xcd,0x64,0xfa,0xab,0x8b,0x78,0x13,0x44,0x9e,0xf9,0x02,0x7d,
+  0x88,0x38,0x36,0xb8,0xed,0xb7,0xd7,0x06,0xc3,0x09,0xbf,0x30,0xb6,0x6b,0x29,0xf9,0xe1,0x98,0xa6,0x96,
+  0x84,0x02,0x8d,0x83,0x23,0xb0,0x00,0x52,0x25,0x87,0x85,0xad,0x76,0x19,0x8b,0x8e,0x25,0x3e,0x28,0xc0,
+  0x73,0xe9,0x58,0xe7,0x5b,0x19,0x7e,0x83,0xe4,0x0e,0x89,0xfa,0x24,0x25,0x3e,0x90,0x7d,0xb6,0x14,0x8d,
+  0x0e,0xe3,0xc4,0xc9,0x8b,0x88,0xb6,0x64,0x27,0x7d,0x7b,0xa4,0x1d,0x09,0xbf,0x86,0xdb,0xc0,0x8f,0x87,
+  0xf6,0x74,0x6b,0x14,0xb0,0xc6,0x43,0xcc,0x0b,0xf1,0x65,0x03,0x9f,0x20,0x86,0xc4,0xb2,0x7e,0x8f,0x9f,
+  0x19,0xae,0xa7,0xdf,0xae,0xd6,0x8c,0x01,0x55,0x7b,0x6f,0x23,0x69,0xaf,0x1d,0xb9,0x4b,0x19,0xa0,0xbd,
+  0x72,0x55,0xcb,0x7d,0x3f,0xbf,0xfc,0xbe,0x2f,0xc7,0x16,0xa4,0x63,0xda,0x81,0x22,0x5b,0x38,0x5f,0x34,
+  0x8e,0xc8,0x9e,0xe2,0x9f,0x99,0xe3,0x4d,0xba,0x90,0xf1,0x42,0x71,0xde,0x95,0xa5,0x16,0x6d,0xbd,0xac,
+  0x05,0x18,0xaa,0x33,0xaf,0xc3,0x12,0x6e,0x8b,0x25,0x14,0x5c,0x9a,0xeb,0x8d,0x7a,0xbd,0xaf,0x47,0x1a,
+  0x08,0xf5,0x33,0x40,0xcf,0xa4,0xa2,0xe0,0xb2,0xd3,0x13,0x9f,0xd1,0xe6,0x33,0xd9,0xcb,0x45,0x5d,0xad,
+  0x0f,0x84,0x04,0x27,0x10,0xd6,0xa1,0xef,0x48,0x42,0x6a,0x0f,0x7d,0x88,0x44,0xf5,0x08,0x86,0x68,0xa2,
+  0x61,0xa9,0xef,0x55,0xa8,0x1a,0xa6,0x00,0x33,0x64,0x12,0x51,0x11,0xe3,0xe5,0x96,0xa9,0x17,0x48,0x63,
+  0x4b,0x8c,0x6c,0x03,0x81,0x20,0x17,0x2b,0xc5,0x94,0x71,0x4c,0x2a,0x42,0x51,0x14,0xe2,0xaa,0xad,0x69,
+  0x3a,0xca,0x00,0xa0,0x84,0x0f,0x2b,0x14,0xe5,0xb7,0x4c,0x64,0x4f,0x0f,0x15,0x8f,0x85,0xc5,0x4b,0xc1,
+  0x2d,0xd2,0x51,0x35,0x6c,0x82,0x26,0xa1,0xe6,0x01,0xcc,0xd6,0x57,0x65,0x6a,0x0a,0xb7,0xb7,0x12,0xd0,
+  0x60,0xa2,0x99,0xc8,0x76,0xf8,0x1d,0x7c,0xe7,0xdb,0x13,0x6f,0x0b,0x19,0xce,0x8d,0x35,0x11,0x18,0xdf,
+  0xa6,0xc8,0x72,0xd6,0x45,0xc5,0xd1,0xb4,0xc4,0xba,0xf8,0xe1,0xaf,0xad,0x7f,0x71,0xd7,0x88,0xe3,0x8a,
+  0x08,0x5a,0x09,0x30,0xfe,0x99,0xc7,0xe3,0x46,0xf6,0xd5,0xfc,0x50,0x65,0xa9,0x97,0xc2,0xb0,0x58,0xbe,
+  0xb8,0x91,0x47,0x93,0xcd,0xec,0x23,0x69,0x21,0x4d,0x64,0xdd,0x97,0x12,0x7a,0xf2,0xff,0x42,0x11,0xb6,
+  0x59,0x2d,0xd3,0x33,0xb4,0xfd,0x9e,0x55,0x6d,0xdc,0xdf,0x30,0xef,0x6e,0x29,0xf4,0xfc,0x87,0x0f,0x68,
+  0x25,0x3f,0xfc,0x7d,0xfc,0xa3,0xe1,0x01,0xe6,0xbe,0xd1,0x93,0xba,0x71,0x00,0x07,0xae,0xa6,0xeb,0xf9,
+  0x74,0x66,0x63,0x65,0x49,0xc5,0x37,0x54,0x7e,0x92,0x45,0x28,0x88,0x6d,0x1a,0x3e,0x54,0x55,0x6a,0x58,
+  0x98,0xbe,0x46,0xd5,0x9b,0xa8,0x08,0xe8,0x87,0x14,0xbf,0x65,0x03,0x61,0x64,0x11,0xb0,0xd2,0x06,0xd0,
+  0xe8,0x04,0x24,0xd7,0x0c,0xa3,0x98,0x19,0xfb,0x24,0xab,0x81,0xd4,0x80,0x5e,0x89,0xf2,0x09,0xce,0x22,
+  0xf6,0x75,0xab,0x25,0x80,0x33,0x28,0x63,0xc0,0x43,0x95,0x0a,0x5f,0xd4,0x37,0x8f,0xe0,0x9a,0xf1,0x33,
+  0xc1,0x9e,0x2f,0xa7,0x79,0x7f,0x56,0x2f,0xaa,0x1c,0x13,0xe6,0x75,0xb0,0x99,0x1d,0x4f,0xba,0xc8,0x28,
+  0xa3,0x84,0xbf,0x92,0xeb,0xa1,0x08,0xf6,0x41,0x52,0x80,0x69,0x21,0xa6,0x07,0xeb,0x81,0x63,0x00,0x8c,
+  0x60,0x86,0x4b,0x16,0x2f,0x70,0xdc,0xd8,0x52,0x2a,0x08,0xa9,0x7e,0xca,0x6b,0xa4,0x42,0x4e,0x97,0x96,
+  0xd6,0x19,0x14,0x90,0x22,0x99,0x26,0xf0,0x77,0xaa,0x58,0x41,0xea,0xaf,0xd6,0x41,0x11,0x7a,0x53,0xde,
+  0x6e,0x40,0xa9,0x37,0x02,0x4a,0x3f,0xef,0xd3,0xb2,0x41,0x0a,0xd4,0xfc,0x42,0xf6,0x52,0x73,0xee,0x6b,
+  0x8f,0xb3,0x61,0x2e,0x5e,0xe5,0x97,0x79,0x70,0x4c,0x61,0x6d,0x10,0xd3,0x8b,0x92,0xa7,0x15,0xe6,0x2c,
+  0xf0,0xf3,0x01,0x60,0xbb,0xfa,0xf8,0x94,0xa7,0x35,0x48,0xf7,0x23,0x06,0xd7,0x1f,0xf1,0x63,0x0e,0xb4,
+  0xb7,0x51,0x9e,0x7d,0x5d,0xb3,0x7f,0x24,0xd8,0xc6,0x82,0x7d,0x42,0xf4,0x19,0x02,0xc1,0x15,0x55,0x96,
+  0x01,0x52,0xd3,0x7e,0x4c,0x3e,0x35,0xba,0xe8,0xa6,0x66,0x03,0xdc,0xb4,0xd7,0xbc,0x46,0x07,0x56,0x95,
+  0xac,0x2c,0x62,0x2c,0x09,0xfd,0x5a,0x32,0x8a,0xd7,0xd5,0x95,0x70,0x9e,0xf2,0x01,0x3d,0xab,0x2c,0x1d,
+  0xc9,0xb6,0xa7,0x63,0xba,0xdd,0xd4,0xaf,0x9b,0x4f,0xae,0x2f,0xef,0x07,0x18,0x25,0x33,0x53,0x60,0x7e,
+  0x68,0xcf,0x9a,0x6c,0x61,0x6b,0x1b,0x7b,0xe6,0x10,0x3c,0x5a,0x57,0x3e,0xd1,0xb2,0x57,0xeb,0x91,0xd8,
+  0x80,0xa6,0xbb,0xce,0xe9,0xa8,0x05,0x33,0x18,0x18,0x37,0x43,0x03,0x8b,0xa3,0x1b,0x40,0x63,0x8a,0x0b,
+  0xdd,0xeb,0x2a,0x43,0xdc,0xf3,0x17,0xb6,0x9e,0x6e,0x29,0x4a,0x11,0x83,0xe3,0xb7,0x64,0x86,0x2d,0xb2,
+  0x0e,0xb9,0x94,0x00,0x5d,0xd2,0x6e,0x8d,0xfe,0x5f,0x22,0x50,0x8c,0xb4,0x82,0x06,0x83,0x74,0x01,0x87,
+  0x34,0x0f,0x4d,0x56,0xd4,0x0c,0x46,0xda,0x67,0x5d,0xff,0xfd,0x74,0xac,0x42,0x49,0x67,0x41,0xeb,0x78,
+  0x90,0xef,0xbd,0xde,0xfd,0x1f,0xd5,0x37,0xdd,0xf7,0x50,0x44,0x00,0x00,
+};
+
+// web/portal.js: 21232 bytes, 7266 gzipped
+static const char PORTAL_JS_VER[] = "96931ed3107a95aa";
+static const char PORTAL_JS_ETAG[] = "\"96931ed3107a95aa\"";
+static const char PORTAL_JS[] PROGMEM = R"FMASSET(// Full-screen loading overlay for page navigations + (non-async) form submits.
+// Makes the ESP32's page-render/transfer gap feel responsive instead of relying
+// on the browser's tiny built-in spinner. Async forms manage their own UI.
+(function(){
+  function ov(){ return document.getElementById('fm-load'); }
+  function show(msg){ var o=ov(); if(!o) return; var m=document.getElementById('fm-load-msg');
+    if(m && msg) m.textContent=msg; o.classList.add('show'); }
+  function hide(){ var o=ov(); if(o) o.classList.remove('show'); }
+  window.fmShowLoading=show; window.fmHideLoading=hide;
+  document.addEventListener('click', function(e){
+    var t=e.target; while(t && t.nodeType!==1) t=t.parentNode;
+    var a = (t && t.closest) ? t.closest('a') : null;
+    if(!a) return;
+    if(a.target==='_blank' || a.hasAttribute('download')) return;
+    if(e.metaKey||e.ctrlKey||e.shiftKey||e.button) return;
+    var href=a.getAttribute('href')||'';
+    if(!href || href.charAt(0)==='#' || href.lastIndexOf('javascript:',0)===0) return;
+    show('Loading…');
+  }, true);
+  document.addEventListener('submit', function(e){
+    var f=e.target;
+    if(f && f.classList && f.classList.contains('async-form')) return;  // handles own UI
+    show('Working…');
+  }, true);
+  window.addEventListener('pageshow', hide);   // incl. bfcache back/forward
+  document.addEventListener('DOMContentLoaded', hide);
+})();
+
+// Status messages: kind = 'ok' | 'warn' | 'err' | 'progress'. ARIA-live region.
+// Transient (ok/progress) auto-clear; errors persist until replaced.
+function showUiStatus(message, kind){
+  var box = document.getElementById('ui-status');
+  if (!box) return;
+  box.className = 'help s-' + (kind || 'ok');
+  box.style.display = 'block';
+  box.setAttribute('role','status');
+  box.textContent = message;
+  if (box._t){ clearTimeout(box._t); box._t = null; }
+  if (kind === 'ok' || kind === 'progress'){
+    box._t = setTimeout(function(){ box.style.display = 'none'; }, 4000);
+  }
+}
+
+function asFormBody(form){
+  var data = new FormData(form);
+  data.append('ajax', '1');
+  return new URLSearchParams(data);
+}
+
+// AbortController may be absent in very old captive-portal webviews — guard it
+// so polling/fetch still works (just without a hard timeout) on those.
+function fmAbort(){ return (typeof AbortController !== 'undefined') ? new AbortController() : null; }
+
+// Restrained connection indicator.
+function setConnection(state){
+  var el = document.getElementById('conn-status');
+  if (!el) return;
+  el.className = 'conn-dot' + (state==='updating' ? ' c-updating'
+                            : state==='warn' ? ' c-warn'
+                            : state==='err' ? ' c-err' : '');
+  el.textContent = state==='updating' ? 'Updating…'
+                 : state==='warn' ? 'Connection interrupted'
+                 : state==='err' ? 'Reconnecting…' : 'Connected';
+}
+
+// --- Async button loading states (contextual labels + inline spinner) ---
+function btnLabelFor(form, btn){
+  if (btn && btn.getAttribute('data-loading-label')) return btn.getAttribute('data-loading-label');
+  var a = (form && form.getAttribute('action')) || '';
+  if (a.indexOf('find-stations')>=0 || a.indexOf('discover')>=0) return 'Searching…';
+  if (a.indexOf('save')>=0 || a.indexOf('transmission')>=0) return 'Saving…';
+  if (a.indexOf('recording-interval')>=0 || a.indexOf('wake-interval')>=0) return 'Applying…';
+  if (a.indexOf('sync')>=0) return 'Updating…';
+  if (a.indexOf('manual-upload')>=0) return 'Uploading…';
+  if (a.indexOf('start')>=0 || a.indexOf('shutdown')>=0) return 'Starting…';
+  if (a.indexOf('set-time')>=0) return 'Setting time…';
+  return 'Working…';
+}
+function setBtnLoading(btn, label){
+  if (!btn) return;
+  if (btn._orig == null) btn._orig = (btn.tagName==='INPUT') ? btn.value : btn.innerHTML;
+  btn.disabled = true;
+  btn.setAttribute('aria-busy','true');
+  btn.classList.add('is-loading');
+  if (btn.tagName==='INPUT') btn.value = label || 'Working…';
+  else btn.innerHTML = '<span class="spinner" aria-hidden="true"></span>' + (label || 'Working…');
+}
+function clearBtnLoading(btn){
+  if (!btn) return;
+  btn.disabled = false;
+  btn.removeAttribute('aria-busy');
+  btn.classList.remove('is-loading','is-ok','is-err');
+  if (btn._orig != null){
+    if (btn.tagName==='INPUT') btn.value = btn._orig; else btn.innerHTML = btn._orig;
+    btn._orig = null;
+  }
+}
+function flashBtn(btn, ok){
+  if (!btn) return;
+  btn.classList.remove('is-loading');
+  btn.classList.add(ok ? 'is-ok' : 'is-err');
+}
+
+// --- Node cards: incremental, XSS-safe (textContent for device strings) ---
+function chipState(state, paused, pending, desiredTarget, ended, reportedPaused, deployUnconfirmed){
+  if (pending && Number(desiredTarget)===0) return ['chip chip--state-unpaired','Remove queued'];
+  // Ended outranks paused, matching the server-rendered chips. End queues
+  // STANDBY and keeps the node DEPLOYED, so every test below would otherwise
+  // call an archived deployment "Paused".
+  if (ended) return ['chip chip--bat-low','Ended'];
+  // An unconfirmed deploy outranks every queued-config label below it: the node
+  // has never acknowledged the deploy, so it is not hearing us at all and
+  // "Pause queued" / "Update queued" would imply a link that does not exist.
+  if (state==='DEPLOYED' && deployUnconfirmed) return ['chip chip--bat-low','Not confirmed'];
+  if (state==='DEPLOYED' && pending && Number(desiredTarget)===3) return ['chip chip--state-paused','Pause queued'];
+  // Only a node that is actually paused is resuming. A settings change leaves a
+  // pending desired config at targetState 2 as well, and calling that "Resume
+  // queued" reports a recovery from a pause that never happened.
+  if (state==='DEPLOYED' && pending && Number(desiredTarget)===2)
+    return reportedPaused ? ['chip chip--state-deployed','Resume queued']
+                          : ['chip chip--state-deployed','Update queued'];
+  if (state==='DEPLOYED') return paused ? ['chip chip--state-paused','Paused']
+                                        : ['chip chip--state-deployed','Active'];
+  if (state==='PAIRED')   return ['chip chip--state-paired','Connected'];
+  return ['chip chip--state-unpaired','New'];
+}
+function chipBatt(v){
+  if (v===null || v===undefined) return ['chip','n/a'];
+  var c = v>=3.9 ? 'chip chip--bat-ok' : v>=3.5 ? 'chip chip--bat-med' : 'chip chip--bat-low';
+  return [c, v.toFixed(2)+'V'];
+}
+function lastSeenTxt(sec){
+  if (sec===null || sec===undefined || sec<0) return 'n/a';
+  return Math.floor(sec/60) + ' min ago';
+}
+function nodeCell(parentClass, labelText, fieldName){
+  var d=document.createElement('div'); d.className=parentClass;
+  var l=document.createElement('span'); l.className='node-timing-label'; l.textContent=labelText;
+  var v=document.createElement('span'); v.setAttribute('data-f', fieldName);
+  d.appendChild(l); d.appendChild(v); return d;
+}
+function applyNodeFields(card, n){
+  if (card && card.dataset){ card.dataset.state=n.state||''; card.dataset.paused=n.paused?'1':'0'; }
+  var st=chipState(n.state, n.paused, n.pending, n.desiredTarget, n.deploymentEnded, n.reportedPaused, n.deployUnconfirmed), s=card.querySelector('[data-f="status"]');
+  if (s){ s.className=st[0]; s.textContent=st[1]; }
+  var bt=chipBatt(n.batV), b=card.querySelector('[data-f="batt"]');
+  if (b){ b.className=bt[0]; b.textContent=bt[1]; }
+  var r=card.querySelector('[data-f="rec"]'); if (r){ r.className='chip node-timing-value'; r.textContent=(n.recMin||0)+' min'; }
+  var ls=card.querySelector('[data-f="lastseen"]'); if (ls){ ls.className='chip node-timing-value'; ls.textContent=lastSeenTxt(n.lastSeenSec); }
+  var lbl=card.querySelector('[data-f="label"]'); if (lbl) lbl.textContent = n.label || n.id;
+}
+function nodeCardEl(n){
+  var wrap=document.createElement('div'); wrap.className='node-select-wrap node-new';
+  wrap.setAttribute('data-node-id', n.id);
+  var pick=document.createElement('label'); pick.className='node-select-control'; pick.title='Select node';
+  var cb=document.createElement('input'); cb.type='checkbox'; cb.name='node_id'; cb.value=n.id;
+  cb.className='node-select'; cb.setAttribute('form','batch-node-actions'); cb.setAttribute('aria-label','Select '+(n.label||n.id));
+  cb.addEventListener('change',function(){ if(window.updateBatchSelection) window.updateBatchSelection(cb); });
+  pick.appendChild(cb); wrap.appendChild(pick);
+  var a=document.createElement('a');
+  a.className='item item--node';
+  a.href='/station?id=' + encodeURIComponent(n.id);
+  var row=document.createElement('div'); row.className='node-row';
+  var main=document.createElement('div'); main.className='node-main';
+  var strong=document.createElement('strong'); strong.setAttribute('data-f','label'); main.appendChild(strong);
+  var status=document.createElement('div'); status.className='node-status';
+  status.appendChild(nodeCell('node-status-cell','Status','status'));
+  status.appendChild(nodeCell('node-status-cell','Battery','batt'));
+  var timing=document.createElement('div'); timing.className='node-timing';
+  timing.appendChild(nodeCell('node-timing-cell','Recording','rec'));
+  timing.appendChild(nodeCell('node-timing-cell','Last seen','lastseen'));
+  row.appendChild(main); row.appendChild(status); row.appendChild(timing);
+  a.appendChild(row); wrap.appendChild(a); applyNodeFields(wrap, n); return wrap;
+}
+function findCard(list, id){
+  var k=list.children;
+  for (var i=0;i<k.length;i++){ if (k[i].getAttribute && k[i].getAttribute('data-node-id')===id) return k[i]; }
+  return null;
+}
+// Update existing cards in place; append new ones (highlighted). We do NOT
+// remove cards that drop out of a poll — a node going briefly silent should not
+// make its card vanish; explicit unpair reloads the page.
+function reconcileNodes(nodes){
+  var list=document.getElementById('node-list');
+  if (!list || !nodes) return;
+  for (var i=0;i<nodes.length;i++){
+    var n=nodes[i], card=findCard(list, n.id);
+    if (!card) list.appendChild(nodeCardEl(n));
+    else applyNodeFields(card, n);
+  }
+  var empty=document.getElementById('node-empty');
+  if (empty) empty.style.display = nodes.length ? 'none' : '';
+}
+function updateKpis(f){
+  var set=function(id,v){ var e=document.getElementById(id); if (e && v!=null) e.textContent=String(v); };
+  set('kpi-deployed-num', f.active);
+  set('kpi-unpaired-num', f.new);
+}
+function setText(id,v){ var e=document.getElementById(id); if (e) e.textContent=v; }
+
+// --- Live poller: one timer, visibility-aware, failure backoff, no overlap ---
+// Polls the RAM-only /api/live endpoint. Cadence adapts: fast during discovery
+// or just after an action, slow when idle, paused when the tab is hidden. This
+// keeps steady-state load on the ESP32 low.
+var FM = {
+  timer:null, inFlight:false, fails:0, lastVersion:-1, discActive:false, fastUntil:0, started:false,
+  IDLE:4000, FAST:650, BUSY_WINDOW:4000,
+  start:function(){
+    if (this.started) return;
+    // Only poll on pages that actually display live data — keeps idle load off
+    // the ESP32 on static form-result pages.
+    if (!document.getElementById('conn-status') && !document.getElementById('node-list') &&
+        !document.getElementById('discovery-panel') && !document.getElementById('kpi-deployed-num')) return;
+    this.started=true;
+    document.addEventListener('visibilitychange', function(){
+      if (document.hidden) FM.clear(); else FM.bump();
+    });
+    this.tick();
+  },
+  clear:function(){ if (this.timer){ clearTimeout(this.timer); this.timer=null; } },
+  delay:function(){
+    if (document.hidden) return 0;
+    if (this.fails>0) return Math.min(8000, 1000*Math.pow(2, this.fails-1));
+    return (this.discActive || Date.now()<this.fastUntil) ? this.FAST : this.IDLE;
+  },
+  schedule:function(){ this.clear(); var d=this.delay(); if (d>0) this.timer=setTimeout(function(){FM.tick();}, d); },
+  bump:function(){ this.fastUntil=Date.now()+this.BUSY_WINDOW; this.clear(); this.tick(); },
+  startDiscoveryUi:function(){ this.discActive=true; var p=document.getElementById('discovery-panel'); if(p) p.hidden=false; this.bump(); },
+  tick:function(){
+    if (this.inFlight || document.hidden){ this.schedule(); return; }
+    this.inFlight=true;
+    if (this.fails===0) setConnection('updating');
+    var ctrl=fmAbort(); var to=ctrl?setTimeout(function(){ctrl.abort();},4000):null;
+    fetch('/api/live', {cache:'no-store', signal:ctrl?ctrl.signal:undefined})
+      .then(function(r){ if(!r.ok) throw new Error('HTTP '+r.status); return r.json(); })
+      .then(function(d){ if(to)clearTimeout(to); FM.fails=0; setConnection('ok'); FM.apply(d); })
+      .catch(function(_){ if(to)clearTimeout(to); FM.fails++; setConnection(FM.fails>2?'err':'warn'); })
+      .then(function(){ FM.inFlight=false; FM.schedule(); });
+  },
+  apply:function(d){
+    var disc = d.discovery || {};
+    if (disc.active){
+      this.discActive=true;
+      var p=document.getElementById('discovery-panel'); if(p){ p.hidden=false; if(p._h){clearTimeout(p._h);p._h=null;} }
+      setText('dp-state','Searching');
+      setText('dp-elapsed', Math.floor((disc.elapsedMs||0)/1000)+'s');
+      setText('dp-found', String(disc.foundThisScan||0));
+      var fb=document.getElementById('find-btn');
+      if (fb && !fb.classList.contains('is-loading')) setBtnLoading(fb,'Searching for nodes…');
+    } else if (this.discActive){
+      this.discActive=false;
+      this.onDiscoveryDone(disc);
+    }
+    if (d.version !== this.lastVersion){
+      this.lastVersion = d.version;
+      if (d.fleet) updateKpis(d.fleet);
+      if (d.nodes) reconcileNodes(d.nodes);
+    }
+  },
+  onDiscoveryDone:function(disc){
+    var found = disc ? (disc.foundThisScan||0) : 0, res = disc ? disc.result : 0;
+    var msg = res===1 ? (found+' new node'+(found===1?'':'s')+' found')
+            : res===2 ? 'No new nodes found'
+            : res===3 ? 'Discovery failed'
+            : res===4 ? 'Discovery timed out' : 'Discovery complete';
+    showUiStatus(msg, res===1?'ok':'warn');
+    setText('dp-state', msg);
+    var fb=document.getElementById('find-btn'); if (fb) clearBtnLoading(fb);
+    var p=document.getElementById('discovery-panel');
+    if (p){ if (p._h) clearTimeout(p._h); p._h=setTimeout(function(){p.hidden=true;p._h=null;}, 4500); }
+    this.lastVersion = -1;  // force one more KPI/node refresh after the scan
+  }
+};
+
+function wireAsyncForms(){
+  var forms = document.querySelectorAll('form.async-form');
+  for (var i=0;i<forms.length;i++){
+    (function(form){
+      if (form._wired) return; form._wired = true;
+      form.addEventListener('submit', function(e){
+        e.preventDefault();
+        var btn = form.querySelector('button[type="submit"],input[type="submit"]');
+        if (btn && btn.disabled) return;  // prevent duplicate submission
+        var action = form.getAttribute('action') || '';
+        var isFind = action.indexOf('find-stations')>=0 || action.indexOf('discover')>=0;
+        var isStart = action.indexOf('/start')>=0;
+        setBtnLoading(btn, btnLabelFor(form, btn));
+        if (isFind) FM.startDiscoveryUi();  // immediate panel + fast polling
+        if (isStart) showUiStatus('Syncing to dashboard… this takes 30-60s', 'progress');
+
+        var ctrl = fmAbort();
+        // /start runs a blocking modem upload (30-60s) before responding — the
+        // default 15s timeout would abort it mid-upload. Give it 120s.
+        var timeoutMs = isStart ? 120000 : 15000;
+        var to = ctrl ? setTimeout(function(){ ctrl.abort(); }, timeoutMs) : null;
+        fetch(form.action, {method:'POST', body:asFormBody(form),
+              headers:{'Content-Type':'application/x-www-form-urlencoded'},
+              signal: ctrl?ctrl.signal:undefined})
+          .then(function(r){ return r.text().then(function(t){ return {ok:r.ok, t:t}; }); })
+          .then(function(res){
+            if (to) clearTimeout(to);
+            var ok = res.ok, msg = res.t;
+            try { var j = JSON.parse(res.t); ok = !!j.ok; msg = j.message || (ok?'Done':'Request failed'); } catch(_){}
+            if (isFind){
+              // Discovery now runs server-side; the live poller owns the button,
+              // panel and node list. No full-page reload.
+              showUiStatus(ok ? 'Searching for nodes…' : ('Discovery failed: '+msg), ok?'progress':'err');
+              if (!ok) clearBtnLoading(btn);
+              FM.bump();
+            } else if (isStart) {
+              // Finish & Start Recording: the upload + shutdown is done. Show a
+              // persistent "Finished" state on the button so the operator knows
+              // the board is about to power down, and a clear status message.
+              showUiStatus(msg, ok?'ok':'err');
+              if (btn){
+                btn.classList.remove('is-loading');
+                btn.classList.add(ok ? 'is-ok' : 'is-err');
+                btn.textContent = ok ? '✓ Finished — powering down' : '✗ Sync failed — powering down';
+                btn.disabled = true;  // stay disabled — the board is shutting down
+              }
+              FM.bump();
+            } else {
+              showUiStatus(msg, ok?'ok':'err');
+              flashBtn(btn, ok);
+              setTimeout(function(){ clearBtnLoading(btn); }, ok?700:1200);
+              FM.bump();  // promptly refresh KPIs/nodes after the action
+            }
+          })
+          .catch(function(err){
+            if (to) clearTimeout(to);
+            var aborted = err && err.name==='AbortError';
+            showUiStatus(aborted ? 'Request timed out — check connection' : ('Request failed: '+err), 'err');
+            if (btn && !isFind){ flashBtn(btn,false); setTimeout(function(){clearBtnLoading(btn);},1200); }
+            else if (isFind) clearBtnLoading(btn);
+          });
+      });
+    })(forms[i]);
+  }
+}
+
+function setCurrentTime(){
+  const n=new Date();
+  const z=n=>String(n).padStart(2,'0');
+  const s=`${z(n.getUTCHours())}:${z(n.getUTCMinutes())}:${z(n.getUTCSeconds())} ${z(n.getUTCDate())}-${z(n.getUTCMonth()+1)}-${n.getUTCFullYear()}`;
+  const el=document.getElementById('datetime'); if(el) el.value=s;
+}
+const MONTH_SHORT=['Jan','Feb','Mar','Apr','May','Jun','Jul','Aug','Sep','Oct','Nov','Dec'];
+function formatHubClock(ms){
+  const dt=new Date(ms);
+  return `${String(dt.getUTCHours()).padStart(2,'0')}:${String(dt.getUTCMinutes()).padStart(2,'0')} · ${String(dt.getUTCDate()).padStart(2,'0')} ${MONTH_SHORT[dt.getUTCMonth()]} ${dt.getUTCFullYear()}`;
+}
+function toggleSettings(){
+  const panel=document.getElementById('settings-panel');
+  if(!panel) return;
+  const showing=panel.style.display==='block';
+  panel.style.display = showing ? 'none' : 'block';
+}
+function toggleGlobalInterval(){
+  const panel=document.getElementById('global-interval-panel');
+  if(!panel) return;
+  const showing=panel.style.display==='block';
+  panel.style.display = showing ? 'none' : 'block';
+}
+function toggleInfoPanel(){
+  const panel=document.getElementById('info-panel');
+  if(!panel) return;
+  const showing=panel.style.display==='block';
+  panel.style.display = showing ? 'none' : 'block';
+}
+// Silently tell the hub what the browser's local UTC offset is, so
+// getRTCTimeString()/formatDateTimeDisplay() render local time. Display-only:
+// the RTC itself is never touched here (that's the separate /set-time flow).
+// Fires on every load so a DST change corrects itself on the next visit.
+function syncLocalDisplayOffset(){
+  const offsetMin = -(new Date().getTimezoneOffset());
+  const b = 'offset=' + encodeURIComponent(offsetMin) + '&ajax=1';
+  fetch('/set-utc-offset', {method:'POST', headers:{'Content-Type':'application/x-www-form-urlencoded'}, body:b})
+    .catch(function(){});
+}
+window.addEventListener('DOMContentLoaded', () => {
+  setCurrentTime();
+  syncLocalDisplayOffset();
+  wireAsyncForms();
+  FM.start();   // begin adaptive /api/live polling (drives KPIs, nodes, discovery, connection)
+});
+
+(function(){
+  function parseHubClock(str){
+    if (!str) return NaN;
+    // Accept "HH:MM · DD Mon YYYY" or legacy "HH:MM:SS DD-MM-YYYY"
+    const m = str.match(/^(\d{2}):(\d{2})(?::(\d{2}))?\s*[\u00b7\-]\s*(\d{1,2})\s+([A-Za-z]{3})\s+(\d{4})$/);
+    if (m){
+      const mon = MONTH_SHORT.indexOf(m[5]);
+      if (mon < 0) return NaN;
+      const value = Date.UTC(+m[6], mon, +m[4], +m[1], +m[2], m[3] ? +m[3] : 0);
+      return isNaN(value) ? NaN : value;
+    }
+    if (str.length >= 19){
+      const H = +str.slice(0,2), M = +str.slice(3,5), S = +str.slice(6,8);
+      const d = +str.slice(9,11), mo = +str.slice(12,14), y = +str.slice(15,19);
+      const value = Date.UTC(y, mo-1, d, H, M, S);
+      return isNaN(value) ? NaN : value;
+    }
+    return NaN;
+  }
+  function startClock(){
+    const el = document.getElementById('rtc-now');
+    if (!el) return;
+    const initial = (el.textContent || '').trim();
+    const rtcMs   = parseHubClock(initial);
+    const offset  = isNaN(rtcMs) ? 0 : (rtcMs - Date.now());
+    function draw(){
+      const nowMs = Date.now() + offset;
+      el.textContent = formatHubClock(nowMs);
+    }
+    draw();
+    setInterval(draw, 1000);
+  }
+  if (document.readyState === 'loading'){
+    document.addEventListener('DOMContentLoaded', startClock);
+  } else {
+    startClock();
+  }
+})();
+)FMASSET";
+static const uint8_t PORTAL_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x5c,0x5f,0x73,0xdb,0x38,0x92,0x7f,0xf7,0xa7,
+  0x80,0x73,0x5b,0x43,0x72,0x2d,0xd1,0x76,0x32,0x99,0xdd,0x95,0x47,0x71,0x39,0x71,0xb2,0xc9,0x6e,0xec,
+  0xa4,0x62,0x67,0xe7,0xe6,0x32,0xbe,0x2c,0x24,0x42,0x12,0x63,0x8a,0xd4,0x11,0x94,0x15,0x8f,0xe3,0xaa,
+  0xfd,0x0e,0x77,0x55,0xf7,0xb2,0xcf,0xf7,0x15,0xee,0xfd,0x3e,0xca,0x7c,0x92,0xfb,0x75,0x03,0x24,0x41,
+  0xea,0x8f,0x9d,0xd9,0x97,0x4d,0x55,0x2c,0x11,0x04,0x1a,0x8d,0xfe,0x87,0xee,0x46,0x43,0xbb,0xbb,0xe2,
+  0xc5,0x3c,0x49,0xba,0x7a,0x98,0x2b,0x95,0x8a,0x24,0x93,0x51,0x9c,0x8e,0x45,0x76,0xa5,0xf2,0x44,0x5e,
+  0x8b,0x51,0x96,0x8b,0x99,0x1c,0x2b,0x91,0xca,0xab,0x78,0x2c,0x8b,0x38,0x4b,0xb5,0xd8,0x11,0x7e,0x9a,
+  0xa5,0x5d,0xa9,0xaf,0xd3,0x61,0x40,0x5d,0xa6,0x42,0xcf,0x07,0xd3,0xb8,0xd0,0xe1,0xd6,0xee,0xae,0x38,
+  0x91,0x97,0x4a,0x8b,0x62,0xa2,0xc4,0xf3,0xb3,0xb7,0x8f,0x1e,0x7a,0x9a,0x21,0x74,0x73,0x95,0x46,0x2a,
+  0xdf,0x2d,0x72,0x99,0xea,0x91,0xca,0xc5,0x58,0xce,0xc4,0x48,0xa9,0x44,0xe4,0x4a,0xcf,0x00,0x36,0xbe,
+  0x52,0x22,0x4e,0x75,0xa1,0x64,0x24,0xb2,0x11,0x5a,0x93,0x6b,0x60,0x42,0x00,0xb3,0x94,0xa1,0x0d,0xf2,
+  0x6c,0xa1,0x55,0x0e,0x78,0x45,0x9c,0x5e,0x8b,0xc1,0x3c,0x4e,0x8a,0x6e,0x9c,0x0a,0x3d,0x8b,0xd3,0x54,
+  0xe5,0xa1,0x38,0x22,0x84,0x18,0x1f,0x2d,0xa6,0x32,0x25,0xb4,0x31,0x2e,0xce,0x45,0xb6,0x48,0xc5,0xfb,
+  0x57,0xe1,0x96,0x3f,0x9a,0xa7,0x43,0x5a,0x83,0x1f,0xdc,0x6c,0x09,0x51,0x3e,0x61,0xb5,0x68,0xc0,0x8c,
+  0xc5,0x3c,0x4f,0x45,0x94,0x0d,0xe7,0x53,0x95,0x16,0xe1,0x58,0x15,0xcf,0x13,0x45,0x5f,0x9f,0x5e,0xbf,
+  0x8a,0x7c,0x6f,0x34,0xed,0x12,0x79,0xbc,0xe0,0x40,0xdc,0xba,0xa3,0xf5,0x24,0x5b,0xf8,0x53,0x3d,0x06,
+  0x88,0x2b,0x89,0xc9,0xfa,0x04,0xee,0x40,0xc4,0x23,0x7f,0x3b,0x0b,0x2c,0xd4,0x03,0x7e,0x35,0xed,0xdf,
+  0x05,0xbc,0x0b,0x38,0x98,0x00,0xe0,0x05,0x01,0x98,0x8a,0x6f,0xbe,0x11,0x04,0x5a,0x4c,0xc3,0x42,0x7d,
+  0x2e,0x9e,0x65,0x69,0x81,0x21,0x7d,0x34,0x1d,0x88,0x2c,0x1c,0x26,0x52,0xeb,0xd7,0xb1,0x2e,0x42,0x19,
+  0x01,0x06,0x21,0xb2,0x84,0xdd,0x24,0x8e,0x94,0xbf,0x8c,0x1a,0x30,0x73,0xc7,0xe7,0x6a,0x0a,0x96,0x37,
+  0x41,0x2c,0xe2,0x34,0xca,0x16,0xe1,0x68,0x7a,0x86,0xc6,0xd7,0x46,0x30,0xfa,0xd4,0xe1,0xa0,0x7e,0xf5,
+  0x12,0xd0,0xcb,0x57,0x34,0x13,0x61,0x5e,0xad,0x11,0x48,0x3d,0xbf,0xc2,0x17,0x9a,0x41,0x81,0x43,0xbe,
+  0x37,0x4c,0xe2,0xe1,0xa5,0xd7,0xa9,0xb0,0xf3,0x15,0x33,0x42,0x30,0x76,0x45,0x5f,0x85,0x85,0xcc,0x41,
+  0x19,0x4c,0x30,0x89,0x13,0xe5,0x17,0xb4,0xfc,0x22,0x4c,0xb3,0x48,0x9d,0x5f,0xcf,0xd4,0x76,0xbf,0xbf,
+  0x1f,0xa0,0x5b,0x11,0xce,0x24,0xa4,0xa9,0x38,0xcd,0xcc,0x84,0x66,0xb8,0x14,0x7d,0x51,0x8e,0x18,0x26,
+  0x99,0x56,0xba,0x08,0xc4,0x61,0xfd,0xe0,0x7b,0xd2,0x0b,0x44,0x4f,0xa4,0x10,0xf7,0x8a,0xc0,0xdb,0xb2,
+  0xe2,0x50,0xd9,0x24,0x2d,0x12,0xfd,0x7e,0xdf,0xfb,0x38,0x48,0x64,0x7a,0xe9,0x89,0x2f,0x5f,0x84,0x0c,
+  0x27,0x52,0x1f,0x15,0x45,0x1e,0x0f,0xe6,0x05,0x28,0x85,0xf5,0xa7,0x46,0x1c,0x96,0x20,0xa8,0x70,0xaa,
+  0x0a,0xf9,0x67,0x75,0xfd,0xe5,0x8b,0x0a,0x87,0x45,0x9e,0xd8,0xaf,0x7a,0x12,0x8f,0x0a,0xfb,0x1d,0x40,
+  0x8a,0x2c,0x6d,0x0e,0xa5,0x55,0x4c,0x72,0x35,0xea,0x4b,0x12,0x0f,0x67,0x2e,0x6a,0xf4,0x82,0x2f,0x5f,
+  0x3c,0xaf,0x46,0x9c,0xda,0x08,0x2f,0xfa,0x0c,0x87,0x13,0x99,0x1f,0x15,0xfe,0x5e,0x40,0x48,0xff,0x8b,
+  0x57,0xb5,0x83,0xbf,0xc5,0x2b,0xa8,0xdd,0xe7,0x37,0x23,0xdf,0xfb,0x24,0xaf,0x24,0xd4,0x3c,0x9e,0x15,
+  0x3d,0xaf,0xc3,0x5d,0xf7,0x9a,0xf3,0xb3,0x20,0x7b,0x96,0x9d,0xbf,0xfc,0xed,0x7f,0x8c,0x20,0xde,0x76,
+  0x44,0x91,0xcf,0x55,0x70,0x07,0x6b,0x8d,0x05,0x58,0xc7,0xdb,0x51,0xcd,0xdb,0x72,0x05,0x23,0x62,0xd5,
+  0xa8,0x96,0xc1,0xd6,0x63,0x38,0x84,0xac,0x4b,0x18,0x04,0xf0,0x8d,0xf4,0xba,0x4b,0x7a,0xed,0x10,0x5b,
+  0x08,0x58,0x86,0x89,0x4c,0xa3,0x04,0xc6,0xc6,0x28,0xb8,0xb3,0x88,0x1f,0xb2,0xfc,0x72,0xdd,0x22,0xac,
+  0xf0,0x2e,0x2f,0x81,0xcc,0x14,0x2b,0x40,0x87,0xb5,0x06,0x6a,0xc0,0x93,0xc4,0xe9,0x30,0x09,0xc5,0x60,
+  0x34,0x94,0x43,0xb2,0x42,0x72,0x78,0xb9,0x0b,0x5c,0x16,0x32,0x8f,0x36,0x53,0xe4,0xf8,0xcd,0x89,0xd5,
+  0x57,0x22,0xa9,0x8a,0x2a,0xb0,0x5b,0xb7,0x01,0xb4,0x70,0x8b,0x4c,0xdb,0x59,0x21,0x8b,0x39,0xac,0x95,
+  0xd2,0x9a,0x26,0xef,0x09,0x60,0x1d,0x41,0x90,0xbd,0x8c,0xa4,0x4e,0x78,0x98,0x25,0xe5,0x2f,0x2a,0xcf,
+  0xf9,0x73,0x96,0x67,0x63,0x18,0x4c,0xed,0xc1,0xdc,0xbd,0x7b,0x75,0xd4,0x4d,0xc8,0x6c,0xe6,0x6a,0x0c,
+  0x82,0xb3,0xf1,0x3d,0x27,0xf3,0x1a,0x63,0x4e,0xe1,0x67,0x97,0xbb,0x65,0xef,0x40,0xc8,0x79,0x91,0x75,
+  0x87,0x89,0x92,0xf9,0x81,0x00,0xac,0x2c,0x87,0x55,0x56,0xb9,0x26,0xba,0xcf,0xd3,0x22,0x26,0x2b,0x3c,
+  0x4b,0xe4,0x50,0x45,0xe1,0x56,0xc3,0xb0,0xbd,0x8f,0x0d,0x8a,0xbe,0x45,0xb1,0xc3,0x18,0x32,0x67,0x89,
+  0xaf,0x83,0xec,0x33,0xb0,0x5d,0x6b,0xd5,0xe6,0x71,0x57,0xf3,0x70,0xc3,0x85,0x78,0x24,0xfc,0x6d,0x0c,
+  0x71,0xc5,0x0e,0x8f,0x86,0xe9,0xa7,0x72,0xaa,0x68,0xe5,0x13,0x95,0xcc,0x84,0xee,0x7a,0xb4,0xcd,0x30,
+  0x35,0x20,0xcc,0x44,0x8e,0xa0,0xec,0xad,0x8b,0xeb,0x44,0x85,0x51,0xac,0x67,0xb4,0x43,0x61,0xc4,0x20,
+  0xc9,0x60,0x55,0xaa,0xd7,0x0d,0xd5,0xc9,0xb3,0x44,0x79,0x1d,0xcf,0xc5,0x82,0x3a,0x39,0xc6,0x14,0x10,
+  0xec,0xda,0x4a,0x14,0xa9,0xc3,0xc7,0x02,0x36,0x93,0xe9,0x75,0x1e,0x4f,0x55,0x36,0x2f,0xca,0xd6,0x03,
+  0x61,0xbe,0x60,0x18,0x5b,0x12,0x36,0x95,0x34,0xca,0x70,0xae,0x5f,0xf2,0xee,0x8b,0xa8,0x1b,0x2a,0xa6,
+  0x59,0x8d,0xa8,0x20,0x00,0xd7,0x12,0xbc,0xb3,0x35,0xad,0x5e,0x25,0xb6,0x5c,0xe5,0x1d,0x90,0x24,0x7f,
+  0xbb,0xb7,0xb7,0x67,0xa4,0x7a,0xeb,0x76,0xab,0x66,0x97,0xd4,0x2f,0xa0,0x22,0x4f,0xb3,0xe8,0xda,0x27,
+  0x5d,0xa9,0x78,0x14,0xc9,0x82,0x6c,0x63,0xaa,0x16,0x82,0x3a,0x1c,0xe3,0xd1,0x74,0x60,0x8d,0xc6,0x53,
+  0x28,0x67,0x33,0x6c,0xce,0x50,0xb4,0x4f,0xf2,0x33,0xa4,0xd4,0xdb,0x37,0x84,0xb2,0x1b,0x22,0x0d,0x7c,
+  0xff,0xee,0xf5,0x19,0x68,0x31,0x9c,0xbc,0x95,0xb9,0x9c,0x6a,0x9f,0x86,0x91,0x20,0xb3,0x10,0x1f,0x0d,
+  0xb2,0x9c,0xa9,0x09,0x62,0x27,0xd8,0xd9,0xa7,0x40,0x78,0xa0,0x84,0x1c,0x68,0x22,0x2f,0x76,0x68,0x38,
+  0x13,0xd7,0x22,0x4b,0x22,0x31,0x94,0xb3,0x02,0x02,0xdb,0x9d,0x61,0x80,0x4c,0xc4,0x42,0x0d,0xae,0x62,
+  0xb5,0xd0,0xe2,0x97,0xbf,0xfd,0x97,0x18,0xcf,0xa1,0x51,0x22,0x2e,0x08,0xa2,0xce,0xc4,0x0c,0xb0,0xa0,
+  0xc1,0xbb,0x23,0x55,0x0c,0x27,0x42,0x43,0x44,0xd1,0x1f,0x5a,0xad,0x85,0xff,0x69,0x0e,0xa9,0x5d,0xc4,
+  0xc5,0x04,0x74,0x83,0xd9,0x9f,0xd0,0xb8,0xc2,0x90,0x31,0x30,0xce,0x02,0x0c,0xbe,0x23,0xc7,0xa3,0x29,
+  0x63,0xe8,0xec,0xf1,0x7e,0x81,0xed,0x04,0x4e,0x46,0x1b,0xf3,0x6d,0xe2,0xd6,0x1c,0x06,0x73,0x14,0xa7,
+  0x50,0x58,0xda,0x3f,0x68,0xf5,0xad,0x6e,0x7e,0xb5,0x8d,0x08,0x43,0x80,0x77,0xd8,0x5e,0x72,0x49,0x43,
+  0x04,0xac,0x56,0xaa,0xcc,0xb4,0x60,0x7f,0x3c,0x94,0x45,0x96,0xbb,0x2a,0xa5,0x08,0x8e,0xed,0xe1,0x93,
+  0x54,0xaa,0x8a,0x4f,0x70,0x85,0x36,0xa8,0x12,0x01,0x5e,0x56,0x26,0x95,0xb8,0xba,0xa4,0x92,0xa6,0x2a,
+  0xf1,0x98,0x28,0x2b,0x58,0x97,0x78,0x32,0xda,0x1f,0xe6,0x33,0x70,0x0f,0xa4,0xf5,0xb0,0x3a,0x4f,0x0c,
+  0xbb,0xd5,0x33,0xcb,0xe6,0xba,0x7f,0x3d,0x51,0x01,0x30,0x46,0xc9,0x0c,0xe6,0xef,0xf7,0x1d,0xc8,0x46,
+  0xcc,0x8c,0xe3,0xaf,0x3d,0xe1,0x99,0xb5,0x00,0xf1,0xa6,0x46,0xae,0x46,0xf6,0xbd,0x7d,0x20,0xb3,0xbe,
+  0x75,0x2f,0x0c,0x9f,0xb9,0xec,0x28,0x30,0xe9,0x7c,0x56,0x80,0xb1,0x5b,0xf7,0xc1,0xf2,0x9d,0x2a,0x99,
+  0x69,0x66,0x24,0x74,0x2d,0x3c,0x80,0x28,0x85,0xbf,0xdb,0xed,0x5a,0xc7,0xd3,0x6c,0xe9,0x95,0x0b,0xcd,
+  0xf0,0x20,0xad,0xb4,0x8f,0x61,0x6d,0x73,0xc8,0x7b,0x22,0x07,0x2a,0x21,0xff,0x39,0x4e,0x21,0xdb,0xaa,
+  0xf4,0x5c,0x03,0x02,0x52,0xcb,0xc8,0xa0,0x48,0x5f,0x53,0x47,0x28,0x2b,0xeb,0x69,0x87,0x5a,0x58,0x4a,
+  0xd8,0x38,0x15,0x29,0xed,0x94,0xf8,0x68,0x39,0x09,0xa4,0x92,0x5d,0x3b,0x79,0x97,0x67,0xaa,0x77,0xcb,
+  0x7b,0x76,0x3f,0xd8,0x72,0x5c,0x29,0xf6,0xeb,0x69,0x4f,0xc6,0x67,0x6b,0xac,0x64,0x44,0x09,0x3c,0xd9,
+  0x66,0xaf,0x94,0x46,0x19,0xc6,0xa5,0xaf,0x01,0xfd,0x89,0x58,0x5a,0x29,0x60,0xf0,0x82,0x27,0xfd,0x3d,
+  0xe3,0x43,0x55,0x1d,0x60,0xd8,0x86,0x14,0x64,0xf0,0xbb,0x0a,0x4d,0xcf,0x18,0x19,0x4b,0xf0,0x15,0x70,
+  0xb5,0xbc,0x52,0xab,0xc0,0x71,0x54,0x31,0x8d,0xb5,0x66,0xbc,0x9a,0x20,0x11,0xb9,0xac,0x85,0x97,0x83,
+  0xc7,0x39,0x93,0x80,0xc5,0xe3,0x4a,0x26,0xab,0xa0,0x2f,0x10,0xd1,0x34,0x3b,0xd4,0xe0,0x8f,0x66,0x33,
+  0x0e,0x54,0xd6,0x21,0x0c,0xc9,0x68,0x8d,0x70,0xa5,0x78,0xc5,0x08,0x44,0x2e,0x90,0x15,0x68,0xa5,0xf1,
+  0x2e,0x5b,0x43,0x93,0xda,0x3b,0x5b,0x35,0x1b,0x7c,0xac,0x62,0xd5,0x0a,0xf4,0x64,0x5e,0x90,0xc7,0xda,
+  0xa6,0x0d,0xf5,0xdf,0x00,0x4e,0x15,0x5d,0x32,0xac,0x4b,0x4c,0x2a,0x68,0x10,0xdb,0xdc,0x72,0x64,0xf9,
+  0xce,0x71,0xbc,0x48,0x43,0x5c,0xc3,0xf7,0x14,0x72,0x6d,0xb0,0x27,0x21,0xee,0x18,0x6d,0xa8,0xe4,0x7a,
+  0x9b,0x84,0xdc,0xb1,0x65,0x56,0xd6,0xc3,0x8f,0x59,0x1e,0x8f,0xb1,0x8d,0xb2,0xc1,0x0d,0x84,0xd3,0x64,
+  0xde,0x17,0x72,0x4c,0xe6,0x8e,0x14,0xf7,0xd5,0xe9,0xdb,0xf7,0xe7,0x6c,0xb4,0xe9,0x05,0x58,0x35,0x57,
+  0xd0,0x59,0xfa,0xce,0x6a,0xf6,0xf2,0xfc,0xe4,0x35,0xef,0xff,0x68,0x80,0xf8,0xc9,0x41,0xa2,0xc8,0xd5,
+  0x22,0xbf,0xb0,0x6c,0x6e,0xfa,0x0e,0x32,0x8f,0x65,0x77,0x30,0xd7,0xd7,0x70,0x20,0xa8,0x97,0x75,0x1f,
+  0xd0,0xaf,0x15,0x78,0xc5,0xba,0xd4,0xa4,0xda,0x34,0xaf,0xc1,0xad,0xc6,0xac,0x6f,0x08,0xc0,0x2a,0xd4,
+  0xa0,0x1a,0x99,0x43,0xad,0x9a,0x78,0x93,0x35,0xff,0x5e,0xcf,0x64,0x2a,0x78,0xea,0xfe,0x03,0x6b,0x3a,
+  0x1e,0x08,0x46,0x12,0x7e,0x65,0xa4,0xd2,0xfe,0x03,0xc2,0xf2,0xc1,0x93,0xef,0x77,0xa9,0xe7,0x13,0xb6,
+  0xfa,0x2b,0xe7,0x08,0x1a,0xac,0x61,0x2f,0xa7,0xc9,0x9c,0xb5,0x5c,0x69,0xd1,0x6e,0x24,0x81,0x69,0xd9,
+  0x6e,0x62,0xc8,0x95,0xf4,0x5b,0x41,0xb8,0x32,0xe2,0x74,0x68,0xd7,0xa1,0x07,0x38,0x4f,0xfc,0x49,0x56,
+  0x38,0x58,0x16,0x84,0x6d,0x2b,0x08,0x37,0x36,0x8c,0xb8,0x17,0xa1,0xab,0xe1,0x07,0xab,0x49,0x5b,0xbf,
+  0x37,0xee,0x99,0x23,0x63,0x65,0xb4,0x78,0xeb,0x52,0x6c,0x84,0x55,0x4c,0x40,0x31,0x23,0xc7,0xd9,0xe5,
+  0x46,0x72,0x6d,0x5c,0xf2,0x1a,0x89,0xca,0x2e,0x69,0x03,0x32,0xd4,0xa0,0x6d,0xa7,0xa6,0x47,0xbd,0xe9,
+  0x50,0xf4,0x0b,0x87,0x2a,0x8f,0x10,0x35,0x20,0x44,0xc9,0xd9,0x57,0x90,0x49,0x47,0xfc,0xeb,0xd9,0x59,
+  0x57,0xcb,0x91,0x82,0x97,0xe3,0xec,0xa9,0x94,0xc9,0x89,0xd4,0x55,0x3c,0xc4,0xb6,0x03,0x0e,0xa5,0x63,
+  0xdd,0xda,0x76,0x60,0x76,0x67,0xe4,0xeb,0x2b,0xe3,0x29,0x74,0xc4,0x4c,0xce,0xb5,0x8a,0xf0,0x09,0xdf,
+  0x10,0xfd,0x3b,0x18,0xae,0xe3,0x5c,0x45,0xe7,0x1c,0xc7,0x75,0x04,0xe5,0x73,0xf0,0x1a,0x81,0x03,0xbc,
+  0x23,0x15,0xbd,0xb5,0xdd,0x23,0x04,0x12,0xd9,0xf5,0xfb,0x14,0xfb,0xde,0x28,0xce,0xa7,0x2a,0xaa,0xa8,
+  0x63,0x01,0xd1,0xa6,0x72,0x3a,0x9f,0x0e,0xe0,0x48,0x35,0x20,0x36,0x22,0x52,0xf1,0xc1,0x23,0x84,0x18,
+  0xab,0x2e,0xef,0x24,0xaa,0x3b,0x4f,0x67,0x92,0xba,0x43,0x40,0xde,0x31,0x29,0xc5,0x7f,0xcc,0xd5,0x1c,
+  0xcf,0x17,0x44,0x45,0x90,0xe5,0x39,0x61,0x24,0xe0,0x06,0x62,0x37,0xb8,0xd4,0xd5,0x02,0xa6,0xb2,0xe0,
+  0x3d,0x85,0xb3,0x48,0x1a,0x46,0x5c,0xe5,0x36,0x1b,0x45,0x0e,0x1b,0x26,0xd0,0x21,0x0d,0x35,0xd0,0xb4,
+  0x01,0x75,0x76,0x7e,0x74,0x7a,0xfc,0xf4,0x47,0x81,0x00,0x53,0x5c,0x2a,0x35,0x33,0x09,0x2d,0xca,0x44,
+  0x88,0xe3,0xe7,0x6f,0x5f,0xbf,0xf9,0xf1,0xf9,0x71,0x87,0xdc,0x54,0xc5,0xbe,0x2d,0x36,0xfa,0x02,0x2e,
+  0x6f,0x92,0x2d,0xe0,0xa3,0xce,0xe1,0xe8,0x66,0xe8,0x9d,0x2f,0x62,0xad,0x0c,0xb4,0xa1,0x84,0xf7,0x0a,
+  0xe5,0xe5,0xcd,0xed,0x0a,0xb3,0x1a,0x22,0x11,0xc7,0xc4,0x03,0x43,0xb8,0x07,0xa1,0xa5,0x12,0x93,0x75,
+  0x35,0x19,0x06,0xb2,0x80,0xe4,0x20,0x3e,0xf5,0x78,0xa5,0xd5,0xba,0x8f,0x52,0x04,0x71,0x15,0xbd,0x2d,
+  0xf0,0x9a,0x0e,0x06,0x47,0x43,0xab,0x2e,0x77,0x1b,0x5b,0xdb,0x63,0x50,0x8e,0x8b,0x5e,0xb5,0xba,0x2d,
+  0x1b,0x57,0x6b,0x38,0xbe,0x18,0x26,0x10,0xed,0xa6,0xd9,0x02,0xda,0x3e,0x06,0x60,0xea,0x64,0x80,0xf3,
+  0xda,0x63,0x38,0xf7,0xe8,0x97,0x15,0x62,0x02,0x0b,0x42,0x04,0x46,0x28,0x2b,0xe1,0x92,0xf3,0x62,0x23,
+  0x03,0xca,0x2c,0xcf,0xce,0xfe,0x40,0xa0,0x81,0xf7,0xbf,0xba,0xc5,0x10,0x2c,0x9e,0x62,0x1b,0x85,0xe3,
+  0x01,0xbf,0xe8,0x12,0xf3,0x00,0x4a,0x94,0x29,0x03,0x5c,0x7d,0x26,0xb5,0xb0,0xd4,0xa9,0xbc,0xb4,0x92,
+  0x0b,0x1e,0x89,0xd3,0xb2,0xcc,0xdd,0x41,0xbf,0x53,0xc0,0xad,0x3a,0x1b,0x3a,0xae,0x87,0x7e,0x0f,0xb9,
+  0x7d,0xb4,0x49,0x6e,0x8d,0x1c,0x62,0x56,0x97,0x14,0x15,0xf3,0xde,0xa4,0xbc,0x70,0x16,0x2d,0x5e,0x38,
+  0x68,0x0a,0x07,0x0b,0x3e,0x00,0xda,0xcd,0x50,0x6a,0x42,0xfc,0x38,0x9f,0x02,0x0b,0xc4,0xfd,0xb4,0x99,
+  0xd2,0x06,0xac,0x31,0x8b,0x4c,0xc7,0x4a,0xc0,0x80,0x5f,0x81,0x58,0xd2,0x00,0x2c,0xd1,0xb5,0x48,0x0a,
+  0xcb,0x71,0x40,0x36,0x19,0x18,0x56,0x72,0xf1,0x10,0xf1,0x22,0x02,0xb0,0x04,0x06,0x83,0x64,0x9c,0x24,
+  0xd4,0xa8,0x08,0xfa,0x3d,0x78,0x47,0x93,0x59,0x59,0x28,0xf9,0x64,0xf4,0x1c,0xb3,0x08,0x72,0x9a,0x58,
+  0xa4,0x46,0x79,0x36,0xc5,0x33,0x23,0x69,0x46,0x1a,0xa1,0x99,0x70,0x40,0x49,0xb9,0x84,0x7f,0x90,0xac,
+  0x0f,0x03,0x36,0xc8,0x96,0xb4,0x4d,0x4b,0x03,0x0b,0xb9,0x82,0xd6,0x46,0x12,0xac,0x8d,0xa0,0x45,0x54,
+  0xe4,0xde,0xda,0x14,0xa2,0x6c,0x86,0xd4,0x90,0xd8,0x4d,0xd2,0x52,0x49,0xc1,0x6c,0x03,0x8a,0x4d,0x71,
+  0xd8,0x8c,0xd9,0xd7,0xe1,0x79,0x34,0xa4,0xe8,0x7a,0x05,0x82,0x6f,0x8f,0x5e,0xbd,0x63,0xf4,0xc4,0x46,
+  0x31,0xb5,0xc6,0xb5,0x0e,0x72,0x2e,0x1c,0xd7,0x6e,0xb3,0x41,0x3e,0x55,0x0b,0xea,0x7d,0xdb,0xdc,0x4f,
+  0x9e,0xca,0xa2,0xf0,0xaf,0xaa,0x0d,0xe0,0x0a,0xb8,0xd0,0x86,0x4a,0xfe,0x08,0x7d,0xaf,0x22,0xed,0x96,
+  0xf6,0x00,0x5e,0xba,0x2b,0xcd,0xec,0x14,0x8f,0x0c,0xb1,0x11,0x5f,0x3d,0xe9,0x3f,0x0a,0xff,0x40,0xdb,
+  0x62,0x4b,0xa1,0xcd,0x16,0xc9,0xaf,0x1f,0xaf,0x78,0x4d,0xfa,0x4d,0x5b,0xe8,0x0a,0x33,0xe0,0x2e,0x6e,
+  0xd8,0x11,0x57,0x61,0x91,0xbd,0x88,0x3f,0xab,0xc8,0x7f,0x18,0xec,0x78,0x7f,0x69,0x2d,0x87,0x52,0xa9,
+  0x67,0x4a,0xa5,0xe7,0x9f,0x0b,0x5f,0xab,0x61,0xb5,0x26,0x7c,0x77,0x56,0x65,0x9e,0xaa,0x75,0xd9,0xa6,
+  0xef,0x1d,0xe7,0x99,0x16,0xe6,0x4c,0x7c,0x22,0x8b,0x49,0x38,0x4a,0x32,0xc4,0x7a,0xe8,0xb8,0xfb,0x1d,
+  0x7a,0xee,0x20,0x40,0x86,0xa6,0x0b,0x39,0xce,0x9a,0x3e,0x34,0x99,0x88,0x67,0xd0,0x58,0xdf,0xa4,0xbf,
+  0x9f,0x91,0xcb,0x60,0xdd,0xe8,0x73,0xec,0xf4,0x1d,0x31,0x8a,0x55,0x12,0x91,0x23,0x54,0xe7,0x7e,0xea,
+  0x13,0x07,0x78,0x08,0xe0,0x99,0xcd,0x29,0x50,0x00,0x76,0x45,0x89,0xfe,0xa8,0xce,0x18,0xf4,0x1d,0xb0,
+  0x25,0xe5,0x93,0xb5,0xe3,0xc9,0xc5,0x24,0x00,0x4e,0xca,0xa1,0xef,0x11,0x86,0x14,0x31,0xd4,0x31,0x25,
+  0x75,0x70,0x4f,0x2e,0x2a,0x6c,0xcb,0x19,0xae,0xee,0x9c,0xe1,0xaa,0xe5,0x96,0x73,0xe4,0x3a,0xf2,0xdc,
+  0xe5,0x72,0x26,0xcb,0xa6,0xb1,0x9e,0x4d,0xe2,0x24,0xf2,0x13,0x5e,0x9b,0xdb,0x72,0x85,0x96,0xf2,0x88,
+  0xa7,0x41,0x56,0x49,0x11,0x1c,0x79,0x53,0x2f,0x08,0x9e,0xf6,0xc9,0xa7,0xea,0x88,0xda,0x07,0xa6,0x67,
+  0x32,0x52,0xf4,0x19,0xd2,0xe4,0x40,0x87,0x92,0x83,0xce,0x63,0x68,0x34,0x2d,0x35,0x9f,0x9c,0xa8,0x6f,
+  0xbe,0x37,0x3a,0x8f,0x0e,0xe6,0xcb,0xa1,0xb7,0xef,0xf5,0xbc,0x3d,0xcf,0x64,0x0f,0x89,0x0c,0xba,0xe8,
+  0xd7,0x0e,0x98,0x85,0x03,0x24,0xc2,0xd2,0x87,0xc1,0xb7,0xd2,0x0d,0x83,0x07,0xde,0x74,0xc4,0xa8,0xa1,
+  0x74,0x27,0x9e,0x1b,0xa7,0x8c,0xbc,0xf1,0xa6,0x5b,0x56,0x76,0x72,0x37,0x49,0xec,0xe2,0x7d,0x46,0x13,
+  0x96,0x2d,0xbf,0x3e,0x53,0x09,0xb4,0x1e,0x82,0xe8,0x7d,0x30,0x24,0x46,0x94,0xc1,0xf9,0xa6,0x07,0x17,
+  0xb5,0x27,0xae,0xb1,0x72,0xed,0xb0,0x5c,0x17,0x1f,0xf6,0x2e,0x0e,0xd0,0xe4,0x32,0x19,0x8d,0xfb,0x17,
+  0xf5,0xda,0x06,0x66,0x6d,0x6c,0x0c,0xd2,0x10,0xda,0xf7,0x17,0xcc,0x3c,0xd8,0x3c,0x33,0x7a,0x15,0xee,
+  0xbc,0x03,0x4a,0x8b,0x3a,0xf3,0x0e,0xcc,0xbc,0x83,0xc6,0xbc,0x83,0xe6,0xbc,0xf9,0xe6,0x29,0xb0,0x8d,
+  0xf1,0x0c,0x0c,0x3f,0xa7,0xe4,0xa0,0x2b,0xca,0x6c,0x2f,0x5c,0x79,0xe6,0x60,0x02,0x1c,0xcb,0x1b,0x53,
+  0xfa,0x44,0xe9,0xe1,0x49,0x9c,0x7e,0xf9,0xb2,0x07,0xab,0x41,0x8a,0xeb,0x70,0x35,0xb9,0x83,0xbe,0x64,
+  0x54,0x34,0x8c,0x4a,0x8d,0x47,0x42,0x04,0x4e,0xf4,0xbd,0x30,0x49,0x74,0x4b,0xb5,0x6a,0x0b,0x95,0x86,
+  0xe5,0xd3,0x19,0x6c,0x95,0x83,0xd0,0x20,0xb9,0x0b,0x23,0xe8,0xa7,0x83,0xce,0x00,0x31,0x37,0xfe,0xb4,
+  0xd2,0x73,0x04,0xde,0xc6,0x95,0x88,0xa4,0xa2,0x65,0x2b,0x85,0x29,0x9e,0x27,0x7e,0x5a,0xd9,0xa1,0x45,
+  0x2e,0x67,0x77,0x99,0x22,0xea,0xb3,0x64,0x4c,0x34,0xa3,0xd8,0xa5,0x77,0x86,0x06,0xa9,0x32,0x86,0x9b,
+  0x7b,0xaf,0x30,0x0c,0xdc,0x29,0xa6,0xc3,0x16,0xc2,0xac,0x4a,0x69,0xcd,0xe2,0xe1,0xe5,0x5a,0x04,0xca,
+  0xf4,0x17,0xf7,0x5a,0x87,0xc2,0xd0,0xe4,0x7f,0x3d,0xdb,0xab,0x88,0x8b,0x04,0x3d,0x0c,0x09,0x19,0x35,
+  0xaf,0xda,0xae,0x06,0x6b,0x67,0x8a,0xd3,0xd9,0xbc,0xa0,0x99,0x86,0x90,0xdc,0xeb,0x19,0x73,0x57,0x0d,
+  0x2f,0x07,0xd9,0x67,0x8f,0xdb,0xd2,0x6a,0xda,0x8f,0x58,0x03,0x37,0x31,0xb7,0xfb,0x86,0xcc,0x82,0x1a,
+  0x56,0xe3,0x67,0x3a,0x37,0x09,0xc2,0x47,0x66,0x1d,0x6f,0x40,0xf1,0x8f,0x21,0x8c,0xc9,0xdc,0x69,0x8b,
+  0xc1,0x8a,0x74,0x87,0x21,0x45,0xa7,0x5c,0x97,0xb7,0xe3,0x5b,0x5e,0x7f,0xf9,0xc2,0xf4,0x0c,0x2c,0x12,
+  0x2b,0xce,0x76,0xd9,0x17,0xf5,0x3a,0xee,0x41,0x46,0x3c,0xf2,0xed,0x69,0x1b,0xe7,0x71,0xd5,0x53,0xc2,
+  0xc4,0x80,0x8e,0xe9,0xf4,0x73,0xc3,0x4b,0x7f,0x38,0x20,0xb9,0xe5,0xf9,0x98,0xe0,0xae,0x2d,0xe7,0x77,
+  0x2c,0x01,0x6e,0x2b,0x75,0xab,0x73,0x98,0x6b,0x79,0x20,0x8d,0x55,0x91,0x2e,0x21,0xe3,0x42,0x4d,0x05,
+  0xfd,0xe9,0x76,0x2b,0x56,0xca,0x90,0x0f,0x63,0xbd,0x5d,0x9b,0xc7,0x3c,0x8c,0xa3,0x3e,0xe5,0x54,0x14,
+  0x2c,0x68,0xa4,0xde,0xbf,0x7b,0xf5,0x2c,0x9b,0xce,0xb2,0x94,0x60,0x36,0x44,0x2d,0xcf,0x16,0x77,0x89,
+  0x3a,0xba,0x2c,0xb1,0x31,0xb7,0x1e,0x09,0x17,0x0a,0xc8,0x38,0xbd,0x0b,0x06,0xf5,0x59,0x02,0x42,0x8d,
+  0x15,0x14,0xc4,0xf9,0x59,0x3a,0x5e,0xbf,0xbf,0xf2,0x6b,0x02,0x65,0xbe,0xad,0xd9,0x66,0x6b,0xed,0xe0,
+  0x19,0x5d,0x82,0x9b,0x71,0x41,0x3d,0x1f,0xed,0x16,0x77,0xe1,0x6d,0x7a,0x2d,0x4b,0xb1,0x39,0xda,0x20,
+  0x58,0xb6,0x87,0x3b,0x53,0xe5,0xfa,0xb8,0x9d,0xbb,0x43,0xb4,0x90,0xac,0x9a,0xa1,0xf5,0x29,0x5f,0xf0,
+  0x6b,0xa0,0xd0,0xf6,0x04,0x9b,0x68,0xf4,0xa5,0xb0,0x40,0xb8,0x2e,0x81,0xad,0xee,0x5d,0xcb,0x32,0xbd,
+  0xd6,0x38,0x43,0xbc,0x2c,0xdb,0x63,0x03,0x42,0xd6,0xbe,0x5b,0x84,0xde,0x95,0xb9,0x69,0x7c,0xc7,0x1e,
+  0x63,0x31,0xfa,0x5a,0x28,0xaf,0xb1,0x0f,0x08,0xda,0x63,0x98,0x93,0x66,0xbb,0xb1,0xa0,0x48,0x0a,0x5d,
+  0x38,0xc4,0x5f,0x2b,0x9c,0x4d,0x2e,0x13,0x99,0x56,0xbc,0x30,0x13,0x59,0x65,0x72,0x5f,0xa0,0xe3,0x2a,
+  0xfd,0x94,0x68,0x6c,0x3b,0x5b,0xd4,0x89,0x9c,0xad,0xca,0x37,0xa3,0x86,0xc6,0x7e,0x42,0x47,0x09,0xb4,
+  0x9f,0xf8,0x09,0x4c,0x4d,0x47,0xc4,0xf5,0xe1,0xf3,0x65,0x3f,0xe1,0x42,0x01,0x02,0x0e,0xcf,0x95,0xf0,
+  0xa0,0x2c,0x97,0x4f,0xef,0xe2,0xfe,0xde,0x41,0xfc,0xfd,0x65,0x98,0xa8,0x74,0x5c,0x4c,0x0e,0xe2,0x9d,
+  0x1d,0x36,0x47,0xc2,0xbf,0xfc,0x10,0x5f,0x34,0x8e,0x33,0xc8,0xb5,0x5b,0x6a,0x6c,0x6d,0x26,0x14,0x8b,
+  0xc6,0x75,0x94,0x42,0xdd,0xcd,0x9e,0x5a,0x1e,0x91,0x72,0x96,0xf0,0x96,0x52,0x73,0x36,0x56,0xe4,0xa4,
+  0x05,0x45,0xb7,0x9c,0xa1,0xa3,0x43,0x50,0x3e,0x5e,0x67,0x02,0x80,0x20,0x7c,0xac,0x08,0xdb,0xa1,0x85,
+  0x3f,0x89,0xc7,0x93,0x04,0xff,0xe1,0xab,0x05,0xa1,0xf8,0x41,0x89,0x28,0x13,0xa7,0x6f,0xce,0x09,0x96,
+  0x49,0x18,0x5a,0x10,0x26,0x29,0x92,0x67,0x33,0x4a,0xec,0x50,0x85,0x94,0xe4,0x33,0x52,0x3e,0x3b,0xb5,
+  0xe9,0x83,0x71,0x46,0x33,0x0e,0xf2,0x58,0x8d,0x92,0x6b,0xa1,0xe3,0x84,0x76,0x6b,0x3d,0xe1,0x04,0x4b,
+  0x9a,0xf1,0xc9,0xea,0x54,0x5e,0x2a,0x18,0x3a,0xcd,0x40,0x41,0xc5,0x34,0xd6,0x93,0x03,0x60,0x3b,0x4b,
+  0xe2,0x61,0x4c,0xb5,0x00,0x14,0xd1,0x51,0xf1,0x55,0x26,0x23,0x93,0xf3,0xa2,0xaa,0x08,0xe7,0x04,0x93,
+  0x82,0xff,0x74,0x08,0xd0,0xc4,0x44,0xcd,0xb2,0xa7,0x2b,0x8e,0x10,0x3f,0xd6,0xd7,0x38,0x31,0x35,0xa9,
+  0x8b,0x73,0x80,0x49,0x8f,0xe4,0x46,0x6c,0x1b,0x40,0x4e,0xee,0xb4,0xc5,0x4a,0x7e,0xdf,0x60,0x67,0x55,
+  0x5c,0x92,0xf6,0xf9,0x25,0x98,0xd2,0xe1,0x65,0xf5,0x5b,0x22,0x53,0x59,0x67,0x3b,0x27,0xf5,0x09,0x18,
+  0xd7,0x65,0x35,0x2a,0x1d,0x17,0xdb,0x9f,0xd3,0xc5,0xeb,0x02,0x04,0x93,0x17,0xb6,0x87,0xb7,0xd3,0x59,
+  0x71,0x7d,0xc7,0xd2,0xb9,0x4f,0xbd,0x76,0x7e,0x0c,0xcc,0xc8,0xa5,0xe3,0x7e,0x77,0xb9,0x14,0xd5,0xf2,
+  0xe9,0x3f,0x1f,0x98,0x36,0x94,0xc3,0xec,0x9c,0x7f,0x9e,0xc5,0xda,0x1f,0x55,0x5c,0x80,0x1d,0xef,0x57,
+  0xbb,0x70,0x1c,0x75,0xae,0x6c,0xf9,0x97,0x5a,0x8b,0x1f,0xd1,0xc7,0xe0,0x44,0xda,0x70,0xb5,0xdd,0x37,
+  0x87,0x2d,0xaa,0xe1,0x5f,0x9e,0x71,0xda,0x98,0xe3,0xa8,0x5b,0x36,0xb0,0x0a,0xd6,0xef,0x72,0x16,0x57,
+  0x19,0x88,0x6e,0x3a,0x9f,0x52,0x58,0x16,0x4a,0xce,0x43,0x04,0x8d,0x4e,0x65,0xae,0xa0,0xea,0x04,0x0d,
+  0x08,0xda,0x47,0x44,0x14,0x18,0x7e,0x2d,0xc6,0x6d,0x34,0xaf,0xca,0x53,0x79,0x4a,0x92,0xbf,0xa6,0xf2,
+  0x98,0x19,0x9f,0xda,0xf7,0x48,0xdf,0xf8,0xcc,0x2a,0x47,0xac,0x1f,0xeb,0x78,0x10,0x27,0x71,0x71,0xdd,
+  0x95,0x0b,0x84,0xbd,0x40,0x48,0xc6,0xc9,0x3c,0x37,0xf5,0x3d,0xd9,0x68,0x04,0xfe,0x66,0xb6,0x0a,0x72,
+  0xc6,0x79,0x72,0x00,0x7c,0x0b,0x38,0x46,0x27,0xde,0x1d,0x9d,0x74,0x33,0xca,0xdb,0xed,0xca,0x59,0xbc,
+  0xcb,0x35,0x38,0x10,0xa3,0x19,0xd4,0xaf,0x08,0xc5,0x33,0x19,0xc1,0x45,0x80,0xd8,0x44,0x72,0x56,0xe8,
+  0x1e,0x20,0x43,0xc4,0xa3,0x39,0x27,0x48,0xcb,0x63,0xcf,0x6b,0xae,0x6b,0xcc,0x05,0x97,0x32,0xc8,0x51,
+  0x41,0x99,0xd6,0x54,0x18,0xef,0x0c,0x51,0x19,0x27,0x92,0x27,0x2a,0x85,0xb5,0x4b,0xaa,0x4c,0xbc,0x69,
+  0xa1,0xe9,0x0b,0x39,0xa0,0x94,0xa0,0x39,0xf5,0x09,0xc5,0xf9,0x24,0xd6,0x04,0xcf,0xe4,0xa9,0xb9,0x82,
+  0xf2,0xda,0x64,0x68,0xf8,0x30,0xba,0xac,0x9f,0xe4,0x6a,0x4c,0xb4,0x2c,0xc2,0x2d,0xa2,0xed,0x8b,0x13,
+  0x88,0xd9,0x8d,0xd9,0x51,0x40,0x1d,0xe2,0x38,0xac,0x6b,0xfa,0x82,0x6d,0x51,0x8f,0x4f,0x76,0x0c,0x55,
+  0x74,0x6f,0xaf,0xc3,0xe9,0x8f,0xbf,0x50,0xc1,0x50,0x96,0xf6,0xba,0xfb,0x1d,0x5e,0x88,0x49,0x37,0xd5,
+  0x5d,0x75,0xf1,0x9e,0x4a,0x89,0xa8,0x3b,0x1f,0x44,0xaa,0xc8,0xbe,0xc3,0x24,0xaf,0x8e,0x5f,0x3f,0xef,
+  0x51,0xe1,0x4a,0x47,0xbc,0x38,0x3a,0x3b,0xef,0x7d,0xf7,0x18,0xdf,0x9e,0xbe,0x3f,0xfb,0xf1,0xe3,0x0f,
+  0xaf,0x4e,0x8f,0xdf,0xfc,0x60,0xde,0x99,0x6d,0x3b,0xc7,0xf4,0x8d,0x42,0x4d,0xa3,0x2f,0x05,0x96,0x19,
+  0x5a,0xc0,0xcd,0xc2,0xb5,0x32,0x8b,0xca,0xf6,0x30,0x4b,0xd9,0x64,0x59,0x83,0x59,0x65,0x52,0x4b,0xd5,
+  0x62,0x66,0x71,0x49,0x0c,0x19,0x4e,0x43,0x32,0xa2,0xb2,0x25,0xd5,0x68,0x54,0x42,0xac,0x49,0x46,0xb2,
+  0x49,0x2e,0xa0,0xa9,0x2d,0xed,0x52,0x26,0x36,0x29,0xcc,0x24,0x61,0x6d,0x55,0xee,0x57,0xb9,0x41,0xfa,
+  0xb5,0x7d,0x1f,0x0b,0x89,0x8e,0x55,0x5e,0x70,0xfd,0x80,0x4a,0x9e,0xba,0x33,0x99,0x92,0x97,0xb6,0x19,
+  0xfe,0x92,0xb6,0xb6,0x8a,0x17,0x5d,0x12,0xf7,0xcb,0x83,0xd1,0x8d,0x45,0x6e,0xb5,0x22,0x95,0xfe,0xbf,
+  0x68,0xf3,0xce,0xd0,0xa7,0x82,0x61,0xa4,0x36,0x80,0xfc,0x85,0x7c,0xf2,0x48,0x05,0xa9,0x6c,0x66,0xd1,
+  0x30,0x98,0x4f,0x67,0xbe,0x35,0xbd,0xb7,0x81,0x83,0x13,0x88,0x7f,0xe9,0xdb,0x4a,0x3e,0x0a,0x40,0x68,
+  0x60,0xaf,0x19,0x69,0x58,0x01,0x61,0x69,0x6e,0xd7,0x6e,0x39,0x6f,0x0e,0x44,0xfd,0xd0,0xb7,0x45,0x3c,
+  0x06,0x68,0xa4,0x20,0x1f,0x2b,0x25,0x6f,0x09,0x77,0xbb,0xed,0xef,0x1d,0x34,0x85,0x93,0xb5,0xe5,0x49,
+  0x9d,0xec,0xe3,0xe4,0x1e,0x7c,0x24,0xff,0xf7,0x2c,0xf8,0xfb,0xf8,0xfb,0x5b,0x6e,0x9b,0x65,0x0b,0xff,
+  0x61,0x47,0xd4,0x83,0xba,0xfb,0xe5,0x8e,0x53,0x55,0x28,0xd1,0xbb,0x5a,0xcb,0x68,0x8f,0x3c,0x86,0x46,
+  0x87,0x29,0x86,0x06,0xdf,0xdb,0x91,0x56,0xe3,0xb8,0xce,0x95,0x5a,0x48,0xb5,0x44,0xcf,0x7c,0x27,0x8d,
+  0xab,0x08,0xa6,0x11,0x66,0x46,0xf3,0x44,0x35,0x68,0xc6,0xdd,0x2a,0x1e,0x98,0x74,0xa1,0x99,0x96,0x28,
+  0xe1,0x5b,0x03,0x1b,0xd1,0x82,0x1c,0x9a,0xad,0xae,0x59,0x03,0xf3,0x2c,0x8f,0x6e,0x61,0x1c,0x68,0x8b,
+  0xa0,0x69,0x89,0x9f,0xcb,0x53,0x56,0x78,0xf7,0xeb,0x15,0xed,0xf0,0x1b,0xc7,0x20,0x1c,0xb4,0xd0,0x73,
+  0xc5,0xc0,0xae,0x89,0xe4,0xf4,0xb8,0x54,0x80,0xf7,0xf1,0xf2,0x44,0x35,0xf9,0x8c,0x30,0x9b,0x4c,0x40,
+  0xff,0xfe,0xda,0xc4,0xa5,0xd2,0xb3,0x40,0xcc,0x2c,0xe7,0xfb,0xe6,0xc0,0xdb,0x40,0xb7,0xc2,0x6a,0x90,
+  0x21,0xcc,0xd6,0x5b,0xad,0xd2,0xac,0x12,0x17,0xdb,0xc2,0x64,0x71,0x2d,0x39,0xe4,0x57,0xae,0xb0,0xf1,
+  0x30,0xad,0x02,0x94,0x10,0x1c,0xad,0x6c,0x8a,0x9d,0x39,0x3c,0x6d,0xd6,0x97,0xd5,0xd5,0x53,0x41,0x5d,
+  0x61,0x4c,0x05,0xc9,0xfd,0xaa,0x24,0xce,0xd0,0xa4,0xc8,0xfa,0xd4,0x7c,0xb8,0x9a,0xb7,0xf4,0x2a,0x94,
+  0xb6,0xff,0x6d,0x87,0xcb,0x0f,0x7b,0x75,0x19,0x35,0x57,0xe8,0xf9,0x5e,0xb5,0x15,0xc2,0x04,0xdc,0x70,
+  0xad,0x6c,0x0f,0xf6,0x0c,0x86,0x2f,0xcb,0xa9,0x49,0xc7,0xe3,0x54,0x26,0x3d,0x9e,0x86,0x01,0xda,0x86,
+  0x2a,0x57,0x7e,0x1b,0x58,0x6b,0x11,0xc2,0xf2,0xa6,0xf5,0xfc,0xb9,0xc9,0x23,0x6c,0xe7,0x61,0x76,0x49,
+  0x82,0x88,0xe0,0x82,0xbd,0xe7,0xe7,0x54,0xc5,0xea,0x7b,0x2f,0xcf,0xcf,0xdf,0x0a,0x6f,0x27,0x0f,0xeb,
+  0x30,0xc5,0x9e,0x16,0x85,0x9f,0x34,0xa1,0x4f,0x49,0x84,0xd5,0x90,0x23,0x03,0xb9,0xc8,0x82,0xa6,0xb1,
+  0xc8,0x30,0x06,0xf2,0x6c,0xc8,0xba,0x77,0xd0,0x26,0x2a,0xd7,0xa2,0x52,0x07,0xf6,0x0b,0xfd,0xa8,0x31,
+  0xc3,0x90,0x92,0x18,0xf5,0x14,0x1f,0xef,0x31,0xc5,0xce,0x4e,0x7b,0x8a,0xf2,0xcd,0x93,0x87,0x87,0x5c,
+  0x8d,0xd6,0x33,0x05,0x6d,0x1b,0x96,0x82,0x69,0x30,0xa8,0x12,0x12,0x2b,0xa6,0x68,0x72,0xc5,0xea,0xb6,
+  0x36,0xa0,0x8c,0x7a,0xcf,0xa5,0x44,0x25,0x1f,0xa4,0x04,0x54,0x88,0x18,0x56,0xda,0x40,0x52,0x7b,0x73,
+  0x5b,0x0b,0x1d,0xbd,0x28,0x7d,0xbc,0xd2,0xc4,0xaf,0xd4,0x37,0xfb,0xee,0x57,0x6a,0xdd,0xcd,0x92,0xda,
+  0x51,0x73,0xf8,0x71,0x02,0x89,0x74,0x89,0xc9,0x4d,0x07,0xf4,0xd7,0xd8,0xf3,0x5b,0xab,0x37,0xa2,0xf2,
+  0x28,0xbd,0x68,0x66,0xfc,0x21,0x4e,0x6c,0xd9,0x0a,0xb3,0x52,0x27,0x9a,0xdd,0x60,0xf9,0x66,0x7c,0x3a,
+  0xe7,0x9e,0xcc,0x98,0x15,0xdb,0x57,0x27,0x9a,0x52,0xbd,0xbb,0x64,0xcc,0x83,0x1d,0x4f,0xaf,0x06,0x33,
+  0xca,0x20,0xd7,0x00,0x62,0x7d,0x66,0x1e,0xcf,0x6d,0xe4,0xab,0x9d,0x0d,0x25,0xa7,0x8b,0x03,0x97,0x40,
+  0xa3,0xc1,0x86,0xcb,0x21,0x54,0x4d,0x37,0x28,0xd2,0x7a,0x2e,0x62,0xc3,0x68,0xc0,0x9b,0xfd,0x68,0xb0,
+  0xb2,0x68,0xde,0x2d,0x32,0x09,0x5a,0xe5,0x57,0xa3,0x81,0x43,0x07,0x0e,0xb4,0x38,0xdc,0xa8,0xaa,0xe5,
+  0x21,0x24,0x66,0x4b,0xae,0x4c,0x4c,0xcd,0xd9,0xb5,0x1c,0xaf,0x6a,0x81,0xaa,0x97,0x59,0x5a,0x59,0xe7,
+  0x63,0xf8,0xde,0x4c,0x85,0x12,0x7e,0x2d,0x4c,0xe1,0x95,0x71,0x2b,0xb9,0xf8,0x96,0xc7,0x39,0xbe,0x66,
+  0x73,0x36,0xe7,0x05,0x4b,0xa8,0x1d,0xe9,0x12,0x25,0x02,0xcb,0x94,0x2a,0x02,0x37,0x32,0x2a,0xdb,0x9a,
+  0xfd,0xaa,0x80,0xb3,0x11,0xcf,0x96,0xed,0x35,0x9a,0xac,0x2f,0xad,0xa5,0x38,0x9a,0x43,0x6b,0x72,0xee,
+  0x39,0x10,0x8f,0x09,0x37,0x52,0xa2,0x43,0xb1,0x86,0xf1,0xd8,0xa2,0xf7,0xa8,0x70,0x46,0xd7,0x3d,0xb9,
+  0xa3,0xf5,0x2c,0x7b,0xa5,0x63,0xc1,0xa9,0x40,0x4d,0x65,0x48,0x78,0x03,0x03,0xbf,0x4f,0x20,0x19,0xda,
+  0x8e,0xc7,0x36,0x90,0x73,0x95,0x3b,0xa6,0x89,0xde,0x1f,0x7a,0xb0,0x15,0x10,0x49,0xbc,0x36,0x12,0x18,
+  0x6c,0x35,0xcf,0x8f,0x0d,0x9c,0x87,0x14,0x51,0x9e,0x66,0x15,0x08,0x6d,0x7b,0xaf,0xec,0xfc,0x88,0x3a,
+  0x57,0xab,0xe7,0x88,0x40,0xad,0xe9,0xfa,0x6d,0xb3,0x2b,0xf9,0x0b,0x5c,0x8e,0xc3,0x81,0x6b,0xdd,0x3e,
+  0xcc,0xa6,0xb3,0x44,0x15,0xca,0xab,0xaf,0x9d,0xd4,0xd7,0x0c,0xf4,0xb8,0x53,0xae,0xf6,0x90,0x4c,0x6d,
+  0x65,0xfb,0xb6,0xd6,0x68,0x34,0xdf,0x8f,0xaa,0xe9,0x75,0x4f,0x3d,0xb2,0x1a,0x14,0x2c,0x55,0xbf,0xa1,
+  0xad,0x06,0xf6,0x55,0x56,0xab,0x12,0xe9,0x99,0xf5,0x47,0xd9,0x30,0x89,0x15,0xb6,0x4a,0xb0,0xb1,0x5a,
+  0xbd,0xd9,0x56,0x36,0x8f,0x2d,0xa8,0x63,0xd5,0x3a,0xe2,0xdb,0xc7,0x54,0xf7,0xef,0x7a,0x05,0x4d,0x85,
+  0xe8,0xee,0x9b,0x5b,0x31,0x50,0x68,0x84,0x9f,0x14,0xed,0x4e,0xb1,0xf7,0x8a,0x3f,0xbf,0x7d,0xb5,0xcb,
+  0xe9,0xa1,0x5c,0x8d,0x40,0xd9,0x89,0x8d,0x37,0xb9,0x18,0x0a,0x02,0x69,0x8a,0xdb,0x0e,0x9c,0x8b,0x04,
+  0x0b,0xc4,0xe9,0x5c,0xd2,0x4c,0xd7,0x05,0xb4,0x5f,0xe5,0x15,0xcc,0xcd,0x3a,0xa7,0x46,0xbd,0x71,0x88,
+  0x74,0x44,0x09,0x48,0x2e,0x16,0x76,0xef,0xeb,0xac,0xc8,0xe4,0x30,0x98,0xe5,0x4c,0x4e,0x4d,0x84,0xea,
+  0xf6,0x42,0x65,0xe9,0x08,0xea,0x47,0x42,0xab,0x0e,0xfc,0x84,0xd3,0xe8,0x54,0x71,0xb2,0x43,0xc2,0x48,
+  0x7c,0xc5,0x0d,0x25,0xce,0xf4,0x84,0xb3,0x5c,0xd1,0x80,0x63,0x35,0x92,0xd0,0x42,0xbf,0x32,0x17,0xe5,
+  0x21,0x26,0x91,0x98,0x41,0xb7,0xce,0xce,0x4c,0xdd,0xf7,0x07,0x3e,0xce,0x79,0x60,0x26,0x79,0x70,0xd1,
+  0xe1,0x93,0x9e,0x56,0xa3,0xe7,0xc0,0x6c,0xd5,0x72,0x97,0x45,0x95,0xcd,0xfb,0x4d,0x16,0x25,0x11,0xcd,
+  0x29,0x3f,0x47,0x01,0x3d,0x83,0xe2,0x32,0xe7,0x06,0x76,0x26,0x73,0x50,0x22,0xb8,0xba,0x5a,0xbb,0x2e,
+  0xd6,0xae,0xc7,0xc5,0xfa,0x85,0xb9,0x70,0x64,0x3a,0xdd,0x59,0xc0,0xdd,0xea,0xd5,0xa8,0xe2,0x6e,0x43,
+  0xe6,0xe2,0xe2,0x15,0xa0,0x77,0xeb,0x2a,0xe5,0x7a,0xc8,0x8a,0xfa,0xe0,0xd5,0x75,0xf0,0x2d,0x12,0x9a,
+  0x05,0x70,0x34,0xd9,0x8e,0x07,0xc8,0xe5,0xe1,0xfb,0x5b,0x53,0x98,0xa1,0x98,0x88,0xc7,0x9a,0x2a,0x76,
+  0x4c,0x46,0xc6,0x5e,0x30,0x69,0x41,0x63,0xa4,0x83,0xa6,0x4d,0xf2,0xce,0x20,0xcf,0x5c,0x1c,0x95,0x89,
+  0x48,0xea,0xc9,0x20,0x93,0x79,0x84,0xcd,0x92,0x75,0x50,0x14,0x7c,0xdd,0xf5,0xd1,0x5e,0xf7,0xbb,0x3d,
+  0x4d,0x97,0x67,0xea,0xcb,0x3e,0xd0,0x29,0x97,0x22,0xe4,0xf5,0x12,0x87,0x2a,0xd7,0xbb,0x7a,0x0b,0x24,
+  0x0d,0x51,0x44,0x3e,0x4f,0xa9,0xc2,0x8a,0x6f,0x34,0xd1,0x8c,0x53,0xe8,0xed,0x54,0x98,0x5a,0x70,0xe1,
+  0x9b,0x49,0x02,0x31,0x50,0x23,0x52,0x6c,0x73,0x71,0x96,0x6b,0xa8,0x28,0x97,0x01,0x85,0x76,0x21,0x46,
+  0x46,0x8e,0xc5,0xfe,0x63,0x5d,0xde,0x8e,0xb1,0xb5,0x76,0xec,0xca,0x53,0xf5,0xde,0x34,0x8e,0x6c,0x9d,
+  0x79,0x28,0xfe,0xc8,0xf7,0x6f,0xd1,0xfd,0xe1,0x9e,0xcd,0x6a,0x54,0xf7,0x32,0xcd,0xe0,0x13,0x52,0xfd,
+  0x92,0xab,0x87,0xd4,0x0f,0xff,0x60,0xd8,0xf7,0x61,0x95,0x5a,0xbc,0x07,0x9d,0xfa,0x66,0xb9,0x87,0xeb,
+  0xae,0x38,0x35,0x62,0x0a,0xbe,0x9e,0x57,0xce,0xd2,0xbc,0xa3,0x59,0x07,0x18,0x46,0xab,0x6d,0x86,0xec,
+  0x66,0xaa,0x8a,0x49,0x16,0xf5,0xbc,0xb7,0x6f,0xce,0xce,0x41,0xf5,0x41,0x16,0x5d,0xf7,0xda,0x17,0xa0,
+  0x3a,0xad,0xc2,0xaa,0x89,0x92,0x11,0x8c,0x65,0xef,0xc6,0xb3,0xb9,0xc2,0x2e,0xdd,0x2a,0xc5,0x0e,0x43,
+  0xde,0x30,0xa9,0x17,0x40,0xef,0x7e,0xee,0x2e,0x16,0x0b,0x36,0x5e,0xdd,0x79,0x9e,0x98,0xb3,0xbe,0xc8,
+  0xbb,0x6d,0xc3,0xb2,0xd1,0x8b,0xb8,0x47,0x3c,0xb3,0x26,0xa6,0xa9,0xc2,0x14,0x4a,0x5e,0xfa,0x41,0xab,
+  0x47,0x51,0xf7,0xb8,0xc9,0x2e,0x7b,0x14,0xfc,0x80,0x46,0xbd,0xe2,0x96,0xdd,0x78,0xb1,0x11,0xb8,0x4d,
+  0xc8,0xd7,0xff,0xd8,0x8d,0xcb,0x5a,0x5b,0x11,0xc5,0x20,0x8d,0x5e,0x7c,0x43,0xf8,0xd2,0x38,0x1b,0x3c,
+  0x5d,0xe5,0x7a,0x84,0x45,0xb3,0x67,0x81,0x4d,0xdc,0x24,0x68,0x3f,0xa1,0xc3,0x9f,0xce,0xde,0x9c,0xd2,
+  0x8d,0x5c,0xad,0x7c,0xee,0x0b,0xf4,0x18,0xcc,0xf6,0xf6,0x27,0x80,0x39,0xb0,0x60,0x3e,0x85,0xf6,0x96,
+  0x1d,0xd9,0x11,0x3f,0xbb,0x3c,0xf4,0xc8,0x91,0x02,0xf1,0xdf,0x29,0xd8,0x53,0xe8,0xa3,0x75,0x2c,0x68,
+  0x71,0xc2,0x44,0x51,0x08,0x9e,0x6e,0x97,0xd6,0x61,0x15,0xfe,0xa6,0xc5,0x0f,0x08,0x7c,0xed,0x60,0xa4,
+  0x08,0x11,0x59,0x93,0x6c,0xb1,0xaf,0xa6,0x9b,0xc9,0xbc,0xe1,0x25,0x75,0x3e,0x98,0x2e,0x8d,0x9a,0x6c,
+  0xae,0x31,0xe0,0x9d,0x65,0x88,0xc6,0x5e,0x50,0x79,0x24,0xef,0x9f,0x7c,0x62,0x20,0xe0,0x37,0x8d,0xe8,
+  0xc6,0x3c,0x5f,0x8b,0x37,0x07,0x25,0x61,0x5b,0x38,0x5c,0xeb,0x61,0x6a,0xb9,0xd7,0xb8,0xdb,0x90,0x75,
+  0x7f,0xc9,0xb9,0x82,0xb3,0xb4,0x43,0x4e,0x0d,0x95,0x96,0x1f,0xd6,0xf6,0xa4,0xe7,0x55,0x35,0xf1,0x6d,
+  0xa2,0x6c,0x53,0x68,0xbc,0xaa,0x8e,0xbf,0xdd,0xb9,0x95,0x63,0x2b,0xff,0x39,0xee,0x7e,0x65,0x02,0x57,
+  0x50,0x18,0x94,0x8f,0xe1,0x3f,0x7c,0x23,0x8c,0x11,0xa8,0x0e,0x28,0x4d,0xf9,0xb0,0xb5,0x52,0x3b,0xa2,
+  0xbc,0x6c,0x42,0x39,0xea,0x08,0x4c,0x0e,0x05,0xdd,0x20,0xe7,0xf2,0xd4,0x36,0x81,0xcd,0x15,0x54,0x2e,
+  0x83,0x36,0xc0,0xa9,0xd2,0xd4,0xa4,0xae,0xcb,0x5b,0xff,0xe6,0x56,0x95,0xce,0xf8,0x29,0xc3,0x08,0xba,
+  0x52,0x27,0xa8,0x2a,0x59,0x2f,0x03,0xe4,0x11,0x19,0x5f,0x24,0xd4,0x64,0xe7,0x60,0xf3,0x0a,0xba,0x4b,
+  0xb8,0x00,0xbf,0x09,0x25,0x53,0xec,0x2a,0x0d,0xad,0xec,0x11,0x71,0x79,0xfd,0x73,0x23,0x17,0xd9,0x2f,
+  0x25,0x76,0xb0,0x4b,0xba,0x96,0x11,0xe5,0xdd,0x89,0xe6,0xbf,0xfb,0x5d,0x03,0xd8,0x34,0x66,0xf3,0xa5,
+  0x80,0x55,0x63,0x9b,0x05,0x3b,0x66,0xec,0x2f,0x7f,0xff,0x4f,0x51,0x92,0x99,0xb7,0x0c,0x26,0x0c,0x9f,
+  0x4b,0xd0,0xdd,0x20,0x02,0xfa,0xcb,0xdf,0xff,0x5b,0x9c,0xf1,0xcf,0x28,0xb0,0x28,0xae,0xe8,0xb5,0x7a,
+  0xba,0xf6,0x85,0x1a,0xe6,0x06,0xe8,0xcb,0x89,0x77,0xf3,0xc6,0xee,0x51,0x35,0x7f,0x48,0x4e,0x8a,0x12,
+  0x6e,0x0b,0xea,0xed,0x57,0x09,0xee,0xcd,0x3f,0xc8,0xba,0xa5,0x0b,0x1d,0xed,0x0e,0xeb,0x76,0xb1,0x55,
+  0x2a,0x47,0xbb,0x19,0xa6,0xfb,0xdd,0xde,0x5e,0x8f,0x36,0xc9,0x0d,0x3a,0x68,0x7d,0x3c,0x84,0x43,0x45,
+  0x72,0x5d,0xb9,0xe7,0xf0,0xd7,0xf5,0xae,0x09,0xcb,0x6a,0x4f,0xdd,0x6c,0x7c,0x5b,0xeb,0x48,0xd4,0xdc,
+  0x0f,0x5a,0x49,0x28,0x2c,0xf9,0x57,0x6f,0x08,0xbc,0x45,0x33,0x5b,0x01,0x85,0x9c,0x55,0x7c,0x98,0x2a,
+  0xa5,0x7e,0xdf,0x63,0x47,0x86,0xf3,0x70,0x2d,0xa9,0x68,0xd0,0xbf,0x04,0xc1,0x57,0x2a,0x8d,0xad,0xaf,
+  0x22,0x43,0x16,0x0a,0x2e,0x81,0x72,0x6e,0xce,0x1a,0xab,0xd8,0xdc,0x17,0xc8,0x26,0xd2,0x3a,0x3a,0x62,
+  0x15,0x07,0x1d,0x67,0x7a,0xbb,0xdc,0x20,0x9a,0x4c,0xe5,0xec,0x44,0x70,0xb0,0x86,0x91,0x2b,0xf9,0x78,
+  0xdb,0x31,0xec,0x6b,0xc9,0xa2,0x63,0x29,0x8d,0xeb,0x79,0x97,0xdd,0xbd,0xad,0x9e,0x6e,0xab,0xa3,0x0d,
+  0x76,0x50,0xe8,0xc4,0x7a,0xc5,0x3d,0x6e,0xca,0x05,0xce,0x73,0x2a,0xc5,0x25,0x4c,0x4d,0xf8,0x05,0xe2,
+  0x80,0x14,0x69,0x9f,0x22,0x76,0x4a,0x9a,0x1b,0x3d,0x30,0xad,0x3f,0xf7,0xd3,0xfe,0x13,0x9b,0x68,0x4a,
+  0x03,0xec,0xc4,0x11,0x9b,0x67,0xff,0x61,0xc7,0xdb,0xf3,0x9c,0x7e,0xba,0xff,0xd7,0xdf,0xdc,0xfc,0xec,
+  0xf3,0x45,0xd0,0xf7,0xe7,0xcf,0x5e,0x66,0xf3,0x1c,0xc1,0x5d,0x70,0xdb,0x73,0x5b,0x4f,0xe2,0x14,0x41,
+  0xc3,0x72,0xfb,0x19,0xa5,0x49,0x22,0x6e,0x17,0x6e,0xbb,0x41,0x26,0xb8,0xed,0x36,0x80,0xc0,0xee,0x4c,
+  0xfc,0x60,0x67,0x9f,0xdb,0xcb,0x56,0xfa,0x9d,0x99,0x1f,0x39,0x9b,0x7f,0xfb,0xd7,0x1a,0x2b,0x95,0x6c,
+  0x88,0xb1,0x01,0xdc,0xdc,0x3f,0xe4,0xdc,0x1f,0x5d,0x76,0x56,0x89,0x2d,0x88,0xd3,0x74,0x76,0x6c,0x40,
+  0x9c,0xbc,0x39,0x3d,0x7f,0xf9,0xf1,0xec,0xe5,0x9b,0x77,0xe7,0xfd,0x0f,0xde,0x9f,0x24,0x95,0xba,0xbc,
+  0x50,0x03,0xfc,0x3d,0x91,0x39,0x95,0xc5,0xcf,0x72,0xfe,0x4e,0xb5,0x3d,0x7f,0x9a,0xa7,0xfc,0x97,0x4a,
+  0x63,0x8e,0xe6,0x63,0x4e,0x08,0x52,0xbd,0xf9,0x9b,0x61,0xc1,0xd7,0x42,0xae,0xf0,0xf7,0x58,0x0d,0xa9,
+  0xf8,0xbb,0xae,0x40,0x01,0xaf,0x64,0xf1,0x72,0x3e,0x78,0x46,0x6e,0x39,0xec,0x89,0xc3,0x92,0xa8,0xa8,
+  0x79,0x32,0xd5,0xee,0xb5,0x79,0x10,0xbb,0xcc,0xfe,0x15,0x2d,0x92,0xb7,0x79,0x44,0xa4,0x6e,0xf7,0xad,
+  0x19,0xb1,0xd4,0x5b,0xfc,0xdf,0xff,0x8a,0xe5,0x01,0x96,0x13,0xcb,0xbd,0x7f,0x73,0xe3,0x10,0xe8,0x43,
+  0x3d,0x81,0x61,0xd2,0x05,0x75,0xa8,0x1a,0x9b,0x3c,0x72,0x0e,0xe7,0x8b,0x6c,0x3c,0x4e,0x94,0xbd,0xf9,
+  0xa9,0x5d,0xa1,0x64,0x27,0x69,0x3d,0x0f,0xcb,0xbb,0x2a,0x6e,0x9a,0x84,0xd2,0xf9,0xfc,0xe8,0x9e,0x3e,
+  0x5a,0x21,0x85,0xe5,0xa0,0x6a,0x2b,0x7e,0xdd,0xac,0x8a,0x20,0x8b,0x53,0xff,0xd4,0xc3,0x8a,0x0e,0x74,
+  0x6f,0xdc,0x0c,0x6f,0x54,0x4c,0x94,0x63,0x96,0x56,0xf3,0xc7,0x24,0x1b,0xc8,0xe4,0x95,0xbd,0xd7,0xfb,
+  0x15,0x6b,0x1a,0xf3,0xc0,0xea,0x46,0xf0,0x3f,0xe1,0xd2,0x5e,0xa5,0xa3,0xec,0x2d,0x81,0xf9,0x8a,0x55,
+  0xc5,0x18,0xf3,0xcf,0xb0,0x14,0xba,0x7d,0xc7,0xa5,0x4b,0x09,0x5d,0xac,0x4b,0x12,0xde,0xff,0x26,0xf3,
+  0x81,0x58,0xd0,0x81,0x7e,0xf3,0x97,0xa0,0x30,0x48,0x26,0x02,0x82,0x4b,0x27,0xf7,0x10,0x35,0xb8,0x15,
+  0x74,0x35,0x8d,0x60,0x60,0x79,0xef,0xce,0x9f,0x91,0x09,0xb5,0x9a,0x12,0xec,0x1a,0x45,0x26,0x45,0xa1,
+  0xe6,0x63,0x83,0x8f,0x4f,0xcb,0xa3,0xcb,0x80,0x16,0x18,0x19,0x9c,0x50,0xd8,0x97,0x5c,0xe5,0xd1,0xdb,
+  0xb2,0x9e,0x25,0xe0,0x51,0xed,0x94,0x4a,0x46,0x7c,0xf1,0x8d,0xef,0x3a,0x15,0xd9,0x9c,0x8e,0x58,0x10,
+  0x5c,0xe6,0x74,0xe3,0x12,0x28,0x7a,0xda,0x5e,0x34,0x44,0x4c,0x44,0x8e,0xec,0x6e,0x79,0x8d,0x1a,0x3b,
+  0x52,0xb6,0x08,0xf8,0x67,0x5a,0x5e,0xc4,0x94,0xfd,0x05,0xbb,0xcc,0xdd,0x3c,0x76,0x9c,0xe1,0xe2,0x4a,
+  0x71,0x7c,0x76,0x5e,0xde,0xea,0x82,0x73,0x9d,0x63,0x43,0xd4,0xe5,0x94,0xd6,0x21,0x4e,0xe1,0xd8,0x71,
+  0xfd,0x4a,0xe1,0xfe,0xae,0x04,0x5c,0xb6,0xd7,0x84,0xbe,0xc5,0xfb,0x0d,0x53,0xc3,0x65,0xbe,0xa1,0x0f,
+  0xac,0x0a,0x25,0x0a,0xfd,0x7a,0x1f,0x21,0x31,0x20,0x6a,0xfc,0x0c,0x46,0x94,0xa3,0x9c,0x4d,0x63,0xc0,
+  0x3f,0x46,0xc3,0xed,0xeb,0x8a,0x5f,0x2b,0xc8,0x7c,0x75,0xe5,0x1b,0xfa,0x11,0x91,0xfe,0x3e,0x73,0xbf,
+  0x3c,0x19,0x24,0x02,0xcc,0x8b,0x61,0xd7,0xf4,0xf4,0x96,0xc3,0xf7,0x7f,0x28,0x32,0x37,0xc1,0xff,0xc0,
+  0xba,0x40,0x6d,0xe7,0x07,0x31,0x24,0x97,0x19,0xad,0xfd,0xd5,0x9f,0x15,0x3f,0xd3,0x03,0x91,0xe8,0x3f,
+  0x61,0xa7,0xb2,0xbd,0x17,0x73,0x49,0xd3,0x1a,0x5a,0x9b,0xdf,0x16,0x6a,0xa6,0x4e,0xa9,0xad,0x4c,0x4d,
+  0xf9,0xe5,0x0f,0x0a,0x0d,0xd4,0x98,0xae,0xf7,0x44,0xe6,0xc7,0x50,0x9c,0x1a,0x22,0x9b,0x92,0x12,0x7e,
+  0x94,0xc7,0x74,0xa1,0x8f,0x3c,0xc1,0x8e,0x09,0x16,0x3b,0x75,0xe9,0x50,0xc7,0x71,0x95,0x82,0x2d,0x5a,
+  0xdd,0xda,0x1f,0x36,0xe3,0xa8,0xbc,0xda,0xb8,0x74,0x91,0x3b,0x07,0xd3,0xdb,0xf4,0x58,0x6e,0x56,0xa7,
+  0xf2,0xb4,0x2a,0xa5,0x39,0x1a,0x0e,0xd5,0x0c,0x01,0xd9,0xcb,0x97,0xbd,0x93,0x13,0xda,0x6b,0x8e,0x8f,
+  0x05,0x36,0x0b,0xf1,0x23,0xfe,0x3d,0xa0,0xa2,0xa5,0x44,0x8d,0xe5,0xf0,0xda,0x76,0xe8,0x9d,0x9d,0xa1,
+  0x43,0xf7,0xe4,0xa4,0xcb,0xef,0x19,0x88,0x11,0x9d,0x29,0xff,0x8e,0x47,0x1e,0xf2,0xf5,0x5b,0x7f,0xf7,
+  0xdf,0xfd,0x9f,0xa2,0x9b,0x87,0xb7,0x41,0xcf,0x7e,0xfa,0x87,0xbd,0xf2,0x6b,0x70,0xf8,0x93,0xfe,0xed,
+  0x87,0x9f,0xe6,0x7b,0x7b,0x83,0xdf,0xfd,0xd4,0xbd,0xc0,0x03,0xbd,0xd8,0xef,0xe0,0xd5,0x4f,0x7a,0xc7,
+  0xff,0x70,0xd4,0xfd,0x37,0xd9,0xfd,0xf9,0xe2,0xe6,0x91,0x79,0xc6,0xbb,0x6f,0x6f,0x83,0xdf,0xec,0x3a,
+  0x29,0xf7,0x3a,0x5f,0x6c,0xe7,0xe6,0x64,0xa8,0xb3,0xef,0x55,0xe9,0xc7,0xe9,0x87,0xc7,0x17,0x8d,0x93,
+  0x20,0xea,0xfa,0xbd,0xd8,0x5b,0x26,0x45,0x09,0xab,0xbc,0x45,0xce,0xc5,0x0a,0x30,0x35,0xfe,0xce,0xf4,
+  0xc3,0x77,0x17,0x1d,0x9a,0xa3,0x23,0xf0,0xfd,0xdb,0x0b,0xfe,0xd8,0x37,0x1f,0x0f,0xe9,0xcd,0x87,0x47,
+  0x17,0x30,0x6e,0x3b,0xfc,0xd9,0x13,0x75,0x08,0x60,0xa7,0x88,0x35,0x26,0xf1,0x19,0x2e,0x95,0x6e,0xe0,
+  0x81,0x6e,0xb0,0xd1,0x63,0xfb,0x74,0x8c,0xe8,0x67,0x8b,0x00,0x9f,0xf4,0xc5,0xfe,0x1f,0x5a,0xcb,0x7c,
+  0x09,0xb4,0x76,0xa8,0x8f,0x86,0x96,0x28,0x7f,0xaf,0xf3,0x10,0x0e,0xf2,0x49,0xb3,0xf1,0x51,0xe7,0x31,
+  0x1a,0xcf,0x9a,0x8d,0xdf,0x75,0x7e,0x1f,0x34,0x57,0x19,0x35,0x3b,0xfc,0xa1,0xb3,0xbf,0x1f,0xd0,0x1a,
+  0x9b,0xcd,0xfb,0x0f,0x3b,0xfb,0xdf,0xa2,0xfd,0xba,0xd5,0xfc,0xb8,0x03,0xdc,0xee,0x20,0xdb,0x35,0x81,
+  0xe3,0xda,0xb1,0x8e,0x78,0x09,0x34,0x81,0xd4,0xaf,0x23,0x4c,0x93,0x51,0xcd,0xdf,0xe2,0x23,0x45,0x33,
+  0xd2,0x6e,0x49,0x55,0x7a,0x99,0x9b,0x7e,0x5b,0x27,0x87,0x6d,0x4a,0xf9,0x87,0xef,0x6a,0xed,0x68,0x6e,
+  0x7b,0x25,0x1c,0x04,0xcf,0x45,0x2c,0x09,0x98,0xdf,0xfa,0xcd,0x1a,0x4e,0xae,0x07,0x21,0xb6,0x9a,0x69,
+  0x19,0xa4,0x9a,0x21,0x00,0x7e,0xa2,0xf1,0xd4,0x6f,0x69,0xa3,0x05,0xd5,0xe8,0x6b,0x37,0x31,0x4e,0xb4,
+  0x12,0x25,0x78,0x2c,0x51,0x82,0x12,0xad,0xe6,0x49,0x74,0x9d,0x3a,0x20,0x3b,0xb8,0x5a,0x7e,0x94,0xcb,
+  0x85,0xdf,0x92,0x11,0x74,0xe4,0xd4,0x6d,0x3d,0x0a,0x66,0xda,0x4c,0x54,0x52,0x7f,0xe9,0xe7,0x77,0x5a,
+  0x1e,0x2f,0x83,0x68,0x9c,0xdc,0x9a,0x89,0xaa,0x33,0xb9,0xca,0x87,0xa2,0x76,0x53,0xe8,0x54,0x55,0xc7,
+  0x36,0x0a,0xa8,0x72,0xaa,0x4d,0x34,0x17,0x90,0xf9,0x97,0xb1,0xaa,0x04,0xc8,0xcd,0x5d,0x85,0x66,0x2b,
+  0xcc,0x74,0xcd,0x6c,0x33,0x99,0x9b,0x0b,0x70,0x05,0xc1,0x86,0x58,0xfc,0xa3,0x6b,0xff,0x0f,0xc9,0x9f,
+  0xd6,0xc7,0xf0,0x52,0x00,0x00,
+};
@@ -9,10 +9,10 @@ namespace {
 
 NodeInfo* findRegisteredNode(const char* nodeId) {
   if (!nodeId || !nodeId[0]) return nullptr;
-  for (auto& node : registeredNodes) {
-    if (strncmp(node.nodeId.c_str(), nodeId, CMD_NODEID_LEN) == 0) return &node;
-  }
-  return nullptr;
+  char id[CMD_NODEID_LEN + 1];
+  strncpy(id, nodeId, CMD_NODEID_LEN);
+  id[CMD_NODEID_LEN] = '\0';
+  return registeredNodes.findById(id);
 }
 
 bool desiredFieldsMatch(const NodeDesiredConfig& cfg,
@@ -30,6 +30,16 @@ bool desiredFieldsMatch(const NodeDesiredConfig& cfg,
   if (options.overrideSyncSchedule &&
       (cfg.syncIntervalMin != options.syncIntervalMin ||
        cfg.syncPhaseUnix != options.syncPhaseUnix)) return false;
+  if (options.overrideAggregation &&
+      (cfg.aggSamplesPerReport != options.aggSamplesPerReport ||
+       cfg.aggStatsMask != options.aggStatsMask)) return false;
+  if (options.overrideRbe &&
+      (cfg.rbeMaxSilenceMin != options.rbeMaxSilenceMin ||
+       cfg.rbeDeadbandTenths != options.rbeDeadbandTenths)) return false;
+  if (options.overrideUrgent &&
+      (cfg.urgentFlags != options.urgentFlags ||
+       cfg.urgentAirBelowCenti != options.urgentAirBelowCenti ||
+       cfg.urgentSoilAboveMv != options.urgentSoilAboveMv)) return false;
   return true;
 }
 
@@ -188,6 +198,19 @@ NodeConfigApplyResult controlApplyNodeConfig(
     next.syncIntervalMin = options.syncIntervalMin;
     next.syncPhaseUnix = options.syncPhaseUnix;
   }
+  if (options.overrideAggregation) {
+    next.aggSamplesPerReport = options.aggSamplesPerReport;
+    next.aggStatsMask = options.aggStatsMask;
+  }
+  if (options.overrideRbe) {
+    next.rbeMaxSilenceMin = options.rbeMaxSilenceMin;
+    next.rbeDeadbandTenths = options.rbeDeadbandTenths;
+  }
+  if (options.overrideUrgent) {
+    next.urgentFlags = options.urgentFlags;
+    next.urgentAirBelowCenti = options.urgentAirBelowCenti;
+    next.urgentSoilAboveMv = options.urgentSoilAboveMv;
+  }
 
   if (!setDesiredConfig(command.payload.nodeId, next)) return out;
   if (!dispatcherBindNodeConfigVersion(command.payload.nodeId, dispatchRevision,
@@ -5,12 +5,24 @@
 
 // Optional local-only schedule metadata. Dashboard SET_NODE_CONFIG controls
 // wakeIntervalMin/targetState/sensorMask and leaves the existing sync rendezvous
-// fields untouched.
+// fields untouched. Aggregation mode, report-by-exception and urgent
+// thresholds are likewise Field UI-only: backend commands leave the stored
+// settings as they are.
 struct NodeConfigApplyOptions {
   bool     allowUnpair = false;
   bool     overrideSyncSchedule = false;
   uint16_t syncIntervalMin = 0;
   uint32_t syncPhaseUnix = 0;
+  bool     overrideAggregation = false;
+  uint8_t  aggSamplesPerReport = 0;
+  uint16_t aggStatsMask = 0;
+  bool     overrideRbe = false;
+  uint16_t rbeMaxSilenceMin = 0;
+  uint8_t  rbeDeadbandTenths = 0;
+  bool     overrideUrgent = false;
+  uint8_t  urgentFlags = 0;
+  int16_t  urgentAirBelowCenti = 0;
+  uint16_t urgentSoilAboveMv = 0;
 };
 
 struct NodeConfigApplyResult {
@@ -21,6 +21,8 @@
 #include "system/wake_reason.h"
 #include "system/hardware_identity.h"
 #include "time/rtc_alarm.h"
+#include "time/node_clock_skew.h"
+#include "time/rendezvous_history.h"
 #include "comms/espnow_sync.h"
 #include "storage/sd_logger.h"
 #include "storage/flash_logger.h"
@@ -33,12 +35,22 @@
 #include "config/sim_settings.h"
 #include "storage/upload_queue.h"
 #include "storage/json_payload.h"
+#include "storage/status_delta.h"
+#include "storage/carry_forward.h"
 #include "comms/modem_driver.h"
+#include "comms/urgent_relay.h"
+#include "comms/upload_pacing.h"
+#include "comms/upload_planner.h"
+#include "comms/registration_cache.h"
 #include "protocol.h"
+#include "time/sync_cohorts.h"
+#include "urgent_listen.h"
+#include "comms/upload_pipeline.h"
 #include "firmware_identity.h"  // role/version/build/hw identity (FW_GIT injected)
 #include "ota/mothership_selfupdate.h"
 #include "ota/mothership_ota_release_store.h"
 #include "ota/mothership_ota_cloud_fetch.h"
+#include "ota/fleet_ota_distributor.h"
 #include "command_dispatcher.h"
 #include "control/backend_command_ingest.h"
 #include "control/node_config_control.h"
@@ -67,6 +79,12 @@ SET_LOOP_TASK_STACK_SIZE(16 * 1024);
 // 120 s, the modem still has ~180 s to power on, register and upload.
 static constexpr uint32_t kSyncSessionLimitMs = 300000UL;  // 5 min
 
+// Backfill over two CCH sessions (comms/upload_pipeline.h); 0 = one POST at a
+// time through httpsPost(), for A/B on the bench.
+#ifndef MOTHERSHIP_PIPELINED_UPLOAD
+#define MOTHERSHIP_PIPELINED_UPLOAD 1
+#endif
+
 // ---------------------------------------------------------------------------
 // Upload subsystem globals
 // ---------------------------------------------------------------------------
@@ -172,6 +190,7 @@ static bool markControlConverged(const char* nodeId,
 
 static BackendIngestResult ingestBackendResponse(const String& responseBody) {
   deploymentIngestAckResponse(responseBody);
+  statusDeltaIngestResponse(responseBody);
   const uint32_t rtcBefore = getRTCTime();
   const bool rtcTrusted = rtcBefore >= 1704067200UL;
   Serial.printf("[CONTROL] HTTP response body bytes=%u\n",
@@ -245,7 +264,9 @@ static void boundedRetryAndShutdown(const char* context) {
 // ---------------------------------------------------------------------------
 // ESP-NOW snapshot processing (main task only)
 // ---------------------------------------------------------------------------
-static void sendSnapshotAck(const uint8_t* mac, const DecodedSnapshot& decoded, bool persisted) {
+// sendFull: the report-by-exception merge had no reference (SNAPSHOT_ACK_SEND_FULL).
+static void sendSnapshotAck(const uint8_t* mac, const DecodedSnapshot& decoded, bool persisted,
+                            bool sendFull) {
   if (!mac) return;
 
   snapshot_ack_t ack{};
@@ -254,16 +275,19 @@ static void sendSnapshotAck(const uint8_t* mac, const DecodedSnapshot& decoded,
   ack.seqNum = decoded.seqNum;
   ack.persisted = persisted ? 1 : 0;
   ack.protocolVersion = decoded.protocolVersion;
+  ack.flags = sendFull ? SNAPSHOT_ACK_SEND_FULL : 0;
 
   const bool sendResult = sendSnapshotAckNow(mac, ack);
-  Serial.printf("[SNAP-ACK] %.15s seq=%lu persisted=%u proto=%u send=%s\n",
+  Serial.printf("[SNAP-ACK] %.15s seq=%lu persisted=%u proto=%u flags=0x%02X send=%s\n",
                 ack.nodeId, static_cast<unsigned long>(ack.seqNum),
                 static_cast<unsigned>(ack.persisted),
-                (unsigned)ack.protocolVersion,
+                (unsigned)ack.protocolVersion, (unsigned)ack.flags,
                 sendResult ? "OK" : "FAIL");
 }
 
-void processSnapshot(const DecodedSnapshot& decoded, const uint8_t* mac) {
+// Takes the snapshot by mutable reference: both callers hand over a drained
+// queue slot they are about to discard, so it is stamped and completed in place.
+void processSnapshot(DecodedSnapshot& decoded, const uint8_t* mac) {
   if (!mac) return;
 
   char macStr[18];
@@ -278,16 +302,37 @@ void processSnapshot(const DecodedSnapshot& decoded, const uint8_t* mac) {
                 (unsigned)decoded.sensorPresent, (unsigned)decoded.protocolVersion,
                 batV ? *batV : 0.0f, airT ? *airT : 0.0f, airH ? *airH : 0.0f);
 
+  // Low-latency listening: an URGENT frame is persisted on arrival, and the
+  // node still queues the sample and sends it again at its sync slot. That copy
+  // is ACKed as persisted without writing a second row.
+  const bool urgent = (decoded.snapFlags & SNAP2_FLAG_URGENT) != 0;
+  if (urgentWasPersisted(decoded.nodeId, decoded.seqNum, decoded.nodeTimestamp, !urgent)) {
+    // The queued copy still moves the report-by-exception reference on, in
+    // order, which the out-of-order urgent frame did not.
+    const bool merged = urgent || carryForwardApply(decoded);
+    Serial.printf("[URGENT] %.15s seq=%lu already persisted - ACK only\n",
+                  decoded.nodeId, static_cast<unsigned long>(decoded.seqNum));
+    sendSnapshotAck(mac, decoded, true, !merged);
+    return;
+  }
+
   // Stamp the deployment the sample was actually taken under, BEFORE it reaches
   // the CSV buffer — so a reading recorded before a redeploy but uploaded after
-  // it keeps the old deployment. `decoded` is a const reference, so stamp a copy
-  // rather than casting away const.
-  DecodedSnapshot stamped = decoded;
-  stamped.deploymentEpoch = resolveEpochForSample(stamped.nodeId, stamped.nodeTimestamp);
+  // it keeps the old deployment.
+  stampDeploymentEpoch(decoded);
+  // Report-by-exception: fill the channels the node held back from the last
+  // values it sent, so the row and fault detection below see every channel.
+  // The merge compacts readings[], so look the battery channel up again. An
+  // urgent frame is always full and may overtake queued samples, so it is left
+  // out of the reference the queued ones are rebuilt from. Without a reference
+  // the row keeps only what was sent, and the ACK asks the node for a full
+  // snapshot next.
+  const bool merged = urgent || carryForwardApply(decoded);
+  batV = decoded.find(SENSOR_ID_BAT_V);
 
   bool persisted = false;
   if (flashIsReady()) {
-    const bool flashSaved = logDecodedSnapshot(stamped);
+    const bool flashSaved = logDecodedSnapshot(decoded);
     persisted = persisted || flashSaved;
     if (!flashSaved) {
       Serial.println("[SNAP] Flash logging failed");
@@ -295,48 +340,56 @@ void processSnapshot(const DecodedSnapshot& decoded, const uint8_t* mac) {
   }
   if (sdIsReady()) {
     String archiveRow;
-    const bool sdSaved = formatDecodedSnapshotCSVRow(stamped, archiveRow) &&
+    const bool sdSaved = formatDecodedSnapshotCSVRow(decoded, archiveRow) &&
                          sdLogCSVRow(archiveRow);
     persisted = persisted || sdSaved;
   }
   if (!persisted) {
     Serial.println("[SNAP] No storage accepted the snapshot");
   }
-  sendSnapshotAck(mac, decoded, persisted);
-
-  for (auto& n : registeredNodes) {
-    if (strncmp(n.nodeId.c_str(), decoded.nodeId, 16) == 0 ||
-        memcmp(n.mac, mac, 6) == 0) {
-      // A received snapshot is the strongest possible evidence of contact, and
-      // it must stamp the durable absolute time too — not just the millis-based
-      // session value, which is worthless to the next boot.
-      noteNodeContact(n);
-      if (batV && !isnan(*batV)) {
-        n.lastReportedBatV = *batV;
-      }
-      if (decoded.nodeTimestamp > 0 && decoded.nodeTimestamp > n.lastNodeTimestamp) {
-        n.lastNodeTimestamp = decoded.nodeTimestamp;
-      }
-      // Configured-sensor fault detection. A configured sensor whose channel is
-      // absent from this snapshot (node emits a reading only on a successful
-      // read) faults after two consecutive misses, so a single transient read
-      // doesn't flap the dashboard. expectedSensorMask holds capability bits only.
-      {
-        const uint16_t present  = decoded.sensorPresent;
-        // Shared normalisation, so the cached mask, this comparison and the UI
-        // can never drift into using different layouts for the same channel.
-        const uint16_t expected = nodeNormalizeSensorMask(n.expectedSensorMask);
-        const uint16_t missNow  = (uint16_t)(expected & ~present);
-        n.sensorFaultMask   = (uint16_t)(missNow & n.sensorMissPrev);
-        n.sensorMissPrev    = missNow;
-        n.lastSensorPresent = present;
-        if (n.sensorFaultMask) {
-          Serial.printf("[SNAP] %.15s sensor fault mask=0x%04X (expected=0x%04X present=0x%04X)\n",
-                        decoded.nodeId, (unsigned)n.sensorFaultMask,
-                        (unsigned)expected, (unsigned)present);
-        }
+  if (urgent && persisted) {
+    urgentNotePersisted(decoded.nodeId, decoded.seqNum, decoded.nodeTimestamp);
+    const uint32_t nowUnix = getRTCTime();
+    Serial.printf("[URGENT] %.15s seq=%lu capture->rx %ld s\n",
+                  decoded.nodeId, static_cast<unsigned long>(decoded.seqNum),
+                  (long)((int64_t)nowUnix - (int64_t)decoded.nodeTimestamp));
+  }
+  sendSnapshotAck(mac, decoded, persisted, !merged);
+
+  char snapId[sizeof(decoded.nodeId) + 1];
+  memcpy(snapId, decoded.nodeId, sizeof(decoded.nodeId));
+  snapId[sizeof(decoded.nodeId)] = '\0';
+  if (NodeInfo* found = registeredNodes.findByMacOrId(mac, snapId)) {
+    NodeInfo& n = *found;
+    // A received snapshot is the strongest possible evidence of contact, and
+    // it must stamp the durable absolute time too — not just the millis-based
+    // session value, which is worthless to the next boot.
+    noteNodeContact(n);
+    if (batV && !isnan(*batV)) {
+      n.lastReportedBatV = *batV;
+    }
+    if (decoded.nodeTimestamp > 0 && decoded.nodeTimestamp > n.lastNodeTimestamp) {
+      n.lastNodeTimestamp = decoded.nodeTimestamp;
+    }
+    // Configured-sensor fault detection. A configured sensor whose channel is
+    // absent from this snapshot (node emits a reading only on a successful
+    // read) faults after two consecutive misses, so a single transient read
+    // doesn't flap the dashboard. expectedSensorMask holds capability bits only.
+    {
+      // The reconstructed mask: a channel held inside its deadband is present.
+      const uint16_t present  = decoded.sensorPresent;
+      // Shared normalisation, so the cached mask, this comparison and the UI
+      // can never drift into using different layouts for the same channel.
+      const uint16_t expected = nodeNormalizeSensorMask(n.expectedSensorMask);
+      const uint16_t missNow  = (uint16_t)(expected & ~present);
+      n.sensorFaultMask   = (uint16_t)(missNow & n.sensorMissPrev);
+      n.sensorMissPrev    = missNow;
+      n.lastSensorPresent = present;
+      if (n.sensorFaultMask) {
+        Serial.printf("[SNAP] %.15s sensor fault mask=0x%04X (expected=0x%04X present=0x%04X)\n",
+                      decoded.nodeId, (unsigned)n.sensorFaultMask,
+                      (unsigned)expected, (unsigned)present);
       }
-      break;
     }
   }
 
@@ -356,6 +409,7 @@ struct ActiveSyncNode {
   char nodeId[16] = {0};
   uint8_t queueDepth = 0;
   uint8_t failedGrants = 0;
+  uint8_t cohort = 0;  // sync cohort the release moved it to
   bool released = false;
   bool releaseConfirmed = false;
 };
@@ -365,6 +419,7 @@ struct LegacyRendezvousState {
   uint16_t intervalMin = 0;
   uint32_t phaseUnix = 0;
   uint8_t remainingCycles = 0;
+  uint8_t cohorts = 1;  // slots the old schedule was split over
 };
 
 static LegacyRendezvousState loadLegacyRendezvousState() {
@@ -375,11 +430,13 @@ static LegacyRendezvousState loadLegacyRendezvousState() {
   state.intervalMin = prefs.getUShort("old_min", 0);
   state.phaseUnix = prefs.getULong("old_phase", 0);
   state.remainingCycles = prefs.getUChar("remaining", 0);
+  state.cohorts = prefs.getUChar("cohorts", 1);
   prefs.end();
   if (state.intervalMin == 0 || state.phaseUnix < 1704067200UL ||
       state.remainingCycles == 0) {
     state = {};
   }
+  if (state.cohorts < 1 || state.cohorts > sync_cohorts::kMaxCohorts) state.cohorts = 1;
   return state;
 }
 
@@ -390,6 +447,7 @@ static void saveLegacyRendezvousState(const LegacyRendezvousState& state) {
   prefs.putUShort("old_min", state.intervalMin);
   prefs.putULong("old_phase", state.phaseUnix);
   prefs.putUChar("remaining", state.remainingCycles);
+  prefs.putUChar("cohorts", state.cohorts);
   prefs.end();
 }
 
@@ -411,6 +469,32 @@ static uint32_t nextRendezvousUnix(uint32_t nowUnix, uint16_t intervalMin,
   return phaseUnix + (slots + 1UL) * period;
 }
 
+// The cohort slot of a legacy schedule this wake serviced, or -1.
+static int legacyCohortAt(uint32_t nowUnix, const LegacyRendezvousState& legacy) {
+  const uint8_t c = sync_cohorts::cohortAt(nowUnix, legacy.phaseUnix,
+                                           legacy.intervalMin, legacy.cohorts);
+  return wakeMatchesRendezvous(nowUnix, legacy.intervalMin,
+                               sync_cohorts::cohortPhase(legacy.phaseUnix, c)) ? c : -1;
+}
+
+// Earliest upcoming slot of any of a schedule's cohorts; phaseOut is that
+// cohort's phase (what armNextSyncAlarmPhase() takes).
+static uint32_t nextCohortRendezvousUnix(uint32_t nowUnix, uint16_t intervalMin,
+                                         uint32_t phaseUnix, uint8_t cohorts,
+                                         uint32_t& phaseOut) {
+  uint32_t best = UINT32_MAX;
+  phaseOut = phaseUnix;
+  for (uint8_t c = 0; c < cohorts; ++c) {
+    const uint32_t phase = sync_cohorts::cohortPhase(phaseUnix, c);
+    const uint32_t next = nextRendezvousUnix(nowUnix, intervalMin, phase);
+    if (next < best) {
+      best = next;
+      phaseOut = phase;
+    }
+  }
+  return best;
+}
+
 static void drainAndPersistSnapshots() {
   EspNowSnapSlot slots[8];
   int drained = 0;
@@ -422,15 +506,11 @@ static void drainAndPersistSnapshots() {
   } while (drained > 0);
 }
 
-static int findActiveSyncNode(const std::vector<ActiveSyncNode>& nodes,
-                              const uint8_t* mac, const char* nodeId) {
-  for (size_t i = 0; i < nodes.size(); ++i) {
-    if ((mac && memcmp(nodes[i].mac, mac, 6) == 0) ||
-        (nodeId && strncmp(nodes[i].nodeId, nodeId, sizeof(nodes[i].nodeId)) == 0)) {
-      return (int)i;
-    }
-  }
-  return -1;
+// The DEPLOYED record a sync frame authenticates against: same MAC and same
+// nodeId. O(1) through the registry's MAC index.
+static NodeInfo* findDeployedSender(const uint8_t* mac, const char* nodeId) {
+  NodeInfo* n = registeredNodes.findByMac(mac);
+  return (n && n->state == DEPLOYED && n->nodeId == nodeId) ? n : nullptr;
 }
 
 // Re-establish a known node whose own NVS record is unavailable. Config version
@@ -468,7 +548,7 @@ static bool buildRecoveryDeploy(const NodeInfo& node, uint16_t activeSyncMin,
 static void runCoordinatedSyncWindow(
     uint32_t sessionStartMs, bool& sessionTimedOut,
     const std::vector<node_config_message_t>& nodeCfgs,
-    uint16_t activeSyncMin, uint32_t activeSyncPhase,
+    uint16_t activeSyncMin, uint32_t activeSyncPhase, uint8_t wakeCohort,
     uint8_t legacyGraceCycles) {
   // The rendezvous window is ANCHORED TO THE SYNC SLOT, not to our (pre-rolled)
   // wake — otherwise the mothership's ~10 s pre-roll consumes it before any node
@@ -478,16 +558,41 @@ static void runCoordinatedSyncWindow(
   // together (HELLO jitter + a couple of retries + ESP-NOW contention). The old
   // fixed 12 s window closed ~2 s after the slot — just before nodes could answer
   // — which is why responders was always 0.
-  static constexpr uint32_t kJoinPostSlotSec = 15;      // hold rendezvous this long past the slot
+  //
+  // kJoinPostSlotSec also covers clocks that are seconds apart. Once every
+  // deployed node has a CLOCK_PROBE history its skew is bounded in ms, so the
+  // post-slot hold shrinks to the boot/jitter/retry budget plus that bound.
+  //
+  // Those are upper bounds. The join phase closes earlier once every deployed
+  // node is either in the roster or past the arrival time learned from its
+  // recent windows (time/rendezvous_history.h); kRosterSettleMs after the last
+  // join lets that node finish its clock exchange and FW_CAPS first.
+  //
+  // With the fleet split into sync cohorts (time/sync_cohorts.h) this wake
+  // meets wakeCohort only: the slot is that cohort's phase, and only its
+  // members are waited for. A node from another cohort that turns up anyway is
+  // still served and released into its planned cohort.
+  static constexpr uint32_t kJoinPostSlotSec = 15;      // legacy: some node's clock is unbounded
+  static constexpr uint32_t kJoinBaseSec     = 9;       // boot + edge lock + jitter + one retry + probes
   static constexpr uint32_t kJoinFloorMs     = 15000UL; // min (if we wake at/after the slot)
   static constexpr uint32_t kJoinCapMs       = 45000UL; // hard ceiling
+  static constexpr uint32_t kRosterSettleMs  = 2500UL;
   static constexpr uint32_t kCoordinatedWindowMs = 105000UL;
   static constexpr uint16_t kGrantWindowMs = 9000U;
   static constexpr uint8_t kGrantQuota = 4;
-
+  // Fleet firmware distribution gets at most this much of a session, and never
+  // more than half of what is left for grants (records outrank firmware).
+  static constexpr uint32_t kFleetOtaBudgetMs = 20000UL;
+  static constexpr uint32_t kFleetOtaMinBudgetMs = 3000UL;
+
+  const uint32_t slotPhase = sync_cohorts::cohortPhase(activeSyncPhase, wakeCohort);
+  auto expectedNow = [&](const NodeInfo& node) {
+    return node.state == DEPLOYED &&
+           rendezvousCohortOf(node.nodeId.c_str()) == wakeCohort;
+  };
   int deployedCount = 0;
   for (const auto& node : registeredNodes) {
-    if (node.state == DEPLOYED) deployedCount++;
+    if (expectedNow(node)) deployedCount++;
   }
 
   const uint32_t syncStartMs = millis();
@@ -497,26 +602,64 @@ static void runCoordinatedSyncWindow(
   uint32_t sessionId = getRTCTime() ^ esp_random();
   if (sessionId == 0) sessionId = 1;
 
+  // t2/t3 of every CLOCK_REPLY this window come from this lock.
+  if (!lockRTCSecondEdge()) {
+    Serial.println("[CLOCK] RTC second-edge lock failed; CLOCK_PROBEs go unanswered");
+  }
+
+  // Post-slot hold: the legacy 15 s unless every deployed node's clock is
+  // bounded by its skew history, then the base plus the worst bound.
+  uint32_t postSlotSec = kJoinPostSlotSec;
+  {
+    const uint32_t nowUnix = getRTCTime();
+    uint32_t worstMs = 0;
+    bool allBounded = deployedCount > 0;
+    for (const auto& node : registeredNodes) {
+      if (!expectedNow(node)) continue;
+      uint32_t boundMs = 0;
+      if (!nodeClockSkewBoundMs(node.nodeId.c_str(), nowUnix, boundMs)) {
+        allBounded = false;
+        break;
+      }
+      if (boundMs > worstMs) worstMs = boundMs;
+    }
+    if (allBounded) {
+      const uint32_t sec = kJoinBaseSec + (worstMs + 999UL) / 1000UL;
+      postSlotSec = sec < kJoinPostSlotSec ? sec : kJoinPostSlotSec;
+      Serial.printf("[CLOCK] worst node skew bound %lu ms -> post-slot %lus\n",
+                    (unsigned long)worstMs, (unsigned long)postSlotSec);
+    }
+  }
+  const uint32_t joinFloorMs = postSlotSec < kJoinPostSlotSec
+      ? postSlotSec * 1000UL : kJoinFloorMs;
+
   // Anchor the join window to the slot: round the current RTC time to the nearest
   // phase-aligned boundary, then hold the rendezvous open until slot +
-  // kJoinPostSlotSec. Falls back to the floor when no anchor is known.
-  uint32_t joinWindowMs = kJoinFloorMs;
+  // postSlotSec. Falls back to the floor when no anchor is known.
+  uint32_t joinWindowMs = joinFloorMs;
+  bool slotAnchored = false;
+  int32_t slotAfterStartMs = 0;  // the slot, in ms after syncStartMs
   {
     const uint32_t nowUnix = getRTCTime();
-    if (activeSyncMin > 0 && activeSyncPhase > 0 && nowUnix >= activeSyncPhase) {
+    if (activeSyncMin > 0 && activeSyncPhase > 0 && nowUnix >= slotPhase) {
       const uint32_t period = (uint32_t)activeSyncMin * 60UL;
-      const uint32_t rem = (nowUnix - activeSyncPhase) % period;
+      const uint32_t rem = (nowUnix - slotPhase) % period;
       const int32_t toSlotSec = (rem <= period - rem)
           ? -(int32_t)rem                 // nearest slot is behind us (woke late)
           : (int32_t)(period - rem);      // nearest slot is ahead (normal pre-roll)
-      int32_t ms = (toSlotSec + (int32_t)kJoinPostSlotSec) * 1000;
-      if (ms < (int32_t)kJoinFloorMs) ms = (int32_t)kJoinFloorMs;
+      slotAnchored = true;
+      slotAfterStartMs = rtcMsClockValid()
+          ? (int32_t)((int64_t)(nowUnix + toSlotSec) * 1000LL - rtcUnixMsAt(syncStartMs))
+          : toSlotSec * 1000;
+      int32_t ms = (toSlotSec + (int32_t)postSlotSec) * 1000;
+      if (ms < (int32_t)joinFloorMs) ms = (int32_t)joinFloorMs;
       if (ms > (int32_t)kJoinCapMs)   ms = (int32_t)kJoinCapMs;
       joinWindowMs = (uint32_t)ms;
     }
   }
-  Serial.printf("[SYNC] join window=%lu ms (anchored to slot+%lus, deployed=%d)\n",
-                (unsigned long)joinWindowMs, (unsigned long)kJoinPostSlotSec, deployedCount);
+  Serial.printf("[SYNC] join window=%lu ms (anchored to slot+%lus, cohort %u, deployed=%d)\n",
+                (unsigned long)joinWindowMs, (unsigned long)postSlotSec,
+                (unsigned)wakeCohort, deployedCount);
 
   sync_session_open_message_t sessionOpen{};
   strncpy(sessionOpen.command, "SYNC_SESSION", sizeof(sessionOpen.command) - 1);
@@ -528,24 +671,91 @@ static void runCoordinatedSyncWindow(
   strncpy(sessionOpen.mothership_id, "M001", sizeof(sessionOpen.mothership_id) - 1);
 
   std::vector<ActiveSyncNode> responders;
+  // responders[] position per registry slot (-1 = not in the roster yet). Only
+  // authenticated DEPLOYED records join, and nothing is erased from the
+  // registry until the window closes, so the slot is a stable key.
+  int16_t rosterBySlot[NodeRegistry::kCapacity];
+  for (int16_t& r : rosterBySlot) r = -1;
   std::vector<String> recoveryAttempts;
+
+  // Config delivery: one CONFIG_DIGEST per burst for the whole fleet, and the
+  // full NODE_CONFIG unicast only to a node that shows it is behind (its HELLO
+  // or a CONFIG_PULL). A few pushes per node per window: a node that keeps
+  // asking is not going to apply it this time either.
+  static constexpr uint8_t kMaxConfigPushes = 3;
+  std::vector<config_digest_entry_t> digest;
+  digest.reserve(nodeCfgs.size());
+  for (const auto& cfg : nodeCfgs) {
+    digest.push_back({configDigestShortId(cfg.nodeId), cfg.configVersion});
+  }
+  uint8_t configPushes[NodeRegistry::kCapacity] = {0};
+  auto pushNodeConfig = [&](const uint8_t* mac, const NodeInfo& node,
+                            uint16_t haveVersion, const char* why) {
+    for (const auto& cfg : nodeCfgs) {
+      if (node.nodeId != cfg.nodeId) continue;
+      uint8_t& pushes = configPushes[registeredNodes.indexOf(node)];
+      if (cfg.configVersion <= haveVersion || pushes >= kMaxConfigPushes) return;
+      pushes++;
+      Serial.printf("[SYNC] %s behind (v%u < v%u, %s) -> unicast NODE_CONFIG\n",
+                    node.nodeId.c_str(), (unsigned)haveVersion,
+                    (unsigned)cfg.configVersion, why);
+      sendNodeConfigNow(mac, cfg);
+      return;
+    }
+  };
+
+  // Answer CLOCK_PROBEs as soon as they are drained (t3 is stamped at send, so
+  // queueing delay is excluded from the node's round trip) and record the
+  // final report each node sends after correcting its clock.
+  auto serviceClockProbes = [&]() -> int {
+    SyncClockProbeSlot probes[8];
+    const int probeCount = drainClockProbes(probes, 8);
+    for (int i = 0; i < probeCount; ++i) {
+      clock_probe_message_t& probe = probes[i].probe;
+      probe.nodeId[sizeof(probe.nodeId) - 1] = '\0';
+      if (probe.sessionId != sessionId) continue;
+      NodeInfo* node = findDeployedSender(probes[i].mac, probe.nodeId);
+      if (!node) continue;
+      if (probe.flags & CLOCK_PROBE_REPORT) {
+        nodeClockSkewRecord(probe.nodeId, probe, getRTCTime());
+        Serial.printf("[CLOCK] %.15s offset=%ldms rtt=%ums stepped=%u drift=%dcppm%s aging=%d\n",
+                      probe.nodeId, (long)probe.offsetMs, (unsigned)probe.delayMs,
+                      (probe.flags & CLOCK_PROBE_STEPPED) ? 1 : 0,
+                      (int)probe.driftCentiPpm,
+                      (probe.flags & CLOCK_DRIFT_VALID) ? "" : "(n/a)",
+                      (int)probe.agingOffset);
+        continue;
+      }
+      if (!rtcMsClockValid()) continue;
+      clock_reply_message_t reply{};
+      strncpy(reply.command, "CLOCK_REPLY", sizeof(reply.command) - 1);
+      strncpy(reply.nodeId, probe.nodeId, sizeof(reply.nodeId) - 1);
+      reply.sessionId = sessionId;
+      reply.seq = probe.seq;
+      reply.t1Ms = probe.t1Ms;
+      reply.t2Ms = rtcUnixMsAt(probes[i].rxMillis);
+      sendClockReply(probes[i].mac, reply);
+    }
+    return probeCount;
+  };
   auto collectHellos = [&]() {
     SyncHelloSlot hellos[8];
     int count = 0;
     do {
+      const int probeCount = serviceClockProbes();
       count = drainSyncHellos(hellos, 8);
       for (int i = 0; i < count; ++i) {
         hellos[i].hello.nodeId[sizeof(hellos[i].hello.nodeId) - 1] = '\0';
-        NodeInfo* authorizedNode = nullptr;
-        for (auto& registered : registeredNodes) {
-          if (registered.state == DEPLOYED &&
-              memcmp(registered.mac, hellos[i].mac, 6) == 0 &&
-              registered.nodeId == String(hellos[i].hello.nodeId)) {
-            authorizedNode = &registered;
-            break;
-          }
-        }
+        NodeInfo* authorizedNode = findDeployedSender(hellos[i].mac, hellos[i].hello.nodeId);
         if (!authorizedNode) {
+          // A known node the hub no longer counts as deployed (unpair pending)
+          // does not join, but is still owed its NODE_CONFIG.
+          const NodeInfo* known = registeredNodes.findByMac(hellos[i].mac);
+          if (known && known->nodeId == hellos[i].hello.nodeId) {
+            pushNodeConfig(hellos[i].mac, *known, hellos[i].hello.configVersion, "hello");
+            esp_now_del_peer(hellos[i].mac);
+            continue;
+          }
           Serial.printf("[SYNC] ignored HELLO from unregistered/mismatched node %.15s\n",
                         hellos[i].hello.nodeId);
           continue;
@@ -581,22 +791,40 @@ static void runCoordinatedSyncWindow(
                           (unsigned)hellos[i].hello.configVersion);
           }
         }
-        int existing = findActiveSyncNode(responders, hellos[i].mac,
-                                          hellos[i].hello.nodeId);
+        pushNodeConfig(hellos[i].mac, *authorizedNode,
+                       hellos[i].hello.configVersion, "hello");
+        int16_t& existing = rosterBySlot[registeredNodes.indexOf(*authorizedNode)];
         if (existing < 0) {
+          existing = (int16_t)responders.size();
           ActiveSyncNode responder{};
           memcpy(responder.mac, hellos[i].mac, 6);
           strncpy(responder.nodeId, hellos[i].hello.nodeId,
                   sizeof(responder.nodeId) - 1);
           responder.queueDepth = hellos[i].hello.queueDepth;
           responders.push_back(responder);
-          Serial.printf("[SYNC] roster +%.15s queue=%u\n", responder.nodeId,
-                        (unsigned)responder.queueDepth);
+          const int32_t afterSlotMs = (int32_t)(millis() - syncStartMs) - slotAfterStartMs;
+          if (slotAnchored) rendezvousHistoryRecordArrival(responder.nodeId, afterSlotMs);
+          Serial.printf("[SYNC] roster +%.15s queue=%u slot%+ldms\n", responder.nodeId,
+                        (unsigned)responder.queueDepth, (long)afterSlotMs);
         } else {
           responders[(size_t)existing].queueDepth = hellos[i].hello.queueDepth;
         }
       }
 
+      // CONFIG_PULL: a node that found itself behind in the digest. MAC + id
+      // must match a registry record, deployed or pending unpair.
+      SyncConfigPullSlot pulls[8];
+      const int pullCount = drainConfigPulls(pulls, 8);
+      for (int i = 0; i < pullCount; ++i) {
+        pulls[i].pull.nodeId[sizeof(pulls[i].pull.nodeId) - 1] = '\0';
+        const NodeInfo* known = registeredNodes.findByMac(pulls[i].mac);
+        if (!known || known->nodeId != pulls[i].pull.nodeId) continue;
+        pushNodeConfig(pulls[i].mac, *known, pulls[i].pull.appliedVersion, "pull");
+        if (rosterBySlot[registeredNodes.indexOf(*known)] < 0) {
+          esp_now_del_peer(pulls[i].mac);
+        }
+      }
+
       // Fold any FW_CAPS reports into the registry (additive; older nodes send
       // none). Keeps the loop alive if caps arrive without a fresh hello.
       SyncCapsSlot caps[8];
@@ -617,15 +845,7 @@ static void runCoordinatedSyncWindow(
       const int statusCount = drainSyncStatuses(statuses, 8);
       for (int i = 0; i < statusCount; ++i) {
         statuses[i].status.nodeId[sizeof(statuses[i].status.nodeId) - 1] = '\0';
-        NodeInfo* known = nullptr;
-        for (auto& node : registeredNodes) {
-          if (node.state == DEPLOYED &&
-              memcmp(node.mac, statuses[i].mac, 6) == 0 &&
-              node.nodeId == String(statuses[i].status.nodeId)) {
-            known = &node;
-            break;
-          }
-        }
+        NodeInfo* known = findDeployedSender(statuses[i].mac, statuses[i].status.nodeId);
         // Stamp contact as soon as the sender is authenticated, before the
         // semantic branches below decide whether recovery applies. A status from
         // a node reporting itself correctly deployed is still proof we heard it.
@@ -649,8 +869,11 @@ static void runCoordinatedSyncWindow(
         }
         if (attempted) continue;
 
+        // Back into the cohort the mothership already has it in.
         deployment_command_t deploy{};
-        if (!buildRecoveryDeploy(*known, activeSyncMin, activeSyncPhase, deploy)) {
+        const uint32_t recoveryPhase = sync_cohorts::cohortPhase(
+            activeSyncPhase, rendezvousCohortOf(known->nodeId.c_str()));
+        if (!buildRecoveryDeploy(*known, activeSyncMin, recoveryPhase, deploy)) {
           Serial.printf("[RECOVERY] %.15s not dispatched: invalid FieldHub clock/schedule\n",
                         known->nodeId.c_str());
           continue;
@@ -673,18 +896,13 @@ static void runCoordinatedSyncWindow(
       for (int i = 0; i < deployAckCount; ++i) {
         deployAcks[i].ack.nodeId[sizeof(deployAcks[i].ack.nodeId) - 1] = '\0';
         if (deployAcks[i].ack.deployed != 1) continue;
-        for (auto& node : registeredNodes) {
-          if (node.state == DEPLOYED &&
-              memcmp(node.mac, deployAcks[i].mac, 6) == 0 &&
-              node.nodeId == String(deployAcks[i].ack.nodeId)) {
-            node.deployPending = false;
-            noteNodeContact(node);
-            Serial.printf("[RECOVERY] DEPLOY_ACK confirmed %.15s\n", node.nodeId.c_str());
-            break;
-          }
+        if (NodeInfo* node = findDeployedSender(deployAcks[i].mac, deployAcks[i].ack.nodeId)) {
+          node->deployPending = false;
+          noteNodeContact(*node);
+          Serial.printf("[RECOVERY] DEPLOY_ACK confirmed %.15s\n", node->nodeId.c_str());
         }
       }
-      count += capsCount + statusCount + deployAckCount;
+      count += probeCount + pullCount + capsCount + statusCount + deployAckCount;
     } while (count > 0);
   };
 
@@ -702,10 +920,52 @@ static void runCoordinatedSyncWindow(
   // that joined the responder roster, so this broadcast covers the rest.
   broadcastTimeSyncAll();
 
+  // When each deployed node is expected, in ms after syncStartMs. INT32_MAX =
+  // no learned timing (or unanchored): the join phase waits the full window.
+  // INT32_MIN = another cohort's node, not waited for at all.
+  int32_t expectedBySlot[NodeRegistry::kCapacity];
+  int learnedCount = 0;
+  {
+    const uint32_t nowUnix = getRTCTime();
+    for (const auto& node : registeredNodes) {
+      if (node.state != DEPLOYED) continue;
+      int32_t& by = expectedBySlot[registeredNodes.indexOf(node)];
+      by = expectedNow(node) ? INT32_MAX : INT32_MIN;
+      if (by == INT32_MIN) continue;
+      int32_t afterSlotMs = 0;
+      if (!slotAnchored || !rendezvousExpectedByMs(node.nodeId.c_str(), afterSlotMs)) {
+        continue;
+      }
+      uint32_t boundMs = 0;
+      if (nodeClockSkewBoundMs(node.nodeId.c_str(), nowUnix, boundMs) && boundMs < 5000UL) {
+        afterSlotMs += (int32_t)boundMs;
+      }
+      by = slotAfterStartMs + afterSlotMs;
+      learnedCount++;
+    }
+  }
+  // Roster complete (or everyone missing is overdue) and the last joiner has
+  // had kRosterSettleMs to finish its exchange.
+  uint32_t lastJoinMs = syncStartMs;
+  auto joinCanClose = [&]() -> bool {
+    const uint32_t nowMs = millis();
+    if ((uint32_t)(nowMs - lastJoinMs) < kRosterSettleMs) return false;
+    const int32_t elapsedMs = (int32_t)(nowMs - syncStartMs);
+    for (const auto& node : registeredNodes) {
+      if (node.state != DEPLOYED) continue;
+      const size_t slot = registeredNodes.indexOf(node);
+      if (rosterBySlot[slot] < 0 && elapsedMs < expectedBySlot[slot]) return false;
+    }
+    return true;
+  };
+  Serial.printf("[SYNC] learned arrival timing for %d/%d deployed node(s)\n",
+                learnedCount, deployedCount);
+
   // Bounded rendezvous. Control/config frames are paced by the ESP-NOW send
   // callback; no node receives permission to dump during this collection phase.
   uint32_t lastBeaconMs = 0;
   uint32_t lastConfigBurstMs = 0;
+  bool joinClosedEarly = false;
   while ((uint32_t)(millis() - syncStartMs) < joinWindowMs) {
     const uint32_t nowMs = millis();
     if (lastBeaconMs == 0 || (uint32_t)(nowMs - lastBeaconMs) >= 1000UL) {
@@ -714,29 +974,62 @@ static void runCoordinatedSyncWindow(
       lastBeaconMs = millis();
     }
     if (lastConfigBurstMs == 0 || (uint32_t)(nowMs - lastConfigBurstMs) >= 6000UL) {
-      for (const auto& cfg : nodeCfgs) broadcastNodeConfigNow(cfg);
+      broadcastConfigDigest(digest.data(), digest.size());
       // Repeat the active schedule at every rendezvous. A node waking on an old
       // grace slot therefore gets another migration opportunity.
-      broadcastSyncScheduleNow(activeSyncMin, activeSyncPhase);
+      broadcastSyncScheduleNow(activeSyncMin, slotPhase);
       lastConfigBurstMs = millis();
     }
+    const size_t rosterBefore = responders.size();
     collectHellos();
+    if (responders.size() != rosterBefore) lastJoinMs = millis();
     drainAndPersistSnapshots();
+    if (joinCanClose()) {
+      // The last joiner may have booted after the latest burst. Its HELLO
+      // already got it a NODE_CONFIG if it was behind; the digest is for a node
+      // whose HELLO was lost.
+      if ((int32_t)(lastJoinMs - lastConfigBurstMs) > 0) {
+        broadcastConfigDigest(digest.data(), digest.size());
+      }
+      joinClosedEarly = true;
+      break;
+    }
     delay(5);
   }
 
   collectHellos();
-  Serial.printf("[SYNC] rendezvous closed: responders=%u deployed=%d\n",
+  const uint32_t joinElapsedMs = millis() - syncStartMs;
+  if (slotAnchored) {
+    for (const auto& node : registeredNodes) {
+      if (expectedNow(node) && rosterBySlot[registeredNodes.indexOf(node)] < 0) {
+        rendezvousHistoryRecordMiss(node.nodeId.c_str());
+      }
+    }
+  }
+  Serial.printf("[SYNC] rendezvous closed%s after %lu ms: responders=%u deployed=%d\n",
+                joinClosedEarly ? " early" : "", (unsigned long)joinElapsedMs,
                 (unsigned)responders.size(), deployedCount);
 
+  // The release hands each node its planned cohort's phase. A later cohort's
+  // slot is still ahead this interval, so the node gets the occurrence after
+  // that one (it arms a future phase directly) instead of meeting the
+  // mothership twice in one interval.
+  auto releasePhaseFor = [&](uint8_t cohort) -> uint32_t {
+    const uint32_t phase = sync_cohorts::cohortPhase(activeSyncPhase, cohort);
+    if (cohort <= wakeCohort || activeSyncMin == 0) return phase;
+    return nextRendezvousUnix(getRTCTime(), activeSyncMin, phase) +
+           (uint32_t)activeSyncMin * 60UL;
+  };
+
   auto releaseNode = [&](ActiveSyncNode& responder) {
     if (responder.released) return;
+    responder.cohort = rendezvousCohortTarget(responder.nodeId);
     sync_release_message_t release{};
     strncpy(release.command, "SYNC_RELEASE", sizeof(release.command) - 1);
     strncpy(release.nodeId, responder.nodeId, sizeof(release.nodeId) - 1);
     release.sessionId = sessionId;
     release.mothershipUnix = getRTCTime();
-    release.syncPhaseUnix = activeSyncPhase;
+    release.syncPhaseUnix = releasePhaseFor(responder.cohort);
     release.syncIntervalMin = activeSyncMin;
     release.legacyGraceCycles = legacyGraceCycles;
     release.flags = legacyGraceCycles > 0 ? 0x01 : 0x00;
@@ -746,6 +1039,7 @@ static void runCoordinatedSyncWindow(
     while (responder.released && !responder.releaseConfirmed &&
            (int32_t)(ackDeadlineMs - millis()) > 0) {
       drainAndPersistSnapshots();
+      serviceClockProbes();  // the roster can close while an exchange is running
       SyncReleaseAckSlot ackSlots[8];
       const int ackCount = drainReleaseAcks(ackSlots, 8);
       for (int i = 0; i < ackCount; ++i) {
@@ -757,24 +1051,38 @@ static void runCoordinatedSyncWindow(
       }
       delay(5);
     }
-    Serial.printf("[SYNC] release node=%.15s sent=%u confirmed=%u remaining=%u\n",
+    if (responder.releaseConfirmed) {
+      rendezvousCohortConfirm(responder.nodeId, responder.cohort);
+    }
+    Serial.printf("[SYNC] release node=%.15s sent=%u confirmed=%u cohort=%u remaining=%u\n",
                   responder.nodeId, responder.released ? 1 : 0,
-                  responder.releaseConfirmed ? 1 : 0,
+                  responder.releaseConfirmed ? 1 : 0, (unsigned)responder.cohort,
                   (unsigned)responder.queueDepth);
     // The ESP-NOW peer table is limited. Peers are re-added on demand for a
     // later grace/session wake, so release the slot immediately.
     esp_now_del_peer(responder.mac);
   };
 
+  uint32_t releaseReserveMs = 3000UL + (uint32_t)responders.size() * 1600UL;
+  if (releaseReserveMs > 30000UL) releaseReserveMs = 30000UL;
+  const uint32_t grantStopMs = syncDeadlineMs - releaseReserveMs;
+
+  // Fleet firmware distribution runs while every responder is still awake and
+  // listening, i.e. before the first release. One broadcast serves them all.
+  if (!responders.empty()) {
+    const int32_t leftMs = (int32_t)(grantStopMs - millis());
+    uint32_t otaBudgetMs = leftMs > 0 ? (uint32_t)leftMs / 2UL : 0;
+    if (otaBudgetMs > kFleetOtaBudgetMs) otaBudgetMs = kFleetOtaBudgetMs;
+    if (otaBudgetMs >= kFleetOtaMinBudgetMs) {
+      fleetOtaRunPhase(sessionId, otaBudgetMs, drainAndPersistSnapshots);
+    }
+  }
+
   // Empty nodes can be clock/schedule synchronized and released immediately.
   for (auto& responder : responders) {
     if (responder.queueDepth == 0) releaseNode(responder);
   }
 
-  uint32_t releaseReserveMs = 3000UL + (uint32_t)responders.size() * 1600UL;
-  if (releaseReserveMs > 30000UL) releaseReserveMs = 30000UL;
-  const uint32_t grantStopMs = syncDeadlineMs - releaseReserveMs;
-
   uint16_t nextGrantId = 1;
   bool madeProgress = true;
   while (madeProgress && (int32_t)(grantStopMs - millis()) > 0) {
@@ -808,6 +1116,7 @@ static void runCoordinatedSyncWindow(
       while (!doneMatched && (int32_t)(grantDeadlineMs - millis()) > 0 &&
              (int32_t)(grantStopMs - millis()) > 0) {
         drainAndPersistSnapshots();
+        serviceClockProbes();  // a late joiner's exchange overlaps the grants
         SyncDoneSlot doneSlots[8];
         const int doneCount = drainDumpDone(doneSlots, 8);
         for (int i = 0; i < doneCount; ++i) {
@@ -844,9 +1153,16 @@ static void runCoordinatedSyncWindow(
     releaseNode(responder);
   }
 
+  // OTA_RESULT frames can arrive at any point of the session.
+  fleetOtaCollectResults();
   drainAndPersistSnapshots();
   Serial.printf("[SYNC] coordinated window complete: responders=%u drops=%lu\n",
                 (unsigned)responders.size(), (unsigned long)getSnapDropCount());
+  const uint32_t windowMs = millis() - syncStartMs;
+  Serial.printf("[SYNC] window duration %lu ms (join %lu of %lu ms, budget %lu ms, %lu ms unused)\n",
+                (unsigned long)windowMs, (unsigned long)joinElapsedMs,
+                (unsigned long)joinWindowMs, (unsigned long)syncBudgetMs,
+                (unsigned long)(windowMs < syncBudgetMs ? syncBudgetMs - windowMs : 0));
 }
 
 // ---------------------------------------------------------------------------
@@ -882,6 +1198,14 @@ static void maybeRunCloudOta(ModemDriver& modem, uint32_t sessionStartMs) {
                 r.rebootPending, r.transient);
   if (r.rebootPending) {
     Serial.println("[OTA] image armed — next RTC-alarm wake will boot the new slot");
+    const uint32_t saved = r.expectedSize > r.bytesDownloaded
+        ? (uint32_t)(((uint64_t)(r.expectedSize - r.bytesDownloaded) * 100ULL) / r.expectedSize)
+        : 0;
+    Serial.printf("[OTA] %s install: downloaded %lu of %lu image bytes (%lu%% saved), "
+                  "download %lums, total %lums\n",
+                  r.delta ? "delta" : "full", (unsigned long)r.bytesDownloaded,
+                  (unsigned long)r.expectedSize, (unsigned long)saved,
+                  (unsigned long)r.downloadMs, (unsigned long)r.installMs);
   }
 }
 
@@ -943,6 +1267,7 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
   };
 
   // 1. Power on modem
+  const uint32_t modemOnStartMs = millis();
   if (!modem.powerOn()) {
     Serial.println("[UPLOAD] FAIL: Modem power-on failed");
     uploadQueue.incrementRetryCount(retryNowUnix, retryCooldownSec);
@@ -955,16 +1280,21 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
     return;
   }
 
-  // 2. Wait for network registration (60s timeout — will fail without antenna)
+  // 2. Wait for network registration (60s timeout — will fail without antenna),
+  // starting on the cell the last wake registered on (comms/registration_cache.h).
   Serial.println("[UPLOAD] Waiting for network registration (60s timeout)...");
+  registrationCacheApply(modem);
   const uint32_t regStartMs = millis();
   if (!modem.waitForNetwork(60000)) {
     Serial.println("[UPLOAD] Network registration failed/timeout — skipping upload");
+    registrationCacheFailed(millis() - regStartMs);
     modem.gracefulShutdown();
+    uploadPlanNoRegistration(millis() - modemOnStartMs);
     uploadQueue.incrementRetryCount(retryNowUnix, retryCooldownSec);
     return;
   }
   const uint32_t regTimeMs = millis() - regStartMs;
+  registrationCacheRegistered(modem, regTimeMs);
   Serial.println("[UPLOAD] Network registered");
   if (sessionExpired()) {
     Serial.println("[WATCHDOG] Session timeout after network registration - forcing shutdown");
@@ -978,12 +1308,13 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
   // -----------------------------------------------------------------------
   if (txSettings.useJsonUpload) {
     constexpr uint16_t kMaxReadingsPerPost = 100;
-    // 8 KB of CSV -> ~32 KB of JSON -> ~65 KB peak (readings + body copy).
-    // 16 KB produced a ~65 KB document and a ~130 KB peak, which is where the
-    // 2026-08-01 truncation happened. The upload LOOPS over chunks, so a smaller
-    // chunk costs an extra POST rather than leaving anything behind - and it is
-    // what keeps the peak flat as the fleet grows.
-    constexpr uint32_t kJsonChunkBytes     = 8192;   // ~37 rows of CSV
+    // Chunk size is paced per POST (comms/upload_pacing.h). 8 KB of CSV ->
+    // ~32 KB of JSON -> ~65 KB peak (readings + body copy); 16 KB produced a
+    // ~130 KB peak, which is where the 2026-08-01 truncation happened. The
+    // pacer sizes each chunk against the heap as it stands instead of that
+    // one fixed guess, and against the link and the session left. The upload
+    // LOOPS over chunks, so a smaller chunk costs an extra POST rather than
+    // leaving anything behind.
 
     // Supabase: header-only Bearer auth, JSON array body, no query params.
     // The legacy Google Apps Script path (apiKey empty) still appends action.
@@ -1013,7 +1344,7 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
     const uint32_t flashPct = (fsTotal > 0)
       ? (uint32_t)((fsUsed * 100ULL) / fsTotal) : 0;
     const UploadCursor statusCursor = uploadQueue.getCursor();
-    const auto allNodes = getRegisteredNodes();
+    const auto& allNodes = getRegisteredNodes();
     uint16_t fTotal = 0, fDeployed = 0, fPaired = 0, fUnpaired = 0, fPending = 0, fPaused = 0;
     for (const auto& n : allNodes) {
       fTotal++;
@@ -1035,6 +1366,17 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
     ModemDiagnostics mdiag;
     modem.getDiagnostics(mdiag);
     const String modemJson = modemDiagnosticsToJson(mdiag, regTimeMs);
+    // Link-quality plan (comms/upload_planner.h): on a poor link only status
+    // and the fresh lane go out; the backlog and a staged OTA wait for a
+    // better wake. FieldMesh only - deferring leans on the fresh lane and the
+    // status heartbeat, and a custom endpoint has neither.
+    const uint32_t pendingBytesAtStart = uploadQueue.getPendingBytes();
+    UploadPlan plan{false, true};
+    if (isFieldMesh) {
+      char stagedRel[40] = {0};
+      plan = uploadPlanWake(mdiag, regTimeMs, pendingBytesAtStart, (uint8_t)flashPct,
+                            otaReleaseStoreGetPending(stagedRel, sizeof(stagedRel)));
+    }
     // Mothership system health. batLoadedV is sampled NOW (modem on) — the
     // sag vs status.batVoltage (resting) is a battery/regulator health signal.
     const float loadedBatV = readBatteryVoltage();
@@ -1046,7 +1388,10 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
         ",\"snapQueueDropped\":" + String((unsigned)getSnapDropCount()) +
         ",\"batLoadedV\":" +
         (isnan(loadedBatV) ? String("null") : String(loadedBatV, 2)) +
-        ",\"sessionMs\":" + String((unsigned)(millis() - sessionStartMs)) + "}";
+        ",\"sessionMs\":" + String((unsigned)(millis() - sessionStartMs)) +
+        ",\"uplink\":" + uploadPaceDiagJson() +
+        ",\"link\":" + uploadPlanDiagJson() +
+        ",\"reg\":" + registrationCacheDiagJson() + "}";
 
     // Firmware identity + OTA state, and the dispatcher control revision — both
     // pre-built here and emitted as status.firmware{} / status.control{}.
@@ -1083,9 +1428,166 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
       isFieldMesh ? deploymentOutboxToJson() : String("[]"),
       deploymentEpochClampCount()
     };
+    // Unchanged sections and node entries go out as a delta against the status
+    // the backend last acknowledged (storage/status_delta.h).
+    if (isFieldMesh) statusDeltaPrepare(statusCtx);
+
+    // Freshness first. With a backlog behind the cursor (an outage, a missed
+    // sync), the newest row of every deployed node goes out before it, so the
+    // dashboard is current after one session; the loop below then backfills
+    // oldest-first with what is left of the session and skips the rows sent
+    // here. FieldMesh only: its backend dedupes and orders by row time, a
+    // custom endpoint may rely on arrival order. This POST carries no status
+    // object and is never isolated row by row - any failure just leaves its
+    // rows to the backfill, which owns retry accounting and poison handling.
+    if (isFieldMesh && !sessionExpired()) {
+      UploadPayload fresh = uploadQueue.getFreshData(
+          uploadPaceNextChunk(sessionStartMs, kSyncSessionLimitMs, kMaxReadingsPerPost),
+          fDeployed);
+      JsonPayload json{};
+      if (fresh.byteLength > 0) {
+        json = buildJsonUpload(fresh.csvData, kMaxReadingsPerPost, FW_SEMVER,
+                               nullptr, getRTCTime());
+      }
+      if (fresh.byteLength > 0 && json.ok && json.rowCount > 0) {
+        Serial.printf("[UPLOAD] Fresh lane: %u newest readings from offset %u "
+                      "(%u backlog bytes behind them)\n",
+                      (unsigned)json.rowCount, (unsigned)fresh.startOffset,
+                      (unsigned)(fresh.startOffset - statusCursor.byteOffset));
+        const uint32_t postStartMs = millis();
+        HttpsPostResult result = modem.httpsPost(buildUploadUrl(txSettings), json.body,
+                                                 "application/json", authHeader);
+        const uint32_t postMs = millis() - postStartMs;
+        const int appended = (result.httpStatus == 200)
+            ? jsonResponseAppendedCount(result.responseBody) : -1;
+        const bool wasDuplicate = (result.httpStatus == 200) &&
+            jsonResponseIsDuplicate(result.responseBody);
+        if (result.httpStatus == 200 && appended == 0 && !wasDuplicate) {
+          // Same guard as the backfill: 200 with nothing stored is not success.
+          Serial.println("[UPLOAD] Fresh lane: backend stored 0 and it is not a "
+                         "duplicate - rows stay queued");
+        } else if (result.httpStatus == 200) {
+          uploadPaceSuccess(json.csvBytesConsumed, json.byteLength, json.rowCount, postMs);
+          nowUnix = getRTCTime();
+          uploadQueue.markUploaded(fresh.startOffset,
+                                   fresh.startOffset + json.csvBytesConsumed,
+                                   nowUnix, json.rowCount);
+          uploadQueue.resetRetryCount();
+          anyJsonSuccess = true;
+          const BackendIngestResult ingest = ingestBackendResponse(result.responseBody);
+          controlReportDirty = controlReportDirty || ingest.commandCount > 0;
+        } else {
+          if (!isNonRetryableHttpStatus(result.httpStatus) || result.httpStatus == 413) {
+            uploadPaceFailure();
+          }
+          Serial.printf("[UPLOAD] Fresh lane: HTTP %d - left to the backfill\n",
+                        result.httpStatus);
+        }
+      }
+    }
 
-    while (uploadQueue.getPendingRows() > 0 && !sessionExpired()) {
-      UploadPayload payload = uploadQueue.getNewData(kJsonChunkBytes);
+    // Pipelined backfill (comms/upload_pipeline.h). Two CCH sessions: chunk
+    // N+1 is built and sent while the server works on chunk N, and the TLS
+    // service stays up across POSTs instead of being rebuilt for each one.
+    // Only the happy path runs here. The cursor advances strictly in send
+    // order and stops at the first chunk not accepted; the serial loop below
+    // then takes over from the cursor and owns everything else - retry
+    // accounting, the CSV fallback, status and poison-row isolation. Needs a
+    // current CSV schema: a legacy purge rewrites the file under the offsets
+    // of chunks still in flight.
+    bool pipelineRetryable = false;
+#if MOTHERSHIP_PIPELINED_UPLOAD
+    if (isFieldMesh && !plan.deferBacklog && uploadQueue.getPendingRows() > 0 &&
+        !sessionExpired() && flashCsvSchemaIsCurrent() &&
+        modem.beginUploadSessions(buildUploadUrl(txSettings))) {
+      upload_pipeline::Window window(uploadQueue.getCursor().byteOffset);
+      const uint32_t pipelineStartMs = millis();
+      while (true) {
+        while (window.canSend()) {
+          if (sessionExpired()) { window.close(); break; }
+          UploadPayload payload = uploadQueue.getNewDataFrom(
+              window.nextOffset(),
+              uploadPaceNextChunk(sessionStartMs, kSyncSessionLimitMs, kMaxReadingsPerPost));
+          if (payload.byteLength == 0) { window.close(); break; }
+          const bool withStatus = firstChunk && !window.pending() && window.commits() == 0;
+          JsonPayload json = buildJsonUpload(payload.csvData, kMaxReadingsPerPost,
+                                             FW_SEMVER, withStatus ? &statusCtx : nullptr,
+                                             getRTCTime());
+          payload.csvData = String();
+          if (!json.ok || json.rowCount == 0) {
+            // Malformed rows, or out of heap: the serial loop knows what to do.
+            window.close();
+            break;
+          }
+          const uint8_t session = window.sendSession();
+          const uint32_t sentAtMs = millis();
+          if (!modem.uploadSend(session, json.body, "application/json", authHeader)) {
+            uploadPaceFailure();
+            window.close();
+            break;
+          }
+          window.sent({payload.startOffset, payload.startOffset + json.csvBytesConsumed,
+                       json.rowCount, json.csvBytesConsumed, json.byteLength, sentAtMs,
+                       withStatus});
+          Serial.printf("[UPLOAD] pipeline: session %u sent %u readings at offset %u\n",
+                        (unsigned)session, (unsigned)json.rowCount,
+                        (unsigned)payload.startOffset);
+        }
+        if (!window.pending()) break;
+
+        HttpsPostResult result = modem.uploadCollect(window.collectSession());
+        const int appended = (result.httpStatus == 200)
+            ? jsonResponseAppendedCount(result.responseBody) : -1;
+        const bool wasDuplicate = (result.httpStatus == 200) &&
+            jsonResponseIsDuplicate(result.responseBody);
+        upload_pipeline::Outcome outcome = upload_pipeline::kAccepted;
+        if (result.httpStatus != 200 || (appended == 0 && !wasDuplicate)) {
+          outcome = (result.httpStatus == 200 || isNonRetryableHttpStatus(result.httpStatus))
+              ? upload_pipeline::kRejected : upload_pipeline::kRetryable;
+        }
+        upload_pipeline::Chunk chunk{};
+        const upload_pipeline::Action action = window.collected(outcome, chunk);
+        if (action == upload_pipeline::kCommit) {
+          uploadPaceSuccess(chunk.csvBytes, chunk.bodyBytes, chunk.rows,
+                            millis() - chunk.sentAtMs);
+          nowUnix = getRTCTime();
+          uploadQueue.advanceCursor(chunk.end, nowUnix, chunk.rows);
+          uploadQueue.resetRetryCount();
+          uploadQueue.clearNonRetryableFailures();
+          anyJsonSuccess = true;
+          if (chunk.carriesStatus) firstChunk = false;
+          const BackendIngestResult ingest = ingestBackendResponse(result.responseBody);
+          controlReportDirty = controlReportDirty || ingest.commandCount > 0;
+        } else if (action == upload_pipeline::kStop) {
+          Serial.printf("[UPLOAD] pipeline: HTTP %d at offset %u - cursor stays, %s\n",
+                        result.httpStatus, (unsigned)chunk.start,
+                        outcome == upload_pipeline::kRetryable
+                            ? "retry next window" : "serial loop isolates it");
+          if (outcome == upload_pipeline::kRetryable) {
+            uploadPaceFailure();
+            pipelineRetryable = true;
+          } else if (result.httpStatus == 413) {
+            uploadPaceFailure();
+          }
+        } else {
+          Serial.printf("[UPLOAD] pipeline: discarding the answer for offset %u "
+                        "(behind a failure; sent again later)\n", (unsigned)chunk.start);
+        }
+      }
+      modem.endUploadSessions();
+      Serial.printf("[UPLOAD] pipeline: %u chunks committed in %lu ms, cursor %u\n",
+                    (unsigned)window.commits(), (unsigned long)(millis() - pipelineStartMs),
+                    (unsigned)uploadQueue.getCursor().byteOffset);
+      if (pipelineRetryable) {
+        uploadQueue.incrementRetryCount(retryNowUnix, retryCooldownSec);
+      }
+    }
+#endif
+
+    while (!pipelineRetryable && !plan.deferBacklog &&
+           uploadQueue.getPendingRows() > 0 && !sessionExpired()) {
+      UploadPayload payload = uploadQueue.getNewData(
+          uploadPaceNextChunk(sessionStartMs, kSyncSessionLimitMs, kMaxReadingsPerPost));
       if (payload.byteLength == 0) {
         Serial.println("[UPLOAD] JSON: no data returned from queue");
         break;
@@ -1112,6 +1614,7 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
       }
       if (!json.ok || json.rowCount == 0) {
         // Build failed (heap) — fall back to a CSV POST for this chunk.
+        if (!json.ok) uploadPaceFailure();
         if (isCustomHttps) {
           Serial.println("[UPLOAD] Custom JSON build failed; refusing an undocumented CSV fallback");
           uploadQueue.incrementRetryCount(retryNowUnix, retryCooldownSec);
@@ -1158,8 +1661,10 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
 
       Serial.printf("[UPLOAD] POSTing JSON to %s (%u bytes)\n",
                     url.c_str(), json.byteLength);
+      const uint32_t postStartMs = millis();
       HttpsPostResult result = modem.httpsPost(url, json.body,
                                                "application/json", authHeader);
+      const uint32_t postMs = millis() - postStartMs;
 
       const bool accepted = isCustomHttps
           ? (result.httpStatus >= 200 && result.httpStatus < 300)
@@ -1201,6 +1706,7 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
         }
         Serial.printf("[UPLOAD] JSON SUCCESS: HTTP %d, %u readings\n",
                       result.httpStatus, (unsigned)json.rowCount);
+        uploadPaceSuccess(json.csvBytesConsumed, json.byteLength, json.rowCount, postMs);
         nowUnix = getRTCTime();
         uploadQueue.advanceCursor(payload.startOffset + json.csvBytesConsumed, nowUnix,
                                   json.rowCount);
@@ -1236,6 +1742,9 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
         Serial.printf("[UPLOAD] JSON non-retryable HTTP %d (%s) at offset %u, %u rows\n",
                       result.httpStatus, nonRetryableHttpReason(result.httpStatus),
                       (unsigned)payload.startOffset, (unsigned)json.rowCount);
+        // The one rejection a smaller chunk can fix; the pacer halves for the
+        // next session, Step B below still isolates a row in this one.
+        if (result.httpStatus == 413) uploadPaceFailure();
 
         if (isCustomHttps) {
           Serial.println("[UPLOAD] Custom endpoint rejected the batch; cursor unchanged");
@@ -1335,17 +1844,21 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
         // 429, 5xx, or transport error (-1): retry with backoff next window.
         Serial.printf("[UPLOAD] JSON retryable HTTP %d, %s\n",
                       result.httpStatus, result.errorDetail.c_str());
+        uploadPaceFailure();
         uploadQueue.incrementRetryCount(retryNowUnix, retryCooldownSec);
         break;
       }
     }
+    uploadPaceFinish();
 
     // A fully paused fleet legitimately has no reading rows, but the cloud
     // still needs proof that the mothership woke, completed the sync window,
     // and remains healthy. Supabase accepts the canonical batch shape with an
     // empty readings[] array and records a zero-reading sync_session while
-    // refreshing mothership_status and nodes.
-    if (totalPendingRows == 0 && isFieldMesh && !sessionExpired()) {
+    // refreshing mothership_status and nodes. A wake that deferred its backlog
+    // sends the same heartbeat: the backfill is what normally carries status.
+    if ((totalPendingRows == 0 || plan.deferBacklog) && isFieldMesh &&
+        !sessionExpired()) {
       JsonPayload heartbeat = buildJsonUpload(String(), 1, FW_SEMVER,
                                                &statusCtx, getRTCTime());
       if (!heartbeat.ok) {
@@ -1398,6 +1911,7 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
       statusCtx.pendingBytes = uploadQueue.getPendingBytes();
       statusCtx.nodesJson = buildNodesStatusJson(statusCtx.rtcUnix);
       statusCtx.controlJson = backendControlStatusJson();
+      statusDeltaPrepare(statusCtx);
 
       JsonPayload controlHeartbeat = buildJsonUpload(
           String(), 1, FW_SEMVER, &statusCtx, statusCtx.rtcUnix);
@@ -1443,7 +1957,16 @@ void performModemUpload(const TransmissionSettings& txSettings, uint32_t session
     // deferred), fetch+verify+install now while the modem is live and the
     // session budget allows. Runs only after the status/control upload above,
     // so a slow ~1 MB download never risks the readings upload or command ACKs.
-    if (isFieldMesh) maybeRunCloudOta(modem, sessionStartMs);
+    // The upload plan holds it on a poor link; the wake is recorded first, so
+    // the download does not count against modem on-time per delivered KB.
+    if (isFieldMesh) {
+      const uint32_t pendingBytesNow = uploadQueue.getPendingBytes();
+      uploadPlanFinish(millis() - modemOnStartMs,
+                       pendingBytesAtStart > pendingBytesNow
+                           ? pendingBytesAtStart - pendingBytesNow : 0,
+                       anyJsonSuccess);
+    }
+    if (isFieldMesh && plan.allowOta) maybeRunCloudOta(modem, sessionStartMs);
 
     // Enforce the bounded LittleFS retention window, then shut down cleanly.
     uploadQueue.emergencyPurgeIfFull(kLittleFsRetentionHighWaterPct);
@@ -1564,10 +2087,10 @@ void handleSyncWake() {
     return;
   }
 
+  // An old schedule split over cohorts is one cycle per pass over its slots.
   LegacyRendezvousState legacyRendezvous = loadLegacyRendezvousState();
   if (legacyRendezvous.active &&
-      wakeMatchesRendezvous(getRTCTime(), legacyRendezvous.intervalMin,
-                            legacyRendezvous.phaseUnix)) {
+      legacyCohortAt(getRTCTime(), legacyRendezvous) == legacyRendezvous.cohorts - 1) {
     if (legacyRendezvous.remainingCycles > 0) legacyRendezvous.remainingCycles--;
     legacyRendezvous.active = legacyRendezvous.remainingCycles > 0;
     saveLegacyRendezvousState(legacyRendezvous);
@@ -1627,6 +2150,9 @@ void handleSyncWake() {
   // Deployment epochs must be live BEFORE the sync window opens, or snapshots
   // received this cycle would be stamped 0.
   deploymentBootstrap();
+  // Per-node clock and arrival history size this wake's rendezvous.
+  nodeClockSkewBegin();
+  rendezvousHistoryBegin();
 
   // Init ESP-NOW in sync-only mode
   if (!initEspNowSyncOnly(ESPNOW_CHANNEL)) {
@@ -1648,16 +2174,43 @@ void handleSyncWake() {
 
   Serial.printf("[SYNC] Listening for %d ms (deployed nodes: %d)...\n", SYNC_WINDOW_MS, deployedCount);
 
-  // Build the per-node NODE_CONFIG broadcasts once for this window. Each carries
+  // Sync cohorts: a large fleet meets the mothership in several slots per
+  // interval instead of one session (time/sync_cohorts.h). Daily mode, a
+  // schedule change and its legacy grace keep one slot, so every node a wake
+  // reaches is released onto the base phase; the fleet is split again once the
+  // grace is over. A transition remembers how many slots the old schedule had.
+  uint8_t cohortSlots = 1;
+  uint8_t wakeCohort = 0;
+  if (gSyncMode == SYNC_MODE_INTERVAL && gSyncIntervalMin > 0 &&
+      gLastSyncBroadcastUnix >= 1704067200UL &&
+      !scheduleTransitionPending && !legacyRendezvous.active) {
+    cohortSlots = rendezvousPlanCohorts(
+        sync_cohorts::cohortCount((size_t)deployedCount, (uint32_t)gSyncIntervalMin));
+    wakeCohort = sync_cohorts::cohortAt(getRTCTime(), (uint32_t)gLastSyncBroadcastUnix,
+                                        (uint32_t)gSyncIntervalMin, cohortSlots);
+    Serial.printf("[SYNC] cohort slot %u of %u\n", (unsigned)wakeCohort + 1U,
+                  (unsigned)cohortSlots);
+  } else {
+    const uint8_t oldSlots = rendezvousPlanCohorts(1);
+    if (scheduleTransitionPending && legacyRendezvous.active &&
+        legacyRendezvous.cohorts != oldSlots) {
+      legacyRendezvous.cohorts = oldSlots;
+      saveLegacyRendezvousState(legacyRendezvous);
+    }
+  }
+  const bool lastCohortSlot = wakeCohort + 1U >= cohortSlots;
+
+  // Build the per-node NODE_CONFIG frames once for this window. Each carries
   // the node's durable desired state (recording interval + targetState +
-  // monotonic version). Nodes apply only a strictly newer version and ACK via
-  // CONFIG_ACK, so re-broadcasting every cadence tick is idempotent. This is the
+  // monotonic version). The window advertises them as a CONFIG_DIGEST and
+  // unicasts a frame only to a node that is behind; nodes apply only a strictly
+  // newer version and ACK via CONFIG_ACK, so a repeated push is idempotent. This is the
   // unified declarative delivery that replaces the old SET_SCHEDULE broadcast;
   // the SYNC schedule still rides the SET_SYNC_SCHED transition handover below.
   std::vector<node_config_message_t> nodeCfgs;
   for (const auto& n : registeredNodes) {
     NodeDesiredConfig dc = getDesiredConfig(n.nodeId.c_str());
-    // Broadcast to deployed nodes and to any node pending unpair.
+    // Deployed nodes, and any node pending unpair.
     if (n.state != DEPLOYED && dc.targetState != 0 /*UNPAIRED*/) continue;
 
     // Repair a STRANDED desired state.
@@ -1709,6 +2262,13 @@ void handleSyncWake() {
     // The NODE_CONFIG payload carries the RAW configured mask — the node needs
     // the ultrasonic selector to know which wind backend to register.
     cfg.sensorMask      = dc.sensorMask;  // 0 = auto; else SNAP_PRESENT_* + VALID bit
+    cfg.aggSamplesPerReport = dc.aggSamplesPerReport;  // 0 = off
+    cfg.aggStatsMask        = dc.aggStatsMask;
+    cfg.rbeMaxSilenceMin    = dc.rbeMaxSilenceMin;   // 0 = off
+    cfg.rbeDeadbandTenths   = dc.rbeDeadbandTenths;
+    cfg.urgentFlags         = dc.urgentFlags;        // 0 = off
+    cfg.urgentAirBelowCenti = dc.urgentAirBelowCenti;
+    cfg.urgentSoilAboveMv   = dc.urgentSoilAboveMv;
     // The cached mask, by contrast, is normalised to the snapshot layout by
     // setNodeExpectedSensorMask() so fault detection and the UI can compare it
     // against a snapshot's sensorPresent directly.
@@ -1717,7 +2277,7 @@ void handleSyncWake() {
             ? (uint16_t)(dc.sensorMask & ~NODE_SENSOR_MASK_VALID) : 0);
     nodeCfgs.push_back(cfg);
   }
-  Serial.printf("[SYNC] NODE_CONFIG broadcasts prepared: %u node(s)\n",
+  Serial.printf("[SYNC] NODE_CONFIG prepared: %u node(s)\n",
                 (unsigned)nodeCfgs.size());
 
   const uint16_t activeSyncMin = (gSyncMode == SYNC_MODE_DAILY)
@@ -1734,7 +2294,7 @@ void handleSyncWake() {
   const uint8_t releaseGraceCycles = scheduleTransitionPending
       ? 3U : legacyRendezvous.remainingCycles;
   runCoordinatedSyncWindow(sessionStartMs, sessionTimedOut, nodeCfgs,
-                           activeSyncMin, activeSyncPhase,
+                           activeSyncMin, activeSyncPhase, wakeCohort,
                            releaseGraceCycles);
 
   Serial.println("[SYNC] Sync window closed");
@@ -1756,6 +2316,11 @@ void handleSyncWake() {
   // the same per-node state, so saving first silently discarded whatever the
   // last few packets of the window changed.
   savePairedNodes();
+  // CLOCK_PROBE reports, HELLO arrivals and report-by-exception references
+  // from this window, one LittleFS write each.
+  nodeClockSkewCommit();
+  rendezvousHistoryCommit();
+  carryForwardCommit();
 
   // --- NODE_CONFIG reconcile: process CONFIG_ACKs collected this window ---
   // A node ACKs after applying a NODE_CONFIG. An UNPAIRED ack (version matched)
@@ -1773,12 +2338,8 @@ void handleSyncWake() {
         markControlConverged(ackNodeId.c_str(), acks[i].appliedVersion);
         Serial.printf("[SYNC] CONFIG_ACK unpair confirmed: %s v%u — removing node\n",
                       ackNodeId.c_str(), (unsigned)acks[i].appliedVersion);
-        for (auto it = registeredNodes.begin(); it != registeredNodes.end(); ++it) {
-          if (it->nodeId == ackNodeId) {
-            esp_now_del_peer(it->mac);
-            registeredNodes.erase(it);
-            break;
-          }
+        if (NodeInfo* gone = registeredNodes.findById(ackNodeId.c_str())) {
+          removeRegisteredNode(*gone);
         }
         // Reset desired config so a future re-pair of this ID is not auto-unpaired.
         NodeDesiredConfig reset{};
@@ -1821,7 +2382,15 @@ void handleSyncWake() {
   // reads or advances the cursor, and on a failed init that cursor is zeros.
   // Uploading against it would re-send the entire retained history and then
   // advance from a false position.
-  if (!sessionTimedOut && txSettings.enabled && flashIsReady() &&
+  //
+  // With sync cohorts the interval's upload follows its last slot only, so
+  // the upload policy still counts one wake per sync interval.
+  if (!lastCohortSlot) {
+    if (txSettings.enabled) {
+      Serial.printf("[UPLOAD] cohort slot %u of %u — upload follows the last slot\n",
+                    (unsigned)wakeCohort + 1U, (unsigned)cohortSlots);
+    }
+  } else if (!sessionTimedOut && txSettings.enabled && flashIsReady() &&
       !uploadQueue.isInitialised()) {
     Serial.println("[UPLOAD] Upload queue not initialised — skipping upload this wake");
   } else if (!sessionTimedOut && txSettings.enabled && flashIsReady()) {
@@ -1917,8 +2486,9 @@ void handleSyncWake() {
                   (unsigned)legacyRendezvous.remainingCycles);
   }
 
+  uint32_t nextSyncWakeUnix = 0;
   if (gSyncMode == SYNC_MODE_DAILY) {
-    if (!armDailyAlarm(gSyncDailyHour, gSyncDailyMinute)) {
+    if (!armDailyAlarm(gSyncDailyHour, gSyncDailyMinute, &nextSyncWakeUnix)) {
       Serial.println("[FATAL] Failed to arm daily alarm - starting bounded recovery");
       boundedRetryAndShutdown("Daily alarm arm failed");
       return;
@@ -1927,15 +2497,21 @@ void handleSyncWake() {
     int syncInterval = (gSyncIntervalMin > 0) ?
                        gSyncIntervalMin : DEFAULT_SYNC_INTERVAL_MIN;
     uint32_t phaseUnix = static_cast<uint32_t>(gLastSyncBroadcastUnix);
+    // The next cohort's slot later this interval, else cohort 0 next interval.
+    if (!lastCohortSlot) {
+      phaseUnix = sync_cohorts::cohortPhase(phaseUnix, (uint8_t)(wakeCohort + 1U));
+    }
     if (legacyRendezvous.active && legacyRendezvous.remainingCycles > 0) {
       const uint32_t nowUnix = getRTCTime();
       const uint32_t nextActive = nextRendezvousUnix(nowUnix,
           (uint16_t)syncInterval, phaseUnix);
-      const uint32_t nextLegacy = nextRendezvousUnix(nowUnix,
-          legacyRendezvous.intervalMin, legacyRendezvous.phaseUnix);
+      uint32_t legacyPhase = legacyRendezvous.phaseUnix;
+      const uint32_t nextLegacy = nextCohortRendezvousUnix(nowUnix,
+          legacyRendezvous.intervalMin, legacyRendezvous.phaseUnix,
+          legacyRendezvous.cohorts, legacyPhase);
       if (nextLegacy < nextActive) {
         syncInterval = legacyRendezvous.intervalMin;
-        phaseUnix = legacyRendezvous.phaseUnix;
+        phaseUnix = legacyPhase;
         Serial.printf("[SYNC] next alarm uses OLD rendezvous (%umin); %u grace cycles remain\n",
                       (unsigned)legacyRendezvous.intervalMin,
                       (unsigned)legacyRendezvous.remainingCycles);
@@ -1944,13 +2520,31 @@ void handleSyncWake() {
                       syncInterval);
       }
     }
-    if (!armNextSyncAlarmPhase(syncInterval, phaseUnix)) {
+    if (!armNextSyncAlarmPhase(syncInterval, phaseUnix, &nextSyncWakeUnix)) {
       Serial.println("[FATAL] Failed to arm next sync alarm - starting bounded recovery");
       boundedRetryAndShutdown("Sync alarm arm failed");
       return;
     }
   }
 
+  // Low-latency listening: with urgent thresholds set on any node, the next
+  // wake may be a listen window before that sync wake.
+  const uint32_t listenMin = urgentListenIntervalMin(gWakeIntervalMin);
+  if (listenMin > 0) {
+    const urgent_listen::PowerBudget budget = urgent_listen::estimateBudget(
+        listenMin, gSyncMode == SYNC_MODE_DAILY ? 24U * 60U : (uint32_t)gSyncIntervalMin,
+        nextSyncWakeUnix, 1.0f);
+    Serial.printf("[URGENT] listening every %lu min: ~%lu windows/day, %.1f%% awake, "
+                  "~%.0f mAh/day + %.1f mAh per urgent POST\n",
+                  (unsigned long)listenMin, (unsigned long)budget.listenWakesPerDay,
+                  budget.dutyPercent, budget.listenMahPerDay, budget.postMahEach);
+  }
+  if (!urgentArmListenBefore(nextSyncWakeUnix, listenMin)) {
+    Serial.println("[FATAL] Failed to restore sync alarm - starting bounded recovery");
+    boundedRetryAndShutdown("Sync alarm arm failed");
+    return;
+  }
+
   // Verify alarm is properly set before power-down
   if (!verifyAlarmSet()) {
     Serial.println("[FATAL] Alarm verification failed - starting bounded recovery");
@@ -1958,12 +2552,147 @@ void handleSyncWake() {
     return;
   }
 
+  Serial.printf("[SYNC] node meta/config NVS reads this wake: %lu\n",
+                (unsigned long)nodeMetaNvsReadCount());
   Serial.println("[SYNC] Alarm armed and verified. Powering down.");
   setLed(false);
   delay(100);
   releasePwrHold();  // Board powers off here
 }
 
+// ---------------------------------------------------------------------------
+// Listen wake handler (low-latency mode, shared/urgent_listen.h)
+// ---------------------------------------------------------------------------
+// A short wake between sync slots, armed by urgentArmListenBefore(). Receives
+// around the nodes' wake boundary, persists the URGENT snapshots that arrive
+// through processSnapshot() like any other, and POSTs just those rows. The
+// upload cursor is not touched: the next regular upload sends the rows again
+// and the backend drops them as duplicates.
+
+// Enough left before the sync wake for power-on, attach and one POST.
+static constexpr uint32_t kUrgentPostLeadSec = 90;
+
+// One POST of the urgent rows (csv = header + rows). True when it landed.
+static bool performUrgentPost(const TransmissionSettings& txSettings, const String& csv) {
+  ModemDriver modem;
+  modem.init();
+  {
+    SimSettings sim;
+    loadSimSettings(sim);
+    modem.configureApn(sim.apn, sim.apnUser, sim.apnPass);
+  }
+  if (!modem.powerOn()) {
+    Serial.println("[URGENT] Modem power-on failed - rows wait for the sync upload");
+    return false;
+  }
+  registrationCacheApply(modem);
+  const uint32_t regStartMs = millis();
+  if (!modem.waitForNetwork(60000)) {
+    Serial.println("[URGENT] Network registration failed - rows wait for the sync upload");
+    registrationCacheFailed(millis() - regStartMs);
+    modem.gracefulShutdown();
+    return false;
+  }
+  registrationCacheRegistered(modem, millis() - regStartMs);
+  bool ok = false;
+  JsonPayload json = buildJsonUpload(csv, 100, FW_SEMVER, nullptr, getRTCTime());
+  if (json.ok && json.rowCount > 0) {
+    HttpsPostResult result = modem.httpsPost(buildUploadUrl(txSettings), json.body,
+                                             "application/json", buildUploadAuth(txSettings));
+    ok = result.httpStatus == 200;
+    Serial.printf("[URGENT] POST %u row(s), %u bytes: HTTP %d\n",
+                  (unsigned)json.rowCount, (unsigned)json.byteLength, result.httpStatus);
+  }
+  modem.gracefulShutdown();
+  return ok;
+}
+
+static void handleListenWake(uint32_t boundaryUnix, uint32_t syncWakeUnix,
+                             uint32_t listenMin) {
+  Serial.printf("=== LISTEN WAKE (boundary %lu, sync wake %lu) ===\n",
+                (unsigned long)boundaryUnix, (unsigned long)syncWakeUnix);
+  setLed(true);
+
+  if (!initSD()) {
+    Serial.println("[WARN] SD card init failed — continuing with flash if available");
+  }
+  if (!initFlash()) {
+    Serial.println("[WARN] Flash init failed — urgent snapshots go out unpersisted");
+  }
+  loadPairedNodes();
+  deploymentBootstrap();
+  if (!initEspNowSyncOnly(ESPNOW_CHANNEL)) {
+    Serial.println("[WARN] ESP-NOW init failed — listen window will be empty");
+  }
+  initSnapQueue(8);
+
+  // A retry of a frame already persisted (its ACK was lost) is ACKed again by
+  // processSnapshot() but not POSTed twice.
+  String csv = String(kUploadCSVHeader) + "\n";
+  size_t rows = 0;
+  uint32_t oldestCaptureUnix = 0;
+  EspNowSnapSlot slots[8];
+  const uint32_t closeUnix = boundaryUnix + urgent_listen::kListenTailSec;
+  while (getRTCTime() < closeUnix) {
+    const int drained = drainSnapQueue(slots, 8);
+    for (int i = 0; i < drained; ++i) {
+      DecodedSnapshot& snap = slots[i].snap;
+      const bool urgent = (snap.snapFlags & SNAP2_FLAG_URGENT) != 0;
+      const bool repeat = urgent &&
+          urgentWasPersisted(snap.nodeId, snap.seqNum, snap.nodeTimestamp, false);
+      processSnapshot(snap, slots[i].mac);
+      String row;
+      if (!urgent || repeat || !formatDecodedSnapshotCSVRow(snap, row)) continue;
+      csv += row;
+      csv += "\n";
+      rows++;
+      if (snap.nodeTimestamp > 0 &&
+          (oldestCaptureUnix == 0 || snap.nodeTimestamp < oldestCaptureUnix)) {
+        oldestCaptureUnix = snap.nodeTimestamp;
+      }
+    }
+    if (drained == 0) delay(20);
+  }
+  Serial.printf("[URGENT] listen window closed: %u urgent snapshot(s)\n", (unsigned)rows);
+  carryForwardCommit();
+
+  if (rows > 0) {
+    TransmissionSettings txSettings;
+    loadTransmissionSettings(txSettings);
+    const uint32_t nowUnix = getRTCTime();
+    if (!txSettings.enabled || !txSettings.useJsonUpload) {
+      Serial.println("[URGENT] JSON upload not enabled - rows wait for the sync upload");
+    } else if (syncWakeUnix != 0 && nowUnix + kUrgentPostLeadSec > syncWakeUnix) {
+      Serial.println("[URGENT] sync wake too close for a POST - rows go with its upload");
+    } else if (performUrgentPost(txSettings, csv) && oldestCaptureUnix > 0) {
+      urgentRecordLatency(getRTCTime() - oldestCaptureUnix);
+    }
+  }
+
+  // Next: another listen window, else the sync wake this one displaced. One
+  // that has slipped past (a long POST) is run now rather than missed.
+  const uint32_t nowUnix = getRTCTime();
+  if (syncWakeUnix <= nowUnix + 5) {
+    Serial.println("[URGENT] sync wake due - running it now");
+    handleSyncWake();
+    return;
+  }
+  if (!armAlarmAtUnix(syncWakeUnix) || !urgentArmListenBefore(syncWakeUnix, listenMin)) {
+    Serial.println("[FATAL] Failed to re-arm after listen window - starting bounded recovery");
+    boundedRetryAndShutdown("Listen re-arm failed");
+    return;
+  }
+  if (!verifyAlarmSet()) {
+    Serial.println("[FATAL] Alarm verification failed - starting bounded recovery");
+    boundedRetryAndShutdown("Alarm verification failed");
+    return;
+  }
+  Serial.println("[URGENT] Alarm armed and verified. Powering down.");
+  setLed(false);
+  delay(100);
+  releasePwrHold();
+}
+
 // ---------------------------------------------------------------------------
 // Config wake handler
 // ---------------------------------------------------------------------------
@@ -2009,6 +2738,7 @@ void handleConfigWake() {
   loadPairedNodes();
   configInitRecordingIntervalControl();
   deploymentBootstrap();
+  nodeClockSkewBegin();
   Serial.println("[CFG-DBG] Step 3 done: loadPairedNodes OK");
   Serial.flush();
 
@@ -2310,9 +3040,17 @@ void setup() {
 
   // Branch based on wake reason
   switch (reason) {
-    case WAKE_RTC_ALARM:
-      handleSyncWake();
+    case WAKE_RTC_ALARM: {
+      // Alarm 1 is either a sync wake or a listen window that displaced one.
+      uint32_t boundaryUnix = 0, syncWakeUnix = 0, listenMin = 0;
+      if (bootRtcStatus == RTC_OK &&
+          urgentTakeListenWake(getRTCTime(), boundaryUnix, syncWakeUnix, listenMin)) {
+        handleListenWake(boundaryUnix, syncWakeUnix, listenMin);
+      } else {
+        handleSyncWake();
+      }
       break;
+    }
     case WAKE_CONFIG_BUTTON:
       handleConfigWake();
       break;
@@ -0,0 +1,237 @@
+#include "ota/fleet_ota_distributor.h"
+#include "ota/node_image_cache.h"
+#include "comms/espnow_sync.h"
+#include "fw_reason.h"
+
+#include <Preferences.h>
+#include <string.h>
+
+namespace {
+
+constexpr const char* kNamespace = "fleet_ota";
+constexpr const char* kKeyTable  = "table";
+constexpr uint32_t kMagic   = 0x41544F46UL;  // "FOTA"
+constexpr uint16_t kVersion = 1;
+// Gap between chunk frames. Nodes queue kChunkQueueDepth chunks and may stall
+// ~40 ms on a first-touch sector erase; 4 ms keeps that inside their queue.
+constexpr uint32_t kChunkGapMs = 4;
+// Chunks between service() calls while bursting.
+constexpr uint16_t kServiceEveryChunks = 16;
+
+struct TableRecord {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t  count;
+  uint8_t  reserved;
+  FleetOtaNodeEntry entries[kFleetOtaMaxEntries];
+  uint32_t checksum;
+};
+
+TableRecord gTable{};
+bool        gLoaded = false;
+bool        gDirty  = false;
+FotaSender  gSender;   // ~820 B bitmap; kept off the loop-task stack
+
+uint32_t checksumFor(const TableRecord& r) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(&r);
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < offsetof(TableRecord, checksum); ++i) {
+    hash ^= p[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+void ensureLoaded() {
+  if (gLoaded) return;
+  gLoaded = true;
+  memset(&gTable, 0, sizeof(gTable));
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return;
+  TableRecord r;
+  const bool ok = prefs.getBytesLength(kKeyTable) == sizeof(r) &&
+                  prefs.getBytes(kKeyTable, &r, sizeof(r)) == sizeof(r);
+  prefs.end();
+  if (ok && r.magic == kMagic && r.version == kVersion &&
+      r.count <= kFleetOtaMaxEntries && r.checksum == checksumFor(r)) {
+    gTable = r;
+  }
+}
+
+bool saveTable() {
+  gTable.magic = kMagic;
+  gTable.version = kVersion;
+  gTable.checksum = checksumFor(gTable);
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const bool ok = prefs.putBytes(kKeyTable, &gTable, sizeof(gTable)) == sizeof(gTable);
+  prefs.end();
+  if (ok) gDirty = false;
+  return ok;
+}
+
+// Entry for nodeId, creating one (or recycling the stalest) if needed.
+FleetOtaNodeEntry& entryFor(const char* nodeId) {
+  ensureLoaded();
+  for (uint8_t i = 0; i < gTable.count; ++i) {
+    if (strncmp(gTable.entries[i].nodeId, nodeId, sizeof(gTable.entries[i].nodeId)) == 0) {
+      return gTable.entries[i];
+    }
+  }
+  uint8_t slot = gTable.count;
+  if (slot < kFleetOtaMaxEntries) {
+    ++gTable.count;
+  } else {
+    slot = 0;
+    for (uint8_t i = 1; i < gTable.count; ++i) {
+      if ((int32_t)(gTable.entries[i].sessionId - gTable.entries[slot].sessionId) < 0) slot = i;
+    }
+  }
+  FleetOtaNodeEntry& e = gTable.entries[slot];
+  memset(&e, 0, sizeof(e));
+  strncpy(e.nodeId, nodeId, sizeof(e.nodeId) - 1);
+  return e;
+}
+
+void noteNeed(const fota_need_message_t& need) {
+  char nodeId[16];
+  memcpy(nodeId, need.nodeId, sizeof(nodeId));
+  nodeId[sizeof(nodeId) - 1] = '\0';
+  if (!nodeId[0]) return;
+  FleetOtaNodeEntry& e = entryFor(nodeId);
+  e.imageId = need.imageId;
+  e.sessionId = need.sessionId;
+  e.chunksHave = need.chunksHave;
+  e.status = 0;
+  e.reason = FW_NONE;
+  gDirty = true;
+}
+
+// Merge NEEDs for this session's image; returns how many arrived.
+int collectNeeds(uint32_t sessionId) {
+  SyncOtaNeedSlot needs[8];
+  int total = 0;
+  int n = 0;
+  do {
+    n = drainOtaNeeds(needs, 8);
+    for (int i = 0; i < n; ++i) {
+      if (needs[i].need.sessionId != sessionId) continue;
+      if (!fotaSenderMergeNeed(gSender, needs[i].need)) continue;
+      noteNeed(needs[i].need);
+      ++total;
+    }
+  } while (n > 0);
+  return total;
+}
+
+}  // namespace
+
+uint32_t fleetOtaRunPhase(uint32_t sessionId, uint32_t budgetMs, void (*service)()) {
+  fota_offer_message_t offer{};
+  if (!nodeImageCacheOffer(offer)) {
+    fleetOtaCollectResults();
+    return 0;
+  }
+  strncpy(offer.command, "OTA_OFFER", sizeof(offer.command) - 1);
+  strncpy(offer.mothership_id, "M001", sizeof(offer.mothership_id) - 1);
+  offer.sessionId = sessionId;
+
+  const uint32_t startMs = millis();
+  const uint32_t deadlineMs = startMs + budgetMs;
+  uint32_t sent = 0;
+  uint16_t rounds = 0;
+  int needsTotal = 0;
+  bool readFailed = false;
+  fota_chunk_message_t chunk{};
+  strncpy(chunk.command, "OTA_CHUNK", sizeof(chunk.command) - 1);
+  chunk.imageId = offer.imageId;
+
+  while (!readFailed &&
+         (int32_t)(deadlineMs - millis()) > (int32_t)(FOTA_NEED_COLLECT_MS + 200UL)) {
+    fotaSenderReset(gSender, offer.imageId, offer.chunkCount);
+    broadcastOtaOffer(offer);
+    const uint32_t collectEndMs = millis() + FOTA_NEED_COLLECT_MS;
+    int needs = 0;
+    while ((int32_t)(collectEndMs - millis()) > 0) {
+      needs += collectNeeds(sessionId);
+      if (service) service();
+      delay(5);
+    }
+    needs += collectNeeds(sessionId);
+    fleetOtaCollectResults();
+    needsTotal += needs;
+    if (gSender.wantedCount == 0) break;  // every listener is complete or uninterested
+    ++rounds;
+
+    uint16_t index = 0;
+    uint16_t burst = 0;
+    while ((int32_t)(deadlineMs - millis()) > 0 && fotaSenderNext(gSender, index)) {
+      chunk.index = index;
+      chunk.length = fotaChunkLength(offer.imageSize, index);
+      if (!nodeImageCacheRead((uint32_t)index * FOTA_CHUNK_BYTES, chunk.data, chunk.length)) {
+        Serial.println("[FOTA] node image read failed; phase aborted");
+        readFailed = true;
+        break;
+      }
+      if (chunk.length < FOTA_CHUNK_BYTES) {
+        memset(chunk.data + chunk.length, 0, FOTA_CHUNK_BYTES - chunk.length);
+      }
+      broadcastOtaChunk(chunk);
+      ++sent;
+      if (++burst >= kServiceEveryChunks) {
+        burst = 0;
+        if (service) service();
+      }
+      delay(kChunkGapMs);
+    }
+  }
+
+  if (gDirty) saveTable();
+  Serial.printf("[FOTA] phase image=%08lX v%s rounds=%u needs=%d chunks=%lu/%u %lums\n",
+                (unsigned long)offer.imageId, offer.version, (unsigned)rounds,
+                needsTotal, (unsigned long)sent, (unsigned)offer.chunkCount,
+                (unsigned long)(millis() - startMs));
+  return sent;
+}
+
+void fleetOtaCollectResults() {
+  SyncOtaResultSlot results[8];
+  int n = 0;
+  do {
+    n = drainOtaResults(results, 8);
+    for (int i = 0; i < n; ++i) {
+      const fota_result_message_t& r = results[i].result;
+      char nodeId[16];
+      memcpy(nodeId, r.nodeId, sizeof(nodeId));
+      nodeId[sizeof(nodeId) - 1] = '\0';
+      if (!nodeId[0] || r.status < FOTA_RESULT_ARMED || r.status > FOTA_RESULT_FAILED) {
+        continue;
+      }
+      FleetOtaNodeEntry& e = entryFor(nodeId);
+      e.imageId = r.imageId;
+      e.chunksHave = r.chunksHave;
+      e.status = r.status;
+      e.reason = r.reason;
+      gDirty = true;
+      Serial.printf("[FOTA] result node=%s image=%08lX status=%u reason=%s\n",
+                    nodeId, (unsigned long)r.imageId, (unsigned)r.status,
+                    fwReasonStr((FwReason)r.reason));
+    }
+  } while (n > 0);
+  if (gDirty) saveTable();
+}
+
+uint8_t fleetOtaGetEntries(FleetOtaNodeEntry* out, uint8_t maxEntries) {
+  ensureLoaded();
+  if (!out) return 0;
+  const uint8_t n = gTable.count < maxEntries ? gTable.count : maxEntries;
+  memcpy(out, gTable.entries, n * sizeof(FleetOtaNodeEntry));
+  return n;
+}
+
+bool fleetOtaClearEntries() {
+  ensureLoaded();
+  memset(gTable.entries, 0, sizeof(gTable.entries));
+  gTable.count = 0;
+  return saveTable();
+}
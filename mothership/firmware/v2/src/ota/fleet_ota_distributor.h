@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include "fleet_ota.h"
+
+// ===== Fleet firmware distribution (mothership side) =====
+//
+// Broadcasts the cached node image (node_image_cache.h) to every node awake in
+// a coordinated sync session. One phase per session, run right after the HELLO
+// roster closes and before any node is released:
+//
+//   OTA_OFFER  ->  collect OTA_NEED for FOTA_NEED_COLLECT_MS  ->  broadcast the
+//   union of missing chunks  ->  repeat until nobody needs anything or the
+//   budget is spent.
+//
+// Nodes that miss chunks (or the whole session) report them in the next
+// round's NEED, so nothing here retries individual frames. Per-node progress
+// and OTA_RESULT outcomes are kept in a small NVS table for GET /api/fleet-ota;
+// the mothership cold-boots every wake, so RAM alone would forget them.
+
+// Per-node state as last reported. `status` is 0 while the node is still
+// collecting (from OTA_NEED), otherwise a FotaResultStatus.
+struct FleetOtaNodeEntry {
+  char     nodeId[16];
+  uint32_t imageId;
+  uint32_t sessionId;      // session of the last report
+  uint16_t chunksHave;
+  uint8_t  status;
+  uint8_t  reason;         // FwReason when status == FOTA_RESULT_FAILED
+};
+
+constexpr uint8_t kFleetOtaMaxEntries = 64;
+
+// Run one distribution phase for `sessionId`, spending at most `budgetMs`.
+// `service` is called between rounds and chunk bursts so snapshot frames keep
+// draining. No-op when no node image is cached. Returns chunks broadcast.
+uint32_t fleetOtaRunPhase(uint32_t sessionId, uint32_t budgetMs, void (*service)());
+
+// Drain queued OTA_RESULT frames into the table. Safe to call at any point of
+// a sync session; results arrive whenever a node has one pending.
+void fleetOtaCollectResults();
+
+// Copy of the persisted table; returns the entry count.
+uint8_t fleetOtaGetEntries(FleetOtaNodeEntry* out, uint8_t maxEntries);
+bool    fleetOtaClearEntries();
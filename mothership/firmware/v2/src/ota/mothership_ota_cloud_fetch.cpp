@@ -5,6 +5,10 @@
 #include "firmware_identity.h"
 #include "protocol.h"        // NODE_PROTOCOL_VERSION
 #include "fw_reason.h"
+#include "ota/ota_delta_patch.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include <SHA256.h>
 
 const char* otaLifecycleStateStr(OtaLifecycleState s) {
   switch (s) {
@@ -49,6 +53,13 @@ String otaBuildManifestUrl(const char* releaseId)    { return otaReleaseBase(rel
 String otaBuildManifestSigUrl(const char* releaseId) { return otaReleaseBase(releaseId) + "/manifest.json.sig"; }
 String otaBuildImageUrl(const char* releaseId)       { return otaReleaseBase(releaseId) + "/image.bin"; }
 
+String otaBuildPatchUrl(const char* releaseId, const char* fromSha256Hex) {
+  // release_sign.py patch_file_name(): first 16 hex chars of the base image SHA.
+  String name = String(fromSha256Hex).substring(0, 16);
+  name.toLowerCase();
+  return otaReleaseBase(releaseId) + "/patch-" + name + ".bin";
+}
+
 const char* otaPreflightReason(float batteryV, uint32_t remainingBudgetMs) {
   if (batteryV > 0.0f && batteryV < OTA_MIN_BATTERY_V) return "DEFERRED_LOW_BATTERY";
   if (remainingBudgetMs < OTA_MIN_BUDGET_MS) return "DEFERRED_BUSY";
@@ -153,6 +164,161 @@ uint8_t otaBackoffWakes(uint8_t attempts) {   // wakes to skip before next attem
   return static_cast<uint8_t>(1u << shift);   // 1, 2, 4, 8, 16, 32, 32, ...
 }
 
+// One resource downloaded as kOtaImageChunkBytes Range requests (see step 4b).
+// Stops at the first request that fails; the caller checks its sink context
+// (budget, write errors) before looking at the outcome.
+enum class RangedGet : uint8_t { Complete, Failed, RangeIgnored };
+struct RangedGetResult {
+  RangedGet            outcome;
+  HttpsGetStreamResult last;
+};
+
+RangedGetResult fetchRanged(ModemDriver& modem, const String& url, uint32_t size,
+                            HttpsStreamChunkCallback sink, void* ctx) {
+  RangedGetResult r{RangedGet::Complete, {}};
+  for (uint32_t chunkStart = 0; chunkStart < size; chunkStart += kOtaImageChunkBytes) {
+    const uint32_t chunkEndExclusive = min(chunkStart + kOtaImageChunkBytes, size);
+    const uint32_t chunkLen = chunkEndExclusive - chunkStart;
+    String range = "bytes=" + String(chunkStart) + "-" + String(chunkEndExclusive - 1);
+    r.last = modem.httpsGetStream(url, sink, ctx, 60000, "", range);
+    if (r.last.httpStatus != 206 || r.last.declaredContentLength != chunkLen) {
+      Serial.printf("[OTA] Range not honored: status=%d declared=%lu expected=%lu\n",
+                    r.last.httpStatus, (unsigned long)r.last.declaredContentLength,
+                    (unsigned long)chunkLen);
+      r.outcome = RangedGet::RangeIgnored;
+      return r;
+    }
+    if (!r.last.success) {
+      r.outcome = RangedGet::Failed;
+      return r;
+    }
+  }
+  return r;
+}
+
+// Delta patch staging. The patch is downloaded into the TAIL of the inactive
+// slot, beyond the range esp_ota_begin() erases for the new image, and applied
+// only after the modem session: a COPY op rewrites up to the whole image from
+// the running slot, far longer than the modem tolerates a stalled sink.
+struct PatchCtx {
+  const esp_partition_t* slot;
+  uint32_t base;            // staging offset within the slot
+  uint32_t size;            // patch size from the signed manifest
+  uint32_t written;
+  SHA256   sha;
+  uint32_t sessionStartMs;
+  uint32_t sessionLimitMs;
+  bool     budgetHit;
+  bool     writeFailed;
+};
+
+bool patchSink(const uint8_t* d, size_t n, void* ctx) {
+  PatchCtx* c = static_cast<PatchCtx*>(ctx);
+  if (millis() - c->sessionStartMs > c->sessionLimitMs) { c->budgetHit = true; return false; }
+  if ((uint64_t)c->written + n > c->size ||
+      esp_partition_write(c->slot, c->base + c->written, d, n) != ESP_OK) {
+    c->writeFailed = true;
+    return false;
+  }
+  c->sha.update(d, n);
+  c->written += (uint32_t)n;
+  return true;
+}
+
+struct RunningSlotSource {
+  const esp_partition_t* part;
+  bool read(uint32_t offset, uint8_t* out, size_t len) {
+    return esp_partition_read(part, offset, out, len) == ESP_OK;
+  }
+};
+
+struct InstallSink {
+  bool write(const uint8_t* data, size_t len) {
+    return mothershipOtaImageChunk(data, len) == FW_NONE;
+  }
+};
+
+OtaDeltaDecoder gDelta;   // ~700 B incl. copy buffer; kept off the loop-task stack
+
+enum class PatchOutcome : uint8_t { Applied, Unusable, BudgetHit };
+
+// Stage, verify and apply `patch`. Applied = the install core holds the whole
+// rebuilt image (not yet finished). Unusable = fall back to the full image.
+PatchOutcome installFromPatch(ModemDriver& modem, const String& patchUrl,
+                              const ManifestPatch& patch, uint32_t imageSize,
+                              uint32_t sessionStartMs, uint32_t sessionLimitMs,
+                              OtaCloudFetchResult& out) {
+  const esp_partition_t* slot = esp_ota_get_next_update_partition(NULL);
+  const esp_partition_t* run = esp_ota_get_running_partition();
+  // esp_ota_begin(imageSize) erases whole sectors up to imageSize/4096 + 1.
+  const uint32_t imageEraseEnd = (imageSize / 4096UL + 1UL) * 4096UL;
+  if (!slot || !run || patch.size >= slot->size ||
+      ((slot->size - patch.size) & ~0xFFFUL) < imageEraseEnd) {
+    Serial.printf("[OTA] delta patch (%lu B) does not fit beside the image\n",
+                  (unsigned long)patch.size);
+    return PatchOutcome::Unusable;
+  }
+  PatchCtx pctx{};
+  pctx.slot = slot;
+  pctx.base = (slot->size - patch.size) & ~0xFFFUL;
+  pctx.size = patch.size;
+  pctx.sessionStartMs = sessionStartMs;
+  pctx.sessionLimitMs = sessionLimitMs;
+  pctx.sha.reset();
+
+  // Sector 0 may hold the fleet node image cache header (node_image_cache.h);
+  // drop it so a cache whose data the staging overwrites is never offered.
+  if (esp_partition_erase_range(slot, 0, 4096) != ESP_OK ||
+      esp_partition_erase_range(slot, pctx.base, slot->size - pctx.base) != ESP_OK) {
+    return PatchOutcome::Unusable;
+  }
+
+  const uint32_t downloadStartMs = millis();
+  const RangedGetResult pr = fetchRanged(modem, patchUrl, patch.size, patchSink, &pctx);
+  out.bytesDownloaded += pctx.written;
+  out.downloadMs += millis() - downloadStartMs;
+  if (pctx.budgetHit) return PatchOutcome::BudgetHit;
+  if (pr.outcome != RangedGet::Complete || pctx.writeFailed || pctx.written != patch.size) {
+    Serial.printf("[OTA] delta patch download failed (%lu/%lu B, status %d)\n",
+                  (unsigned long)pctx.written, (unsigned long)patch.size,
+                  pr.last.httpStatus);
+    return PatchOutcome::Unusable;
+  }
+  uint8_t want[32], got[32];
+  pctx.sha.finalize(got, sizeof got);
+  if (!fwHexToBytes(patch.sha256, want, sizeof want) || memcmp(got, want, sizeof got) != 0) {
+    Serial.println("[OTA] delta patch SHA-256 mismatch");
+    return PatchOutcome::Unusable;
+  }
+
+  // Apply: staged patch + running slot -> install core, in order.
+  if (mothershipOtaImageBegin() != FW_NONE) return PatchOutcome::Unusable;
+  const uint32_t applyStartMs = millis();
+  otaDeltaReset(gDelta, patch.fromSize);
+  RunningSlotSource src{run};
+  InstallSink sink;
+  OtaDeltaStatus ds = OtaDeltaStatus::NeedMore;
+  uint8_t buf[1024];
+  for (uint32_t off = 0; off < patch.size && ds == OtaDeltaStatus::NeedMore; off += sizeof buf) {
+    const uint32_t n = (patch.size - off) < sizeof buf ? (patch.size - off) : (uint32_t)sizeof buf;
+    if (esp_partition_read(slot, pctx.base + off, buf, n) != ESP_OK) {
+      ds = OtaDeltaStatus::ReadError;
+      break;
+    }
+    ds = otaDeltaFeed(gDelta, buf, n, src, sink);
+  }
+  if (ds != OtaDeltaStatus::Done) {
+    Serial.printf("[OTA] delta patch apply failed: %s after %lu B\n",
+                  otaDeltaStatusStr(ds), (unsigned long)gDelta.written);
+    return PatchOutcome::Unusable;
+  }
+  out.bytesWritten = gDelta.written;
+  Serial.printf("[OTA] delta patch applied: %lu B patch -> %lu B image in %lums\n",
+                (unsigned long)patch.size, (unsigned long)gDelta.written,
+                (unsigned long)(millis() - applyStartMs));
+  return PatchOutcome::Applied;
+}
+
 }  // namespace
 
 OtaCloudFetchResult mothershipOtaCloudFetchAndInstall(ModemDriver& modem,
@@ -265,7 +431,42 @@ OtaCloudFetchResult mothershipOtaCloudFetchAndInstall(ModemDriver& modem,
     return t ? retryable(reason, vr) : terminal(reason, vr);
   }
 
-  // 4. DOWNLOAD image, in bounded Range-request chunks, each streamed straight
+  out.state = OtaLifecycleState::DOWNLOADING;
+  MothershipOtaStatus st0 = mothershipOtaGetStatus();
+  out.expectedSize = st0.expectedSize;
+  const uint32_t installStartMs = millis();
+  bool armed = false;
+
+  // 4a. DELTA PATCH. When the signed manifest lists a patch whose base is the
+  // image running right now, download only the patch and rebuild the new image
+  // from the running slot. Any patch problem short of the session budget falls
+  // back to the full image below; otaInstallFinish()'s SHA-256 check against the
+  // manifest judges the rebuilt image exactly as it would a downloaded one.
+  ManifestPatch patch;
+  if (mothershipOtaSelectPatch(patch)) {
+    const String patchUrl = otaBuildPatchUrl(releaseId, patch.fromSha256);
+    if (!hwEndpointAllowed(patchUrl)) {
+      return terminal("MANIFEST_INVALID", FW_MANIFEST_INVALID);
+    }
+    const PatchOutcome po = installFromPatch(modem, patchUrl, patch, st0.expectedSize,
+                                             sessionStartMs, sessionLimitMs, out);
+    if (po == PatchOutcome::BudgetHit) return deferred("DEFERRED_BUSY", FW_DEFERRED_BUSY);
+    if (po == PatchOutcome::Applied) {
+      out.state = OtaLifecycleState::VERIFYING;
+      const FwReason pr = mothershipOtaImageFinish();
+      if (pr == FW_NONE) {
+        armed = true;
+        out.delta = true;
+      } else {
+        Serial.printf("[OTA] delta-rebuilt image rejected (%s) — falling back to full image\n",
+                      fwReasonStr(pr));
+      }
+    } else {
+      mothershipOtaImageDiscard();
+    }
+  }
+
+  // 4b. FULL IMAGE, in bounded Range-request chunks, each streamed straight
   // into the install core. On-air evidence (2026-07-21/22 bench) ruled out
   // flow control as the cause of a persistent truncation: switching the whole
   // transport from auto-push to a flow-controlled manual AT+CCHRECV pull loop
@@ -279,36 +480,32 @@ OtaCloudFetchResult mothershipOtaCloudFetchAndInstall(ModemDriver& modem,
   // A 60s idle timeout (vs 20s for the small manifest/sig fetches) tolerates
   // a transient LTE stall within a chunk; the session-limit budget check in
   // imageSink still bounds the overall time across all chunks.
-  out.state = OtaLifecycleState::DOWNLOADING;
-  ImageCtx ictx{sessionStartMs, sessionLimitMs, FW_NONE, false};
-  MothershipOtaStatus st0 = mothershipOtaGetStatus();
-  out.expectedSize = st0.expectedSize;
+  if (!armed) {
+    out.state = OtaLifecycleState::DOWNLOADING;
+    out.delta = false;
+    ImageCtx ictx{sessionStartMs, sessionLimitMs, FW_NONE, false};
 
-  // Pre-erase the target partition BEFORE opening any download session. Left to
-  // run lazily on the first imageSink write, esp_ota_begin's full-partition erase
-  // (~200 ms) stalls the modem receive loop and the A7670G drops the TLS session
-  // mid-chunk — bench-proven 2026-07-22, where every chunk size truncated on
-  // chunk 0. Running it here moves the erase out of the session window, after
-  // which every in-session flash write measured <=1 ms and the full 1.3 MB image
-  // downloaded cleanly (see CLOUD_OTA_BENCH_TEST_RESULTS_2026-07-22.md, Test 4).
-  {
-    FwReason br = mothershipOtaImageBegin();
-    if (br != FW_NONE) {
-      bool t = false; const char* reason = otaFwReasonToBrief(br, &t);
-      return t ? retryable(reason, br) : terminal(reason, br);
+    // Pre-erase the target partition BEFORE opening any download session. Left to
+    // run lazily on the first imageSink write, esp_ota_begin's full-partition erase
+    // (~200 ms) stalls the modem receive loop and the A7670G drops the TLS session
+    // mid-chunk — bench-proven 2026-07-22, where every chunk size truncated on
+    // chunk 0. Running it here moves the erase out of the session window, after
+    // which every in-session flash write measured <=1 ms and the full 1.3 MB image
+    // downloaded cleanly (see CLOUD_OTA_BENCH_TEST_RESULTS_2026-07-22.md, Test 4).
+    {
+      FwReason br = mothershipOtaImageBegin();
+      if (br != FW_NONE) {
+        bool t = false; const char* reason = otaFwReasonToBrief(br, &t);
+        return t ? retryable(reason, br) : terminal(reason, br);
+      }
     }
-  }
 
-  for (uint32_t chunkStart = 0; chunkStart < st0.expectedSize; chunkStart += kOtaImageChunkBytes) {
-    const uint32_t chunkEndExclusive =
-        min(chunkStart + kOtaImageChunkBytes, st0.expectedSize);
-    const uint32_t chunkLen = chunkEndExclusive - chunkStart;
-    String range = "bytes=" + String(chunkStart) + "-" + String(chunkEndExclusive - 1);
-
-    HttpsGetStreamResult ir = modem.httpsGetStream(imageUrl, imageSink, &ictx, 60000,
-                                                   "", range);
-    MothershipOtaStatus st1 = mothershipOtaGetStatus();
-    out.bytesWritten = st1.written;
+    const uint32_t downloadStartMs = millis();
+    const RangedGetResult ir =
+        fetchRanged(modem, imageUrl, st0.expectedSize, imageSink, &ictx);
+    out.bytesWritten = mothershipOtaGetStatus().written;
+    out.bytesDownloaded += out.bytesWritten;
+    out.downloadMs += millis() - downloadStartMs;
 
     if (ictx.budgetHit) return deferred("DEFERRED_BUSY", FW_DEFERRED_BUSY);
     if (ictx.lastFwReason != FW_NONE) {
@@ -320,30 +517,36 @@ OtaCloudFetchResult mothershipOtaCloudFetchAndInstall(ModemDriver& modem,
     // requested slice (a properly-ranged 206's Content-Length is the SLICE
     // length, not the whole resource) — chunking cannot help against a server
     // that won't honor Range, so don't spin retrying it forever.
-    if (ir.httpStatus != 206 || ir.declaredContentLength != chunkLen) {
-      Serial.printf("[OTA] Range not honored: status=%d declared=%lu expected=%lu\n",
-                    ir.httpStatus, (unsigned long)ir.declaredContentLength,
-                    (unsigned long)chunkLen);
+    if (ir.outcome == RangedGet::RangeIgnored) {
       return terminal("DOWNLOAD_FAILED", FW_DOWNLOAD_FAILED);
     }
-    if (!ir.success) {
+    if (ir.outcome == RangedGet::Failed) {
       // Transport ended before this chunk's declared body -> truncated
       // (retryable; the whole install restarts from chunk 0 next wake — the
       // install core has no partial-image resume, same as before chunking).
-      return retryable(ir.aborted ? "DOWNLOAD_TIMEOUT" : "DOWNLOAD_TRUNCATED",
-                       ir.aborted ? FW_DOWNLOAD_TIMEOUT : FW_DOWNLOAD_TRUNCATED);
+      return retryable(ir.last.aborted ? "DOWNLOAD_TIMEOUT" : "DOWNLOAD_TRUNCATED",
+                       ir.last.aborted ? FW_DOWNLOAD_TIMEOUT : FW_DOWNLOAD_TRUNCATED);
     }
-  }
 
-  // 5. FINISH (size + SHA-256 + esp_ota_end + set-boot). Arms the release.
-  out.state = OtaLifecycleState::VERIFYING;
-  FwReason fr = mothershipOtaImageFinish();
-  if (fr != FW_NONE) {
-    const char* reason = otaFwReasonToBrief(fr, nullptr);
-    // A complete-but-bad image is terminal; treat everything here as terminal.
-    return terminal(reason, fr);
+    // 5. FINISH (size + SHA-256 + esp_ota_end + set-boot). Arms the release.
+    out.state = OtaLifecycleState::VERIFYING;
+    FwReason fr = mothershipOtaImageFinish();
+    if (fr != FW_NONE) {
+      const char* reason = otaFwReasonToBrief(fr, nullptr);
+      // A complete-but-bad image is terminal; treat everything here as terminal.
+      return terminal(reason, fr);
+    }
   }
 
+  out.installMs = millis() - installStartMs;
+  OtaInstallStats stats{};
+  stats.delta = out.delta ? 1 : 0;
+  stats.imageBytes = out.expectedSize;
+  stats.downloadedBytes = out.bytesDownloaded;
+  stats.downloadMs = out.downloadMs;
+  stats.installMs = out.installMs;
+  otaReleaseStoreSetInstallStats(stats);
+
   // Success: image flashed + boot-armed. The release store already recorded it
   // ARMED (in mothershipOtaImageFinish). Clear the fetch intent; the next boot
   // confirms it via mothershipOtaFirstBootCheck -> promote to INSTALLED.
@@ -31,6 +31,11 @@ struct OtaCloudFetchResult {
   uint32_t          expectedSize = 0;
   bool              rebootPending = false; // install armed; caller may reboot
   bool              transient = false;     // failure is retryable next wake
+  // Transfer accounting (also persisted as status.firmware.lastInstall).
+  bool              delta = false;         // image rebuilt from a delta patch
+  uint32_t          bytesDownloaded = 0;   // patch and/or image bytes over LTE
+  uint32_t          downloadMs = 0;
+  uint32_t          installMs = 0;         // first download request -> armed
 };
 
 // ---- Pure helpers (no IO — unit-tested in tests/test_ota_cloud_fetch.cpp) ----
@@ -40,6 +45,9 @@ struct OtaCloudFetchResult {
 String otaBuildManifestUrl(const char* releaseId);
 String otaBuildManifestSigUrl(const char* releaseId);
 String otaBuildImageUrl(const char* releaseId);
+// Delta patch against the image whose SHA-256 is fromSha256Hex:
+// .../<releaseId>/patch-<first 16 hex of fromSha256>.bin (release_sign.py).
+String otaBuildPatchUrl(const char* releaseId, const char* fromSha256Hex);
 
 // Preflight gate decision. Returns a brief §5.5 reason string:
 //   "NONE"                -> proceed
@@ -65,6 +73,9 @@ const char* otaFwReasonToBrief(int fwReason, bool* isTransient);
 // ---- Full orchestration (IO — proven on-air in the bench plan) ----
 
 // Drive PREFLIGHT -> fetch manifest+sig -> verify -> stream image -> finish.
+// When the manifest carries a delta patch for the running image, the patch is
+// downloaded instead and the image rebuilt on device; the full image is the
+// fallback if the patch cannot be used.
 // `batteryV` gates preflight (pass <=0 to skip). sessionStartMs/sessionLimitMs
 // bound the whole operation against the wake's shared budget.
 OtaCloudFetchResult mothershipOtaCloudFetchAndInstall(ModemDriver& modem,
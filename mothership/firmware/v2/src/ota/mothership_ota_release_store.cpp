@@ -11,6 +11,13 @@ constexpr const char* kKeyB = "rec_b";
 constexpr uint32_t kMagic = 0x464D4F52UL;   // "FMOR" (FieldMesh OTA Release)
 constexpr uint16_t kVersion = 1;
 constexpr size_t   kReleaseIdLen = 40;
+constexpr const char* kKeyStats = "stats";
+constexpr uint32_t kStatsMagic = 0x53544F46UL;  // "FOTS"
+
+struct StatsRecord {
+  uint32_t        magic;
+  OtaInstallStats stats;
+};
 
 struct ReleaseRecord {
   uint32_t magic;
@@ -235,6 +242,30 @@ bool otaReleaseStoreClearArmed() {
   return persist();
 }
 
+bool otaReleaseStoreSetInstallStats(const OtaInstallStats& stats) {
+  StatsRecord rec{};
+  rec.magic = kStatsMagic;
+  rec.stats = stats;
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const bool ok = prefs.putBytes(kKeyStats, &rec, sizeof(rec)) == sizeof(rec);
+  prefs.end();
+  return ok;
+}
+
+bool otaReleaseStoreGetInstallStats(OtaInstallStats& out) {
+  memset(&out, 0, sizeof(out));
+  StatsRecord rec{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return false;
+  const bool ok = prefs.getBytesLength(kKeyStats) == sizeof(rec) &&
+                  prefs.getBytes(kKeyStats, &rec, sizeof(rec)) == sizeof(rec) &&
+                  rec.magic == kStatsMagic;
+  prefs.end();
+  if (ok) out = rec.stats;
+  return ok;
+}
+
 void otaReleaseStoreResetForTest() {
   Preferences prefs;
   if (prefs.begin(kNamespace, false)) {
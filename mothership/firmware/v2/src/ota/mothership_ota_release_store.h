@@ -69,5 +69,19 @@ bool     otaReleaseStoreGetArmed(char* out, size_t outLen, uint32_t* outSequence
 bool     otaReleaseStorePromoteArmed();
 bool     otaReleaseStoreClearArmed();
 
+// ---- Last install transfer stats (delta-patch savings) ----
+// Written when a cloud install is armed; read back after the reboot so the
+// status upload can report what the download actually cost. Kept under its own
+// key so the release record layout above is untouched.
+struct OtaInstallStats {
+  uint8_t  delta;            // 1 = rebuilt from a delta patch
+  uint32_t imageBytes;       // size of the full image
+  uint32_t downloadedBytes;  // bytes fetched over LTE (patch or image)
+  uint32_t downloadMs;       // time spent downloading
+  uint32_t installMs;        // first download request -> image armed
+};
+bool     otaReleaseStoreSetInstallStats(const OtaInstallStats& stats);
+bool     otaReleaseStoreGetInstallStats(OtaInstallStats& out);
+
 // Test-only: wipe the whole namespace back to defaults.
 void     otaReleaseStoreResetForTest();
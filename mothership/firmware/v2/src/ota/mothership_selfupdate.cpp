@@ -3,25 +3,12 @@
 #include "protocol.h"           // NODE_PROTOCOL_VERSION
 #include "firmware_identity.h"
 #include "firmware_manifest.h"
+#include "release_pubkey.h"     // kReleasePubKey
 #include "ota_installer.h"
 #include "esp_ota_ops.h"        // esp_ota_get_*_partition, get_partition_description
 #include "esp_partition.h"      // esp_partition_find / _next / _get
 #include "esp_app_format.h"     // esp_app_desc_t
 
-// ---------------------------------------------------------------------------
-// Release verification public key (Ed25519, 32 bytes).
-//
-// *** PLACEHOLDER — bench/test key from scripts/release_sign.py. ***
-// Before any real deployment, replace with the PRODUCTION public key whose
-// private half is generated by `release_sign.py keygen` and kept offline.
-// ---------------------------------------------------------------------------
-// *** BENCH KEY — TEMPORARY *** Revert to the production key above after the
-// cloud-OTA bench. Private half is in scripts/ota-bench/bench-key.json (gitignored),
-// generated locally with scripts/release_sign.py keygen. See
-// docs/FIELDMESH_CLOUD_OTA_BENCH_RUNBOOK.md.
-// FieldMesh release verification public key (Ed25519, 32 bytes)
-static const uint8_t kReleasePubKey[32] = { 0x09, 0x8c, 0x05, 0x3a, 0x8f, 0xee, 0x38, 0x5d, 0x84, 0x8c, 0x5c, 0x06, 0xcc, 0x9b, 0x8f, 0xe3, 0xa2, 0x5c, 0x60, 0x09, 0x60, 0xcc, 0x96, 0xbb, 0x24, 0x7d, 0xa2, 0xda, 0x57, 0x84, 0x26, 0x3c };
-
 // Single self-update state (one local upload at a time).
 static bool                gManifestReady = false;
 static bool                gInstalling    = false;
@@ -31,6 +18,8 @@ static char                gExpectedSha[65];
 static char                gTargetVersion[16];
 static char                gTargetReleaseId[40];
 static uint32_t            gTargetSequence = 0;
+static ManifestPatch       gPatches[FW_MANIFEST_MAX_PATCHES];
+static uint8_t             gPatchCount    = 0;
 static FwReason            gLastReason    = FW_NONE;
 
 // Anti-downgrade source: the monotonic releaseSequence of the confirmed-running
@@ -48,6 +37,7 @@ FwReason mothershipOtaVerifyManifest(const uint8_t* json, size_t len,
   gManifestReady = false;
   gInstalling = false;
   gExpectedSize = 0;
+  gPatchCount = 0;
 
   if (!manifestVerifySignature(json, len, sig, kReleasePubKey)) {
     gLastReason = FW_SIGNATURE_INVALID; return gLastReason;
@@ -66,11 +56,18 @@ FwReason mothershipOtaVerifyManifest(const uint8_t* json, size_t len,
   strlcpy(gTargetVersion, art->version, sizeof gTargetVersion);
   strlcpy(gTargetReleaseId, m.releaseId, sizeof gTargetReleaseId);
   gTargetSequence = m.releaseSequence;
+  gPatchCount = art->patchCount;
+  memcpy(gPatches, art->patches, sizeof(gPatches));
   gManifestReady = true;
   gLastReason = FW_NONE;
   return FW_NONE;
 }
 
+bool mothershipOtaVerifyReleaseSignature(const uint8_t* json, size_t len,
+                                         const uint8_t sig[64]) {
+  return manifestVerifySignature(json, len, sig, kReleasePubKey);
+}
+
 FwReason mothershipOtaImageBegin() {
   if (!gManifestReady) { gLastReason = FW_MANIFEST_INVALID; return gLastReason; }
   if (gInstalling) return FW_NONE;   // idempotent: already begun this install
@@ -106,6 +103,26 @@ FwReason mothershipOtaImageFinish() {
   return gLastReason;
 }
 
+void mothershipOtaImageDiscard() {
+  if (gInstalling) { otaInstallAbort(gInstall); gInstalling = false; }
+}
+
+bool mothershipOtaSelectPatch(ManifestPatch& out) {
+  if (!gManifestReady || gPatchCount == 0) return false;
+  const esp_partition_t* run = esp_ota_get_running_partition();
+  if (!run) return false;
+  for (uint8_t i = 0; i < gPatchCount; ++i) {
+    const ManifestPatch& p = gPatches[i];
+    uint8_t want[32], got[32];
+    if (p.fromSize > run->size || !fwHexToBytes(p.fromSha256, want, sizeof want)) continue;
+    if (otaSha256Partition(run, p.fromSize, got) && memcmp(got, want, sizeof got) == 0) {
+      out = p;
+      return true;
+    }
+  }
+  return false;
+}
+
 uint32_t mothershipOtaTargetSequence() { return gTargetSequence; }
 
 void mothershipOtaAbort() {
@@ -237,6 +254,19 @@ String mothershipFirmwareStatusJson() {
   const bool haveArmed = otaReleaseStoreGetArmed(armedRid, sizeof(armedRid), &armedSeq);
   if (haveArmed) { j += ",\"armedReleaseId\":\""; j += armedRid; j += "\""; }
   else           { j += ",\"armedReleaseId\":null"; }
+  // Transfer cost of the last cloud install: with a delta patch downloadBytes
+  // is far below imageBytes.
+  OtaInstallStats stats;
+  if (otaReleaseStoreGetInstallStats(stats)) {
+    j += ",\"lastInstall\":{\"delta\":";   j += stats.delta ? "true" : "false";
+    j += ",\"imageBytes\":";               j += String(stats.imageBytes);
+    j += ",\"downloadBytes\":";            j += String(stats.downloadedBytes);
+    j += ",\"downloadMs\":";               j += String(stats.downloadMs);
+    j += ",\"installMs\":";                j += String(stats.installMs);
+    j += "}";
+  } else {
+    j += ",\"lastInstall\":null";
+  }
   j += ",\"runningSlot\":\"";          j += (run ? run->label : "?");
   j += "\",\"otaState\":\"";           j += otaState;
   j += "\",\"otaReason\":\"";          j += fwReasonStr(gLastReason);
@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include "fw_reason.h"
+#include "firmware_manifest.h"   // ManifestPatch
 
 // ===== Mothership local self-update (plan §7.1) =====
 //
@@ -26,6 +27,12 @@ FwReason mothershipOtaVerifyManifest(const uint8_t* json, size_t len,
                                      const uint8_t sig[64],
                                      bool allowDowngrade = false);
 
+// Ed25519 check of release-signed bytes (a manifest or a fleet OTA statement)
+// against the release key (release_pubkey.h), without staging anything. Used by
+// the node image cache (fleet distribution).
+bool mothershipOtaVerifyReleaseSignature(const uint8_t* json, size_t len,
+                                         const uint8_t sig[64]);
+
 // Begin the install (allocate the inactive slot + ERASE it) up front, before any
 // image bytes arrive. The cloud OTA path MUST call this after a successful verify
 // and BEFORE opening the image download session. esp_ota_begin() erases the whole
@@ -48,6 +55,15 @@ FwReason mothershipOtaImageChunk(const uint8_t* data, size_t len);
 // release is recorded ARMED in the NVS release store for post-reboot promotion.
 FwReason mothershipOtaImageFinish();
 
+// Abort an install in progress but keep the verified manifest staged, so the
+// cloud path can still stream the full image after a delta patch fails.
+void mothershipOtaImageDiscard();
+
+// Delta patch listed for the staged artifact whose base image is the one now
+// running (SHA-256 of the running slot's first fromSize bytes), if any. Hashes
+// the running slot once per candidate, so call it once per install attempt.
+bool mothershipOtaSelectPatch(ManifestPatch& out);
+
 // releaseSequence of the manifest currently staged (0 if none verified). The
 // cloud-fetch orchestrator reads this to record the ARMED release alongside its
 // releaseId.
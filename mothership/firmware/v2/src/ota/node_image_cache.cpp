@@ -0,0 +1,215 @@
+#include "ota/node_image_cache.h"
+#include "ota/mothership_selfupdate.h"   // release signature key, staged self-update
+#include "firmware_manifest.h"
+#include "ota_installer.h"               // otaIsPendingVerify
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include <SHA256.h>
+
+namespace {
+
+constexpr uint32_t kHeaderMagic   = 0x494E4D46u;  // "FMNI"
+constexpr uint32_t kHeaderVersion = 3;  // 2: + fleetSig, 3: + releaseSequence
+
+struct NodeImageHeader {
+  uint32_t magic;
+  uint32_t headerVersion;
+  uint32_t size;
+  uint32_t imageId;
+  uint8_t  sha256[32];
+  char     version[12];
+  char     hwTarget[16];
+  char     releaseId[40];
+  uint32_t releaseSequence;  // signed into fleetSig; nodes refuse older ones
+  uint8_t  fleetSig[64];     // release signature relayed in every OTA_OFFER
+  uint32_t checksum;         // FNV-1a over every byte above
+};
+
+uint32_t headerChecksum(const NodeImageHeader& h) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(&h);
+  uint32_t x = 2166136261u;
+  for (size_t i = 0; i < offsetof(NodeImageHeader, checksum); ++i) {
+    x ^= p[i];
+    x *= 16777619u;
+  }
+  return x;
+}
+
+// Staged by verifyManifest, committed by finish.
+bool            gManifestReady = false;
+bool            gUploading     = false;
+NodeImageHeader gPending{};
+uint32_t        gWritten       = 0;
+SHA256          gSha;
+FwReason        gLastReason    = FW_NONE;
+
+// The inactive app slot, or null when it is not ours to use: a new mothership
+// image on probation (the slot is its rollback target) or one armed for the
+// next boot.
+const esp_partition_t* cacheSlot() {
+  if (otaIsPendingVerify()) return nullptr;
+  if (esp_ota_get_boot_partition() != esp_ota_get_running_partition()) return nullptr;
+  return esp_ota_get_next_update_partition(nullptr);
+}
+
+bool readHeader(const esp_partition_t* slot, NodeImageHeader& h) {
+  if (!slot || esp_partition_read(slot, 0, &h, sizeof(h)) != ESP_OK) return false;
+  return h.magic == kHeaderMagic && h.headerVersion == kHeaderVersion &&
+         h.size > 0 && h.size <= FOTA_MAX_IMAGE_BYTES &&
+         h.size <= slot->size - kNodeImageCacheDataOffset &&
+         h.checksum == headerChecksum(h);
+}
+
+}  // namespace
+
+FwReason nodeImageCacheVerifyManifest(const uint8_t* json, size_t len,
+                                      const uint8_t sig[64]) {
+  nodeImageCacheAbort();
+  if (!mothershipOtaVerifyReleaseSignature(json, len, sig)) {
+    gLastReason = FW_SIGNATURE_INVALID; return gLastReason;
+  }
+  Manifest m;
+  if (!manifestParse(json, len, m)) { gLastReason = FW_MANIFEST_INVALID; return gLastReason; }
+  const ManifestArtifact* art = manifestArtifactForRole(m, "node");
+  if (!art || art->hwTargetCount == 0) {
+    gLastReason = FW_NO_ARTIFACT_FOR_DEVICE; return gLastReason;
+  }
+  if (art->size == 0 || art->size > FOTA_MAX_IMAGE_BYTES) {
+    gLastReason = FW_IMAGE_TOO_LARGE; return gLastReason;
+  }
+
+  memset(&gPending, 0, sizeof(gPending));
+  gPending.magic = kHeaderMagic;
+  gPending.headerVersion = kHeaderVersion;
+  gPending.size = art->size;
+  if (!fwHexToBytes(art->sha256, gPending.sha256, sizeof(gPending.sha256))) {
+    gLastReason = FW_MANIFEST_INVALID; return gLastReason;
+  }
+  gPending.imageId = fotaImageIdOf(gPending.sha256);
+  strlcpy(gPending.version, art->version, sizeof(gPending.version));
+  // Nodes compare against their own single hardware target; the first listed
+  // target is the one the fleet is offered.
+  strlcpy(gPending.hwTarget, art->hwTargets[0], sizeof(gPending.hwTarget));
+  strlcpy(gPending.releaseId, m.releaseId, sizeof(gPending.releaseId));
+  gPending.releaseSequence = m.releaseSequence;
+  // Nodes accept an offer only with the release signature over its statement;
+  // caching an image no node would take is rejected here, up front.
+  uint8_t statement[FOTA_STATEMENT_BYTES];
+  fotaOfferStatement(statement, gPending.size, gPending.sha256, gPending.version,
+                     gPending.hwTarget, gPending.releaseSequence);
+  if (strlen(art->version) >= sizeof(gPending.version) ||
+      !fwHexToBytes(art->fleetSig, gPending.fleetSig, sizeof(gPending.fleetSig)) ||
+      !mothershipOtaVerifyReleaseSignature(statement, sizeof statement, gPending.fleetSig)) {
+    gLastReason = FW_SIGNATURE_INVALID; return gLastReason;
+  }
+  gManifestReady = true;
+  gLastReason = FW_NONE;
+  return FW_NONE;
+}
+
+FwReason nodeImageCacheWrite(const uint8_t* data, size_t len) {
+  if (!gManifestReady) { gLastReason = FW_MANIFEST_INVALID; return gLastReason; }
+  const esp_partition_t* slot = cacheSlot();
+  if (!slot || mothershipOtaGetStatus().manifestReady) {
+    gLastReason = FW_DEFERRED_BUSY; return gLastReason;  // slot holds a mothership image
+  }
+  if (!gUploading) {
+    const uint32_t eraseBytes =
+        (kNodeImageCacheDataOffset + gPending.size + 0xFFFu) & ~0xFFFu;
+    if (eraseBytes > slot->size) { gLastReason = FW_IMAGE_TOO_LARGE; return gLastReason; }
+    if (esp_partition_erase_range(slot, 0, eraseBytes) != ESP_OK) {
+      gLastReason = FW_FLASH_WRITE_FAILED; return gLastReason;
+    }
+    gSha.reset();
+    gWritten = 0;
+    gUploading = true;
+  }
+  if ((uint64_t)gWritten + len > gPending.size) {
+    nodeImageCacheAbort(); gLastReason = FW_SIZE_MISMATCH; return gLastReason;
+  }
+  if (esp_partition_write(slot, kNodeImageCacheDataOffset + gWritten, data, len) != ESP_OK) {
+    nodeImageCacheAbort(); gLastReason = FW_FLASH_WRITE_FAILED; return gLastReason;
+  }
+  gSha.update(data, len);
+  gWritten += len;
+  return FW_NONE;
+}
+
+FwReason nodeImageCacheFinish() {
+  if (!gUploading) { gLastReason = FW_IMAGE_INVALID; return gLastReason; }
+  gUploading = false;
+  gManifestReady = false;
+  if (gWritten != gPending.size) { gLastReason = FW_SIZE_MISMATCH; return gLastReason; }
+  uint8_t got[32];
+  gSha.finalize(got, sizeof got);
+  if (memcmp(got, gPending.sha256, sizeof got) != 0) {
+    gLastReason = FW_HASH_MISMATCH; return gLastReason;
+  }
+  const esp_partition_t* slot = cacheSlot();
+  gPending.checksum = headerChecksum(gPending);
+  if (!slot || esp_partition_write(slot, 0, &gPending, sizeof(gPending)) != ESP_OK) {
+    gLastReason = FW_FLASH_WRITE_FAILED; return gLastReason;
+  }
+  gLastReason = FW_NONE;
+  Serial.printf("[FOTA] node image v%s (%s, %lu bytes, id %08lX) cached for fleet broadcast\n",
+                gPending.version, gPending.hwTarget, (unsigned long)gPending.size,
+                (unsigned long)gPending.imageId);
+  return FW_NONE;
+}
+
+void nodeImageCacheAbort() {
+  gUploading = false;
+  gManifestReady = false;
+  gWritten = 0;
+}
+
+bool nodeImageCacheClear() {
+  nodeImageCacheAbort();
+  const esp_partition_t* slot = cacheSlot();
+  NodeImageHeader h;
+  if (!readHeader(slot, h)) return true;  // nothing cached (or not ours)
+  return esp_partition_erase_range(slot, 0, kNodeImageCacheDataOffset) == ESP_OK;
+}
+
+bool nodeImageCacheOffer(fota_offer_message_t& out) {
+  if (gUploading) return false;
+  NodeImageHeader h;
+  if (!readHeader(cacheSlot(), h)) return false;
+  out.imageId = h.imageId;
+  out.imageSize = h.size;
+  out.chunkCount = fotaChunkCountFor(h.size);
+  out.chunkBytes = FOTA_CHUNK_BYTES;
+  memcpy(out.sha256, h.sha256, sizeof(out.sha256));
+  strlcpy(out.version, h.version, sizeof(out.version));
+  strlcpy(out.hwTarget, h.hwTarget, sizeof(out.hwTarget));
+  out.releaseSequence = h.releaseSequence;
+  memcpy(out.signature, h.fleetSig, sizeof(out.signature));
+  return true;
+}
+
+bool nodeImageCacheRead(uint32_t offset, uint8_t* out, size_t len) {
+  const esp_partition_t* slot = cacheSlot();
+  if (!slot || !out) return false;
+  return esp_partition_read(slot, kNodeImageCacheDataOffset + offset, out, len) == ESP_OK;
+}
+
+NodeImageCacheStatus nodeImageCacheGetStatus() {
+  NodeImageCacheStatus s{};
+  s.uploading = gUploading;
+  s.written = gWritten;
+  s.lastReason = gLastReason;
+  NodeImageHeader h;
+  if (gUploading || gManifestReady) {
+    h = gPending;
+  } else if (readHeader(cacheSlot(), h)) {
+    s.present = true;
+  } else {
+    return s;
+  }
+  s.size = h.size;
+  s.imageId = h.imageId;
+  strlcpy(s.version, h.version, sizeof s.version);
+  strlcpy(s.hwTarget, h.hwTarget, sizeof s.hwTarget);
+  strlcpy(s.releaseId, h.releaseId, sizeof s.releaseId);
+  return s;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <Arduino.h>
+#include "fw_reason.h"
+#include "fleet_ota.h"
+
+// ===== Node firmware image cache (fleet distribution source) =====
+//
+// Holds the one node image the mothership broadcasts to the fleet over ESP-NOW
+// (fleet_ota.h, fleet_ota_distributor.h). The image lives in the mothership's
+// own INACTIVE app slot: the LittleFS partition (768 KiB) cannot hold a node
+// image (~830 KiB), and the inactive slot is idle except while a mothership
+// self-update is staged. Layout:
+//
+//   0x0000  header sector  magic, size, SHA-256, version, hwTarget, releaseId,
+//                          fleet OTA signature (fleet_ota.h)
+//   0x1000  node image     raw bytes exactly as in the signed manifest
+//
+// The header is written LAST, after the streamed bytes hashed to the manifest
+// SHA-256, so a torn upload never looks valid. A mothership self-update erases
+// the slot and with it the cache; offers simply stop until the node image is
+// uploaded again.
+//
+// Upload flow mirrors the mothership self-update (config UI):
+//   1) nodeImageCacheVerifyManifest()  signature + "node" artifact + its fleetSig
+//   2) nodeImageCacheWrite()...        streamed image bytes
+//   3) nodeImageCacheFinish()          size + SHA-256, then commit header
+
+constexpr uint32_t kNodeImageCacheDataOffset = 0x1000;
+
+FwReason nodeImageCacheVerifyManifest(const uint8_t* json, size_t len,
+                                      const uint8_t sig[64]);
+// Ordered image bytes. The first call erases the slot (header + image range).
+FwReason nodeImageCacheWrite(const uint8_t* data, size_t len);
+FwReason nodeImageCacheFinish();
+void     nodeImageCacheAbort();
+// Drop the cached image (erase the header sector).
+bool     nodeImageCacheClear();
+
+// True when a committed image is present; fills the fleet OTA_OFFER fields
+// (everything except command/mothership_id/sessionId).
+bool nodeImageCacheOffer(fota_offer_message_t& out);
+// Random access into the cached image.
+bool nodeImageCacheRead(uint32_t offset, uint8_t* out, size_t len);
+
+struct NodeImageCacheStatus {
+  bool     present;          // committed image available for broadcast
+  bool     uploading;
+  uint32_t size;
+  uint32_t written;
+  uint32_t imageId;
+  char     version[12];
+  char     hwTarget[16];
+  char     releaseId[40];
+  FwReason lastReason;
+};
+NodeImageCacheStatus nodeImageCacheGetStatus();
@@ -0,0 +1,218 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// ===== Binary delta patch decoder ("FMDP", produced by scripts/release_sign.py) =====
+//
+// A patch rebuilds a new image from the image the device is already running
+// plus the bytes that changed, so a small release costs a small download.
+// Layout (little-endian):
+//
+//   header  "FMDP" | version=1 | 3 reserved | sourceSize u32 | targetSize u32
+//           | sourceSha256[32] | targetSha256[32]                      (80 B)
+//   ops     0x01 COPY    srcOffset u32, length u32   bytes from the old image
+//           0x02 INSERT  length u32, then `length` literal bytes
+//           0x00 END     output must equal targetSize; nothing may follow
+//
+// The decoder is fed the patch in arbitrary pieces and emits the new image in
+// order through a caller sink, reading COPY ranges through a caller source, so
+// RAM stays bounded (one small copy buffer) whatever the image size. It only
+// checks structure and bounds: the SHA-256 of the rebuilt image, checked by
+// otaInstallFinish() against the signed manifest, stays the authority.
+//
+// Pure code (no Arduino, no esp_ota) so the tooling round trip can be checked
+// off-target.
+
+#define OTA_DELTA_MAGIC        "FMDP"
+#define OTA_DELTA_VERSION      1u
+#define OTA_DELTA_HEADER_BYTES 80u
+#define OTA_DELTA_COPY_CHUNK   512u
+
+enum OtaDeltaOp : uint8_t {
+  OTA_DELTA_OP_END    = 0x00,
+  OTA_DELTA_OP_COPY   = 0x01,
+  OTA_DELTA_OP_INSERT = 0x02,
+};
+
+enum class OtaDeltaStatus : uint8_t {
+  NeedMore,        // consumed everything; feed the next piece
+  Done,            // END seen and the output is exactly targetSize
+  BadFormat,       // magic/version/opcode/trailing bytes
+  SourceMismatch,  // header source size differs from the running image
+  SourceRange,     // COPY outside the old image
+  TargetOverflow,  // output would exceed targetSize (or END came early)
+  ReadError,       // source read failed
+  WriteError,      // sink write failed
+};
+
+struct OtaDeltaHeader {
+  uint32_t sourceSize;
+  uint32_t targetSize;
+  uint8_t  sourceSha256[32];
+  uint8_t  targetSha256[32];
+};
+
+struct OtaDeltaDecoder {
+  enum class Phase : uint8_t { Header, Opcode, Args, Literal, Done, Failed };
+  Phase          phase;
+  uint8_t        op;
+  uint8_t        argHave;
+  uint8_t        argNeed;
+  uint16_t       headerHave;
+  uint32_t       expectSourceSize;  // 0 = accept whatever the header says
+  uint32_t       literalLeft;
+  uint32_t       written;
+  OtaDeltaHeader header;
+  OtaDeltaStatus failure;
+  uint8_t        headerBuf[OTA_DELTA_HEADER_BYTES];
+  uint8_t        args[8];
+  uint8_t        copyBuf[OTA_DELTA_COPY_CHUNK];
+};
+
+inline void otaDeltaReset(OtaDeltaDecoder& d, uint32_t expectSourceSize) {
+  memset(&d, 0, sizeof(d));
+  d.phase = OtaDeltaDecoder::Phase::Header;
+  d.expectSourceSize = expectSourceSize;
+}
+
+inline uint32_t otaDeltaLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+namespace ota_delta_detail {
+
+inline OtaDeltaStatus fail(OtaDeltaDecoder& d, OtaDeltaStatus s) {
+  d.phase = OtaDeltaDecoder::Phase::Failed;
+  d.failure = s;
+  return s;
+}
+
+inline OtaDeltaStatus parseHeader(OtaDeltaDecoder& d) {
+  const uint8_t* h = d.headerBuf;
+  if (memcmp(h, OTA_DELTA_MAGIC, 4) != 0 || h[4] != OTA_DELTA_VERSION) {
+    return fail(d, OtaDeltaStatus::BadFormat);
+  }
+  d.header.sourceSize = otaDeltaLe32(h + 8);
+  d.header.targetSize = otaDeltaLe32(h + 12);
+  memcpy(d.header.sourceSha256, h + 16, 32);
+  memcpy(d.header.targetSha256, h + 48, 32);
+  if (d.expectSourceSize != 0 && d.header.sourceSize != d.expectSourceSize) {
+    return fail(d, OtaDeltaStatus::SourceMismatch);
+  }
+  d.phase = OtaDeltaDecoder::Phase::Opcode;
+  return OtaDeltaStatus::NeedMore;
+}
+
+template <class Source, class Sink>
+OtaDeltaStatus runCopy(OtaDeltaDecoder& d, uint32_t offset, uint32_t length,
+                       Source& src, Sink& sink) {
+  if ((uint64_t)offset + length > d.header.sourceSize) {
+    return fail(d, OtaDeltaStatus::SourceRange);
+  }
+  if ((uint64_t)d.written + length > d.header.targetSize) {
+    return fail(d, OtaDeltaStatus::TargetOverflow);
+  }
+  while (length > 0) {
+    const uint32_t n = length < OTA_DELTA_COPY_CHUNK ? length : OTA_DELTA_COPY_CHUNK;
+    if (!src.read(offset, d.copyBuf, n)) return fail(d, OtaDeltaStatus::ReadError);
+    if (!sink.write(d.copyBuf, n)) return fail(d, OtaDeltaStatus::WriteError);
+    offset += n;
+    length -= n;
+    d.written += n;
+  }
+  return OtaDeltaStatus::NeedMore;
+}
+
+}  // namespace ota_delta_detail
+
+// Feed the next `len` patch bytes. Source needs
+//   bool read(uint32_t offset, uint8_t* out, size_t len)   (old image)
+// and Sink needs
+//   bool write(const uint8_t* data, size_t len)            (new image, in order).
+// Once Done or failed, further calls return the same status.
+template <class Source, class Sink>
+OtaDeltaStatus otaDeltaFeed(OtaDeltaDecoder& d, const uint8_t* data, size_t len,
+                            Source& src, Sink& sink) {
+  using Phase = OtaDeltaDecoder::Phase;
+  using namespace ota_delta_detail;
+  size_t i = 0;
+  while (i < len) {
+    switch (d.phase) {
+      case Phase::Failed:
+        return d.failure;
+      case Phase::Done:
+        return fail(d, OtaDeltaStatus::BadFormat);  // bytes after END
+      case Phase::Header: {
+        const size_t want = OTA_DELTA_HEADER_BYTES - d.headerHave;
+        const size_t n = (len - i) < want ? (len - i) : want;
+        memcpy(d.headerBuf + d.headerHave, data + i, n);
+        d.headerHave = (uint16_t)(d.headerHave + n);
+        i += n;
+        if (d.headerHave == OTA_DELTA_HEADER_BYTES) {
+          const OtaDeltaStatus s = parseHeader(d);
+          if (s != OtaDeltaStatus::NeedMore) return s;
+        }
+        break;
+      }
+      case Phase::Opcode:
+        d.op = data[i++];
+        d.argHave = 0;
+        if (d.op == OTA_DELTA_OP_END) {
+          if (d.written != d.header.targetSize) return fail(d, OtaDeltaStatus::TargetOverflow);
+          d.phase = Phase::Done;
+        } else if (d.op == OTA_DELTA_OP_COPY) {
+          d.argNeed = 8;
+          d.phase = Phase::Args;
+        } else if (d.op == OTA_DELTA_OP_INSERT) {
+          d.argNeed = 4;
+          d.phase = Phase::Args;
+        } else {
+          return fail(d, OtaDeltaStatus::BadFormat);
+        }
+        break;
+      case Phase::Args:
+        d.args[d.argHave++] = data[i++];
+        if (d.argHave < d.argNeed) break;
+        if (d.op == OTA_DELTA_OP_COPY) {
+          const OtaDeltaStatus s =
+              runCopy(d, otaDeltaLe32(d.args), otaDeltaLe32(d.args + 4), src, sink);
+          if (s != OtaDeltaStatus::NeedMore) return s;
+          d.phase = Phase::Opcode;
+        } else {
+          d.literalLeft = otaDeltaLe32(d.args);
+          if ((uint64_t)d.written + d.literalLeft > d.header.targetSize) {
+            return fail(d, OtaDeltaStatus::TargetOverflow);
+          }
+          d.phase = d.literalLeft ? Phase::Literal : Phase::Opcode;
+        }
+        break;
+      case Phase::Literal: {
+        const size_t n = (len - i) < d.literalLeft ? (len - i) : d.literalLeft;
+        if (!sink.write(data + i, n)) return fail(d, OtaDeltaStatus::WriteError);
+        i += n;
+        d.literalLeft -= (uint32_t)n;
+        d.written += (uint32_t)n;
+        if (d.literalLeft == 0) d.phase = Phase::Opcode;
+        break;
+      }
+    }
+  }
+  if (d.phase == Phase::Failed) return d.failure;
+  return d.phase == Phase::Done ? OtaDeltaStatus::Done : OtaDeltaStatus::NeedMore;
+}
+
+inline const char* otaDeltaStatusStr(OtaDeltaStatus s) {
+  switch (s) {
+    case OtaDeltaStatus::NeedMore:       return "NEED_MORE";
+    case OtaDeltaStatus::Done:           return "DONE";
+    case OtaDeltaStatus::BadFormat:      return "BAD_FORMAT";
+    case OtaDeltaStatus::SourceMismatch: return "SOURCE_MISMATCH";
+    case OtaDeltaStatus::SourceRange:    return "SOURCE_RANGE";
+    case OtaDeltaStatus::TargetOverflow: return "TARGET_OVERFLOW";
+    case OtaDeltaStatus::ReadError:      return "READ_ERROR";
+    case OtaDeltaStatus::WriteError:     return "WRITE_ERROR";
+  }
+  return "?";
+}
@@ -0,0 +1,266 @@
+#include "carry_forward.h"
+#include "config/node_registry.h"
+
+#include <LittleFS.h>
+#include <math.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+// On-flash record
+// ---------------------------------------------------------------------------
+// One file for the fleet. Per-node NVS blobs took ~11 entries each, more than
+// the 0x5000 partition has to spare at 64 nodes.
+
+static const char* kCfFile = "/cf.bin";
+static const char* kCfTmp  = "/cf.tmp";
+
+static constexpr uint32_t kCfMagic   = 0x52464346UL;  // "FCFR"
+static constexpr uint16_t kCfVersion = 1;
+static constexpr size_t   kCfNodes   = NODE_REGISTRY_CAPACITY;
+static constexpr size_t   kCfIdLen   = 16;            // wire nodeId width
+
+struct __attribute__((packed)) CfChannel {
+  uint16_t sensorId;
+  float    value;
+};
+
+struct CfNodeRecord {
+  char      nodeId[kCfIdLen];  // "" = free
+  uint8_t   count;
+  uint8_t   reserved;
+  CfChannel ch[MAX_READINGS_PER_SNAPSHOT];
+};
+
+struct CfFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t records;    // CfNodeRecord entries that follow
+  uint32_t checksum;   // FNV-1a over the records
+};
+
+// Static, not on the loop stack: ~20 KB at the default registry capacity.
+static CfNodeRecord gRecords[kCfNodes];
+static bool gLoaded = false;
+static bool gDirty = false;
+
+static uint32_t fnv1a32(const uint8_t* data, size_t len) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= data[i];
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+// Read /cf.bin once per boot, after loadPairedNodes(), and drop records for
+// nodes that left the registry. A missing or corrupt file starts empty: each
+// node's next delta then asks for a full snapshot.
+static void load() {
+  if (gLoaded) return;
+  gLoaded = true;
+  memset(gRecords, 0, sizeof(gRecords));
+
+  File f = LittleFS.open(kCfFile, "r");
+  if (f) {
+    CfFileHeader hdr{};
+    bool loaded = false;
+    const bool headerOk =
+        f.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) == sizeof(hdr) &&
+        hdr.magic == kCfMagic && hdr.version == kCfVersion && hdr.records <= kCfNodes;
+    if (headerOk) {
+      const size_t bytes = (size_t)hdr.records * sizeof(CfNodeRecord);
+      loaded = f.read(reinterpret_cast<uint8_t*>(gRecords), bytes) == bytes &&
+               fnv1a32(reinterpret_cast<const uint8_t*>(gRecords), bytes) == hdr.checksum;
+    }
+    f.close();
+    if (!loaded) {
+      Serial.println("[CF] /cf.bin unreadable — starting empty");
+      memset(gRecords, 0, sizeof(gRecords));
+    }
+  }
+
+  for (auto& r : gRecords) {
+    if (!r.nodeId[0]) continue;
+    r.nodeId[kCfIdLen - 1] = '\0';
+    if (r.count > MAX_READINGS_PER_SNAPSHOT || !registeredNodes.findById(r.nodeId)) {
+      memset(&r, 0, sizeof(r));
+      gDirty = true;
+    }
+  }
+}
+
+static CfNodeRecord* findRecord(const char* nodeId) {
+  if (!nodeId || !nodeId[0]) return nullptr;
+  for (auto& r : gRecords) {
+    if (r.nodeId[0] && strncmp(r.nodeId, nodeId, kCfIdLen) == 0) return &r;
+  }
+  return nullptr;
+}
+
+// A free slot, or one whose node has left the registry since boot.
+static CfNodeRecord* allocRecord(const char* nodeId) {
+  for (auto& r : gRecords) {
+    if (!r.nodeId[0] || !registeredNodes.findById(r.nodeId)) {
+      memset(&r, 0, sizeof(r));
+      strncpy(r.nodeId, nodeId, kCfIdLen - 1);
+      return &r;
+    }
+  }
+  return nullptr;
+}
+
+static void toSet(const CfNodeRecord& r, CarryForwardSet& ref) {
+  ref = CarryForwardSet{};
+  ref.count = r.count;
+  for (uint8_t i = 0; i < r.count; ++i) {
+    ref.ch[i].sensorId = r.ch[i].sensorId;
+    ref.ch[i].value = r.ch[i].value;
+  }
+}
+
+static void fromSet(const CarryForwardSet& ref, CfNodeRecord& r) {
+  r.count = ref.count;
+  for (uint8_t i = 0; i < ref.count; ++i) {
+    r.ch[i].sensorId = ref.ch[i].sensorId;
+    r.ch[i].value = ref.ch[i].value;
+  }
+}
+
+static DecodedReading* findReading(CarryForwardSet& ref, uint16_t sensorId) {
+  for (uint8_t i = 0; i < ref.count; ++i) {
+    if (ref.ch[i].sensorId == sensorId) return &ref.ch[i];
+  }
+  return nullptr;
+}
+
+static bool sameReference(const CarryForwardSet& a, const CarryForwardSet& b) {
+  if (a.count != b.count) return false;
+  for (uint8_t i = 0; i < a.count; ++i) {
+    if (a.ch[i].sensorId != b.ch[i].sensorId || a.ch[i].value != b.ch[i].value) return false;
+  }
+  return true;
+}
+
+static uint16_t presentBitFor(uint16_t sensorId) {
+  // snapPresentBitForSensorId() covers the configurable capabilities only;
+  // battery voltage has its own bit in the snapshot layout (see decodeV2).
+  return sensorId == SENSOR_ID_BAT_V ? (uint16_t)SNAP_PRESENT_BAT_V
+                                     : snapPresentBitForSensorId(sensorId);
+}
+
+bool carryForwardMerge(DecodedSnapshot& snap, CarryForwardSet& ref, bool haveRef) {
+  if (snap.qualityFlags & SNAP_QF_AGGREGATED) {
+    // Window means and min/max/SD ids are not values the node's deadbands
+    // track; the node restarts report-by-exception with a full snapshot.
+    ref = CarryForwardSet{};
+    return true;
+  }
+  if (!(snap.qualityFlags & SNAP_QF_CARRIED_FORWARD)) {
+    ref = CarryForwardSet{};
+    for (size_t i = 0; i < snap.readingCount && ref.count < MAX_READINGS_PER_SNAPSHOT; ++i) {
+      if (isnan(snap.readings[i].value)) continue;
+      ref.ch[ref.count++] = snap.readings[i];
+    }
+    return true;
+  }
+  if (!haveRef) return false;
+
+  // Apply the delta: sent values move the reference, NaN markers retire it.
+  size_t kept = 0;
+  for (size_t i = 0; i < snap.readingCount; ++i) {
+    const DecodedReading r = snap.readings[i];
+    DecodedReading* c = findReading(ref, r.sensorId);
+    if (isnan(r.value)) {
+      if (c) *c = ref.ch[--ref.count];
+      continue;
+    }
+    if (c) {
+      c->value = r.value;
+    } else if (ref.count < MAX_READINGS_PER_SNAPSHOT) {
+      ref.ch[ref.count++] = r;
+    }
+    snap.readings[kept++] = r;
+  }
+  snap.readingCount = kept;
+
+  // Fill every channel the node held back.
+  for (uint8_t i = 0; i < ref.count && snap.readingCount < MAX_READINGS_PER_SNAPSHOT; ++i) {
+    if (snap.hasSensor(ref.ch[i].sensorId)) continue;
+    snap.readings[snap.readingCount++] = ref.ch[i];
+  }
+
+  snap.sensorPresent = 0;
+  for (size_t i = 0; i < snap.readingCount; ++i) {
+    snap.sensorPresent |= presentBitFor(snap.readings[i].sensorId);
+  }
+  return true;
+}
+
+bool carryForwardApply(DecodedSnapshot& snap) {
+  load();
+  CfNodeRecord* r = findRecord(snap.nodeId);
+  CarryForwardSet ref{};
+  const bool haveRef = r != nullptr;
+  if (haveRef) toSet(*r, ref);
+  const CarryForwardSet before = ref;
+
+  const bool complete = carryForwardMerge(snap, ref, haveRef);
+  if (!complete) {
+    Serial.printf("[CF] %.15s seq=%lu partial snapshot, no reference — logged as sent, "
+                  "asking the node for a full one\n",
+                  snap.nodeId, (unsigned long)snap.seqNum);
+    return false;
+  }
+  // A node whose channels sit inside their deadbands resends the same full
+  // snapshot at each heartbeat; skip the flash write when nothing moved.
+  if (haveRef && sameReference(before, ref)) return true;
+
+  if (!r) r = allocRecord(snap.nodeId);
+  if (!r) {
+    Serial.printf("[CF] %.15s no free reference slot\n", snap.nodeId);
+    return true;
+  }
+  fromSet(ref, *r);
+  gDirty = true;
+  return true;
+}
+
+bool carryForwardCommit() {
+  if (!gDirty) return true;
+
+  // Trailing free slots are not written.
+  size_t records = kCfNodes;
+  while (records > 0 && !gRecords[records - 1].nodeId[0]) --records;
+
+  CfFileHeader hdr{};
+  hdr.magic = kCfMagic;
+  hdr.version = kCfVersion;
+  hdr.records = (uint16_t)records;
+  const size_t bytes = records * sizeof(CfNodeRecord);
+  hdr.checksum = fnv1a32(reinterpret_cast<const uint8_t*>(gRecords), bytes);
+
+  File f = LittleFS.open(kCfTmp, "w", true);
+  if (!f) {
+    Serial.println("[CF] commit: cannot open temp file");
+    return false;
+  }
+  size_t written = f.write(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr));
+  written += f.write(reinterpret_cast<const uint8_t*>(gRecords), bytes);
+  const bool writeError = f.getWriteError();
+  f.close();
+  if (writeError || written != sizeof(hdr) + bytes) {
+    Serial.println("[CF] commit: short write");
+    LittleFS.remove(kCfTmp);
+    return false;
+  }
+  // A lost file only costs each node one partial delta and a full resend
+  // (SNAPSHOT_ACK_SEND_FULL), so a plain replace is enough.
+  LittleFS.remove(kCfFile);
+  if (!LittleFS.rename(kCfTmp, kCfFile)) {
+    Serial.println("[CF] commit: rename failed");
+    LittleFS.remove(kCfTmp);
+    return false;
+  }
+  gDirty = false;
+  return true;
+}
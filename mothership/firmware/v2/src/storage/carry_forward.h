@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include "flash_logger.h"  // DecodedSnapshot
+
+// Carry-forward for report-by-exception snapshots.
+//
+// A node in report-by-exception mode (FIELDMESH_NODE_CONFIG_PROTOCOL.md) sends
+// only the channels that left their deadband and sets SNAP_QF_CARRIED_FORWARD.
+// Every other channel is "unchanged since the last value sent". The FieldHub
+// keeps that last value per node and fills the missing channels back in before
+// the snapshot is logged, so the CSV, the upload payload and fault detection
+// all still see a complete snapshot. The flag stays set on the row, so the
+// backend can tell carried-forward values from fresh ones.
+//
+// A full snapshot (flag clear) replaces the reference set. In a flagged one a
+// NaN reading means "this channel stopped reading": it is dropped from the
+// snapshot and from the reference set. An aggregation summary clears it: the
+// node runs no report-by-exception while it aggregates.
+//
+// The reference sets live in RAM and in one LittleFS file (/cf.bin), written
+// by carryForwardCommit() once per wake (config mode: after each snapshot).
+// A set that never reached flash (power lost first, or a failed write) leaves
+// the node's next delta partial; the hub then logs what arrived and sets
+// SNAPSHOT_ACK_SEND_FULL so the node's following snapshot re-baselines it.
+
+struct CarryForwardSet {
+  uint8_t        count;
+  uint8_t        reserved[3];
+  DecodedReading ch[MAX_READINGS_PER_SNAPSHOT];
+};
+
+// Pure merge, no storage. Updates `ref` from `snap` and, for a flagged snapshot,
+// completes `snap` from `ref` and recomputes sensorPresent. `haveRef` false
+// means no reference is known for the node: a flagged snapshot is then left
+// partial and this returns false.
+bool carryForwardMerge(DecodedSnapshot& snap, CarryForwardSet& ref, bool haveRef);
+
+// Merge against the node's reference set (loading /cf.bin on first use) and
+// keep the updated set in RAM. Returns false only for a flagged snapshot with
+// no reference known (the set never reached flash, or the node's last full
+// snapshot never arrived): the caller should ask the node for a full one.
+bool carryForwardApply(DecodedSnapshot& snap);
+
+// Write /cf.bin if any reference set changed since the last commit.
+bool carryForwardCommit();
@@ -19,6 +19,15 @@
 //           local CSV downloads and upload payloads.
 // 33 -> 35: latitude and longitude — the node's configured deployment
 //           location (decimal degrees, 6dp). Blank/"nan" when unset.
+// 35 -> 38: windGust, windSpeedSd, windCalmFraction — the reed anemometer's
+//           per-wake peak 3 s gust, 1 s speed SD and calm fraction
+//           (SENSOR_ID_WIND_GUST..WIND_CALM_FRAC). "nan" when not reported.
+// 38 -> 40: aggSamples, aggStats — on-node aggregation summaries. aggSamples
+//           is the number of wakes folded into the row (0 for an ordinary
+//           snapshot); aggStats carries the per-channel window min/max/SD as
+//           one comma-free cell, "<baseId>:<min>/<max>/<sd>;..." ("nan" when
+//           the row is not a summary). The headline columns hold the window
+//           mean (gust: peak, windDir: vector mean) either way.
 //
 // kLegacyCSVHeader31 is the header actually shipped in the field (commit
 // ea98b05): deploymentEpoch appended, no identity or location columns. A hub
@@ -62,7 +71,7 @@ static constexpr const char* kLegacyCSVHeader33 =
     "spectral_clear,spectral_nir,spectral_gain,spectral_integration_ms,"
     "spectral_saturated,deploymentEpoch,userId,name";
 
-static constexpr const char* kCurrentCSVHeader35 =
+static constexpr const char* kLegacyCSVHeader35 =
     "datetime,nodeId,seqNum,sensorPresent,qualityFlags,configVersion,"
     "batVoltage,airTemp,airHumidity,"
     "spectral_415,spectral_445,spectral_480,spectral_515,"
@@ -71,8 +80,30 @@ static constexpr const char* kCurrentCSVHeader35 =
     "spectral_clear,spectral_nir,spectral_gain,spectral_integration_ms,"
     "spectral_saturated,deploymentEpoch,userId,name,latitude,longitude";
 
+static constexpr const char* kLegacyCSVHeader38 =
+    "datetime,nodeId,seqNum,sensorPresent,qualityFlags,configVersion,"
+    "batVoltage,airTemp,airHumidity,"
+    "spectral_415,spectral_445,spectral_480,spectral_515,"
+    "spectral_555,spectral_590,spectral_630,spectral_680,"
+    "windSpeed,windDir,soil1Vwc,soil1Temp,soil2Vwc,soil2Temp,aux1,aux2,"
+    "spectral_clear,spectral_nir,spectral_gain,spectral_integration_ms,"
+    "spectral_saturated,deploymentEpoch,userId,name,latitude,longitude,"
+    "windGust,windSpeedSd,windCalmFraction";
+
+static constexpr const char* kCurrentCSVHeader40 =
+    "datetime,nodeId,seqNum,sensorPresent,qualityFlags,configVersion,"
+    "batVoltage,airTemp,airHumidity,"
+    "spectral_415,spectral_445,spectral_480,spectral_515,"
+    "spectral_555,spectral_590,spectral_630,spectral_680,"
+    "windSpeed,windDir,soil1Vwc,soil1Temp,soil2Vwc,soil2Temp,aux1,aux2,"
+    "spectral_clear,spectral_nir,spectral_gain,spectral_integration_ms,"
+    "spectral_saturated,deploymentEpoch,userId,name,latitude,longitude,"
+    "windGust,windSpeedSd,windCalmFraction,aggSamples,aggStats";
+
 static constexpr size_t kLegacyCSVColumnCount   = 25;
 static constexpr size_t kLegacyCSVColumnCount30 = 30;
 static constexpr size_t kLegacyCSVColumnCount31 = 31;
 static constexpr size_t kLegacyCSVColumnCount33 = 33;
-static constexpr size_t kCurrentCSVColumnCount  = 35;
+static constexpr size_t kLegacyCSVColumnCount35 = 35;
+static constexpr size_t kLegacyCSVColumnCount38 = 38;
+static constexpr size_t kCurrentCSVColumnCount  = 40;
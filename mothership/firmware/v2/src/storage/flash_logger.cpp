@@ -13,8 +13,10 @@ static const char* kFlashFile = "/datalog.csv";
 // sensors populated, a 32-character node name and full-width coordinates
 // measures ~443 bytes, so 512 left barely any headroom: a node reporting
 // legitimately wide values would overflow and have its row REJECTED, which is
-// silent data loss. 640 removes that cliff for ~128 bytes of stack.
-static constexpr size_t kCsvRowBufBytes = 640;
+// silent data loss. 640 removed that cliff for ~128 bytes of stack. The
+// 38 -> 40 bump adds aggStats, up to ~30 bytes per aggregated channel; a full
+// summary of every linear channel lands near 700, so the buffer is now 1 KiB.
+static constexpr size_t kCsvRowBufBytes = 1024;
 
 // Bounded append shared by every row builder below.
 //
@@ -141,6 +143,7 @@ bool decodeV2(const uint8_t* data, int len, DecodedSnapshot& out) {
   out.qualityFlags     = hdr->qualityFlags;
   out.configVersion    = hdr->configVersion;
   out.protocolVersion  = hdr->protocolVersion;
+  out.snapFlags        = hdr->flags;
   out.sensorPresent    = 0;  // synthesised below
   out.readingCount     = 0;
 
@@ -171,7 +174,10 @@ bool decodeV2(const uint8_t* data, int len, DecodedSnapshot& out) {
       case SENSOR_ID_SPECTRAL_ATIME:
       case SENSOR_ID_SPECTRAL_SAT:    out.sensorPresent |= SNAP_PRESENT_SPECTRAL; break;
       case SENSOR_ID_WIND_SPEED:
-      case SENSOR_ID_WIND_DIR:       out.sensorPresent |= SNAP_PRESENT_WIND; break;
+      case SENSOR_ID_WIND_DIR:
+      case SENSOR_ID_WIND_GUST:
+      case SENSOR_ID_WIND_SPEED_SD:
+      case SENSOR_ID_WIND_CALM_FRAC: out.sensorPresent |= SNAP_PRESENT_WIND; break;
       case SENSOR_ID_SOIL1_VWC:
       case SENSOR_ID_SOIL1_TEMP:     out.sensorPresent |= SNAP_PRESENT_SOIL1; break;
       case SENSOR_ID_SOIL2_VWC:
@@ -243,6 +249,38 @@ static int appendSensor(char* buf, size_t bufSize, int offset,
   return appendFloat(buf, bufSize, offset, *p);
 }
 
+// aggStats cell: the window min/max/SD of every aggregated channel, as
+// "<baseId>:<min>/<max>/<sd>" joined by ';' so the cell stays comma-free.
+// A stat the node could not fit into its summary is written as nan. "nan" for
+// the whole cell when the row carries no aggregate readings.
+static int appendAggStats(char* buf, size_t bufSize, int offset,
+                          const DecodedSnapshot& d) {
+  const int start = offset;
+  uint16_t seen[MAX_READINGS_PER_SNAPSHOT];
+  size_t seenCount = 0;
+  for (size_t i = 0; i < d.readingCount; ++i) {
+    if (aggregateStatOf(d.readings[i].sensorId) == 0) continue;
+    const uint16_t base = aggregateBaseSensorId(d.readings[i].sensorId);
+    bool dup = false;
+    for (size_t j = 0; j < seenCount; ++j) dup |= (seen[j] == base);
+    if (dup) continue;
+    seen[seenCount++] = base;
+
+    offset += appendFmt(buf, bufSize, offset, "%s%u:", seenCount > 1 ? ";" : "",
+                        (unsigned)base);
+    offset += appendSensor(buf, bufSize, offset, d,
+                           aggregateSensorId(base, SENSOR_AGG_STAT_MIN));
+    offset += appendFmt(buf, bufSize, offset, "/");
+    offset += appendSensor(buf, bufSize, offset, d,
+                           aggregateSensorId(base, SENSOR_AGG_STAT_MAX));
+    offset += appendFmt(buf, bufSize, offset, "/");
+    offset += appendSensor(buf, bufSize, offset, d,
+                           aggregateSensorId(base, SENSOR_AGG_STAT_SD));
+  }
+  if (seenCount == 0) offset += appendFmt(buf, bufSize, offset, "%s", "nan");
+  return offset - start;
+}
+
 static void traceDecodedSpectralMetadata(const DecodedSnapshot& decoded) {
   const uint16_t ids[] = {
     SENSOR_ID_SPECTRAL_CLEAR, SENSOR_ID_SPECTRAL_NIR,
@@ -334,9 +372,19 @@ bool formatDecodedSnapshotCSVRow(const DecodedSnapshot& decoded, String& outRow)
   n += appendFmt(row, sizeof(row), n, ",%s", nodeName.c_str());
   // Node location appended as CSV columns 34 and 35 (nan when unset).
   n += appendFmt(row, sizeof(row), n, ",");
-  n += appendCoord(row, sizeof(row), n, getNodeLatitude(String(decoded.nodeId)));
+  n += appendCoord(row, sizeof(row), n, getNodeLatitude(decoded.nodeId));
+  n += appendFmt(row, sizeof(row), n, ",");
+  n += appendCoord(row, sizeof(row), n, getNodeLongitude(decoded.nodeId));
+  // Reed anemometer statistics appended as CSV columns 36-38.
   n += appendFmt(row, sizeof(row), n, ",");
-  n += appendCoord(row, sizeof(row), n, getNodeLongitude(String(decoded.nodeId)));
+  n += appendSensor(row, sizeof(row), n, decoded, SENSOR_ID_WIND_GUST);      n += appendFmt(row, sizeof(row), n, ",");
+  n += appendSensor(row, sizeof(row), n, decoded, SENSOR_ID_WIND_SPEED_SD);  n += appendFmt(row, sizeof(row), n, ",");
+  n += appendSensor(row, sizeof(row), n, decoded, SENSOR_ID_WIND_CALM_FRAC);
+  // On-node aggregation summary appended as CSV columns 39-40.
+  const float* aggSamples = decoded.find(SENSOR_ID_AGG_SAMPLES);
+  n += appendFmt(row, sizeof(row), n, ",%u,",
+                 (aggSamples && *aggSamples >= 1.0f) ? (unsigned)*aggSamples : 0u);
+  n += appendAggStats(row, sizeof(row), n, decoded);
 
   if (n <= 0 || n >= static_cast<int>(sizeof(row))) return false;
   outRow = String(row);
@@ -367,8 +415,9 @@ bool logDecodedSnapshot(const DecodedSnapshot& decoded) {
 //          batVoltage, airTemp, airHumidity, spectral[8], windSpeed, windDir,
 //          soil1Vwc, soil1Temp, soil2Vwc, soil2Temp, aux1, aux2,
 //          spectral_clear, spectral_nir, spectral_gain, spectral_integration_ms,
-//          spectral_saturated, deploymentEpoch, userId, name, latitude, longitude
-static const char* kCSVHeader = kCurrentCSVHeader35;
+//          spectral_saturated, deploymentEpoch, userId, name, latitude, longitude,
+//          windGust, windSpeedSd, windCalmFraction, aggSamples, aggStats
+static const char* kCSVHeader = kCurrentCSVHeader40;
 
 static bool gFlashReady = false;
 static bool gFlashMountFailed = false;
@@ -434,8 +483,12 @@ bool initFlash() {
     const bool isLegacy30 = (firstLine == String(kLegacyCSVHeader30));
     const bool isLegacy31 = (firstLine == String(kLegacyCSVHeader31));
     const bool isLegacy33 = (firstLine == String(kLegacyCSVHeader33));
-    if (isLegacy25 || isLegacy30 || isLegacy31 || isLegacy33) {
-      const int legacyCols = isLegacy25 ? 25 : (isLegacy30 ? 30 : (isLegacy31 ? 31 : 33));
+    const bool isLegacy35 = (firstLine == String(kLegacyCSVHeader35));
+    const bool isLegacy38 = (firstLine == String(kLegacyCSVHeader38));
+    if (isLegacy25 || isLegacy30 || isLegacy31 || isLegacy33 || isLegacy35 ||
+        isLegacy38) {
+      const int legacyCols = isLegacy25 ? 25 : (isLegacy30 ? 30 : (isLegacy31 ? 31 :
+                             (isLegacy33 ? 33 : (isLegacy35 ? 35 : 38))));
       if (hasDataRows) {
         Serial.printf("[FLASH] Legacy %d-column CSV has queued rows; preserving until upload drain\n",
                       legacyCols);
@@ -534,9 +587,11 @@ bool logSnapshotRow(const node_snapshot_t* snap) {
   const String nodeName = csvSafeCell(getNodeName(String(snap->nodeId)));
   n += appendFmt(row, sizeof(row), n, ",nan,nan,nan,nan,nan,0,%s,%s,",
                 userId.c_str(), nodeName.c_str());
-  n += appendCoord(row, sizeof(row), n, getNodeLatitude(String(snap->nodeId)));
+  n += appendCoord(row, sizeof(row), n, getNodeLatitude(snap->nodeId));
   n += appendFmt(row, sizeof(row), n, ",");
-  n += appendCoord(row, sizeof(row), n, getNodeLongitude(String(snap->nodeId)));
+  n += appendCoord(row, sizeof(row), n, getNodeLongitude(snap->nodeId));
+  // V1 carries no wind statistics and is never an aggregation summary.
+  n += appendFmt(row, sizeof(row), n, ",nan,nan,nan,0,nan");
 
   // Same overflow gate as formatDecodedSnapshotCSVRow: a truncated row is short
   // a trailing column and must not reach the queue as a mis-framed line.
@@ -603,9 +658,10 @@ bool logSnapshotBatch(const node_snapshot_t* snapshots, int count) {
     const String nodeName = csvSafeCell(getNodeName(String(snap->nodeId)));
     n += appendFmt(row, sizeof(row), n, ",nan,nan,nan,nan,nan,0,%s,%s,",
                   userId.c_str(), nodeName.c_str());
-    n += appendCoord(row, sizeof(row), n, getNodeLatitude(String(snap->nodeId)));
+    n += appendCoord(row, sizeof(row), n, getNodeLatitude(snap->nodeId));
     n += appendFmt(row, sizeof(row), n, ",");
-    n += appendCoord(row, sizeof(row), n, getNodeLongitude(String(snap->nodeId)));
+    n += appendCoord(row, sizeof(row), n, getNodeLongitude(snap->nodeId));
+    n += appendFmt(row, sizeof(row), n, ",nan,nan,nan,0,nan");
 
     // Same overflow gate as formatDecodedSnapshotCSVRow: a row that did not fit
     // is short a trailing column, so writing it would append a mis-framed line
@@ -29,6 +29,7 @@ struct DecodedSnapshot {
     uint16_t qualityFlags;
     uint16_t configVersion;
     uint8_t  protocolVersion;
+    uint8_t  snapFlags;         // V2 header SNAP2_FLAG_* (0 for V1)
     // V1-only: bitmask of channels that were present in the original packet.
     // For V2 snapshots this is synthesised from the readings so existing
     // CSV columns (sensorPresent) stay populated.
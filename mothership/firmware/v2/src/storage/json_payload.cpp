@@ -19,7 +19,8 @@
 //   25 spectral_clear 26 spectral_nir 27 spectral_gain
 //   28 spectral_integration_ms 29 spectral_saturated
 //   30 deploymentEpoch 31 userId 32 name 33 latitude 34 longitude
-static constexpr int kNumCsvColumns = 35;
+//   35 windGust 36 windSpeedSd 37 windCalmFraction 38 aggSamples 39 aggStats
+static constexpr int kNumCsvColumns = 40;
 static constexpr uint16_t kMaxReadingsPerPost = 100;  // backend hard limit
 
 enum CellType {
@@ -29,6 +30,8 @@ enum CellType {
   CELL_INT,          // integer literal straight from the CSV cell
   CELL_INT_BASE0,    // parse decimal or 0x hex, emit as decimal integer
   CELL_NUM_NULLABLE, // numeric literal, or JSON null when the cell is nan/empty
+  CELL_AGG_STATS,    // "<id>:<min>/<max>/<sd>;..." -> {"<id>":{"min":..,..}},
+                     // or JSON null when the cell is nan/empty
 };
 
 struct ColumnMapping {
@@ -78,6 +81,13 @@ static const ColumnMapping kColumnMappings[kNumCsvColumns] = {
   // 33-field row stops before these mappings, so the keys are simply absent.
   {33, "latitude",                CELL_NUM_NULLABLE},
   {34, "longitude",               CELL_NUM_NULLABLE},
+  // Appended by the 35 -> 38 schema bump (reed anemometer statistics).
+  {35, "windGust",                CELL_NUM_NULLABLE},
+  {36, "windSpeedSd",             CELL_NUM_NULLABLE},
+  {37, "windCalmFraction",        CELL_NUM_NULLABLE},
+  // Appended by the 38 -> 40 schema bump (on-node aggregation summaries).
+  {38, "aggSamples",              CELL_INT},
+  {39, "aggStats",                CELL_AGG_STATS},
 };
 
 // ---------------------------------------------------------------------------
@@ -148,14 +158,44 @@ static bool isFiniteNumberCell(const String& v) {
   return end != v.c_str() && end && *end == '\0' && isfinite(parsed);
 }
 
+// aggStats cell: nan/empty, or ';'-joined "<id>:<min>/<max>/<sd>" groups with
+// a decimal id and three numeric-or-nan stats. Walked in place; the JSON
+// emitter below relies on this having passed.
+static bool isAggStatsCell(const String& v) {
+  if (isNanCell(v)) return true;
+  const int len = v.length();
+  if (v[len - 1] == ';') return false;
+  int pos = 0;
+  while (pos < len) {
+    const int colon = v.indexOf(':', pos);
+    if (colon <= pos || !isDecimalIntegerCell(v.substring(pos, colon))) return false;
+    int end = v.indexOf(';', colon + 1);
+    if (end < 0) end = len;
+    int start = colon + 1;
+    for (int k = 0; k < 3; ++k) {
+      int slash = (k < 2) ? v.indexOf('/', start) : end;
+      if (slash < 0 || slash > end) return false;
+      const String stat = v.substring(start, slash);
+      if (stat.length() == 0 || !isFiniteNumberCell(stat)) return false;
+      start = slash + 1;
+    }
+    pos = end + 1;
+  }
+  return true;
+}
+
 // Column layout (see kColumnMappings above): 0-5 are non-numeric/int header
 // fields checked explicitly below; 6-29 are sensor floats; 30 is the
 // deploymentEpoch integer; 31-32 (userId, name) are free-form identity text
-// — NOT numeric, must not be run through isFiniteNumberCell; 33-34
-// (latitude, longitude) are numeric-or-nan again.
+// — NOT numeric, must not be run through isFiniteNumberCell; 33-37
+// (latitude, longitude, wind statistics) are numeric-or-nan again; 38 is the
+// aggSamples integer and 39 the structured aggStats cell.
 static constexpr int kSensorFieldsEnd     = 30;  // exclusive: fields[6..29]
 static constexpr int kDeploymentEpochIdx  = 30;
 static constexpr int kLocationFieldsStart = 33;  // fields[31..32] (userId, name) unchecked
+static constexpr int kLocationFieldsEnd   = 38;  // exclusive: fields[33..37]
+static constexpr int kAggSamplesIdx       = 38;
+static constexpr int kAggStatsIdx         = 39;
 
 static bool validReadingRow(const String* fields, int count,
                             bool fallbackTimestampAvailable) {
@@ -178,12 +218,58 @@ static bool validReadingRow(const String* fields, int count,
     return false;
   }
   // fields[31..32] (userId, name) are free text — no numeric constraint.
-  for (int i = kLocationFieldsStart; i < count; ++i) {
+  const int numericEnd = count < kLocationFieldsEnd ? count : kLocationFieldsEnd;
+  for (int i = kLocationFieldsStart; i < numericEnd; ++i) {
     if (!isFiniteNumberCell(fields[i])) return false;
   }
+  if (count > kAggSamplesIdx && !isDecimalIntegerCell(fields[kAggSamplesIdx])) {
+    return false;
+  }
+  if (count > kAggStatsIdx && !isAggStatsCell(fields[kAggStatsIdx])) {
+    return false;
+  }
   return true;
 }
 
+static void appendJsonStat(String& json, const char* key, const String& v) {
+  json += "\"";
+  json += key;
+  json += "\":";
+  if (isNanCell(v)) json += "null";
+  else json += v;
+}
+
+// {"1001":{"min":10.000,"max":15.000,"sd":1.871},...}. The cell has already
+// been through isAggStatsCell(), so the split can trust its shape.
+static void appendAggStatsObject(String& json, const String& v) {
+  if (isNanCell(v)) {
+    json += "null";
+    return;
+  }
+  json += "{";
+  int pos = 0;
+  const int len = v.length();
+  while (pos < len) {
+    int end = v.indexOf(';', pos);
+    if (end < 0) end = len;
+    const int colon = v.indexOf(':', pos);
+    const int s1 = v.indexOf('/', colon + 1);
+    const int s2 = v.indexOf('/', s1 + 1);
+    if (pos > 0) json += ",";
+    json += "\"";
+    json += v.substring(pos, colon);
+    json += "\":{";
+    appendJsonStat(json, "min", v.substring(colon + 1, s1));
+    json += ",";
+    appendJsonStat(json, "max", v.substring(s1 + 1, s2));
+    json += ",";
+    appendJsonStat(json, "sd", v.substring(s2 + 1, end));
+    json += "}";
+    pos = end + 1;
+  }
+  json += "}";
+}
+
 static String escapeJsonString(const String& v) {
   String out;
   out.reserve(v.length() + 8);
@@ -296,6 +382,9 @@ static bool appendReadingObject(String& json, const String& line, bool& first,
         if (isNanCell(val)) json += "null";
         else json += val;  // CSV already holds a valid numeric literal
         break;
+      case CELL_AGG_STATS:
+        appendAggStatsObject(json, val);
+        break;
     }
   }
 
@@ -354,7 +443,9 @@ JsonPayload buildJsonUpload(const String& csvChunk,
   // coordinates — lands near 835 B, which all but erased that headroom. 950
   // restores it. Under-estimating here is not cosmetic: the reserve below is
   // what stops a fragmented heap from silently truncating the body.
-  const uint32_t kEstBytesPerReading = 950U;
+  // The 38 -> 40 bump's aggStats object costs ~45 B per aggregated channel; a
+  // summary with eight linear channels adds ~370 B, hence 1350.
+  const uint32_t kEstBytesPerReading = 1350U;
   // Size from the ACTUAL chunk, not the maxReadings ceiling.
   //
   // The caller bounds a chunk by CSV bytes, so maxReadings (100) is an upper
@@ -487,6 +578,9 @@ JsonPayload buildJsonUpload(const String& csvChunk,
     else { dtostrf(status->batVoltage, 1, 2, numBuf); body += numBuf; }
     body += ",\"rtcUnix\":"; body += String(status->rtcUnix);
     body += ",\"deviceId\":\""; body += escapeJsonString(status->deviceId); body += "\"";
+    if (status->statusDeltaJson.length()) {
+      body += ",\"statusDelta\":"; body += status->statusDeltaJson;
+    }
     body += ",\"wakeIntervalMinutes\":"; body += String(status->wakeIntervalMinutes);
     body += ",\"syncIntervalMinutes\":"; body += String(status->syncIntervalMinutes);
     body += ",\"syncMode\":\""; body += escapeJsonString(status->syncMode); body += "\"";
@@ -70,6 +70,9 @@ struct StatusContext {
   // status.epochClampCount — readings whose timestamp fell outside every
   // retained deployment boundary and were attributed approximately.
   uint32_t epochClampCount;
+  // status.statusDelta{} — set by statusDeltaPrepare() (storage/status_delta.h)
+  // when sections above may be omitted as unchanged. "" = full legacy status.
+  String   statusDeltaJson;
 };
 
 // ---------------------------------------------------------------------------
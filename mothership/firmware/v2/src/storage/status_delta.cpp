@@ -0,0 +1,313 @@
+#include "storage/status_delta.h"
+
+#include <Preferences.h>
+
+namespace {
+
+constexpr const char* kNamespace    = "stdelta";
+constexpr const char* kKeySeq       = "seq";         // last seq handed out
+constexpr const char* kKeyBase      = "base";        // seq the backend acked, 0 = none
+constexpr const char* kKeySections  = "sections";    // section hashes as acked
+constexpr const char* kKeyNodes     = "nodes";       // node stable hashes as acked
+constexpr const char* kKeySinceFull = "since_full";  // deltas acked since the last full
+
+enum Section : uint8_t { kTransmission, kModem, kFirmware, kSectionCount };
+
+// Above NODE_REGISTRY_CAPACITY; nodes past it are simply always sent whole.
+constexpr size_t kMaxNodeHashes = 128;
+
+// Fields that change on every contact. A node entry differing only in these
+// is sent compact.
+const char* const kContactFields[] = {"lastSeenUnix", "lastReportedBatV"};
+
+struct Baseline {
+  uint32_t seq;                      // 0 = none
+  uint32_t sections[kSectionCount];
+  uint32_t nodes[kMaxNodeHashes];
+  uint16_t nodeCount;
+  uint8_t  sinceFull;
+};
+
+Baseline gBase{};
+bool     gBaseLoaded = false;
+// What the baseline becomes once the backend acks the last prepared status.
+Baseline gPending{};
+bool     gHavePending = false;
+
+uint32_t fnv1a(const char* p, size_t n, uint32_t h = 2166136261u) {
+  for (size_t i = 0; i < n; ++i) h = (h ^ (uint8_t)p[i]) * 16777619u;
+  return h;
+}
+
+void loadBaseline() {
+  if (gBaseLoaded) return;
+  gBaseLoaded = true;
+  gBase = Baseline{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return;
+  gBase.seq = prefs.getUInt(kKeyBase, 0);
+  gBase.sinceFull = prefs.getUChar(kKeySinceFull, 0);
+  const bool sectionsOk =
+      prefs.getBytesLength(kKeySections) == sizeof(gBase.sections) &&
+      prefs.getBytes(kKeySections, gBase.sections, sizeof(gBase.sections)) ==
+          sizeof(gBase.sections);
+  const size_t nodeBytes = prefs.getBytesLength(kKeyNodes);
+  if (nodeBytes % sizeof(uint32_t) == 0 && nodeBytes <= sizeof(gBase.nodes) &&
+      (nodeBytes == 0 || prefs.getBytes(kKeyNodes, gBase.nodes, nodeBytes) == nodeBytes)) {
+    gBase.nodeCount = (uint16_t)(nodeBytes / sizeof(uint32_t));
+  } else {
+    gBase.seq = 0;
+  }
+  prefs.end();
+  if (!sectionsOk) gBase = Baseline{};
+}
+
+void saveBaseline() {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return;
+  prefs.putUInt(kKeyBase, gBase.seq);
+  prefs.putUChar(kKeySinceFull, gBase.sinceFull);
+  prefs.putBytes(kKeySections, gBase.sections, sizeof(gBase.sections));
+  if (gBase.nodeCount > 0) {
+    prefs.putBytes(kKeyNodes, gBase.nodes, gBase.nodeCount * sizeof(uint32_t));
+  } else if (prefs.isKey(kKeyNodes)) {
+    prefs.remove(kKeyNodes);
+  }
+  prefs.end();
+}
+
+uint32_t nextSeq() {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return 0;
+  uint32_t seq = prefs.getUInt(kKeySeq, 0) + 1;
+  if (seq == 0) seq = 1;   // 0 means "no baseline"
+  prefs.putUInt(kKeySeq, seq);
+  prefs.end();
+  return seq;
+}
+
+// Index just past the JSON value starting at s[i]: a string, an object or
+// array (nested), or a scalar (up to the next ',' '}' or ']').
+int valueEnd(const String& s, int i) {
+  const int len = (int)s.length();
+  int depth = 0;
+  bool inString = false;
+  for (; i < len; ++i) {
+    const char c = s[i];
+    if (inString) {
+      if (c == '\\') ++i;
+      else if (c == '"') {
+        inString = false;
+        if (depth == 0) return i + 1;
+      }
+      continue;
+    }
+    if (c == '"') inString = true;
+    else if (c == '{' || c == '[') ++depth;
+    else if (c == '}' || c == ']') {
+      if (depth == 0) return i;
+      if (--depth == 0) return i + 1;
+    } else if (c == ',' && depth == 0) {
+      return i;
+    }
+  }
+  return len;
+}
+
+int skipSpace(const String& s, int i) {
+  while (i < (int)s.length() && (s[i] == ' ' || s[i] == '\n' || s[i] == '\r' || s[i] == '\t')) ++i;
+  return i;
+}
+
+// Locate member `key` of the object s[objStart..]: memberStart is its opening
+// quote, valueStart/valueEndOut bound its value. Top-level members only.
+bool findMember(const String& s, int objStart, const char* key,
+                int& memberStart, int& valueStart, int& valueEndOut) {
+  const int len = (int)s.length();
+  const size_t keyLen = strlen(key);
+  int i = skipSpace(s, objStart);
+  if (i >= len || s[i] != '{') return false;
+  ++i;
+  while (true) {
+    i = skipSpace(s, i);
+    if (i >= len || s[i] != '"') return false;
+    const int nameStart = i;
+    const int nameEnd = valueEnd(s, i);            // past the closing quote
+    i = skipSpace(s, nameEnd);
+    if (i >= len || s[i] != ':') return false;
+    const int vStart = skipSpace(s, i + 1);
+    const int vEnd = valueEnd(s, vStart);
+    if ((size_t)(nameEnd - nameStart - 2) == keyLen &&
+        strncmp(s.c_str() + nameStart + 1, key, keyLen) == 0) {
+      memberStart = nameStart;
+      valueStart = vStart;
+      valueEndOut = vEnd;
+      return true;
+    }
+    i = skipSpace(s, vEnd);
+    if (i >= len || s[i] != ',') return false;
+    ++i;
+  }
+}
+
+bool contains(const uint32_t* set, size_t count, uint32_t h) {
+  for (size_t i = 0; i < count; ++i) {
+    if (set[i] == h) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+uint32_t statusNodeStableHash(const String& entry) {
+  const int open = skipSpace(entry, 0);
+  if (open >= (int)entry.length() || entry[open] != '{') return 0;
+  int skipFrom[2], skipTo[2];
+  int n = 0;
+  for (const char* field : kContactFields) {
+    int member, from, to;
+    if (findMember(entry, 0, field, member, from, to)) {
+      skipFrom[n] = from;
+      skipTo[n] = to;
+      ++n;
+    }
+  }
+  if (n == 2 && skipFrom[1] < skipFrom[0]) {
+    const int f = skipFrom[0], t = skipTo[0];
+    skipFrom[0] = skipFrom[1]; skipTo[0] = skipTo[1];
+    skipFrom[1] = f; skipTo[1] = t;
+  }
+  const char* p = entry.c_str();
+  uint32_t h = 2166136261u;
+  int at = 0;
+  for (int k = 0; k < n; ++k) {
+    h = fnv1a(p + at, (size_t)(skipFrom[k] - at), h);
+    at = skipTo[k];
+  }
+  h = fnv1a(p + at, entry.length() - (size_t)at, h);
+  return h ? h : 1u;
+}
+
+String statusDeltaNodes(const String& nodesJson,
+                        const uint32_t* acked, size_t ackedCount,
+                        uint32_t* hashesOut, size_t maxHashes, size_t& hashCount) {
+  hashCount = 0;
+  String out;
+  out.reserve(nodesJson.length() + 2);
+  out = "[";
+  const int len = (int)nodesJson.length();
+  int i = skipSpace(nodesJson, 0);
+  if (i >= len || nodesJson[i] != '[') return nodesJson;
+  ++i;
+  bool first = true;
+  while (true) {
+    i = skipSpace(nodesJson, i);
+    if (i >= len || nodesJson[i] != '{') break;
+    const int end = valueEnd(nodesJson, i);
+    const String entry = nodesJson.substring(i, end);
+    const uint32_t h = statusNodeStableHash(entry);
+    if (hashCount < maxHashes) hashesOut[hashCount++] = h;
+
+    if (!first) out += ",";
+    first = false;
+    int member, from, to;
+    if (acked && contains(acked, ackedCount, h) &&
+        findMember(entry, 0, "nodeId", member, from, to)) {
+      out += "{";
+      out += entry.substring(member, to);
+      for (const char* field : kContactFields) {
+        if (findMember(entry, 0, field, member, from, to)) {
+          out += ",";
+          out += entry.substring(member, to);
+        }
+      }
+      out += "}";
+    } else {
+      out += entry;
+    }
+    i = skipSpace(nodesJson, end);
+    if (i >= len || nodesJson[i] != ',') break;
+    ++i;
+  }
+  out += "]";
+  return out;
+}
+
+void statusDeltaPrepare(StatusContext& ctx) {
+  loadBaseline();
+  const uint32_t seq = nextSeq();
+  if (seq == 0) {
+    ctx.statusDeltaJson = String();   // NVS unavailable: plain full status
+    gHavePending = false;
+    return;
+  }
+  const bool full = gBase.seq == 0 || gBase.sinceFull + 1 >= kStatusFullEverySessions;
+
+  Baseline next{};
+  next.seq = seq;
+  next.sinceFull = full ? 0 : (uint8_t)(gBase.sinceFull + 1);
+
+  size_t before = ctx.nodesJson.length();
+  String* sections[kSectionCount] = {&ctx.transmissionJson, &ctx.modemJson,
+                                     &ctx.firmwareJson};
+  for (uint8_t k = 0; k < kSectionCount; ++k) {
+    String& s = *sections[k];
+    before += s.length();
+    // Absent keeps the stored value on the backend, full snapshot or not.
+    if (s.length() == 0) {
+      next.sections[k] = gBase.sections[k];
+      continue;
+    }
+    next.sections[k] = fnv1a(s.c_str(), s.length());
+    if (!full && next.sections[k] == gBase.sections[k]) s = String();
+  }
+
+  size_t nodeCount = 0;
+  ctx.nodesJson = statusDeltaNodes(ctx.nodesJson,
+                                   full ? nullptr : gBase.nodes,
+                                   full ? 0 : gBase.nodeCount,
+                                   next.nodes, kMaxNodeHashes, nodeCount);
+  next.nodeCount = (uint16_t)nodeCount;
+  gPending = next;
+  gHavePending = true;
+
+  size_t after = ctx.nodesJson.length();
+  for (String* s : sections) after += s->length();
+  ctx.statusDeltaJson = String("{\"v\":") + String((unsigned)kStatusDeltaVersion) +
+                        ",\"seq\":" + String((unsigned long)seq) +
+                        ",\"base\":" + String((unsigned long)(full ? 0 : gBase.seq)) + "}";
+  Serial.printf("[STATUS] %s seq=%lu base=%lu: sections+nodes %u -> %u bytes\n",
+                full ? "full" : "delta", (unsigned long)seq,
+                (unsigned long)(full ? 0 : gBase.seq),
+                (unsigned)before, (unsigned)after);
+}
+
+void statusDeltaIngestResponse(const String& responseBody) {
+  const int at = responseBody.indexOf("\"statusBaseline\"");
+  if (at < 0) return;   // backend without status deltas: stay on full
+  int i = responseBody.indexOf(':', at);
+  if (i < 0) return;
+  ++i;
+  while (i < (int)responseBody.length() && responseBody[i] == ' ') ++i;
+  uint32_t acked = 0;
+  bool sawDigit = false;
+  while (i < (int)responseBody.length() &&
+         responseBody[i] >= '0' && responseBody[i] <= '9') {
+    acked = acked * 10 + (uint32_t)(responseBody[i] - '0');
+    sawDigit = true;
+    ++i;
+  }
+  if (!sawDigit) return;
+
+  loadBaseline();
+  if (acked != 0 && gHavePending && acked == gPending.seq) {
+    gBase = gPending;
+    gHavePending = false;
+    saveBaseline();
+    Serial.printf("[STATUS] baseline -> seq %lu\n", (unsigned long)acked);
+  } else if (acked == 0 && gBase.seq != 0) {
+    gBase = Baseline{};
+    saveBaseline();
+    Serial.println("[STATUS] backend has no baseline - next status is full");
+  }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include "storage/json_payload.h"
+
+// ---------------------------------------------------------------------------
+// Status deltas
+// ---------------------------------------------------------------------------
+// The status object used to go out whole on every session: every node entry
+// plus transmission{}, modem{} and firmware{}. At fleet sizes of 64+ that
+// rivals the readings it rides with, although almost none of it changes
+// between sessions.
+//
+// Each status object now carries status.statusDelta {"v":1,"seq":S,"base":B}.
+// With base B != 0 it is a delta against the status the backend acknowledged
+// as seq B:
+//   - transmission{}, modem{}, firmware{} are omitted when unchanged; an
+//     absent section keeps the stored value.
+//   - a node entry whose content is unchanged apart from its per-contact
+//     fields shrinks to {"nodeId","lastSeenUnix","lastReportedBatV"}; nodes[]
+//     entries are upserts that merge into the stored row.
+// base 0 is a full snapshot: sent when there is no baseline and every
+// kStatusFullEverySessions sessions, so a backend that lost a delta
+// converges.
+//
+// The backend acknowledges by answering "statusBaseline": S, which advances
+// the baseline to this status. "statusBaseline": 0 (it has no baseline, or
+// not B) drops the baseline and the next status is full. A backend that never
+// answers statusBaseline gets a full status every session, as before.
+// Scalars, control{}, diagnostics{} and deploymentEvents[] are always sent.
+// Baseline hashes persist in NVS namespace "stdelta".
+
+constexpr uint8_t kStatusDeltaVersion = 1;
+constexpr uint8_t kStatusFullEverySessions = 12;
+
+// Rewrite ctx's sections as a delta against the acknowledged baseline and set
+// ctx.statusDeltaJson. Call once per status object, after its fields are
+// built and before it is POSTed; call again after rebuilding fields.
+void statusDeltaPrepare(StatusContext& ctx);
+
+// Advance (or drop) the baseline from an upload response body.
+void statusDeltaIngestResponse(const String& responseBody);
+
+// --- Building blocks, exposed for tests -------------------------------------
+
+// Hash of one status.nodes[] entry excluding the values of its per-contact
+// fields. 0 = not an object.
+uint32_t statusNodeStableHash(const String& entry);
+
+// Rewrite a status.nodes[] array: an entry whose stable hash is in acked[]
+// shrinks to its nodeId and per-contact fields. hashesOut receives each
+// entry's stable hash (the first maxHashes of them; hashCount = how many).
+String statusDeltaNodes(const String& nodesJson,
+                        const uint32_t* acked, size_t ackedCount,
+                        uint32_t* hashesOut, size_t maxHashes, size_t& hashCount);
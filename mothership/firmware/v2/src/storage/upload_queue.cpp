@@ -5,9 +5,10 @@ static const char* kTxNamespace = "tx";
 static const char* kDataFile    = "/datalog.csv";
 static const char* kTempFile    = "/datalog_tmp.csv";
 static const char* kBackupFile  = "/datalog_bak.csv";
+static const char* kRangesKey   = "up_ranges";
 
 // Any header older than the current one. All must be recognised: a hub can be
-// carrying a 25-, 30-, 31-, or 33-column file depending on which firmware it
+// carrying a 25-, 30-, 31-, 33-, 35- or 38-column file depending on which firmware it
 // upgraded from, and either way the queued rows must be preserved and
 // drained, not deleted or misparsed.
 static bool isLegacyCSVHeader(String header) {
@@ -15,7 +16,9 @@ static bool isLegacyCSVHeader(String header) {
   return header == String(kLegacyCSVHeader25) ||
          header == String(kLegacyCSVHeader30) ||
          header == String(kLegacyCSVHeader31) ||
-         header == String(kLegacyCSVHeader33);
+         header == String(kLegacyCSVHeader33) ||
+         header == String(kLegacyCSVHeader35) ||
+         header == String(kLegacyCSVHeader38);
 }
 
 bool uploadQueueHasLegacyRows(uint32_t* pendingRowsOut) {
@@ -72,7 +75,7 @@ static bool commitTempDataFile(const char* context) {
 // Construction / init
 // ---------------------------------------------------------------------------
 UploadQueue::UploadQueue()
-    : m_initialised(false), m_poisonOffset(0), m_poisonCount(0) {
+    : m_initialised(false), m_poisonOffset(0), m_poisonCount(0), m_rangeCount(0) {
   m_cursor.byteOffset    = 0;
   m_cursor.rowsUploaded   = 0;
   m_cursor.lastUploadUnix = 0;
@@ -111,11 +114,13 @@ bool UploadQueue::init() {
   // "normalise, never fail": a missing file or an out-of-range offset is a
   // self-healing reset, not an error, so it stays void.
   validateCursor();
+  validateRanges();
   m_initialised = true;
-  Serial.printf("[UQ] init: offset=%u rows=%u wakes=%u\n",
+  Serial.printf("[UQ] init: offset=%u rows=%u wakes=%u ranges=%u\n",
                 (unsigned)m_cursor.byteOffset,
                 (unsigned)m_cursor.rowsUploaded,
-                (unsigned)m_cursor.wakeCounter);
+                (unsigned)m_cursor.wakeCounter,
+                (unsigned)m_rangeCount);
   return true;
 }
 
@@ -146,6 +151,16 @@ bool UploadQueue::loadCursor() {
   // could never reach the threshold — it has to be durable.
   m_poisonOffset = prefs.getUInt("poison_off", 0);
   m_poisonCount  = prefs.getUChar("poison_n", 0);
+  // Fresh-lane ranges: one blob of whole UploadedRange records. Anything else
+  // (absent, torn, older layout) loads as no ranges - the rows they covered
+  // are uploaded once more by the backfill and deduped by the backend.
+  m_rangeCount = 0;
+  const size_t rangeBytes = prefs.getBytesLength(kRangesKey);
+  if (rangeBytes > 0 && rangeBytes % sizeof(UploadedRange) == 0 &&
+      rangeBytes <= sizeof(m_ranges) &&
+      prefs.getBytes(kRangesKey, m_ranges, rangeBytes) == rangeBytes) {
+    m_rangeCount = (uint8_t)(rangeBytes / sizeof(UploadedRange));
+  }
   prefs.end();
   return true;
 }
@@ -193,6 +208,17 @@ void UploadQueue::savePoisonState() {
   prefs.end();
 }
 
+void UploadQueue::saveRanges() {
+  Preferences prefs;
+  if (!prefs.begin(kTxNamespace, false)) return;
+  if (m_rangeCount == 0) {
+    if (prefs.isKey(kRangesKey)) prefs.remove(kRangesKey);
+  } else {
+    prefs.putBytes(kRangesKey, m_ranges, m_rangeCount * sizeof(UploadedRange));
+  }
+  prefs.end();
+}
+
 void UploadQueue::saveCursor() {
   Preferences prefs;
   if (!prefs.begin(kTxNamespace, false)) {   // read-write
@@ -333,13 +359,80 @@ void UploadQueue::validateCursor() {
   saveCursor();
 }
 
+void UploadQueue::validateRanges() {
+  if (m_rangeCount == 0) return;
+  File f = LittleFS.open(kDataFile, "r");
+  const uint32_t fileSize = f ? (uint32_t)f.size() : 0;
+  if (f) f.close();
+  // A range past EOF or out of order means the file was replaced underneath
+  // the record; drop them all rather than guess.
+  bool ok = m_rangeCount <= kMaxUploadedRanges;
+  for (uint8_t i = 0; ok && i < m_rangeCount; ++i) {
+    const UploadedRange& r = m_ranges[i];
+    if (r.start >= r.end || r.end > fileSize ||
+        (i > 0 && r.start <= m_ranges[i - 1].end)) {
+      ok = false;
+    }
+  }
+  if (!ok) {
+    Serial.printf("[UQ] validateRanges: %u range(s) do not fit the file - dropping\n",
+                  (unsigned)m_rangeCount);
+    m_rangeCount = 0;
+    saveRanges();
+    return;
+  }
+  if (foldRangesIntoCursor()) {
+    saveCursor();
+    saveRanges();
+  }
+}
+
+bool UploadQueue::foldRangesIntoCursor() {
+  uint8_t drop = 0;
+  while (drop < m_rangeCount && m_ranges[drop].start <= m_cursor.byteOffset) {
+    if (m_ranges[drop].end > m_cursor.byteOffset) {
+      m_cursor.byteOffset = m_ranges[drop].end;
+    }
+    ++drop;
+  }
+  if (drop == 0) return false;
+  for (uint8_t i = drop; i < m_rangeCount; ++i) m_ranges[i - drop] = m_ranges[i];
+  m_rangeCount -= drop;
+  return true;
+}
+
+void UploadQueue::shiftRanges(uint32_t cutOffset, uint32_t removedBytes) {
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < m_rangeCount; ++i) {
+    UploadedRange r = m_ranges[i];
+    if (r.end <= cutOffset) continue;
+    if (r.start < cutOffset) r.start = cutOffset;
+    r.start -= removedBytes;
+    r.end -= removedBytes;
+    m_ranges[kept++] = r;
+  }
+  m_rangeCount = kept;
+}
+
+uint32_t UploadQueue::nextRangeStart(uint32_t from) const {
+  for (uint8_t i = 0; i < m_rangeCount; ++i) {
+    if (m_ranges[i].start > from) return m_ranges[i].start;
+  }
+  return UINT32_MAX;
+}
+
 uint32_t UploadQueue::getPendingBytes() const {
   File f = LittleFS.open(kDataFile, "r");
   if (!f) return 0;
   size_t fileSize = f.size();
   f.close();
   if (fileSize <= m_cursor.byteOffset) return 0;
-  return (uint32_t)(fileSize - m_cursor.byteOffset);
+  uint32_t pending = (uint32_t)(fileSize - m_cursor.byteOffset);
+  for (uint8_t i = 0; i < m_rangeCount; ++i) {
+    const uint32_t end = m_ranges[i].end < fileSize ? m_ranges[i].end : (uint32_t)fileSize;
+    if (end > m_ranges[i].start) pending -= end - m_ranges[i].start;
+  }
+  return pending;
 }
 
 uint32_t UploadQueue::getPendingRows() const {
@@ -349,22 +442,63 @@ uint32_t UploadQueue::getPendingRows() const {
     f.close();
     return 0;
   }
+  // Rows inside an uploaded range are not pending. Ranges are sorted and
+  // start on row boundaries, so a '\n' at position p belongs to the range
+  // with start <= p < end.
   uint32_t rows = 0;
+  uint32_t pos = m_cursor.byteOffset;
+  uint8_t next = 0;
   while (f.available()) {
-    if (f.read() == '\n') rows++;
+    const int c = f.read();
+    if (c < 0) break;
+    while (next < m_rangeCount && pos >= m_ranges[next].end) ++next;
+    const bool uploaded = next < m_rangeCount && pos >= m_ranges[next].start;
+    if (c == '\n' && !uploaded) rows++;
+    ++pos;
   }
   f.close();
   return rows;
 }
 
+// Header line the payload is prefixed with. Normally the actual header. During
+// the safe 25->30 migration, present the current superset header while leaving
+// the old on-disk file and cursor untouched. Legacy rows have 25 cells (the
+// five appended values are absent) and new rows have all 30; both remain
+// positionally valid.
+static String payloadHeaderLine() {
+  String line;
+  File hf = LittleFS.open(kDataFile, "r");
+  if (hf) {
+    String header = hf.readStringUntil('\n');
+    hf.close();
+    if (header.length() > 0) {
+      line = isLegacyCSVHeader(header) ? String(kUploadCSVHeader) : header;
+    }
+  }
+  if (line.length() == 0) line = String(kUploadCSVHeader);
+  line += "\n";
+  return line;
+}
+
 // ---------------------------------------------------------------------------
 // getNewData
 // ---------------------------------------------------------------------------
 UploadPayload UploadQueue::getNewData(uint32_t maxBytes) {
+  return getNewDataFrom(m_cursor.byteOffset, maxBytes);
+}
+
+UploadPayload UploadQueue::getNewDataFrom(uint32_t startOffset, uint32_t maxBytes) {
+  if (startOffset < m_cursor.byteOffset) startOffset = m_cursor.byteOffset;
+  for (uint8_t i = 0; i < m_rangeCount; ++i) {
+    if (m_ranges[i].start <= startOffset && startOffset < m_ranges[i].end) {
+      startOffset = m_ranges[i].end;
+    }
+  }
+
   UploadPayload payload;
   payload.csvData    = String();
   payload.byteLength  = 0;
-  payload.startOffset = m_cursor.byteOffset;
+  payload.startOffset = startOffset;
   payload.rowEstimate = 0;
 
   const uint32_t freeHeap = ESP.getFreeHeap();
@@ -387,13 +521,20 @@ UploadPayload UploadQueue::getNewData(uint32_t maxBytes) {
                   static_cast<unsigned>(freeHeap));
   }
 
+  // Stop at the next fresh-lane range: those rows are already uploaded. A
+  // range starts on a row boundary, so the chunk still ends on one.
+  const uint32_t rangeStart = nextRangeStart(startOffset);
+  if (rangeStart != UINT32_MAX && rangeStart - startOffset < effectiveMaxBytes) {
+    effectiveMaxBytes = rangeStart - startOffset;
+  }
+
   File f = LittleFS.open(kDataFile, "r");
   if (!f) {
     Serial.println("[UQ] getNewData: cannot open datalog.csv");
     return payload;
   }
 
-  if (!f.seek(m_cursor.byteOffset)) {
+  if (!f.seek(startOffset)) {
     Serial.println("[UQ] getNewData: seek failed — offset past EOF");
     f.close();
     return payload;
@@ -406,29 +547,7 @@ UploadPayload UploadQueue::getNewData(uint32_t maxBytes) {
     return payload;
   }
 
-  // Normally use the actual header. During the safe 25->30 migration, present
-  // the current superset header while leaving the old on-disk file and cursor
-  // untouched. Legacy rows have 25 cells (the five appended values are absent)
-  // and new rows have all 30; both remain positionally valid.
-  {
-    File hf = LittleFS.open(kDataFile, "r");
-    if (hf) {
-      String header = hf.readStringUntil('\n');
-      hf.close();
-      if (header.length() > 0) {
-        payload.csvData = isLegacyCSVHeader(header)
-            ? String(kUploadCSVHeader)
-            : header;
-        payload.csvData += "\n";
-      } else {
-        payload.csvData = String(kUploadCSVHeader);
-        payload.csvData += "\n";
-      }
-    } else {
-      payload.csvData = String(kUploadCSVHeader);
-      payload.csvData += "\n";
-    }
-  }
+  payload.csvData = payloadHeaderLine();
   const uint32_t payloadHeaderLength = payload.csvData.length();
 
   uint8_t buf[4096];
@@ -508,12 +627,166 @@ UploadPayload UploadQueue::getNewData(uint32_t maxBytes) {
   return payload;
 }
 
+// ---------------------------------------------------------------------------
+// Freshness-first lane
+// ---------------------------------------------------------------------------
+// Hash of a row's nodeId cell (column 2), 0 when the row has none.
+static uint32_t rowNodeHash(const char* row, size_t len) {
+  size_t i = 0;
+  while (i < len && row[i] != ',') ++i;
+  if (i >= len) return 0;
+  uint32_t h = 2166136261u;   // FNV-1a
+  bool any = false;
+  for (++i; i < len && row[i] != ',' && row[i] != '\r' && row[i] != '\n'; ++i) {
+    h = (h ^ (uint8_t)row[i]) * 16777619u;
+    any = true;
+  }
+  return any ? (h ? h : 1u) : 0;
+}
+
+UploadPayload UploadQueue::getFreshData(uint32_t maxBytes, uint16_t nodesWanted) {
+  UploadPayload payload;
+  payload.csvData     = String();
+  payload.byteLength  = 0;
+  payload.startOffset = 0;
+  payload.rowEstimate = 0;
+
+  // The window plus the payload copy, and the same margin getNewData() keeps.
+  // The fresh lane is an optimisation: on a tight heap it just does not run.
+  if (ESP.getFreeHeap() < 2U * maxBytes + 8192U) return payload;
+
+  File f = LittleFS.open(kDataFile, "r");
+  if (!f) return payload;
+  const uint32_t fileSize = (uint32_t)f.size();
+  // Never overlap an earlier window: start at or after the newest range.
+  const uint32_t floorOffset =
+      m_rangeCount > 0 ? m_ranges[m_rangeCount - 1].end : m_cursor.byteOffset;
+  if (fileSize <= floorOffset) {
+    f.close();
+    return payload;
+  }
+  const uint32_t readStart =
+      (fileSize - floorOffset > maxBytes) ? fileSize - maxBytes : floorOffset;
+
+  String tail;
+  if (!tail.reserve(fileSize - readStart + 1) || !f.seek(readStart)) {
+    f.close();
+    return payload;
+  }
+  uint8_t buf[512];
+  while (f.available()) {
+    const int n = f.read(buf, sizeof(buf));
+    if (n <= 0) break;
+    tail.concat(reinterpret_cast<const char*>(buf), (size_t)n);
+  }
+  f.close();
+
+  const char* data = tail.c_str();
+  const int32_t len = (int32_t)tail.length();
+  // Window bounds, relative to readStart. The end drops a crash-truncated last
+  // row; the start moves to the first whole row unless it sits on the floor.
+  int32_t end = len;
+  while (end > 0 && data[end - 1] != '\n') --end;
+  int32_t begin = 0;
+  if (readStart != floorOffset) {
+    while (begin < end && data[begin] != '\n') ++begin;
+    ++begin;
+  }
+  if (begin >= end) return payload;
+
+  // Walk back from the newest row until every wanted node has a row in the
+  // window. Bounded: a fleet larger than the table simply uses the byte limit.
+  constexpr uint16_t kMaxTrackedNodes = 64;
+  uint32_t seen[kMaxTrackedNodes];
+  uint16_t seenCount = 0;
+  const uint16_t wanted = nodesWanted < kMaxTrackedNodes ? nodesWanted : kMaxTrackedNodes;
+  int32_t windowStart = end;
+  uint32_t rows = 0;
+  while (windowStart > begin && (wanted == 0 || seenCount < wanted)) {
+    int32_t rowStart = windowStart - 1;   // on the previous row's '\n'
+    while (rowStart > begin && data[rowStart - 1] != '\n') --rowStart;
+    const uint32_t h = rowNodeHash(data + rowStart, (size_t)(windowStart - rowStart));
+    if (h != 0) {
+      bool known = false;
+      for (uint16_t i = 0; i < seenCount && !known; ++i) known = seen[i] == h;
+      if (!known && seenCount < kMaxTrackedNodes) seen[seenCount++] = h;
+    }
+    windowStart = rowStart;
+    ++rows;
+  }
+
+  const uint32_t startOffset = readStart + (uint32_t)windowStart;
+  // Not worth a jump: the backfill's next chunk reaches the window anyway.
+  if (startOffset <= m_cursor.byteOffset ||
+      startOffset - m_cursor.byteOffset < maxBytes) {
+    return payload;
+  }
+  if (m_rangeCount >= kMaxUploadedRanges && startOffset != floorOffset) {
+    Serial.println("[UQ] getFreshData: all range slots in use - backfill only");
+    return payload;
+  }
+
+  payload.csvData = payloadHeaderLine();
+  if (!payload.csvData.concat(data + windowStart, (size_t)(end - windowStart))) {
+    Serial.println("[UPLOAD] String allocation failed");
+    payload.csvData = String();
+    return payload;
+  }
+  payload.byteLength  = (uint32_t)(end - windowStart);
+  payload.startOffset = startOffset;
+  payload.rowEstimate = rows;
+  return payload;
+}
+
+bool UploadQueue::markUploaded(uint32_t startOffset, uint32_t endOffset,
+                               uint32_t timestampUnix, uint32_t rowsUploadedDelta) {
+  if (endOffset <= startOffset) return false;
+  if (startOffset <= m_cursor.byteOffset) {
+    return advanceCursor(endOffset > m_cursor.byteOffset ? endOffset : m_cursor.byteOffset,
+                         timestampUnix, rowsUploadedDelta);
+  }
+  // Merge with every range it touches (adjacent counts), then insert in order.
+  UploadedRange merged = {startOffset, endOffset};
+  uint8_t at = 0;
+  while (at < m_rangeCount && m_ranges[at].end < merged.start) ++at;
+  uint8_t past = at;
+  while (past < m_rangeCount && m_ranges[past].start <= merged.end) {
+    if (m_ranges[past].start < merged.start) merged.start = m_ranges[past].start;
+    if (m_ranges[past].end > merged.end) merged.end = m_ranges[past].end;
+    ++past;
+  }
+  const uint8_t newCount = (uint8_t)(m_rangeCount - (past - at) + 1);
+  if (newCount > kMaxUploadedRanges) {
+    Serial.printf("[UQ] markUploaded: no free range slot for %u..%u\n",
+                  (unsigned)startOffset, (unsigned)endOffset);
+    return false;
+  }
+  UploadedRange next[kMaxUploadedRanges];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < at; ++i) next[n++] = m_ranges[i];
+  next[n++] = merged;
+  for (uint8_t i = past; i < m_rangeCount; ++i) next[n++] = m_ranges[i];
+  memcpy(m_ranges, next, n * sizeof(UploadedRange));
+  m_rangeCount = n;
+
+  m_cursor.lastUploadUnix = timestampUnix;
+  m_cursor.rowsUploaded += rowsUploadedDelta;
+  saveRanges();
+  saveCursor();
+  Serial.printf("[UQ] markUploaded: %u..%u rows+=%u ranges=%u\n",
+                (unsigned)startOffset, (unsigned)endOffset,
+                (unsigned)rowsUploadedDelta, (unsigned)m_rangeCount);
+  return true;
+}
+
 // ---------------------------------------------------------------------------
 // advanceCursor
 // ---------------------------------------------------------------------------
 bool UploadQueue::advanceCursor(uint32_t newOffset, uint32_t timestampUnix,
                                 uint32_t rowsUploadedDelta) {
   m_cursor.byteOffset    = newOffset;
+  // Reaching a fresh-lane range skips it: those rows are already uploaded.
+  if (foldRangesIntoCursor()) saveRanges();
   m_cursor.lastUploadUnix = timestampUnix;
   // Accumulate the rows actually uploaded (the caller passes the chunk's row
   // count; malformed-skip advances pass 0). This is what the "N readings sent"
@@ -521,7 +794,7 @@ bool UploadQueue::advanceCursor(uint32_t newOffset, uint32_t timestampUnix,
   m_cursor.rowsUploaded += rowsUploadedDelta;
   saveCursor();
   Serial.printf("[UQ] advanceCursor: offset=%u ts=%u rows+=%u total=%u\n",
-                (unsigned)newOffset, (unsigned)timestampUnix,
+                (unsigned)m_cursor.byteOffset, (unsigned)timestampUnix,
                 (unsigned)rowsUploadedDelta, (unsigned)m_cursor.rowsUploaded);
   return true;
 }
@@ -587,8 +860,13 @@ bool UploadQueue::purgeUploaded() {
     return false;
   }
 
-  // Reset cursor to header end.
+  // Reset cursor to header end; ranges above it move down with their rows.
+  const uint32_t oldCursor = m_cursor.byteOffset;
   m_cursor.byteOffset = headerEndOffset();
+  if (m_rangeCount > 0) {
+    shiftRanges(oldCursor, oldCursor - m_cursor.byteOffset);
+    saveRanges();
+  }
   saveCursor();
 
   Serial.printf("[UQ] purgeUploaded: copied %u bytes, cursor reset to %u\n",
@@ -742,6 +1020,11 @@ bool UploadQueue::emergencyPurgeIfFull(uint8_t thresholdPct) {
       m_cursor.byteOffset = headerEndOffset();
     }
   }
+  if (m_rangeCount > 0) {
+    shiftRanges(skipBoundaryOffset, skipBoundaryOffset - firstDataOffset);
+    foldRangesIntoCursor();
+    saveRanges();
+  }
   m_cursor.rowsRemovedLocally += rowsToSkip;
   saveCursor();
 
@@ -20,7 +20,7 @@ static constexpr uint8_t kLittleFsRetentionKeepPct = 40;
 // ---------------------------------------------------------------------------
 // CSV header (must match flash_logger.cpp)
 // ---------------------------------------------------------------------------
-static constexpr const char* kUploadCSVHeader = kCurrentCSVHeader35;
+static constexpr const char* kUploadCSVHeader = kCurrentCSVHeader40;
 
 // True while /datalog.csv still carries a pre-epoch header, i.e. queued rows
 // exist that have no deploymentEpoch column. Those rows would follow the
@@ -43,13 +43,21 @@ struct UploadCursor {
   uint32_t rowsRemovedLocally; // cumulative rows evicted from bounded history
 };
 
+// A run of rows above the cursor that the fresh lane has already uploaded.
+// [start, end) are row boundaries in /datalog.csv.
+struct UploadedRange {
+  uint32_t start;
+  uint32_t end;
+};
+
 // ---------------------------------------------------------------------------
 // Payload — produced by getNewData()
 // ---------------------------------------------------------------------------
 struct UploadPayload {
   String  csvData;       // CSV header + rows from cursor to EOF (or maxBytes)
   uint32_t byteLength;   // payload size in bytes (data portion, excluding header)
-  uint32_t startOffset;  // byte offset where this payload starts (= cursor)
+  uint32_t startOffset;  // byte offset where this payload starts (= cursor,
+                         // or the fresh window's start for getFreshData())
   uint32_t rowEstimate;  // approximate row count in data portion
 };
 
@@ -78,17 +86,51 @@ class UploadQueue {
 
   // Read new data from /datalog.csv starting at the cursor, up to maxBytes.
   // The payload is prefixed with the CSV header.  Reading stops at a row
-  // boundary (next '\n') so rows are never split.
+  // boundary (next '\n') so rows are never split, and at the start of the
+  // next uploaded range so fresh-lane rows are not sent twice.
   UploadPayload getNewData(uint32_t maxBytes);
 
+  // Read ahead of the cursor: getNewData() starting at startOffset instead, a
+  // row boundary at or above the cursor (the end of a chunk still in flight).
+  // A start at an uploaded range moves past it. Used by the pipelined upload,
+  // which builds chunk N+1 before chunk N is acknowledged; the cursor itself
+  // only moves through advanceCursor(), in order.
+  UploadPayload getNewDataFrom(uint32_t startOffset, uint32_t maxBytes);
+
   // Advance the cursor after a successful upload.
   // newOffset  — byte offset of the first un-uploaded byte.
   // timestampUnix — RTC timestamp to store as lastUploadUnix (0 if unknown).
   // rowsUploadedDelta — rows actually uploaded in this chunk; added to the
   //   cumulative rowsUploaded counter (0 for malformed-skip advances).
+  // An uploaded range the cursor reaches is folded in (the cursor jumps past it).
   bool advanceCursor(uint32_t newOffset, uint32_t timestampUnix,
                      uint32_t rowsUploadedDelta = 0);
 
+  // --- Freshness-first lane -------------------------------------------------
+  // After an outage the cursor drains the backlog oldest-first, one chunk per
+  // POST, so the dashboard stays stale for as many sessions as the backlog
+  // takes. The fresh lane sends the newest rows first: the tail of the file,
+  // reaching back far enough to hold the latest row of nodesWanted distinct
+  // nodes (or maxBytes, whichever is less). Once acknowledged, the window is
+  // recorded as an uploaded range above the cursor; the cursor then backfills
+  // oldest-first as before and skips over it. Ranges persist in NVS "tx".
+  static constexpr uint8_t kMaxUploadedRanges = 8;
+
+  // Empty payload when there is no backlog worth jumping (the window would
+  // start less than maxBytes past the cursor), when every range slot is taken,
+  // or when the heap cannot hold the window. A window never overlaps an
+  // earlier range: it starts at or after the newest range's end.
+  UploadPayload getFreshData(uint32_t maxBytes, uint16_t nodesWanted);
+
+  // Record [startOffset, endOffset) as uploaded. Adjacent and overlapping
+  // ranges merge; a range starting at or below the cursor advances it instead.
+  // Returns false when no slot is free (the rows are then simply uploaded
+  // again by the backfill, which the backend dedupes).
+  bool markUploaded(uint32_t startOffset, uint32_t endOffset,
+                    uint32_t timestampUnix, uint32_t rowsUploadedDelta);
+
+  uint8_t uploadedRangeCount() const { return m_rangeCount; }
+
   // Streaming rewrite: keep only the un-uploaded portion of /datalog.csv.
   // Writes header + rows from cursor to EOF into /datalog_tmp.csv, then
   // swaps files and resets the cursor to the header end.
@@ -149,6 +191,19 @@ class UploadQueue {
   bool loadCursor();
   // Persist the poison-row counters to NVS namespace "tx".
   void savePoisonState();
+  // Persist m_ranges to NVS namespace "tx" (one blob).
+  void saveRanges();
+  // Normalise the loaded ranges against the file; called by init() after
+  // validateCursor(). Same "never fail" contract.
+  void validateRanges();
+  // Drop ranges the cursor has reached, moving the cursor past them. Returns
+  // true when anything changed.
+  bool foldRangesIntoCursor();
+  // After a rewrite removed every byte below cutOffset except the header:
+  // clip ranges to cutOffset and shift them down by removedBytes.
+  void shiftRanges(uint32_t cutOffset, uint32_t removedBytes);
+  // Start of the first range above offset `from`, UINT32_MAX if none.
+  uint32_t nextRangeStart(uint32_t from) const;
   // Byte offset of the first data row (end of header line).
   uint32_t headerEndOffset() const;
 
@@ -156,4 +211,7 @@ class UploadQueue {
   bool m_initialised;
   uint32_t m_poisonOffset;   // cursor offset the failures are counted against
   uint8_t  m_poisonCount;    // consecutive non-retryable rejections there
+  // Sorted, disjoint, non-adjacent; every start is above the cursor.
+  UploadedRange m_ranges[kMaxUploadedRanges];
+  uint8_t  m_rangeCount;
 };
@@ -0,0 +1,226 @@
+#include "time/node_clock_skew.h"
+#include "config/node_registry.h"
+#include "clock_sync.h"
+
+#include <LittleFS.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+// On-flash record
+// ---------------------------------------------------------------------------
+
+static const char* kClockFile = "/clock.bin";
+static const char* kClockTmp  = "/clock.tmp";
+
+static constexpr uint32_t kClockMagic   = 0x4B4C4346UL;  // "FCLK"
+static constexpr uint16_t kClockVersion = 1;
+static constexpr size_t   kClockNodes   = NODE_REGISTRY_CAPACITY;
+static constexpr size_t   kClockIdLen   = 16;            // wire nodeId width
+
+struct ClockNodeRecord {
+  char     nodeId[kClockIdLen];  // "" = free
+  uint8_t  count;                // valid samples, newest at head - 1
+  uint8_t  head;
+  NodeClockSample samples[kClockHistoryLen];
+};
+
+struct ClockFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t records;    // ClockNodeRecord entries that follow
+  uint32_t checksum;   // FNV-1a over the records
+};
+
+// Static, not on the loop stack: ~12 KB at the default registry capacity.
+static ClockNodeRecord gRecords[kClockNodes];
+static bool gDirty = false;
+
+static uint32_t fnv1a32(const uint8_t* data, size_t len) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= data[i];
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+static ClockNodeRecord* findRecord(const char* nodeId) {
+  if (!nodeId || !nodeId[0]) return nullptr;
+  for (auto& r : gRecords) {
+    if (r.nodeId[0] && strncmp(r.nodeId, nodeId, kClockIdLen) == 0) return &r;
+  }
+  return nullptr;
+}
+
+// A free slot, or one whose node has left the registry since boot.
+static ClockNodeRecord* allocRecord(const char* nodeId) {
+  for (auto& r : gRecords) {
+    if (!r.nodeId[0] || !registeredNodes.findById(r.nodeId)) {
+      memset(&r, 0, sizeof(r));
+      strncpy(r.nodeId, nodeId, kClockIdLen - 1);
+      return &r;
+    }
+  }
+  return nullptr;
+}
+
+static const NodeClockSample* latest(const ClockNodeRecord& r) {
+  if (r.count == 0) return nullptr;
+  return &r.samples[(r.head + kClockHistoryLen - 1) % kClockHistoryLen];
+}
+
+// Newest report that carried a drift estimate.
+static const NodeClockSample* latestDrift(const ClockNodeRecord& r) {
+  for (uint8_t i = 1; i <= r.count; ++i) {
+    const NodeClockSample& s = r.samples[(r.head + kClockHistoryLen - i) % kClockHistoryLen];
+    if (s.flags & CLOCK_DRIFT_VALID) return &s;
+  }
+  return nullptr;
+}
+
+// What the node's clock was left holding after the report: the sample's own
+// uncertainty, plus the untouched offset when the node decided not to step.
+static uint32_t residualMs(const NodeClockSample& s) {
+  uint32_t residual = (uint32_t)(s.rttMs + 1U) / 2U + 2U;
+  if (!(s.flags & CLOCK_PROBE_STEPPED)) {
+    residual += (uint32_t)(s.offsetMs < 0 ? -(int64_t)s.offsetMs : s.offsetMs);
+  }
+  return residual;
+}
+
+static void mirrorInto(NodeInfo& n, const ClockNodeRecord* r) {
+  const NodeClockSample* s = r ? latest(*r) : nullptr;
+  n.hasClockSkew = s != nullptr;
+  if (!s) return;
+  const NodeClockSample* d = latestDrift(*r);
+  n.clockSyncUnix      = s->atUnix;
+  n.clockOffsetMs      = s->offsetMs;
+  n.clockRttMs         = s->rttMs;
+  n.clockResidualMs    = (uint16_t)min(residualMs(*s), (uint32_t)UINT16_MAX);
+  n.clockDriftValid    = d != nullptr;
+  n.clockDriftCentiPpm = d ? d->driftCentiPpm : 0;
+  n.clockAging         = s->aging;
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool nodeClockSkewBegin() {
+  memset(gRecords, 0, sizeof(gRecords));
+  gDirty = false;
+
+  bool loaded = false;
+  File f = LittleFS.open(kClockFile, "r");
+  if (f) {
+    ClockFileHeader hdr{};
+    const bool headerOk =
+        f.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) == sizeof(hdr) &&
+        hdr.magic == kClockMagic && hdr.version == kClockVersion &&
+        hdr.records <= kClockNodes;
+    if (headerOk) {
+      const size_t bytes = (size_t)hdr.records * sizeof(ClockNodeRecord);
+      loaded = f.read(reinterpret_cast<uint8_t*>(gRecords), bytes) == bytes &&
+               fnv1a32(reinterpret_cast<const uint8_t*>(gRecords), bytes) == hdr.checksum;
+    }
+    f.close();
+    if (!loaded) {
+      Serial.println("[CLOCK] /clock.bin unreadable — starting empty");
+      memset(gRecords, 0, sizeof(gRecords));
+    }
+  }
+
+  size_t kept = 0;
+  for (auto& r : gRecords) {
+    if (!r.nodeId[0]) continue;
+    r.nodeId[kClockIdLen - 1] = '\0';
+    if (r.count > kClockHistoryLen || r.head >= kClockHistoryLen ||
+        !registeredNodes.findById(r.nodeId)) {
+      memset(&r, 0, sizeof(r));
+      gDirty = true;
+      continue;
+    }
+    ++kept;
+  }
+  nodeClockSkewSyncRegistryMirror();
+  Serial.printf("[CLOCK] skew history: %u node(s)\n", (unsigned)kept);
+  return loaded;
+}
+
+void nodeClockSkewRecord(const char* nodeId, const clock_probe_message_t& report,
+                         uint32_t hubUnix) {
+  if (!(report.flags & CLOCK_PROBE_REPORT)) return;
+  ClockNodeRecord* r = findRecord(nodeId);
+  if (!r) r = allocRecord(nodeId);
+  if (!r) return;
+
+  NodeClockSample& s = r->samples[r->head];
+  s.atUnix        = hubUnix;
+  s.offsetMs      = report.offsetMs;
+  s.rttMs         = report.delayMs;
+  s.driftCentiPpm = report.driftCentiPpm;
+  s.aging         = report.agingOffset;
+  s.flags         = report.flags;
+  r->head = (uint8_t)((r->head + 1) % kClockHistoryLen);
+  if (r->count < kClockHistoryLen) r->count++;
+  gDirty = true;
+
+  if (NodeInfo* n = registeredNodes.findById(nodeId)) mirrorInto(*n, r);
+}
+
+bool nodeClockSkewCommit() {
+  if (!gDirty) return true;
+
+  // Trailing free slots are not written.
+  size_t records = kClockNodes;
+  while (records > 0 && !gRecords[records - 1].nodeId[0]) --records;
+
+  ClockFileHeader hdr{};
+  hdr.magic = kClockMagic;
+  hdr.version = kClockVersion;
+  hdr.records = (uint16_t)records;
+  const size_t bytes = records * sizeof(ClockNodeRecord);
+  hdr.checksum = fnv1a32(reinterpret_cast<const uint8_t*>(gRecords), bytes);
+
+  File f = LittleFS.open(kClockTmp, "w", true);
+  if (!f) {
+    Serial.println("[CLOCK] commit: cannot open temp file");
+    return false;
+  }
+  size_t written = f.write(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr));
+  written += f.write(reinterpret_cast<const uint8_t*>(gRecords), bytes);
+  const bool writeError = f.getWriteError();
+  f.close();
+  if (writeError || written != sizeof(hdr) + bytes) {
+    Serial.println("[CLOCK] commit: short write");
+    LittleFS.remove(kClockTmp);
+    return false;
+  }
+  // History only sizes the rendezvous: losing it costs one legacy-length
+  // window, so a plain replace is enough (no backup generation).
+  LittleFS.remove(kClockFile);
+  if (!LittleFS.rename(kClockTmp, kClockFile)) {
+    Serial.println("[CLOCK] commit: rename failed");
+    LittleFS.remove(kClockTmp);
+    return false;
+  }
+  gDirty = false;
+  return true;
+}
+
+bool nodeClockSkewBoundMs(const char* nodeId, uint32_t hubUnix, uint32_t& boundMs) {
+  const ClockNodeRecord* r = findRecord(nodeId);
+  const NodeClockSample* s = r ? latest(*r) : nullptr;
+  if (!s) return false;
+  const NodeClockSample* d = latestDrift(*r);
+  const uint32_t elapsed = hubUnix > s->atUnix ? hubUnix - s->atUnix : 0;
+  boundMs = clock_sync::skewBoundMs(residualMs(*s), d != nullptr,
+                                    d ? d->driftCentiPpm : 0, elapsed);
+  return true;
+}
+
+void nodeClockSkewSyncRegistryMirror() {
+  for (auto& n : registeredNodes) {
+    mirrorInto(n, findRecord(n.nodeId.c_str()));
+  }
+}
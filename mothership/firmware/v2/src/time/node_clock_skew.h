@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+#include "protocol.h"
+
+// ---------------------------------------------------------------------------
+// Per-node clock skew history (two-way CLOCK_PROBE exchange)
+// ---------------------------------------------------------------------------
+// Once per sync session a node reports the offset it measured against the hub
+// before stepping its RTC, the round trip of that sample and, once it has a
+// long enough span, its crystal drift and DS3231 aging value. The last
+// kClockHistoryLen reports per node are kept in LittleFS (/clock.bin) so the
+// hub can size the next rendezvous from how far each node can have wandered
+// since, and status.nodes[] can show it. The file is rewritten at most once per
+// wake, after the sync window.
+
+constexpr size_t kClockHistoryLen = 8;
+
+struct __attribute__((packed)) NodeClockSample {
+  uint32_t atUnix;         // hub time of the report
+  int32_t  offsetMs;       // hub minus node, before the node stepped
+  uint16_t rttMs;          // round trip of the sample the node used
+  int16_t  driftCentiPpm;  // valid when flags & CLOCK_DRIFT_VALID; +ve = node fast
+  int8_t   aging;          // DS3231 aging register after the session
+  uint8_t  flags;          // CLOCK_PROBE_* / CLOCK_DRIFT_VALID as reported
+};
+
+// Load /clock.bin, drop records for nodes no longer in the registry and fill
+// the NodeInfo mirror. Call after loadPairedNodes(). A missing or corrupt file
+// starts empty: every node then gets the legacy rendezvous until it reports.
+bool nodeClockSkewBegin();
+
+// Record a CLOCK_PROBE_REPORT from an authenticated node and refresh its
+// mirror. RAM only until nodeClockSkewCommit().
+void nodeClockSkewRecord(const char* nodeId, const clock_probe_message_t& report,
+                         uint32_t hubUnix);
+
+// Write /clock.bin if anything was recorded since the last commit.
+bool nodeClockSkewCommit();
+
+// Worst-case |hub - node| at hubUnix: the residual left by the node's last
+// fix plus its drift (measured, or the DS3231 spec when unknown) since. False
+// when the node has no usable report, i.e. the caller cannot bound it.
+bool nodeClockSkewBoundMs(const char* nodeId, uint32_t hubUnix, uint32_t& boundMs);
+
+// Refresh the clock fields of every NodeInfo from the history.
+void nodeClockSkewSyncRegistryMirror();
@@ -0,0 +1,254 @@
+#include "time/rendezvous_history.h"
+#include "config/node_registry.h"
+#include "time/sync_cohorts.h"
+
+#include <LittleFS.h>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+// Policy
+// ---------------------------------------------------------------------------
+
+// Arrivals needed before a node's window is trusted to close early.
+static constexpr uint8_t kMinArrivals = 3;
+// Held past the slowest recent arrival: a HELLO retry plus ESP-NOW contention
+// when more nodes than usual boot together.
+static constexpr int32_t kArrivalMarginMs = 2500;
+// After a miss the node gets the full window for this many sessions, and again
+// every kReprobeEvery consecutive misses, so a node that is merely late (not
+// gone) is re-learned instead of being shut out by its old timing.
+static constexpr uint8_t kFullWindowMisses = 2;
+static constexpr uint8_t kReprobeEvery     = 8;
+// A dropped cohort's slot stops being visited once its remaining nodes have
+// missed this many of those visits in a row.
+static constexpr uint8_t kCohortQuietMisses = 8;
+
+// ---------------------------------------------------------------------------
+// On-flash record
+// ---------------------------------------------------------------------------
+
+static const char* kRdvFile = "/rdv.bin";
+static const char* kRdvTmp  = "/rdv.tmp";
+
+static constexpr uint32_t kRdvMagic   = 0x56445246UL;  // "FRDV"
+static constexpr uint16_t kRdvVersion = 1;
+static constexpr size_t   kRdvNodes   = NODE_REGISTRY_CAPACITY;
+static constexpr size_t   kRdvIdLen   = 16;            // wire nodeId width
+
+struct RdvNodeRecord {
+  char     nodeId[kRdvIdLen];  // "" = free
+  uint8_t  count;              // valid arrivals, newest at head - 1
+  uint8_t  head;
+  uint8_t  misses;             // consecutive windows without a HELLO (saturates)
+  uint8_t  cohort;             // confirmed sync cohort (was reserved, always 0)
+  int16_t  arrivalMs[kRendezvousHistoryLen];  // after the slot, clamped
+};
+
+struct RdvFileHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t records;    // RdvNodeRecord entries that follow
+  uint32_t checksum;   // FNV-1a over the records
+};
+
+static RdvNodeRecord gRecords[kRdvNodes];
+// This wake's plan, per record. RAM only: recomputed every wake.
+static uint8_t gCohortTarget[kRdvNodes];
+static bool gDirty = false;
+
+static uint32_t fnv1a32(const uint8_t* data, size_t len) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= data[i];
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+static RdvNodeRecord* findRecord(const char* nodeId) {
+  if (!nodeId || !nodeId[0]) return nullptr;
+  for (auto& r : gRecords) {
+    if (r.nodeId[0] && strncmp(r.nodeId, nodeId, kRdvIdLen) == 0) return &r;
+  }
+  return nullptr;
+}
+
+// A free slot, or one whose node has left the registry since boot.
+static RdvNodeRecord* allocRecord(const char* nodeId) {
+  for (auto& r : gRecords) {
+    if (!r.nodeId[0] || !registeredNodes.findById(r.nodeId)) {
+      memset(&r, 0, sizeof(r));
+      strncpy(r.nodeId, nodeId, kRdvIdLen - 1);
+      return &r;
+    }
+  }
+  return nullptr;
+}
+
+static RdvNodeRecord* recordFor(const char* nodeId) {
+  RdvNodeRecord* r = findRecord(nodeId);
+  return r ? r : allocRecord(nodeId);
+}
+
+// ---------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------
+
+bool rendezvousHistoryBegin() {
+  memset(gRecords, 0, sizeof(gRecords));
+  memset(gCohortTarget, 0, sizeof(gCohortTarget));
+  gDirty = false;
+
+  bool loaded = false;
+  File f = LittleFS.open(kRdvFile, "r");
+  if (f) {
+    RdvFileHeader hdr{};
+    const bool headerOk =
+        f.read(reinterpret_cast<uint8_t*>(&hdr), sizeof(hdr)) == sizeof(hdr) &&
+        hdr.magic == kRdvMagic && hdr.version == kRdvVersion &&
+        hdr.records <= kRdvNodes;
+    if (headerOk) {
+      const size_t bytes = (size_t)hdr.records * sizeof(RdvNodeRecord);
+      loaded = f.read(reinterpret_cast<uint8_t*>(gRecords), bytes) == bytes &&
+               fnv1a32(reinterpret_cast<const uint8_t*>(gRecords), bytes) == hdr.checksum;
+    }
+    f.close();
+    if (!loaded) {
+      Serial.println("[SYNC] /rdv.bin unreadable — starting empty");
+      memset(gRecords, 0, sizeof(gRecords));
+    }
+  }
+
+  size_t kept = 0;
+  for (auto& r : gRecords) {
+    if (!r.nodeId[0]) continue;
+    r.nodeId[kRdvIdLen - 1] = '\0';
+    if (r.count > kRendezvousHistoryLen || r.head >= kRendezvousHistoryLen ||
+        r.cohort >= sync_cohorts::kMaxCohorts ||
+        !registeredNodes.findById(r.nodeId)) {
+      memset(&r, 0, sizeof(r));
+      gDirty = true;
+      continue;
+    }
+    ++kept;
+  }
+  Serial.printf("[SYNC] rendezvous history: %u node(s)\n", (unsigned)kept);
+  return loaded;
+}
+
+void rendezvousHistoryRecordArrival(const char* nodeId, int32_t arrivalMs) {
+  RdvNodeRecord* r = recordFor(nodeId);
+  if (!r) return;
+  if (arrivalMs > INT16_MAX) arrivalMs = INT16_MAX;
+  if (arrivalMs < INT16_MIN) arrivalMs = INT16_MIN;
+  r->arrivalMs[r->head] = (int16_t)arrivalMs;
+  r->head = (uint8_t)((r->head + 1) % kRendezvousHistoryLen);
+  if (r->count < kRendezvousHistoryLen) r->count++;
+  r->misses = 0;
+  gDirty = true;
+}
+
+void rendezvousHistoryRecordMiss(const char* nodeId) {
+  RdvNodeRecord* r = recordFor(nodeId);
+  if (!r) return;
+  if (r->misses < UINT8_MAX) r->misses++;
+  gDirty = true;
+}
+
+bool rendezvousHistoryCommit() {
+  if (!gDirty) return true;
+
+  // Trailing free slots are not written.
+  size_t records = kRdvNodes;
+  while (records > 0 && !gRecords[records - 1].nodeId[0]) --records;
+
+  RdvFileHeader hdr{};
+  hdr.magic = kRdvMagic;
+  hdr.version = kRdvVersion;
+  hdr.records = (uint16_t)records;
+  const size_t bytes = records * sizeof(RdvNodeRecord);
+  hdr.checksum = fnv1a32(reinterpret_cast<const uint8_t*>(gRecords), bytes);
+
+  File f = LittleFS.open(kRdvTmp, "w", true);
+  if (!f) {
+    Serial.println("[SYNC] rdv commit: cannot open temp file");
+    return false;
+  }
+  size_t written = f.write(reinterpret_cast<const uint8_t*>(&hdr), sizeof(hdr));
+  written += f.write(reinterpret_cast<const uint8_t*>(gRecords), bytes);
+  const bool writeError = f.getWriteError();
+  f.close();
+  if (writeError || written != sizeof(hdr) + bytes) {
+    Serial.println("[SYNC] rdv commit: short write");
+    LittleFS.remove(kRdvTmp);
+    return false;
+  }
+  // Losing the history only costs full-length join phases until it is
+  // re-learned, so a plain replace is enough (no backup generation).
+  LittleFS.remove(kRdvFile);
+  if (!LittleFS.rename(kRdvTmp, kRdvFile)) {
+    Serial.println("[SYNC] rdv commit: rename failed");
+    LittleFS.remove(kRdvTmp);
+    return false;
+  }
+  gDirty = false;
+  return true;
+}
+
+bool rendezvousExpectedByMs(const char* nodeId, int32_t& expectedByMs) {
+  const RdvNodeRecord* r = findRecord(nodeId);
+  if (!r || r->count < kMinArrivals) return false;
+  if (r->misses > 0 &&
+      (r->misses <= kFullWindowMisses || r->misses % kReprobeEvery == 0)) {
+    return false;
+  }
+  int32_t slowest = INT16_MIN;
+  for (uint8_t i = 0; i < r->count; ++i) {
+    if (r->arrivalMs[i] > slowest) slowest = r->arrivalMs[i];
+  }
+  expectedByMs = slowest + kArrivalMarginMs;
+  return true;
+}
+
+uint8_t rendezvousPlanCohorts(uint8_t cohorts) {
+  if (cohorts < 1) cohorts = 1;
+  RdvNodeRecord* members[kRdvNodes];
+  uint8_t plan[kRdvNodes];
+  size_t n = 0;
+  uint8_t slots = cohorts;
+  for (const auto& node : registeredNodes) {
+    if (node.state != DEPLOYED) continue;
+    RdvNodeRecord* r = recordFor(node.nodeId.c_str());
+    if (!r) continue;
+    if (r->cohort >= cohorts && r->misses < kCohortQuietMisses &&
+        r->cohort + 1 > slots) {
+      slots = (uint8_t)(r->cohort + 1);
+    }
+    members[n] = r;
+    plan[n] = r->cohort;
+    ++n;
+  }
+  const size_t moved = sync_cohorts::rebalance(plan, n, cohorts);
+  memset(gCohortTarget, 0, sizeof(gCohortTarget));
+  for (size_t i = 0; i < n; ++i) gCohortTarget[members[i] - gRecords] = plan[i];
+  Serial.printf("[SYNC] cohorts=%u slots=%u: %u of %u node(s) to move\n",
+                (unsigned)cohorts, (unsigned)slots, (unsigned)moved, (unsigned)n);
+  return slots;
+}
+
+uint8_t rendezvousCohortOf(const char* nodeId) {
+  const RdvNodeRecord* r = findRecord(nodeId);
+  return r ? r->cohort : 0;
+}
+
+uint8_t rendezvousCohortTarget(const char* nodeId) {
+  const RdvNodeRecord* r = findRecord(nodeId);
+  return r ? gCohortTarget[r - gRecords] : 0;
+}
+
+void rendezvousCohortConfirm(const char* nodeId, uint8_t cohort) {
+  RdvNodeRecord* r = recordFor(nodeId);
+  if (!r || cohort >= sync_cohorts::kMaxCohorts || r->cohort == cohort) return;
+  r->cohort = cohort;
+  gDirty = true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ---------------------------------------------------------------------------
+// Per-node rendezvous arrival history
+// ---------------------------------------------------------------------------
+// Each coordinated sync window records, per deployed node, when its first
+// authenticated NODE_HELLO arrived relative to the sync slot (or that it did
+// not arrive at all). The last kRendezvousHistoryLen arrivals are kept in
+// LittleFS (/rdv.bin) so the next window can stop waiting for a node once its
+// usual arrival time has clearly passed, instead of holding the join phase
+// open for the fixed worst case. Rewritten at most once per wake.
+
+constexpr size_t kRendezvousHistoryLen = 8;
+
+// Load /rdv.bin and drop records for nodes no longer in the registry. Call
+// after loadPairedNodes(). A missing or corrupt file starts empty: every node
+// then holds the join phase open for the full window until it has history.
+bool rendezvousHistoryBegin();
+
+// First HELLO of this window from an authenticated node, `arrivalMs` after the
+// slot (negative when it beat the slot). RAM only until the commit.
+void rendezvousHistoryRecordArrival(const char* nodeId, int32_t arrivalMs);
+
+// The window closed without a HELLO from this deployed node.
+void rendezvousHistoryRecordMiss(const char* nodeId);
+
+// Write /rdv.bin if anything was recorded since the last commit.
+bool rendezvousHistoryCommit();
+
+// Latest the node is expected to join, in ms after the slot: the slowest of its
+// recent arrivals plus a margin. False when the join phase should wait the full
+// window for it — too little history, or it has just missed a window (so a
+// node whose timing moved gets a full-length window to be re-learned).
+bool rendezvousExpectedByMs(const char* nodeId, int32_t& expectedByMs);
+
+// ---------------------------------------------------------------------------
+// Sync cohorts (time/sync_cohorts.h)
+// ---------------------------------------------------------------------------
+// Each record also holds the cohort the node last confirmed with a
+// RELEASE_ACK, i.e. the slot it actually wakes for. 0 (the base phase) for a
+// node that was never moved, so histories written before cohorts need no
+// migration.
+
+// Rebalance the deployed fleet over `cohorts` slots, starting from the
+// confirmed cohorts, and keep the result as each node's target for this wake.
+// Returns how many slots the mothership has to visit: more than `cohorts`
+// while a node is still confirmed in a slot that has since been dropped (and
+// has not gone quiet there).
+uint8_t rendezvousPlanCohorts(uint8_t cohorts);
+
+// Where the node wakes now / where this wake's plan wants it. 0 when unknown.
+uint8_t rendezvousCohortOf(const char* nodeId);
+uint8_t rendezvousCohortTarget(const char* nodeId);
+
+// The node acknowledged a SYNC_RELEASE carrying `cohort`'s phase.
+void rendezvousCohortConfirm(const char* nodeId, uint8_t cohort);
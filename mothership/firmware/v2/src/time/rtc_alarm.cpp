@@ -102,8 +102,39 @@ uint32_t getRTCTime() {
   return now.unixtime();
 }
 
+static bool gEdgeValid = false;
+static uint32_t gEdgeUnix = 0;
+static uint32_t gEdgeMillis = 0;
+
+bool lockRTCSecondEdge() {
+  gEdgeValid = false;
+  if (!gRTCInitialized) return false;
+  uint8_t first = 0;
+  if (!readReg(0x00, first)) return false;
+  const uint32_t started = millis();
+  while ((uint32_t)(millis() - started) < 1100UL) {
+    uint8_t sec = 0;
+    if (!readReg(0x00, sec)) return false;
+    if (sec != first) {
+      gEdgeMillis = millis();
+      gEdgeUnix = gRTC.now().unixtime();  // same second for the next ~999 ms
+      gEdgeValid = true;
+      return true;
+    }
+    delayMicroseconds(500);
+  }
+  return false;
+}
+
+bool rtcMsClockValid() { return gEdgeValid; }
+
+int64_t rtcUnixMsAt(uint32_t millisValue) {
+  return (int64_t)gEdgeUnix * 1000LL + (int64_t)(int32_t)(millisValue - gEdgeMillis);
+}
+
 void setRTCTime(uint32_t unixTime) {
   if (!gRTCInitialized) return;
+  gEdgeValid = false;
   DateTime dt(static_cast<uint32_t>(unixTime));
   gRTC.adjust(dt);
   Serial.printf("[RTC] Time set to %04d-%02d-%02d %02d:%02d:%02d\n",
@@ -199,7 +230,7 @@ bool armNextSyncAlarm(int intervalMin) {
   return true;
 }
 
-bool armNextSyncAlarmPhase(int intervalMin, uint32_t phaseUnix) {
+bool armNextSyncAlarmPhase(int intervalMin, uint32_t phaseUnix, uint32_t* armedUnixOut) {
   if (!gRTCInitialized) return false;
 
   DateTime now = gRTC.now();
@@ -261,10 +292,54 @@ bool armNextSyncAlarmPhase(int intervalMin, uint32_t phaseUnix) {
   Serial.printf("[RTC] Alarm 1 armed for %04d-%02d-%02d %02d:%02d:%02d (phase-aligned, in %d sec)\n",
                 next.year(), next.month(), next.day(), next.hour(), next.minute(), next.second(),
                 (int)(nextSyncUnix - nowUnix));
+  if (armedUnixOut) *armedUnixOut = nextSyncUnix;
+  return true;
+}
+
+bool armAlarmAtUnix(uint32_t wakeUnix) {
+  if (!gRTCInitialized) return false;
+
+  const uint32_t nowUnix = gRTC.now().unixtime();
+  if (wakeUnix <= nowUnix) {
+    Serial.println("[RTC] Refusing to arm Alarm 1 in the past");
+    return false;
+  }
+  DateTime next(wakeUnix);
+
+  uint8_t ctrl = 0;
+  if (!readReg(0x0E, ctrl)) {
+    Serial.println("[RTC] Failed to read control register");
+    return false;
+  }
+  ctrl |= 0x04;  // INTCN=1
+  ctrl |= 0x01;  // A1IE=1
+  if (!writeReg(0x0E, ctrl)) {
+    Serial.println("[RTC] Failed to write control register");
+    return false;
+  }
+
+  if (!writeAlarm1Exact(next)) {
+    Serial.println("[RTC] Failed to write Alarm 1 registers");
+    return false;
+  }
+
+  if (!verifyAlarmSet(next)) {
+    Serial.println("[RTC] Alarm 1 read-back verification failed");
+    return false;
+  }
+
+  if (!clearAlarmFlag()) {
+    Serial.println("[RTC] Failed to clear alarm flag after verification");
+    return false;
+  }
+
+  Serial.printf("[RTC] Alarm 1 armed for %04d-%02d-%02d %02d:%02d:%02d (in %d sec)\n",
+                next.year(), next.month(), next.day(), next.hour(), next.minute(), next.second(),
+                (int)(wakeUnix - nowUnix));
   return true;
 }
 
-bool armDailyAlarm(int hour, int minute) {
+bool armDailyAlarm(int hour, int minute, uint32_t* armedUnixOut) {
   if (!gRTCInitialized) return false;
 
   DateTime now = gRTC.now();
@@ -298,6 +373,7 @@ bool armDailyAlarm(int hour, int minute) {
   }
 
   Serial.printf("[RTC] Daily alarm armed for %02d:%02d\n", hour, minute);
+  if (armedUnixOut) *armedUnixOut = alarmTime.unixtime();
   return true;
 }
 
@@ -17,10 +17,24 @@ RtcInitStatus initRTC();
 bool rtcTimeValid();
 uint32_t getRTCTime();
 void setRTCTime(uint32_t unixTime);
+
+// Millisecond view of the RTC for the node clock exchange (CLOCK_PROBE). The
+// DS3231 only reads out whole seconds, so lockRTCSecondEdge() waits (<= 1.1 s)
+// for the seconds register to tick and pins that instant to millis();
+// rtcUnixMsAt() extrapolates from it on the ESP32 crystal, which is good to a
+// millisecond or two over one sync window. setRTCTime() drops the lock.
+bool lockRTCSecondEdge();
+bool rtcMsClockValid();
+int64_t rtcUnixMsAt(uint32_t millisValue);
 bool armRescueAlarm(int intervalMin);
 bool armNextSyncAlarm(int intervalMin);
-bool armNextSyncAlarmPhase(int intervalMin, uint32_t phaseUnix);
-bool armDailyAlarm(int hour, int minute);
+// armedUnixOut, when given, receives the wake time actually programmed (the
+// sync alarms include their pre-wake).
+bool armNextSyncAlarmPhase(int intervalMin, uint32_t phaseUnix,
+                           uint32_t* armedUnixOut = nullptr);
+bool armDailyAlarm(int hour, int minute, uint32_t* armedUnixOut = nullptr);
+// Alarm 1 at an exact unix second (listen windows, re-arming a saved sync wake).
+bool armAlarmAtUnix(uint32_t wakeUnix);
 bool clearAlarmFlag();
 void disableAlarmInterrupt();
 bool readAlarmFlag();
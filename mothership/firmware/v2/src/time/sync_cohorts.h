@@ -0,0 +1,114 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Sync cohorts: the deployed fleet split over several sync slots.
+//
+// Pure arithmetic — no Arduino — so the firmware and the native host
+// simulation (tests/test_sync_cohort_sim.cpp) run the same code.
+//
+// With one shared sync phase every node joins the same radio session, so the
+// rendezvous and the grant schedule grow with the fleet. Instead cohort c
+// meets the mothership at basePhase + c * kCohortSpacingSec, every sync
+// interval. The mothership wakes once per cohort slot and uploads on the last
+// one. Nodes learn their cohort's phase from SYNC_RELEASE, so node firmware
+// needs no notion of cohorts at all.
+//
+// Cohort 0 is the base phase itself, which is where every node that has never
+// been moved already is.
+
+namespace sync_cohorts {
+
+// Nodes per session the planner aims for before it opens another cohort.
+constexpr size_t kTargetNodesPerCohort = 24;
+constexpr uint8_t kMaxCohorts = 8;
+
+// Slots are whole minutes apart (node sync alarms are minute-resolution) and
+// leave room for a full-length session, the commit and the mothership's
+// 10 s pre-roll before the next slot.
+constexpr uint32_t kCohortSpacingSec = 180;
+
+// All cohort slots sit in the first half of the interval, so the upload after
+// the last one is done well before cohort 0 comes round again.
+inline uint8_t cohortCount(size_t deployedNodes, uint32_t syncIntervalMin) {
+  if (syncIntervalMin == 0 || deployedNodes <= kTargetNodesPerCohort) return 1;
+  size_t want = (deployedNodes + kTargetNodesPerCohort - 1) / kTargetNodesPerCohort;
+  size_t fit = (syncIntervalMin * 60UL / 2UL) / kCohortSpacingSec;
+  if (fit < 1) fit = 1;
+  if (want > fit) want = fit;
+  if (want > kMaxCohorts) want = kMaxCohorts;
+  return (uint8_t)want;
+}
+
+inline uint32_t cohortPhase(uint32_t basePhase, uint8_t cohort) {
+  return basePhase + (uint32_t)cohort * kCohortSpacingSec;
+}
+
+// Which cohort's slot is nearest to nowUnix (the mothership wakes a few
+// seconds before it). Slots past the last cohort read as the last cohort.
+inline uint8_t cohortAt(uint32_t nowUnix, uint32_t basePhase,
+                        uint32_t syncIntervalMin, uint8_t count) {
+  if (count <= 1 || syncIntervalMin == 0 || nowUnix < basePhase) return 0;
+  const uint32_t period = syncIntervalMin * 60UL;
+  const uint32_t intoPeriod = (nowUnix - basePhase) % period;
+  // Just before the base slot is cohort 0 of the next period.
+  if (intoPeriod > period - kCohortSpacingSec / 2) return 0;
+  uint32_t c = (intoPeriod + kCohortSpacingSec / 2) / kCohortSpacingSec;
+  if (c >= count) c = count - 1;
+  return (uint8_t)c;
+}
+
+// Rebalance in place: cohort[i] is where node i meets the mothership now
+// (anything >= count has to move). Afterwards cohort sizes differ by at most
+// one, and only as many nodes as that needs have moved: the cohorts that are
+// already largest keep the extra node. Returns the number of nodes moved.
+inline size_t rebalance(uint8_t* cohort, size_t nodes, uint8_t count) {
+  if (!cohort || nodes == 0) return 0;
+  if (count < 1) count = 1;
+  if (count > kMaxCohorts) count = kMaxCohorts;
+
+  size_t size[kMaxCohorts] = {0};
+  for (size_t i = 0; i < nodes; ++i) {
+    if (cohort[i] < count) size[cohort[i]]++;
+  }
+  // Quota: floor for all, +1 for the `extra` currently largest cohorts.
+  const size_t floorQuota = nodes / count;
+  size_t extra = nodes % count;
+  size_t quota[kMaxCohorts] = {0};
+  bool gotExtra[kMaxCohorts] = {false};
+  for (uint8_t c = 0; c < count; ++c) quota[c] = floorQuota;
+  while (extra > 0) {
+    uint8_t best = kMaxCohorts;
+    for (uint8_t c = 0; c < count; ++c) {
+      if (gotExtra[c]) continue;
+      if (best == kMaxCohorts || size[c] > size[best]) best = c;
+    }
+    gotExtra[best] = true;
+    quota[best]++;
+    extra--;
+  }
+
+  // Evict from the back of over-quota cohorts, then fill the gaps in order.
+  size_t kept[kMaxCohorts] = {0};
+  size_t moved = 0;
+  for (size_t i = 0; i < nodes; ++i) {
+    const uint8_t c = cohort[i];
+    if (c < count && kept[c] < quota[c]) {
+      kept[c]++;
+      continue;
+    }
+    cohort[i] = 0xFF;
+  }
+  uint8_t fill = 0;
+  for (size_t i = 0; i < nodes; ++i) {
+    if (cohort[i] != 0xFF) continue;
+    while (kept[fill] >= quota[fill]) fill++;
+    cohort[i] = fill;
+    kept[fill]++;
+    moved++;
+  }
+  return moved;
+}
+
+}  // namespace sync_cohorts
@@ -16,11 +16,12 @@
 #include "config/node_registry.h"
 #include "config/deployment_store.h"
 #include "config/deployment_epoch.h"
+#include "storage/flash_logger.h"
 
 // ---------------------------------------------------------------------------
 // Fake node_registry
 // ---------------------------------------------------------------------------
-std::vector<NodeInfo> registeredNodes;
+NodeRegistry registeredNodes;
 
 struct MetaEntry { String nodeId, userId, name; };
 static std::vector<MetaEntry> gMeta;
@@ -184,6 +185,7 @@ static void resetAll() {
   LittleFS.remove("/deploy.bin");
   LittleFS.remove("/deploy.bak");
   LittleFS.remove("/deploy.tmp");
+  LittleFS.remove("/deploy.jnl");
   LittleFS.remove("/deploy.v1");
   LittleFS.remove("/deploy.v1.tmp");
   deploymentStoreBegin();
@@ -296,6 +298,71 @@ static void testInTransitKeepsOldEpoch() {
         resolveEpochForSample("ENV_A1", inTransit) == 1);
 }
 
+// resolveEpochForSample() memoises the matched interval per node. The cache must
+// never outlive a Start, must keep counting clamped attributions on a hit, and
+// must make a backlog drain cheaper than resolving from scratch each time.
+static void testEpochResolutionCache() {
+  resetAll();
+  addNode("ENV_A1", 0x01, DEPLOYED);
+  addNode("ENV_A2", 0x02, DEPLOYED);
+  beginNewDeployment("ENV_A1", "001", "A", NAN, NAN, 0);
+  beginNewDeployment("ENV_A2", "002", "B", NAN, NAN, 0);
+  const uint32_t epoch1Sample = gFakeNow + 60;
+  gFakeNow += 86400; endDeployment("ENV_A1", 1);
+  gFakeNow += 3600;  beginNewDeployment("ENV_A1", "003", "C", NAN, NAN, 1);
+
+  check("cache: epoch-1 sample resolves to 1",
+        resolveEpochForSample("ENV_A1", epoch1Sample) == 1);
+  check("cache: a second epoch-1 sample hits the same answer",
+        resolveEpochForSample("ENV_A1", epoch1Sample + 1) == 1);
+  check("cache: a sample past the next boundary is not served from the cache",
+        resolveEpochForSample("ENV_A1", gFakeNow + 60) == 2);
+  check("cache: another node keeps its own answer",
+        resolveEpochForSample("ENV_A2", gFakeNow + 60) == 1);
+
+  const uint32_t clampsBefore = deploymentEpochClampCount();
+  const uint32_t preHistory = 1752000000UL;   // plausible, before every boundary
+  resolveEpochForSample("ENV_A1", preHistory);
+  resolveEpochForSample("ENV_A1", preHistory + 1);
+  check("cache: a cached clamp still counts as a clamp",
+        deploymentEpochClampCount() == clampsBefore + 2);
+
+  const uint32_t beforeRestart = gFakeNow + 120;
+  check("cache: warm before the redeploy",
+        resolveEpochForSample("ENV_A1", beforeRestart) == 2);
+  gFakeNow += 86400; endDeployment("ENV_A1", 2);
+  gFakeNow += 3600;  beginNewDeployment("ENV_A1", "004", "D", NAN, NAN, 2);
+  check("cache: a Start invalidates the cached interval",
+        resolveEpochForSample("ENV_A1", gFakeNow + 60) == 3);
+  check("cache: the old interval is still exact after invalidation",
+        resolveEpochForSample("ENV_A1", beforeRestart) == 2);
+
+  DecodedSnapshot snap{};
+  strncpy(snap.nodeId, "ENV_A1", sizeof(snap.nodeId));
+  snap.nodeTimestamp = epoch1Sample;
+  stampDeploymentEpoch(snap);
+  check("cache: stampDeploymentEpoch stamps in place", snap.deploymentEpoch == 1);
+
+  // A backlog drain: consecutive samples one minute apart, all inside the
+  // current deployment, once from the cache and once with a miss forced on
+  // every record.
+  const int kRecords = 2000;
+  uint32_t sink = 0;
+  for (int i = 0; i < kRecords; ++i) {
+    snap.nodeTimestamp = gFakeNow + 60U * (uint32_t)i;
+    stampDeploymentEpoch(snap);
+    sink += snap.deploymentEpoch;
+  }
+  for (int i = 0; i < kRecords; ++i) {
+    deploymentSlotFor(nullptr, "ENV_A1");   // bumps the revision: forces a miss
+    snap.nodeTimestamp = gFakeNow + 60U * (uint32_t)i;
+    stampDeploymentEpoch(snap);
+    sink += snap.deploymentEpoch;
+  }
+  check("cache: drain stamped every record with the current epoch",
+        sink == 3U * 2U * kRecords);
+}
+
 static void testStopStartDoesNotChangeEpoch() {
   resetAll();
   addNode("ENV_A1", 0x01, DEPLOYED);
@@ -1124,6 +1191,80 @@ static void testTornWriteRecovery() {
   check("torn write: a stray temp file is ignored", epochOf("ENV_A1") == 1);
 }
 
+static size_t fileSize(const char* path) {
+  if (!LittleFS.exists(path)) return 0;
+  File f = LittleFS.open(path, "r");
+  const size_t n = f ? f.size() : 0;
+  if (f) f.close();
+  return n;
+}
+
+// Commits append only the entries they changed to /deploy.jnl; the base record
+// is rewritten only at compaction, and a torn journal frame is dropped whole.
+static void testJournalCommitsAreIncremental() {
+  resetAll();
+  addNode("ENV_A1", 0x01, DEPLOYED);
+  addNode("ENV_A2", 0x02, DEPLOYED);
+  const size_t baseSize = fileSize("/deploy.bin");
+
+  beginNewDeployment("ENV_A1", "001", "A", NAN, NAN, 0);
+  const size_t afterStart = fileSize("/deploy.jnl");
+  check("journal: Start appended a frame", afterStart > 0);
+  check("journal: the frame is a fraction of the full record",
+        afterStart > 0 && afterStart * 4 < baseSize);
+  check("journal: the base record was not rewritten",
+        fileSize("/deploy.bin") == baseSize);
+
+  check("journal: a commit with no changes writes nothing",
+        deploymentStoreCommit() && fileSize("/deploy.jnl") == afterStart);
+
+  gFakeNow += 60;
+  beginNewDeployment("ENV_A2", "002", "B", NAN, NAN, 0);
+  const size_t afterSecond = fileSize("/deploy.jnl");
+  check("journal: a second Start adds about one more frame",
+        afterSecond > afterStart && afterSecond - afterStart < afterStart * 2);
+
+  deploymentStoreResetForTest();
+  deploymentStoreBegin();
+  check("journal: both Starts replay after a reboot",
+        epochOf("ENV_A1") == 1 && epochOf("ENV_A2") == 1 &&
+        deploymentOutboxCount() == 2);
+
+  // A frame cut short by power loss: only its first bytes reached flash.
+  {
+    File f = LittleFS.open("/deploy.jnl", "a");
+    if (f) {
+      const uint8_t partial[] = {0x4D, 0x44, 0x50, 0x4A, 0x99, 0x00};
+      f.write(partial, sizeof(partial));
+      f.close();
+    }
+  }
+  deploymentStoreResetForTest();
+  check("journal: a torn tail does not stop the store opening", deploymentStoreBegin());
+  check("journal: frames before the torn tail still apply",
+        epochOf("ENV_A1") == 1 && epochOf("ENV_A2") == 1);
+  check("journal: the torn tail is compacted away",
+        fileSize("/deploy.jnl") == 0 && fileSize("/deploy.bin") == baseSize);
+
+  // Enough transitions to cross the compaction threshold.
+  for (int i = 0; i < 12; ++i) {
+    gFakeNow += 3600;
+    endDeployment("ENV_A1", epochOf("ENV_A1"));
+    acknowledgeWholeOutbox();
+    gFakeNow += 60;
+    char num[4];
+    snprintf(num, sizeof(num), "%03d", 10 + i);
+    beginNewDeployment("ENV_A1", num, "A", NAN, NAN, epochOf("ENV_A1"));
+    acknowledgeWholeOutbox();
+  }
+  check("journal: compaction keeps the journal bounded",
+        fileSize("/deploy.jnl") <= baseSize / 2);
+  deploymentStoreResetForTest();
+  deploymentStoreBegin();
+  check("journal: state after compaction survives a reboot",
+        epochOf("ENV_A1") == 13 && epochOf("ENV_A2") == 1);
+}
+
 static void testLegacyBacklogBlocksStart() {
   resetAll();
   addNode("ENV_A1", 0x01, DEPLOYED);
@@ -1366,6 +1507,7 @@ void setup() {
   testEpoch1SampleDuringEpoch3();
   testImplausibleClockDoesNotDecrement();
   testInTransitKeepsOldEpoch();
+  testEpochResolutionCache();
   testStopStartDoesNotChangeEpoch();
   testEditingIdentityDoesNotChangeEpoch();
   testNumberGuard();
@@ -1393,6 +1535,7 @@ void setup() {
   testOutboxAckClearsOnlyMatching();
   testSurvivesReboot();
   testTornWriteRecovery();
+  testJournalCommitsAreIncremental();
   testLegacyBacklogBlocksStart();
   testEpochOverflowRejected();
   testStartRejectedOnEndedViaPlainStart();
@@ -0,0 +1,331 @@
+// Link-quality upload planner — native host simulation.
+//
+// Replays recorded link traces (per-wake RSRP / RSRQ / RSSI / registration
+// time, as ModemDriver::getDiagnostics() reports them) through
+// comms/link_planner.h (the code the upload session uses) and through
+// the old always-send-everything policy, with a simple cost model of the
+// upload session:
+//   - every wake registers (regMs) and sends status plus the freshest rows;
+//   - a bulk transfer sends the backlog in 32 KB bodies at a rate set by the
+//     link score, until the session budget runs out;
+//   - on a poor link each POST may time out (30 s) and end the session.
+// Compares modem on-time per delivered KB, and checks the backlog stays
+// bounded (the planner never starves a hub). No Arduino, no modem:
+//
+//   pio run -e mothership-v2-test-link-planner-sim -t exec
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "comms/link_planner.h"
+#include "native_check.h"
+
+using namespace link_planner;
+
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+};
+
+// ---------------------------------------------------------------------------
+// Scoring
+// ---------------------------------------------------------------------------
+
+static void testScoring() {
+  printf("\n--- scoring ---\n");
+  const uint8_t strong = scoreLink({-63, -82, -7, kTechLte, 8000});
+  const uint8_t fair   = scoreLink({-85, -105, -12, kTechLte, 12000});
+  const uint8_t edge   = scoreLink({-101, -121, -18, kTechLte, 25000});
+  const uint8_t slow   = scoreLink({-85, -105, -12, kTechLte, 45000});
+  const uint8_t gsm    = scoreLink({-65, 0, 0, kTechGsm, 9000});
+  const uint8_t none   = scoreLink({0, 0, 0, kTechUnknown, 60000});
+  printf("  strong %u, fair %u, cell edge %u, slow-register %u, 2G %u, unknown %u\n",
+         strong, fair, edge, slow, gsm, none);
+  check(strong >= kGoodScore && edge < kPoorScore, "score: strong LTE is good, cell edge is poor");
+  check(fair >= kPoorScore && fair < kGoodScore, "score: mid-range LTE lands in the history band");
+  check(slow < fair, "score: a slow registration costs score");
+  check(gsm <= kPoorScore + 10, "score: 2G is capped whatever its RSSI");
+  check(none == 0, "score: no measurements score 0");
+}
+
+// ---------------------------------------------------------------------------
+// Recorded traces
+// ---------------------------------------------------------------------------
+
+// One wake as recorded by the hub.
+struct TraceWake {
+  int16_t  rssi;
+  int16_t  rsrp;
+  int8_t   rsrq;
+  uint8_t  tech;
+  uint32_t regMs;   // 0 = never registered
+};
+
+// Hilltop site: a ridge fades the LTE cell through the afternoon (two wakes of
+// 2.5 h a day in the shadow, the rest fine). 96 wakes, 15 min apart, repeated.
+static std::vector<TraceWake> traceFadingRidge() {
+  std::vector<TraceWake> t;
+  for (int day = 0; day < 4; ++day) {
+    for (int w = 0; w < 96; ++w) {
+      const bool shadow = w >= 52 && w < 72;
+      const bool edge = w == 50 || w == 51 || w == 72 || w == 73;
+      if (shadow)      t.push_back({-103, -122, -17, kTechLte, 28000u + (w % 5) * 4000u});
+      else if (edge)   t.push_back({-92,  -110, -14, kTechLte, 18000});
+      else             t.push_back({-74,  -92,  -9,  kTechLte, 9000u + (w % 3) * 1000u});
+    }
+  }
+  return t;
+}
+
+// Marginal cell all day: nothing better will come, so deferring buys nothing.
+static std::vector<TraceWake> traceMarginal() {
+  std::vector<TraceWake> t;
+  for (int w = 0; w < 288; ++w) t.push_back({-95, -112, -14, kTechLte, 20000u + (w % 4) * 3000u});
+  return t;
+}
+
+static std::vector<TraceWake> traceGoodSite() {
+  std::vector<TraceWake> t;
+  for (int w = 0; w < 288; ++w) t.push_back({-70, -88, -8, kTechLte, 8000u + (w % 3) * 1000u});
+  return t;
+}
+
+// A hub under a cell that only offers 2G.
+static std::vector<TraceWake> traceGsmOnly() {
+  std::vector<TraceWake> t;
+  for (int w = 0; w < 288; ++w) t.push_back({-79, 0, 0, kTechGsm, 15000});
+  return t;
+}
+
+// Deep shadow for a week: never better than poor.
+static std::vector<TraceWake> traceDeepShadow() {
+  std::vector<TraceWake> t;
+  for (int w = 0; w < 96 * 3; ++w) t.push_back({-105, -123, -19, kTechLte, 35000});
+  return t;
+}
+
+// ---------------------------------------------------------------------------
+// Session cost model
+// ---------------------------------------------------------------------------
+
+constexpr uint32_t kSessionBudgetMs = 300000;
+constexpr uint32_t kBodyBytes = 32768;        // one JSON body
+constexpr uint32_t kPostTimeoutMs = 30000;
+constexpr uint32_t kFixedMs = 15000;          // power-on, NETOPEN, NTP, status
+constexpr uint32_t kFreshBytes = 8192;        // the fresh lane's one body of CSV
+constexpr uint32_t kBytesPerWake = 20000;     // CSV rows arriving every 15 min
+
+// Body throughput and per-POST failure odds by score.
+static uint32_t bytesPerSec(uint8_t score) { return 150 + score * 40; }
+static uint32_t failPct(uint8_t score) { return score >= 45 ? 2 : score >= 30 ? 20 : 55; }
+
+struct WakeResult {
+  uint32_t onMs;
+  uint32_t delivered;
+  bool failed;
+};
+
+// One POST: true if accepted; charges the modem time.
+static bool post(uint32_t bytes, uint8_t score, Rng& rng, uint32_t& onMs) {
+  if (rng.next() % 100 < failPct(score)) { onMs += kPostTimeoutMs; return false; }
+  onMs += 1500 + bytes * 1000 / bytesPerSec(score);
+  return true;
+}
+
+static WakeResult runWake(const TraceWake& tw, uint8_t score, bool bulk,
+                          uint32_t& backlog, Rng& rng) {
+  WakeResult r{kFixedMs + tw.regMs, 0, false};
+  // Fresh lane: status plus the newest rows, one small body.
+  const uint32_t fresh = std::min<uint32_t>(backlog, kFreshBytes);
+  if (!post(fresh + 1024, score, rng, r.onMs)) { r.failed = true; return r; }
+  r.delivered += fresh;
+  backlog -= fresh;   // approximation: the fresh lane drains the backlog's tail
+  if (!bulk) return r;
+  while (backlog > 0 && r.onMs < kSessionBudgetMs) {
+    const uint32_t n = std::min(backlog, kBodyBytes);
+    if (!post(n, score, rng, r.onMs)) { r.failed = r.delivered == 0; break; }
+    r.delivered += n;
+    backlog -= n;
+  }
+  return r;
+}
+
+struct RunResult {
+  uint64_t onMs;
+  uint64_t delivered;
+  uint32_t maxBacklog;
+  uint32_t endBacklog;
+  uint32_t deferred;
+  uint32_t maxDeferredRun;
+  uint32_t otaWake;     // wake the staged OTA was allowed on, or UINT32_MAX
+  uint32_t msPerKb() const { return delivered ? (uint32_t)(onMs * 1024 / delivered) : 0; }
+};
+
+static RunResult run(const std::vector<TraceWake>& trace, bool usePlanner,
+                     uint32_t seed, uint32_t otaFromWake = UINT32_MAX) {
+  RunResult res{0, 0, 0, 0, 0, 0, UINT32_MAX};
+  History h{};
+  Rng rng{seed};
+  uint32_t backlog = 64 * 1024;   // a hub that has been out of coverage
+  uint32_t run = 0;
+  for (uint32_t i = 0; i < trace.size(); ++i) {
+    const TraceWake& tw = trace[i];
+    backlog += kBytesPerWake;
+    res.maxBacklog = std::max(res.maxBacklog, backlog);
+    const bool otaPending = i >= otaFromWake && res.otaWake == UINT32_MAX;
+    const LinkSample s{tw.rssi, tw.rsrp, tw.rsrq, tw.tech, tw.regMs};
+    const uint8_t score = scoreLink(s);
+    Decision d{kPlanFull, kReasonGoodLink, otaPending};
+    if (usePlanner) {
+      d = decide(h, {score, backlog, (uint8_t)std::min<uint32_t>(100, backlog / 20000), otaPending});
+    }
+    if (d.allowOta && res.otaWake == UINT32_MAX) res.otaWake = i;
+    const WakeResult w = runWake(tw, score, d.plan == kPlanFull, backlog, rng);
+    res.onMs += w.onMs;
+    res.delivered += w.delivered;
+    if (d.plan == kPlanFreshOnly) { ++res.deferred; ++run; } else { run = 0; }
+    res.maxDeferredRun = std::max(res.maxDeferredRun, run);
+    uint8_t flags = 0;
+    if (d.plan == kPlanFreshOnly) flags |= kWakeDeferred;
+    if (w.failed) flags |= kWakeFailed;
+    finishWake(h, d, otaPending, {score, flags, (uint16_t)(w.onMs / 1000), w.delivered});
+  }
+  res.endBacklog = backlog;
+  return res;
+}
+
+static void report(const char* name, const RunResult& full, const RunResult& plan) {
+  printf("\n--- trace: %s ---\n", name);
+  printf("  always full : %7.1f min on, %7.1f KB, %5u ms/KB, max backlog %5.1f KB\n",
+         full.onMs / 60000.0, full.delivered / 1024.0, full.msPerKb(), full.maxBacklog / 1024.0);
+  printf("  planner     : %7.1f min on, %7.1f KB, %5u ms/KB, max backlog %5.1f KB, "
+         "%u deferred (longest run %u)\n",
+         plan.onMs / 60000.0, plan.delivered / 1024.0, plan.msPerKb(), plan.maxBacklog / 1024.0,
+         plan.deferred, plan.maxDeferredRun);
+}
+
+static void testTraces() {
+  {
+    const auto t = traceFadingRidge();
+    const RunResult full = run(t, false, 7), plan = run(t, true, 7);
+    report("fading ridge (4 days)", full, plan);
+    check(plan.msPerKb() * 10 < full.msPerKb() * 9,
+          "ridge: planner spends 10%+ less modem time per delivered KB");
+    check(plan.onMs < full.onMs, "ridge: planner spends less modem time overall");
+    check(plan.deferred > 0 && plan.maxDeferredRun <= kMaxDeferredWakes,
+          "ridge: backlog deferred in the shadow, never past the starvation bound");
+    check(plan.endBacklog <= full.endBacklog + kBodyBytes,
+          "ridge: backlog at the end no worse than always-full (one body)");
+  }
+  {
+    const auto t = traceGoodSite();
+    const RunResult full = run(t, false, 11), plan = run(t, true, 11);
+    report("good site", full, plan);
+    check(plan.deferred == 0 && plan.onMs == full.onMs,
+          "good site: planner changes nothing");
+  }
+  {
+    const auto t = traceMarginal();
+    const RunResult full = run(t, false, 13), plan = run(t, true, 13);
+    report("marginal cell all day", full, plan);
+    check(plan.endBacklog <= full.endBacklog + kBodyBytes && plan.maxDeferredRun <= kMaxDeferredWakes,
+          "marginal: nothing better comes, the backlog still drains");
+  }
+  {
+    const auto t = traceGsmOnly();
+    const RunResult full = run(t, false, 17), plan = run(t, true, 17);
+    report("2G only", full, plan);
+    check(plan.deferred == 0, "2G only: no better wake on record, never deferred");
+  }
+  {
+    const auto t = traceDeepShadow();
+    const RunResult full = run(t, false, 19), plan = run(t, true, 19);
+    report("deep shadow (3 days)", full, plan);
+    check(plan.maxDeferredRun <= kMaxDeferredWakes,
+          "shadow: poor link every wake, the backlog still goes every 7th wake");
+    // Neither policy keeps up with this link; the planner must not fall far
+    // behind the old one while it saves modem time.
+    check(plan.delivered * 5 >= full.delivered * 4 && plan.onMs < full.onMs,
+          "shadow: 80%+ of always-full's delivery for less modem time");
+  }
+  {
+    // A release staged just as the ridge shadow starts.
+    const auto t = traceFadingRidge();
+    const RunResult plan = run(t, true, 23, 53);
+    const TraceWake& w = t[plan.otaWake < t.size() ? plan.otaWake : 0];
+    const uint8_t score = scoreLink({w.rssi, w.rsrp, w.rsrq, w.tech, w.regMs});
+    printf("  OTA staged at wake 53, downloaded at wake %u (score %u)\n",
+           (unsigned)plan.otaWake, score);
+    check(plan.otaWake > 53 && plan.otaWake < 53 + kMaxOtaDeferredWakes + 8 && score >= kOtaMinScore,
+          "ridge: staged OTA waits out the shadow, then goes on a good wake");
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Deferral bounds and OTA gating
+// ---------------------------------------------------------------------------
+
+static void testBounds() {
+  printf("\n--- bounds ---\n");
+  History h{};
+  const Inputs poor{10, 200000, 20, true};
+  Decision d = decide(h, poor);
+  check(d.plan == kPlanFreshOnly && d.reason == kReasonPoorLink && !d.allowOta,
+        "bounds: poor link, big backlog -> fresh only, no OTA");
+  check(decide(h, {10, 8000, 20, false}).reason == kReasonSmallBacklog,
+        "bounds: small backlog is sent anyway");
+  check(decide(h, {10, 200000, 60, false}).reason == kReasonFlashPressure,
+        "bounds: flash pressure overrides the deferral");
+  for (uint8_t i = 0; i < kMaxDeferredWakes; ++i) {
+    d = decide(h, poor);
+    finishWake(h, d, true, {10, kWakeDeferred, 40, 8000});
+  }
+  d = decide(h, poor);
+  check(d.plan == kPlanFull && d.reason == kReasonDeferredTooLong,
+        "bounds: kMaxDeferredWakes in a row forces the backlog");
+  finishWake(h, d, true, {10, 0, 200, 90000});
+  check(h.deferredWakes == 0, "bounds: a full wake resets the streak");
+  bool otaHeld = true;
+  while (h.otaDeferredWakes < kMaxOtaDeferredWakes) {
+    d = decide(h, poor);
+    otaHeld = otaHeld && !d.allowOta;
+    finishWake(h, d, true, {10, 0, 40, 8000});
+  }
+  check(otaHeld, "bounds: OTA held on a poor link, even on forced full wakes");
+  check(decide(h, poor).allowOta, "bounds: OTA goes after kMaxOtaDeferredWakes whatever the link");
+
+  // Mid band: history decides.
+  History mid{};
+  for (int i = 0; i < 3; ++i) record(mid, {80, 0, 90, 200000});
+  record(mid, {35, kWakeFailed, 240, 0});
+  record(mid, {38, kWakeFailed, 240, 0});
+  check(decide(mid, {36, 200000, 20, false}).reason == kReasonHistoryFails,
+        "history: wakes at this score failed, better ones exist -> defer");
+  History noBetter{};
+  record(noBetter, {35, kWakeFailed, 240, 0});
+  record(noBetter, {38, kWakeFailed, 240, 0});
+  check(decide(noBetter, {36, 200000, 20, false}).plan == kPlanFull,
+        "history: no better wake on record -> send anyway");
+  History costly{};
+  record(costly, {85, 0, 60, 300000});
+  record(costly, {40, 0, 280, 40000});
+  check(decide(costly, {40, 200000, 20, false}).reason == kReasonHistoryCostly,
+        "history: 3x the modem time per KB of better wakes -> defer");
+  check(msPerKb(costly) == (uint32_t)((340ULL * 1000 * 1024) / 340000),
+        "history: modem on-time per KB over the ring");
+}
+
+int main() {
+  printf("=== link planner simulation ===\n");
+  testScoring();
+  testTraces();
+  testBounds();
+  return checkSummary();
+}
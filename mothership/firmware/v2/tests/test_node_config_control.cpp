@@ -6,7 +6,7 @@
 
 // Minimal fake registry for the production node_config_control.cpp. This test
 // isolates convergence behavior without touching the deployed registry NVS.
-std::vector<NodeInfo> registeredNodes;
+NodeRegistry registeredNodes;
 
 namespace {
 
@@ -194,6 +194,73 @@ void runSuite() {
         gDesired[0].config.targetState == 0 &&
         gDesired[1].config.targetState == 0);
 
+  // Aggregation mode is a local-only override like the sync schedule: setting
+  // it issues a new wire version, and a later change that does not carry the
+  // override must leave it in place.
+  resetFixture(7, 2, false, 7, false);
+  NodeConfigApplyOptions aggOptions{};
+  aggOptions.overrideAggregation = true;
+  aggOptions.aggSamplesPerReport = 6;
+  aggOptions.aggStatsMask = 0x0013;
+  NodeConfigApplyResult aggOn = controlApplyLocalNodeConfig(
+      "ENV_D13F98", 20, 2, 37, aggOptions);
+  check("aggregation override persists under a new wire version",
+        aggOn.durable && aggOn.registryApplied &&
+        gDesired[0].config.configVersion == 8 &&
+        gDesired[0].config.aggSamplesPerReport == 6 &&
+        gDesired[0].config.aggStatsMask == 0x0013);
+  NodeConfigApplyResult wakeOnly = controlApplyLocalNodeConfig(
+      "ENV_D13F98", 10, 2, 37);
+  check("a later wake change keeps the aggregation setting",
+        wakeOnly.durable && wakeOnly.registryApplied &&
+        gDesired[0].config.wakeIntervalMin == 10 &&
+        gDesired[0].config.aggSamplesPerReport == 6 &&
+        gDesired[0].config.aggStatsMask == 0x0013);
+
+  // Report-by-exception rides the same local-only override rule.
+  NodeConfigApplyOptions rbeOptions{};
+  rbeOptions.overrideRbe = true;
+  rbeOptions.rbeMaxSilenceMin = 60;
+  rbeOptions.rbeDeadbandTenths = 15;
+  NodeConfigApplyResult rbeOn = controlApplyLocalNodeConfig(
+      "ENV_D13F98", 10, 2, 37, rbeOptions);
+  check("report-by-exception override persists under a new wire version",
+        rbeOn.durable && rbeOn.registryApplied &&
+        gDesired[0].config.configVersion == 10 &&
+        gDesired[0].config.rbeMaxSilenceMin == 60 &&
+        gDesired[0].config.rbeDeadbandTenths == 15 &&
+        gDesired[0].config.aggSamplesPerReport == 6);
+  NodeConfigApplyResult rbeWakeOnly = controlApplyLocalNodeConfig(
+      "ENV_D13F98", 5, 2, 37);
+  check("a later wake change keeps the report-by-exception setting",
+        rbeWakeOnly.durable && rbeWakeOnly.registryApplied &&
+        gDesired[0].config.wakeIntervalMin == 5 &&
+        gDesired[0].config.rbeMaxSilenceMin == 60 &&
+        gDesired[0].config.rbeDeadbandTenths == 15);
+
+  // Urgent thresholds too.
+  NodeConfigApplyOptions urgentOptions{};
+  urgentOptions.overrideUrgent = true;
+  urgentOptions.urgentFlags = 0x03;
+  urgentOptions.urgentAirBelowCenti = -50;
+  urgentOptions.urgentSoilAboveMv = 2200;
+  NodeConfigApplyResult urgentOn = controlApplyLocalNodeConfig(
+      "ENV_D13F98", 5, 2, 37, urgentOptions);
+  check("urgent-threshold override persists under a new wire version",
+        urgentOn.durable && urgentOn.registryApplied &&
+        gDesired[0].config.configVersion == 12 &&
+        gDesired[0].config.urgentFlags == 0x03 &&
+        gDesired[0].config.urgentAirBelowCenti == -50 &&
+        gDesired[0].config.urgentSoilAboveMv == 2200 &&
+        gDesired[0].config.rbeMaxSilenceMin == 60);
+  NodeConfigApplyResult urgentWakeOnly = controlApplyLocalNodeConfig(
+      "ENV_D13F98", 10, 2, 37);
+  check("a later wake change keeps the urgent thresholds",
+        urgentWakeOnly.durable && urgentWakeOnly.registryApplied &&
+        gDesired[0].config.wakeIntervalMin == 10 &&
+        gDesired[0].config.urgentFlags == 0x03 &&
+        gDesired[0].config.urgentSoilAboveMv == 2200);
+
   Serial.printf("=== SUITE: %d passed, %d failed ===\n", gPass, gFail);
 }
 
@@ -0,0 +1,112 @@
+// On-device assertion test for the indexed node registry (NodeRegistry in
+// config/node_registry.h): MAC and nodeId lookups agree with a front-to-back
+// scan through inserts, in-place renames, erases and a full table, and the
+// fixed-size text fields truncate instead of overrunning. Header-only; links no
+// registry code and touches no NVS.
+//
+//   pio run -e mothership-v2-test-node-registry-index -t upload && pio device monitor
+//
+#include <Arduino.h>
+#include "config/node_registry.h"
+
+NodeRegistry registeredNodes;
+
+static int failures = 0;
+static void ok(bool c, const char* label) {
+  if (c) Serial.printf("ok   %s\n", label);
+  else { Serial.printf("FAIL %s\n", label); failures++; }
+}
+
+static void makeMac(uint8_t out[6], uint16_t i) {
+  out[0] = 0x24; out[1] = 0x6F; out[2] = 0x28;
+  out[3] = 0x00; out[4] = (uint8_t)(i >> 8); out[5] = (uint8_t)i;
+}
+
+static NodeInfo makeNode(uint16_t i) {
+  NodeInfo n{};
+  makeMac(n.mac, i);
+  char id[16];
+  snprintf(id, sizeof id, "ENV_%06X", (unsigned)(0xA00000 + i));
+  n.nodeId = id;
+  n.state = DEPLOYED;
+  return n;
+}
+
+static const NodeInfo* scanById(const char* id) {
+  for (const auto& n : registeredNodes) if (n.nodeId == id) return &n;
+  return nullptr;
+}
+
+static const NodeInfo* scanByMac(const uint8_t* mac) {
+  for (const auto& n : registeredNodes) if (memcmp(n.mac, mac, 6) == 0) return &n;
+  return nullptr;
+}
+
+static bool allLookupsMatchScan() {
+  for (const auto& n : registeredNodes) {
+    if (registeredNodes.findById(n.nodeId.c_str()) != scanById(n.nodeId.c_str())) return false;
+    if (registeredNodes.findByMac(n.mac) != scanByMac(n.mac)) return false;
+  }
+  return true;
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(600);
+  Serial.println("\n[TEST] Node registry index");
+
+  // --- fill to capacity ---
+  registeredNodes.clear();
+  bool pushed = true;
+  for (uint16_t i = 0; i < NodeRegistry::kCapacity; ++i) {
+    pushed = registeredNodes.push_back(makeNode(i)) && pushed;
+  }
+  ok(pushed && registeredNodes.size() == NodeRegistry::kCapacity, "filled to capacity");
+  ok(!registeredNodes.push_back(makeNode(999)), "push_back refused when full");
+  ok(allLookupsMatchScan(), "every id/MAC lookup matches the scan (full table)");
+
+  uint8_t mac[6];
+  makeMac(mac, 999);
+  ok(registeredNodes.findByMac(mac) == nullptr, "unknown MAC misses");
+  ok(registeredNodes.findById("ENV_NOPE") == nullptr, "unknown nodeId misses");
+  ok(registeredNodes.findById("") == nullptr && registeredNodes.findById(nullptr) == nullptr,
+     "empty/null nodeId misses");
+
+  // --- mac-or-id returns the earliest match, like the old scan ---
+  makeMac(mac, 40);
+  NodeInfo* either = registeredNodes.findByMacOrId(mac, registeredNodes[7].nodeId.c_str());
+  ok(either == &registeredNodes[7], "findByMacOrId picks the earlier record");
+
+  // --- in-place rename without reindex(): still found, old id gone ---
+  registeredNodes[12].nodeId = "ENV_RENAMED";
+  ok(registeredNodes.findById("ENV_RENAMED") == &registeredNodes[12], "stale index self-heals on rename");
+  ok(registeredNodes.findById("ENV_A0000C") == nullptr, "old id no longer resolves");
+
+  // --- erase shifts records and keeps the indexes right ---
+  const NodeInfo* gone = registeredNodes.findById("ENV_A00003");
+  registeredNodes.erase(const_cast<NodeInfo*>(gone));
+  ok(registeredNodes.size() == NodeRegistry::kCapacity - 1, "erase shrinks the table");
+  ok(registeredNodes.findById("ENV_A00003") == nullptr, "erased id misses");
+  ok(allLookupsMatchScan(), "every lookup matches the scan after erase");
+  ok(registeredNodes.push_back(makeNode(500)) &&
+     registeredNodes.findById("ENV_A001F4") == &registeredNodes.back(),
+     "freed slot reused and indexed");
+
+  // --- fixed text fields ---
+  NodeInfo t{};
+  t.name = "a-name-that-is-much-longer-than-thirty-two-bytes";
+  ok(t.name.length() == sizeof(t.name.buf) - 1, "over-long name truncated");
+  t.userId = String("0071");
+  ok(t.userId == "007", "userId holds three digits");
+  ok(t.fwVersion.isEmpty() && t.fwVersion == "", "unset field reads empty");
+  t.nodeId = "ENV_X";
+  ok(String("ENV_X") == t.nodeId && t.nodeId != "ENV_Y", "String/char* comparisons");
+
+  registeredNodes.clear();
+  ok(registeredNodes.empty() && registeredNodes.findByMac(registeredNodes[0].mac) == nullptr,
+     "clear empties the table and indexes");
+
+  Serial.printf("\n[TEST] %s (failures=%d)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void loop() {}
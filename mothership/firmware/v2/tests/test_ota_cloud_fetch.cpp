@@ -43,6 +43,11 @@ void setup() {
   // The derived URLs must pass the same approved-host gate the fetch uses.
   ok(hwEndpointAllowed(mUrl), "manifest URL passes hwEndpointAllowed");
   ok(hwEndpointAllowed(iUrl), "image URL passes hwEndpointAllowed");
+  const String pUrl = otaBuildPatchUrl(
+      rel, "0123456789ABCDEF0123456789abcdef0123456789abcdef0123456789abcdef");
+  ok(pUrl.endsWith("/" + String(rel) + "/patch-0123456789abcdef.bin"),
+     "patch URL = first 16 lowercase hex of the base SHA");
+  ok(hwEndpointAllowed(pUrl), "patch URL passes hwEndpointAllowed");
 
   // --- Preflight gating ---
   ok(strcmp(otaPreflightReason(3.9f, 200000UL), "NONE") == 0, "preflight ok when healthy");
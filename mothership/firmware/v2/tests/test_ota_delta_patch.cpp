@@ -0,0 +1,147 @@
+// On-device assertion test for the delta OTA patch decoder (ota_delta_patch.h):
+// a hand-built FMDP patch rebuilds the target from a synthetic base image no
+// matter how the patch is split, and malformed or out-of-bounds patches are
+// rejected before anything past the bad op is written. The host generator in
+// scripts/release_sign.py round-trips its own patches through a reference
+// decoder with the same format.
+//
+//   pio run -e mothership-v2-test-ota-delta-patch -t upload && pio device monitor
+//
+#include <Arduino.h>
+#include "ota/ota_delta_patch.h"
+
+static int failures = 0;
+static void ok(bool c, const char* label) {
+  if (c) Serial.printf("ok   %s\n", label);
+  else { Serial.printf("FAIL %s\n", label); failures++; }
+}
+
+static const uint32_t kOldSize = 4096;
+static const uint32_t kNewSize = 4096 - 512 + 40;
+static uint8_t gOld[kOldSize];
+static uint8_t gNew[kNewSize];
+static uint8_t gPatch[160];
+static size_t  gPatchLen = 0;
+
+struct BufSource {
+  bool read(uint32_t offset, uint8_t* out, size_t len) {
+    if ((uint64_t)offset + len > kOldSize) return false;
+    memcpy(out, gOld + offset, len);
+    return true;
+  }
+};
+
+struct BufSink {
+  uint8_t  out[kNewSize + 64];
+  uint32_t len = 0;
+  bool write(const uint8_t* data, size_t n) {
+    if (len + n > sizeof(out)) return false;
+    memcpy(out + len, data, n);
+    len += n;
+    return true;
+  }
+};
+
+static void put32(uint8_t* p, uint32_t v) {
+  p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+// new = old[0..1024) + 40 literal bytes + old[1536..4096)
+static void buildFixture() {
+  uint32_t x = 0x12345678u;
+  for (uint32_t i = 0; i < kOldSize; ++i) {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    gOld[i] = (uint8_t)x;
+  }
+  uint8_t lit[40];
+  for (uint8_t i = 0; i < sizeof lit; ++i) lit[i] = (uint8_t)(0xA0 + i);
+  memcpy(gNew, gOld, 1024);
+  memcpy(gNew + 1024, lit, sizeof lit);
+  memcpy(gNew + 1024 + sizeof lit, gOld + 1536, kOldSize - 1536);
+
+  uint8_t* p = gPatch;
+  memset(p, 0, OTA_DELTA_HEADER_BYTES);
+  memcpy(p, OTA_DELTA_MAGIC, 4);
+  p[4] = OTA_DELTA_VERSION;
+  put32(p + 8, kOldSize);
+  put32(p + 12, kNewSize);
+  p += OTA_DELTA_HEADER_BYTES;           // hashes left zero: the decoder does not check them
+  *p++ = OTA_DELTA_OP_COPY;   put32(p, 0);    put32(p + 4, 1024); p += 8;
+  *p++ = OTA_DELTA_OP_INSERT; put32(p, sizeof lit); p += 4;
+  memcpy(p, lit, sizeof lit); p += sizeof lit;
+  *p++ = OTA_DELTA_OP_COPY;   put32(p, 1536); put32(p + 4, kOldSize - 1536); p += 8;
+  *p++ = OTA_DELTA_OP_END;
+  gPatchLen = p - gPatch;
+}
+
+static OtaDeltaDecoder gDec;
+static BufSink gSink;
+
+static OtaDeltaStatus run(const uint8_t* patch, size_t len, size_t piece,
+                          uint32_t expectSource = kOldSize) {
+  otaDeltaReset(gDec, expectSource);
+  gSink.len = 0;
+  BufSource src;
+  OtaDeltaStatus s = OtaDeltaStatus::NeedMore;
+  for (size_t i = 0; i < len && s == OtaDeltaStatus::NeedMore; i += piece) {
+    const size_t n = (len - i) < piece ? (len - i) : piece;
+    s = otaDeltaFeed(gDec, patch + i, n, src, gSink);
+  }
+  return s;
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(600);
+  Serial.println("\n[TEST] OTA delta patch decoder");
+  buildFixture();
+
+  // --- rebuild, independent of how the patch arrives ---
+  const size_t pieces[] = {1, 3, 9, 80, 1024};
+  for (size_t piece : pieces) {
+    const OtaDeltaStatus s = run(gPatch, gPatchLen, piece);
+    char label[64];
+    snprintf(label, sizeof label, "rebuild matches target (piece=%u)", (unsigned)piece);
+    ok(s == OtaDeltaStatus::Done && gSink.len == kNewSize &&
+       memcmp(gSink.out, gNew, kNewSize) == 0, label);
+  }
+  ok(gDec.header.sourceSize == kOldSize && gDec.header.targetSize == kNewSize,
+     "header sizes parsed");
+
+  // --- truncated patch just waits for more ---
+  ok(run(gPatch, gPatchLen - 1, 64) == OtaDeltaStatus::NeedMore, "missing END -> NEED_MORE");
+
+  // --- rejections ---
+  static uint8_t bad[sizeof gPatch + 1];
+  memcpy(bad, gPatch, gPatchLen);
+  bad[0] = 'X';
+  ok(run(bad, gPatchLen, 64) == OtaDeltaStatus::BadFormat, "bad magic rejected");
+
+  ok(run(gPatch, gPatchLen, 64, kOldSize + 1) == OtaDeltaStatus::SourceMismatch,
+     "patch for another base image rejected");
+
+  memcpy(bad, gPatch, gPatchLen);
+  bad[gPatchLen] = 0x00;
+  ok(run(bad, gPatchLen + 1, 64) == OtaDeltaStatus::BadFormat, "bytes after END rejected");
+
+  memcpy(bad, gPatch, gPatchLen);
+  put32(bad + OTA_DELTA_HEADER_BYTES + 1, kOldSize - 100);   // first COPY runs off the end
+  ok(run(bad, gPatchLen, 64) == OtaDeltaStatus::SourceRange, "COPY outside base rejected");
+  ok(gSink.len == 0, "nothing written for the out-of-range COPY");
+
+  memcpy(bad, gPatch, gPatchLen);
+  put32(bad + 12, kNewSize - 10);                            // target smaller than the ops
+  ok(run(bad, gPatchLen, 64) == OtaDeltaStatus::TargetOverflow, "output past targetSize rejected");
+
+  memcpy(bad, gPatch, gPatchLen);
+  bad[OTA_DELTA_HEADER_BYTES] = 0x7F;
+  ok(run(bad, gPatchLen, 64) == OtaDeltaStatus::BadFormat, "unknown opcode rejected");
+
+  memcpy(bad, gPatch, gPatchLen);
+  put32(bad + 12, kNewSize + 1);                             // END before targetSize
+  ok(run(bad, gPatchLen, 64) == OtaDeltaStatus::TargetOverflow, "early END rejected");
+
+  Serial.printf("\n[TEST] %s (failures=%d)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void loop() {}
@@ -0,0 +1,143 @@
+// Bench Test 5: OTA installer throughput, no modem.
+//
+// Streams the running image through the REAL installer (ota_installer.h) in
+// 1400-byte pieces — the size of one AT+CCHRECV pull — and times the
+// pre-erase, every otaInstallWrite() call, and otaInstallFinish(). The slot is
+// armed by a good install, so the boot partition is put back to the running one
+// straight after; nothing reboots.
+//
+// Build twice to A/B the writer task against the old synchronous path:
+//   pio run -e mothership-v2-test-ota-install-rate       -t upload -t monitor
+//   pio run -e mothership-v2-test-ota-install-rate-sync  -t upload -t monitor
+// TEST_RX_US_PER_PIECE adds a busy-wait per piece to stand in for the modem
+// pull (0 = installer-limited rate). Procedure:
+// docs/FIELDMESH_CLOUD_OTA_BENCH_RUNBOOK.md (section 10).
+//
+
+#include <Arduino.h>
+#include "ota_installer.h"
+
+#ifndef TEST_RX_US_PER_PIECE
+#define TEST_RX_US_PER_PIECE 0
+#endif
+
+static const size_t   kPieceBytes  = 1400;
+static const uint32_t kLongWriteMs = 10;
+
+static int failures = 0;
+static void ok(bool c, const char* label) {
+  if (c) Serial.printf("ok   %s\n", label);
+  else { Serial.printf("FAIL %s\n", label); failures++; }
+}
+
+static void toHex(const uint8_t* b, size_t n, char* out) {
+  static const char* h = "0123456789abcdef";
+  for (size_t i = 0; i < n; i++) { out[i*2] = h[b[i] >> 4]; out[i*2+1] = h[b[i] & 0xf]; }
+  out[n*2] = 0;
+}
+
+struct RunStats {
+  uint32_t beginMs;
+  uint32_t streamMs;
+  uint32_t finishMs;
+  uint32_t maxWriteMs;
+  uint32_t longWrites;
+  uint32_t writes;
+  FwReason streamReason;
+  FwReason finishReason;
+};
+
+static RunStats runInstall(const esp_partition_t* src, uint32_t size, const char* shaHex) {
+  RunStats s{};
+  static OtaInstall o;   // the writer task holds a pointer to it while active
+  static uint8_t piece[kPieceBytes];
+
+  uint32_t t0 = millis();
+  FwReason r = otaInstallBegin(o, size, shaHex);
+  s.beginMs = millis() - t0;
+  if (r != FW_NONE) { s.streamReason = r; return s; }
+
+  t0 = millis();
+  for (uint32_t off = 0; off < size; off += kPieceBytes) {
+    const size_t n = (size - off) < kPieceBytes ? (size - off) : kPieceBytes;
+    if (esp_partition_read(src, off, piece, n) != ESP_OK) { s.streamReason = FW_FLASH_WRITE_FAILED; break; }
+    if (TEST_RX_US_PER_PIECE > 0) delayMicroseconds(TEST_RX_US_PER_PIECE);
+    const uint32_t w0 = millis();
+    r = otaInstallWrite(o, piece, n);
+    const uint32_t dt = millis() - w0;
+    s.writes++;
+    if (dt > s.maxWriteMs) s.maxWriteMs = dt;
+    if (dt >= kLongWriteMs) s.longWrites++;
+    if (r != FW_NONE) { s.streamReason = r; break; }
+  }
+  s.streamMs = millis() - t0;
+  if (s.streamReason != FW_NONE) return s;
+
+  t0 = millis();
+  s.finishReason = otaInstallFinish(o);
+  s.finishMs = millis() - t0;
+  return s;
+}
+
+static void printRun(const char* label, uint32_t size, const RunStats& s) {
+  const uint32_t totalMs = s.streamMs + s.finishMs;
+  Serial.printf("\n  --- %s ---\n", label);
+  Serial.printf("  pre-erase (begin): %lu ms\n", (unsigned long)s.beginMs);
+  Serial.printf("  stream:            %lu ms  (%lu writes, %lu >= %lu ms, max %lu ms)\n",
+                (unsigned long)s.streamMs, (unsigned long)s.writes, (unsigned long)s.longWrites,
+                (unsigned long)kLongWriteMs, (unsigned long)s.maxWriteMs);
+  Serial.printf("  finish:            %lu ms  (%s)\n", (unsigned long)s.finishMs,
+                fwReasonStr(s.finishReason));
+  Serial.printf("  install rate:      %lu KiB/s over %lu bytes\n",
+                totalMs ? (unsigned long)((uint64_t)size * 1000 / 1024 / totalMs) : 0UL,
+                (unsigned long)size);
+}
+
+void setup() {
+  Serial.begin(115200);
+  delay(800);
+  Serial.println("\n[TEST 5] OTA installer throughput");
+  Serial.printf("  writer task: %s  piece: %u B  rx wait: %u us/piece\n",
+                OTA_INSTALL_WRITER_TASK ? "ON" : "OFF (synchronous)",
+                (unsigned)kPieceBytes, (unsigned)TEST_RX_US_PER_PIECE);
+
+  const esp_partition_t* run = esp_ota_get_running_partition();
+  const esp_partition_t* next = esp_ota_get_next_update_partition(NULL);
+  if (!run || !next) { Serial.println("FAIL no OTA slots"); return; }
+  const uint32_t size = run->size < next->size ? run->size : next->size;
+
+  uint8_t digest[32];
+  const uint32_t tHash = millis();
+  const bool hashed = otaSha256Partition(run, size, digest);
+  Serial.printf("  hardware SHA-256 of %lu bytes: %lu ms\n",
+                (unsigned long)size, (unsigned long)(millis() - tHash));
+  ok(hashed, "running slot hashed");
+  char shaHex[65];
+  toHex(digest, sizeof digest, shaHex);
+
+  // 1: good install — the rate under test.
+  const RunStats good = runInstall(run, size, shaHex);
+  printRun("self-clone install", size, good);
+  ok(good.streamReason == FW_NONE, "every write accepted");
+  ok(good.finishReason == FW_NONE, "finish verified SHA-256 and armed the slot");
+  ok(esp_ota_set_boot_partition(run) == ESP_OK, "boot partition restored to the running slot");
+
+  // 2: wrong hash — the pipeline must not let a bad image through.
+  shaHex[0] = (shaHex[0] == 'a') ? 'b' : 'a';
+  const esp_partition_t* bootBefore = esp_ota_get_boot_partition();
+  const RunStats bad = runInstall(run, size, shaHex);
+  ok(bad.finishReason == FW_HASH_MISMATCH, "wrong SHA-256 rejected at finish");
+  ok(esp_ota_get_boot_partition() == bootBefore, "boot partition untouched by the rejected image");
+
+  // 3: overrun past the declared size is refused and the writer is torn down.
+  static OtaInstall o;
+  static uint8_t piece[kPieceBytes];
+  FwReason r = otaInstallBegin(o, kPieceBytes, shaHex);
+  if (r == FW_NONE) r = otaInstallWrite(o, piece, kPieceBytes);
+  if (r == FW_NONE) r = otaInstallWrite(o, piece, 1);
+  ok(r == FW_SIZE_MISMATCH && !o.active && o.pipe.task == nullptr, "overrun aborts the install");
+
+  Serial.printf("\n[TEST] %s (failures=%d)\n", failures == 0 ? "PASS" : "FAIL", failures);
+}
+
+void loop() {}
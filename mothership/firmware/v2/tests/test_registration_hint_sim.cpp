@@ -0,0 +1,107 @@
+// Registration hint — native host test.
+//
+// Runs comms/registration_hint.h (the code the modem power-on uses) against
+// +CPSI: lines recorded from A7670G hubs, and replays wake sequences through
+// the hint bookkeeping: a hub on a steady cell, one whose cell changes, and
+// one where the hinted PLMN stops answering. No Arduino, no modem:
+//
+//   pio run -e mothership-v2-test-registration-hint-sim -t exec
+
+#include <stdio.h>
+#include <string.h>
+
+#include "comms/registration_hint.h"
+#include "native_check.h"
+
+using namespace reg_hint;
+
+static void testParse() {
+  printf("\n--- +CPSI: parsing ---\n");
+  Cell c{};
+  check(parseCpsi("LTE,Online,505-01,0x30D4,135402508,349,EUTRAN-BAND3,1275,5,5,-94,-1052,-727,15", c) &&
+        strcmp(c.plmn, "50501") == 0 && c.act == kActLte && c.band == 3 && c.earfcn == 1275,
+        "parse: LTE serving cell -> PLMN, band, EARFCN");
+  check(parseCpsi(" LTE,Online,310-410,0x1A2B,2345678,77,EUTRAN-BAND28,9410,3,3,-108,-1190,-801,9", c) &&
+        strcmp(c.plmn, "310410") == 0 && c.band == 28 && c.earfcn == 9410,
+        "parse: three-digit MNC, leading space");
+  check(parseCpsi("GSM,Online,460-00,0x182d,12401,27 EGSM900,-64,2110,42-42", c) &&
+        strcmp(c.plmn, "46000") == 0 && c.act == kActGsm && c.earfcn == 27 && c.band == 900,
+        "parse: GSM cell -> PLMN, ARFCN, band MHz");
+  check(!parseCpsi("NO SERVICE,Online", c) && c.plmn[0] == '\0',
+        "parse: no service is not a cell");
+  check(!parseCpsi("LTE,Online,505-0A,0x30D4,1,2,EUTRAN-BAND3,1275", c), "parse: junk PLMN rejected");
+  check(!parseCpsi("WCDMA,Online,001-01,0xFFFF,0,WCDMA IMT 2000,10663", c),
+        "parse: a system mode this modem cannot hint is rejected");
+  check(!parseCpsi("", c) && !parseCpsi(nullptr, c), "parse: empty and null");
+}
+
+static Cell lte(const char* plmn, uint16_t band, uint32_t earfcn) {
+  Cell c{};
+  strncpy(c.plmn, plmn, sizeof(c.plmn) - 1);
+  c.act = kActLte;
+  c.band = band;
+  c.earfcn = earfcn;
+  return c;
+}
+
+static void testSteadyCell() {
+  printf("\n--- steady cell ---\n");
+  State s{};
+  check(!hasHint(s) && hintWindowMs(s) == kMinWindowMs, "steady: no hint before the first registration");
+  const Cell home = lte("50501", 3, 1275);
+  recordRegistered(s, kPathScan, 41000, &home);
+  check(hasHint(s) && s.scanAvgMs == 41000, "steady: first full scan learns the cell");
+  for (int i = 0; i < 10; ++i) recordRegistered(s, kPathHint, 6000 + (i % 3) * 500, &home);
+  printf("  hint avg %u ms vs scan %u ms, window %u ms\n",
+         (unsigned)s.hintAvgMs, (unsigned)s.scanAvgMs, (unsigned)hintWindowMs(s));
+  check(s.hintWakes == 10 && s.hintAvgMs < 7000 && s.misses == 0, "steady: hinted wakes tracked separately");
+  check(hintWindowMs(s) >= kMinWindowMs && hintWindowMs(s) <= kMaxWindowMs,
+        "steady: window = 3x the hinted average, clamped");
+}
+
+static void testCellChange() {
+  printf("\n--- cell change ---\n");
+  State s{};
+  const Cell a = lte("50501", 3, 1275);
+  const Cell b = lte("50502", 28, 9410);
+  recordRegistered(s, kPathScan, 40000, &a);
+  recordRegistered(s, kPathFallback, 52000, &b);
+  check(strcmp(s.cell.plmn, "50502") == 0 && s.misses == 0 && hasHint(s),
+        "change: fallback onto another PLMN replaces the hint, fresh count");
+  recordRegistered(s, kPathHint, 7000, &b);
+  check(s.lastPath == kPathHint && s.misses == 0, "change: next wake registers on the new hint");
+  Cell none{};
+  recordRegistered(s, kPathHint, 8000, parseCpsi("NO SERVICE,Online", none) ? &none : nullptr);
+  check(strcmp(s.cell.plmn, "50502") == 0, "change: an unreadable CPSI keeps the hint");
+}
+
+static void testDeadHint() {
+  printf("\n--- hinted PLMN stops answering ---\n");
+  State s{};
+  const Cell a = lte("50501", 3, 1275);
+  recordRegistered(s, kPathScan, 40000, &a);
+  // Same cell found only by the fallback scan (e.g. a roaming agreement that
+  // now rejects manual selection): counts as a miss each time.
+  for (uint8_t i = 0; i < kMaxMisses; ++i) {
+    check(hasHint(s), "dead: hint tried while under kMaxMisses");
+    recordRegistered(s, kPathFallback, 55000, &a);
+  }
+  check(!hasHint(s), "dead: kMaxMisses in a row drop the hint");
+  int scans = 0;
+  while (!hasHint(s) && scans < 50) { recordRegistered(s, kPathScan, 40000, &a); ++scans; }
+  printf("  hint retried after %d full scans\n", scans);
+  check(scans == kRetryAfterScans, "dead: retried after kRetryAfterScans full scans");
+  recordFailed(s, true, 60000);
+  check(s.lastPath == kPathFailed && s.misses == 1, "dead: a failed hinted wake is a miss");
+  recordFailed(s, false, 60000);
+  check(s.misses == 1, "dead: a failed scan is not a hint miss");
+}
+
+int main() {
+  printf("=== registration hint test ===\n");
+  testParse();
+  testSteadyCell();
+  testCellChange();
+  testDeadHint();
+  return checkSummary();
+}
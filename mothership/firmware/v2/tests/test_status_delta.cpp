@@ -0,0 +1,85 @@
+// Status-delta building blocks: node entry hashing and compaction.
+//
+// Pure string work only. statusDeltaPrepare()/statusDeltaIngestResponse() own
+// the NVS baseline ("stdelta") and are left to the bench run, so building and
+// running this suite writes nothing.
+
+#include <Arduino.h>
+
+#include "storage/status_delta.h"
+
+namespace {
+int passed = 0;
+int failed = 0;
+
+void check(const char* name, bool ok) {
+  Serial.printf("  [%s] %s\n", ok ? "PASS" : "FAIL", name);
+  ok ? ++passed : ++failed;
+}
+
+String nodeEntry(const char* id, const char* state, uint32_t lastSeen,
+                 const char* batV, const char* name = "Hedge") {
+  String e = "{\"nodeId\":\"";
+  e += id;
+  e += "\",\"name\":\"";
+  e += name;
+  e += "\",\"state\":\"";
+  e += state;
+  e += "\",\"lastSeenUnix\":";
+  e += String((unsigned long)lastSeen);
+  e += ",\"lastReportedBatV\":";
+  e += batV;
+  e += ",\"firmwareSlots\":[{\"label\":\"app0\",\"active\":true}]}";
+  return e;
+}
+
+void runSuite() {
+  Serial.println("\n--- Status delta suite ---");
+
+  const String a1 = nodeEntry("ENV_A1", "deployed", 1000, "3.91");
+  const String a2 = nodeEntry("ENV_A1", "deployed", 1600, "3.88");
+  const String a3 = nodeEntry("ENV_A1", "paired", 1600, "3.88");
+  check("stable hash ignores the per-contact fields",
+        statusNodeStableHash(a1) == statusNodeStableHash(a2));
+  check("stable hash changes with the rest of the entry",
+        statusNodeStableHash(a2) != statusNodeStableHash(a3));
+  check("stable hash of a non-object is 0", statusNodeStableHash("null") == 0);
+
+  const String b1 = nodeEntry("ENV_B2", "deployed", 1000, "null", "a,}\\\"b");
+  const String first = "[" + a1 + "," + b1 + "]";
+  uint32_t hashes[4];
+  size_t count = 0;
+  const String full = statusDeltaNodes(first, nullptr, 0, hashes, 4, count);
+  check("no baseline: array passes through unchanged", full == first);
+  check("no baseline: one hash per entry, delimiters inside strings ignored",
+        count == 2 && hashes[0] == statusNodeStableHash(a1) &&
+        hashes[1] == statusNodeStableHash(b1));
+
+  const String b2 = nodeEntry("ENV_B2", "paired", 1600, "null", "a,}\\\"b");
+  const String second = "[" + a2 + "," + b2 + "]";
+  uint32_t next[4];
+  const String delta = statusDeltaNodes(second, hashes, count, next, 4, count);
+  const String compactA =
+      "{\"nodeId\":\"ENV_A1\",\"lastSeenUnix\":1600,\"lastReportedBatV\":3.88}";
+  check("unchanged node shrinks to nodeId + per-contact fields",
+        delta.startsWith("[" + compactA + ","));
+  check("changed node is sent whole", delta.endsWith("," + b2 + "]"));
+  check("next baseline holds the current hashes",
+        count == 2 && next[0] == statusNodeStableHash(a2) &&
+        next[1] == statusNodeStableHash(b2));
+  check("delta is smaller than the full array", delta.length() < second.length());
+
+  check("empty array stays empty",
+        statusDeltaNodes("[]", hashes, 2, next, 4, count) == "[]" && count == 0);
+
+  Serial.printf("Status delta result: %d passed, %d failed\n", passed, failed);
+}
+}  // namespace
+
+void setup() {
+  Serial.begin(115200);
+  delay(100);
+  runSuite();
+}
+
+void loop() { delay(1000); }
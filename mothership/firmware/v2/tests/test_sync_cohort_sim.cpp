@@ -0,0 +1,227 @@
+// Sync cohort scheduler — native host simulation.
+//
+// Runs the time/sync_cohorts.h planner (the same code the firmware uses)
+// for fleets of 64 to 256 nodes over many simulated sync intervals: the fleet
+// grows, some SYNC_RELEASEs are lost so a node keeps meeting the hub in its
+// old cohort's slot, and the hub only learns a node moved from its
+// RELEASE_ACK. A node released into another cohort first meets it in the next
+// interval (the release carries that occurrence of the slot). Checks that
+// sessions stay bounded once the first split has settled, that all cohort
+// slots fit the interval, and that the plan churns no more than growth needs
+// and converges. No Arduino, no radio:
+//
+//   pio run -e mothership-v2-test-sync-cohort-sim -t exec
+
+#include <stdio.h>
+
+#include <vector>
+
+#include "time/sync_cohorts.h"
+#include "native_check.h"
+
+using namespace sync_cohorts;
+
+// Deterministic xorshift32 so every run sees the same losses.
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+  bool chance(uint32_t percent) { return next() % 100u < percent; }
+};
+
+static const uint32_t kBasePhase = 1760000400UL;  // minute-aligned
+
+static void testCohortCount() {
+  check(cohortCount(20, 15) == 1, "count: a small fleet keeps one session");
+  check(cohortCount(64, 0) == 1, "count: daily mode keeps one session");
+  check(cohortCount(64, 15) == 2, "count: 64 nodes at 15 min -> 2 (interval-bound)");
+  check(cohortCount(64, 60) == 3, "count: 64 nodes at 60 min -> 3");
+  check(cohortCount(256, 30) == 5, "count: 256 nodes at 30 min -> 5 (interval-bound)");
+  check(cohortCount(256, 60) == kMaxCohorts, "count: 256 nodes at 60 min -> capped");
+  bool fits = true;
+  for (uint32_t interval : {5u, 10u, 15u, 20u, 30u, 60u, 120u}) {
+    for (size_t n = 1; n <= 256; ++n) {
+      const uint8_t c = cohortCount(n, interval);
+      if (c > 1 && (uint32_t)c * kCohortSpacingSec > interval * 60u / 2u) fits = false;
+    }
+  }
+  check(fits, "count: every cohort slot falls in the first half of the interval");
+}
+
+static void testCohortAt() {
+  bool ok = true;
+  for (uint8_t c = 0; c < 4; ++c) {
+    const uint32_t slot = cohortPhase(kBasePhase, c) + 3600u * 5u;
+    if (cohortAt(slot - 10, kBasePhase, 60, 4) != c) ok = false;  // pre-roll
+    if (cohortAt(slot + 40, kBasePhase, 60, 4) != c) ok = false;  // woke late
+  }
+  check(ok, "slot: pre-rolled and late wakes map to their own cohort");
+  check(cohortAt(kBasePhase + 3600u - 10u, kBasePhase, 60, 4) == 0,
+        "slot: just before the base slot is cohort 0 of the next period");
+  check(cohortAt(kBasePhase + 3u * 60u, kBasePhase, 15, 1) == 0,
+        "slot: a single cohort is always 0");
+}
+
+static void testRebalance() {
+  std::vector<uint8_t> cohort(64, 0);
+  const size_t moved = rebalance(cohort.data(), cohort.size(), 3);
+  size_t size[3] = {0, 0, 0};
+  for (uint8_t c : cohort) size[c]++;
+  check(size[0] == 22 && size[1] == 21 && size[2] == 21 && moved == 42,
+        "rebalance: 64 from one slot -> 22/21/21, only the movers move");
+  check(rebalance(cohort.data(), cohort.size(), 3) == 0,
+        "rebalance: a balanced fleet is left alone");
+
+  cohort.push_back(0xFF);  // a newly deployed node
+  check(rebalance(cohort.data(), cohort.size(), 3) == 1,
+        "rebalance: a new node is the only one placed");
+
+  std::vector<uint8_t> shrink(cohort);
+  const size_t shrinkMoved = rebalance(shrink.data(), shrink.size(), 2);
+  size_t s2[2] = {0, 0};
+  bool inRange = true;
+  for (uint8_t c : shrink) {
+    if (c >= 2) inRange = false;
+    else s2[c]++;
+  }
+  check(inRange && s2[0] == 33 && s2[1] == 32 && shrinkMoved == 21,
+        "rebalance: dropping a cohort moves exactly its members");
+}
+
+struct SimNode {
+  uint8_t meets;      // slot the node actually wakes for
+  uint8_t confirmed;  // what the hub believes (last RELEASE_ACK)
+};
+
+// One fleet growing from `startNodes` to `endNodes` over `intervals` sync
+// intervals, with `lossPct` of SYNC_RELEASEs (or their ACKs) lost.
+static void simulateFleet(size_t startNodes, size_t endNodes, uint32_t intervalMin,
+                          uint32_t lossPct, uint32_t seed) {
+  Rng rng{seed};
+  std::vector<SimNode> fleet(startNodes, SimNode{0, 0});
+  const uint32_t intervals = 400;
+  // The first split moves most of the fleet at once; with lossPct of releases
+  // lost a few intervals pass before nearly every node has left cohort 0.
+  const uint32_t settleIntervals = 8;
+  size_t worstSession = 0;
+  size_t worstBound = 0;
+  size_t churn = 0;             // plan changes for nodes already placed
+  size_t churnAtSteadyCount = 0;
+  size_t wakes = 0;
+  size_t uploads = 0;
+  uint8_t lastCount = cohortCount(fleet.size(), intervalMin);
+  std::vector<uint8_t> lastTarget;
+  bool slotsFit = true;
+  bool overBound = false;
+
+  for (uint32_t k = 0; k < intervals; ++k) {
+    if (fleet.size() < endNodes && k % 2 == 0) fleet.push_back(SimNode{0, 0});
+
+    const uint8_t count = cohortCount(fleet.size(), intervalMin);
+    if (count > 1 && (uint32_t)count * kCohortSpacingSec > intervalMin * 60u / 2u) {
+      slotsFit = false;
+    }
+    std::vector<uint8_t> target(fleet.size());
+    for (size_t i = 0; i < fleet.size(); ++i) target[i] = fleet[i].confirmed;
+    rebalance(target.data(), target.size(), count);
+    size_t changed = 0;
+    for (size_t i = 0; i < lastTarget.size(); ++i) {
+      if (target[i] != lastTarget[i]) changed++;
+    }
+    churn += changed;
+    if (count == lastCount) churnAtSteadyCount += changed;
+    lastCount = count;
+    lastTarget = target;
+
+    // The hub wakes once per cohort slot, and keeps visiting a dropped
+    // cohort's slot while any node is still confirmed there; it uploads after
+    // the last slot.
+    uint8_t slots = count;
+    for (const auto& n : fleet) {
+      if (n.confirmed >= slots) slots = (uint8_t)(n.confirmed + 1);
+    }
+    const size_t bound = (fleet.size() + count - 1) / count;
+    std::vector<SimNode> next(fleet);
+    for (uint8_t slot = 0; slot < slots; ++slot) {
+      wakes++;
+      size_t session = 0;
+      for (size_t i = 0; i < fleet.size(); ++i) {
+        if (fleet[i].meets != slot) continue;
+        session++;
+        if (rng.chance(lossPct)) continue;  // release or ack lost: no move
+        next[i].meets = target[i];
+        next[i].confirmed = target[i];
+      }
+      if (k >= settleIntervals && session > worstSession) {
+        worstSession = session;
+        worstBound = bound;
+      }
+      // Past the first split, stragglers that missed a release only linger
+      // on their old slot for an interval or two.
+      if (k >= settleIntervals && session > bound + bound / 4 + 2) overBound = true;
+    }
+    uploads++;
+    fleet.swap(next);
+  }
+
+  // Converged: after the last rebalance with no losses everyone meets the
+  // slot the hub planned for it.
+  const uint8_t count = cohortCount(fleet.size(), intervalMin);
+  std::vector<uint8_t> target(fleet.size());
+  for (size_t i = 0; i < fleet.size(); ++i) target[i] = fleet[i].confirmed;
+  const size_t finalMoves = rebalance(target.data(), target.size(), count);
+  size_t size[kMaxCohorts] = {0};
+  bool agree = true;
+  for (size_t i = 0; i < fleet.size(); ++i) {
+    if (fleet[i].meets != fleet[i].confirmed) agree = false;
+    size[target[i]]++;
+  }
+  size_t lo = fleet.size(), hi = 0;
+  for (uint8_t c = 0; c < count; ++c) {
+    if (size[c] < lo) lo = size[c];
+    if (size[c] > hi) hi = size[c];
+  }
+
+  printf("  fleet %3u->%3u @%3u min: cohorts=%u sizes=%u..%u worst session=%u (quota %u) "
+         "churn=%u (%u without a count change) wakes=%u uploads=%u\n",
+         (unsigned)startNodes, (unsigned)fleet.size(), (unsigned)intervalMin,
+         (unsigned)count, (unsigned)lo, (unsigned)hi, (unsigned)worstSession,
+         (unsigned)worstBound, (unsigned)churn, (unsigned)churnAtSteadyCount,
+         (unsigned)wakes, (unsigned)uploads);
+
+  char label[96];
+  snprintf(label, sizeof(label), "sim %u->%u @%u min: slots fit the interval",
+           (unsigned)startNodes, (unsigned)endNodes, (unsigned)intervalMin);
+  check(slotsFit, label);
+  snprintf(label, sizeof(label), "sim %u->%u @%u min: sessions stay bounded",
+           (unsigned)startNodes, (unsigned)endNodes, (unsigned)intervalMin);
+  check(!overBound, label);
+  snprintf(label, sizeof(label), "sim %u->%u @%u min: converged and balanced",
+           (unsigned)startNodes, (unsigned)endNodes, (unsigned)intervalMin);
+  check(agree && finalMoves == 0 && hi - lo <= 1, label);
+  // While the cohort count holds, each new node shifts at most one placed
+  // node (the cohort that takes the extra changes), and lost releases do not
+  // reshuffle anyone: the plan is recomputed from confirmed cohorts only.
+  snprintf(label, sizeof(label), "sim %u->%u @%u min: growth churns at most one node each",
+           (unsigned)startNodes, (unsigned)endNodes, (unsigned)intervalMin);
+  check(churnAtSteadyCount <= (endNodes - startNodes), label);
+  snprintf(label, sizeof(label), "sim %u->%u @%u min: one upload per interval",
+           (unsigned)startNodes, (unsigned)endNodes, (unsigned)intervalMin);
+  check(uploads == intervals && wakes >= intervals, label);
+}
+
+int main() {
+  testCohortCount();
+  testCohortAt();
+  testRebalance();
+  simulateFleet(64, 64, 15, 10, 0x1234u);
+  simulateFleet(64, 128, 30, 10, 0x2345u);
+  simulateFleet(64, 256, 60, 10, 0x3456u);
+  simulateFleet(128, 256, 30, 25, 0x4567u);
+  simulateFleet(256, 256, 120, 10, 0x5678u);
+  return checkSummary();
+}
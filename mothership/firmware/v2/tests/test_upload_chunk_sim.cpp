@@ -0,0 +1,225 @@
+// Upload chunk sizing — native host simulation.
+//
+// Runs the comms/upload_chunk_sizer.h controller (the code the upload loop
+// uses) against simulated link traces: a good LTE link, a weak one, a link
+// that degrades mid-session, transport failures, a fragmented heap and a
+// nearly spent session. Each POST takes overhead + body/throughput
+// (with jitter); the body is ~4x the CSV bytes, as json_payload.cpp builds it.
+// Checks that chunks grow on a good link and beat the fixed 8 KB chunk, keep
+// POSTs near the target time on a slow one, halve on failure and recover,
+// never outgrow the heap, and respect the backend's row cap. No Arduino, no
+// modem:
+//
+//   pio run -e mothership-v2-test-upload-chunk-sim -t exec
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "comms/upload_chunk_sizer.h"
+#include "native_check.h"
+
+using namespace upload_sizing;
+
+// Deterministic xorshift32 so every run sees the same jitter.
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+  // Uniform in [-pct, +pct] percent, as a factor.
+  float jitter(int pct) {
+    return 1.0f + (float)((int)(next() % (2 * pct + 1)) - pct) / 100.0f;
+  }
+};
+
+constexpr uint32_t kRowBytes = 220;          // one 40-column CSV row
+constexpr uint16_t kMaxRows = 100;           // backend readings per POST
+constexpr uint32_t kSessionMs = 300000;      // kSyncSessionLimitMs
+constexpr uint32_t kExpansion = 4;           // JSON body bytes per CSV byte
+
+struct LinkPhase {
+  uint32_t fromPost;      // applies from this POST index on
+  uint32_t overheadMs;
+  uint32_t bytesPerSec;
+  bool     fails;         // transport error (nothing accepted)
+};
+
+struct Heap {
+  uint32_t freeBytes;
+  uint32_t maxAlloc;
+};
+
+struct Trace {
+  std::vector<uint32_t> chunk;     // decided CSV bytes per POST
+  std::vector<uint32_t> postMs;
+  std::vector<Limit> limit;
+  uint32_t rowsSent = 0;
+  uint32_t posts = 0;
+  uint32_t failures = 0;
+  uint32_t elapsedMs = 0;
+  uint32_t maxBody = 0;
+  uint32_t maxRowsInPost = 0;
+};
+
+// Drain backlogRows through the upload loop. fixedChunk != 0 replays the old
+// fixed-size loop for comparison.
+static Trace runSession(State& st, uint32_t backlogRows, const std::vector<LinkPhase>& link,
+                        Heap heap, uint32_t sessionMs, uint32_t seed,
+                        uint32_t fixedChunk = 0) {
+  Trace t;
+  Rng rng{seed};
+  uint32_t remainingRows = backlogRows;
+  while (remainingRows > 0) {
+    const uint32_t left = t.elapsedMs < sessionMs ? sessionMs - t.elapsedMs : 0;
+    if (left < kSessionReserveMs / 2) break;   // the loop's sessionExpired()
+    const Decision d = decide(st, Inputs{heap.freeBytes, heap.maxAlloc, left, kMaxRows});
+    const uint32_t chunk = fixedChunk ? fixedChunk : d.chunkBytes;
+    uint32_t rows = chunk / kRowBytes;
+    if (rows == 0) rows = 1;
+    if (rows > kMaxRows) rows = kMaxRows;
+    if (rows > remainingRows) rows = remainingRows;
+    const uint32_t csv = rows * kRowBytes;
+    const uint32_t body = csv * kExpansion;
+
+    LinkPhase p = link.front();
+    for (const auto& lp : link) {
+      if (t.posts >= lp.fromPost) p = lp;
+    }
+    uint32_t ms = (uint32_t)((p.overheadMs + (uint64_t)body * 1000ULL / p.bytesPerSec) *
+                             rng.jitter(10));
+    t.chunk.push_back(chunk);
+    t.limit.push_back(d.limit);
+    t.postMs.push_back(ms);
+    t.elapsedMs += ms;
+    ++t.posts;
+    t.maxBody = std::max(t.maxBody, body);
+    t.maxRowsInPost = std::max(t.maxRowsInPost, rows);
+    if (p.fails) {
+      ++t.failures;
+      recordFailure(st, chunk);
+      continue;
+    }
+    recordSuccess(st, chunk, csv, body, (uint16_t)rows, ms);
+    t.rowsSent += rows;
+    remainingRows -= rows;
+  }
+  return t;
+}
+
+static void testGoodLinkGrowsAndBeatsFixed() {
+  printf("\n--- good LTE link (2 s per POST, 40 KB/s) ---\n");
+  const std::vector<LinkPhase> link = {{0, 2000, 40000, false}};
+  const Heap heap{180000, 110000};
+  State st = initialState();
+  const Trace t = runSession(st, 1000, link, heap, kSessionMs, 1);
+  State fixed = initialState();
+  const Trace f = runSession(fixed, 1000, link, heap, kSessionMs, 1, kStartChunkBytes);
+  printf("  adaptive: %u POSTs, %u rows, %.1f s | fixed 8 KB: %u POSTs, %u rows, %.1f s\n",
+         t.posts, t.rowsSent, t.elapsedMs / 1000.0, f.posts, f.rowsSent, f.elapsedMs / 1000.0);
+  check(t.chunk.front() == kStartChunkBytes, "good: first chunk is the proven 8 KB");
+  check(t.rowsSent == 1000, "good: whole backlog drained in one session");
+  check(t.posts < f.posts && t.elapsedMs < f.elapsedMs,
+        "good: fewer POSTs and less time than the fixed 8 KB chunk");
+  check(t.chunk.back() > 2 * kStartChunkBytes && t.limit.back() == kLimitHeap,
+        "good: chunks grow until the free-heap cap binds");
+  State roomy = initialState();
+  const Trace r = runSession(roomy, 1000, link, Heap{260000, 110000}, kSessionMs, 1);
+  check(r.maxRowsInPost == kMaxRows && r.limit.back() == kLimitRows,
+        "good: with more heap, the backend's 100-row cap binds");
+}
+
+static void testWeakLinkKeepsPostsNearTarget() {
+  printf("\n--- weak link (6 s per POST, 1.5 KB/s) ---\n");
+  const std::vector<LinkPhase> link = {{0, 6000, 1500, false}};
+  State st = initialState();
+  const Trace t = runSession(st, 400, link, Heap{180000, 110000}, kSessionMs, 2);
+  uint32_t worstLate = 0;
+  for (size_t i = 3; i < t.postMs.size(); ++i) worstLate = std::max(worstLate, t.postMs[i]);
+  printf("  %u POSTs, %u rows, worst POST after the fit settles %u ms, last chunk %u (%s)\n",
+         t.posts, t.rowsSent, worstLate, t.chunk.back(), limitStr(t.limit.back()));
+  check(t.chunk.back() < kStartChunkBytes, "weak: chunk shrinks below 8 KB");
+  check(worstLate <= kTargetPostMs * 13 / 10, "weak: POSTs stay near the target time");
+  check(t.elapsedMs <= kSessionMs, "weak: session limit respected");
+}
+
+static void testDegradingLinkAdapts() {
+  printf("\n--- link degrades after 4 POSTs (40 KB/s -> 2 KB/s) ---\n");
+  const std::vector<LinkPhase> link = {{0, 2000, 40000, false}, {4, 5000, 2000, false}};
+  State st = initialState();
+  const Trace t = runSession(st, 2000, link, Heap{180000, 110000}, kSessionMs, 3);
+  uint32_t slowPosts = 0;
+  for (size_t i = 4; i < t.postMs.size(); ++i) {
+    if (t.postMs[i] > kTargetPostMs * 3 / 2) ++slowPosts;
+  }
+  printf("  %u POSTs, %u over 1.5x target after the drop, last chunk %u (%s)\n",
+         t.posts, slowPosts, t.chunk.back(), limitStr(t.limit.back()));
+  check(slowPosts <= 2, "degrade: at most two long POSTs before the fit catches up");
+  check(t.chunk.back() < t.chunk[3], "degrade: chunk shrinks after the drop");
+}
+
+static void testFailuresHalveAndRecover() {
+  printf("\n--- transport failures on POSTs 3-5 ---\n");
+  const std::vector<LinkPhase> link = {
+      {0, 2000, 40000, false}, {3, 2000, 40000, true}, {6, 2000, 40000, false}};
+  State st = initialState();
+  const Trace t = runSession(st, 800, link, Heap{180000, 110000}, kSessionMs, 4);
+  check(t.failures == 3, "fail: three failed POSTs");
+  check(t.chunk[4] <= t.chunk[3] / 2 && t.chunk[5] <= t.chunk[4] / 2,
+        "fail: each failure halves the next chunk");
+  check(st.failures == 0 && t.chunk.back() > t.chunk[5], "fail: grows back after success");
+  State floor = initialState();
+  for (int i = 0; i < 10; ++i) recordFailure(floor, floor.chunkBytes);
+  check(floor.chunkBytes == kMinChunkBytes && floor.failures == 10,
+        "fail: repeated failures bottom out at the minimum chunk");
+}
+
+static void testFragmentedHeapCaps() {
+  printf("\n--- fragmented heap (largest block 20 KB, free 60 KB) ---\n");
+  const Heap heap{60000, 20000};
+  State st = initialState();
+  const Trace t = runSession(st, 300, {{0, 2000, 40000, false}}, heap, kSessionMs, 5);
+  const uint32_t blockCap = (heap.maxAlloc - kHeapMarginBytes / 4) / kBodyPerCsvByte;
+  const uint32_t heapCap = (heap.freeBytes - kHeapMarginBytes) / kPeakPerCsvByte;
+  bool within = true;
+  for (uint32_t c : t.chunk) within = within && c <= std::max(std::min(blockCap, heapCap), kMinChunkBytes);
+  printf("  first chunk %u (%s), block cap %u, heap cap %u\n",
+         t.chunk.front(), limitStr(t.limit.front()), blockCap, heapCap);
+  check(t.chunk.front() < kStartChunkBytes, "heap: first chunk already below the fixed 8 KB");
+  check(within, "heap: no chunk above the heap caps");
+  check(t.maxBody < heap.maxAlloc, "heap: JSON body always fits the largest block");
+  const Decision starved = decide(initialState(), Inputs{20000, 8000, kSessionMs, kMaxRows});
+  check(starved.chunkBytes == kMinChunkBytes && starved.limit == kLimitFloor,
+        "heap: a starved heap still yields the minimum chunk");
+}
+
+static void testSessionBudgetCaps() {
+  printf("\n--- session nearly spent ---\n");
+  State st = initialState();
+  // Teach it a 4 KB/s link first.
+  runSession(st, 200, {{0, 3000, 4000, false}}, Heap{180000, 110000}, kSessionMs, 6);
+  const Link l = linkModel(st);
+  const Decision d = decide(st, Inputs{180000, 110000, kSessionReserveMs + 12000, kMaxRows});
+  const uint32_t expectMs = l.overheadMs + d.chunkBytes * kBodyPerCsvByte * 1000 / l.bytesPerSec;
+  printf("  fit: %u ms + %u B/s; 42 s left -> chunk %u (%s), ~%u ms\n",
+         l.overheadMs, l.bytesPerSec, d.chunkBytes, limitStr(d.limit), expectMs);
+  check(l.bytesPerSec > 3000 && l.bytesPerSec < 5000 && l.overheadMs > 1500 && l.overheadMs < 4500,
+        "session: fit recovers the link's overhead and throughput");
+  check(d.limit == kLimitSession && expectMs <= 12000 + l.overheadMs,
+        "session: chunk sized to finish before the reserve");
+}
+
+int main() {
+  printf("=== upload chunk sizing simulation ===\n");
+  testGoodLinkGrowsAndBeatsFixed();
+  testWeakLinkKeepsPostsNearTarget();
+  testDegradingLinkAdapts();
+  testFailuresHalveAndRecover();
+  testFragmentedHeapCaps();
+  testSessionBudgetCaps();
+  return checkSummary();
+}
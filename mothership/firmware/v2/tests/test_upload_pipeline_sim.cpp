@@ -0,0 +1,228 @@
+// Pipelined upload — native host simulation.
+//
+// Runs the comms/upload_pipeline.h window (the code the pipelined backfill
+// uses) two ways:
+//   1. Ordering: thousands of random sessions with random accept / retryable /
+//      rejected answers. The cursor must only ever move to the end of the
+//      longest accepted prefix, in send order, and nothing behind a failure
+//      may commit.
+//   2. Throughput model: a timing model of the A7670G path built from the
+//      driver's own waits (NETOPEN settle, NTP, the 1 s post-open delay, 1 KB
+//      CCHSEND chunks at 115200 baud) and assumed server times, comparing one
+//      httpsPost() per chunk, one persistent session, and two pipelined
+//      sessions. These are modelled figures, not measurements; nothing here
+//      says what the modem achieves on a real link.
+// No Arduino, no modem:
+//
+//   pio run -e mothership-v2-test-upload-pipeline-sim -t exec
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "comms/upload_pipeline.h"
+#include "native_check.h"
+
+using namespace upload_pipeline;
+
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+};
+
+// ---------------------------------------------------------------------------
+// 1. Ordering under partial failure
+// ---------------------------------------------------------------------------
+
+static void testOrdering() {
+  printf("\n--- ordering: 5000 random sessions ---\n");
+  Rng rng{12345};
+  bool cursorOk = true, sessionsOk = true, noCommitAfterStop = true, drained = true;
+  uint32_t stops = 0, discards = 0;
+  for (int run = 0; run < 5000; ++run) {
+    const uint32_t fileEnd = 10000 + rng.next() % 50000;
+    uint32_t cursor = 64 + rng.next() % 512;   // header, or a prior session's cursor
+    Window w(cursor);
+    std::vector<Chunk> sentOrder;
+    std::vector<uint8_t> sentSession;
+    size_t collectedIdx = 0;
+    bool sawStop = false;
+    // Reference: the cursor may only reach the end of the accepted prefix.
+    uint32_t expectCursor = cursor;
+    bool prefixBroken = false;
+    while (true) {
+      while (w.canSend()) {
+        if (w.nextOffset() >= fileEnd) { w.close(); break; }
+        const uint32_t len = std::min<uint32_t>(2000 + rng.next() % 20000, fileEnd - w.nextOffset());
+        Chunk c{w.nextOffset(), w.nextOffset() + len, (uint16_t)(len / 220), len, len * 4, 0, false};
+        sentSession.push_back(w.sendSession());
+        sentOrder.push_back(c);
+        w.sent(c);
+      }
+      if (!w.pending()) break;
+      if (w.collectSession() != sentSession[collectedIdx]) sessionsOk = false;
+      const uint32_t r = rng.next() % 100;
+      const Outcome o = r < 85 ? kAccepted : r < 95 ? kRetryable : kRejected;
+      Chunk got{};
+      const Action a = w.collected(o, got);
+      if (got.start != sentOrder[collectedIdx].start) cursorOk = false;
+      ++collectedIdx;
+      if (!prefixBroken && o == kAccepted) expectCursor = got.end;
+      if (o != kAccepted) prefixBroken = true;
+      if (a == kCommit) {
+        if (sawStop || got.start != cursor) noCommitAfterStop = false;
+        cursor = got.end;   // what advanceCursor() does
+      } else if (a == kStop) {
+        sawStop = true;
+        ++stops;
+      } else {
+        ++discards;
+        if (!sawStop) noCommitAfterStop = false;
+      }
+    }
+    if (cursor != expectCursor || w.committed() != cursor) cursorOk = false;
+    if (collectedIdx != sentOrder.size()) drained = false;
+    // At most one chunk can be on the air past the failure.
+    if (sawStop && sentOrder.size() - w.commits() > 2) noCommitAfterStop = false;
+  }
+  printf("  %u stops, %u answers discarded behind a failure\n", stops, discards);
+  check(cursorOk, "order: cursor = end of the longest accepted prefix, every run");
+  check(noCommitAfterStop, "order: commits are contiguous; nothing behind a failure commits");
+  check(sessionsOk, "order: each answer is collected from the session it was sent on");
+  check(drained, "order: every chunk sent is collected (its session closed)");
+}
+
+static void testEdgeCases() {
+  printf("\n--- edge cases ---\n");
+  Window w(100);
+  check(w.canSend() && w.sendSession() == 0 && w.nextOffset() == 100, "edge: starts at the cursor on session 0");
+  w.sent({100, 900, 4, 800, 3200, 0, true});
+  w.sent({900, 1500, 3, 600, 2400, 0, false});
+  check(!w.canSend() && w.collectSession() == 0, "edge: two on the air, oldest is session 0");
+  Chunk c{};
+  check(w.collected(kAccepted, c) == kCommit && c.carriesStatus && w.committed() == 900,
+        "edge: first answer commits the status-carrying chunk");
+  check(w.canSend() && w.sendSession() == 0, "edge: session 0 is reused while 1 is on the air");
+  w.sent({1500, 2000, 2, 500, 2000, 0, false});
+  check(w.collectSession() == 1, "edge: session 1 is collected before the newer session 0");
+  check(w.collected(kRetryable, c) == kStop && w.stopReason() == kRetryable && !w.canSend(),
+        "edge: a retryable failure stops the window");
+  check(w.collected(kAccepted, c) == kDiscard && w.committed() == 900,
+        "edge: an accepted answer behind it is discarded, cursor unchanged");
+  Window closed(0);
+  closed.sent({0, 10, 1, 10, 40, 0, false});
+  closed.close();
+  check(!closed.canSend() && closed.collected(kAccepted, c) == kCommit,
+        "edge: close() stops sending but chunks on the air still commit");
+}
+
+// ---------------------------------------------------------------------------
+// 2. Throughput model (assumed link and server times, not measurements)
+// ---------------------------------------------------------------------------
+
+struct LinkModel {
+  const char* name;
+  uint32_t tlsOpenMs;     // CCHOPEN until +CCHOPEN: n,0
+  uint32_t serverMs;      // request fully sent -> response cached in the modem
+  uint32_t atRttMs;       // one AT command round trip
+};
+
+// Driver waits (comms/modem_driver.cpp), in ms.
+constexpr uint32_t kNetopenMs   = 1000 + 3000;   // NETOPEN + settle delay
+constexpr uint32_t kNtpMs       = 2000 + 3000;   // CNTP + settle delay
+constexpr uint32_t kSslCfgAts   = 7;             // CSSLCFG x5, CCHSSLCFG, CCHSET
+constexpr uint32_t kCchStartMs  = 1000;
+constexpr uint32_t kPostOpenMs  = 1000;          // delay after CCHOPEN
+constexpr uint32_t kSerialResponseDelayMs = 2000;   // httpsPostSSL waits before reading
+constexpr uint32_t kTeardownMs  = 1500;          // CCHCLOSE + CCHSTOP + NETCLOSE
+constexpr uint32_t kBuildMs     = 250;           // buildJsonUpload for one chunk
+
+// 1 KB CCHSEND chunks: prompt round trip, 1024 bytes at 115200 8N1, OK, 50 ms.
+static uint32_t uartSendMs(uint32_t bytes, const LinkModel& l) {
+  const uint32_t chunks = (bytes + 1023) / 1024;
+  return chunks * (2 * l.atRttMs + 50) + bytes * 10 * 1000 / 115200;
+}
+
+static uint32_t pullMs(const LinkModel& l) { return 2 * l.atRttMs + 120; }
+
+struct Bench {
+  uint32_t chunks;
+  uint32_t ms;
+};
+
+// One httpsPost() per chunk, as the serial loop does.
+static Bench benchSerial(uint32_t chunks, uint32_t bodyBytes, const LinkModel& l) {
+  uint32_t t = 0;
+  for (uint32_t i = 0; i < chunks; ++i) {
+    t += kBuildMs + kNetopenMs + kNtpMs + kSslCfgAts * l.atRttMs + kCchStartMs +
+         l.tlsOpenMs + kPostOpenMs + uartSendMs(bodyBytes + 300, l) +
+         std::max(kSerialResponseDelayMs, l.serverMs) + pullMs(l) + kTeardownMs;
+  }
+  return {chunks, t};
+}
+
+// Upload sessions: two requests on the air, scheduled by Window, or strictly
+// send-then-collect on one. The UART is one resource: opens,
+// sends and pulls serialise on it; server time runs in parallel.
+static Bench benchSessions(uint32_t chunks, uint32_t bodyBytes, const LinkModel& l,
+                           bool pipelined) {
+  uint32_t t = kNetopenMs + kNtpMs + kSslCfgAts * l.atRttMs + kCchStartMs;
+  Window w(0);
+  std::vector<uint32_t> readyAt(chunks);
+  uint32_t sent = 0, done = 0;
+  while (done < chunks) {
+    while (w.canSend() && sent < chunks && (pipelined || !w.pending())) {
+      t += kBuildMs + l.tlsOpenMs + kPostOpenMs + uartSendMs(bodyBytes + 300, l);
+      readyAt[sent] = t + l.serverMs;
+      w.sent({sent, sent + 1, 0, 0, 0, 0, false});
+      ++sent;
+    }
+    t = std::max(t, readyAt[done]) + pullMs(l) + l.atRttMs;   // pull + CCHCLOSE
+    Chunk c{};
+    w.collected(kAccepted, c);
+    ++done;
+  }
+  t += kTeardownMs;
+  return {chunks, t};
+}
+
+static void testThroughput() {
+  const LinkModel links[] = {
+      {"LTE, fast backend", 1500, 1500, 30},
+      {"LTE, busy backend", 1500, 4000, 30},
+      {"weak 2G-class link", 4000, 6000, 120},
+  };
+  const uint32_t kChunks = 10;
+  const uint32_t kBody = 32768;   // 8 KB of CSV as JSON
+  bool pipelineBeatsSingle = true, pipelineBeatsSerial = true;
+  for (const auto& l : links) {
+    const Bench s = benchSerial(kChunks, kBody, l);
+    const Bench one = benchSessions(kChunks, kBody, l, false);
+    const Bench two = benchSessions(kChunks, kBody, l, true);
+    printf("\n--- modelled throughput: %s (%u x %u-byte bodies) ---\n", l.name, kChunks, kBody);
+    printf("  httpsPost() per chunk : %6.1f s  (%5.1f chunks/min)\n",
+           s.ms / 1000.0, kChunks * 60000.0 / s.ms);
+    printf("  one upload session    : %6.1f s  (%5.1f chunks/min)\n",
+           one.ms / 1000.0, kChunks * 60000.0 / one.ms);
+    printf("  two pipelined sessions: %6.1f s  (%5.1f chunks/min)\n",
+           two.ms / 1000.0, kChunks * 60000.0 / two.ms);
+    pipelineBeatsSingle = pipelineBeatsSingle && two.ms < one.ms;
+    pipelineBeatsSerial = pipelineBeatsSerial && two.ms * 3 < s.ms * 2;
+  }
+  check(pipelineBeatsSingle, "model: two sessions beat one persistent session on every link");
+  check(pipelineBeatsSerial, "model: two sessions are 1.5x+ the per-chunk httpsPost() rate");
+}
+
+int main() {
+  printf("=== pipelined upload simulation ===\n");
+  testOrdering();
+  testEdgeCases();
+  testThroughput();
+  return checkSummary();
+}
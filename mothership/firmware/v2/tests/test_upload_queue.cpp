@@ -24,6 +24,7 @@
 #include "storage/flash_logger.h"
 #include "storage/upload_queue.h"
 #include "storage/json_payload.h"
+#include "storage/carry_forward.h"
 #include "config/node_registry.h"
 
 static int gPass = 0, gFail = 0;
@@ -88,23 +89,30 @@ static size_t columnCount(const String& row) {
 // ---------------------------------------------------------------------------
 
 static void testSchemaConstants() {
-  check("schema: current column count is 35", kCurrentCSVColumnCount == 35);
+  check("schema: current column count is 40", kCurrentCSVColumnCount == 40);
+  check("schema: legacy 38 retained", kLegacyCSVColumnCount38 == 38);
+  check("schema: legacy 35 retained", kLegacyCSVColumnCount35 == 35);
   check("schema: legacy 33 retained", kLegacyCSVColumnCount33 == 33);
   check("schema: legacy 30 retained", kLegacyCSVColumnCount30 == 30);
   check("schema: legacy 25 retained", kLegacyCSVColumnCount == 25);
-  check("schema: current header ends with latitude,longitude",
-        String(kCurrentCSVHeader35).endsWith(",latitude,longitude"));
-  check("schema: current header keeps identity columns before location",
-        String(kCurrentCSVHeader35)
-            .endsWith(",deploymentEpoch,userId,name,latitude,longitude") &&
-        String(kCurrentCSVHeader35)
-            .indexOf(",deploymentEpoch,userId,name,latitude,longitude") > 0);
+  check("schema: current header ends with the aggregation columns",
+        String(kCurrentCSVHeader40).endsWith(",aggSamples,aggStats"));
+  check("schema: current header extends the legacy-38 header",
+        String(kCurrentCSVHeader40).startsWith(String(kLegacyCSVHeader38)));
+  check("schema: legacy-38 header ends with the wind statistics",
+        String(kLegacyCSVHeader38).endsWith(",windGust,windSpeedSd,windCalmFraction") &&
+        String(kLegacyCSVHeader38).startsWith(String(kLegacyCSVHeader35)));
+  check("schema: legacy-35 header keeps identity columns before location",
+        String(kLegacyCSVHeader35)
+            .endsWith(",deploymentEpoch,userId,name,latitude,longitude"));
   check("schema: legacy-33 header extends the legacy-30 header",
         String(kLegacyCSVHeader33).startsWith(String(kLegacyCSVHeader30)));
   check("schema: legacy-30 header extends the legacy-25 header",
         String(kLegacyCSVHeader30).startsWith(String(kLegacyCSVHeader25)));
   check("schema: header column counts agree",
-        columnCount(String(kCurrentCSVHeader35)) == kCurrentCSVColumnCount &&
+        columnCount(String(kCurrentCSVHeader40)) == kCurrentCSVColumnCount &&
+        columnCount(String(kLegacyCSVHeader38)) == kLegacyCSVColumnCount38 &&
+        columnCount(String(kLegacyCSVHeader35)) == kLegacyCSVColumnCount35 &&
         columnCount(String(kLegacyCSVHeader33)) == kLegacyCSVColumnCount33 &&
         columnCount(String(kLegacyCSVHeader30)) == kLegacyCSVColumnCount30);
 }
@@ -145,7 +153,7 @@ static void testRealFieldHeaderIsRecognised() {
 static void testLegacyBacklogDetection() {
   uint32_t rows = 0;
 
-  writeDataFile(kCurrentCSVHeader35, (String(kRow31) + "\n").c_str());
+  writeDataFile(kCurrentCSVHeader40, (String(kRow31) + "\n").c_str());
   check("legacy: a current-schema file reports no backlog",
         !uploadQueueHasLegacyRows(&rows));
 
@@ -190,8 +198,17 @@ static void testSchemaCurrentGate() {
   check("gate: schema NOT current with a 33-column header",
         !flashCsvSchemaIsCurrent());
 
-  writeDataFile(kCurrentCSVHeader35, (String(kRow33) + ",nan,nan\n").c_str());
-  check("gate: schema IS current with the 35-column header",
+  writeDataFile(kLegacyCSVHeader35, (String(kRow33) + ",nan,nan\n").c_str());
+  check("gate: schema NOT current with a 35-column header",
+        !flashCsvSchemaIsCurrent());
+
+  writeDataFile(kLegacyCSVHeader38, (String(kRow33) + ",nan,nan,nan,nan,nan\n").c_str());
+  check("gate: schema NOT current with a 38-column header",
+        !flashCsvSchemaIsCurrent());
+
+  writeDataFile(kCurrentCSVHeader40,
+                (String(kRow33) + ",nan,nan,nan,nan,nan,0,nan\n").c_str());
+  check("gate: schema IS current with the 40-column header",
         flashCsvSchemaIsCurrent());
 }
 
@@ -237,12 +254,12 @@ static void testStampedRowRoundTrip() {
   String row;
   check("roundtrip: a decoded snapshot formats",
         formatDecodedSnapshotCSVRow(snap, row));
-  check("roundtrip: the row has 35 columns",
+  check("roundtrip: the row has 40 columns",
         columnCount(row) == kCurrentCSVColumnCount);
   check("roundtrip: the row carries the stamped epoch, identity, and (unset) location",
-        row.endsWith(",5,001,North Hedge,nan,nan"));
+        row.endsWith(",5,001,North Hedge,nan,nan,nan,nan,nan,0,nan"));
 
-  const String chunk = String(kCurrentCSVHeader35) + "\n" + row + "\n";
+  const String chunk = String(kCurrentCSVHeader40) + "\n" + row + "\n";
   JsonPayload json = buildJsonUpload(chunk, 1, "roundtrip", nullptr, 1753000000UL);
   check("roundtrip: it builds one reading", json.ok && json.rowCount == 1);
   check("roundtrip: the epoch reaches the payload",
@@ -260,8 +277,8 @@ static void testStampedRowRoundTrip() {
   formatDecodedSnapshotCSVRow(snap, rowWithLoc);
   registeredNodes.clear();
   check("roundtrip: a registered node's coordinates are stamped at 6dp",
-        rowWithLoc.endsWith(",5,001,North Hedge,-27.469771,153.025124"));
-  JsonPayload jsonLoc = buildJsonUpload(String(kCurrentCSVHeader35) + "\n" + rowWithLoc + "\n",
+        rowWithLoc.endsWith(",5,001,North Hedge,-27.469771,153.025124,nan,nan,nan,0,nan"));
+  JsonPayload jsonLoc = buildJsonUpload(String(kCurrentCSVHeader40) + "\n" + rowWithLoc + "\n",
                                         1, "roundtrip", nullptr, 1753000000UL);
   check("roundtrip: the stamped location reaches the payload",
         jsonLoc.body.indexOf("\"latitude\":-27.469771") >= 0 &&
@@ -279,7 +296,7 @@ static void testStampedRowRoundTrip() {
         columnCount(rowComma) == kCurrentCSVColumnCount);
   check("roundtrip: the comma is replaced, not dropped",
         rowComma.indexOf("Plot A  North") >= 0);
-  JsonPayload jsonComma = buildJsonUpload(String(kCurrentCSVHeader35) + "\n" + rowComma + "\n",
+  JsonPayload jsonComma = buildJsonUpload(String(kCurrentCSVHeader40) + "\n" + rowComma + "\n",
                                           1, "roundtrip", nullptr, 1753000000UL);
   check("roundtrip: a comma-named node still uploads",
         jsonComma.ok && jsonComma.rowCount == 1);
@@ -291,11 +308,66 @@ static void testStampedRowRoundTrip() {
   String row0;
   formatDecodedSnapshotCSVRow(snap, row0);
   check("roundtrip: an unresolved epoch is written as 0",
-        row0.endsWith(",0,001,North Hedge,nan,nan"));
-  JsonPayload json0 = buildJsonUpload(String(kCurrentCSVHeader35) + "\n" + row0 + "\n",
+        row0.endsWith(",0,001,North Hedge,nan,nan,nan,nan,nan,0,nan"));
+  JsonPayload json0 = buildJsonUpload(String(kCurrentCSVHeader40) + "\n" + row0 + "\n",
                                       1, "roundtrip", nullptr, 1753000000UL);
   check("roundtrip: an unresolved epoch reaches the payload as 0",
         json0.body.indexOf("\"deploymentEpoch\":0") >= 0);
+
+  // Reed anemometer statistics land in the three trailing columns.
+  snap.readingCount = 4;
+  snap.readings[1].sensorId = SENSOR_ID_WIND_GUST;      snap.readings[1].value = 6.5f;
+  snap.readings[2].sensorId = SENSOR_ID_WIND_SPEED_SD;  snap.readings[2].value = 1.25f;
+  snap.readings[3].sensorId = SENSOR_ID_WIND_CALM_FRAC; snap.readings[3].value = 0.2f;
+  String rowWind;
+  formatDecodedSnapshotCSVRow(snap, rowWind);
+  check("roundtrip: wind statistics follow the location columns",
+        rowWind.endsWith(",nan,nan,6.500,1.250,0.200,0,nan"));
+  JsonPayload jsonWind = buildJsonUpload(String(kCurrentCSVHeader40) + "\n" + rowWind + "\n",
+                                         1, "roundtrip", nullptr, 1753000000UL);
+  check("roundtrip: wind statistics reach the payload",
+        jsonWind.body.indexOf("\"windGust\":6.500") >= 0 &&
+        jsonWind.body.indexOf("\"windSpeedSd\":1.250") >= 0 &&
+        jsonWind.body.indexOf("\"windCalmFraction\":0.200") >= 0);
+
+  // An aggregation summary: headline means under the base ids, the sample
+  // count, and min/max/SD triples folded into the structured aggStats cell.
+  snap.readingCount = 6;
+  snap.readings[0].sensorId = SENSOR_ID_AIR_TEMP;      snap.readings[0].value = 12.0f;
+  snap.readings[1].sensorId = SENSOR_ID_AGG_SAMPLES;   snap.readings[1].value = 4.0f;
+  snap.readings[2].sensorId = aggregateSensorId(SENSOR_ID_AIR_TEMP, SENSOR_AGG_STAT_MIN);
+  snap.readings[2].value = 10.0f;
+  snap.readings[3].sensorId = aggregateSensorId(SENSOR_ID_AIR_TEMP, SENSOR_AGG_STAT_MAX);
+  snap.readings[3].value = 15.0f;
+  snap.readings[4].sensorId = aggregateSensorId(SENSOR_ID_AIR_TEMP, SENSOR_AGG_STAT_SD);
+  snap.readings[4].value = 2.16f;
+  snap.readings[5].sensorId = aggregateSensorId(SENSOR_ID_AIR_RH, SENSOR_AGG_STAT_SD);
+  snap.readings[5].value = 0.5f;
+  String rowAgg;
+  check("roundtrip: an aggregation summary formats",
+        formatDecodedSnapshotCSVRow(snap, rowAgg) &&
+        columnCount(rowAgg) == kCurrentCSVColumnCount);
+  check("roundtrip: sample count and stats are the trailing columns",
+        rowAgg.endsWith(",4,1001:10.000/15.000/2.160;1002:nan/nan/0.500"));
+  JsonPayload jsonAgg = buildJsonUpload(String(kCurrentCSVHeader40) + "\n" + rowAgg + "\n",
+                                        1, "roundtrip", nullptr, 1753000000UL);
+  check("roundtrip: the summary reaches the payload",
+        jsonAgg.ok && jsonAgg.rowCount == 1 &&
+        jsonAgg.body.indexOf("\"airTemp\":12.000") >= 0 &&
+        jsonAgg.body.indexOf("\"aggSamples\":4") >= 0 &&
+        jsonAgg.body.indexOf(
+            "\"aggStats\":{\"1001\":{\"min\":10.000,\"max\":15.000,\"sd\":2.160},"
+            "\"1002\":{\"min\":null,\"max\":null,\"sd\":0.500}}") >= 0);
+  check("roundtrip: an ordinary row uploads aggStats as null",
+        json0.body.indexOf("\"aggSamples\":0") >= 0 &&
+        json0.body.indexOf("\"aggStats\":null") >= 0);
+
+  const String badAgg = String(kCurrentCSVHeader40) + "\n" + row0 + "\n";
+  String mangled = badAgg;
+  mangled.replace(",0,nan\n", ",0,1001:1/2\n");
+  JsonPayload jsonBad = buildJsonUpload(mangled, 1, "roundtrip", nullptr, 1753000000UL);
+  check("roundtrip: a malformed aggStats cell is skipped, not uploaded",
+        jsonBad.rowCount == 0);
 }
 
 // A node reporting absurd-but-finite sensor values must be REJECTED, not allowed
@@ -307,6 +379,55 @@ static void testStampedRowRoundTrip() {
 //
 // NaN and infinity are already safe (they format to 3-4 characters); only large
 // FINITE values are wide enough to overrun, so that is what this drives.
+// Report-by-exception: a flagged snapshot is completed from the last values
+// the node sent before it is formatted, and keeps the flag on the row. Uses the
+// pure merge so the bench hub's NVS reference sets are left alone.
+static void testCarryForwardCompletesRow() {
+  CarryForwardSet ref{};
+  DecodedSnapshot full{};
+  strncpy(full.nodeId, "ENV_A1", sizeof(full.nodeId) - 1);
+  full.readingCount = 3;
+  full.readings[0] = {SENSOR_ID_AIR_TEMP, 21.5f};
+  full.readings[1] = {SENSOR_ID_AIR_RH, 55.0f};
+  full.readings[2] = {SENSOR_ID_SOIL1_VWC, 1.2f};
+  check("carry-forward: a full snapshot sets the reference",
+        carryForwardMerge(full, ref, false) && ref.count == 3);
+
+  DecodedSnapshot delta{};
+  strncpy(delta.nodeId, "ENV_A1", sizeof(delta.nodeId) - 1);
+  delta.qualityFlags = SNAP_QF_CARRIED_FORWARD;
+  delta.readingCount = 2;
+  delta.readings[0] = {SENSOR_ID_AIR_RH, 61.0f};
+  delta.readings[1] = {SENSOR_ID_SOIL1_VWC, NAN};
+  DecodedSnapshot orphan = delta;
+  CarryForwardSet empty{};
+  check("carry-forward: with no reference the snapshot stays partial",
+        !carryForwardMerge(orphan, empty, false) && orphan.readingCount == 2);
+
+  check("carry-forward: a flagged snapshot merges", carryForwardMerge(delta, ref, true));
+  const float* t = delta.find(SENSOR_ID_AIR_TEMP);
+  const float* h = delta.find(SENSOR_ID_AIR_RH);
+  check("carry-forward: the held-back channel is filled, the sent one is fresh",
+        t && *t == 21.5f && h && *h == 61.0f);
+  check("carry-forward: a NaN marker drops the channel from row and reference",
+        !delta.hasSensor(SENSOR_ID_SOIL1_VWC) && ref.count == 2);
+  check("carry-forward: sensorPresent is rebuilt from the completed set",
+        delta.sensorPresent == (SNAP_PRESENT_AIR_TEMP | SNAP_PRESENT_AIR_RH));
+
+  String row;
+  check("carry-forward: the completed snapshot formats",
+        formatDecodedSnapshotCSVRow(delta, row) &&
+        columnCount(row) == kCurrentCSVColumnCount);
+  check("carry-forward: the row keeps the carried-forward quality flag",
+        row.indexOf(",ENV_A1,0,3," + String((unsigned)SNAP_QF_CARRIED_FORWARD) + ",0,") > 0);
+
+  DecodedSnapshot summary = full;
+  summary.qualityFlags = SNAP_QF_AGGREGATED;
+  summary.readings[0] = {SENSOR_ID_AIR_TEMP, 20.0f};
+  check("carry-forward: an aggregation summary clears the reference",
+        carryForwardMerge(summary, ref, true) && ref.count == 0 && summary.readingCount == 3);
+}
+
 static void testOversizedRowIsRejectedNotOverflowed() {
   const uint16_t kAllSensorIds[] = {
     SENSOR_ID_BAT_V, SENSOR_ID_AIR_TEMP, SENSOR_ID_AIR_RH,
@@ -359,7 +480,7 @@ static void testOversizedRowIsRejectedNotOverflowed() {
 }
 
 static void testUploadAckCompatibilityHookKeepsCurrentHistory() {
-  writeDataFile(kCurrentCSVHeader35, (String(kRow31) + "\n").c_str());
+  writeDataFile(kCurrentCSVHeader40, (String(kRow31) + "\n").c_str());
   File beforeFile = LittleFS.open(kDataFile, "r");
   const size_t before = beforeFile ? beforeFile.size() : 0;
   if (beforeFile) beforeFile.close();
@@ -394,12 +515,15 @@ static void testUploadAckCompatibilityHookKeepsCurrentHistory() {
 static const char* kTxNamespaceForTest = "tx";
 
 // Every key saveCursor() writes. validateCursor() -> saveCursor() is the write
-// path that makes this necessary; the poison keys are not touched by it.
+// path that makes this necessary; the poison keys are not touched by it. The
+// fresh-lane case also writes the uploaded-range blob.
 struct SavedCursorNvs {
   bool     hadOffset, hadRows, hadLastUpload, hadRetry,
-           hadWake, hadNextAttempt, hadLocalRemoved;
+           hadWake, hadNextAttempt, hadLocalRemoved, hadRanges;
   uint32_t offset, rows, lastUpload, wake, nextAttempt, localRemoved;
   uint8_t  retry;
+  uint8_t  ranges[UploadQueue::kMaxUploadedRanges * sizeof(UploadedRange)];
+  size_t   rangesLen;
   bool     opened;
 };
 
@@ -418,6 +542,8 @@ static void backupCursorNvs(SavedCursorNvs& b) {
   b.hadWake         = p.isKey("wake_counter");  b.wake         = p.getUInt("wake_counter", 0);
   b.hadNextAttempt  = p.isKey("next_attempt");  b.nextAttempt  = p.getUInt("next_attempt", 0);
   b.hadLocalRemoved = p.isKey("local_removed"); b.localRemoved = p.getUInt("local_removed", 0);
+  b.hadRanges = p.isKey("up_ranges");
+  if (b.hadRanges) b.rangesLen = p.getBytes("up_ranges", b.ranges, sizeof(b.ranges));
   p.end();
 }
 
@@ -437,18 +563,20 @@ static void restoreCursorNvs(const SavedCursorNvs& b) {
   if (b.hadWake)         p.putUInt("wake_counter", b.wake);          else p.remove("wake_counter");
   if (b.hadNextAttempt)  p.putUInt("next_attempt", b.nextAttempt);   else p.remove("next_attempt");
   if (b.hadLocalRemoved) p.putUInt("local_removed", b.localRemoved); else p.remove("local_removed");
+  if (b.hadRanges) p.putBytes("up_ranges", b.ranges, b.rangesLen);   else p.remove("up_ranges");
 
   const bool restored =
       p.getUInt("cursor_offset", 0) == (b.hadOffset ? b.offset : 0) &&
       p.getUInt("rows_uploaded", 0) == (b.hadRows ? b.rows : 0) &&
       p.getUInt("last_upload", 0)   == (b.hadLastUpload ? b.lastUpload : 0) &&
-      p.getUChar("retry_count", 0)  == (b.hadRetry ? b.retry : 0);
+      p.getUChar("retry_count", 0)  == (b.hadRetry ? b.retry : 0) &&
+      p.isKey("up_ranges") == b.hadRanges;
   p.end();
   check("init: cursor NVS restored after the init cases", restored);
 }
 
 static void testInitIsIdempotent() {
-  writeDataFile(kCurrentCSVHeader35, (String(kRow31) + "\n").c_str());
+  writeDataFile(kCurrentCSVHeader40, (String(kRow31) + "\n").c_str());
 
   UploadQueue queue;
   check("init: first call succeeds", queue.init());
@@ -468,7 +596,7 @@ static void testInitIsIdempotent() {
 
 #ifdef UQ_TEST_INIT_FAILURE_HOOK
 static void testFailedInitIsRetryableAndConsumesNothing() {
-  writeDataFile(kCurrentCSVHeader35, (String(kRow31) + "\n").c_str());
+  writeDataFile(kCurrentCSVHeader40, (String(kRow31) + "\n").c_str());
 
   UploadQueue queue;
   UploadQueue::testForceInitFailure(true);
@@ -493,6 +621,135 @@ static void testFailedInitIsRetryableAndConsumesNothing() {
 }
 #endif
 
+// Freshness-first lane: after an outage the newest row of each node goes out
+// before the backlog, and the backfill then drains everything else exactly
+// once. Rows alternate between two nodes and are all the same length.
+static void testFreshLaneThenBackfill() {
+  constexpr int kRows = 40;
+  String rows;
+  String firstRow, lastRow;
+  for (int i = 0; i < kRows; ++i) {
+    String r = kRow31;
+    r.replace("ENV_A1", (i % 2) ? "ENV_B2" : "ENV_A1");
+    r.replace(",43,", String(",") + String(100 + i) + ",");
+    if (i == 0) firstRow = r;
+    if (i == kRows - 1) lastRow = r;
+    rows += r;
+    rows += "\n";
+  }
+  writeDataFile(kCurrentCSVHeader40, rows.c_str());
+  const uint32_t rowLen = firstRow.length() + 1;
+  const uint32_t headerEnd = strlen(kCurrentCSVHeader40) + 2;   // println CRLF
+  const uint32_t fileEnd = headerEnd + kRows * rowLen;
+
+  {
+    // A bench hub's own ranges would not fit this fixture; start clean.
+    Preferences p;
+    if (p.begin(kTxNamespaceForTest, false)) {
+      if (p.isKey("up_ranges")) p.remove("up_ranges");
+      p.end();
+    }
+  }
+  UploadQueue queue;
+  check("fresh: init succeeds", queue.init());
+  queue.advanceCursor(headerEnd, 0, 0);   // whole fixture is backlog
+
+  UploadPayload fresh = queue.getFreshData(600, 2);
+  check("fresh: window holds the newest row of each of the two nodes",
+        fresh.rowEstimate == 2 && fresh.byteLength == 2 * rowLen &&
+        fresh.startOffset == fileEnd - 2 * rowLen);
+  check("fresh: window carries the newest row, not the oldest",
+        fresh.csvData.indexOf(lastRow) >= 0 && fresh.csvData.indexOf(firstRow) < 0);
+  check("fresh: payload is prefixed with the header",
+        fresh.csvData.startsWith(kCurrentCSVHeader40));
+
+  check("fresh: window recorded as an uploaded range",
+        queue.markUploaded(fresh.startOffset, fresh.startOffset + fresh.byteLength, 1000, 2) &&
+        queue.uploadedRangeCount() == 1);
+  check("fresh: uploaded rows no longer count as pending",
+        queue.getPendingRows() == kRows - 2 &&
+        queue.getPendingBytes() == (kRows - 2) * rowLen);
+  check("fresh: nothing newer than the range - no second window",
+        queue.getFreshData(600, 2).byteLength == 0);
+
+  uint32_t sent = 0;
+  bool resent = false;
+  for (int guard = 0; guard < 100 && queue.getPendingRows() > 0; ++guard) {
+    UploadPayload p = queue.getNewData(600);
+    if (p.byteLength == 0) break;
+    if (p.csvData.indexOf(lastRow) >= 0) resent = true;
+    sent += p.rowEstimate;
+    queue.advanceCursor(p.startOffset + p.byteLength, 1000, p.rowEstimate);
+  }
+  check("fresh: backfill sends every other row exactly once",
+        sent == kRows - 2 && !resent);
+  check("fresh: cursor folds the range in and ends at EOF",
+        queue.getCursor().byteOffset == fileEnd && queue.uploadedRangeCount() == 0);
+
+  // No backlog: new rows just past the cursor go out through getNewData().
+  File f = LittleFS.open(kDataFile, "a");
+  if (f) {
+    f.print(firstRow + "\n" + lastRow + "\n");
+    f.close();
+  }
+  check("fresh: no window without a backlog behind it",
+        queue.getFreshData(600, 2).byteLength == 0);
+}
+
+// Pipelined backfill reads chunk N+1 before chunk N is acknowledged.
+static void testReadAheadFromOffset() {
+  constexpr int kRows = 10;
+  String rows;
+  String row0;
+  for (int i = 0; i < kRows; ++i) {
+    String r = kRow31;
+    r.replace(",43,", String(",") + String(200 + i) + ",");
+    if (i == 0) row0 = r;
+    rows += r;
+    rows += "\n";
+  }
+  writeDataFile(kCurrentCSVHeader40, rows.c_str());
+  const uint32_t rowLen = row0.length() + 1;
+  const uint32_t headerEnd = strlen(kCurrentCSVHeader40) + 2;   // println CRLF
+  const uint32_t rowAt = headerEnd;
+
+  {
+    Preferences p;
+    if (p.begin(kTxNamespaceForTest, false)) {
+      if (p.isKey("up_ranges")) p.remove("up_ranges");
+      p.end();
+    }
+  }
+  UploadQueue queue;
+  check("readahead: init succeeds", queue.init());
+  queue.advanceCursor(headerEnd, 0, 0);
+  // Rows 6-7 went out in a fresh window.
+  queue.markUploaded(rowAt + 6 * rowLen, rowAt + 8 * rowLen, 1000, 2);
+
+  UploadPayload n = queue.getNewData(2 * rowLen);
+  UploadPayload n1 = queue.getNewDataFrom(n.startOffset + n.byteLength, 3 * rowLen);
+  check("readahead: N+1 starts where N ends, cursor untouched",
+        n1.startOffset == rowAt + 2 * rowLen && n1.rowEstimate == 3 &&
+        queue.getCursor().byteOffset == headerEnd);
+  UploadPayload n2 = queue.getNewDataFrom(n1.startOffset + n1.byteLength, 4 * rowLen);
+  check("readahead: stops at an uploaded range",
+        n2.startOffset == rowAt + 5 * rowLen && n2.rowEstimate == 1);
+  UploadPayload n3 = queue.getNewDataFrom(n2.startOffset + n2.byteLength, 4 * rowLen);
+  check("readahead: a start at an uploaded range moves past it",
+        n3.startOffset == rowAt + 8 * rowLen && n3.rowEstimate == 2);
+  check("readahead: a start below the cursor is clamped to it",
+        queue.getNewDataFrom(0, rowLen).startOffset == headerEnd);
+
+  // Acknowledged in send order, the cursor folds the range in and reaches EOF.
+  queue.advanceCursor(n.startOffset + n.byteLength, 1000, n.rowEstimate);
+  queue.advanceCursor(n1.startOffset + n1.byteLength, 1000, n1.rowEstimate);
+  queue.advanceCursor(n2.startOffset + n2.byteLength, 1000, n2.rowEstimate);
+  check("readahead: range folded once the cursor reaches it",
+        queue.getCursor().byteOffset == n3.startOffset && queue.uploadedRangeCount() == 0);
+  queue.advanceCursor(n3.startOffset + n3.byteLength, 1000, n3.rowEstimate);
+  check("readahead: nothing pending after the last chunk", queue.getPendingRows() == 0);
+}
+
 // ---------------------------------------------------------------------------
 void setup() {
   Serial.begin(115200);
@@ -518,6 +775,7 @@ void setup() {
   testSchemaCurrentGate();
   testMixedWidthRowsParse();
   testStampedRowRoundTrip();
+  testCarryForwardCompletesRow();
   testOversizedRowIsRejectedNotOverflowed();
   testUploadAckCompatibilityHookKeepsCurrentHistory();
 
@@ -527,6 +785,8 @@ void setup() {
     SavedCursorNvs cursorBak;
     backupCursorNvs(cursorBak);
     testInitIsIdempotent();
+    testFreshLaneThenBackfill();
+    testReadAheadFromOffset();
 #ifdef UQ_TEST_INIT_FAILURE_HOOK
     testFailedInitIsRetryableAndConsumesNothing();
 #else
@@ -66,12 +66,14 @@ void setup() {
   removeIfPresent("/deploy.bin");
   removeIfPresent("/deploy.bak");
   removeIfPresent("/deploy.tmp");
+  removeIfPresent("/deploy.jnl");
   removeIfPresent("/deploy.v1");
   removeIfPresent("/deploy.v1.tmp");
 
   check("deploy.bin is gone", !LittleFS.exists("/deploy.bin"));
   check("deploy.bak is gone", !LittleFS.exists("/deploy.bak"));
   check("deploy.tmp is gone", !LittleFS.exists("/deploy.tmp"));
+  check("deploy.jnl is gone", !LittleFS.exists("/deploy.jnl"));
   check("deploy.v1 is gone", !LittleFS.exists("/deploy.v1"));
   check("deploy.v1.tmp is gone", !LittleFS.exists("/deploy.v1.tmp"));
 
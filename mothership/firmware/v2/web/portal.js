@@ -0,0 +1,424 @@
+// Full-screen loading overlay for page navigations + (non-async) form submits.
+// Makes the ESP32's page-render/transfer gap feel responsive instead of relying
+// on the browser's tiny built-in spinner. Async forms manage their own UI.
+(function(){
+  function ov(){ return document.getElementById('fm-load'); }
+  function show(msg){ var o=ov(); if(!o) return; var m=document.getElementById('fm-load-msg');
+    if(m && msg) m.textContent=msg; o.classList.add('show'); }
+  function hide(){ var o=ov(); if(o) o.classList.remove('show'); }
+  window.fmShowLoading=show; window.fmHideLoading=hide;
+  document.addEventListener('click', function(e){
+    var t=e.target; while(t && t.nodeType!==1) t=t.parentNode;
+    var a = (t && t.closest) ? t.closest('a') : null;
+    if(!a) return;
+    if(a.target==='_blank' || a.hasAttribute('download')) return;
+    if(e.metaKey||e.ctrlKey||e.shiftKey||e.button) return;
+    var href=a.getAttribute('href')||'';
+    if(!href || href.charAt(0)==='#' || href.lastIndexOf('javascript:',0)===0) return;
+    show('Loading…');
+  }, true);
+  document.addEventListener('submit', function(e){
+    var f=e.target;
+    if(f && f.classList && f.classList.contains('async-form')) return;  // handles own UI
+    show('Working…');
+  }, true);
+  window.addEventListener('pageshow', hide);   // incl. bfcache back/forward
+  document.addEventListener('DOMContentLoaded', hide);
+})();
+
+// Status messages: kind = 'ok' | 'warn' | 'err' | 'progress'. ARIA-live region.
+// Transient (ok/progress) auto-clear; errors persist until replaced.
+function showUiStatus(message, kind){
+  var box = document.getElementById('ui-status');
+  if (!box) return;
+  box.className = 'help s-' + (kind || 'ok');
+  box.style.display = 'block';
+  box.setAttribute('role','status');
+  box.textContent = message;
+  if (box._t){ clearTimeout(box._t); box._t = null; }
+  if (kind === 'ok' || kind === 'progress'){
+    box._t = setTimeout(function(){ box.style.display = 'none'; }, 4000);
+  }
+}
+
+function asFormBody(form){
+  var data = new FormData(form);
+  data.append('ajax', '1');
+  return new URLSearchParams(data);
+}
+
+// AbortController may be absent in very old captive-portal webviews — guard it
+// so polling/fetch still works (just without a hard timeout) on those.
+function fmAbort(){ return (typeof AbortController !== 'undefined') ? new AbortController() : null; }
+
+// Restrained connection indicator.
+function setConnection(state){
+  var el = document.getElementById('conn-status');
+  if (!el) return;
+  el.className = 'conn-dot' + (state==='updating' ? ' c-updating'
+                            : state==='warn' ? ' c-warn'
+                            : state==='err' ? ' c-err' : '');
+  el.textContent = state==='updating' ? 'Updating…'
+                 : state==='warn' ? 'Connection interrupted'
+                 : state==='err' ? 'Reconnecting…' : 'Connected';
+}
+
+// --- Async button loading states (contextual labels + inline spinner) ---
+function btnLabelFor(form, btn){
+  if (btn && btn.getAttribute('data-loading-label')) return btn.getAttribute('data-loading-label');
+  var a = (form && form.getAttribute('action')) || '';
+  if (a.indexOf('find-stations')>=0 || a.indexOf('discover')>=0) return 'Searching…';
+  if (a.indexOf('save')>=0 || a.indexOf('transmission')>=0) return 'Saving…';
+  if (a.indexOf('recording-interval')>=0 || a.indexOf('wake-interval')>=0) return 'Applying…';
+  if (a.indexOf('sync')>=0) return 'Updating…';
+  if (a.indexOf('manual-upload')>=0) return 'Uploading…';
+  if (a.indexOf('start')>=0 || a.indexOf('shutdown')>=0) return 'Starting…';
+  if (a.indexOf('set-time')>=0) return 'Setting time…';
+  return 'Working…';
+}
+function setBtnLoading(btn, label){
+  if (!btn) return;
+  if (btn._orig == null) btn._orig = (btn.tagName==='INPUT') ? btn.value : btn.innerHTML;
+  btn.disabled = true;
+  btn.setAttribute('aria-busy','true');
+  btn.classList.add('is-loading');
+  if (btn.tagName==='INPUT') btn.value = label || 'Working…';
+  else btn.innerHTML = '<span class="spinner" aria-hidden="true"></span>' + (label || 'Working…');
+}
+function clearBtnLoading(btn){
+  if (!btn) return;
+  btn.disabled = false;
+  btn.removeAttribute('aria-busy');
+  btn.classList.remove('is-loading','is-ok','is-err');
+  if (btn._orig != null){
+    if (btn.tagName==='INPUT') btn.value = btn._orig; else btn.innerHTML = btn._orig;
+    btn._orig = null;
+  }
+}
+function flashBtn(btn, ok){
+  if (!btn) return;
+  btn.classList.remove('is-loading');
+  btn.classList.add(ok ? 'is-ok' : 'is-err');
+}
+
+// --- Node cards: incremental, XSS-safe (textContent for device strings) ---
+function chipState(state, paused, pending, desiredTarget, ended, reportedPaused, deployUnconfirmed){
+  if (pending && Number(desiredTarget)===0) return ['chip chip--state-unpaired','Remove queued'];
+  // Ended outranks paused, matching the server-rendered chips. End queues
+  // STANDBY and keeps the node DEPLOYED, so every test below would otherwise
+  // call an archived deployment "Paused".
+  if (ended) return ['chip chip--bat-low','Ended'];
+  // An unconfirmed deploy outranks every queued-config label below it: the node
+  // has never acknowledged the deploy, so it is not hearing us at all and
+  // "Pause queued" / "Update queued" would imply a link that does not exist.
+  if (state==='DEPLOYED' && deployUnconfirmed) return ['chip chip--bat-low','Not confirmed'];
+  if (state==='DEPLOYED' && pending && Number(desiredTarget)===3) return ['chip chip--state-paused','Pause queued'];
+  // Only a node that is actually paused is resuming. A settings change leaves a
+  // pending desired config at targetState 2 as well, and calling that "Resume
+  // queued" reports a recovery from a pause that never happened.
+  if (state==='DEPLOYED' && pending && Number(desiredTarget)===2)
+    return reportedPaused ? ['chip chip--state-deployed','Resume queued']
+                          : ['chip chip--state-deployed','Update queued'];
+  if (state==='DEPLOYED') return paused ? ['chip chip--state-paused','Paused']
+                                        : ['chip chip--state-deployed','Active'];
+  if (state==='PAIRED')   return ['chip chip--state-paired','Connected'];
+  return ['chip chip--state-unpaired','New'];
+}
+function chipBatt(v){
+  if (v===null || v===undefined) return ['chip','n/a'];
+  var c = v>=3.9 ? 'chip chip--bat-ok' : v>=3.5 ? 'chip chip--bat-med' : 'chip chip--bat-low';
+  return [c, v.toFixed(2)+'V'];
+}
+function lastSeenTxt(sec){
+  if (sec===null || sec===undefined || sec<0) return 'n/a';
+  return Math.floor(sec/60) + ' min ago';
+}
+function nodeCell(parentClass, labelText, fieldName){
+  var d=document.createElement('div'); d.className=parentClass;
+  var l=document.createElement('span'); l.className='node-timing-label'; l.textContent=labelText;
+  var v=document.createElement('span'); v.setAttribute('data-f', fieldName);
+  d.appendChild(l); d.appendChild(v); return d;
+}
+function applyNodeFields(card, n){
+  if (card && card.dataset){ card.dataset.state=n.state||''; card.dataset.paused=n.paused?'1':'0'; }
+  var st=chipState(n.state, n.paused, n.pending, n.desiredTarget, n.deploymentEnded, n.reportedPaused, n.deployUnconfirmed), s=card.querySelector('[data-f="status"]');
+  if (s){ s.className=st[0]; s.textContent=st[1]; }
+  var bt=chipBatt(n.batV), b=card.querySelector('[data-f="batt"]');
+  if (b){ b.className=bt[0]; b.textContent=bt[1]; }
+  var r=card.querySelector('[data-f="rec"]'); if (r){ r.className='chip node-timing-value'; r.textContent=(n.recMin||0)+' min'; }
+  var ls=card.querySelector('[data-f="lastseen"]'); if (ls){ ls.className='chip node-timing-value'; ls.textContent=lastSeenTxt(n.lastSeenSec); }
+  var lbl=card.querySelector('[data-f="label"]'); if (lbl) lbl.textContent = n.label || n.id;
+}
+function nodeCardEl(n){
+  var wrap=document.createElement('div'); wrap.className='node-select-wrap node-new';
+  wrap.setAttribute('data-node-id', n.id);
+  var pick=document.createElement('label'); pick.className='node-select-control'; pick.title='Select node';
+  var cb=document.createElement('input'); cb.type='checkbox'; cb.name='node_id'; cb.value=n.id;
+  cb.className='node-select'; cb.setAttribute('form','batch-node-actions'); cb.setAttribute('aria-label','Select '+(n.label||n.id));
+  cb.addEventListener('change',function(){ if(window.updateBatchSelection) window.updateBatchSelection(cb); });
+  pick.appendChild(cb); wrap.appendChild(pick);
+  var a=document.createElement('a');
+  a.className='item item--node';
+  a.href='/station?id=' + encodeURIComponent(n.id);
+  var row=document.createElement('div'); row.className='node-row';
+  var main=document.createElement('div'); main.className='node-main';
+  var strong=document.createElement('strong'); strong.setAttribute('data-f','label'); main.appendChild(strong);
+  var status=document.createElement('div'); status.className='node-status';
+  status.appendChild(nodeCell('node-status-cell','Status','status'));
+  status.appendChild(nodeCell('node-status-cell','Battery','batt'));
+  var timing=document.createElement('div'); timing.className='node-timing';
+  timing.appendChild(nodeCell('node-timing-cell','Recording','rec'));
+  timing.appendChild(nodeCell('node-timing-cell','Last seen','lastseen'));
+  row.appendChild(main); row.appendChild(status); row.appendChild(timing);
+  a.appendChild(row); wrap.appendChild(a); applyNodeFields(wrap, n); return wrap;
+}
+function findCard(list, id){
+  var k=list.children;
+  for (var i=0;i<k.length;i++){ if (k[i].getAttribute && k[i].getAttribute('data-node-id')===id) return k[i]; }
+  return null;
+}
+// Update existing cards in place; append new ones (highlighted). We do NOT
+// remove cards that drop out of a poll — a node going briefly silent should not
+// make its card vanish; explicit unpair reloads the page.
+function reconcileNodes(nodes){
+  var list=document.getElementById('node-list');
+  if (!list || !nodes) return;
+  for (var i=0;i<nodes.length;i++){
+    var n=nodes[i], card=findCard(list, n.id);
+    if (!card) list.appendChild(nodeCardEl(n));
+    else applyNodeFields(card, n);
+  }
+  var empty=document.getElementById('node-empty');
+  if (empty) empty.style.display = nodes.length ? 'none' : '';
+}
+function updateKpis(f){
+  var set=function(id,v){ var e=document.getElementById(id); if (e && v!=null) e.textContent=String(v); };
+  set('kpi-deployed-num', f.active);
+  set('kpi-unpaired-num', f.new);
+}
+function setText(id,v){ var e=document.getElementById(id); if (e) e.textContent=v; }
+
+// --- Live poller: one timer, visibility-aware, failure backoff, no overlap ---
+// Polls the RAM-only /api/live endpoint. Cadence adapts: fast during discovery
+// or just after an action, slow when idle, paused when the tab is hidden. This
+// keeps steady-state load on the ESP32 low.
+var FM = {
+  timer:null, inFlight:false, fails:0, lastVersion:-1, discActive:false, fastUntil:0, started:false,
+  IDLE:4000, FAST:650, BUSY_WINDOW:4000,
+  start:function(){
+    if (this.started) return;
+    // Only poll on pages that actually display live data — keeps idle load off
+    // the ESP32 on static form-result pages.
+    if (!document.getElementById('conn-status') && !document.getElementById('node-list') &&
+        !document.getElementById('discovery-panel') && !document.getElementById('kpi-deployed-num')) return;
+    this.started=true;
+    document.addEventListener('visibilitychange', function(){
+      if (document.hidden) FM.clear(); else FM.bump();
+    });
+    this.tick();
+  },
+  clear:function(){ if (this.timer){ clearTimeout(this.timer); this.timer=null; } },
+  delay:function(){
+    if (document.hidden) return 0;
+    if (this.fails>0) return Math.min(8000, 1000*Math.pow(2, this.fails-1));
+    return (this.discActive || Date.now()<this.fastUntil) ? this.FAST : this.IDLE;
+  },
+  schedule:function(){ this.clear(); var d=this.delay(); if (d>0) this.timer=setTimeout(function(){FM.tick();}, d); },
+  bump:function(){ this.fastUntil=Date.now()+this.BUSY_WINDOW; this.clear(); this.tick(); },
+  startDiscoveryUi:function(){ this.discActive=true; var p=document.getElementById('discovery-panel'); if(p) p.hidden=false; this.bump(); },
+  tick:function(){
+    if (this.inFlight || document.hidden){ this.schedule(); return; }
+    this.inFlight=true;
+    if (this.fails===0) setConnection('updating');
+    var ctrl=fmAbort(); var to=ctrl?setTimeout(function(){ctrl.abort();},4000):null;
+    fetch('/api/live', {cache:'no-store', signal:ctrl?ctrl.signal:undefined})
+      .then(function(r){ if(!r.ok) throw new Error('HTTP '+r.status); return r.json(); })
+      .then(function(d){ if(to)clearTimeout(to); FM.fails=0; setConnection('ok'); FM.apply(d); })
+      .catch(function(_){ if(to)clearTimeout(to); FM.fails++; setConnection(FM.fails>2?'err':'warn'); })
+      .then(function(){ FM.inFlight=false; FM.schedule(); });
+  },
+  apply:function(d){
+    var disc = d.discovery || {};
+    if (disc.active){
+      this.discActive=true;
+      var p=document.getElementById('discovery-panel'); if(p){ p.hidden=false; if(p._h){clearTimeout(p._h);p._h=null;} }
+      setText('dp-state','Searching');
+      setText('dp-elapsed', Math.floor((disc.elapsedMs||0)/1000)+'s');
+      setText('dp-found', String(disc.foundThisScan||0));
+      var fb=document.getElementById('find-btn');
+      if (fb && !fb.classList.contains('is-loading')) setBtnLoading(fb,'Searching for nodes…');
+    } else if (this.discActive){
+      this.discActive=false;
+      this.onDiscoveryDone(disc);
+    }
+    if (d.version !== this.lastVersion){
+      this.lastVersion = d.version;
+      if (d.fleet) updateKpis(d.fleet);
+      if (d.nodes) reconcileNodes(d.nodes);
+    }
+  },
+  onDiscoveryDone:function(disc){
+    var found = disc ? (disc.foundThisScan||0) : 0, res = disc ? disc.result : 0;
+    var msg = res===1 ? (found+' new node'+(found===1?'':'s')+' found')
+            : res===2 ? 'No new nodes found'
+            : res===3 ? 'Discovery failed'
+            : res===4 ? 'Discovery timed out' : 'Discovery complete';
+    showUiStatus(msg, res===1?'ok':'warn');
+    setText('dp-state', msg);
+    var fb=document.getElementById('find-btn'); if (fb) clearBtnLoading(fb);
+    var p=document.getElementById('discovery-panel');
+    if (p){ if (p._h) clearTimeout(p._h); p._h=setTimeout(function(){p.hidden=true;p._h=null;}, 4500); }
+    this.lastVersion = -1;  // force one more KPI/node refresh after the scan
+  }
+};
+
+function wireAsyncForms(){
+  var forms = document.querySelectorAll('form.async-form');
+  for (var i=0;i<forms.length;i++){
+    (function(form){
+      if (form._wired) return; form._wired = true;
+      form.addEventListener('submit', function(e){
+        e.preventDefault();
+        var btn = form.querySelector('button[type="submit"],input[type="submit"]');
+        if (btn && btn.disabled) return;  // prevent duplicate submission
+        var action = form.getAttribute('action') || '';
+        var isFind = action.indexOf('find-stations')>=0 || action.indexOf('discover')>=0;
+        var isStart = action.indexOf('/start')>=0;
+        setBtnLoading(btn, btnLabelFor(form, btn));
+        if (isFind) FM.startDiscoveryUi();  // immediate panel + fast polling
+        if (isStart) showUiStatus('Syncing to dashboard… this takes 30-60s', 'progress');
+
+        var ctrl = fmAbort();
+        // /start runs a blocking modem upload (30-60s) before responding — the
+        // default 15s timeout would abort it mid-upload. Give it 120s.
+        var timeoutMs = isStart ? 120000 : 15000;
+        var to = ctrl ? setTimeout(function(){ ctrl.abort(); }, timeoutMs) : null;
+        fetch(form.action, {method:'POST', body:asFormBody(form),
+              headers:{'Content-Type':'application/x-www-form-urlencoded'},
+              signal: ctrl?ctrl.signal:undefined})
+          .then(function(r){ return r.text().then(function(t){ return {ok:r.ok, t:t}; }); })
+          .then(function(res){
+            if (to) clearTimeout(to);
+            var ok = res.ok, msg = res.t;
+            try { var j = JSON.parse(res.t); ok = !!j.ok; msg = j.message || (ok?'Done':'Request failed'); } catch(_){}
+            if (isFind){
+              // Discovery now runs server-side; the live poller owns the button,
+              // panel and node list. No full-page reload.
+              showUiStatus(ok ? 'Searching for nodes…' : ('Discovery failed: '+msg), ok?'progress':'err');
+              if (!ok) clearBtnLoading(btn);
+              FM.bump();
+            } else if (isStart) {
+              // Finish & Start Recording: the upload + shutdown is done. Show a
+              // persistent "Finished" state on the button so the operator knows
+              // the board is about to power down, and a clear status message.
+              showUiStatus(msg, ok?'ok':'err');
+              if (btn){
+                btn.classList.remove('is-loading');
+                btn.classList.add(ok ? 'is-ok' : 'is-err');
+                btn.textContent = ok ? '✓ Finished — powering down' : '✗ Sync failed — powering down';
+                btn.disabled = true;  // stay disabled — the board is shutting down
+              }
+              FM.bump();
+            } else {
+              showUiStatus(msg, ok?'ok':'err');
+              flashBtn(btn, ok);
+              setTimeout(function(){ clearBtnLoading(btn); }, ok?700:1200);
+              FM.bump();  // promptly refresh KPIs/nodes after the action
+            }
+          })
+          .catch(function(err){
+            if (to) clearTimeout(to);
+            var aborted = err && err.name==='AbortError';
+            showUiStatus(aborted ? 'Request timed out — check connection' : ('Request failed: '+err), 'err');
+            if (btn && !isFind){ flashBtn(btn,false); setTimeout(function(){clearBtnLoading(btn);},1200); }
+            else if (isFind) clearBtnLoading(btn);
+          });
+      });
+    })(forms[i]);
+  }
+}
+
+function setCurrentTime(){
+  const n=new Date();
+  const z=n=>String(n).padStart(2,'0');
+  const s=`${z(n.getUTCHours())}:${z(n.getUTCMinutes())}:${z(n.getUTCSeconds())} ${z(n.getUTCDate())}-${z(n.getUTCMonth()+1)}-${n.getUTCFullYear()}`;
+  const el=document.getElementById('datetime'); if(el) el.value=s;
+}
+const MONTH_SHORT=['Jan','Feb','Mar','Apr','May','Jun','Jul','Aug','Sep','Oct','Nov','Dec'];
+function formatHubClock(ms){
+  const dt=new Date(ms);
+  return `${String(dt.getUTCHours()).padStart(2,'0')}:${String(dt.getUTCMinutes()).padStart(2,'0')} · ${String(dt.getUTCDate()).padStart(2,'0')} ${MONTH_SHORT[dt.getUTCMonth()]} ${dt.getUTCFullYear()}`;
+}
+function toggleSettings(){
+  const panel=document.getElementById('settings-panel');
+  if(!panel) return;
+  const showing=panel.style.display==='block';
+  panel.style.display = showing ? 'none' : 'block';
+}
+function toggleGlobalInterval(){
+  const panel=document.getElementById('global-interval-panel');
+  if(!panel) return;
+  const showing=panel.style.display==='block';
+  panel.style.display = showing ? 'none' : 'block';
+}
+function toggleInfoPanel(){
+  const panel=document.getElementById('info-panel');
+  if(!panel) return;
+  const showing=panel.style.display==='block';
+  panel.style.display = showing ? 'none' : 'block';
+}
+// Silently tell the hub what the browser's local UTC offset is, so
+// getRTCTimeString()/formatDateTimeDisplay() render local time. Display-only:
+// the RTC itself is never touched here (that's the separate /set-time flow).
+// Fires on every load so a DST change corrects itself on the next visit.
+function syncLocalDisplayOffset(){
+  const offsetMin = -(new Date().getTimezoneOffset());
+  const b = 'offset=' + encodeURIComponent(offsetMin) + '&ajax=1';
+  fetch('/set-utc-offset', {method:'POST', headers:{'Content-Type':'application/x-www-form-urlencoded'}, body:b})
+    .catch(function(){});
+}
+window.addEventListener('DOMContentLoaded', () => {
+  setCurrentTime();
+  syncLocalDisplayOffset();
+  wireAsyncForms();
+  FM.start();   // begin adaptive /api/live polling (drives KPIs, nodes, discovery, connection)
+});
+
+(function(){
+  function parseHubClock(str){
+    if (!str) return NaN;
+    // Accept "HH:MM · DD Mon YYYY" or legacy "HH:MM:SS DD-MM-YYYY"
+    const m = str.match(/^(\d{2}):(\d{2})(?::(\d{2}))?\s*[\u00b7\-]\s*(\d{1,2})\s+([A-Za-z]{3})\s+(\d{4})$/);
+    if (m){
+      const mon = MONTH_SHORT.indexOf(m[5]);
+      if (mon < 0) return NaN;
+      const value = Date.UTC(+m[6], mon, +m[4], +m[1], +m[2], m[3] ? +m[3] : 0);
+      return isNaN(value) ? NaN : value;
+    }
+    if (str.length >= 19){
+      const H = +str.slice(0,2), M = +str.slice(3,5), S = +str.slice(6,8);
+      const d = +str.slice(9,11), mo = +str.slice(12,14), y = +str.slice(15,19);
+      const value = Date.UTC(y, mo-1, d, H, M, S);
+      return isNaN(value) ? NaN : value;
+    }
+    return NaN;
+  }
+  function startClock(){
+    const el = document.getElementById('rtc-now');
+    if (!el) return;
+    const initial = (el.textContent || '').trim();
+    const rtcMs   = parseHubClock(initial);
+    const offset  = isNaN(rtcMs) ? 0 : (rtcMs - Date.now());
+    function draw(){
+      const nowMs = Date.now() + offset;
+      el.textContent = formatHubClock(nowMs);
+    }
+    draw();
+    setInterval(draw, 1000);
+  }
+  if (document.readyState === 'loading'){
+    document.addEventListener('DOMContentLoaded', startClock);
+  } else {
+    startClock();
+  }
+})();
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdint.h>
+
+// Two-way clock exchange arithmetic (CLOCK_PROBE / CLOCK_REPLY, protocol.h).
+//
+// Pure arithmetic — no Arduino — so the node, the mothership and the native
+// host test (tests/test_clock_sync.cpp) run the same code. All timestamps are
+// unix milliseconds; t1/t4 are read on the node clock, t2/t3 on the
+// mothership clock.
+//
+// The node runs a few probes per session and keeps the sample with the
+// smallest round trip: its offset error is bounded by half that delay. After
+// correcting the RTC it records the fix time, so the offset measured at the
+// next session divided by the time in between is the crystal's rate error.
+// That error is fed back into the DS3231 aging register a half-step at a time.
+
+namespace clock_sync {
+
+// A sample with a longer round trip than this is discarded: the reply queued
+// behind other traffic and its midpoint says little about either clock.
+constexpr uint32_t kMaxDelayMs = 250;
+
+// Offsets at or below this are left alone; a step costs a wait for the next
+// mothership second edge and buys nothing the read-out jitter would not undo.
+constexpr int32_t kStepThresholdMs = 8;
+
+// Drift is only estimated over at least this span. The previous fix's
+// residual (a few ms) over four hours is ~0.2 ppm, about two aging LSBs.
+constexpr uint32_t kMinDriftSpanSec = 4UL * 3600UL;
+
+// DS3231 aging offset: ~0.1 ppm per LSB at 25 °C, positive slows the clock.
+constexpr int16_t kCentiPpmPerAgingLsb = 10;
+constexpr int8_t  kMaxAgingStep = 12;
+
+// Worst-case rate the mothership assumes for a node with no drift history
+// (DS3231 0–40 °C spec), and for one whose drift is known, the margin kept on
+// top of the measured rate.
+constexpr uint32_t kUnknownDriftCentiPpm = 200;
+constexpr uint32_t kDriftMarginCentiPpm = 50;
+
+struct Sample {
+  int32_t  offsetMs = 0;   // mothership minus node
+  uint32_t delayMs = 0;    // round trip excluding mothership turnaround
+  bool     valid = false;
+};
+
+// Build one sample from the four timestamps. Returns an invalid sample when
+// the timestamps are inconsistent (a clock went backwards, a reply from an
+// earlier probe) or the round trip is too long to be useful.
+inline Sample sampleFrom(int64_t t1, int64_t t2, int64_t t3, int64_t t4) {
+  Sample s;
+  if (t4 < t1 || t3 < t2) return s;
+  int64_t delay = (t4 - t1) - (t3 - t2);
+  if (delay < 0) delay = 0;  // ms rounding on either side
+  if (delay > (int64_t)kMaxDelayMs) return s;
+  const int64_t sum = (t2 - t1) + (t3 - t4);
+  // Round half away from zero so a symmetric ±1 ms split does not bias.
+  const int64_t offset = (sum >= 0) ? (sum + 1) / 2 : -((-sum + 1) / 2);
+  if (offset > INT32_MAX || offset < INT32_MIN) return s;
+  s.offsetMs = (int32_t)offset;
+  s.delayMs = (uint32_t)delay;
+  s.valid = true;
+  return s;
+}
+
+// Keep the lower-delay sample of `best` and `candidate`.
+inline void keepBest(Sample& best, const Sample& candidate) {
+  if (!candidate.valid) return;
+  if (!best.valid || candidate.delayMs < best.delayMs) best = candidate;
+}
+
+// Uncertainty left after stepping to `s`: half the round trip plus the
+// millisecond read-out on each side.
+inline uint32_t residualMs(const Sample& s) {
+  return s.valid ? (s.delayMs + 1) / 2 + 2 : 0;
+}
+
+// Rate error in 0.01 ppm, positive when the node runs fast, from the offset
+// measured `elapsedSec` after the last fix. Returns false when the span is too
+// short for a meaningful estimate.
+inline bool driftCentiPpm(int32_t offsetMs, uint32_t elapsedSec, int16_t& out) {
+  if (elapsedSec < kMinDriftSpanSec) return false;
+  // node fast => node ahead => offset (mothership - node) negative.
+  int64_t cppm = -(int64_t)offsetMs * 100000LL / (int64_t)elapsedSec;
+  if (cppm > INT16_MAX) cppm = INT16_MAX;
+  if (cppm < INT16_MIN) cppm = INT16_MIN;
+  out = (int16_t)cppm;
+  return true;
+}
+
+// Next DS3231 aging register value. Corrects half the measured error per
+// session (one noisy span cannot swing the oscillator), at most
+// kMaxAgingStep LSBs, within the register's int8 range.
+inline int8_t nextAgingOffset(int8_t current, int16_t driftCentiPpm) {
+  int32_t step = driftCentiPpm / (2 * kCentiPpmPerAgingLsb);
+  if (step > kMaxAgingStep) step = kMaxAgingStep;
+  if (step < -kMaxAgingStep) step = -kMaxAgingStep;
+  int32_t next = (int32_t)current + step;
+  if (next > 127) next = 127;
+  if (next < -127) next = -127;
+  return (int8_t)next;
+}
+
+// How far a node's clock may be from the mothership `elapsedSec` after a fix
+// with `residualMs` uncertainty, given its measured drift (or none).
+inline uint32_t skewBoundMs(uint32_t residualMs, bool driftKnown,
+                            int16_t driftCentiPpm, uint32_t elapsedSec) {
+  uint32_t rate = kUnknownDriftCentiPpm;
+  if (driftKnown) {
+    const int32_t d = driftCentiPpm < 0 ? -(int32_t)driftCentiPpm : driftCentiPpm;
+    rate = (uint32_t)d + kDriftMarginCentiPpm;
+    if (rate > kUnknownDriftCentiPpm) rate = kUnknownDriftCentiPpm;
+  }
+  // centi-ppm * s = 1e-8 s = 1e-5 ms
+  const uint64_t driftMs = ((uint64_t)rate * elapsedSec + 99999ULL) / 100000ULL;
+  const uint64_t total = (uint64_t)residualMs + driftMs;
+  return total > UINT32_MAX ? UINT32_MAX : (uint32_t)total;
+}
+
+}  // namespace clock_sync
@@ -1,9 +1,18 @@
 #include "command_dispatcher.h"
 #include <Preferences.h>
+#include <stddef.h>
 #include <string.h>
 
 // ---------------------------------------------------------------------------
 // In-RAM authoritative state (mirrored to NVS on every accepted change).
+//
+// NVS layout (version 3): a small A/B header ("state_a"/"state_b") carries the
+// revision, global slot and result ring, and one record per node lives under
+// "nXX". A commit writes the header with a redo copy of every node it touched,
+// then rewrites only those node keys, so the cost of an accepted command no
+// longer scales with the table size. Node keys plus the newest header's redo
+// entries are always the committed state; a reset between the two writes is
+// repaired on the next dispatcherInit().
 // ---------------------------------------------------------------------------
 struct NodeSlot {
   DispatchNodeConfig cfg;
@@ -32,8 +41,15 @@ struct LegacyNodeSlot {
   bool     converged;
 };
 
+// Table size of every pre-V3 layout. Frozen so old records still parse after
+// CMD_MAX_NODES grows.
+static constexpr uint8_t kLegacyNodes = 16;
+static_assert(CMD_MAX_NODES >= kLegacyNodes && CMD_MAX_NODES <= 64,
+              "CMD_MAX_NODES must fit the legacy table and the dirty bitmap");
+
 static uint32_t      gRevision = 0;
 static NodeSlot      gNodes[CMD_MAX_NODES];
+static uint64_t      gDirtyNodes = 0;   // node keys behind RAM (covered by header redo)
 static CommandResult gResults[CMD_MAX_RESULTS];
 static uint8_t       gResultHead = 0;   // next write index (ring)
 static uint8_t       gResultCount = 0;
@@ -45,7 +61,11 @@ static const char*   kNs = "dispatch";
 static const char*   kStateA = "state_a";
 static const char*   kStateB = "state_b";
 static constexpr uint32_t kStateMagic = 0x464D4453UL;  // FMDS
-static constexpr uint16_t kStateVersion = 2;
+static constexpr uint16_t kStateVersion = 3;
+static constexpr uint32_t kNodeMagic = 0x464D444EUL;   // FMDN
+// A batch touches at most CMD_MAX_RESULTS nodes; the slack absorbs node keys
+// left behind by a failed flash write until the next commit retries them.
+static constexpr uint8_t  kRedoMax = 2 * CMD_MAX_RESULTS;
 
 struct DispatcherStateRecordV1 {
   uint32_t      magic;
@@ -53,7 +73,7 @@ struct DispatcherStateRecordV1 {
   uint16_t      size;
   uint32_t      generation;
   uint32_t      revision;
-  NodeSlot      nodes[CMD_MAX_NODES];
+  NodeSlot      nodes[kLegacyNodes];
   CommandResult results[CMD_MAX_RESULTS];
   uint8_t       resultHead;
   uint8_t       resultCount;
@@ -62,13 +82,13 @@ struct DispatcherStateRecordV1 {
   uint32_t      checksum;
 };
 
-struct DispatcherStateRecord {
+struct DispatcherStateRecordV2 {
   uint32_t      magic;
   uint16_t      version;
   uint16_t      size;
   uint32_t      generation;
   uint32_t      revision;
-  NodeSlot      nodes[CMD_MAX_NODES];
+  NodeSlot      nodes[kLegacyNodes];
   GlobalSlot    global;
   CommandResult results[CMD_MAX_RESULTS];
   uint8_t       resultHead;
@@ -78,6 +98,38 @@ struct DispatcherStateRecord {
   uint32_t      checksum;
 };
 
+struct NodeRedo {
+  uint8_t  index;
+  uint8_t  reserved[3];
+  NodeSlot slot;
+};
+
+// Stored with only redoCount redo entries; size is the stored byte length and
+// the checksum covers exactly those bytes.
+struct DispatcherStateRecord {
+  uint32_t      magic;
+  uint16_t      version;
+  uint16_t      size;
+  uint32_t      generation;
+  uint32_t      revision;
+  GlobalSlot    global;
+  CommandResult results[CMD_MAX_RESULTS];
+  uint8_t       resultHead;
+  uint8_t       resultCount;
+  uint8_t       lastChangeSource;
+  uint8_t       redoCount;
+  uint32_t      checksum;
+  NodeRedo      redo[kRedoMax];
+};
+
+static constexpr size_t kRecordFixedBytes = offsetof(DispatcherStateRecord, redo);
+
+struct NodeRecord {
+  uint32_t magic;
+  NodeSlot slot;
+  uint32_t checksum;   // seeded with the key index
+};
+
 static GlobalSlot gGlobal{};
 
 const char* cmdOutcomeStr(CmdOutcome o) {
@@ -92,42 +144,72 @@ const char* cmdOutcomeStr(CmdOutcome o) {
   }
 }
 
-static uint32_t checksumFor(DispatcherStateRecord record) {
-  record.checksum = 0;
-  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
-  uint32_t hash = 2166136261UL;
-  for (size_t i = 0; i < sizeof(record); ++i) {
+static uint32_t fnv1a(const void* data, size_t length,
+                      uint32_t hash = 2166136261UL) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < length; ++i) {
     hash ^= bytes[i];
     hash *= 16777619UL;
   }
   return hash;
 }
 
+static uint32_t checksumFor(const DispatcherStateRecord& record) {
+  const uint32_t zero = 0;
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
+  const size_t at = offsetof(DispatcherStateRecord, checksum);
+  uint32_t hash = fnv1a(bytes, at);
+  hash = fnv1a(&zero, sizeof(zero), hash);
+  return fnv1a(bytes + at + sizeof(zero), record.size - at - sizeof(zero), hash);
+}
+
+static uint32_t checksumForNode(const NodeRecord& record, uint8_t index) {
+  return fnv1a(&record, offsetof(NodeRecord, checksum),
+               2166136261UL ^ (uint32_t)(index + 1U) * 16777619UL);
+}
+
+static uint32_t checksumForV2(DispatcherStateRecordV2 record) {
+  record.checksum = 0;
+  return fnv1a(&record, sizeof(record));
+}
+
 static uint32_t checksumForV1(DispatcherStateRecordV1 record) {
   record.checksum = 0;
-  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
-  uint32_t hash = 2166136261UL;
-  for (size_t i = 0; i < sizeof(record); ++i) {
-    hash ^= bytes[i];
-    hash *= 16777619UL;
-  }
-  return hash;
+  return fnv1a(&record, sizeof(record));
 }
 
-static bool validRecord(const DispatcherStateRecord& record) {
-  return record.magic == kStateMagic && record.version == kStateVersion &&
-         record.size == sizeof(record) &&
-         record.resultHead < CMD_MAX_RESULTS &&
-         record.resultCount <= CMD_MAX_RESULTS &&
-         record.lastChangeSource <= SRC_DASHBOARD &&
-         record.checksum == checksumFor(record);
+static bool validRecord(const DispatcherStateRecord& record, size_t length) {
+  if (record.magic != kStateMagic || record.version != kStateVersion ||
+      record.size != length || record.redoCount > kRedoMax ||
+      length != kRecordFixedBytes + record.redoCount * sizeof(NodeRedo) ||
+      record.resultHead >= CMD_MAX_RESULTS ||
+      record.resultCount > CMD_MAX_RESULTS ||
+      record.lastChangeSource > SRC_DASHBOARD ||
+      record.checksum != checksumFor(record)) return false;
+  for (uint8_t i = 0; i < record.redoCount; ++i) {
+    if (record.redo[i].index >= CMD_MAX_NODES) return false;
+  }
+  return true;
 }
 
 static bool readRecord(Preferences& prefs, const char* key,
                        DispatcherStateRecord& record) {
+  const size_t length = prefs.getBytesLength(key);
+  return length >= kRecordFixedBytes && length <= sizeof(record) &&
+         prefs.getBytes(key, &record, length) == length &&
+         validRecord(record, length);
+}
+
+static bool readRecordV2(Preferences& prefs, const char* key,
+                         DispatcherStateRecordV2& record) {
   return prefs.getBytesLength(key) == sizeof(record) &&
          prefs.getBytes(key, &record, sizeof(record)) == sizeof(record) &&
-         validRecord(record);
+         record.magic == kStateMagic && record.version == 2 &&
+         record.size == sizeof(record) &&
+         record.resultHead < CMD_MAX_RESULTS &&
+         record.resultCount <= CMD_MAX_RESULTS &&
+         record.lastChangeSource <= SRC_DASHBOARD &&
+         record.checksum == checksumForV2(record);
 }
 
 static bool readRecordV1(Preferences& prefs, const char* key,
@@ -146,47 +228,170 @@ static bool generationNewer(uint32_t a, uint32_t b) {
   return static_cast<int32_t>(a - b) > 0;
 }
 
-// ---- NVS persistence (checksummed A/B durable state) ----------------------
+// ---- nodeId index ----------------------------------------------------------
+// Linear-probed, like the mothership NodeRegistry. Slots are never freed (a
+// node, once tracked, stays tracked), so there are no tombstones; the index is
+// rebuilt wholesale on load, reset and batch rollback.
+static constexpr size_t  kIndexSlots = 128;
+static constexpr uint8_t kIndexEmpty = 0xFF;
+static_assert(kIndexSlots >= 2 * CMD_MAX_NODES &&
+              (kIndexSlots & (kIndexSlots - 1)) == 0,
+              "index must be a power of two, at least twice CMD_MAX_NODES");
+static uint8_t gIndex[kIndexSlots];
+static uint8_t gNodeCount = 0;
+
+static size_t hashNodeId(const char* nodeId) {
+  const uint32_t h = fnv1a(nodeId, strnlen(nodeId, CMD_NODEID_LEN));
+  return (size_t)(h ^ (h >> 16));
+}
+
+static void indexInsert(uint8_t i) {
+  for (size_t h = hashNodeId(gNodes[i].cfg.nodeId); ; ++h) {
+    uint8_t& slot = gIndex[h & (kIndexSlots - 1)];
+    if (slot == kIndexEmpty) { slot = i; break; }
+  }
+  ++gNodeCount;
+}
+
+static void rebuildIndex() {
+  memset(gIndex, kIndexEmpty, sizeof gIndex);
+  gNodeCount = 0;
+  for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
+    if (gNodes[i].inUse) indexInsert(i);
+  }
+}
+
+static void markDirty(const NodeSlot* n) {
+  gDirtyNodes |= 1ULL << (n - gNodes);
+}
+
+static uint8_t dirtyCount(uint64_t mask) {
+  uint8_t n = 0;
+  for (; mask; mask &= mask - 1) ++n;
+  return n;
+}
+
+static void nodeKey(uint8_t index, char out[4]) {
+  snprintf(out, 4, "n%02u", (unsigned)index);
+}
+
+// ---- NVS persistence (checksummed A/B header + per-node records) -----------
+static bool readNode(Preferences& prefs, uint8_t index, NodeSlot& slot) {
+  char key[4];
+  nodeKey(index, key);
+  NodeRecord record{};
+  if (prefs.getBytesLength(key) != sizeof(record) ||
+      prefs.getBytes(key, &record, sizeof(record)) != sizeof(record) ||
+      record.magic != kNodeMagic ||
+      record.checksum != checksumForNode(record, index)) return false;
+  slot = record.slot;
+  return true;
+}
+
+// Rewrite the node keys still behind RAM; bits clear only once read back. The
+// current header already carries every dirty node in its redo list, so a
+// failure here loses nothing.
+static bool flushDirtyNodes() {
+  if (!gDirtyNodes) return true;
+  if (!gNvs.begin(kNs, false)) return false;
+  const uint64_t pending = gDirtyNodes;
+  for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
+    if (!(pending & (1ULL << i))) continue;
+    char key[4];
+    nodeKey(i, key);
+    if (!gNodes[i].inUse) {
+      if (!gNvs.isKey(key) || gNvs.remove(key)) gDirtyNodes &= ~(1ULL << i);
+      continue;
+    }
+    NodeRecord record{};
+    record.magic = kNodeMagic;
+    record.slot = gNodes[i];
+    record.checksum = checksumForNode(record, i);
+    NodeSlot verify{};
+    if (gNvs.putBytes(key, &record, sizeof(record)) == sizeof(record) &&
+        readNode(gNvs, i, verify) &&
+        memcmp(&verify, &gNodes[i], sizeof(verify)) == 0) {
+      gDirtyNodes &= ~(1ULL << i);
+    }
+  }
+  gNvs.end();
+  return gDirtyNodes == 0;
+}
+
 static bool persist() {
+  if (dirtyCount(gDirtyNodes) > kRedoMax) return false;
   DispatcherStateRecord candidate{};
   candidate.magic = kStateMagic;
   candidate.version = kStateVersion;
-  candidate.size = sizeof(candidate);
   candidate.generation = gGeneration + 1U;
   candidate.revision = gRevision;
-  memcpy(candidate.nodes, gNodes, sizeof(gNodes));
   candidate.global = gGlobal;
   memcpy(candidate.results, gResults, sizeof(gResults));
   candidate.resultHead = gResultHead;
   candidate.resultCount = gResultCount;
   candidate.lastChangeSource = static_cast<uint8_t>(gLastChangeSource);
+  for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
+    if (!(gDirtyNodes & (1ULL << i))) continue;
+    NodeRedo& redo = candidate.redo[candidate.redoCount++];
+    redo.index = i;
+    redo.slot = gNodes[i];
+  }
+  const size_t length =
+      kRecordFixedBytes + candidate.redoCount * sizeof(NodeRedo);
+  candidate.size = static_cast<uint16_t>(length);
   candidate.checksum = checksumFor(candidate);
   const char* key = (candidate.generation & 1U) ? kStateA : kStateB;
 
   if (!gNvs.begin(kNs, false)) return false;
   // A/B means this key is the older redundant copy. Remove it before writing
-  // the larger replacement so NVS can reclaim its blob pages instead of
-  // needing space for three simultaneous copies during schema migration.
+  // the replacement so NVS can reclaim its blob pages instead of needing
+  // space for three simultaneous copies.
   if (gNvs.isKey(key)) gNvs.remove(key);
-  const bool wrote = gNvs.putBytes(key, &candidate, sizeof(candidate)) ==
-                     sizeof(candidate);
+  const bool wrote = gNvs.putBytes(key, &candidate, length) == length;
   gNvs.end();
   if (!wrote || !gNvs.begin(kNs, true)) return false;
   DispatcherStateRecord verify{};
   const bool verified = readRecord(gNvs, key, verify) &&
-                        memcmp(&verify, &candidate, sizeof(candidate)) == 0;
+                        memcmp(&verify, &candidate, length) == 0;
   gNvs.end();
-  if (verified) gGeneration = candidate.generation;
-  return verified;
+  if (!verified) return false;
+  gGeneration = candidate.generation;
+  // The header is the commit point; node keys catching up is best-effort.
+  flushDirtyNodes();
+  return true;
 }
 
-void dispatcherInit() {
+static void loadLegacyNodes(const NodeSlot* nodes) {
+  memcpy(gNodes, nodes, sizeof(NodeSlot) * kLegacyNodes);
+  gDirtyNodes = (1ULL << kLegacyNodes) - 1U;
+}
+
+// Legacy layouts become V3 by writing every node key first, then the header
+// into the older A/B key; until that header lands the legacy record still
+// wins on the next boot. The stale legacy copy is removed last.
+static bool completeMigration() {
+  if (!flushDirtyNodes() || !persist()) return false;
+  const char* stale = (gGeneration & 1U) ? kStateB : kStateA;
+  if (gNvs.begin(kNs, false)) {
+    if (gNvs.isKey(stale)) gNvs.remove(stale);
+    gNvs.end();
+  }
+  return true;
+}
+
+static void clearState() {
   memset(gNodes, 0, sizeof gNodes);
   memset(&gGlobal, 0, sizeof gGlobal);
   memset(gResults, 0, sizeof gResults);
   gRevision = 0; gResultHead = 0; gResultCount = 0;
   gLastChangeSource = SRC_LOCAL_UI;
   gGeneration = 0;
+  gDirtyNodes = 0;
+}
+
+void dispatcherInit() {
+  clearState();
+  rebuildIndex();
 
   if (!gNvs.begin(kNs, true)) return;
   DispatcherStateRecord a{}, b{};
@@ -197,7 +402,6 @@ void dispatcherInit() {
         aValid && bValid ? (generationNewer(b.generation, a.generation) ? b : a)
                          : (aValid ? a : b);
     gRevision = selected.revision;
-    memcpy(gNodes, selected.nodes, sizeof(gNodes));
     gGlobal = selected.global;
     memcpy(gResults, selected.results, sizeof(gResults));
     gResultHead = selected.resultHead;
@@ -205,7 +409,42 @@ void dispatcherInit() {
     gLastChangeSource = selected.lastChangeSource == SRC_DASHBOARD
         ? SRC_DASHBOARD : SRC_LOCAL_UI;
     gGeneration = selected.generation;
+    for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) readNode(gNvs, i, gNodes[i]);
+    // Replay the redo copies; any that the node keys do not match yet were
+    // interrupted mid-commit and are rewritten below.
+    for (uint8_t i = 0; i < selected.redoCount; ++i) {
+      const NodeRedo& redo = selected.redo[i];
+      if (memcmp(&gNodes[redo.index], &redo.slot, sizeof(NodeSlot)) == 0) continue;
+      gNodes[redo.index] = redo.slot;
+      gDirtyNodes |= 1ULL << redo.index;
+    }
     gNvs.end();
+    rebuildIndex();
+    flushDirtyNodes();
+    return;
+  }
+
+  DispatcherStateRecordV2 v2A{}, v2B{};
+  const bool v2AValid = readRecordV2(gNvs, kStateA, v2A);
+  const bool v2BValid = readRecordV2(gNvs, kStateB, v2B);
+  if (v2AValid || v2BValid) {
+    const DispatcherStateRecordV2& selected = v2AValid && v2BValid
+        ? (generationNewer(v2B.generation, v2A.generation) ? v2B : v2A)
+        : (v2AValid ? v2A : v2B);
+    gRevision = selected.revision;
+    loadLegacyNodes(selected.nodes);
+    gGlobal = selected.global;
+    memcpy(gResults, selected.results, sizeof(gResults));
+    gResultHead = selected.resultHead;
+    gResultCount = selected.resultCount;
+    gLastChangeSource = selected.lastChangeSource == SRC_DASHBOARD
+        ? SRC_DASHBOARD : SRC_LOCAL_UI;
+    gGeneration = selected.generation;
+    gNvs.end();
+    rebuildIndex();
+    Serial.printf("[CONTROL] dispatcher V2->V3 migration revision=%lu: %s\n",
+                  static_cast<unsigned long>(gRevision),
+                  completeMigration() ? "durable" : "FAILED");
     return;
   }
 
@@ -220,7 +459,7 @@ void dispatcherInit() {
         ? (generationNewer(oldB.generation, oldA.generation) ? oldB : oldA)
         : (oldAValid ? oldA : oldB);
     gRevision = selected.revision;
-    memcpy(gNodes, selected.nodes, sizeof(gNodes));
+    loadLegacyNodes(selected.nodes);
     memcpy(gResults, selected.results, sizeof(gResults));
     gResultHead = selected.resultHead;
     gResultCount = selected.resultCount;
@@ -228,12 +467,11 @@ void dispatcherInit() {
         ? SRC_DASHBOARD : SRC_LOCAL_UI;
     gGeneration = selected.generation;
     gNvs.end();
+    rebuildIndex();
     // The checksummed record is authoritative. Remove obsolete pre-A/B keys
-    // and the older redundant V1 slot before allocating the V2 blob; deployed
-    // units can have very little free NVS after years of configuration writes.
+    // before allocating the node records; deployed units can have very little
+    // free NVS after years of configuration writes.
     if (gNvs.begin(kNs, false)) {
-      const char* replacement = ((gGeneration + 1U) & 1U) ? kStateA : kStateB;
-      if (gNvs.isKey(replacement)) gNvs.remove(replacement);
       const char* legacyKeys[] = {
         "rev", "nodes", "nodes2", "results", "rhead", "rcount", "source"
       };
@@ -242,28 +480,30 @@ void dispatcherInit() {
       }
       gNvs.end();
     }
-    Serial.printf("[CONTROL] dispatcher V1->V2 migration revision=%lu: %s\n",
+    Serial.printf("[CONTROL] dispatcher V1->V3 migration revision=%lu: %s\n",
                   static_cast<unsigned long>(gRevision),
-                  persist() ? "durable" : "FAILED");
+                  completeMigration() ? "durable" : "FAILED");
     return;
   }
 
   // One-way migration from the original multi-key dispatcher layout.
   gRevision = gNvs.getUInt("rev", 0);
-  if (gNvs.getBytesLength("nodes2") == sizeof gNodes) {
-    gNvs.getBytes("nodes2", gNodes, sizeof gNodes);
-  } else if (gNvs.getBytesLength("nodes") == sizeof(LegacyNodeSlot) * CMD_MAX_NODES) {
-    LegacyNodeSlot legacy[CMD_MAX_NODES]{};
+  NodeSlot legacyNodes[kLegacyNodes]{};
+  if (gNvs.getBytesLength("nodes2") == sizeof legacyNodes) {
+    gNvs.getBytes("nodes2", legacyNodes, sizeof legacyNodes);
+  } else if (gNvs.getBytesLength("nodes") == sizeof(LegacyNodeSlot) * kLegacyNodes) {
+    LegacyNodeSlot legacy[kLegacyNodes]{};
     if (gNvs.getBytes("nodes", legacy, sizeof legacy) == sizeof legacy) {
-      for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
-        gNodes[i].cfg = legacy[i].cfg;
-        memcpy(gNodes[i].pendingCmdId, legacy[i].pendingCmdId, CMD_ID_LEN);
-        gNodes[i].pendingRevision = legacy[i].pendingRevision;
-        gNodes[i].inUse = legacy[i].inUse;
-        gNodes[i].converged = legacy[i].converged;
+      for (uint8_t i = 0; i < kLegacyNodes; ++i) {
+        legacyNodes[i].cfg = legacy[i].cfg;
+        memcpy(legacyNodes[i].pendingCmdId, legacy[i].pendingCmdId, CMD_ID_LEN);
+        legacyNodes[i].pendingRevision = legacy[i].pendingRevision;
+        legacyNodes[i].inUse = legacy[i].inUse;
+        legacyNodes[i].converged = legacy[i].converged;
       }
     }
   }
+  loadLegacyNodes(legacyNodes);
   if (gNvs.getBytesLength("results") == sizeof gResults) {
     gNvs.getBytes("results", gResults, sizeof gResults);
   }
@@ -274,21 +514,18 @@ void dispatcherInit() {
   const uint8_t source = gNvs.getUChar("source", SRC_LOCAL_UI);
   gLastChangeSource = source == SRC_DASHBOARD ? SRC_DASHBOARD : SRC_LOCAL_UI;
   gNvs.end();
+  rebuildIndex();
 
-  // Complete legacy migration into the checksummed A/B record.
-  persist();
+  // Complete legacy migration into the checksummed V3 layout.
+  completeMigration();
 }
 
 void dispatcherResetForTest() {
   gNvs.begin(kNs, false);
   gNvs.clear();
   gNvs.end();
-  memset(gNodes, 0, sizeof gNodes);
-  memset(&gGlobal, 0, sizeof gGlobal);
-  memset(gResults, 0, sizeof gResults);
-  gRevision = 0; gResultHead = 0; gResultCount = 0;
-  gLastChangeSource = SRC_LOCAL_UI;
-  gGeneration = 0;
+  clearState();
+  rebuildIndex();
 }
 
 uint32_t dispatcherRevision() { return gRevision; }
@@ -375,22 +612,27 @@ String dispatcherStatusJson() {
 
 // ---- node table helpers ----
 static NodeSlot* findNode(const char* nodeId) {
-  for (uint8_t i = 0; i < CMD_MAX_NODES; i++)
-    if (gNodes[i].inUse && strncmp(gNodes[i].cfg.nodeId, nodeId, CMD_NODEID_LEN) == 0)
+  if (!nodeId || !nodeId[0]) return nullptr;
+  for (size_t h = hashNodeId(nodeId); ; ++h) {
+    const uint8_t i = gIndex[h & (kIndexSlots - 1)];
+    if (i == kIndexEmpty) return nullptr;
+    if (strncmp(gNodes[i].cfg.nodeId, nodeId, CMD_NODEID_LEN) == 0)
       return &gNodes[i];
-  return nullptr;
+  }
 }
 
 static NodeSlot* findOrAddNode(const char* nodeId) {
   NodeSlot* n = findNode(nodeId);
   if (n) return n;
+  if (gNodeCount >= CMD_MAX_NODES) return nullptr;  // table full
   for (uint8_t i = 0; i < CMD_MAX_NODES; i++)
     if (!gNodes[i].inUse) {
       gNodes[i].inUse = true;
       strlcpy(gNodes[i].cfg.nodeId, nodeId, CMD_NODEID_LEN);
+      indexInsert(i);
       return &gNodes[i];
     }
-  return nullptr;  // table full
+  return nullptr;
 }
 
 const DispatchNodeConfig* dispatcherNodeConfig(const char* nodeId) {
@@ -398,14 +640,32 @@ const DispatchNodeConfig* dispatcherNodeConfig(const char* nodeId) {
   return n ? &n->cfg : nullptr;
 }
 
-bool dispatcherEnsureDurable() { return persist(); }
+// Nothing to write when every node key is current and the header on flash is
+// the one RAM was loaded from or last committed.
+static bool headerDurable() {
+  if (gGeneration == 0 || !gNvs.begin(kNs, true)) return false;
+  DispatcherStateRecord current{};
+  const char* key = (gGeneration & 1U) ? kStateA : kStateB;
+  const bool ok = readRecord(gNvs, key, current) &&
+                  current.generation == gGeneration &&
+                  current.revision == gRevision;
+  gNvs.end();
+  return ok;
+}
+
+bool dispatcherEnsureDurable() {
+  if (gDirtyNodes) flushDirtyNodes();
+  return (gDirtyNodes == 0 && headerDurable()) || persist();
+}
 
 bool dispatcherBindNodeConfigVersion(const char* nodeId, uint32_t revision,
                                      uint16_t configVersion) {
   NodeSlot* n = findNode(nodeId);
   if (!n || n->pendingRevision != revision || configVersion == 0) return false;
-  if (n->wireConfigVersion == configVersion) return persist();
+  if (n->wireConfigVersion == configVersion) return dispatcherEnsureDurable();
+  if (gDirtyNodes) flushDirtyNodes();
   n->wireConfigVersion = configVersion;
+  markDirty(n);
   return persist();
 }
 
@@ -440,7 +700,9 @@ bool dispatcherMarkConverged(const char* nodeId, uint32_t revision) {
   NodeSlot* n = findNode(nodeId);
   if (!n || n->pendingRevision != revision) return false;
   if (n->converged) return false;
+  if (gDirtyNodes) flushDirtyNodes();
   n->converged = true;
+  markDirty(n);
   CommandResult* result = findResult(n->pendingCmdId);
   if (result && result->outcome == OUT_ACCEPTED) result->outcome = OUT_CONVERGED;
   return persist();
@@ -480,11 +742,8 @@ bool dispatcherSubmitBatch(const DispatchBatchItem* items, uint8_t count,
 
   // Validate the complete set before changing the in-RAM desired mirrors.
   uint8_t newNodes = 0;
-  uint8_t freeNodes = 0;
+  const uint8_t freeNodes = CMD_MAX_NODES - gNodeCount;
   uint8_t acceptedChanges = 0;
-  for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
-    if (!gNodes[i].inUse) ++freeNodes;
-  }
   for (uint8_t i = 0; i < count; ++i) {
     const Command& command = items[i].command;
     if (!command.cmdId[0]) return false;
@@ -521,15 +780,23 @@ bool dispatcherSubmitBatch(const DispatchBatchItem* items, uint8_t count,
   if (newNodes > freeNodes ||
       acceptedChanges > UINT32_MAX - initialRevision) return false;
 
+  // Node keys a previous commit could not rewrite ride along in this header's
+  // redo list; retry them first so the list stays short.
+  if (gDirtyNodes) flushDirtyNodes();
+
   const uint32_t revisionBefore = gRevision;
   const uint32_t generationBefore = gGeneration;
   const uint8_t resultHeadBefore = gResultHead;
   const uint8_t resultCountBefore = gResultCount;
   const CmdSource sourceBefore = gLastChangeSource;
   const GlobalSlot globalBefore = gGlobal;
-  NodeSlot nodesBefore[CMD_MAX_NODES];
+  const uint64_t dirtyBefore = gDirtyNodes;
+  // Each node appears at most once per batch (validated above), so one undo
+  // entry per accepted item covers every slot this batch can touch.
+  struct NodeUndo { uint8_t index; NodeSlot slot; };
+  NodeUndo undo[CMD_MAX_RESULTS];
+  uint8_t undoCount = 0;
   CommandResult resultsBefore[CMD_MAX_RESULTS];
-  memcpy(nodesBefore, gNodes, sizeof(gNodes));
   memcpy(resultsBefore, gResults, sizeof(gResults));
 
   CommandResult batchResults[CMD_MAX_RESULTS]{};
@@ -600,8 +867,13 @@ bool dispatcherSubmitBatch(const DispatchBatchItem* items, uint8_t count,
       continue;
     }
 
-    NodeSlot* node = findOrAddNode(command.payload.nodeId);
+    NodeSlot* node = findNode(command.payload.nodeId);
+    const NodeSlot nodeBefore = node ? *node : NodeSlot{};
+    if (!node) node = findOrAddNode(command.payload.nodeId);
     if (!node) goto rollback;
+    undo[undoCount].index = static_cast<uint8_t>(node - gNodes);
+    undo[undoCount++].slot = nodeBefore;
+    markDirty(node);
     if (node->pendingCmdId[0] != '\0' && !node->converged &&
         strncmp(node->pendingCmdId, command.cmdId, CMD_ID_LEN) != 0) {
       CommandResult* superseded = findResult(node->pendingCmdId);
@@ -636,7 +908,12 @@ rollback:
   gResultCount = resultCountBefore;
   gLastChangeSource = sourceBefore;
   gGlobal = globalBefore;
-  memcpy(gNodes, nodesBefore, sizeof(gNodes));
+  gDirtyNodes = dirtyBefore;
+  while (undoCount) {
+    const NodeUndo& u = undo[--undoCount];
+    gNodes[u.index] = u.slot;
+  }
+  rebuildIndex();
   memcpy(gResults, resultsBefore, sizeof(gResults));
   return false;
 }
@@ -13,12 +13,18 @@
 //   - Supersession: a newer accepted change for a node marks the earlier,
 //     not-yet-converged command SUPERSEDED instead of "applied".
 //   - Reboot-safe: revision, recent results, and desired configs persist in NVS.
+//     Each commit writes one small header plus the node records it touched.
 //
 // This module is transport-agnostic: local UI handlers and the backend command
 // parser both build a Command and call dispatcherSubmit(). Node delivery
 // (NODE_CONFIG) and convergence tracking sit downstream via dispatcherMarkConverged().
 
-#define CMD_MAX_NODES    16
+// Dispatcher node table size. Matches the mothership registry/deployment-store
+// limit; each node persists under its own NVS key, so raising this does not
+// grow any single blob. Capped at 64 by the per-commit dirty bitmap.
+#ifndef CMD_MAX_NODES
+#define CMD_MAX_NODES    64
+#endif
 #define CMD_MAX_RESULTS  8
 #define CMD_ID_LEN       24
 #define CMD_NODEID_LEN   16
@@ -114,8 +120,8 @@ bool          dispatcherSubmitBatch(const DispatchBatchItem* items,
 // Record a parser/transport rejection durably without mutating desired state.
 CommandResult dispatcherReject(const char* cmdId, CmdSource source,
                                CmdOutcome outcome = OUT_INVALID);
-// Re-write and verify the complete dispatcher state. A cloud command cursor
-// must not advance unless this returns true.
+// Flush any node records still pending and verify the current header reads
+// back. A cloud command cursor must not advance unless this returns true.
 bool          dispatcherEnsureDurable();
 const DispatchNodeConfig* dispatcherNodeConfig(const char* nodeId);
 bool          dispatcherKnownCmd(const char* cmdId);          // seen before?
@@ -1,10 +1,10 @@
 #pragma once
 #include <Arduino.h>
 #include <string.h>
-#include <Ed25519.h>       // rweather/Crypto
 #include <ArduinoJson.h>   // bblanchon/ArduinoJson v7
 #include "firmware_identity.h"
 #include "fw_reason.h"     // FwReason, fwReasonStr, fwHexToBytes
+#include "release_signature.h"  // manifestVerifySignature (Ed25519)
 
 // ===== Release manifest verify + compatibility (shared by both roles) =====
 //
@@ -25,6 +25,19 @@
 #ifndef FW_MANIFEST_MAX_HWTARGETS
 #define FW_MANIFEST_MAX_HWTARGETS 4
 #endif
+#ifndef FW_MANIFEST_MAX_PATCHES
+#define FW_MANIFEST_MAX_PATCHES 2
+#endif
+
+// Optional delta patch of an artifact (scripts/release_sign.py `from=`): rebuilds
+// the artifact from the image whose SHA-256 is fromSha256. Covered by the same
+// manifest signature as the full image, which stays the fallback.
+struct ManifestPatch {
+  char     fromSha256[65];   // base image the patch applies to
+  uint32_t fromSize;
+  char     sha256[65];       // of the patch file itself
+  uint32_t size;
+};
 
 struct ManifestArtifact {
   char     role[12];
@@ -36,6 +49,11 @@ struct ManifestArtifact {
   uint32_t size;
   char     sha256[65];   // 64 hex + NUL
   char     minMothershipVersion[16];
+  // role "node" only: Ed25519 over the fleet OTA statement (fleet_ota.h
+  // fotaOfferStatement) for hwTargets[0], relayed in every OTA_OFFER.
+  char     fleetSig[129];   // 128 hex + NUL
+  ManifestPatch patches[FW_MANIFEST_MAX_PATCHES];
+  uint8_t  patchCount;
 };
 
 struct Manifest {
@@ -47,11 +65,7 @@ struct Manifest {
 };
 
 // --- Step 1: signature over the EXACT downloaded manifest bytes ---
-static inline bool manifestVerifySignature(const uint8_t* json, size_t len,
-                                           const uint8_t sig64[64],
-                                           const uint8_t pub32[32]) {
-  return Ed25519::verify(sig64, pub32, json, len);
-}
+// manifestVerifySignature() (release_signature.h).
 
 // --- Step 2: parse (call ONLY after the signature verified) ---
 static inline bool manifestParse(const uint8_t* json, size_t len, Manifest& m) {
@@ -71,6 +85,7 @@ static inline bool manifestParse(const uint8_t* json, size_t len, Manifest& m) {
     strlcpy(t.buildId, a["buildId"] | "", sizeof t.buildId);
     strlcpy(t.sha256,  a["sha256"]  | "", sizeof t.sha256);
     strlcpy(t.minMothershipVersion, a["minMothershipVersion"] | "", sizeof t.minMothershipVersion);
+    strlcpy(t.fleetSig, a["fleetSig"] | "", sizeof t.fleetSig);
     t.protocolVersion = a["protocolVersion"] | 0;
     t.size            = a["size"] | 0UL;
     for (JsonVariantConst h : a["hwTargets"].as<JsonArrayConst>()) {
@@ -79,6 +94,19 @@ static inline bool manifestParse(const uint8_t* json, size_t len, Manifest& m) {
               sizeof t.hwTargets[0]);
       t.hwTargetCount++;
     }
+    for (JsonObjectConst p : a["patches"].as<JsonArrayConst>()) {
+      if (t.patchCount >= FW_MANIFEST_MAX_PATCHES) break;
+      ManifestPatch& dst = t.patches[t.patchCount];
+      strlcpy(dst.fromSha256, p["fromSha256"] | "", sizeof dst.fromSha256);
+      strlcpy(dst.sha256,     p["sha256"]     | "", sizeof dst.sha256);
+      dst.fromSize = p["fromSize"] | 0UL;
+      dst.size     = p["size"] | 0UL;
+      if (strlen(dst.fromSha256) != 64 || strlen(dst.sha256) != 64 ||
+          dst.fromSize == 0 || dst.size == 0) {
+        continue;   // malformed entry: ignore it, the full image still works
+      }
+      t.patchCount++;
+    }
     m.artifactCount++;
   }
   return m.artifactCount > 0;
@@ -0,0 +1,418 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// ===== Fleet firmware distribution over ESP-NOW (shared by both roles) =====
+//
+// The mothership holds one signed node image and broadcasts it in numbered
+// chunks during sync sessions. Every node that wants the image listens to the
+// SAME broadcast, keeps a received-chunk bitmap that survives power cuts, and
+// asks only for the ranges it is missing. Airtime therefore grows with the
+// image size (plus repair rounds for lost chunks), not with image size times
+// the number of nodes.
+//
+// Per sync session, after the HELLO roster closes (docs/FIELDMESH_COORDINATED_
+// SYNC_PROTOCOL.md):
+//
+//   mothership -> fleet  OTA_OFFER   image identity, size, SHA-256, version,
+//                                    release sequence, release signature over
+//                                    those fields
+//   node -> mothership   OTA_NEED    missing chunk ranges (only if it wants it)
+//   mothership -> fleet  OTA_CHUNK   the union of every node's missing chunks
+//   ... OFFER / NEED / CHUNK repeats while the session's OTA budget lasts ...
+//   node -> mothership   OTA_RESULT  armed / installed / failed
+//
+// ESP-NOW frames are unauthenticated, so the offer carries its own proof: an
+// Ed25519 signature by the release key over the image statement below,
+// produced by scripts/release_sign.py next to the manifest signature and
+// relayed unchanged by the mothership. A node checks it before it starts
+// collecting an image and again before it arms the slot; an offer that fails
+// the check is declined. The statement includes the manifest's releaseSequence,
+// and a node declines any offer older than the release it has installed (the
+// firmware_manifest.h anti-downgrade rule), so replaying an old, validly
+// signed offer cannot move the fleet backwards.
+//
+// A node writes each chunk straight to its inactive OTA slot at
+// index * FOTA_CHUNK_BYTES, erasing each 4 KiB flash sector the first time a
+// chunk lands in it. Once every bit is set it hashes the slot, compares the
+// signed SHA-256 from the offer and arms the slot (ota_installer.h
+// otaInstallFromPartition). The next cold boot runs the new image under the
+// deferred-verify rollback guard.
+//
+// Pure arithmetic — no Arduino, no FreeRTOS, no flash — so node firmware, the
+// mothership and the host simulation (tests/test_fleet_ota_sim.cpp) run the
+// same state machines. Flash access goes through a caller-supplied sink.
+
+#define FOTA_CHUNK_BYTES        200u
+#define FOTA_SECTOR_BYTES       4096u
+// Largest node OTA slot (partitions_ota.csv: 0x140000).
+#define FOTA_MAX_IMAGE_BYTES    0x140000u
+#define FOTA_MAX_CHUNKS \
+    ((FOTA_MAX_IMAGE_BYTES + FOTA_CHUNK_BYTES - 1u) / FOTA_CHUNK_BYTES)
+#define FOTA_BITMAP_BYTES       ((FOTA_MAX_CHUNKS + 7u) / 8u)
+#define FOTA_MAX_SECTORS        (FOTA_MAX_IMAGE_BYTES / FOTA_SECTOR_BYTES)
+#define FOTA_SECTOR_BITMAP_BYTES ((FOTA_MAX_SECTORS + 7u) / 8u)
+// Nodes spread their OTA_NEED replies over the jitter window after each
+// OTA_OFFER; the mothership listens for the collect window before sending.
+#define FOTA_NEED_JITTER_MS     300u
+#define FOTA_NEED_COLLECT_MS    450u
+// Missing ranges per OTA_NEED. A node with more gaps lists the first ones and
+// lets the last range run to the end of the image; the next round narrows it.
+#define FOTA_NEED_MAX_RANGES    40u
+
+typedef struct __attribute__((packed)) fota_range {
+    uint16_t first;
+    uint16_t count;
+} fota_range_t;
+
+typedef struct __attribute__((packed)) fota_offer_message {
+    char     command[16];       // "OTA_OFFER"
+    char     mothership_id[16];
+    uint32_t sessionId;         // echoed in OTA_NEED
+    uint32_t imageId;           // first 4 bytes of sha256 (little-endian)
+    uint32_t imageSize;
+    uint16_t chunkCount;
+    uint16_t chunkBytes;        // FOTA_CHUNK_BYTES
+    uint8_t  sha256[32];        // from the signature-verified release manifest
+    char     version[12];       // node artifact semantic version
+    char     hwTarget[16];      // node artifact hardware target
+    uint32_t releaseSequence;   // manifest releaseSequence (monotonic per role)
+    uint8_t  signature[64];     // release Ed25519 over fotaOfferStatement()
+} fota_offer_message_t;
+
+typedef struct __attribute__((packed)) fota_chunk_message {
+    char     command[16];       // "OTA_CHUNK"
+    uint32_t imageId;
+    uint16_t index;
+    uint16_t length;            // FOTA_CHUNK_BYTES except for the last chunk
+    uint8_t  data[FOTA_CHUNK_BYTES];
+} fota_chunk_message_t;
+
+typedef struct __attribute__((packed)) fota_need_message {
+    char         command[16];   // "OTA_NEED"
+    char         nodeId[16];
+    uint32_t     sessionId;
+    uint32_t     imageId;
+    uint16_t     chunksHave;
+    uint8_t      rangeCount;
+    uint8_t      reserved;
+    fota_range_t ranges[FOTA_NEED_MAX_RANGES];
+} fota_need_message_t;
+
+enum FotaResultStatus : uint8_t {
+    FOTA_RESULT_ARMED     = 1,  // verified and set as next boot; installs on next wake
+    FOTA_RESULT_INSTALLED = 2,  // new image booted and confirmed itself
+    FOTA_RESULT_FAILED    = 3,  // hash/image/flash failure or rollback (reason = FwReason)
+};
+
+typedef struct __attribute__((packed)) fota_result_message {
+    char     command[16];       // "OTA_RESULT"
+    char     nodeId[16];
+    uint32_t imageId;
+    uint8_t  status;            // FotaResultStatus
+    uint8_t  reason;            // FwReason (FW_NONE unless FAILED)
+    uint16_t chunksHave;
+} fota_result_message_t;
+
+static_assert(sizeof(fota_offer_message_t) == 176, "fota_offer_message_t size mismatch");
+static_assert(sizeof(fota_chunk_message_t) == 224, "fota_chunk_message_t size mismatch");
+static_assert(sizeof(fota_need_message_t) == 204, "fota_need_message_t size mismatch");
+static_assert(sizeof(fota_result_message_t) == 40, "fota_result_message_t size mismatch");
+static_assert(sizeof(fota_offer_message_t) <= 250 && sizeof(fota_chunk_message_t) <= 250 &&
+              sizeof(fota_need_message_t) <= 250,
+              "fleet OTA frames exceed the ESP-NOW v1 payload ceiling");
+
+// ---------------------------------------------------------------------------
+// Shared helpers
+// ---------------------------------------------------------------------------
+
+inline uint32_t fotaImageIdOf(const uint8_t sha256[32]) {
+  return (uint32_t)sha256[0] | ((uint32_t)sha256[1] << 8) |
+         ((uint32_t)sha256[2] << 16) | ((uint32_t)sha256[3] << 24);
+}
+
+inline uint16_t fotaChunkCountFor(uint32_t imageSize) {
+  return (uint16_t)((imageSize + FOTA_CHUNK_BYTES - 1u) / FOTA_CHUNK_BYTES);
+}
+
+inline uint16_t fotaChunkLength(uint32_t imageSize, uint16_t index) {
+  const uint32_t offset = (uint32_t)index * FOTA_CHUNK_BYTES;
+  if (offset >= imageSize) return 0;
+  const uint32_t left = imageSize - offset;
+  return (uint16_t)(left < FOTA_CHUNK_BYTES ? left : FOTA_CHUNK_BYTES);
+}
+
+// Bytes the release key signs for one node image (the offer's `signature`):
+//   "FMFOTA2\0" | imageSize (LE32) | sha256[32] | version[12] | hwTarget[16] |
+//   releaseSequence (LE32)
+// version and hwTarget are NUL-padded to their field width. imageId and
+// chunkCount follow from these, so they need no signature of their own.
+#define FOTA_STATEMENT_BYTES    76u
+
+inline void fotaOfferStatement(uint8_t out[FOTA_STATEMENT_BYTES], uint32_t imageSize,
+                               const uint8_t sha256[32], const char* version,
+                               const char* hwTarget, uint32_t releaseSequence) {
+  memset(out, 0, FOTA_STATEMENT_BYTES);
+  memcpy(out, "FMFOTA2", 8);
+  out[8]  = (uint8_t)imageSize;
+  out[9]  = (uint8_t)(imageSize >> 8);
+  out[10] = (uint8_t)(imageSize >> 16);
+  out[11] = (uint8_t)(imageSize >> 24);
+  memcpy(out + 12, sha256, 32);
+  for (size_t i = 0; i < 12 && version[i]; ++i) out[44 + i] = (uint8_t)version[i];
+  for (size_t i = 0; i < 16 && hwTarget[i]; ++i) out[56 + i] = (uint8_t)hwTarget[i];
+  out[72] = (uint8_t)releaseSequence;
+  out[73] = (uint8_t)(releaseSequence >> 8);
+  out[74] = (uint8_t)(releaseSequence >> 16);
+  out[75] = (uint8_t)(releaseSequence >> 24);
+}
+
+inline bool fotaBitTest(const uint8_t* bits, uint32_t i) {
+  return (bits[i >> 3] >> (i & 7u)) & 1u;
+}
+inline void fotaBitSet(uint8_t* bits, uint32_t i) {
+  bits[i >> 3] = (uint8_t)(bits[i >> 3] | (1u << (i & 7u)));
+}
+inline void fotaBitClear(uint8_t* bits, uint32_t i) {
+  bits[i >> 3] = (uint8_t)(bits[i >> 3] & ~(1u << (i & 7u)));
+}
+
+// ---------------------------------------------------------------------------
+// Node receiver
+// ---------------------------------------------------------------------------
+
+constexpr uint32_t kFotaRxMagic = 0x33524F46u;  // "FOR3"
+
+enum class FotaRxPhase : uint8_t {
+  Idle      = 0,
+  Receiving = 1,  // collecting chunks for imageId
+  Armed     = 2,  // verified and set as the next boot partition
+  Installed = 3,  // booted and confirmed; OTA_RESULT not yet reported
+  Failed    = 4,  // imageId rejected (hash/image/flash/rollback); not retried
+};
+
+// Persisted byte-for-byte (NVS), like the RBE and aggregation state.
+struct FotaRxState {
+  uint32_t magic;
+  uint32_t imageId;
+  uint32_t imageSize;
+  uint16_t chunkCount;
+  uint16_t chunksHave;
+  uint8_t  phase;           // FotaRxPhase
+  uint8_t  lastReason;      // FwReason of the last failure
+  uint8_t  resultPending;   // 1 = phase change not yet reported in OTA_RESULT
+  uint8_t  reserved;
+  uint8_t  sha256[32];
+  char     version[12];
+  uint32_t releaseSequence; // offer's release sequence, signed with the rest
+  uint8_t  signature[64];   // offer signature, checked again before arming
+  uint8_t  chunkBits[FOTA_BITMAP_BYTES];
+  uint8_t  sectorBits[FOTA_SECTOR_BITMAP_BYTES];  // sector erased this image
+  uint32_t checksum;        // FNV-1a over every byte above
+};
+
+inline uint32_t fotaRxChecksum(const FotaRxState& s) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(&s);
+  const size_t n = offsetof(FotaRxState, checksum);
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < n; ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+inline void fotaRxReset(FotaRxState& s) {
+  memset(&s, 0, sizeof(s));
+  s.magic = kFotaRxMagic;
+}
+
+inline void fotaRxSeal(FotaRxState& s) { s.checksum = fotaRxChecksum(s); }
+
+inline bool fotaRxIsValid(const FotaRxState& s) {
+  return s.magic == kFotaRxMagic && s.chunkCount <= FOTA_MAX_CHUNKS &&
+         s.chunksHave <= s.chunkCount && s.imageSize <= FOTA_MAX_IMAGE_BYTES &&
+         s.phase <= (uint8_t)FotaRxPhase::Failed && s.checksum == fotaRxChecksum(s);
+}
+
+inline bool fotaRxComplete(const FotaRxState& s) {
+  return s.phase == (uint8_t)FotaRxPhase::Receiving && s.chunkCount > 0 &&
+         s.chunksHave == s.chunkCount;
+}
+
+enum class FotaOfferVerdict : uint8_t {
+  Decline = 0,  // not for this node (hardware, version, size, older release,
+                //   known-bad image)
+  Start   = 1,  // new image: reset state and request everything
+  Resume  = 2,  // same image: request only the missing ranges
+  Hold    = 3,  // already armed/installed for this image: nothing to request
+};
+
+// selfVersion/selfHw are this node's running identity; slotBytes the inactive
+// OTA slot capacity; installedSequence the release sequence of the image it
+// runs (0 = unknown / factory, which accepts any sequence, as in
+// manifestCheckCompatibility).
+inline FotaOfferVerdict fotaRxConsiderOffer(const FotaRxState& s,
+                                            const fota_offer_message_t& offer,
+                                            const char* selfVersion,
+                                            const char* selfHw,
+                                            uint32_t slotBytes,
+                                            uint32_t installedSequence) {
+  if (strncmp(offer.hwTarget, selfHw, sizeof(offer.hwTarget)) != 0) {
+    return FotaOfferVerdict::Decline;
+  }
+  if (offer.imageSize == 0 || offer.imageSize > slotBytes ||
+      offer.imageSize > FOTA_MAX_IMAGE_BYTES || offer.chunkBytes != FOTA_CHUNK_BYTES ||
+      offer.chunkCount != fotaChunkCountFor(offer.imageSize) ||
+      offer.imageId != fotaImageIdOf(offer.sha256)) {
+    return FotaOfferVerdict::Decline;
+  }
+  // Anti-downgrade: never an older release than the one installed, and never
+  // abandon a download for an older release than the one being collected.
+  if (installedSequence != 0 && offer.releaseSequence < installedSequence) {
+    return FotaOfferVerdict::Decline;
+  }
+  if (s.phase == (uint8_t)FotaRxPhase::Receiving && s.imageId != offer.imageId &&
+      offer.releaseSequence < s.releaseSequence) {
+    return FotaOfferVerdict::Decline;
+  }
+  if (s.imageId == offer.imageId) {
+    switch ((FotaRxPhase)s.phase) {
+      case FotaRxPhase::Receiving: return FotaOfferVerdict::Resume;
+      case FotaRxPhase::Armed:
+      case FotaRxPhase::Installed: return FotaOfferVerdict::Hold;
+      case FotaRxPhase::Failed:    return FotaOfferVerdict::Decline;
+      case FotaRxPhase::Idle:      break;
+    }
+  }
+  if (strncmp(offer.version, selfVersion, sizeof(offer.version)) == 0) {
+    return FotaOfferVerdict::Decline;  // already running it
+  }
+  return FotaOfferVerdict::Start;
+}
+
+inline void fotaRxStart(FotaRxState& s, const fota_offer_message_t& offer) {
+  fotaRxReset(s);
+  s.imageId    = offer.imageId;
+  s.imageSize  = offer.imageSize;
+  s.chunkCount = offer.chunkCount;
+  s.phase      = (uint8_t)FotaRxPhase::Receiving;
+  memcpy(s.sha256, offer.sha256, sizeof(s.sha256));
+  memcpy(s.version, offer.version, sizeof(s.version));
+  s.version[sizeof(s.version) - 1] = '\0';
+  s.releaseSequence = offer.releaseSequence;
+  memcpy(s.signature, offer.signature, sizeof(s.signature));
+}
+
+enum class FotaChunkResult : uint8_t {
+  Stored    = 0,
+  Duplicate = 1,  // already have it
+  Foreign   = 2,  // other image, bad index/length, or not receiving
+  FlashError = 3,
+};
+
+// Sink: bool eraseSector(uint32_t sectorIndex);
+//       bool write(uint32_t offset, const uint8_t* data, size_t len);
+// A sector is erased the first time any chunk lands in it, before the write,
+// so every persisted chunk bit implies its sectors' erased bits.
+template <typename Sink>
+inline FotaChunkResult fotaRxAcceptChunk(FotaRxState& s,
+                                         const fota_chunk_message_t& chunk,
+                                         Sink& sink) {
+  if (s.phase != (uint8_t)FotaRxPhase::Receiving || chunk.imageId != s.imageId ||
+      chunk.index >= s.chunkCount ||
+      chunk.length != fotaChunkLength(s.imageSize, chunk.index)) {
+    return FotaChunkResult::Foreign;
+  }
+  if (fotaBitTest(s.chunkBits, chunk.index)) return FotaChunkResult::Duplicate;
+
+  const uint32_t offset = (uint32_t)chunk.index * FOTA_CHUNK_BYTES;
+  const uint32_t firstSector = offset / FOTA_SECTOR_BYTES;
+  const uint32_t lastSector = (offset + chunk.length - 1u) / FOTA_SECTOR_BYTES;
+  for (uint32_t sec = firstSector; sec <= lastSector; ++sec) {
+    if (fotaBitTest(s.sectorBits, sec)) continue;
+    if (!sink.eraseSector(sec)) return FotaChunkResult::FlashError;
+    fotaBitSet(s.sectorBits, sec);
+  }
+  if (!sink.write(offset, chunk.data, chunk.length)) return FotaChunkResult::FlashError;
+  fotaBitSet(s.chunkBits, chunk.index);
+  ++s.chunksHave;
+  return FotaChunkResult::Stored;
+}
+
+// Missing ranges in index order. Returns how many were written to `out`.
+inline size_t fotaRxMissingRanges(const FotaRxState& s, fota_range_t* out,
+                                  size_t maxRanges) {
+  size_t n = 0;
+  uint32_t i = 0;
+  while (i < s.chunkCount && n < maxRanges) {
+    if (fotaBitTest(s.chunkBits, i)) { ++i; continue; }
+    uint32_t end = i + 1;
+    if (n + 1 == maxRanges) {
+      end = s.chunkCount;  // out of room: the last range covers the tail
+    } else {
+      while (end < s.chunkCount && !fotaBitTest(s.chunkBits, end)) ++end;
+    }
+    out[n].first = (uint16_t)i;
+    out[n].count = (uint16_t)(end - i);
+    ++n;
+    i = end;
+  }
+  return n;
+}
+
+// ---------------------------------------------------------------------------
+// Mothership sender
+// ---------------------------------------------------------------------------
+
+// The union of every node's missing chunks for one image. Each OTA_NEED is OR-ed
+// in; next() hands out wanted chunks in index order and clears them as sent, so
+// a chunk two nodes are missing goes on air once.
+struct FotaSender {
+  uint32_t imageId;
+  uint16_t chunkCount;
+  uint16_t wantedCount;
+  uint16_t cursor;
+  uint8_t  wanted[FOTA_BITMAP_BYTES];
+};
+
+inline void fotaSenderReset(FotaSender& f, uint32_t imageId, uint16_t chunkCount) {
+  memset(&f, 0, sizeof(f));
+  f.imageId = imageId;
+  f.chunkCount = chunkCount > FOTA_MAX_CHUNKS ? (uint16_t)FOTA_MAX_CHUNKS : chunkCount;
+}
+
+// Returns false (and merges nothing) for another image or a malformed NEED.
+inline bool fotaSenderMergeNeed(FotaSender& f, const fota_need_message_t& need) {
+  if (need.imageId != f.imageId || need.rangeCount > FOTA_NEED_MAX_RANGES) return false;
+  for (uint8_t r = 0; r < need.rangeCount; ++r) {
+    const uint32_t first = need.ranges[r].first;
+    const uint32_t count = need.ranges[r].count;
+    if (first >= f.chunkCount || count == 0) continue;
+    const uint32_t end = first + count > f.chunkCount ? f.chunkCount : first + count;
+    for (uint32_t i = first; i < end; ++i) {
+      if (fotaBitTest(f.wanted, i)) continue;
+      fotaBitSet(f.wanted, i);
+      ++f.wantedCount;
+    }
+  }
+  return true;
+}
+
+// Next wanted chunk at or after the cursor (wrapping), cleared as it is taken.
+inline bool fotaSenderNext(FotaSender& f, uint16_t& index) {
+  if (f.wantedCount == 0 || f.chunkCount == 0) return false;
+  for (uint32_t step = 0; step < f.chunkCount; ++step) {
+    const uint32_t i = ((uint32_t)f.cursor + step) % f.chunkCount;
+    if (!fotaBitTest(f.wanted, i)) continue;
+    fotaBitClear(f.wanted, i);
+    --f.wantedCount;
+    f.cursor = (uint16_t)((i + 1) % f.chunkCount);
+    index = (uint16_t)i;
+    return true;
+  }
+  f.wantedCount = 0;
+  return false;
+}
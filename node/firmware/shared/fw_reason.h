@@ -41,6 +41,9 @@ enum FwReason : uint8_t {
   FW_DEFERRED_LOW_BATTERY,
   FW_DEFERRED_BUSY,
   FW_DEFERRED_BACKOFF,   // skipping this wake under retry backoff after a failure
+  // Fleet distribution: an armed image did not survive its first boot (the
+  // bootloader reverted to the previous slot). Appended.
+  FW_ROLLED_BACK,
 };
 
 static inline const char* fwReasonStr(FwReason r) {
@@ -66,6 +69,7 @@ static inline const char* fwReasonStr(FwReason r) {
     case FW_DEFERRED_LOW_BATTERY:   return "DEFERRED_LOW_BATTERY";
     case FW_DEFERRED_BUSY:          return "DEFERRED_BUSY";
     case FW_DEFERRED_BACKOFF:       return "DEFERRED_BACKOFF";
+    case FW_ROLLED_BACK:            return "ROLLED_BACK";
     default:                        return "??";
   }
 }
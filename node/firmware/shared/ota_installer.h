@@ -3,7 +3,11 @@
 #include <string.h>
 #include "esp_ota_ops.h"
 #include "esp_partition.h"
-#include <SHA256.h>   // rweather/Crypto (same lib as Ed25519 manifest verify)
+#include <mbedtls/sha256.h>   // ESP32 SHA peripheral behind the mbedTLS API
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
 #include "fw_reason.h"   // FwReason, fwHexToBytes (no JSON/crypto deps)
 
 // ===== Streaming OTA image installer (shared by both roles) =====
@@ -18,17 +22,123 @@
 // must define `extern "C" bool verifyRollbackLater() { return true; }` so the
 // Arduino core does not auto-confirm, then call otaConfirmImage() only after a
 // first-boot self-test passes. A crash/reset before that auto-rolls back.
+//
+// Hashing uses mbedTLS, which the ESP32 core routes to the SHA peripheral.
+// Flash programming runs on a writer task fed through two OTA_INSTALL_BUF_BYTES
+// buffers: otaInstallWrite() copies into one while the writer programs and
+// hashes the other. That overlaps only the caller's memcpy with the writer's
+// SHA update. It does not hide flash time: an SPI flash write disables the
+// cache on both CPUs, so the caller still stalls for each esp_ota_write, and
+// esp_ota_begin() with a known size erases the whole region up front. No
+// measurement of the gain exists. A flash error raised by the writer is
+// reported by the next otaInstallWrite() or by otaInstallFinish().
+// Build with -D OTA_INSTALL_WRITER_TASK=0 for the old synchronous path (bench
+// A/B); it is also the fallback when the buffers or task cannot be allocated.
+// The writer holds a pointer to the OtaInstall, so keep it static (or at least
+// in place) from otaInstallBegin() until Finish/Abort.
+
+#ifndef OTA_INSTALL_WRITER_TASK
+#define OTA_INSTALL_WRITER_TASK 1
+#endif
+#define OTA_INSTALL_BUF_BYTES    4096u   // one flash sector per hand-off
+#define OTA_INSTALL_WRITER_STACK 3072u
+#define OTA_INSTALL_WAIT_MS      5000u   // caller wait for a free buffer
+#define OTA_INSTALL_PIPE_STOP    0xFFu   // sentinel index: writer exits
+
+struct OtaInstallPipe {
+  uint8_t*          buf[2];
+  uint16_t          len[2];
+  QueueHandle_t     full;      // buffer index (or STOP), caller -> writer
+  QueueHandle_t     empty;     // buffer index, writer -> caller
+  SemaphoreHandle_t exited;    // given by the writer just before it deletes itself
+  TaskHandle_t      task;      // null = synchronous writes
+  int8_t            filling;   // buffer the caller is filling, -1 = none
+  volatile bool     failed;    // esp_ota_write failed inside the writer
+};
 
 struct OtaInstall {
   esp_ota_handle_t       handle;
   const esp_partition_t* target;
-  SHA256                 sha;
+  mbedtls_sha256_context sha;
   uint32_t               expectedSize;
-  uint32_t               written;
+  uint32_t               written;      // bytes accepted from the caller
   uint8_t                expectedSha[32];
   bool                   active;
+  OtaInstallPipe         pipe;
 };
 
+// Writer task: owns o.handle and o.sha while the pipe is open; the caller only
+// touches them again after otaInstallPipeClose() has joined it.
+static void otaInstallWriterTask(void* arg) {
+  OtaInstall& o = *static_cast<OtaInstall*>(arg);
+  uint8_t idx = 0;
+  while (xQueueReceive(o.pipe.full, &idx, portMAX_DELAY) == pdTRUE &&
+         idx != OTA_INSTALL_PIPE_STOP) {
+    if (!o.pipe.failed) {
+      if (esp_ota_write(o.handle, o.pipe.buf[idx], o.pipe.len[idx]) == ESP_OK) {
+        mbedtls_sha256_update(&o.sha, o.pipe.buf[idx], o.pipe.len[idx]);
+      } else {
+        o.pipe.failed = true;   // keep draining so the caller never blocks
+      }
+    }
+    xQueueSend(o.pipe.empty, &idx, portMAX_DELAY);
+  }
+  xSemaphoreGive(o.pipe.exited);
+  vTaskDelete(NULL);
+}
+
+static inline void otaInstallPipeFree(OtaInstallPipe& p) {
+  if (p.full)   vQueueDelete(p.full);
+  if (p.empty)  vQueueDelete(p.empty);
+  if (p.exited) vSemaphoreDelete(p.exited);
+  free(p.buf[0]);
+  free(p.buf[1]);
+  memset(&p, 0, sizeof(p));
+  p.filling = -1;
+}
+
+// Leaves the pipe closed (synchronous writes) if anything cannot be allocated.
+static inline void otaInstallPipeOpen(OtaInstall& o) {
+  OtaInstallPipe& p = o.pipe;
+  memset(&p, 0, sizeof(p));
+  p.filling = -1;
+#if OTA_INSTALL_WRITER_TASK
+  p.buf[0] = static_cast<uint8_t*>(malloc(OTA_INSTALL_BUF_BYTES));
+  p.buf[1] = static_cast<uint8_t*>(malloc(OTA_INSTALL_BUF_BYTES));
+  p.full   = xQueueCreate(3, sizeof(uint8_t));    // both buffers + STOP
+  p.empty  = xQueueCreate(2, sizeof(uint8_t));
+  p.exited = xSemaphoreCreateBinary();
+  if (!p.buf[0] || !p.buf[1] || !p.full || !p.empty || !p.exited) {
+    otaInstallPipeFree(p);
+    return;
+  }
+  for (uint8_t i = 0; i < 2; ++i) xQueueSend(p.empty, &i, 0);
+  // Core 0, beside the radio stacks, leaves the Arduino loop core to the caller.
+  if (xTaskCreatePinnedToCore(otaInstallWriterTask, "ota_writer", OTA_INSTALL_WRITER_STACK,
+                              &o, uxTaskPriorityGet(NULL), &p.task, 0) != pdPASS) {
+    p.task = nullptr;
+    otaInstallPipeFree(p);
+  }
+#endif
+}
+
+// Hand the partly filled buffer to the writer, stop it, wait for it to finish
+// every queued buffer, and release the pipe. Returns false if any write failed.
+static inline bool otaInstallPipeClose(OtaInstall& o) {
+  OtaInstallPipe& p = o.pipe;
+  if (!p.task) return true;
+  if (p.filling >= 0 && p.len[p.filling] > 0) {
+    const uint8_t idx = (uint8_t)p.filling;
+    xQueueSend(p.full, &idx, portMAX_DELAY);
+  }
+  const uint8_t stop = OTA_INSTALL_PIPE_STOP;
+  xQueueSend(p.full, &stop, portMAX_DELAY);
+  xSemaphoreTake(p.exited, portMAX_DELAY);   // buffers stay allocated until it is gone
+  const bool ok = !p.failed;
+  otaInstallPipeFree(p);
+  return ok;
+}
+
 // expectedSha256Hex: 64 lowercase hex chars from the verified manifest artifact.
 static inline FwReason otaInstallBegin(OtaInstall& o, uint32_t expectedSize,
                                        const char* expectedSha256Hex) {
@@ -41,37 +151,73 @@ static inline FwReason otaInstallBegin(OtaInstall& o, uint32_t expectedSize,
   if (!o.target) return FW_FLASH_WRITE_FAILED;
   if (expectedSize == 0 || expectedSize > o.target->size) return FW_IMAGE_TOO_LARGE;
 
-  o.sha.reset();
   if (esp_ota_begin(o.target, expectedSize, &o.handle) != ESP_OK) return FW_FLASH_WRITE_FAILED;
+  mbedtls_sha256_init(&o.sha);
+  mbedtls_sha256_starts(&o.sha, 0);
+  otaInstallPipeOpen(o);
   o.active = true;
   return FW_NONE;
 }
 
-// Feed the next ordered chunk. Rejects an overrun past the declared size.
 static inline void otaInstallAbort(OtaInstall& o) {
-  if (o.active) { esp_ota_abort(o.handle); o.active = false; }
+  if (!o.active) return;
+  otaInstallPipeClose(o);
+  esp_ota_abort(o.handle);
+  mbedtls_sha256_free(&o.sha);
+  o.active = false;
 }
 
+// Feed the next ordered chunk. Rejects an overrun past the declared size.
 static inline FwReason otaInstallWrite(OtaInstall& o, const uint8_t* data, size_t len) {
   if (!o.active) return FW_IMAGE_INVALID;
   if ((uint64_t)o.written + len > o.expectedSize) { otaInstallAbort(o); return FW_SIZE_MISMATCH; }
-  if (esp_ota_write(o.handle, data, len) != ESP_OK) { otaInstallAbort(o); return FW_FLASH_WRITE_FAILED; }
-  o.sha.update(data, len);
-  o.written += len;
+  OtaInstallPipe& p = o.pipe;
+  if (!p.task) {
+    if (esp_ota_write(o.handle, data, len) != ESP_OK) { otaInstallAbort(o); return FW_FLASH_WRITE_FAILED; }
+    mbedtls_sha256_update(&o.sha, data, len);
+    o.written += len;
+    return FW_NONE;
+  }
+  while (len > 0) {
+    if (p.failed) { otaInstallAbort(o); return FW_FLASH_WRITE_FAILED; }
+    if (p.filling < 0) {
+      uint8_t idx = 0;
+      if (xQueueReceive(p.empty, &idx, pdMS_TO_TICKS(OTA_INSTALL_WAIT_MS)) != pdTRUE) {
+        otaInstallAbort(o); return FW_FLASH_WRITE_FAILED;
+      }
+      p.filling = (int8_t)idx;
+      p.len[idx] = 0;
+    }
+    const uint8_t idx = (uint8_t)p.filling;
+    const size_t room = OTA_INSTALL_BUF_BYTES - p.len[idx];
+    const size_t n = len < room ? len : room;
+    memcpy(p.buf[idx] + p.len[idx], data, n);
+    p.len[idx] = (uint16_t)(p.len[idx] + n);
+    data += n;
+    len -= n;
+    o.written += n;
+    if (p.len[idx] == OTA_INSTALL_BUF_BYTES) {
+      xQueueSend(p.full, &idx, portMAX_DELAY);   // queue holds both buffers: never blocks
+      p.filling = -1;
+    }
+  }
   return FW_NONE;
 }
 
-// Finalise: size check -> SHA-256 check -> ESP image validation -> set boot slot.
-// Returns FW_NONE on success (image is armed but NOT yet confirmed; caller
-// persists state and reboots). Never changes the boot slot on any failure.
+// Finalise: drain writer -> size check -> SHA-256 check -> ESP image validation
+// -> set boot slot. Returns FW_NONE on success (image is armed but NOT yet
+// confirmed; caller persists state and reboots). Never changes the boot slot on
+// any failure.
 static inline FwReason otaInstallFinish(OtaInstall& o) {
   if (!o.active) return FW_IMAGE_INVALID;
   o.active = false;
 
-  if (o.written != o.expectedSize) { esp_ota_abort(o.handle); return FW_SIZE_MISMATCH; }
-
+  const bool flushed = otaInstallPipeClose(o);
   uint8_t got[32];
-  o.sha.finalize(got, sizeof got);
+  mbedtls_sha256_finish(&o.sha, got);
+  mbedtls_sha256_free(&o.sha);
+  if (!flushed) { esp_ota_abort(o.handle); return FW_FLASH_WRITE_FAILED; }
+  if (o.written != o.expectedSize) { esp_ota_abort(o.handle); return FW_SIZE_MISMATCH; }
   if (memcmp(got, o.expectedSha, 32) != 0) { esp_ota_abort(o.handle); return FW_HASH_MISMATCH; }
 
   if (esp_ota_end(o.handle) != ESP_OK) return FW_IMAGE_INVALID;       // ESP image checks
@@ -79,6 +225,45 @@ static inline FwReason otaInstallFinish(OtaInstall& o) {
   return FW_NONE;
 }
 
+// SHA-256 of the first `size` bytes of a partition (hardware SHA, 1 KiB reads).
+static inline bool otaSha256Partition(const esp_partition_t* part, uint32_t size,
+                                      uint8_t out[32]) {
+  if (!part || size > part->size) return false;
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);
+  uint8_t buf[1024];
+  bool ok = true;
+  for (uint32_t off = 0; off < size && ok; off += sizeof buf) {
+    const uint32_t n = (size - off) < sizeof buf ? (size - off) : (uint32_t)sizeof buf;
+    ok = esp_partition_read(part, off, buf, n) == ESP_OK;
+    if (ok) mbedtls_sha256_update(&sha, buf, n);
+  }
+  mbedtls_sha256_finish(&sha, out);
+  mbedtls_sha256_free(&sha);
+  return ok;
+}
+
+// Random-access variant: the image was already written into `target` out of
+// order (fleet_ota.h chunk broadcast), so there is no esp_ota handle to finish.
+// Re-reads the first `size` bytes, checks the SHA-256 against the verified
+// offer, then sets the boot slot (esp_ota_set_boot_partition runs the same ESP
+// image validation esp_ota_end does). Never changes the boot slot on failure.
+static inline FwReason otaInstallFromPartition(const esp_partition_t* target, uint32_t size,
+                                               const uint8_t expectedSha[32]) {
+  if (!target || target == esp_ota_get_running_partition()) return FW_FLASH_WRITE_FAILED;
+  if (size == 0 || size > target->size) return FW_IMAGE_TOO_LARGE;
+
+  uint8_t got[32];
+  if (!otaSha256Partition(target, size, got)) return FW_FLASH_WRITE_FAILED;
+  if (memcmp(got, expectedSha, 32) != 0) return FW_HASH_MISMATCH;
+
+  const esp_err_t err = esp_ota_set_boot_partition(target);
+  if (err == ESP_ERR_OTA_VALIDATE_FAILED) return FW_IMAGE_INVALID;
+  if (err != ESP_OK) return FW_FLASH_WRITE_FAILED;
+  return FW_NONE;
+}
+
 // --- Boot-side (first-boot validation / rollback) ---
 
 static inline bool otaIsPendingVerify() {
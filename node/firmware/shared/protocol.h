@@ -129,8 +129,41 @@ typedef struct node_config_message {
                                 // + NODE_SENSOR_MASK_VALID. 0 = auto (legacy: an
                                 // older mothership sends 0 -> node auto-detects).
     uint32_t syncPhaseUnix;     // sync anchor (unix seconds)
+    // --- Aggregation mode (appended; absent from 60-byte legacy frames) ---
+    uint8_t  aggSamplesPerReport; // 0/1 = off. N>=2: wake every wakeIntervalMin,
+                                  // queue one min/mean/max/SD summary per N wakes.
+    uint8_t  aggReserved;
+    uint16_t aggStatsMask;      // SNAP_PRESENT_* groups that get min/max/SD
+                                // (0 = every eligible channel); others mean only.
+    // --- Report-by-exception (appended; absent from 60/64-byte frames) ---
+    uint16_t rbeMaxSilenceMin;  // 0 = off. Else a channel is only sent when it
+                                // leaves its deadband, with a full snapshot at
+                                // least every rbeMaxSilenceMin minutes.
+    uint8_t  rbeDeadbandTenths; // scale on the node's per-channel deadbands in
+                                // tenths (10 = 1.0x); 0 = default (1.0x).
+    uint8_t  rbeReserved;
+    // --- Urgent thresholds (appended; absent from 60/64/68-byte frames) ---
+    uint8_t  urgentFlags;       // urgent_listen::kFrost | kFlood; 0 = off. When
+                                // set, data wakes align to wakeIntervalMin
+                                // boundaries and a crossing is sent at once as
+                                // an URGENT snapshot (SNAP2_FLAG_URGENT).
+    uint8_t  urgentReserved;
+    int16_t  urgentAirBelowCenti; // frost: air temperature below, 0.01 °C
+    uint16_t urgentSoilAboveMv;   // flood: soil 1 probe above, mV
+    uint16_t urgentReserved2;
 } node_config_message_t;
 
+// Sizes of node_config_message_t before the aggregation, report-by-exception
+// and urgent-threshold fields were appended. Nodes accept all four sizes
+// (missing fields read as 0 = off), and the mothership sends the shortest
+// frame that carries the features in use so nodes on older firmware, which
+// validate by exact size, keep receiving their config.
+#define NODE_CONFIG_LEGACY_SIZE 60
+#define NODE_CONFIG_AGG_SIZE    64
+#define NODE_CONFIG_RBE_SIZE    68
+#define NODE_AGG_MAX_SAMPLES_PER_REPORT 60
+#define NODE_RBE_MAX_SILENCE_MIN 1440
+
 // ===== Pull-handshake messages (Phase 2) =====
 
 // Node -> Mothership: sent at start of each wake cycle (before data flush)
@@ -239,9 +272,16 @@ typedef struct snapshot_ack {
     uint32_t seqNum;
     uint8_t  persisted;         // 1 = mothership durably stored this seq
     uint8_t  protocolVersion;   // NODE_PROTOCOL_VERSION
-    uint16_t reserved;
+    uint8_t  flags;             // SNAPSHOT_ACK_* (was reserved, always 0)
+    uint8_t  reserved;
 } snapshot_ack_t;
 
+// The hub had no report-by-exception reference for this node, so a
+// SNAP_QF_CARRIED_FORWARD snapshot was stored with only the channels it
+// carried. The node drops its own reference and sends its next snapshot in
+// full.
+#define SNAPSHOT_ACK_SEND_FULL 0x01
+
 // ===== Coordinated sync-session messages =====
 //
 // A sync wake is a bounded mothership-controlled pull session:
@@ -299,6 +339,101 @@ typedef struct __attribute__((packed)) sync_release_ack_message {
     uint8_t  remainingRecords;
 } sync_release_ack_message_t;
 
+// ===== Two-way clock exchange =====
+//
+// NTP-style probe inside a sync session, after NODE_HELLO. All timestamps are
+// unix milliseconds: t1/t4 on the node clock, t2/t3 on the mothership clock.
+//   offset = ((t2 - t1) + (t3 - t4)) / 2     delay = (t4 - t1) - (t3 - t2)
+// The node keeps the lowest-delay sample, corrects its RTC, then sends one
+// last CLOCK_PROBE with CLOCK_PROBE_REPORT set so the mothership can record
+// the measured offset/drift. These are separate messages rather than new
+// fields on NODE_HELLO / SYNC_RELEASE because both sides match those by exact
+// size; firmware without them simply keeps the one-second RELEASE sync.
+
+#define CLOCK_PROBE_REPORT   0x01  // final report; offsetMs/delayMs are valid
+#define CLOCK_PROBE_STEPPED  0x02  // RTC was stepped using offsetMs
+#define CLOCK_DRIFT_VALID    0x04  // driftCentiPpm/agingOffset are valid
+
+typedef struct __attribute__((packed)) clock_probe_message {
+    char     command[16];       // "CLOCK_PROBE"
+    char     nodeId[16];
+    uint32_t sessionId;
+    uint8_t  seq;               // echoed in CLOCK_REPLY
+    uint8_t  flags;             // CLOCK_PROBE_* / CLOCK_DRIFT_VALID
+    int8_t   agingOffset;       // DS3231 aging register after this session
+    uint8_t  reserved;
+    int64_t  t1Ms;              // node clock at transmit
+    int32_t  offsetMs;          // report: mothership minus node before the step
+    uint16_t delayMs;           // report: round trip of the chosen sample
+    int16_t  driftCentiPpm;     // report: node rate error, +ve = node fast
+} clock_probe_message_t;
+
+typedef struct __attribute__((packed)) clock_reply_message {
+    char     command[16];       // "CLOCK_REPLY"
+    char     nodeId[16];
+    uint32_t sessionId;
+    uint8_t  seq;
+    uint8_t  reserved[3];
+    int64_t  t1Ms;              // echoed from the probe
+    int64_t  t2Ms;              // mothership clock at probe receive
+    int64_t  t3Ms;              // mothership clock at reply transmit
+} clock_reply_message_t;
+
+// ===== Fleet config digest =====
+//
+// Instead of broadcasting one NODE_CONFIG per node every config burst, the
+// mothership broadcasts (shortId, configVersion) for the whole fleet. A node
+// that finds its own entry newer than the version it has applied sends
+// CONFIG_PULL, and the full NODE_CONFIG comes back unicast. The mothership also
+// unicasts it to any node whose NODE_HELLO shows it lagging, which is how
+// firmware that predates the digest (and drops it as unknown) still converges.
+// shortId is a hash, so a node reads the highest version listed under its own
+// shortId: a collision can then only cause a redundant pull.
+
+#define CONFIG_DIGEST_MAX_ENTRIES 56
+#define CONFIG_DIGEST_HEADER_SIZE 20
+
+typedef struct __attribute__((packed)) config_digest_entry {
+    uint16_t shortId;           // configDigestShortId(nodeId)
+    uint16_t configVersion;     // desired version
+} config_digest_entry_t;
+
+typedef struct __attribute__((packed)) config_digest_message {
+    char     command[16];       // "CONFIG_DIGEST"
+    uint8_t  page;              // 0-based; the fleet spans `pages` frames
+    uint8_t  pages;
+    uint8_t  count;             // entries used; the frame is cut after them
+    uint8_t  reserved;
+    config_digest_entry_t entries[CONFIG_DIGEST_MAX_ENTRIES];
+} config_digest_message_t;
+static_assert(sizeof(config_digest_message_t) <= 250,
+              "CONFIG_DIGEST exceeds the ESP-NOW v1 payload ceiling");
+static_assert(offsetof(config_digest_message_t, entries) == CONFIG_DIGEST_HEADER_SIZE,
+              "CONFIG_DIGEST header layout changed");
+
+typedef struct __attribute__((packed)) config_pull_message {
+    char     command[16];       // "CONFIG_PULL"
+    char     nodeId[16];
+    uint16_t appliedVersion;    // what the node runs now
+    uint16_t wantedVersion;     // what the digest advertised
+} config_pull_message_t;
+
+// FNV-1a over the NUL-terminated nodeId, folded to 16 bits.
+static inline uint16_t configDigestShortId(const char* nodeId) {
+    uint32_t h = 2166136261UL;
+    for (size_t i = 0; nodeId && nodeId[i] && i < 16; ++i) {
+        h ^= (uint8_t)nodeId[i];
+        h *= 16777619UL;
+    }
+    return (uint16_t)(h ^ (h >> 16));
+}
+
+// ===== Fleet firmware distribution messages =====
+// OTA_OFFER / OTA_NEED / OTA_CHUNK / OTA_RESULT, exchanged inside a sync
+// session. The structs and both sides' state machines live in fleet_ota.h so
+// the host simulation can build them without Arduino.
+#include "fleet_ota.h"
+
 // Optional: RNT-compatible pairing struct
 typedef struct rnt_pairing_t {
     uint8_t msgType;            // 0 = PAIRING, 1 = DATA
@@ -342,6 +477,11 @@ typedef struct rnt_pairing_t {
 #define SENSOR_ID_SPECTRAL_SAT   1113  // saturation/validity flag (0=ok, 1=saturated)
 #define SENSOR_ID_WIND_SPEED    1201
 #define SENSOR_ID_WIND_DIR      1202
+// Reed cup per-wake statistics (same 1200 wind group), computed from the same
+// window as SENSOR_ID_WIND_SPEED over 1 s sub-intervals:
+#define SENSOR_ID_WIND_GUST      1203  // peak 3 s running mean (m/s)
+#define SENSOR_ID_WIND_SPEED_SD  1204  // SD of 1 s speeds (m/s)
+#define SENSOR_ID_WIND_CALM_FRAC 1205  // fraction of 1 s intervals below calm (0..1)
 // The SOIL*_VWC names are retained for wire/schema compatibility. Current
 // node firmware emits moisture sensor output volts in these channels; backend
 // calibration is responsible for converting volts to moisture/VWC.
@@ -353,6 +493,29 @@ typedef struct rnt_pairing_t {
 #define SENSOR_ID_AUX1          3001
 #define SENSOR_ID_AUX2          3002
 #define SENSOR_ID_PAR           1301
+// Aggregation-mode summaries: wakes folded into this record (count).
+#define SENSOR_ID_AGG_SAMPLES   4002
+
+// Aggregate channels. A summary snapshot reports each channel's mean (or
+// peak / vector mean, see snapshot_aggregator.h) under its ordinary id, so
+// every existing consumer keeps working, and appends min / max / SD under
+// stat * 10000 + base id: 11001 = AIR_TEMP min, 21001 = max, 31001 = SD.
+#define SENSOR_AGG_STAT_MIN     1
+#define SENSOR_AGG_STAT_MAX     2
+#define SENSOR_AGG_STAT_SD      3
+#define SENSOR_AGG_STAT_STRIDE  10000u
+
+inline uint16_t aggregateSensorId(uint16_t baseId, uint8_t stat) {
+  return (uint16_t)(stat * SENSOR_AGG_STAT_STRIDE + baseId);
+}
+// 0 for an ordinary channel, else SENSOR_AGG_STAT_*.
+inline uint8_t aggregateStatOf(uint16_t sensorId) {
+  const unsigned stat = sensorId / SENSOR_AGG_STAT_STRIDE;
+  return (stat >= SENSOR_AGG_STAT_MIN && stat <= SENSOR_AGG_STAT_SD) ? (uint8_t)stat : 0;
+}
+inline uint16_t aggregateBaseSensorId(uint16_t sensorId) {
+  return (uint16_t)(sensorId % SENSOR_AGG_STAT_STRIDE);
+}
 
 // Reserved sensor ID ranges:
 // 1000-1999: Standard environmental sensors (temp, humidity, spectral, wind, PAR)
@@ -360,6 +523,18 @@ typedef struct rnt_pairing_t {
 // 3000-3999: Auxiliary inputs
 // 4000-4999: System metrics (battery, internal temp, etc.)
 // 5000-5999: Future port-based dynamic sensors (plug-and-play ports)
+// 11000-35999: Aggregate min / max / SD of the ranges above (aggregation mode)
+
+// node_snapshot_v2_t::qualityFlags bits. Bit 0 is local_queue::QF_DROPPED.
+#define SNAP_QF_AGGREGATED      (1u << 1)  // summary of SENSOR_ID_AGG_SAMPLES wakes
+// Report-by-exception delta: channels inside their deadband were omitted, and a
+// channel that stopped reading since the last send is listed with a NaN value.
+// The FieldHub fills the omitted channels from the node's last values and keeps
+// the flag on the stored row, so carried-forward rows stay identifiable.
+#define SNAP_QF_CARRIED_FORWARD (1u << 2)
+// Aggregated summary that did not have room for every channel's min / max / SD
+// triple: the headline values are complete, some stats are missing.
+#define SNAP_QF_AGG_STATS_PARTIAL (1u << 3)
 
 // ===== Snapshot packet (node -> mothership, one per wake cycle) =====
 // Single packet containing all sensor values for one wake event.
@@ -462,7 +637,10 @@ inline uint16_t snapPresentBitForSensorId(uint16_t sensorId) {
     case SENSOR_ID_SPECTRAL_GAIN: case SENSOR_ID_SPECTRAL_ATIME:
     case SENSOR_ID_SPECTRAL_SAT:
       return SNAP_PRESENT_SPECTRAL;
-    case SENSOR_ID_WIND_SPEED:   case SENSOR_ID_WIND_DIR:  return SNAP_PRESENT_WIND;
+    case SENSOR_ID_WIND_SPEED:   case SENSOR_ID_WIND_DIR:
+    case SENSOR_ID_WIND_GUST:    case SENSOR_ID_WIND_SPEED_SD:
+    case SENSOR_ID_WIND_CALM_FRAC:
+      return SNAP_PRESENT_WIND;
     case SENSOR_ID_SOIL1_VWC:    case SENSOR_ID_SOIL1_TEMP: return SNAP_PRESENT_SOIL1;
     case SENSOR_ID_SOIL2_VWC:    case SENSOR_ID_SOIL2_TEMP: return SNAP_PRESENT_SOIL2;
     case SENSOR_ID_AUX1:         return SNAP_PRESENT_AUX1;
@@ -499,7 +677,13 @@ static_assert(sizeof(pairing_command_t) == 52, "pairing_command_t size mismatch"
 static_assert(sizeof(config_snapshot_message_t) == 52, "config_snapshot_message_t size mismatch");
 static_assert(sizeof(deployment_command_t) == 92, "deployment_command_t size mismatch");
 static_assert(sizeof(unpair_command_t) == 48, "unpair_command_t size mismatch");
-static_assert(sizeof(node_config_message_t) == 60, "node_config_message_t size mismatch");
+static_assert(sizeof(node_config_message_t) == 76, "node_config_message_t size mismatch");
+static_assert(offsetof(node_config_message_t, aggSamplesPerReport) == NODE_CONFIG_LEGACY_SIZE,
+              "aggregation fields must extend the legacy NODE_CONFIG frame");
+static_assert(offsetof(node_config_message_t, rbeMaxSilenceMin) == NODE_CONFIG_AGG_SIZE,
+              "report-by-exception fields must extend the aggregation frame");
+static_assert(offsetof(node_config_message_t, urgentFlags) == NODE_CONFIG_RBE_SIZE,
+              "urgent-threshold fields must extend the report-by-exception frame");
 static_assert(sizeof(time_sync_response_t) == 56, "time_sync_response_t size mismatch");
 static_assert(sizeof(config_apply_ack_message_t) == 40, "config_apply_ack_message_t size mismatch");
 static_assert(sizeof(snapshot_ack_t) == 40, "snapshot_ack_t size mismatch");
@@ -534,11 +718,16 @@ typedef struct __attribute__((packed)) node_snapshot_v2 {
     uint16_t qualityFlags;      // QF_DROPPED etc.                2
     uint16_t configVersion;     // node config version            2
     uint8_t  protocolVersion;   // 2                              1
-    uint8_t  reserved;          // padding                        1
+    uint8_t  flags;             // SNAP2_FLAG_* (was padding, 0)  1
     // Body follows: v2_reading_t readings[sensorCount]
 } node_snapshot_v2_t;
 static_assert(sizeof(node_snapshot_v2_t) == 48, "node_snapshot_v2_t header must be 48 bytes");
 
+// Sent outside the sync session because a configured threshold was crossed
+// (see urgent_listen.h). The readings are a full snapshot; the mothership
+// persists it like any other and pushes it to the cloud straight away.
+#define SNAP2_FLAG_URGENT 0x01
+
 #define NODE_SNAPSHOT_V2_DEFINED
 #define V2_READING_DEFINED
 
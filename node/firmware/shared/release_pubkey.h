@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+
+// ---------------------------------------------------------------------------
+// Release verification public key (Ed25519, 32 bytes).
+//
+// *** PLACEHOLDER — bench/test key from scripts/release_sign.py. ***
+// Before any real deployment, replace with the PRODUCTION public key whose
+// private half is generated by `release_sign.py keygen` and kept offline.
+// ---------------------------------------------------------------------------
+// *** BENCH KEY — TEMPORARY *** Revert to the production key above after the
+// cloud-OTA bench. Private half is in scripts/ota-bench/bench-key.json (gitignored),
+// generated locally with scripts/release_sign.py keygen. See
+// docs/FIELDMESH_CLOUD_OTA_BENCH_RUNBOOK.md.
+//
+// One key for both roles: the mothership checks release manifests against it,
+// and nodes check the fleet OTA statement in every OTA_OFFER (fleet_ota.h).
+// FieldMesh release verification public key (Ed25519, 32 bytes)
+static const uint8_t kReleasePubKey[32] = { 0x09, 0x8c, 0x05, 0x3a, 0x8f, 0xee, 0x38, 0x5d, 0x84, 0x8c, 0x5c, 0x06, 0xcc, 0x9b, 0x8f, 0xe3, 0xa2, 0x5c, 0x60, 0x09, 0x60, 0xcc, 0x96, 0xbb, 0x24, 0x7d, 0xa2, 0xda, 0x57, 0x84, 0x26, 0x3c };
@@ -0,0 +1,16 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <Ed25519.h>       // rweather/Crypto
+
+// ===== Release signature check (shared by both roles) =====
+//
+// Ed25519 over exact bytes with the embedded release key (release_pubkey.h).
+// Split out of firmware_manifest.h so a node can check a release-signed fleet
+// OTA statement (fleet_ota.h) without pulling in the JSON manifest parser.
+
+static inline bool manifestVerifySignature(const uint8_t* json, size_t len,
+                                           const uint8_t sig64[64],
+                                           const uint8_t pub32[32]) {
+  return Ed25519::verify(sig64, pub32, json, len);
+}
@@ -36,13 +36,16 @@ struct SensorSlot {
 //   air(2) + spectral bands(8) + soil(4) + wind(1) + aux(2) = 17
 constexpr size_t MAX_SENSORS = 20;  // headroom above the 17-slot standard profile
 constexpr size_t SPECTRAL_METADATA_READING_COUNT = 5;
+// Reed anemometer gust / SD / calm fraction (1203-1205), same metadata pattern.
+constexpr size_t WIND_STATS_READING_COUNT = 3;
 
 // captureSensorsToQueue() adds one battery reading before registry readings.
 // Prove at compile time that even a completely full registry still leaves room
-// for the AS7341 metadata without exceeding the ESP-NOW V2 packet limit.
-static_assert(MAX_SENSORS + 1 + SPECTRAL_METADATA_READING_COUNT <=
-                  MAX_READINGS_PER_SNAPSHOT,
-              "V2 snapshot capacity cannot hold registry + battery + spectral metadata");
+// for the AS7341 metadata and wind statistics without exceeding the ESP-NOW V2
+// packet limit.
+static_assert(MAX_SENSORS + 1 + SPECTRAL_METADATA_READING_COUNT +
+                  WIND_STATS_READING_COUNT <= MAX_READINGS_PER_SNAPSHOT,
+              "V2 snapshot capacity cannot hold registry + battery + metadata");
 
 // Global registry (defined in sensors.cpp)
 extern SensorSlot g_sensors[MAX_SENSORS];
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Low-latency listening: urgent threshold crossings reach the cloud within a
+// data wake instead of waiting for the next sync slot.
+//
+// Pure arithmetic — no Arduino — so the node, the mothership and the native
+// host simulation (tests/test_urgent_listen_sim.cpp) run the same code.
+//
+// A node with urgent thresholds aligns its data wakes to whole multiples of
+// its wake interval (unix time), so every node's wake lands on a boundary the
+// mothership can predict. When a wake's snapshot crosses a threshold the node
+// sends it straight away as an URGENT frame (NODE_SNAPSHOT2 with
+// SNAP2_FLAG_URGENT). The mothership, which is otherwise powered off between
+// sync slots, wakes for a short listen window around those boundaries,
+// persists whatever urgent frames arrive and pushes them in one short modem
+// POST. A crossing that is not acknowledged (no listen window that wake, frame
+// lost) is resent on every later wake until it is.
+
+namespace urgent_listen {
+
+// Threshold bits, carried in NODE_CONFIG urgentFlags.
+constexpr uint8_t kFrost = 0x01;  // air temperature fell below the frost line
+constexpr uint8_t kFlood = 0x02;  // soil 1 probe rose above the flood line
+
+// A crossing re-arms only once the value has come back past the threshold by
+// this much, so a reading hovering on the line sends one frame, not one per
+// wake.
+constexpr int32_t kFrostHysteresisCenti = 50;  // 0.5 °C
+constexpr int32_t kFloodHysteresisMv = 20;     // soil probes report sensor volts
+
+struct Thresholds {
+  uint8_t flags;              // kFrost | kFlood; 0 = urgent reporting off
+  int16_t airBelowCenti;      // frost: air temperature below, 0.01 °C
+  uint16_t soilAboveMv;       // flood: soil 1 probe above, mV
+};
+
+// Survives deep sleep on the node. `active` is the alarm state with
+// hysteresis; `delivered` the alarms the mothership has acknowledged.
+struct State {
+  uint8_t active;
+  uint8_t delivered;
+};
+
+// Fold one wake's readings into `s` and return the alarms that still need an
+// urgent frame. NaN (sensor missing this wake) leaves that alarm as it was.
+inline uint8_t evaluate(const Thresholds& t, float airTempC, float soilVolts, State& s) {
+  if (!(t.flags & kFrost)) s.active &= (uint8_t)~kFrost;
+  if (!(t.flags & kFlood)) s.active &= (uint8_t)~kFlood;
+  if ((t.flags & kFrost) && !isnan(airTempC)) {
+    const float below = t.airBelowCenti / 100.0f;
+    const float clear = (t.airBelowCenti + kFrostHysteresisCenti) / 100.0f;
+    if (airTempC < below) s.active |= kFrost;
+    else if (airTempC >= clear) s.active &= (uint8_t)~kFrost;
+  }
+  if ((t.flags & kFlood) && !isnan(soilVolts)) {
+    const float above = t.soilAboveMv / 1000.0f;
+    const float clear = ((int32_t)t.soilAboveMv - kFloodHysteresisMv) / 1000.0f;
+    if (soilVolts > above) s.active |= kFlood;
+    else if (soilVolts <= clear) s.active &= (uint8_t)~kFlood;
+  }
+  // A cleared alarm may be delivered again the next time it trips.
+  s.delivered &= s.active;
+  return (uint8_t)(s.active & ~s.delivered);
+}
+
+inline void markDelivered(State& s, uint8_t bits) {
+  s.delivered |= (uint8_t)(bits & s.active);
+}
+
+// ---------------------------------------------------------------------------
+// Schedule
+// ---------------------------------------------------------------------------
+
+// The mothership is up kListenLeadSec before a boundary (boot, radio up) and
+// listens until kListenTailSec after it: a node spends up to ~15 s on its
+// sensors (the reed anemometer window is 10 s) before the frame goes out.
+constexpr uint32_t kListenLeadSec = 5;
+constexpr uint32_t kListenTailSec = 30;
+constexpr uint32_t kListenWindowSec = kListenLeadSec + kListenTailSec;
+
+// Listening every minute would keep the mothership up more than half the
+// time; 1-minute nodes are heard on every fifth wake instead.
+constexpr uint32_t kMinListenIntervalMin = 5;
+
+// A listen window is skipped when it would still be open this close to the
+// next sync wake: the sync session accepts urgent frames itself.
+constexpr uint32_t kSyncGuardSec = 60;
+
+// First boundary (multiple of intervalMin minutes) strictly after nowUnix.
+inline uint32_t nextBoundary(uint32_t nowUnix, uint32_t intervalMin) {
+  if (intervalMin == 0) intervalMin = 1;
+  const uint32_t period = intervalMin * 60UL;
+  return (nowUnix / period + 1UL) * period;
+}
+
+inline uint32_t gcd(uint32_t a, uint32_t b) {
+  while (b != 0) {
+    const uint32_t r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+// Listen cadence for the nodes that have urgent thresholds: the greatest
+// common divisor of their wake intervals, so each node's boundaries are
+// listen boundaries, raised to a multiple of itself no shorter than
+// kMinListenIntervalMin. 0 = nobody to listen for.
+inline uint32_t listenIntervalMin(const uint8_t* wakeIntervalMin, size_t count) {
+  uint32_t g = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t w = wakeIntervalMin[i] ? wakeIntervalMin[i] : 1;
+    g = g ? gcd(g, w) : w;
+  }
+  if (g == 0) return 0;
+  if (g < kMinListenIntervalMin) {
+    g = ((kMinListenIntervalMin + g - 1) / g) * g;
+  }
+  return g;
+}
+
+// Wake time (boundary - kListenLeadSec) of the next listen window that starts
+// after nowUnix + minArmSec and closes kSyncGuardSec before nextSyncWakeUnix.
+// 0 = none: the next wake is the sync wake.
+inline uint32_t nextListenWake(uint32_t nowUnix, uint32_t listenMin,
+                               uint32_t nextSyncWakeUnix, uint32_t minArmSec = 5) {
+  if (listenMin == 0) return 0;
+  uint32_t boundary = nextBoundary(nowUnix + minArmSec + kListenLeadSec - 1, listenMin);
+  if (nextSyncWakeUnix != 0 &&
+      boundary + kListenTailSec + kSyncGuardSec > nextSyncWakeUnix) {
+    return 0;
+  }
+  return boundary - kListenLeadSec;
+}
+
+// ---------------------------------------------------------------------------
+// Power budget
+// ---------------------------------------------------------------------------
+
+// Bench estimates for the FieldHub board; the budget is a planning figure,
+// not a measurement.
+constexpr float kHubBootSec = 1.5f;      // PWR_HOLD to radio up, storage mounted
+constexpr float kHubListenMa = 110.0f;   // ESP32 with ESP-NOW receive on
+constexpr float kUrgentPostSec = 45.0f;  // modem power-on, attach, one POST
+constexpr float kUrgentPostMa = 180.0f;  // average over the POST session
+
+struct PowerBudget {
+  uint32_t listenWakesPerDay;
+  float listenSecPerDay;
+  float dutyPercent;       // share of the day spent in listen windows
+  float listenMahPerDay;
+  float postMahEach;       // one urgent POST
+  float totalMahPerDay;    // listen windows + urgentPostsPerDay POSTs
+};
+
+// Walks one day of the listen schedule against sync wakes every
+// syncIntervalMin (phase syncPhaseUnix), so the skipped windows are counted
+// exactly as the mothership would skip them.
+inline PowerBudget estimateBudget(uint32_t listenMin, uint32_t syncIntervalMin,
+                                  uint32_t syncPhaseUnix, float urgentPostsPerDay) {
+  PowerBudget b{};
+  if (listenMin != 0) {
+    const uint32_t day = 86400UL;
+    const uint32_t syncPeriod = syncIntervalMin * 60UL;
+    uint32_t now = syncPhaseUnix;
+    while (now < syncPhaseUnix + day) {
+      uint32_t nextSync = 0;
+      if (syncPeriod != 0) {
+        nextSync = syncPhaseUnix + ((now - syncPhaseUnix) / syncPeriod + 1UL) * syncPeriod;
+      }
+      const uint32_t wake = nextListenWake(now, listenMin, nextSync);
+      if (wake == 0) {
+        now = nextSync + 1;
+        continue;
+      }
+      if (wake >= syncPhaseUnix + day) break;
+      b.listenWakesPerDay++;
+      now = wake + kListenWindowSec;
+    }
+  }
+  const float awakeSec = kHubBootSec + (float)kListenWindowSec;
+  b.listenSecPerDay = (float)b.listenWakesPerDay * awakeSec;
+  b.dutyPercent = b.listenSecPerDay / 864.0f;
+  b.listenMahPerDay = b.listenSecPerDay * kHubListenMa / 3600.0f;
+  b.postMahEach = kUrgentPostSec * kUrgentPostMa / 3600.0f;
+  b.totalMahPerDay = b.listenMahPerDay + urgentPostsPerDay * b.postMahEach;
+  return b;
+}
+
+// Worst case from capture to the end of the urgent POST for a node woken
+// every wakeMin minutes: a crossing on a wake the mothership does not listen
+// for waits for the next listen boundary.
+inline uint32_t worstLatencySec(uint32_t wakeMin, uint32_t listenMin) {
+  const uint32_t wait = wakeMin < listenMin ? (listenMin - wakeMin) * 60UL : 0;
+  return wait + kListenTailSec + (uint32_t)kUrgentPostSec;
+}
+
+}  // namespace urgent_listen
@@ -1,6 +1,29 @@
 // ads1115_helper.cpp
 #include "ads1115_helper.h"
 
+namespace {
+
+constexpr uint8_t  REG_CONVERSION = 0x00;
+constexpr uint8_t  REG_CONFIG     = 0x01;
+constexpr uint8_t  REG_LO_THRESH  = 0x02;
+constexpr uint8_t  REG_HI_THRESH  = 0x03;
+
+constexpr uint16_t CFG_DR_MASK    = 0x00E0;
+constexpr uint16_t CFG_COMP_QUE   = 0x0003;  // 11 = comparator disabled
+
+// Worst-case conversion time per DR code, with the datasheet's 10% oscillator
+// tolerance. Only used when no ALERT/RDY pin is wired.
+uint32_t conversionUs(uint16_t dataRate) {
+    switch (dataRate & CFG_DR_MASK) {
+        case ADS1115::DR_860SPS: return 1300;
+        case ADS1115::DR_475SPS: return 2320;
+        case ADS1115::DR_250SPS: return 4400;
+        default:                 return 8600;  // 128 SPS
+    }
+}
+
+} // namespace
+
 ADS1115::ADS1115(TwoWire &wire, uint8_t address, float vref)
 : m_wire(&wire),
   m_addr(address),
@@ -18,35 +41,60 @@ bool ADS1115::begin() {
         return false;
     }
     Serial.printf("[ADS] probe @0x%02X OK\n", m_addr);
+    if (m_rdyPin >= 0) {
+        // Hi_thresh MSB=1, Lo_thresh MSB=0 turns ALERT into conversion-ready.
+        if (!writeRegister(REG_HI_THRESH, 0x8000) ||
+            !writeRegister(REG_LO_THRESH, 0x0000)) {
+            Serial.println(F("[ADS] RDY threshold setup failed - using timed waits"));
+            m_rdyPin = -1;
+        }
+    }
     return true;
 }
 
-bool ADS1115::readChannelMv(uint8_t ch, int16_t &rawOut, float &mvOut) {
-    if (ch > 3) return false;
+void ADS1115::setReadyPin(int gpio) {
+    m_rdyPin = gpio;
+    if (m_rdyPin >= 0) pinMode(m_rdyPin, INPUT_PULLUP);
+}
 
+bool ADS1115::writeRegister(uint8_t reg, uint16_t value) {
+    m_wire->beginTransmission(m_addr);
+    m_wire->write(reg);
+    m_wire->write((uint8_t)(value >> 8));
+    m_wire->write((uint8_t)(value & 0xFF));
+    return m_wire->endTransmission() == 0;
+}
+
+bool ADS1115::startSingleShot(uint8_t ch, uint16_t dataRate) {
     // single-ended mux: 100=AIN0, 101=AIN1, 110=AIN2, 111=AIN3
     uint16_t muxBits = 0x4000 | ((ch & 0x03) << 12);
-    uint16_t cfg     = m_baseConfig | muxBits;
-
-    uint8_t cfgBytes[2] = {
-        (uint8_t)(cfg >> 8),
-        (uint8_t)(cfg & 0xFF)
-    };
+    uint16_t cfg     = (m_baseConfig & ~CFG_DR_MASK) | (dataRate & CFG_DR_MASK) | muxBits;
+    // COMP_QUE=00 asserts ALERT/RDY after every conversion; 11 leaves it off.
+    if (m_rdyPin >= 0) cfg &= ~CFG_COMP_QUE;
+    return writeRegister(REG_CONFIG, cfg);
+}
 
-    // Write config
-    m_wire->beginTransmission(m_addr);
-    m_wire->write(0x01);                  // config register
-    m_wire->write(cfgBytes, 2);
-    if (m_wire->endTransmission() != 0) {
-        return false;
+void ADS1115::waitConversion(uint16_t dataRate) {
+    const uint32_t budgetUs = conversionUs(dataRate);
+    if (m_rdyPin < 0) {
+        // Millisecond-scale waits yield to the scheduler; only the fast rates
+        // busy-wait, where a 1 ms tick would double the conversion time.
+        if (budgetUs >= 2000) delay((budgetUs + 999) / 1000);
+        else                  delayMicroseconds(budgetUs);
+        return;
     }
+    // ALERT/RDY (COMP_POL=0) drops low when the single-shot result latches.
+    // Bounded by twice the timed budget so a broken wire degrades to the
+    // timed behaviour instead of hanging the wake.
+    const uint32_t t0 = micros();
+    while (digitalRead(m_rdyPin) != LOW) {
+        if ((micros() - t0) > 2 * budgetUs) return;
+    }
+}
 
-    // Wait conversion (~8ms at 128SPS)
-    delay(9);
-
-    // Read conversion register
+bool ADS1115::readConversion(int16_t &rawOut) {
     m_wire->beginTransmission(m_addr);
-    m_wire->write((uint8_t)0x00);
+    m_wire->write(REG_CONVERSION);
     if (m_wire->endTransmission(false) != 0) {
         return false;
     }
@@ -57,10 +105,39 @@ bool ADS1115::readChannelMv(uint8_t ch, int16_t &rawOut, float &mvOut) {
 
     uint8_t hi = m_wire->read();
     uint8_t lo = m_wire->read();
-    int16_t val = (int16_t)((hi << 8) | lo);
+    rawOut = (int16_t)((hi << 8) | lo);
+    return true;
+}
+
+bool ADS1115::readChannelMv(uint8_t ch, int16_t &rawOut, float &mvOut) {
+    if (ch > 3) return false;
+
+    const uint16_t dataRate = m_baseConfig & CFG_DR_MASK;
+    if (!startSingleShot(ch, dataRate)) {
+        return false;
+    }
+
+    // Wait conversion (~8ms at 128SPS, or until RDY)
+    waitConversion(dataRate);
+
+    int16_t val;
+    if (!readConversion(val)) {
+        return false;
+    }
 
     rawOut = val;
-    mvOut  = (val / 32768.0f) * m_vref * 1000.0f;
+    mvOut  = rawToMv(val);
 
     return true;
 }
+
+bool ADS1115::readChannelBatchRaw(uint8_t ch, int16_t *out, size_t k, uint16_t dataRate) {
+    if (ch > 3 || !out) return false;
+
+    for (size_t i = 0; i < k; ++i) {
+        if (!startSingleShot(ch, dataRate)) return false;
+        waitConversion(dataRate);
+        if (!readConversion(out[i])) return false;
+    }
+    return true;
+}
@@ -5,17 +5,42 @@
 
 class ADS1115 {
 public:
+    // Config-register DR field (bits 7:5). Conversion time is 1/rate.
+    static constexpr uint16_t DR_128SPS = 0x0080;
+    static constexpr uint16_t DR_250SPS = 0x00A0;
+    static constexpr uint16_t DR_475SPS = 0x00C0;
+    static constexpr uint16_t DR_860SPS = 0x00E0;
+
     ADS1115(TwoWire &wire, uint8_t address = 0x48, float vref = 4.096f);
 
     // Probe device on bus, return true if found
     bool begin();
 
+    // Optional ALERT/RDY wiring. With a GPIO (>= 0) the comparator is set up
+    // as a conversion-ready output and every wait polls the pin instead of
+    // sleeping the worst-case conversion time. -1 (default) = timed waits.
+    void setReadyPin(int gpio);
+
     // Read single-ended channel 0..3, return raw + millivolts
     bool readChannelMv(uint8_t ch, int16_t &rawOut, float &mvOut);
 
+    // K back-to-back single-shot conversions of one channel at `dataRate`
+    // (one of the DR_* constants). Same bus transactions as readChannelMv,
+    // with the wait sized to the rate. Returns false on the first bus error.
+    bool readChannelBatchRaw(uint8_t ch, int16_t *out, size_t k,
+                             uint16_t dataRate = DR_128SPS);
+
+    float rawToMv(int16_t raw) const { return (raw / 32768.0f) * m_vref * 1000.0f; }
+
 private:
+    bool writeRegister(uint8_t reg, uint16_t value);
+    bool startSingleShot(uint8_t ch, uint16_t dataRate);
+    void waitConversion(uint16_t dataRate);
+    bool readConversion(int16_t &rawOut);
+
     TwoWire   *m_wire;
     uint8_t    m_addr;
     float      m_vref;
     uint16_t   m_baseConfig;
+    int        m_rdyPin = -1;
 };
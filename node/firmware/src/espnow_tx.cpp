@@ -0,0 +1,145 @@
+#include "espnow_tx.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+
+namespace {
+
+TxTracker     g_tracker;
+portMUX_TYPE  g_mux = portMUX_INITIALIZER_UNLOCKED;
+QueueHandle_t g_done = nullptr;     // TxCompletion, filled by the send callback
+TaskHandle_t  g_waiter = nullptr;
+espnow_tx::Stats g_stats{};
+
+// Completions drained from g_done and not yet claimed by poll(). A ticket is
+// normally claimed right after it completes, so a few entries are plenty; the
+// oldest is overwritten if nobody ever asks (fire-and-forget frames).
+constexpr uint8_t kResultSlots = kTxMaxInFlight * 2;
+TxCompletion g_results[kResultSlots];
+uint8_t      g_resultNext = 0;
+
+void account(const TxCompletion& c) {
+  ++g_stats.frames;
+  switch (c.outcome) {
+    case TxOutcome::Acked:  ++g_stats.acked;  break;
+    case TxOutcome::Failed: ++g_stats.failed; break;
+    case TxOutcome::Lost:   ++g_stats.lost;   break;
+  }
+  if (c.outcome != TxOutcome::Lost) {
+    g_stats.latencySumUs += c.latencyUs;
+    if (c.latencyUs > g_stats.latencyMaxUs) g_stats.latencyMaxUs = c.latencyUs;
+  }
+}
+
+void store(const TxCompletion& c) {
+  account(c);
+  g_results[g_resultNext] = c;
+  g_resultNext = (uint8_t)((g_resultNext + 1) % kResultSlots);
+}
+
+// Main task: move callback completions and overdue frames into g_results.
+void drain() {
+  if (g_done) {
+    TxCompletion c;
+    while (xQueueReceive(g_done, &c, 0) == pdTRUE) store(c);
+  }
+  TxCompletion expired[kTxMaxInFlight];
+  portENTER_CRITICAL(&g_mux);
+  const size_t n = g_tracker.expire(millis(), expired);
+  portEXIT_CRITICAL(&g_mux);
+  for (size_t i = 0; i < n; ++i) store(expired[i]);
+}
+
+}  // namespace
+
+namespace espnow_tx {
+
+bool begin() {
+  g_waiter = xTaskGetCurrentTaskHandle();
+  if (!g_done) g_done = xQueueCreate(kTxMaxInFlight * 2, sizeof(TxCompletion));
+  return g_done != nullptr;
+}
+
+esp_err_t submit(const uint8_t* mac, const void* payload, size_t len,
+                 uint32_t timeoutMs, uint32_t& ticketOut) {
+  ticketOut = 0;
+  if (!mac || !payload || len == 0) return ESP_ERR_INVALID_ARG;
+  drain();
+
+  portENTER_CRITICAL(&g_mux);
+  const uint32_t ticket = g_tracker.push(mac, (uint32_t)esp_timer_get_time(),
+                                         millis() + timeoutMs);
+  portEXIT_CRITICAL(&g_mux);
+  if (ticket == 0) return ESP_ERR_ESPNOW_FULL;
+
+  const esp_err_t res = esp_now_send(mac, reinterpret_cast<const uint8_t*>(payload), len);
+  if (res != ESP_OK) {
+    portENTER_CRITICAL(&g_mux);
+    g_tracker.cancel(ticket);
+    portEXIT_CRITICAL(&g_mux);
+    return res;
+  }
+  ticketOut = ticket;
+  return ESP_OK;
+}
+
+bool poll(uint32_t ticket, TxCompletion& out) {
+  if (ticket == 0) return false;
+  drain();
+  for (uint8_t i = 0; i < kResultSlots; ++i) {
+    if (g_results[i].ticket != ticket) continue;
+    out = g_results[i];
+    g_results[i].ticket = 0;
+    return true;
+  }
+  return false;
+}
+
+uint8_t inFlight() {
+  drain();
+  portENTER_CRITICAL(&g_mux);
+  const uint8_t n = g_tracker.count;
+  portEXIT_CRITICAL(&g_mux);
+  return n;
+}
+
+bool waitForActivity(uint32_t timeoutMs) {
+  if (!g_waiter || timeoutMs == 0) return false;
+  const int64_t start = esp_timer_get_time();
+  TickType_t ticks = pdMS_TO_TICKS(timeoutMs);
+  if (ticks == 0) ticks = 1;
+  const bool woken = ulTaskNotifyTake(pdTRUE, ticks) > 0;
+  g_stats.blockedUs += (uint32_t)(esp_timer_get_time() - start);
+  return woken;
+}
+
+void onSendComplete(const uint8_t* mac, esp_now_send_status_t status) {
+  if (!mac) return;
+  TxCompletion done[kTxMaxInFlight];
+  portENTER_CRITICAL(&g_mux);
+  const size_t n = g_tracker.complete(mac, status == ESP_NOW_SEND_SUCCESS,
+                                      (uint32_t)esp_timer_get_time(), done);
+  portEXIT_CRITICAL(&g_mux);
+  if (n == 0) return;
+  for (size_t i = 0; i < n; ++i) {
+    if (g_done) xQueueSendToBack(g_done, &done[i], 0);
+  }
+  if (g_waiter) xTaskNotifyGive(g_waiter);
+}
+
+void reset() {
+  drain();
+  TxCompletion lost[kTxMaxInFlight];
+  portENTER_CRITICAL(&g_mux);
+  const size_t n = g_tracker.retireAll(lost);
+  portEXIT_CRITICAL(&g_mux);
+  for (size_t i = 0; i < n; ++i) store(lost[i]);
+}
+
+Stats stats() { return g_stats; }
+
+void resetStats() { g_stats = Stats{}; }
+
+}  // namespace espnow_tx
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_now.h>
+#include "espnow_tx_tracker.h"
+
+// Event-driven ESP-NOW transmit path.
+//
+// submit() hands a frame to esp_now_send() and returns a ticket immediately;
+// the send callback (Wi-Fi task) records the outcome in a small completion
+// queue and wakes the main task with a FreeRTOS task notification. The main
+// task blocks in waitForActivity() instead of polling with delay(), so the CPU
+// idles while the radio works. Up to kTxMaxInFlight frames may be outstanding,
+// which lets a second frame queue behind one still waiting for its MAC ACK.
+//
+// The same notification is given by node_event_queue when an inbound event is
+// queued, so one wait covers "my frame finished" and "something arrived".
+
+namespace espnow_tx {
+
+struct Stats {
+  uint32_t frames;       // completed (acked + failed + lost)
+  uint32_t acked;
+  uint32_t failed;
+  uint32_t lost;         // no callback before the frame's deadline
+  uint32_t latencySumUs; // submit -> callback, acked and failed frames
+  uint32_t latencyMaxUs;
+  uint32_t blockedUs;    // main task blocked in waitForActivity()
+};
+
+// Bind the calling task as the one to wake and create the completion queue.
+// Call once from the main task before the first submit().
+bool begin();
+
+// Queue one frame. `timeoutMs` bounds how long its callback may take before
+// the ticket is reported lost. Peer and channel setup are the caller's job.
+// Returns ESP_ERR_ESPNOW_FULL while kTxMaxInFlight frames are outstanding.
+esp_err_t submit(const uint8_t* mac, const void* payload, size_t len,
+                 uint32_t timeoutMs, uint32_t& ticketOut);
+
+// Outcome of `ticket` once its callback arrived (or it was retired as lost).
+// Returns false while it is still in flight.
+bool poll(uint32_t ticket, TxCompletion& out);
+
+// Frames submitted and not yet completed or retired.
+uint8_t inFlight();
+
+// Block until a send completes, an event is queued, or `timeoutMs` passes.
+// Returns true when woken by a notification.
+bool waitForActivity(uint32_t timeoutMs);
+
+// Send-callback hook (Wi-Fi task).
+void onSendComplete(const uint8_t* mac, esp_now_send_status_t status);
+
+// Retire everything in flight as lost (ESP-NOW deinit drops pending callbacks).
+void reset();
+
+Stats stats();
+void resetStats();
+
+}  // namespace espnow_tx
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// In-flight ESP-NOW send bookkeeping.
+//
+// Pure arithmetic — no Arduino, no FreeRTOS — so espnow_tx.cpp and the native
+// host test (tests/test_espnow_tx_tracker.cpp) run the same code. The caller
+// provides the locking: push/cancel/expire run on the main task, complete() on
+// the Wi-Fi task, and espnow_tx.cpp wraps every call in one critical section.
+//
+// ESP-NOW reports send completion in submission order, one callback per frame,
+// and the callback carries only the destination MAC and a status. The tracker
+// keeps the submitted frames in that order so each callback can be tied back
+// to its ticket:
+//
+//   * complete() takes the oldest frame to the reported MAC. An older frame to
+//     a different MAC still waiting in front of it lost its callback (driver
+//     re-init) and is retired as lost, so one lost callback cannot shift
+//     every later status onto the wrong ticket;
+//   * expire() retires frames whose callback is overdue, so a wedged slot
+//     cannot block submission forever. Deadlines are hundreds of ms against a
+//     callback that normally lands within a few ms, so a callback arriving
+//     after its frame expired is not worth tracking separately.
+
+constexpr uint8_t kTxMaxInFlight = 4;
+
+enum class TxOutcome : uint8_t {
+  Acked    = 0,   // MAC-level ACK (unicast) / transmitted (broadcast)
+  Failed   = 1,   // send callback reported failure
+  Lost     = 2,   // callback never arrived; retired by expire() or complete()
+};
+
+struct TxCompletion {
+  uint32_t  ticket;
+  TxOutcome outcome;
+  uint32_t  latencyUs;   // submit -> callback (0 for Lost)
+};
+
+struct TxSlot {
+  uint32_t ticket;
+  uint8_t  mac[6];
+  uint32_t submitUs;
+  uint32_t expireMs;     // millis() after which the callback is overdue
+};
+
+struct TxTracker {
+  TxSlot   slot[kTxMaxInFlight];
+  uint8_t  head = 0;
+  uint8_t  count = 0;
+  uint32_t nextTicket = 1;
+
+  bool full() const { return count >= kTxMaxInFlight; }
+
+  // Record a frame about to be handed to esp_now_send(). Returns 0 when the
+  // tracker is full (the caller waits for a completion and retries).
+  uint32_t push(const uint8_t mac[6], uint32_t nowUs, uint32_t expireMs) {
+    if (full()) return 0;
+    TxSlot& s = slot[(head + count) % kTxMaxInFlight];
+    s.ticket = nextTicket++;
+    if (nextTicket == 0) nextTicket = 1;  // 0 is "no ticket"
+    memcpy(s.mac, mac, 6);
+    s.submitUs = nowUs;
+    s.expireMs = expireMs;
+    ++count;
+    return s.ticket;
+  }
+
+  // Undo push() after esp_now_send() refused the frame. Only the newest slot
+  // can be cancelled: nothing was submitted behind it.
+  bool cancel(uint32_t ticket) {
+    if (count == 0) return false;
+    const uint8_t tail = (uint8_t)((head + count - 1) % kTxMaxInFlight);
+    if (slot[tail].ticket != ticket) return false;
+    --count;
+    return true;
+  }
+
+  // Match one send callback. Writes every retired frame to `out` (at most
+  // kTxMaxInFlight) and returns how many; the last one, if any, is the match.
+  size_t complete(const uint8_t mac[6], bool success, uint32_t nowUs,
+                  TxCompletion* out) {
+    uint8_t match = count;
+    for (uint8_t i = 0; i < count; ++i) {
+      if (memcmp(slot[(head + i) % kTxMaxInFlight].mac, mac, 6) == 0) {
+        match = i;
+        break;
+      }
+    }
+    if (match == count) return 0;  // stale callback for a frame already retired
+    size_t n = 0;
+    for (uint8_t i = 0; i <= match; ++i) {
+      const TxSlot& s = slot[head];
+      TxCompletion& c = out[n++];
+      c.ticket = s.ticket;
+      if (i < match) {
+        c.outcome = TxOutcome::Lost;
+        c.latencyUs = 0;
+      } else {
+        c.outcome = success ? TxOutcome::Acked : TxOutcome::Failed;
+        c.latencyUs = nowUs - s.submitUs;
+      }
+      head = (uint8_t)((head + 1) % kTxMaxInFlight);
+      --count;
+    }
+    return n;
+  }
+
+  // Retire everything (ESP-NOW was deinitialised; no callback will come).
+  size_t retireAll(TxCompletion* out) {
+    size_t n = 0;
+    while (count > 0) {
+      TxCompletion& c = out[n++];
+      c.ticket = slot[head].ticket;
+      c.outcome = TxOutcome::Lost;
+      c.latencyUs = 0;
+      head = (uint8_t)((head + 1) % kTxMaxInFlight);
+      --count;
+    }
+    return n;
+  }
+
+  // Retire overdue frames from the front. Returns how many went to `out`.
+  size_t expire(uint32_t nowMs, TxCompletion* out) {
+    size_t n = 0;
+    while (count > 0 && (int32_t)(nowMs - slot[head].expireMs) >= 0) {
+      TxCompletion& c = out[n++];
+      c.ticket = slot[head].ticket;
+      c.outcome = TxOutcome::Lost;
+      c.latencyUs = 0;
+      head = (uint8_t)((head + 1) % kTxMaxInFlight);
+      --count;
+    }
+    return n;
+  }
+};
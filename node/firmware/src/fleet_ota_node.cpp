@@ -0,0 +1,247 @@
+#include "fleet_ota_node.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <string.h>
+
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "ota_installer.h"
+#include "release_pubkey.h"
+#include "release_signature.h"
+#include "storage/fota_state_store.h"
+
+namespace {
+
+QueueHandle_t g_chunks = nullptr;
+TaskHandle_t g_waiter = nullptr;
+// Image id the receive callback filters on (0 = not collecting anything).
+volatile uint32_t g_acceptImageId = 0;
+
+FotaRxState g_state;
+char g_nodeId[16] = {0};
+char g_runningVersion[12] = {0};
+char g_hwTarget[16] = {0};
+uint32_t g_installedSequence = 0;
+uint16_t g_storedSincePersist = 0;
+bool g_dirty = false;
+
+// fotaRxAcceptChunk() sink over the inactive OTA slot.
+struct SlotSink {
+  const esp_partition_t* part;
+  bool eraseSector(uint32_t sector) {
+    return esp_partition_erase_range(part, sector * FOTA_SECTOR_BYTES,
+                                     FOTA_SECTOR_BYTES) == ESP_OK;
+  }
+  bool write(uint32_t offset, const uint8_t* data, size_t len) {
+    return esp_partition_write(part, offset, data, len) == ESP_OK;
+  }
+};
+
+// Release signature over an image's size, hash, version, hardware target and
+// release sequence.
+bool statementSigned(uint32_t imageSize, const uint8_t sha256[32], const char* version,
+                     const char* hwTarget, uint32_t releaseSequence,
+                     const uint8_t signature[64]) {
+  uint8_t statement[FOTA_STATEMENT_BYTES];
+  fotaOfferStatement(statement, imageSize, sha256, version, hwTarget, releaseSequence);
+  return manifestVerifySignature(statement, sizeof(statement), signature, kReleasePubKey);
+}
+
+void persist() {
+  if (!fota_state_store::save(g_state)) {
+    Serial.println("[FOTA] state persist FAILED");
+  }
+  g_storedSincePersist = 0;
+  g_dirty = false;
+}
+
+void fail(FwReason reason) {
+  g_state.phase = (uint8_t)FotaRxPhase::Failed;
+  g_state.lastReason = reason;
+  g_state.resultPending = 1;
+  g_acceptImageId = 0;
+  persist();
+  Serial.printf("[FOTA] image %08lX failed: %s\n",
+                (unsigned long)g_state.imageId, fwReasonStr(reason));
+}
+
+void armIfComplete(const esp_partition_t* slot) {
+  if (!fotaRxComplete(g_state)) return;
+  g_acceptImageId = 0;
+  persist();  // a power cut during the hash pass must not lose the bitmap
+  // The persisted state is the only record of what was offered; re-check it
+  // against the release key before the slot becomes the boot partition.
+  if (!statementSigned(g_state.imageSize, g_state.sha256, g_state.version, g_hwTarget,
+                       g_state.releaseSequence, g_state.signature)) {
+    fail(FW_SIGNATURE_INVALID);
+    return;
+  }
+  const uint32_t startMs = millis();
+  const FwReason r = otaInstallFromPartition(slot, g_state.imageSize, g_state.sha256);
+  if (r != FW_NONE) {
+    fail(r);
+    return;
+  }
+  g_state.phase = (uint8_t)FotaRxPhase::Armed;
+  g_state.lastReason = FW_NONE;
+  g_state.resultPending = 1;
+  persist();
+  Serial.printf("[FOTA] image %08lX v%s verified in %lums and armed for next boot\n",
+                (unsigned long)g_state.imageId, g_state.version,
+                (unsigned long)(millis() - startMs));
+}
+
+}  // namespace
+
+namespace fleet_ota_node {
+
+void begin(const char* nodeId, const char* runningVersion, const char* hwTarget,
+           TaskHandle_t waiter) {
+  strncpy(g_nodeId, nodeId ? nodeId : "", sizeof(g_nodeId) - 1);
+  strncpy(g_runningVersion, runningVersion ? runningVersion : "", sizeof(g_runningVersion) - 1);
+  strncpy(g_hwTarget, hwTarget ? hwTarget : "", sizeof(g_hwTarget) - 1);
+  g_waiter = waiter;
+  if (!g_chunks) g_chunks = xQueueCreate(kChunkQueueDepth, sizeof(fota_chunk_message_t));
+  if (!g_chunks) Serial.println("[FOTA] chunk queue allocation failed");
+
+  fota_state_store::load(g_state);
+  g_installedSequence = fota_state_store::loadInstalledSequence();
+  if (g_state.phase == (uint8_t)FotaRxPhase::Armed) {
+    // Armed on an earlier wake, so this boot was the attempt to run it.
+    if (strncmp(g_state.version, g_runningVersion, sizeof(g_state.version)) == 0) {
+      g_state.phase = (uint8_t)FotaRxPhase::Installed;
+      g_state.lastReason = FW_NONE;
+      if (!fota_state_store::saveInstalledSequence(g_state.releaseSequence)) {
+        Serial.println("[FOTA] installed sequence persist FAILED");
+      }
+      if (g_state.releaseSequence > g_installedSequence) {
+        g_installedSequence = g_state.releaseSequence;
+      }
+      Serial.printf("[FOTA] now running fleet image v%s (release sequence %lu)\n",
+                    g_state.version, (unsigned long)g_state.releaseSequence);
+    } else {
+      g_state.phase = (uint8_t)FotaRxPhase::Failed;
+      g_state.lastReason = FW_ROLLED_BACK;
+      Serial.printf("[FOTA] armed image v%s did not stay booted; running v%s\n",
+                    g_state.version, g_runningVersion);
+    }
+    g_state.resultPending = 1;
+    persist();
+  }
+  if (g_state.phase == (uint8_t)FotaRxPhase::Receiving) {
+    g_acceptImageId = g_state.imageId;
+    Serial.printf("[FOTA] resuming image %08lX: %u/%u chunks\n",
+                  (unsigned long)g_state.imageId, (unsigned)g_state.chunksHave,
+                  (unsigned)g_state.chunkCount);
+  }
+}
+
+bool enqueueChunk(const uint8_t* data, size_t len) {
+  if (!g_chunks || !data || len != sizeof(fota_chunk_message_t)) return false;
+  const fota_chunk_message_t* c = reinterpret_cast<const fota_chunk_message_t*>(data);
+  if (g_acceptImageId == 0 || c->imageId != g_acceptImageId) return false;
+  if (xQueueSendToBack(g_chunks, data, 0) != pdTRUE) return false;
+  if (g_waiter) xTaskNotifyGive(g_waiter);
+  return true;
+}
+
+bool onOffer(const fota_offer_message_t& offer, fota_need_message_t& need) {
+  const esp_partition_t* slot = esp_ota_get_next_update_partition(nullptr);
+  const uint32_t slotBytes = slot ? slot->size : 0;
+  const FotaOfferVerdict v =
+      fotaRxConsiderOffer(g_state, offer, g_runningVersion, g_hwTarget, slotBytes,
+                          g_installedSequence);
+  if (v == FotaOfferVerdict::Decline || v == FotaOfferVerdict::Hold) return false;
+
+  if (v == FotaOfferVerdict::Start) {
+    if (!statementSigned(offer.imageSize, offer.sha256, offer.version, offer.hwTarget,
+                         offer.releaseSequence, offer.signature)) {
+      Serial.printf("[FOTA] offer %08lX v%s rejected: %s\n",
+                    (unsigned long)offer.imageId, offer.version,
+                    fwReasonStr(FW_SIGNATURE_INVALID));
+      return false;
+    }
+    fotaRxStart(g_state, offer);
+    persist();
+    Serial.printf("[FOTA] collecting image %08lX v%s seq %lu (%lu bytes, %u chunks)\n",
+                  (unsigned long)offer.imageId, offer.version,
+                  (unsigned long)offer.releaseSequence,
+                  (unsigned long)offer.imageSize, (unsigned)offer.chunkCount);
+  }
+  g_acceptImageId = g_state.imageId;
+
+  memset(&need, 0, sizeof(need));
+  strcpy(need.command, "OTA_NEED");
+  strncpy(need.nodeId, g_nodeId, sizeof(need.nodeId) - 1);
+  need.sessionId = offer.sessionId;
+  need.imageId = g_state.imageId;
+  need.chunksHave = g_state.chunksHave;
+  need.rangeCount =
+      (uint8_t)fotaRxMissingRanges(g_state, need.ranges, FOTA_NEED_MAX_RANGES);
+  return need.rangeCount > 0;
+}
+
+uint16_t serviceChunks(uint16_t maxChunks) {
+  if (!g_chunks || g_state.phase != (uint8_t)FotaRxPhase::Receiving) return 0;
+  const esp_partition_t* slot = esp_ota_get_next_update_partition(nullptr);
+  if (!slot) return 0;
+  SlotSink sink{slot};
+
+  uint16_t stored = 0;
+  fota_chunk_message_t chunk;
+  while (stored < maxChunks && xQueueReceive(g_chunks, &chunk, 0) == pdTRUE) {
+    const FotaChunkResult r = fotaRxAcceptChunk(g_state, chunk, sink);
+    if (r == FotaChunkResult::FlashError) {
+      fail(FW_FLASH_WRITE_FAILED);
+      xQueueReset(g_chunks);
+      return stored;
+    }
+    if (r != FotaChunkResult::Stored) continue;
+    ++stored;
+    g_dirty = true;
+    if (++g_storedSincePersist >= kPersistEveryChunks) persist();
+  }
+  armIfComplete(slot);
+  return stored;
+}
+
+void endSession() {
+  while (g_chunks && uxQueueMessagesWaiting(g_chunks) > 0 &&
+         g_state.phase == (uint8_t)FotaRxPhase::Receiving) {
+    serviceChunks(kChunkQueueDepth);
+  }
+  g_acceptImageId = 0;
+  if (g_chunks) xQueueReset(g_chunks);
+  if (g_dirty) {
+    persist();
+    Serial.printf("[FOTA] image %08lX progress %u/%u chunks\n",
+                  (unsigned long)g_state.imageId, (unsigned)g_state.chunksHave,
+                  (unsigned)g_state.chunkCount);
+  }
+}
+
+bool pendingResult(fota_result_message_t& out) {
+  if (!g_state.resultPending) return false;
+  memset(&out, 0, sizeof(out));
+  strcpy(out.command, "OTA_RESULT");
+  strncpy(out.nodeId, g_nodeId, sizeof(out.nodeId) - 1);
+  out.imageId = g_state.imageId;
+  switch ((FotaRxPhase)g_state.phase) {
+    case FotaRxPhase::Armed:     out.status = FOTA_RESULT_ARMED; break;
+    case FotaRxPhase::Installed: out.status = FOTA_RESULT_INSTALLED; break;
+    default:                     out.status = FOTA_RESULT_FAILED; break;
+  }
+  out.reason = g_state.lastReason;
+  out.chunksHave = g_state.chunksHave;
+  return true;
+}
+
+void resultDelivered() {
+  if (!g_state.resultPending) return;
+  g_state.resultPending = 0;
+  persist();
+}
+
+}  // namespace fleet_ota_node
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include "fleet_ota.h"
+
+// Node side of fleet firmware distribution (fleet_ota.h).
+//
+// OTA_CHUNK frames arrive in bursts of hundreds per session, far more than the
+// node event queue is sized for, so they bypass it: the receive callback copies
+// each one into a dedicated chunk queue and wakes the main task, which writes
+// them to the inactive OTA slot in serviceChunks(). OTA_OFFER goes through the
+// normal event queue; the session loop hands it to onOffer() and sends back the
+// NEED it builds. This module never touches the radio itself.
+//
+// Progress (the chunk bitmap) is persisted to NVS every kPersistEveryChunks
+// stored chunks and at endSession(), so a power cut costs at most those chunks.
+// A new image is collected only when the offer's release signature verifies
+// and its release sequence is not older than the installed one; the signature
+// is checked again before arming. Once every chunk is in,
+// the slot is hashed, checked against the offer's SHA-256 and armed; the node
+// boots it on its next wake under deferred verify.
+
+namespace fleet_ota_node {
+
+constexpr uint8_t  kChunkQueueDepth    = 24;
+constexpr uint16_t kPersistEveryChunks = 64;
+
+// Load persisted progress and settle an image armed on a previous wake:
+// running `runningVersion` means it installed, anything else means the
+// bootloader rolled it back. Call once after NVS is up. `waiter` is woken
+// (xTaskNotifyGive) whenever a chunk is queued.
+void begin(const char* nodeId, const char* runningVersion, const char* hwTarget,
+           TaskHandle_t waiter);
+
+// Receive callback (Wi-Fi task): queue one already-classified OTA_CHUNK.
+// Chunks for an image this node is not collecting are dropped here.
+bool enqueueChunk(const uint8_t* data, size_t len);
+
+// Main task. Decide on an OTA_OFFER; true when `need` should be sent to the
+// mothership (a new release-signed image, or a partly received one, for this
+// hardware).
+bool onOffer(const fota_offer_message_t& offer, fota_need_message_t& need);
+
+// Main task. Write up to `maxChunks` queued chunks to the inactive slot and
+// arm the image once complete. Returns the number stored.
+uint16_t serviceChunks(uint16_t maxChunks);
+
+// Drain remaining chunks and persist progress. Call before the radio goes down.
+void endSession();
+
+// OTA_RESULT still owed to the mothership (armed / installed / failed).
+bool pendingResult(fota_result_message_t& out);
+void resultDelivered();
+
+}  // namespace fleet_ota_node
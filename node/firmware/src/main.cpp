@@ -17,10 +17,17 @@
 #include "sensors/soil_moist_temp.h"
 #include "storage/local_queue.h"
 #include "storage/node_config_store.h"
+#include "storage/agg_state_store.h"
+#include "storage/rbe_state_store.h"
 #include "message_dispatch.h"
 #include "node_event_queue.h"
+#include "espnow_tx.h"
+#include "fleet_ota_node.h"
+#include "ota_installer.h"  // deferred-verify confirm/reject of a new image
 
 #include "protocol.h"     // pins, ESPNOW_CHANNEL, protocol structs
+#include "clock_sync.h"   // CLOCK_PROBE offset/drift arithmetic
+#include "urgent_listen.h"  // urgent thresholds, boundary-aligned data wakes
 #include "firmware_identity.h"  // role/version/build/hw identity (FW_GIT injected)
 
 // Prefer the injected git build id over __DATE__/__TIME__, which freeze across
@@ -48,6 +55,11 @@ static char gNodeId[16] = NODE_ID;
 #undef NODE_ID
 #define NODE_ID gNodeId
 
+// Keep a freshly installed image on probation: the Arduino core must not
+// auto-confirm it. setup() confirms once NVS and the local queue come up; a
+// crash or reset before that makes the bootloader revert to the previous slot.
+extern "C" bool verifyRollbackLater() { return true; }
+
 static void initNodeIdentity() {
 #if NODE_ID_AUTO_FROM_MAC
   uint8_t mac[6] = {0};
@@ -138,6 +150,16 @@ RTC_DS3231 rtc;
 #define NODE_SYNC_HELLO_JITTER_MS 1800UL
 #endif
 
+// Two-way clock exchange after NODE_HELLO: probes per session and how long to
+// wait for each CLOCK_REPLY before sending the next.
+#ifndef NODE_CLOCK_PROBES
+#define NODE_CLOCK_PROBES 3
+#endif
+
+#ifndef NODE_CLOCK_PROBE_TIMEOUT_MS
+#define NODE_CLOCK_PROBE_TIMEOUT_MS 400UL
+#endif
+
 #ifndef NODE_SNAPSHOT_RETRY_COUNT
 #define NODE_SNAPSHOT_RETRY_COUNT 3
 #endif
@@ -169,6 +191,10 @@ static void initWatchdog() {
   Serial.printf("[WDT] hardware watchdog armed (%ds)\n", NODE_WDT_TIMEOUT_S);
 }
 
+// Aggregation windows live in RTC memory, which the PWR_HOLD cut wipes between
+// wakes; on a power-gated board every fold is mirrored to NVS as well.
+static constexpr bool kAggMirrorToNvs = ENABLE_POWER_HOLD_CONTROL && (PWR_HOLD_PIN >= 0);
+
 #if ENABLE_POWER_HOLD_CONTROL && (PWR_HOLD_PIN >= 0)
 static const uint8_t kPwrHoldOnLevel  = PWR_HOLD_ACTIVE_HIGH ? HIGH : LOW;
 static const uint8_t kPwrHoldOffLevel = PWR_HOLD_ACTIVE_HIGH ? LOW  : HIGH;
@@ -567,13 +593,21 @@ static bool ds3231EveryMinute() {
 }
 
 // Compute next trigger as now + interval minutes (relative scheduling), program A1.
+// alignToBoundary instead lands it on the next whole multiple of the interval
+// (unix time), where the FieldHub's listen windows are: urgent mode.
 static bool ds3231ArmNextInNMinutes(uint8_t intervalMin,
                                     DateTime* nextOut = nullptr,
-                                    AlarmBytes* bytesOut = nullptr) {
+                                    AlarmBytes* bytesOut = nullptr,
+                                    bool alignToBoundary = false) {
   if (intervalMin == 0) intervalMin = 1;
 
   DateTime now = rtc.now();
   DateTime next = now + TimeSpan(0, 0, intervalMin, 0);
+  if (alignToBoundary) {
+    // A wake that fired a little early must not re-arm for the boundary it
+    // was meant for.
+    next = DateTime(urgent_listen::nextBoundary(now.unixtime() + 30UL, intervalMin));
+  }
 
   const uint8_t secBCD  = uint8_t(((next.second()/10)<<4) | (next.second()%10)); // A1M1=0
   const uint8_t minBCD  = uint8_t(((next.minute()/10)<<4) | (next.minute()%10)); // A1M2=0
@@ -581,7 +615,8 @@ static bool ds3231ArmNextInNMinutes(uint8_t intervalMin,
   const uint8_t dayReg  = 0b10000000; // A1M4=1 ignore day/date
 
   char buf[24]; formatTime(next, buf, sizeof(buf));
-  Serial.printf("[A1] Next alarm in %u min at %s\n", intervalMin, buf);
+  Serial.printf("[A1] Next alarm in %u min at %s%s\n", intervalMin, buf,
+                alignToBoundary ? " (boundary-aligned)" : "");
 
   if (nextOut) *nextOut = next;
   if (bytesOut) {
@@ -715,6 +750,15 @@ uint16_t  g_appliedConfigVersion = 0;
 // Last FieldHub deployment epoch applied by this physical node. Stored
 // separately from the A/B config record so firmware upgrades preserve it.
 uint16_t  g_deploymentEpoch = 0;
+// Aggregation mode from NODE_CONFIG (standalone NVS keys). samplesPerReport < 2
+// means every data wake queues its own snapshot, as before.
+NodeAggConfig g_aggConfig = {};
+// Report-by-exception from NODE_CONFIG (standalone NVS keys). maxSilenceMin 0
+// means every plain snapshot carries every channel, as before.
+NodeRbeConfig g_rbeConfig = {};
+// Urgent thresholds from NODE_CONFIG (standalone NVS keys). flags 0 means no
+// urgent frames and relative data wakes, as before.
+NodeUrgentConfig g_urgentConfig = {};
 // Standby: node stays DEPLOYED and keeps its sync (A2) check-ins, but does not
 // arm the recording alarm (A1) or take samples. Persisted so it survives the
 // power-cycle that happens at every wake. Cleared on resume/unpair.
@@ -746,13 +790,6 @@ static bool g_postUnpairHold = false;
 
 static bool g_espNowReady = false;
 static volatile uint32_t g_syncWindowMarkerMs = 0;
-static volatile bool g_lastSendDone = false;
-static volatile esp_now_send_status_t g_lastSendStatus = ESP_NOW_SEND_FAIL;
-static volatile bool g_sendActive = false;
-static volatile bool g_sendCallbackReceived = false;
-static volatile esp_now_send_status_t g_sendDeliveryStatus = ESP_NOW_SEND_FAIL;
-static volatile uint32_t g_sendGeneration = 0;
-static uint8_t g_sendExpectedMac[6] = {0};
 static bool g_waitingSnapshotAck = false;
 static uint32_t g_expectedSnapshotAckSeq = 0;
 static bool g_snapshotAckMatched = false;
@@ -785,6 +822,10 @@ static uint8_t g_pendingConfigSnapshotMac[6];
 static volatile bool g_pendingNodeConfig = false;
 static node_config_message_t g_pendingNodeConfigData;
 static uint8_t g_pendingNodeConfigMac[6];
+// CONFIG_DIGEST is reduced to this in the receive callback: the version the
+// mothership advertises for us, when it is newer than the applied one.
+static volatile bool g_configPullPending = false;
+static volatile uint16_t g_digestWantedVersion = 0;
 static volatile bool g_pendingPersistConfig = false;
 static volatile bool g_syncSessionOpenPending = false;
 static sync_session_open_message_t g_syncSessionOpenData;
@@ -792,18 +833,11 @@ static volatile bool g_dumpGrantPending = false;
 static dump_grant_message_t g_dumpGrantData;
 static volatile bool g_syncReleasePending = false;
 static sync_release_message_t g_syncReleaseData;
-
-static bool waitForSendDelivery(uint32_t timeoutMs) {
-  const uint32_t start = millis();
-  while ((millis() - start) < timeoutMs) {
-    serviceNodeEvents(4);
-    if (g_lastSendDone) {
-      return g_lastSendStatus == ESP_NOW_SEND_SUCCESS;
-    }
-    delay(1);
-  }
-  return false;
-}
+static volatile bool g_otaOfferPending = false;
+static fota_offer_message_t g_otaOfferData;
+static volatile bool g_clockReplyPending = false;
+static clock_reply_message_t g_clockReplyData;
+static uint32_t g_clockReplyRxMs = 0;   // millis() in the receive callback (t4)
 
 struct SendResult {
   esp_err_t queueResult = ESP_FAIL;
@@ -811,78 +845,98 @@ struct SendResult {
   esp_now_send_status_t deliveryStatus = ESP_NOW_SEND_FAIL;
 };
 
-static bool isBroadcastMac(const uint8_t* mac) {
-  if (!mac) return false;
-  for (int i = 0; i < 6; ++i) {
-    if (mac[i] != 0xFF) return false;
-  }
-  return true;
-}
+// Longest single block in an event wait. Loops that also watch the RTC, feed
+// the watchdog or run a timer of their own come back at least this often even
+// when no radio event arrives.
+#ifndef NODE_EVENT_WAIT_SLICE_MS
+#define NODE_EVENT_WAIT_SLICE_MS 100UL
+#endif
 
-static SendResult sendEspNowAndWait(const uint8_t* destination,
-                                    const void* payload,
-                                    size_t payloadLength,
-                                    uint32_t timeoutMs) {
-  SendResult result{};
-  if (!destination || !payload || payloadLength == 0) {
-    result.queueResult = ESP_ERR_INVALID_ARG;
-    return result;
-  }
+// Block the main task until a send completes or an inbound event is queued
+// (both give its task notification), at most `timeoutMs`. Replaces the
+// delay() polling loops: the CPU idles instead of spinning while the radio
+// works.
+static void waitForNodeActivity(uint32_t timeoutMs) {
+  if (timeoutMs > NODE_EVENT_WAIT_SLICE_MS) timeoutMs = NODE_EVENT_WAIT_SLICE_MS;
+  espnow_tx::waitForActivity(timeoutMs);
+}
 
-  const uint32_t busyStart = millis();
-  while (g_sendActive && (uint32_t)(millis() - busyStart) < timeoutMs) {
+static esp_err_t espnowSendWithRecover(const uint8_t* mac, const void* payload, size_t len,
+                                       uint32_t timeoutMs, uint32_t& ticket);
+
+// Queue one frame and return without waiting for its send callback. Blocks
+// (event-driven) only while kTxMaxInFlight frames are already outstanding.
+static esp_err_t submitEspNow(const uint8_t* destination, const void* payload,
+                              size_t payloadLength, uint32_t timeoutMs,
+                              uint32_t& ticket) {
+  ticket = 0;
+  if (!destination || !payload || payloadLength == 0) return ESP_ERR_INVALID_ARG;
+  const uint32_t deadline = millis() + timeoutMs;
+  while (espnow_tx::inFlight() >= kTxMaxInFlight) {
+    const int32_t left = (int32_t)(deadline - millis());
+    if (left <= 0) return ESP_ERR_INVALID_STATE;
     serviceNodeEvents(4);
-    delay(1);
-  }
-  if (g_sendActive) {
-    result.queueResult = ESP_ERR_INVALID_STATE;
-    return result;
+    waitForNodeActivity((uint32_t)left);
   }
+  return espnowSendWithRecover(destination, payload, payloadLength, timeoutMs, ticket);
+}
 
-  if (!bringupEspNow()) {
-    result.queueResult = ESP_ERR_ESPNOW_NOT_INIT;
-    return result;
-  }
-  if (!ensureEspNowPeer(destination)) {
-    result.queueResult = ESP_ERR_ESPNOW_NOT_FOUND;
-    return result;
+// Wait for a submitted frame's send callback, servicing inbound events while
+// blocked. `queued` is submitEspNow()'s result, so a refused frame falls
+// straight through.
+static SendResult awaitEspNowSend(uint32_t ticket, esp_err_t queued, uint32_t deadlineMs) {
+  SendResult result{};
+  result.queueResult = queued;
+  if (queued != ESP_OK) return result;
+  TxCompletion done{};
+  for (;;) {
+    if (espnow_tx::poll(ticket, done)) {
+      result.callbackReceived = done.outcome != TxOutcome::Lost;
+      result.deliveryStatus = done.outcome == TxOutcome::Acked ? ESP_NOW_SEND_SUCCESS
+                                                               : ESP_NOW_SEND_FAIL;
+      return result;
+    }
+    const int32_t left = (int32_t)(deadlineMs - millis());
+    if (left <= 0) return result;
+    serviceNodeEvents(4);
+    waitForNodeActivity((uint32_t)left);
   }
+}
 
-  memcpy(g_sendExpectedMac, destination, sizeof(g_sendExpectedMac));
-  g_sendCallbackReceived = false;
-  g_sendDeliveryStatus = ESP_NOW_SEND_FAIL;
-  g_lastSendDone = false;
-  g_lastSendStatus = ESP_NOW_SEND_FAIL;
-  ++g_sendGeneration;
-  g_sendActive = true;
+static SendResult sendEspNowAndWait(const uint8_t* destination,
+                                    const void* payload,
+                                    size_t payloadLength,
+                                    uint32_t timeoutMs) {
+  uint32_t ticket = 0;
+  const esp_err_t queued = submitEspNow(destination, payload, payloadLength, timeoutMs, ticket);
+  return awaitEspNowSend(ticket, queued, millis() + timeoutMs);
+}
 
-  esp_wifi_set_channel(ESPNOW_CHANNEL, WIFI_SECOND_CHAN_NONE);
-  result.queueResult = esp_now_send(destination,
-                                    reinterpret_cast<const uint8_t*>(payload),
-                                    payloadLength);
-  if (result.queueResult != ESP_OK) {
-    g_sendActive = false;
-    ++g_sendGeneration;
-    return result;
-  }
+// One payload to two destinations (direct + broadcast). The second frame is
+// queued behind the first instead of waiting out its MAC ACK, then both are
+// awaited. `second` may be null.
+static void sendEspNowPairAndWait(const uint8_t* first, const uint8_t* second,
+                                  const void* payload, size_t payloadLength,
+                                  uint32_t timeoutMs,
+                                  SendResult& firstOut, SendResult& secondOut) {
+  uint32_t firstTicket = 0;
+  uint32_t secondTicket = 0;
+  const uint32_t deadline = millis() + timeoutMs;
+  const esp_err_t firstQueued =
+      submitEspNow(first, payload, payloadLength, timeoutMs, firstTicket);
+  const esp_err_t secondQueued = second
+      ? submitEspNow(second, payload, payloadLength, timeoutMs, secondTicket)
+      : ESP_ERR_INVALID_ARG;
+  firstOut = awaitEspNowSend(firstTicket, firstQueued, deadline);
+  secondOut = awaitEspNowSend(secondTicket, secondQueued, deadline);
+}
 
-  const uint32_t start = millis();
-  while ((uint32_t)(millis() - start) < timeoutMs) {
-    serviceNodeEvents(4);
-    if (g_sendCallbackReceived) {
-      result.callbackReceived = true;
-      result.deliveryStatus = g_sendDeliveryStatus;
-      g_sendActive = false;
-      return result;
-    }
-    delay(1);
+static bool isBroadcastMac(const uint8_t* mac) {
+  if (!mac) return false;
+  for (int i = 0; i < 6; ++i) {
+    if (mac[i] != 0xFF) return false;
   }
-
-  g_sendActive = false;
-  ++g_sendGeneration;
-  result.callbackReceived = false;
-  result.deliveryStatus = ESP_NOW_SEND_FAIL;
-  return result;
+  return true;
 }
 
 // --- Derived state helpers ---
@@ -1039,7 +1093,8 @@ static bool bringupEspNow();
 static bool ensureEspNowPeer(const uint8_t* mac);
 static void shutdownEspNow();
 static bool shouldSyncAt(uint32_t unixNow);
-static void captureSensorsToQueue();
+static void captureSensorsToQueue(bool bypassAggregation = false);
+static void flushAggregateWindow(const char* reason);
 struct QueueFlushResult {
   uint8_t sentRecords = 0;
   uint8_t status = 0;  // 0=quota/empty, 1=send/ACK failure, 2=deadline
@@ -1053,26 +1108,28 @@ static bool armDeploymentWakeAlarms(DateTime* nextDataOut = nullptr, DateTime* n
 static void finalizeWakeAndSleep(const char* reason);
 
 // Guard against stale g_espNowReady state by retrying once after a forced re-init.
-static esp_err_t espnowSendWithRecover(const uint8_t* mac, const uint8_t* payload, size_t len) {
+static esp_err_t espnowSendWithRecover(const uint8_t* mac, const void* payload, size_t len,
+                                       uint32_t timeoutMs, uint32_t& ticket) {
   if (!bringupEspNow()) return ESP_ERR_ESPNOW_NOT_INIT;
 
   if (!ensureEspNowPeer(mac)) return ESP_ERR_ESPNOW_NOT_FOUND;
 
   esp_wifi_set_channel(ESPNOW_CHANNEL, WIFI_SECOND_CHAN_NONE);
-  esp_err_t res = esp_now_send(mac, payload, len);
+  esp_err_t res = espnow_tx::submit(mac, payload, len, timeoutMs, ticket);
   if (res != ESP_ERR_ESPNOW_NOT_INIT && res != ESP_ERR_ESPNOW_IF) return res;
 
   Serial.printf("⚠️ ESP-NOW send error (%s); forcing re-init and retrying once\n",
                 esp_err_to_name(res));
   g_espNowReady = false;
   esp_now_deinit();
+  espnow_tx::reset();
   WiFi.mode(WIFI_OFF);
   delay(40);
 
   if (!bringupEspNow()) return ESP_ERR_ESPNOW_NOT_INIT;
   if (!ensureEspNowPeer(mac)) return ESP_ERR_ESPNOW_NOT_FOUND;
   esp_wifi_set_channel(ESPNOW_CHANNEL, WIFI_SECOND_CHAN_NONE);
-  return esp_now_send(mac, payload, len);
+  return espnow_tx::submit(mac, payload, len, timeoutMs, ticket);
 }
 
 static bool ensureEspNowPeer(const uint8_t* mac) {
@@ -1084,8 +1141,9 @@ static bool ensureEspNowPeer(const uint8_t* mac) {
   pi.ifidx   = WIFI_IF_STA;
   pi.encrypt = false;
 
-  esp_now_del_peer(mac);
-  esp_err_t r = esp_now_add_peer(&pi);
+  // Modify rather than delete/re-add an existing peer: a frame to it may still
+  // be in flight behind a pipelined send.
+  esp_err_t r = esp_now_is_peer_exist(mac) ? esp_now_mod_peer(&pi) : esp_now_add_peer(&pi);
   if (r != ESP_OK && r != ESP_ERR_ESPNOW_EXIST) {
     Serial.printf("⚠️ add peer failed for %02X:%02X:%02X:%02X:%02X:%02X: %s\n",
                   mac[0], mac[1], mac[2], mac[3], mac[4], mac[5],
@@ -1150,11 +1208,12 @@ static bool bringupEspNow() {
 
 static void shutdownEspNow() {
   if (!g_espNowReady) return;
-  if (g_sendActive) {
+  if (espnow_tx::inFlight() > 0) {
     Serial.println("[ESP-NOW] shutdown deferred: send active");
     return;
   }
   esp_now_deinit();
+  espnow_tx::reset();
   WiFi.mode(WIFI_OFF);
   g_espNowReady = false;
   Serial.println("📴 WiFi/ESP-NOW off");
@@ -1201,11 +1260,216 @@ static uint32_t nextSyncSlotUnix(uint32_t nowUnix) {
   return phase + slot * periodSec;
 }
 
+// Assemble a V2 header around `readings` and enqueue it. Logs the record via
+// Serial for verification.
+static bool enqueueSnapshotV2(uint32_t nodeTimestamp, uint16_t qualityFlags,
+                              const v2_reading_t* readings, size_t count) {
+  node_snapshot_v2_t snap2{};
+  strncpy(snap2.command, "NODE_SNAPSHOT2", sizeof(snap2.command) - 1);
+  strncpy(snap2.nodeId,  NODE_ID,         sizeof(snap2.nodeId)  - 1);
+  snap2.nodeTimestamp   = nodeTimestamp;
+  snap2.seqNum          = local_queue::nextSeq();
+  snap2.sensorCount     = (uint16_t)count;
+  snap2.qualityFlags    = qualityFlags;
+  snap2.configVersion   = 0; // filled by flush from NVS in Phase 2c
+  snap2.protocolVersion = NODE_PROTOCOL_VERSION;
+  snap2.flags           = 0;
+
+  // Log V2 data for verification.
+  Serial.printf("🧾 V2 snapshot seq=%lu sensorCount=%u (header=%uB + body=%uB = %uB)\n",
+                (unsigned long)snap2.seqNum,
+                (unsigned)count,
+                (unsigned)sizeof(node_snapshot_v2_t),
+                (unsigned)(count * sizeof(v2_reading_t)),
+                (unsigned)(sizeof(node_snapshot_v2_t) + count * sizeof(v2_reading_t)));
+  for (size_t i = 0; i < count; ++i) {
+    Serial.printf("   [%02u] id=%-5u value=%.4f\n",
+                  (unsigned)i,
+                  (unsigned)readings[i].sensorId,
+                  readings[i].value);
+  }
+
+  // Enqueue the V2 snapshot into the local queue (Phase 2c).
+  if (local_queue::enqueueV2(snap2, readings, count)) {
+    Serial.printf("🧾 V2 snapshot enqueued (seq=%lu sensorCount=%u)\n",
+                  (unsigned long)snap2.seqNum, (unsigned)count);
+    return true;
+  }
+  Serial.println("❌ V2 snapshot enqueue failed");
+  return false;
+}
+
+// How a channel is summarised in aggregation mode (see snapshot_aggregator.h).
+// Only channels in a SNAP_PRESENT_* group selected by the stats mask (0 = all)
+// carry min/max/SD; housekeeping and unmapped channels are averaged.
+static AggKind aggKindForSensorId(uint16_t sensorId) {
+  switch (sensorId) {
+    case SENSOR_ID_WIND_DIR:       return AggKind::Circular;
+    case SENSOR_ID_WIND_GUST:
+    case SENSOR_ID_SPECTRAL_SAT:   return AggKind::Peak;
+    case SENSOR_ID_SPECTRAL_GAIN:
+    case SENSOR_ID_SPECTRAL_ATIME:
+    case SENSOR_ID_WIND_SPEED_SD:
+    case SENSOR_ID_WIND_CALM_FRAC: return AggKind::MeanOnly;
+    default: break;
+  }
+  const uint16_t bit = snapPresentBitForSensorId(sensorId);
+  if (bit == 0) return AggKind::MeanOnly;
+  if (g_aggConfig.statsMask != 0 && !(g_aggConfig.statsMask & bit)) return AggKind::MeanOnly;
+  return AggKind::Linear;
+}
+
+static uint16_t aggStatSensorId(uint16_t baseId, AggStat stat) {
+  return aggregateSensorId(baseId, (uint8_t)stat);
+}
+
+// Queue the summary of a (complete or partial) aggregation window, stamped at
+// its last sample.
+static bool enqueueAggregateSummary(const AggState& st) {
+  v2_reading_t summary[MAX_READINGS_PER_SNAPSHOT];
+  size_t statsDropped = 0;
+  const size_t n = aggEmit(st, summary, MAX_READINGS_PER_SNAPSHOT,
+                           SENSOR_ID_AGG_SAMPLES, aggStatSensorId, &statsDropped);
+  Serial.printf("📊 [AGG] summary of %u/%u wakes (%lu..%lu), %u channels -> %u readings\n",
+                (unsigned)st.samples, (unsigned)st.samplesPerReport,
+                (unsigned long)st.windowStartUnix, (unsigned long)st.lastSampleUnix,
+                (unsigned)st.channelCount, (unsigned)n);
+  if (statsDropped) {
+    Serial.printf("📊 [AGG] min/max/SD of %u channel(s) did not fit the snapshot\n",
+                  (unsigned)statsDropped);
+  }
+  const uint16_t qf = SNAP_QF_AGGREGATED | (statsDropped ? SNAP_QF_AGG_STATS_PARTIAL : 0);
+  return enqueueSnapshotV2(st.lastSampleUnix, qf, summary, n);
+}
+
+// Close any open window early (aggregation reconfigured or turned off) so
+// samples already taken are reported rather than lost.
+static void flushAggregateWindow(const char* reason) {
+  AggState st;
+  if (agg_state_store::load(st, 0) && st.samples > 0) {
+    Serial.printf("📊 [AGG] flushing partial window (%s)\n", reason);
+    enqueueAggregateSummary(st);
+  }
+  agg_state_store::clear();
+  rbe_state_store::clear();
+}
+
+// Report-by-exception deadband per channel, in the channel's own units, scaled
+// by the configured deadbandTenths. Chosen for the slow channels that dominate
+// a stable deployment (resolution-ish, well above read noise). Negative means
+// "always send": spectral counts and wind move every wake anyway, and an
+// unknown channel is never silently held back. Spectral gain/integration are
+// settings, sent on any change.
+static float rbeDeadbandForSensorId(uint16_t sensorId) {
+  float base;
+  switch (sensorId) {
+    case SENSOR_ID_AIR_TEMP:       base = 0.2f;  break;  // °C
+    case SENSOR_ID_AIR_RH:         base = 1.0f;  break;  // % RH
+    case SENSOR_ID_SOIL1_VWC:
+    case SENSOR_ID_SOIL2_VWC:      base = 0.01f; break;  // sensor volts
+    case SENSOR_ID_SOIL1_TEMP:
+    case SENSOR_ID_SOIL2_TEMP:     base = 0.2f;  break;  // °C
+    case SENSOR_ID_BAT_V:          base = 0.05f; break;  // V
+    case SENSOR_ID_SPECTRAL_GAIN:
+    case SENSOR_ID_SPECTRAL_ATIME: return 0.0f;
+    default:                       return -1.0f;
+  }
+  const uint8_t tenths = g_rbeConfig.deadbandTenths ? g_rbeConfig.deadbandTenths : 10;
+  return base * (float)tenths / 10.0f;
+}
+
+// Plain per-wake snapshot under report-by-exception: send only the channels
+// that left their deadband, nothing at all when none did, and everything at
+// least every maxSilenceMin. The reference set is committed only once the
+// record is safely queued — a failed enqueue, or one that pushed older records
+// out of the queue, leaves the FieldHub without values the reference assumes
+// it has, so the set is dropped and the next wake goes out in full.
+static void enqueueReportByException(uint32_t nowUnix, v2_reading_t* readings,
+                                     size_t count, bool forceFull) {
+  RbeState st;
+  if (forceFull) rbeReset(st);
+  else rbe_state_store::load(st);
+  const size_t captured = count;
+  const RbeDecision d = rbeFilter(st, nowUnix, readings, count, MAX_READINGS_PER_SNAPSHOT,
+                                  rbeDeadbandForSensorId,
+                                  (uint32_t)g_rbeConfig.maxSilenceMin * 60u);
+  if (d == RbeDecision::Suppress) {
+    Serial.printf("🔕 [RBE] all %u channels inside deadband — snapshot suppressed\n",
+                  (unsigned)captured);
+    return;
+  }
+  Serial.printf("📉 [RBE] %s: %u of %u channels sent\n",
+                d == RbeDecision::Full ? "full" : "delta",
+                (unsigned)count, (unsigned)captured);
+
+  const uint32_t droppedBefore = local_queue::stats().droppedDueToCapacity;
+  const bool queued = enqueueSnapshotV2(
+      nowUnix, d == RbeDecision::Delta ? SNAP_QF_CARRIED_FORWARD : 0, readings, count);
+  if (!queued || local_queue::stats().droppedDueToCapacity != droppedBefore) {
+    rbe_state_store::clear();
+    return;
+  }
+  if (!rbe_state_store::save(st, kAggMirrorToNvs)) {
+    Serial.println("⚠️ [RBE] reference persist FAILED — next wake sends in full");
+    rbe_state_store::clear();
+  }
+}
+
+// Low-latency listening: send this wake's full snapshot straight to the
+// FieldHub as an URGENT frame, outside the sync session. It carries the seq
+// and timestamp the queued copy will have, so the hub ACKs that copy without
+// a second row. True once the hub has persisted it; the FieldHub only listens
+// around its listen boundaries, so a miss is normal and retried next wake.
+static bool sendUrgentSnapshot(uint32_t nowUnix, uint32_t seqNum,
+                               const v2_reading_t* readings, size_t count) {
+  if (!hasMothershipMAC() || !bringupEspNow()) return false;
+
+  static uint8_t buf[sizeof(node_snapshot_v2_t) +
+                     MAX_READINGS_PER_SNAPSHOT * sizeof(v2_reading_t)];
+  node_snapshot_v2_t* snap2 = reinterpret_cast<node_snapshot_v2_t*>(buf);
+  memset(snap2, 0, sizeof(*snap2));
+  strncpy(snap2->command, "NODE_SNAPSHOT2", sizeof(snap2->command) - 1);
+  strncpy(snap2->nodeId,  NODE_ID,         sizeof(snap2->nodeId)  - 1);
+  snap2->nodeTimestamp   = nowUnix;
+  snap2->seqNum          = seqNum;
+  snap2->sensorCount     = (uint16_t)count;
+  snap2->configVersion   = (uint16_t)getNodeConfigVersion();
+  snap2->protocolVersion = NODE_PROTOCOL_VERSION;
+  snap2->flags           = SNAP2_FLAG_URGENT;
+  memcpy(buf + sizeof(node_snapshot_v2_t), readings, count * sizeof(v2_reading_t));
+  const size_t len = snapshotV2WireSize((uint16_t)count);
+
+  bool delivered = false;
+  for (uint8_t attempt = 1; attempt <= 2 && !delivered; ++attempt) {
+    g_snapshotAckMatched = false;
+    g_snapshotAckPersisted = false;
+    g_expectedSnapshotAckSeq = seqNum;
+    g_waitingSnapshotAck = true;
+    SendResult send = sendEspNowAndWait(mothershipMAC, buf, len, 350);
+    if (send.queueResult == ESP_OK && send.callbackReceived &&
+        send.deliveryStatus == ESP_NOW_SEND_SUCCESS) {
+      const uint32_t ackStart = millis();
+      while ((uint32_t)(millis() - ackStart) < NODE_SNAPSHOT_ACK_TIMEOUT_MS) {
+        feedWatchdog();
+        serviceNodeEvents(8);
+        if (g_snapshotAckMatched && g_snapshotAckPersisted) break;
+        waitForNodeActivity(NODE_SNAPSHOT_ACK_TIMEOUT_MS - (millis() - ackStart));
+      }
+      delivered = g_snapshotAckMatched && g_snapshotAckPersisted;
+    }
+    g_waitingSnapshotAck = false;
+  }
+  Serial.printf("🚨 [URGENT] seq=%lu %s\n", (unsigned long)seqNum,
+                delivered ? "persisted by FieldHub" : "not heard - retry next wake");
+  shutdownEspNow();
+  return delivered;
+}
+
 // V2 key-value snapshot capture.
-// Builds a node_snapshot_v2_t header + v2_reading_t[] array from the sensor
-// registry and battery ADC. Does NOT enqueue yet (local_queue::enqueueV2() is
-// Phase 2c). Logs the V2 data via Serial for verification.
-static void captureSensorsToQueue() {
+// Builds a v2_reading_t[] array from the sensor registry and battery ADC and
+// enqueues it as one snapshot — or, in aggregation mode, folds it into the
+// open window and enqueues only the summary once the window is complete.
+static void captureSensorsToQueue(bool bypassAggregation) {
   v2_reading_t readings[MAX_READINGS_PER_SNAPSHOT];
   size_t count = 0;
 
@@ -1237,39 +1501,65 @@ static void captureSensorsToQueue() {
                                              MAX_READINGS_PER_SNAPSHOT - count);
   count += sensorReadings;
 
-  // Assemble V2 header.
-  node_snapshot_v2_t snap2{};
-  strncpy(snap2.command, "NODE_SNAPSHOT2", sizeof(snap2.command) - 1);
-  strncpy(snap2.nodeId,  NODE_ID,         sizeof(snap2.nodeId)  - 1);
-  snap2.nodeTimestamp   = rtc.now().unixtime();
-  snap2.seqNum          = local_queue::nextSeq();
-  snap2.sensorCount     = (uint16_t)count;
-  snap2.qualityFlags    = 0;
-  snap2.configVersion   = 0; // filled by flush from NVS in Phase 2c
-  snap2.protocolVersion = NODE_PROTOCOL_VERSION;
-  snap2.reserved        = 0;
+  const uint32_t nowUnix = rtc.now().unixtime();
 
-  // Log V2 data for verification.
-  Serial.printf("🧾 V2 snapshot seq=%lu sensorCount=%u (header=%uB + body=%uB = %uB)\n",
-                (unsigned long)snap2.seqNum,
-                (unsigned)count,
-                (unsigned)sizeof(node_snapshot_v2_t),
-                (unsigned)(count * sizeof(v2_reading_t)),
-                (unsigned)(sizeof(node_snapshot_v2_t) + count * sizeof(v2_reading_t)));
-  for (size_t i = 0; i < count; ++i) {
-    Serial.printf("   [%02u] id=%-5u value=%.4f\n",
-                  (unsigned)i,
-                  (unsigned)readings[i].sensorId,
-                  readings[i].value);
+  // Urgent thresholds: a crossing not yet acknowledged goes out now, and this
+  // wake is queued in full and on its own (no deadband, no aggregation) under
+  // the seq the urgent frame carried.
+  bool urgentWake = false;
+  if (g_urgentConfig.flags != 0) {
+    float airC = NAN, soilV = NAN;
+    for (size_t i = 0; i < count; ++i) {
+      if (readings[i].sensorId == SENSOR_ID_AIR_TEMP) airC = readings[i].value;
+      if (readings[i].sensorId == SENSOR_ID_SOIL1_VWC) soilV = readings[i].value;
+    }
+    urgent_listen::State st = nodeUrgentStateLoad();
+    const urgent_listen::State before = st;
+    const uint8_t due = urgent_listen::evaluate(g_urgentConfig, airC, soilV, st);
+    if (due != 0) {
+      urgentWake = true;
+      Serial.printf("🚨 [URGENT] threshold crossed (0x%02X) air=%.2f soil=%.3f\n",
+                    (unsigned)due, airC, soilV);
+      if (sendUrgentSnapshot(nowUnix, local_queue::nextSeq(), readings, count)) {
+        urgent_listen::markDelivered(st, due);
+      }
+    }
+    if (st.active != before.active || st.delivered != before.delivered) {
+      nodeUrgentStateSave(st);
+    }
   }
 
-  // Enqueue the V2 snapshot into the local queue (Phase 2c).
-  if (local_queue::enqueueV2(snap2, readings, count)) {
-    Serial.printf("🧾 V2 snapshot enqueued (seq=%lu sensorCount=%u)\n",
-                  (unsigned long)snap2.seqNum, (unsigned)count);
-  } else {
-    Serial.println("❌ V2 snapshot enqueue failed");
+  const uint8_t aggN = g_aggConfig.samplesPerReport;
+  if (aggN < 2 || bypassAggregation || urgentWake) {
+    // Report-by-exception only runs while aggregation is off: its reference
+    // must be what was last sent, and in aggregation mode that is the window
+    // summary, not this wake's raw values.
+    if (g_rbeConfig.maxSilenceMin == 0 || aggN >= 2) {
+      enqueueSnapshotV2(nowUnix, 0, readings, count);
+    } else {
+      enqueueReportByException(nowUnix, readings, count, bypassAggregation || urgentWake);
+    }
+    return;
+  }
+
+  // Aggregation mode: fold this wake into the open window. Nothing reaches the
+  // queue (or, later, the radio) until the window holds aggN wakes.
+  AggState st;
+  agg_state_store::load(st, aggN);
+  if (st.samplesPerReport != aggN) {
+    if (st.samples > 0) enqueueAggregateSummary(st);
+    aggReset(st, aggN);
   }
+  aggAddSample(st, nowUnix, readings, count, aggKindForSensorId);
+  if (aggWindowComplete(st)) {
+    enqueueAggregateSummary(st);
+    agg_state_store::clear();
+    return;
+  }
+  const bool saved = agg_state_store::save(st, kAggMirrorToNvs);
+  Serial.printf("📊 [AGG] wake folded %u/%u (%u channels)%s\n",
+                (unsigned)st.samples, (unsigned)aggN, (unsigned)st.channelCount,
+                saved ? "" : " — state persist FAILED");
 }
 
 static QueueFlushResult flushQueuedToMothership(uint32_t deadlineMs,
@@ -1352,7 +1642,7 @@ static QueueFlushResult flushQueuedToMothership(uint32_t deadlineMs,
           feedWatchdog();
           serviceNodeEvents(8);
           if (g_snapshotAckMatched && g_snapshotAckPersisted) break;
-          delay(5);
+          waitForNodeActivity(NODE_SNAPSHOT_ACK_TIMEOUT_MS - (millis() - ackStart));
         }
         delivered = g_snapshotAckMatched && g_snapshotAckPersisted;
         if (!delivered) {
@@ -1377,7 +1667,7 @@ static QueueFlushResult flushQueuedToMothership(uint32_t deadlineMs,
             break;
           }
           serviceNodeEvents(4);
-          delay(5);
+          waitForNodeActivity(backoffMs - (millis() - backoffStart));
         }
       }
     }
@@ -1394,7 +1684,9 @@ static QueueFlushResult flushQueuedToMothership(uint32_t deadlineMs,
       break;
     }
     result.sentRecords++;
-    delay(5);
+    // A durable flush is paced by the mothership's SNAPSHOT_ACK. Without one,
+    // keep the short gap so a burst cannot overrun the hub's receive queue.
+    if (!requireDurableAck) delay(5);
   }
 
   Serial.printf("📤 queue flush done: sent=%u pending=%u\n",
@@ -1408,15 +1700,7 @@ static QueueFlushResult flushQueuedToMothership(uint32_t deadlineMs,
 }
 
 static void onDataSent(const uint8_t *mac_addr, esp_now_send_status_t status) {
-  if (!mac_addr) return;
-  if (!g_sendActive) return;
-  if (memcmp(mac_addr, g_sendExpectedMac, 6) != 0) {
-    return;
-  }
-  g_sendDeliveryStatus = status;
-  g_sendCallbackReceived = true;
-  g_lastSendStatus = status;
-  g_lastSendDone = true;
+  espnow_tx::onSendComplete(mac_addr, status);
 }
 // --- Receive-path diagnostics -----------------------------------------------
 // Separates "packets are arriving and being discarded" from "nothing is
@@ -1459,6 +1743,10 @@ static void onDataReceived(const uint8_t *mac, const uint8_t *incomingData, int
       type == IncomingMessageType::SYNC_SESSION ||
       type == IncomingMessageType::DUMP_GRANT ||
       type == IncomingMessageType::SYNC_RELEASE ||
+      type == IncomingMessageType::OTA_OFFER ||
+      type == IncomingMessageType::OTA_CHUNK ||
+      type == IncomingMessageType::CLOCK_REPLY ||
+      type == IncomingMessageType::CONFIG_DIGEST ||
       type == IncomingMessageType::SNAPSHOT_ACK;
 
   if (operational && hasMothershipMAC() && memcmp(mac, mothershipMAC, 6) != 0) {
@@ -1477,6 +1765,23 @@ static void onDataReceived(const uint8_t *mac, const uint8_t *incomingData, int
     return;
   }
 
+  // Chunk bursts would swamp the event queue; they have their own.
+  if (type == IncomingMessageType::OTA_CHUNK) {
+    fleet_ota_node::enqueueChunk(incomingData, static_cast<size_t>(len));
+    return;
+  }
+
+  // The digest lists the whole fleet; all we keep is our own entry.
+  if (type == IncomingMessageType::CONFIG_DIGEST) {
+    uint16_t wanted = 0;
+    if (configDigestVersionFor(incomingData, static_cast<size_t>(len), NODE_ID, wanted) &&
+        wanted > g_appliedConfigVersion) {
+      g_digestWantedVersion = wanted;
+      g_configPullPending = true;
+    }
+    return;
+  }
+
   enqueueValidatedNodeEvent(mac, type, incomingData,
                             static_cast<size_t>(len), millis());
   return;
@@ -1529,10 +1834,11 @@ static bool hasCriticalPendingWork() {
   // the event queue by processPowerCut() after shutdown — sets a flag nothing
   // clears, and the node defers power-off forever until its battery dies.
   if (g_espNowReady &&
-      (g_syncSessionOpenPending || g_dumpGrantPending || g_syncReleasePending)) {
+      (g_syncSessionOpenPending || g_dumpGrantPending || g_syncReleasePending ||
+       g_configPullPending)) {
     return true;
   }
-  if (g_sendActive || g_waitingSnapshotAck) return true;
+  if (espnow_tx::inFlight() > 0 || g_waitingSnapshotAck) return true;
   if ((int32_t)(g_postWakeWindowUntilMs - millis()) > 0) return true;
   if (currentNodeState() == STATE_DEPLOYED && rtcSynced && !g_alarmWakeVerified) return true;
   return false;
@@ -1708,7 +2014,25 @@ static void serviceNodeEvents(uint32_t maxEvents) {
         g_syncReleasePending = true;
         break;
 
+      case NodeEventType::OTA_OFFER:
+        memcpy(&g_otaOfferData, &ev.payload.otaOffer, sizeof(g_otaOfferData));
+        g_otaOfferPending = true;
+        break;
+
+      case NodeEventType::CLOCK_REPLY:
+        memcpy(&g_clockReplyData, &ev.payload.clockReply, sizeof(g_clockReplyData));
+        g_clockReplyRxMs = ev.receivedMs;
+        g_clockReplyPending = true;
+        break;
+
       case NodeEventType::SNAPSHOT_ACK:
+        // The hub lost this node's report-by-exception reference: whichever
+        // ACK says so, the next snapshot goes out in full to rebuild it.
+        if (ev.payload.snapshotAck.flags & SNAPSHOT_ACK_SEND_FULL) {
+          rbe_state_store::clear();
+          Serial.printf("[RBE] hub has no reference (seq=%lu) - next snapshot in full\n",
+                        (unsigned long)ev.payload.snapshotAck.seqNum);
+        }
         if (g_waitingSnapshotAck &&
             ev.payload.snapshotAck.seqNum == g_expectedSnapshotAckSeq &&
             ev.payload.snapshotAck.persisted == 1 &&
@@ -1778,7 +2102,7 @@ static void runStaleSyncRecoveryIfNeeded() {
     serviceNodeEvents(8);
     if (lastTimeSyncUnix > syncBefore) break;
     if (g_syncWindowMarkerMs != 0) break;
-    delay(50);
+    waitForNodeActivity((uint32_t)(deadline - millis()));
   }
 
   const bool timeRecovered = (lastTimeSyncUnix > syncBefore);
@@ -1845,12 +2169,13 @@ static void sendNodeStatusUpdate(const char* reason) {
   st.rescueMode = g_rescueModeActive ? 1 : 0;
   st.rtcUnix = g_rtcReady ? rtc.now().unixtime() : 0;
 
-  esp_err_t bcastRes = sendEspNowAndWait(broadcastAddress, &st, sizeof(st), 250).queueResult;
-
-  esp_err_t directRes = ESP_ERR_INVALID_STATE;
-  if (hasMothershipMAC()) {
-    directRes = sendEspNowAndWait(mothershipMAC, &st, sizeof(st), 250).queueResult;
-  }
+  SendResult bcast{};
+  SendResult direct{};
+  const bool haveMothership = hasMothershipMAC();
+  sendEspNowPairAndWait(broadcastAddress, haveMothership ? mothershipMAC : nullptr,
+                        &st, sizeof(st), 250, bcast, direct);
+  const esp_err_t bcastRes = bcast.queueResult;
+  const esp_err_t directRes = haveMothership ? direct.queueResult : ESP_ERR_INVALID_STATE;
 
   Serial.printf("📣 NODE_STATUS sent (%s): state=%u rtcSynced=%u deployed=%u rescue=%u rtcUnix=%lu direct=%s bcast=%s\n",
                 reason ? reason : "periodic",
@@ -1976,8 +2301,10 @@ static void sendFwCaps() {
     caps.otherSlotState = FW_OTA_EMPTY;  // no readable image staged
   }
 
-  sendEspNowAndWait(mothershipMAC, &caps, sizeof(caps), 250);
-  sendEspNowAndWait(broadcastAddress, &caps, sizeof(caps), 250);
+  SendResult direct{};
+  SendResult bcast{};
+  sendEspNowPairAndWait(mothershipMAC, broadcastAddress, &caps, sizeof(caps), 250,
+                        direct, bcast);
   sentThisWake = true;
   Serial.printf("📦 FW_CAPS sent: v%s build=%s hw=%s maxImg=%u slot=%s otherState=%u\n",
                 caps.fwVersion, caps.buildId, caps.hwTarget,
@@ -2001,11 +2328,14 @@ static void sendNodeHello(bool broadcastFallback) {
   hello.rtcUnix         = rtc.now().unixtime();
 
   // Send direct first, then broadcast fallback to improve contact probability.
-  esp_err_t resDirect = sendEspNowAndWait(mothershipMAC, &hello, sizeof(hello), 250).queueResult;
-  esp_err_t resBcast = ESP_OK;
-  if (broadcastFallback) {
-    resBcast = sendEspNowAndWait(broadcastAddress, &hello, sizeof(hello), 250).queueResult;
-  }
+  // The broadcast copy is queued behind the direct one rather than after its
+  // MAC ACK.
+  SendResult direct{};
+  SendResult bcast{};
+  sendEspNowPairAndWait(mothershipMAC, broadcastFallback ? broadcastAddress : nullptr,
+                        &hello, sizeof(hello), 250, direct, bcast);
+  const esp_err_t resDirect = direct.queueResult;
+  const esp_err_t resBcast = broadcastFallback ? bcast.queueResult : ESP_OK;
 
   Serial.printf("👋 NODE_HELLO sent: cfgV=%u wakeMin=%u qDepth=%u : direct=%s bcast=%s\n",
                 hello.configVersion, hello.wakeIntervalMin, hello.queueDepth,
@@ -2042,7 +2372,8 @@ static bool armDeploymentWakeAlarms(DateTime* nextDataOut, DateTime* nextSyncOut
     result.alarm1Verified = true;
     if (nextDataOut) *nextDataOut = DateTime((uint32_t)0);
   } else {
-    result.alarm1Written = ds3231ArmNextInNMinutes(g_intervalMin, nextDataOut, &expected);
+    result.alarm1Written = ds3231ArmNextInNMinutes(g_intervalMin, nextDataOut, &expected,
+                                                   g_urgentConfig.flags != 0);
     result.alarm1Verified = result.alarm1Written && verifyAlarm1Bytes(expected.a1);
   }
 
@@ -2130,7 +2461,7 @@ static void finalizeWakeAndSleep(const char* reason) {
 
   while ((int32_t)(g_postWakeWindowUntilMs - millis()) > 0) {
     serviceNodeEvents(12);
-    delay(20);
+    waitForNodeActivity(g_postWakeWindowUntilMs - millis());
   }
   serviceNodeEvents(12);
 
@@ -2152,6 +2483,214 @@ static uint32_t coordinatedHelloJitterMs(uint32_t sessionId) {
   return NODE_SYNC_HELLO_JITTER_MS ? (hash % NODE_SYNC_HELLO_JITTER_MS) : 0;
 }
 
+// ---- Two-way clock exchange (CLOCK_PROBE / CLOCK_REPLY) ----
+//
+// The DS3231 only reads out whole seconds. lockRtcSecondEdge() polls the
+// seconds register until it ticks and pins that instant to millis(); from then
+// until sleep, nodeClockMs() is the RTC in milliseconds. The exchange then
+// measures the offset to the mothership to within half the round trip, steps
+// the RTC onto the mothership's second boundary, and trims the DS3231 aging
+// register from the drift seen since the previous fix (NVS "clock"/"fix").
+
+struct RtcSecondEdge {
+  bool     valid = false;
+  uint32_t atUnix = 0;
+  uint32_t millisAt = 0;
+};
+static RtcSecondEdge g_rtcEdge;
+static bool g_preciseClockFix = false;  // precise fix applied this wake
+
+static bool lockRtcSecondEdge() {
+  g_rtcEdge.valid = false;
+  if (!g_rtcReady) return false;
+  uint8_t first = 0;
+  if (!readDS3231RegChecked(0x00, first)) return false;
+  feedWatchdog();
+  const uint32_t deadlineMs = millis() + 1100UL;
+  while ((int32_t)(deadlineMs - millis()) > 0) {
+    uint8_t sec = 0;
+    if (!readDS3231RegChecked(0x00, sec)) return false;
+    if (sec != first) {
+      const uint32_t at = millis();
+      g_rtcEdge.atUnix = rtc.now().unixtime();  // same second for the next ~999 ms
+      g_rtcEdge.millisAt = at;
+      g_rtcEdge.valid = true;
+      return true;
+    }
+    delayMicroseconds(500);
+  }
+  return false;
+}
+
+static int64_t nodeClockMsAt(uint32_t millisValue) {
+  return (int64_t)g_rtcEdge.atUnix * 1000LL +
+         (int64_t)(int32_t)(millisValue - g_rtcEdge.millisAt);
+}
+
+static int64_t nodeClockMs() { return nodeClockMsAt(millis()); }
+
+static bool readDS3231Aging(int8_t& out) {
+  uint8_t raw = 0;
+  if (!readDS3231RegChecked(0x10, raw)) return false;
+  out = (int8_t)raw;
+  return true;
+}
+
+// New aging values take effect at the next temperature conversion; force one
+// (CONV, control bit 5) rather than wait up to 64 s for the automatic one.
+static bool writeDS3231Aging(int8_t value) {
+  if (!writeDS3231RegChecked(0x10, (uint8_t)value)) return false;
+  uint8_t ctrl = 0;
+  if (!readDS3231RegChecked(0x0E, ctrl)) return false;
+  return writeDS3231RegChecked(0x0E, (uint8_t)(ctrl | 0x20));
+}
+
+// Step the RTC by offsetMs. Writing the seconds register restarts the
+// DS3231's one-second countdown, so the write is timed to the instant the
+// mothership's clock crosses a whole second and sets exactly that second.
+static bool stepRtcAligned(int32_t offsetMs) {
+  const int64_t mothershipNow = nodeClockMs() + offsetMs;
+  int64_t targetMs = (mothershipNow / 1000LL + 1LL) * 1000LL;
+  if (targetMs - mothershipNow < 20) targetMs += 1000LL;  // time to get there
+  const uint32_t atMillis =
+      g_rtcEdge.millisAt +
+      (uint32_t)(targetMs - offsetMs - (int64_t)g_rtcEdge.atUnix * 1000LL);
+  const int32_t waitMs = (int32_t)(atMillis - millis());
+  if (waitMs > 3) delay((uint32_t)waitMs - 3);
+  while ((int32_t)(atMillis - millis()) > 0) {
+  }
+  const uint32_t targetUnix = (uint32_t)(targetMs / 1000LL);
+  rtc.adjust(DateTime(targetUnix));
+  g_rtcEdge.atUnix = targetUnix;
+  g_rtcEdge.millisAt = atMillis;
+  return rtc.now().unixtime() == targetUnix;
+}
+
+static uint32_t loadClockFixUnix() {
+  if (!g_nvsReady) return 0;
+  Preferences p;
+  if (!p.begin("clock", true)) return 0;
+  const uint32_t fix = p.getULong("fix", 0);
+  p.end();
+  return fix;
+}
+
+static void saveClockFixUnix(uint32_t fixUnix) {
+  if (!g_nvsReady) return;
+  Preferences p;
+  if (!p.begin("clock", false)) return;
+  if (p.getULong("fix", 0) != fixUnix) p.putULong("fix", fixUnix);
+  p.end();
+}
+
+// A coarse (whole-second) clock set breaks the drift span: the next offset
+// would measure the step, not the crystal.
+static void forgetClockFix() {
+  if (loadClockFixUnix() != 0) saveClockFixUnix(0);
+}
+
+static bool sendClockProbe(uint32_t sessionId, uint8_t seq, uint8_t flags,
+                           int8_t aging, const clock_sync::Sample& sample,
+                           int16_t driftCentiPpm, int64_t* t1Out) {
+  clock_probe_message_t probe{};
+  strcpy(probe.command, "CLOCK_PROBE");
+  strncpy(probe.nodeId, NODE_ID, sizeof(probe.nodeId) - 1);
+  probe.sessionId = sessionId;
+  probe.seq = seq;
+  probe.flags = flags;
+  probe.agingOffset = aging;
+  probe.offsetMs = sample.offsetMs;
+  probe.delayMs = (uint16_t)min(sample.delayMs, (uint32_t)UINT16_MAX);
+  probe.driftCentiPpm = driftCentiPpm;
+  probe.t1Ms = nodeClockMs();
+  if (t1Out) *t1Out = probe.t1Ms;
+  return sendEspNowAndWait(mothershipMAC, &probe, sizeof(probe), 250).queueResult == ESP_OK;
+}
+
+// Run the exchange inside an open sync session. Returns true when the RTC now
+// holds a precise fix. Other session traffic that arrives meanwhile stays
+// pending for the caller's loop.
+static bool runClockExchange(uint32_t sessionId, uint32_t sessionDeadlineMs) {
+  if (!g_rtcEdge.valid || !hasMothershipMAC()) return false;
+
+  clock_sync::Sample best;
+  g_clockReplyPending = false;
+  for (uint8_t seq = 1; seq <= (uint8_t)NODE_CLOCK_PROBES; ++seq) {
+    if ((int32_t)(sessionDeadlineMs - millis()) < (int32_t)NODE_CLOCK_PROBE_TIMEOUT_MS) break;
+    int64_t t1 = 0;
+    if (!sendClockProbe(sessionId, seq, 0, 0, clock_sync::Sample{}, 0, &t1)) continue;
+    const uint32_t waitUntilMs = millis() + NODE_CLOCK_PROBE_TIMEOUT_MS;
+    while ((int32_t)(waitUntilMs - millis()) > 0) {
+      feedWatchdog();
+      serviceNodeEvents(8);
+      if (g_clockReplyPending) {
+        g_clockReplyPending = false;
+        const clock_reply_message_t reply = g_clockReplyData;
+        if (reply.sessionId == sessionId && reply.seq == seq && reply.t1Ms == t1) {
+          clock_sync::keepBest(best, clock_sync::sampleFrom(
+              t1, reply.t2Ms, reply.t3Ms, nodeClockMsAt(g_clockReplyRxMs)));
+          break;
+        }
+      }
+      waitForNodeActivity(waitUntilMs - millis());
+    }
+  }
+  if (!best.valid) {
+    Serial.println("[CLOCK] no usable CLOCK_REPLY; keeping RELEASE time sync");
+    return false;
+  }
+
+  const uint32_t nowUnix = (uint32_t)(nodeClockMs() / 1000LL);
+  const uint32_t fixUnix = loadClockFixUnix();
+  int16_t drift = 0;
+  const bool driftValid = fixUnix > 0 && nowUnix > fixUnix &&
+      clock_sync::driftCentiPpm(best.offsetMs, nowUnix - fixUnix, drift);
+
+  int8_t aging = 0;
+  const bool agingRead = readDS3231Aging(aging);
+  bool agingChanged = false;
+  if (driftValid && agingRead) {
+    const int8_t next = clock_sync::nextAgingOffset(aging, drift);
+    if (next != aging && writeDS3231Aging(next)) {
+      aging = next;
+      agingChanged = true;
+    }
+  }
+
+  const int32_t absOffset = best.offsetMs < 0 ? -best.offsetMs : best.offsetMs;
+  bool stepped = false;
+  if (absOffset > clock_sync::kStepThresholdMs) {
+    stepped = stepRtcAligned(best.offsetMs);
+    if (!stepped) {
+      Serial.println("[CLOCK] aligned RTC step did not verify");
+      return false;
+    }
+  }
+  // Restart the drift span only when the clock or its rate changed; a small
+  // untouched offset keeps accumulating toward the next estimate.
+  const uint32_t fixedUnix = (uint32_t)(nodeClockMs() / 1000LL);
+  if (stepped || agingChanged || fixUnix == 0) saveClockFixUnix(fixedUnix);
+
+  rtcSynced = true;
+  g_rtcPowerLost = false;
+  if (g_recoveryReason == RecoveryReason::RTC_LOST_POWER) {
+    g_recoveryReason = RecoveryReason::NONE;
+  }
+  lastTimeSyncUnix = fixedUnix;
+  g_preciseClockFix = true;
+
+  uint8_t flags = CLOCK_PROBE_REPORT;
+  if (stepped) flags |= CLOCK_PROBE_STEPPED;
+  if (driftValid && agingRead) flags |= CLOCK_DRIFT_VALID;
+  sendClockProbe(sessionId, 0, flags, aging, best, drift, nullptr);
+
+  Serial.printf("[CLOCK] offset=%ldms delay=%lums stepped=%u drift=%s%d.%02dppm aging=%d%s\n",
+                (long)best.offsetMs, (unsigned long)best.delayMs, stepped ? 1 : 0,
+                drift < 0 ? "-" : "", abs(drift) / 100, abs(drift) % 100,
+                (int)aging, driftValid ? (agingChanged ? " (trimmed)" : "") : " (no span yet)");
+  return true;
+}
+
 static void sendDumpDone(uint32_t sessionId, uint16_t grantId,
                          const QueueFlushResult& flush) {
   dump_done_message_t done{};
@@ -2163,11 +2702,12 @@ static void sendDumpDone(uint32_t sessionId, uint16_t grantId,
   done.remainingRecords = (uint8_t)min((int)local_queue::count(), 255);
   done.status = flush.status;
 
-  // DUMP_DONE is idempotent. Send twice with spacing so a lost control frame
-  // does not consume the entire grant timeout at the mothership.
+  // DUMP_DONE is idempotent. Send twice so a lost control frame does not
+  // consume the entire grant timeout at the mothership. The second copy goes
+  // out as soon as the first one's send callback returns; the radio's own
+  // ACK/retry cycle spaces them, not a fixed sleep.
   for (uint8_t attempt = 0; attempt < 2; ++attempt) {
     sendEspNowAndWait(mothershipMAC, &done, sizeof(done), 350);
-    if (attempt == 0) delay(35);
   }
   Serial.printf("[SYNC] DUMP_DONE session=%lu grant=%u sent=%u remaining=%u status=%u\n",
                 (unsigned long)sessionId, (unsigned)grantId,
@@ -2179,10 +2719,20 @@ static bool applySyncReleaseAndAck(const sync_release_message_t& release) {
   bool applied = validSyncScheduleValue(release.syncIntervalMin,
                                         release.syncPhaseUnix);
   if (applied && release.mothershipUnix >= 1704067200UL) {
-    rtc.adjust(DateTime(release.mothershipUnix));
+    // mothershipUnix is truncated to the second. After a CLOCK_PROBE fix this
+    // wake the RTC is already closer than that; only a disagreement beyond
+    // the truncation means something went wrong and the coarse set wins.
+    const uint32_t rtcUnix = rtc.now().unixtime();
+    const uint32_t diff = rtcUnix > release.mothershipUnix
+        ? rtcUnix - release.mothershipUnix : release.mothershipUnix - rtcUnix;
+    if (!g_preciseClockFix || diff > 2) {
+      rtc.adjust(DateTime(release.mothershipUnix));
+      forgetClockFix();
+      g_preciseClockFix = false;
+      lastTimeSyncUnix = release.mothershipUnix;
+    }
     rtcSynced = true;
     g_rtcPowerLost = false;
-    lastTimeSyncUnix = release.mothershipUnix;
     g_syncIntervalMin = release.syncIntervalMin;
     g_syncPhaseUnix = release.syncPhaseUnix;
     g_lastSyncSlot = 0xFFFFFFFFUL;
@@ -2198,9 +2748,9 @@ static bool applySyncReleaseAndAck(const sync_release_message_t& release) {
   ack.appliedSyncIntervalMin = applied ? g_syncIntervalMin : 0;
   ack.scheduleApplied = applied ? 1 : 0;
   ack.remainingRecords = (uint8_t)min((int)local_queue::count(), 255);
+  // Idempotent, sent twice like DUMP_DONE.
   for (uint8_t attempt = 0; attempt < 2; ++attempt) {
     sendEspNowAndWait(mothershipMAC, &ack, sizeof(ack), 350);
-    if (attempt == 0) delay(35);
   }
   Serial.printf("[SYNC] RELEASE_ACK session=%lu applied=%u sync=%u phase=%lu remaining=%u grace=%u\n",
                 (unsigned long)release.sessionId, applied ? 1 : 0,
@@ -2209,11 +2759,43 @@ static bool applySyncReleaseAndAck(const sync_release_message_t& release) {
   return applied;
 }
 
+// Ask for the NODE_CONFIG a CONFIG_DIGEST advertised as newer than ours. Spaced
+// and capped per wake: the mothership answers within one config burst, and it
+// pushes the frame after our NODE_HELLO anyway.
+static constexpr uint32_t kConfigPullSpacingMs = 2000UL;
+static constexpr uint8_t  kMaxConfigPullsPerWake = 3;
+
+static void serviceConfigPull() {
+  static uint32_t lastPullMs = 0;
+  static uint8_t pullsThisWake = 0;
+  if (!g_configPullPending) return;
+  g_configPullPending = false;
+
+  const uint16_t wanted = g_digestWantedVersion;
+  if (wanted <= getNodeConfigVersion()) return;
+  if (g_pendingNodeConfig && g_pendingNodeConfigData.configVersion >= wanted) return;
+  if (pullsThisWake >= kMaxConfigPullsPerWake || !hasMothershipMAC()) return;
+  if (pullsThisWake > 0 && (uint32_t)(millis() - lastPullMs) < kConfigPullSpacingMs) return;
+
+  config_pull_message_t pull{};
+  strncpy(pull.command, "CONFIG_PULL", sizeof(pull.command) - 1);
+  strncpy(pull.nodeId, NODE_ID, sizeof(pull.nodeId) - 1);
+  pull.appliedVersion = getNodeConfigVersion();
+  pull.wantedVersion = wanted;
+  const esp_err_t res = sendEspNowAndWait(mothershipMAC, &pull, sizeof(pull), 250).queueResult;
+  lastPullMs = millis();
+  pullsThisWake++;
+  Serial.printf("[CONFIG] digest v%u > applied v%u -> CONFIG_PULL %s\n",
+                (unsigned)wanted, (unsigned)pull.appliedVersion,
+                res == ESP_OK ? "OK" : esp_err_to_name(res));
+}
+
 // Apply a deferred NODE_CONFIG from main-task context while ESP-NOW is still
 // available. The receive callback only enqueues the command; coordinated sync
 // loops call this helper immediately after draining events so CONFIG_ACK is
 // returned before the mothership closes the radio window.
 static bool servicePendingNodeConfig() {
+  serviceConfigPull();
   if (!g_pendingNodeConfig) return false;
 
   g_pendingNodeConfig = false;
@@ -2275,6 +2857,69 @@ static bool servicePendingNodeConfig() {
           Serial.println("   ⚠️ sensor mask persist FAILED");
         }
       }
+      // Aggregation mode rides the same version bump. A 60-byte legacy frame
+      // reads as 0 = off. Any open window was sampled under the old settings,
+      // so it is summarised and queued before the new ones take effect.
+      NodeAggConfig agg{};
+      agg.samplesPerReport = cfg.aggSamplesPerReport < 2 ? 0 : cfg.aggSamplesPerReport;
+      if (agg.samplesPerReport > NODE_AGG_MAX_SAMPLES_PER_REPORT) {
+        agg.samplesPerReport = NODE_AGG_MAX_SAMPLES_PER_REPORT;
+      }
+      agg.statsMask = agg.samplesPerReport ? cfg.aggStatsMask : 0;
+      if (configPersisted && (agg.samplesPerReport != g_aggConfig.samplesPerReport ||
+                              agg.statsMask != g_aggConfig.statsMask)) {
+        flushAggregateWindow("config change");
+        // The flushed summary is a full snapshot the FieldHub rebases on.
+        rbe_state_store::clear();
+        if (nodeAggConfigSave(agg)) {
+          g_aggConfig = agg;
+          Serial.printf("   ↪ aggregation %s (N=%u statsMask=0x%04X)\n",
+                        agg.samplesPerReport ? "on" : "off",
+                        (unsigned)agg.samplesPerReport, (unsigned)agg.statsMask);
+        } else {
+          Serial.println("   ⚠️ aggregation config persist FAILED");
+        }
+      }
+      // Report-by-exception, same rules: frames older than 68 bytes read as off.
+      // Any change restarts from a full snapshot so node and FieldHub agree on
+      // the reference.
+      NodeRbeConfig rbe{};
+      rbe.maxSilenceMin = cfg.rbeMaxSilenceMin > NODE_RBE_MAX_SILENCE_MIN
+          ? NODE_RBE_MAX_SILENCE_MIN : cfg.rbeMaxSilenceMin;
+      rbe.deadbandTenths = rbe.maxSilenceMin ? cfg.rbeDeadbandTenths : 0;
+      if (configPersisted && (rbe.maxSilenceMin != g_rbeConfig.maxSilenceMin ||
+                              rbe.deadbandTenths != g_rbeConfig.deadbandTenths)) {
+        rbe_state_store::clear();
+        if (nodeRbeConfigSave(rbe)) {
+          g_rbeConfig = rbe;
+          Serial.printf("   ↪ report-by-exception %s (maxSilence=%umin deadband=%u/10)\n",
+                        rbe.maxSilenceMin ? "on" : "off",
+                        (unsigned)rbe.maxSilenceMin, (unsigned)rbe.deadbandTenths);
+        } else {
+          Serial.println("   ⚠️ report-by-exception config persist FAILED");
+        }
+      }
+      // Urgent thresholds, same rules: frames older than 76 bytes read as off.
+      // Turning them on or off moves the data wakes onto (or off) the
+      // interval boundaries, so A1 is re-armed.
+      NodeUrgentConfig urgent{};
+      urgent.flags = cfg.urgentFlags & (urgent_listen::kFrost | urgent_listen::kFlood);
+      urgent.airBelowCenti = (urgent.flags & urgent_listen::kFrost) ? cfg.urgentAirBelowCenti : 0;
+      urgent.soilAboveMv = (urgent.flags & urgent_listen::kFlood) ? cfg.urgentSoilAboveMv : 0;
+      if (configPersisted && (urgent.flags != g_urgentConfig.flags ||
+                              urgent.airBelowCenti != g_urgentConfig.airBelowCenti ||
+                              urgent.soilAboveMv != g_urgentConfig.soilAboveMv)) {
+        if (nodeUrgentConfigSave(urgent)) {
+          if ((urgent.flags != 0) != (g_urgentConfig.flags != 0)) wakeChanged = true;
+          g_urgentConfig = urgent;
+          nodeUrgentStateSave(urgent_listen::State{});
+          Serial.printf("   ↪ urgent thresholds 0x%02X (frost<%.2fC flood>%umV)\n",
+                        (unsigned)urgent.flags, urgent.airBelowCenti / 100.0f,
+                        (unsigned)urgent.soilAboveMv);
+        } else {
+          Serial.println("   ⚠️ urgent threshold persist FAILED");
+        }
+      }
       // Re-arm if the interval changed OR we just resumed from standby (to
       // bring the recording alarm A1 back).
       if ((wakeChanged || wasPaused) && configPersisted &&
@@ -2381,6 +3026,7 @@ static void handleRtcWakeEvents(bool dataWake, bool syncWake) {
     g_syncSessionOpenPending = false;
     g_dumpGrantPending = false;
     g_syncReleasePending = false;
+    g_otaOfferPending = false;
     if (bringupEspNow()) {
       const uint32_t nowUnix = rtc.now().unixtime();
       const uint32_t targetSyncUnix = nextSyncSlotUnix(nowUnix);
@@ -2414,7 +3060,7 @@ static void handleRtcWakeEvents(bool dataWake, bool syncWake) {
         feedWatchdog();
         serviceNodeEvents(8);
         servicePendingNodeConfig();
-        delay(20);
+        waitForNodeActivity(NODE_EVENT_WAIT_SLICE_MS);
       }
 
       if (g_syncSessionOpenPending) {
@@ -2423,21 +3069,30 @@ static void handleRtcWakeEvents(bool dataWake, bool syncWake) {
         const uint32_t sessionWindowSec = session.sessionWindowSec < 15U
             ? 15UL : (uint32_t)session.sessionWindowSec;
         const uint32_t sessionDeadlineMs = millis() + sessionWindowSec * 1000UL;
+        const uint32_t sessionStartMs = millis();
+        espnow_tx::resetStats();
 
         // Stable node/session jitter spreads HELLO responses without needing a
-        // synchronized random source.
+        // synchronized random source. The RTC second-edge lock for the clock
+        // exchange runs inside that wait rather than after it.
         const uint32_t helloDelayMs = coordinatedHelloJitterMs(session.sessionId);
         const uint32_t helloAtMs = millis() + helloDelayMs;
+        lockRtcSecondEdge();
         while ((int32_t)(helloAtMs - millis()) > 0) {
           feedWatchdog();
           serviceNodeEvents(8);
           servicePendingNodeConfig();
-          delay(5);
+          waitForNodeActivity(helloAtMs - millis());
         }
         sendNodeHello(false);
+        runClockExchange(session.sessionId, sessionDeadlineMs);
         uint32_t nextHelloRetryMs = millis() + 1800UL;
         uint16_t lastGrantId = 0;
         bool released = false;
+        fota_need_message_t otaNeed{};
+        bool otaNeedDue = false;
+        uint32_t otaNeedAtMs = 0;
+        uint32_t otaResultAtMs = millis();
 
         while ((int32_t)(sessionDeadlineMs - millis()) > 0 && !released) {
           feedWatchdog();
@@ -2461,7 +3116,6 @@ static void handleRtcWakeEvents(bool dataWake, bool syncWake) {
             const dump_grant_message_t grant = g_dumpGrantData;
             g_dumpGrantPending = false;
             if (grant.sessionId != session.sessionId || grant.grantId <= lastGrantId) {
-              delay(5);
               continue;
             }
             lastGrantId = grant.grantId;
@@ -2481,23 +3135,82 @@ static void handleRtcWakeEvents(bool dataWake, bool syncWake) {
             nextHelloRetryMs = sessionDeadlineMs;  // roster already confirmed by a grant
           }
 
+          // Fleet firmware distribution: answer each OTA_OFFER round with the
+          // missing chunk ranges (jittered so the fleet's NEEDs do not collide),
+          // then store the broadcast chunks as they stream in.
+          if (g_otaOfferPending) {
+            const fota_offer_message_t offer = g_otaOfferData;
+            g_otaOfferPending = false;
+            if (offer.sessionId == session.sessionId &&
+                fleet_ota_node::onOffer(offer, otaNeed)) {
+              otaNeedAtMs = millis() +
+                  coordinatedHelloJitterMs(session.sessionId ^ offer.imageId) %
+                      FOTA_NEED_JITTER_MS;
+              otaNeedDue = true;
+            }
+          }
+          if (otaNeedDue && (int32_t)(millis() - otaNeedAtMs) >= 0) {
+            otaNeedDue = false;
+            sendEspNowAndWait(mothershipMAC, &otaNeed, sizeof(otaNeed), 350);
+          }
+          fleet_ota_node::serviceChunks(fleet_ota_node::kChunkQueueDepth);
+          fota_result_message_t otaResult;
+          if ((int32_t)(millis() - otaResultAtMs) >= 0 &&
+              fleet_ota_node::pendingResult(otaResult)) {
+            const SendResult sent =
+                sendEspNowAndWait(mothershipMAC, &otaResult, sizeof(otaResult), 350);
+            if (sent.callbackReceived && sent.deliveryStatus == ESP_NOW_SEND_SUCCESS) {
+              fleet_ota_node::resultDelivered();
+              Serial.printf("[FOTA] OTA_RESULT status=%u reason=%s delivered\n",
+                            (unsigned)otaResult.status,
+                            fwReasonStr((FwReason)otaResult.reason));
+            } else {
+              otaResultAtMs = millis() + 2000UL;
+            }
+          }
+
           // Until granted, repeat HELLO at a low rate in case the first unicast
           // was lost. Once granted, the mothership owns further scheduling.
           if (lastGrantId == 0 && (int32_t)(millis() - nextHelloRetryMs) >= 0) {
             sendNodeHello(false);
             nextHelloRetryMs = millis() + 1800UL;
           }
-          delay(10);
+          // Sleep until the next grant/release frame, the HELLO retry or the
+          // session deadline, whichever comes first.
+          uint32_t wakeAtMs = lastGrantId == 0 &&
+                              (int32_t)(nextHelloRetryMs - sessionDeadlineMs) < 0
+              ? nextHelloRetryMs : sessionDeadlineMs;
+          if (otaNeedDue && (int32_t)(otaNeedAtMs - wakeAtMs) < 0) wakeAtMs = otaNeedAtMs;
+          if ((int32_t)(wakeAtMs - millis()) > 0) waitForNodeActivity(wakeAtMs - millis());
         }
 
+        fleet_ota_node::endSession();
         if (!released) {
           Serial.printf("[SYNC] session %lu ended without RELEASE; queue retained=%u\n",
                         (unsigned long)session.sessionId,
                         (unsigned)local_queue::count());
         }
+        {
+          // Per-session radio cost: ms per frame (submit -> send callback) and
+          // how long the main task actually ran rather than blocked on events.
+          const espnow_tx::Stats tx = espnow_tx::stats();
+          const uint32_t sessionMs = millis() - sessionStartMs;
+          const uint32_t blockedMs = tx.blockedUs / 1000UL;
+          const uint32_t timed = tx.acked + tx.failed;
+          Serial.printf("[TX] session %lu frames=%lu acked=%lu failed=%lu lost=%lu "
+                        "avg=%.2fms max=%.2fms cpuActive=%lums of %lums\n",
+                        (unsigned long)session.sessionId, (unsigned long)tx.frames,
+                        (unsigned long)tx.acked, (unsigned long)tx.failed,
+                        (unsigned long)tx.lost,
+                        timed ? tx.latencySumUs / 1000.0f / (float)timed : 0.0f,
+                        tx.latencyMaxUs / 1000.0f,
+                        (unsigned long)(sessionMs > blockedMs ? sessionMs - blockedMs : 0),
+                        (unsigned long)sessionMs);
+        }
         g_syncSessionOpenPending = false;
         g_dumpGrantPending = false;
         g_syncReleasePending = false;
+        g_otaOfferPending = false;
         // Catch a final NODE_CONFIG received while RELEASE/ACK traffic was in
         // flight. Keep the radio available until its CONFIG_ACK is sent.
         serviceNodeEvents(12);
@@ -2603,6 +3316,11 @@ void setup() {
   if (!initNodeEventQueue(NODE_EVENT_QUEUE_DEPTH)) {
     Serial.println("[EVENT] node event queue allocation failed");
   }
+  // setup() and loop() share the Arduino loop task: it is the one to wake.
+  if (!espnow_tx::begin()) {
+    Serial.println("[EVENT] ESP-NOW TX completion queue allocation failed");
+  }
+  setNodeEventWaiter(xTaskGetCurrentTaskHandle());
 
   initNodeIdentity();
 
@@ -2611,6 +3329,10 @@ void setup() {
   }
   loadNodeConfig();
   bootCount++;
+  {
+    const FirmwareIdentity id = fwIdentity(NODE_PROTOCOL_VERSION);
+    fleet_ota_node::begin(NODE_ID, id.semver, id.hwTarget, xTaskGetCurrentTaskHandle());
+  }
 
   // Banner doubles as the production-firmware marker that
   // scripts/node_test_harness.sh greps for to confirm a node came up on the
@@ -2649,6 +3371,7 @@ void setup() {
       g_rtcPowerLost = true;
       g_recoveryReason = RecoveryReason::RTC_LOST_POWER;
       lastTimeSyncUnix = 0;
+      forgetClockFix();  // the oscillator stopped; there is no drift span
       ds3231DisableAlarmInterrupt();
       ds3231DisableAlarm2Interrupt();
       clearDS3231_AlarmFlags();
@@ -2689,10 +3412,22 @@ void setup() {
     }
   }
 
-  if (!local_queue::begin()) {
+  const bool queueReady = local_queue::begin();
+  if (!queueReady) {
     Serial.println("⚠️ Local queue init failed; logging/sync will be degraded");
   }
 
+  // First boot of a new image: NVS is mounted (rollbackPendingOtaForNvsFault
+  // covers the failure) and the local queue decides whether it keeps the slot.
+  if (otaIsPendingVerify()) {
+    if (queueReady) {
+      Serial.printf("[OTA] new image confirmed: %s\n", esp_err_to_name(otaConfirmImage()));
+    } else {
+      Serial.println("[OTA] new image cannot open the local queue; rolling back");
+      otaRejectImageAndReboot();
+    }
+  }
+
   if (rtcReady) {
     const uint32_t bootUnix = rtc.now().unixtime();
     if (updateRescueBootStreak(bootUnix)) {
@@ -2707,6 +3442,24 @@ void setup() {
   // Load the configured "expected" sensor mask before initSensors() so passive
   // sensors are gated by the operator's selection. 0 = auto-detect everything.
   g_expectedSensorMask = nodeSensorMaskLoad();
+  g_aggConfig = nodeAggConfigLoad();
+  if (g_aggConfig.samplesPerReport >= 2) {
+    Serial.printf("📊 [AGG] aggregation mode: one summary per %u wakes (statsMask=0x%04X)\n",
+                  (unsigned)g_aggConfig.samplesPerReport, (unsigned)g_aggConfig.statsMask);
+  }
+  g_rbeConfig = nodeRbeConfigLoad();
+  if (g_rbeConfig.maxSilenceMin > 0) {
+    Serial.printf("📉 [RBE] report-by-exception: full snapshot at least every %u min "
+                  "(deadband %u/10)\n",
+                  (unsigned)g_rbeConfig.maxSilenceMin, (unsigned)g_rbeConfig.deadbandTenths);
+  }
+  g_urgentConfig = nodeUrgentConfigLoad();
+  if (g_urgentConfig.flags != 0) {
+    Serial.printf("🚨 [URGENT] thresholds 0x%02X (frost<%.2fC flood>%umV), "
+                  "boundary-aligned wakes\n",
+                  (unsigned)g_urgentConfig.flags, g_urgentConfig.airBelowCenti / 100.0f,
+                  (unsigned)g_urgentConfig.soilAboveMv);
+  }
 
   // Initialise all sensors (SHT41, PAR, soil, wind stub, AUX stub via sensors.cpp)
   if (!initSensors()) {
@@ -2791,8 +3544,20 @@ void loop() {
       return;
     }
 
+    // Broadcast TIME_SYNC is whole-second; do not let it undo a CLOCK_PROBE
+    // fix taken this wake unless the two disagree by more than the truncation.
+    const uint32_t rtcUnixNow = rtc.now().unixtime();
+    if (g_preciseClockFix &&
+        (incomingUnix > rtcUnixNow ? incomingUnix - rtcUnixNow
+                                   : rtcUnixNow - incomingUnix) <= 2) {
+      Serial.println("⏰ [LOOP] TIME_SYNC skipped: RTC holds a precise fix from this session");
+      return;
+    }
+
     uint32_t prevSync = lastTimeSyncUnix;
     rtc.adjust(dt);
+    forgetClockFix();
+    g_preciseClockFix = false;
     rtcSynced        = true;
     g_rtcPowerLost   = false;
     if (g_recoveryReason == RecoveryReason::RTC_LOST_POWER) {
@@ -2841,6 +3606,8 @@ void loop() {
     ds3231DisableAlarm2Interrupt();
     clearDS3231_AlarmFlags();
     local_queue::clear();
+    agg_state_store::clear();
+    rbe_state_store::clear();
     Serial.println("🧹 Cleared local queue after PAIR_NODE");
     persistNodeConfig();
     Serial.println("💾 Node state persisted after PAIR_NODE (rtcSynced=false, deployed=false)");
@@ -2869,6 +3636,8 @@ void loop() {
       ds3231DisableAlarm2Interrupt();
       clearDS3231_AlarmFlags();
       local_queue::clear();
+      agg_state_store::clear();
+      rbe_state_store::clear();
       Serial.println("🧹 Cleared local queue after PAIRING_RESPONSE");
       persistNodeConfig();
       if (g_rescueModeActive) {
@@ -2896,6 +3665,8 @@ void loop() {
     clearDS3231_AlarmFlags();
     persistNodeConfig();
     local_queue::clear();
+    agg_state_store::clear();
+    rbe_state_store::clear();
     g_postUnpairHold = true;
     Serial.println("💾 Node config persisted after UNPAIR");
     Serial.println("📡 Post-unpair: radio hold requested (15 min idle before power-off)");
@@ -2976,6 +3747,9 @@ void loop() {
       deploymentEpochPersisted = nodeDeploymentEpochSave(dc.deploymentEpoch);
       if (deploymentEpochPersisted) {
         g_deploymentEpoch = dc.deploymentEpoch;
+        // A window must not straddle two deployments.
+        agg_state_store::clear();
+        rbe_state_store::clear();
       } else {
         Serial.println("[DEPLOY] epoch persist failed; baseline capture deferred for safe retry");
       }
@@ -3138,7 +3912,9 @@ void loop() {
     Serial.println("🚦 [DEPLOY S1] Bootstrap start (loop context)");
 
     Serial.println("🚦 [DEPLOY S2] Capturing sensors");
-    captureSensorsToQueue();
+    // The baseline confirms the deployment end to end, so it is always a
+    // plain snapshot even when aggregation mode is configured.
+    captureSensorsToQueue(true);
     Serial.printf("🚦 [DEPLOY S2] Capture done; pending queue=%u\n", (unsigned)local_queue::count());
 
     // S3: Best-effort immediate upload – do not wait for SYNC_WINDOW_OPEN.
@@ -3189,7 +3965,7 @@ void loop() {
         sendNodeStatusUpdate("rescue-beacon");
         sendDiscoveryRequest();
       }
-      delay(100);
+      waitForNodeActivity(100);
       return;
     }
   }
@@ -3211,7 +3987,7 @@ void loop() {
       sendNodeStatusUpdate("rtc-absent");
       lastTimeSyncReq = nowMs;
     }
-    delay(100);
+    waitForNodeActivity(100);
     return;
   }
 
@@ -3346,5 +4122,7 @@ if (nowMs - lastA1Check > 1000UL) {
     }
   }
 
-  delay(100);
+  // Idle until the next loop tick, but come back at once for an inbound
+  // command so the loop head services it without the old 100 ms lag.
+  waitForNodeActivity(100);
 }
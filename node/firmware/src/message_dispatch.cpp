@@ -43,6 +43,31 @@ const T* asPacket(const uint8_t* data, size_t len) {
   return reinterpret_cast<const T*>(data);
 }
 
+// NODE_CONFIG grew from 60 to 64 bytes (aggregation fields appended), then to
+// 68 (report-by-exception) and 76 (urgent thresholds). All four sizes are
+// valid; only the leading text fields are inspected here, and those sit inside
+// the legacy frame.
+bool nodeConfigSize(size_t len) {
+  return len == sizeof(node_config_message_t) || len == NODE_CONFIG_RBE_SIZE ||
+         len == NODE_CONFIG_AGG_SIZE || len == NODE_CONFIG_LEGACY_SIZE;
+}
+
+const node_config_message_t* asNodeConfig(const uint8_t* data, size_t len) {
+  if (!data || !nodeConfigSize(len)) return nullptr;
+  return reinterpret_cast<const node_config_message_t*>(data);
+}
+
+// CONFIG_DIGEST is cut after its last entry, so its length follows from count.
+const config_digest_message_t* asConfigDigest(const uint8_t* data, size_t len) {
+  if (!data || len < CONFIG_DIGEST_HEADER_SIZE) return nullptr;
+  const auto* p = reinterpret_cast<const config_digest_message_t*>(data);
+  if (p->count > CONFIG_DIGEST_MAX_ENTRIES ||
+      len != CONFIG_DIGEST_HEADER_SIZE + (size_t)p->count * sizeof(config_digest_entry_t)) {
+    return nullptr;
+  }
+  return p;
+}
+
 bool targetMatches(const char* packetNodeId, size_t width, const char* nodeId) {
   if (!nodeId || !hasNullWithin(packetNodeId, width)) return false;
   return strncmp(packetNodeId, nodeId, width) == 0;
@@ -68,6 +93,10 @@ const char* incomingMessageTypeName(IncomingMessageType type) {
     case IncomingMessageType::SYNC_SESSION:      return "SYNC_SESSION";
     case IncomingMessageType::DUMP_GRANT:        return "DUMP_GRANT";
     case IncomingMessageType::SYNC_RELEASE:      return "SYNC_RELEASE";
+    case IncomingMessageType::OTA_OFFER:         return "OTA_OFFER";
+    case IncomingMessageType::OTA_CHUNK:         return "OTA_CHUNK";
+    case IncomingMessageType::CLOCK_REPLY:       return "CLOCK_REPLY";
+    case IncomingMessageType::CONFIG_DIGEST:     return "CONFIG_DIGEST";
     case IncomingMessageType::INVALID:
     default:                                     return "INVALID";
   }
@@ -140,7 +169,7 @@ IncomingMessageType classifyIncomingMessage(const uint8_t* data, size_t len) {
         : IncomingMessageType::INVALID;
   }
   if (strcmp(command, "NODE_CONFIG") == 0) {
-    return exactSize<node_config_message_t>(len)
+    return nodeConfigSize(len)
         ? IncomingMessageType::NODE_CONFIG
         : IncomingMessageType::INVALID;
   }
@@ -159,6 +188,26 @@ IncomingMessageType classifyIncomingMessage(const uint8_t* data, size_t len) {
         ? IncomingMessageType::SYNC_RELEASE
         : IncomingMessageType::INVALID;
   }
+  if (strcmp(command, "OTA_OFFER") == 0) {
+    return exactSize<fota_offer_message_t>(len)
+        ? IncomingMessageType::OTA_OFFER
+        : IncomingMessageType::INVALID;
+  }
+  if (strcmp(command, "OTA_CHUNK") == 0) {
+    return exactSize<fota_chunk_message_t>(len)
+        ? IncomingMessageType::OTA_CHUNK
+        : IncomingMessageType::INVALID;
+  }
+  if (strcmp(command, "CLOCK_REPLY") == 0) {
+    return exactSize<clock_reply_message_t>(len)
+        ? IncomingMessageType::CLOCK_REPLY
+        : IncomingMessageType::INVALID;
+  }
+  if (strcmp(command, "CONFIG_DIGEST") == 0) {
+    return asConfigDigest(data, len)
+        ? IncomingMessageType::CONFIG_DIGEST
+        : IncomingMessageType::INVALID;
+  }
 
   return IncomingMessageType::INVALID;
 }
@@ -195,7 +244,7 @@ bool incomingMessageHasValidTarget(IncomingMessageType type,
     }
     case IncomingMessageType::NODE_CONFIG: {
       // Broadcast-safe: only the addressed node acts on it.
-      const auto* p = asPacket<node_config_message_t>(data, len);
+      const auto* p = asNodeConfig(data, len);
       return p && targetMatches(p->nodeId, sizeof(p->nodeId), nodeId);
     }
     case IncomingMessageType::DUMP_GRANT: {
@@ -206,12 +255,23 @@ bool incomingMessageHasValidTarget(IncomingMessageType type,
       const auto* p = asPacket<sync_release_message_t>(data, len);
       return p && targetMatches(p->nodeId, sizeof(p->nodeId), nodeId);
     }
+    case IncomingMessageType::CLOCK_REPLY: {
+      const auto* p = asPacket<clock_reply_message_t>(data, len);
+      return p && targetMatches(p->nodeId, sizeof(p->nodeId), nodeId);
+    }
+    case IncomingMessageType::CONFIG_DIGEST: {
+      // Broadcast to the fleet: only a node it lists has anything to do.
+      uint16_t version = 0;
+      return configDigestVersionFor(data, len, nodeId, version);
+    }
     case IncomingMessageType::SET_SCHEDULE:
     case IncomingMessageType::SET_SYNC_SCHED:
     case IncomingMessageType::SYNC_WINDOW_OPEN:
     case IncomingMessageType::SYNC_SESSION:
     case IncomingMessageType::TIME_SYNC:
     case IncomingMessageType::CONFIG_SNAPSHOT:
+    case IncomingMessageType::OTA_OFFER:
+    case IncomingMessageType::OTA_CHUNK:
       return true;
     case IncomingMessageType::INVALID:
     default:
@@ -282,7 +342,7 @@ bool incomingMessageTextFieldsTerminated(IncomingMessageType type,
              hasNullWithin(p->nodeId, sizeof(p->nodeId));
     }
     case IncomingMessageType::NODE_CONFIG: {
-      const auto* p = asPacket<node_config_message_t>(data, len);
+      const auto* p = asNodeConfig(data, len);
       return p && hasNullWithin(p->command, sizeof(p->command)) &&
              hasNullWithin(p->nodeId, sizeof(p->nodeId)) &&
              hasNullWithin(p->mothership_id, sizeof(p->mothership_id));
@@ -302,8 +362,47 @@ bool incomingMessageTextFieldsTerminated(IncomingMessageType type,
       return p && hasNullWithin(p->command, sizeof(p->command)) &&
              hasNullWithin(p->nodeId, sizeof(p->nodeId));
     }
+    case IncomingMessageType::CLOCK_REPLY: {
+      const auto* p = asPacket<clock_reply_message_t>(data, len);
+      return p && hasNullWithin(p->command, sizeof(p->command)) &&
+             hasNullWithin(p->nodeId, sizeof(p->nodeId));
+    }
+    case IncomingMessageType::OTA_OFFER: {
+      const auto* p = asPacket<fota_offer_message_t>(data, len);
+      return p && hasNullWithin(p->command, sizeof(p->command)) &&
+             hasNullWithin(p->mothership_id, sizeof(p->mothership_id)) &&
+             hasNullWithin(p->version, sizeof(p->version)) &&
+             hasNullWithin(p->hwTarget, sizeof(p->hwTarget));
+    }
+    case IncomingMessageType::OTA_CHUNK: {
+      const auto* p = asPacket<fota_chunk_message_t>(data, len);
+      return p && hasNullWithin(p->command, sizeof(p->command));
+    }
+    case IncomingMessageType::CONFIG_DIGEST: {
+      const auto* p = asConfigDigest(data, len);
+      return p && hasNullWithin(p->command, sizeof(p->command));
+    }
     case IncomingMessageType::INVALID:
     default:
       return false;
   }
 }
+
+bool configDigestVersionFor(const uint8_t* data, size_t len, const char* nodeId,
+                            uint16_t& version) {
+  const auto* p = asConfigDigest(data, len);
+  if (!p || !nodeId) return false;
+  // shortId is a 16-bit hash, so another node may share it. Take the highest
+  // version listed under it: a colliding entry can then only cause a redundant
+  // pull, never hide a newer config behind an older one.
+  const uint16_t shortId = configDigestShortId(nodeId);
+  bool found = false;
+  for (uint8_t i = 0; i < p->count; ++i) {
+    if (p->entries[i].shortId == shortId &&
+        (!found || p->entries[i].configVersion > version)) {
+      version = p->entries[i].configVersion;
+      found = true;
+    }
+  }
+  return found;
+}
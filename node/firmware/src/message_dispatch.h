@@ -20,7 +20,11 @@ enum class IncomingMessageType : uint8_t {
   NODE_CONFIG,
   SYNC_SESSION,
   DUMP_GRANT,
-  SYNC_RELEASE
+  SYNC_RELEASE,
+  OTA_OFFER,
+  OTA_CHUNK,
+  CLOCK_REPLY,
+  CONFIG_DIGEST
 };
 
 const char* incomingMessageTypeName(IncomingMessageType type);
@@ -38,3 +42,9 @@ bool incomingMessageHasValidTarget(IncomingMessageType type,
 bool incomingMessageTextFieldsTerminated(IncomingMessageType type,
                                          const uint8_t* data,
                                          size_t len);
+
+// Version a CONFIG_DIGEST advertises for nodeId — the highest one listed under
+// its shortId. False when the frame is not a well-formed digest or does not
+// list this node.
+bool configDigestVersionFor(const uint8_t* data, size_t len, const char* nodeId,
+                            uint16_t& version);
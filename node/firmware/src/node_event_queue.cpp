@@ -2,12 +2,14 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <freertos/task.h>
 #include <string.h>
 
 namespace {
 
 QueueHandle_t g_queue = nullptr;
 NodeEventCounters g_counters{};
+TaskHandle_t g_waiter = nullptr;
 
 NodeEventType toNodeEventType(IncomingMessageType type) {
   switch (type) {
@@ -27,6 +29,10 @@ NodeEventType toNodeEventType(IncomingMessageType type) {
     case IncomingMessageType::SYNC_SESSION:      return NodeEventType::SYNC_SESSION;
     case IncomingMessageType::DUMP_GRANT:        return NodeEventType::DUMP_GRANT;
     case IncomingMessageType::SYNC_RELEASE:      return NodeEventType::SYNC_RELEASE;
+    case IncomingMessageType::OTA_OFFER:         return NodeEventType::OTA_OFFER;
+    case IncomingMessageType::CLOCK_REPLY:       return NodeEventType::CLOCK_REPLY;
+    case IncomingMessageType::OTA_CHUNK:         // fleet_ota_node chunk queue, not here
+    case IncomingMessageType::CONFIG_DIGEST:     // reduced to a flag in the RX callback
     case IncomingMessageType::INVALID:
     default:                                     return NodeEventType::DISCOVERY_RESPONSE;
   }
@@ -102,6 +108,16 @@ void forceTermination(NodeEvent& ev) {
       ev.payload.syncRelease.command[sizeof(ev.payload.syncRelease.command) - 1] = '\0';
       ev.payload.syncRelease.nodeId[sizeof(ev.payload.syncRelease.nodeId) - 1] = '\0';
       break;
+    case NodeEventType::OTA_OFFER:
+      ev.payload.otaOffer.command[sizeof(ev.payload.otaOffer.command) - 1] = '\0';
+      ev.payload.otaOffer.mothership_id[sizeof(ev.payload.otaOffer.mothership_id) - 1] = '\0';
+      ev.payload.otaOffer.version[sizeof(ev.payload.otaOffer.version) - 1] = '\0';
+      ev.payload.otaOffer.hwTarget[sizeof(ev.payload.otaOffer.hwTarget) - 1] = '\0';
+      break;
+    case NodeEventType::CLOCK_REPLY:
+      ev.payload.clockReply.command[sizeof(ev.payload.clockReply.command) - 1] = '\0';
+      ev.payload.clockReply.nodeId[sizeof(ev.payload.clockReply.nodeId) - 1] = '\0';
+      break;
   }
 }
 
@@ -153,8 +169,14 @@ bool copyPayload(NodeEvent& ev, IncomingMessageType type, const uint8_t* data, s
       copyPacket(ev.payload.snapshotAck, data);
       break;
     case IncomingMessageType::NODE_CONFIG:
-      if (len != sizeof(node_config_message_t)) return false;
-      copyPacket(ev.payload.nodeConfig, data);
+      // A 60/64/68-byte frame from an older mothership leaves the appended
+      // fields zero (aggregation / report-by-exception / urgent off).
+      if (len != sizeof(node_config_message_t) && len != NODE_CONFIG_RBE_SIZE &&
+          len != NODE_CONFIG_AGG_SIZE && len != NODE_CONFIG_LEGACY_SIZE) {
+        return false;
+      }
+      memset(&ev.payload.nodeConfig, 0, sizeof(ev.payload.nodeConfig));
+      memcpy(&ev.payload.nodeConfig, data, len);
       break;
     case IncomingMessageType::SYNC_SESSION:
       if (len != sizeof(sync_session_open_message_t)) return false;
@@ -168,6 +190,16 @@ bool copyPayload(NodeEvent& ev, IncomingMessageType type, const uint8_t* data, s
       if (len != sizeof(sync_release_message_t)) return false;
       copyPacket(ev.payload.syncRelease, data);
       break;
+    case IncomingMessageType::OTA_OFFER:
+      if (len != sizeof(fota_offer_message_t)) return false;
+      copyPacket(ev.payload.otaOffer, data);
+      break;
+    case IncomingMessageType::CLOCK_REPLY:
+      if (len != sizeof(clock_reply_message_t)) return false;
+      copyPacket(ev.payload.clockReply, data);
+      break;
+    case IncomingMessageType::OTA_CHUNK:
+    case IncomingMessageType::CONFIG_DIGEST:
     case IncomingMessageType::INVALID:
     default:
       return false;
@@ -188,6 +220,10 @@ bool initNodeEventQueue(size_t capacity) {
   return true;
 }
 
+void setNodeEventWaiter(TaskHandle_t task) {
+  g_waiter = task;
+}
+
 void resetNodeEventQueueForTest() {
   if (g_queue) {
     vQueueDelete(g_queue);
@@ -224,6 +260,7 @@ bool enqueueValidatedNodeEvent(const uint8_t senderMac[6],
   }
 
   ++g_counters.callbackEventsReceived;
+  if (g_waiter) xTaskNotifyGive(g_waiter);
   return true;
 }
 
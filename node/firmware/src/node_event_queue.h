@@ -20,7 +20,9 @@ enum class NodeEventType : uint8_t {
   NODE_CONFIG,
   SYNC_SESSION,
   DUMP_GRANT,
-  SYNC_RELEASE
+  SYNC_RELEASE,
+  OTA_OFFER,
+  CLOCK_REPLY
 };
 
 struct NodeEvent {
@@ -43,6 +45,8 @@ struct NodeEvent {
     sync_session_open_message_t syncSession;
     dump_grant_message_t dumpGrant;
     sync_release_message_t syncRelease;
+    fota_offer_message_t otaOffer;
+    clock_reply_message_t clockReply;
   } payload;
 };
 
@@ -53,6 +57,9 @@ struct NodeEventCounters {
 };
 
 bool initNodeEventQueue(size_t capacity = 12);
+// Task to wake (xTaskNotifyGive) whenever an event is queued, so the main loop
+// can block on its notification instead of polling. nullptr = no wake-up.
+void setNodeEventWaiter(TaskHandle_t task);
 void resetNodeEventQueueForTest();
 bool enqueueValidatedNodeEvent(const uint8_t senderMac[6],
                                IncomingMessageType type,
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+// Per-wake gust/turbulence statistics for the reed cup anemometer.
+//
+// Pure arithmetic — no Arduino, no ISR state — so the same kernel runs inside
+// reed_wind_backend::read() and in the native host test
+// (tests/test_reed_wind_stats.cpp) against synthetic pulse trains.
+//
+// The measurement window is cut into fixed sub-intervals ("buckets", 1 s by
+// default). Each completed bucket becomes one speed sample
+// (factor * pulses / bucketSeconds + offset), and every statistic is updated
+// incrementally as the bucket closes, so nothing is buffered beyond the last
+// three bucket counts:
+//
+//   * mean / standard deviation — Welford's online update over bucket speeds
+//     (sample SD, n-1; 0 when fewer than two buckets closed);
+//   * peak 3 s gust — the WMO definition: the highest running 3 s mean. With
+//     1 s buckets that is the best sum of three consecutive bucket counts. A
+//     window shorter than the gust span falls back to the mean of whatever
+//     buckets closed, rather than inventing a gust;
+//   * calm fraction — share of buckets whose speed is below calmThresholdMs.
+//
+// Pulses must be fed in non-decreasing time order. A trailing partial bucket is
+// discarded by finish(): its pulses still count toward the caller's whole-window
+// mean speed, but a partial bucket would bias both SD and gust low.
+
+struct ReedWindStats {
+  float    meanMs;        // mean of bucket speeds (m/s)
+  float    sdMs;          // sample SD of bucket speeds (m/s)
+  float    gustMs;        // peak running gustSpan-bucket mean (m/s)
+  float    calmFraction;  // 0..1 share of buckets below the calm threshold
+  uint16_t buckets;       // completed buckets the statistics cover
+  bool     valid;         // false until at least one bucket closed
+};
+
+class ReedWindAccumulator {
+public:
+  static constexpr uint8_t kGustSpan = 3;  // buckets in the gust average
+
+  void begin(uint32_t startMs, uint32_t bucketMs, float factor, float offset,
+             float calmThresholdMs) {
+    m_startMs    = startMs;
+    m_bucketMs   = bucketMs ? bucketMs : 1;
+    m_factor     = factor;
+    m_offset     = offset;
+    m_calmMs     = calmThresholdMs;
+    m_bucketIdx  = 0;
+    m_bucketPulses = 0;
+    m_n = 0;
+    m_mean = 0.0;
+    m_m2 = 0.0;
+    m_calmBuckets = 0;
+    m_bestGustPulses = 0;
+    for (uint8_t i = 0; i < kGustSpan; ++i) m_recent[i] = 0;
+  }
+
+  // One debounced reed closure at absolute time tMs (same clock as startMs).
+  // Pulses stamped before startMs are ignored.
+  void addPulse(uint32_t tMs) {
+    if ((int32_t)(tMs - m_startMs) < 0) return;
+    advanceTo(tMs);
+    ++m_bucketPulses;
+  }
+
+  // Close every bucket that ended at or before endMs.
+  void finish(uint32_t endMs) {
+    if ((int32_t)(endMs - m_startMs) < 0) return;
+    advanceTo(endMs);
+  }
+
+  ReedWindStats stats() const {
+    ReedWindStats s{};
+    s.buckets = (uint16_t)(m_n > 0xFFFF ? 0xFFFF : m_n);
+    s.valid   = m_n > 0;
+    if (!s.valid) return s;
+
+    s.meanMs = (float)m_mean;
+    s.sdMs   = (m_n > 1) ? (float)sqrt(m_m2 / (double)(m_n - 1)) : 0.0f;
+    s.calmFraction = (float)m_calmBuckets / (float)m_n;
+
+    if (m_n >= kGustSpan) {
+      s.gustMs = speedFor(m_bestGustPulses, kGustSpan);
+    } else {
+      // Not enough buckets for a full gust span; report the mean of those
+      // that closed (equal to the window mean, never above a real gust).
+      uint32_t sum = 0;
+      for (uint32_t i = 0; i < m_n; ++i) sum += m_recent[i];
+      s.gustMs = speedFor(sum, (uint8_t)m_n);
+    }
+    return s;
+  }
+
+private:
+  float speedFor(uint32_t pulses, uint8_t buckets) const {
+    if (pulses == 0 || buckets == 0) return 0.0f;  // calm stays exactly 0
+    const float seconds = (float)buckets * (float)m_bucketMs / 1000.0f;
+    return m_factor * ((float)pulses / seconds) + m_offset;
+  }
+
+  void advanceTo(uint32_t tMs) {
+    const uint32_t idx = (tMs - m_startMs) / m_bucketMs;
+    while (m_bucketIdx < idx) closeBucket();
+  }
+
+  void closeBucket() {
+    const uint32_t pulses = m_bucketPulses;
+    const double v = speedFor(pulses, 1);
+
+    ++m_n;
+    const double delta = v - m_mean;
+    m_mean += delta / (double)m_n;
+    m_m2   += delta * (v - m_mean);
+    if (v < m_calmMs) ++m_calmBuckets;
+
+    // Shift the gust window (oldest bucket falls out of the running sum).
+    for (uint8_t i = kGustSpan - 1; i > 0; --i) m_recent[i] = m_recent[i - 1];
+    m_recent[0] = pulses;
+    if (m_n >= kGustSpan) {
+      uint32_t sum = 0;
+      for (uint8_t i = 0; i < kGustSpan; ++i) sum += m_recent[i];
+      if (sum > m_bestGustPulses) m_bestGustPulses = sum;
+    }
+
+    m_bucketPulses = 0;
+    ++m_bucketIdx;
+  }
+
+  uint32_t m_startMs = 0;
+  uint32_t m_bucketMs = 1000;
+  float    m_factor = 0.0f;
+  float    m_offset = 0.0f;
+  float    m_calmMs = 0.0f;
+
+  uint32_t m_bucketIdx = 0;      // bucket currently accumulating
+  uint32_t m_bucketPulses = 0;   // pulses in that bucket so far
+
+  uint32_t m_n = 0;              // closed buckets
+  double   m_mean = 0.0;         // Welford running mean
+  double   m_m2 = 0.0;           // Welford sum of squared deviations
+  uint32_t m_calmBuckets = 0;
+  uint32_t m_recent[kGustSpan] = {};  // newest first
+  uint32_t m_bestGustPulses = 0;
+};
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Report-by-exception: send a channel only when it has moved.
+//
+// Pure arithmetic — no Arduino, no NVS — so captureSensorsToQueue() and the
+// native host test (tests/test_report_by_exception.cpp) run the same code.
+//
+// The node remembers the value it last SENT for every channel. On each wake a
+// reading is kept only when it differs from that value by more than the
+// channel's deadband; the sent value is then updated. A reading inside the
+// deadband is dropped from the snapshot and its reference is NOT moved, so a
+// slow drift still gets reported once it has accumulated past the deadband.
+//
+// Three outcomes per wake:
+//
+//   * Full     — every reading is sent and the reference set replaced. Taken on
+//                the first wake, whenever the last full snapshot is older than
+//                the maximum silence interval, and after the clock steps back;
+//   * Delta    — only the changed readings are sent. A channel that was sent
+//                before but produced no reading this wake is listed with a NaN
+//                value, so the receiver can tell "stopped reading" from
+//                "unchanged" and stops carrying it forward;
+//   * Suppress — nothing changed: no snapshot is queued at all.
+//
+// The state is a flat POD persisted byte-for-byte (RTC + NVS), like the
+// aggregation window in snapshot_aggregator.h.
+
+constexpr size_t   kRbeMaxChannels = 33;          // == MAX_READINGS_PER_SNAPSHOT
+constexpr uint32_t kRbeStateMagic  = 0x31454252u;  // "RBE1"
+
+enum class RbeDecision : uint8_t {
+  Full     = 0,
+  Delta    = 1,
+  Suppress = 2,
+};
+
+struct RbeChannel {
+  uint16_t sensorId;
+  uint16_t reserved;
+  float    value;     // last value sent for this channel
+};
+static_assert(sizeof(RbeChannel) == 8, "RbeChannel is persisted byte-for-byte");
+
+struct RbeState {
+  uint32_t   magic;
+  uint32_t   lastFullUnix;      // node time of the last Full snapshot
+  uint8_t    channelCount;
+  uint8_t    reserved[3];
+  RbeChannel ch[kRbeMaxChannels];
+  uint32_t   checksum;          // FNV-1a over every byte above
+};
+
+inline uint32_t rbeChecksum(const RbeState& s) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(&s);
+  const size_t n = offsetof(RbeState, checksum);
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < n; ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+inline void rbeReset(RbeState& s) {
+  s = RbeState{};
+  s.magic = kRbeStateMagic;
+}
+
+inline void rbeSeal(RbeState& s) { s.checksum = rbeChecksum(s); }
+
+inline bool rbeIsValid(const RbeState& s) {
+  return s.magic == kRbeStateMagic && s.channelCount <= kRbeMaxChannels &&
+         s.checksum == rbeChecksum(s);
+}
+
+inline RbeChannel* rbeFind(RbeState& s, uint16_t sensorId) {
+  for (uint8_t i = 0; i < s.channelCount; ++i) {
+    if (s.ch[i].sensorId == sensorId) return &s.ch[i];
+  }
+  return nullptr;
+}
+
+// True when the next wake must send everything.
+inline bool rbeHeartbeatDue(const RbeState& s, uint32_t nowUnix, uint32_t maxSilenceSec) {
+  return s.lastFullUnix == 0 || nowUnix < s.lastFullUnix ||
+         nowUnix - s.lastFullUnix >= maxSilenceSec;
+}
+
+// Filter one wake's readings in place. `r` has room for `cap` entries and holds
+// `count` on entry; on return `count` is the number to send. `deadbandOf(id)`
+// gives the channel's deadband in its own units: a negative value means the
+// channel is always sent (it never lets a snapshot be suppressed).
+template <typename Reading, typename DeadbandFn>
+inline RbeDecision rbeFilter(RbeState& s, uint32_t nowUnix, Reading* r,
+                             size_t& count, size_t cap,
+                             DeadbandFn deadbandOf, uint32_t maxSilenceSec) {
+  if (rbeHeartbeatDue(s, nowUnix, maxSilenceSec)) {
+    s.channelCount = 0;
+    for (size_t i = 0; i < count && s.channelCount < kRbeMaxChannels; ++i) {
+      if (isnan(r[i].value)) continue;
+      RbeChannel& c = s.ch[s.channelCount++];
+      c = RbeChannel{};
+      c.sensorId = r[i].sensorId;
+      c.value    = r[i].value;
+    }
+    s.lastFullUnix = nowUnix;
+    return RbeDecision::Full;
+  }
+
+  // Channels sent before but absent this wake: listed as NaN, then forgotten.
+  // Collected before the in-place compaction below overwrites `r`.
+  uint16_t gone[kRbeMaxChannels];
+  size_t goneCount = 0;
+  for (uint8_t i = 0; i < s.channelCount; ++i) {
+    bool seen = false;
+    for (size_t j = 0; j < count && !seen; ++j) {
+      seen = r[j].sensorId == s.ch[i].sensorId && !isnan(r[j].value);
+    }
+    if (!seen) gone[goneCount++] = s.ch[i].sensorId;
+  }
+
+  size_t kept = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const float v = r[i].value;
+    if (isnan(v)) continue;
+    RbeChannel* c = rbeFind(s, r[i].sensorId);
+    const float band = deadbandOf(r[i].sensorId);
+    bool send = true;
+    if (c && band >= 0.0f) send = fabsf(v - c->value) > band;
+    if (!send) continue;
+    if (!c && s.channelCount < kRbeMaxChannels) {
+      c = &s.ch[s.channelCount++];
+      *c = RbeChannel{};
+      c->sensorId = r[i].sensorId;
+    }
+    if (c) c->value = v;
+    r[kept++] = r[i];
+  }
+
+  for (size_t g = 0; g < goneCount; ++g) {
+    // No room for the marker: keep the channel so the next wake reports it.
+    if (kept >= cap) break;
+    r[kept].sensorId = gone[g];
+    r[kept].value    = NAN;
+    ++kept;
+    for (uint8_t i = 0; i < s.channelCount; ++i) {
+      if (s.ch[i].sensorId != gone[g]) continue;
+      s.ch[i] = s.ch[--s.channelCount];
+      break;
+    }
+  }
+
+  count = kept;
+  return kept == 0 ? RbeDecision::Suppress : RbeDecision::Delta;
+}
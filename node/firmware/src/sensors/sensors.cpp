@@ -327,5 +327,29 @@ size_t buildReadingsArray(v2_reading_t* out, size_t maxCount) {
     }
   }
 
+  // Reed anemometer gust / SD / calm fraction, from the window the WIND_SPEED
+  // read above just measured. Same all-or-none rule as the spectral metadata.
+  if (reed_wind_backend::statsAvailable()) {
+    const ReedWindStats ws = reed_wind_backend::getStats();
+    if ((maxCount - count) < WIND_STATS_READING_COUNT) {
+      Serial.printf("[SENS-WIND] no snapshot capacity: used=%u max=%u need=%u; stats omitted\n",
+                    static_cast<unsigned>(count), static_cast<unsigned>(maxCount),
+                    static_cast<unsigned>(WIND_STATS_READING_COUNT));
+    } else {
+      const struct { uint16_t id; float val; } extras[] = {
+        { SENSOR_ID_WIND_GUST,      ws.gustMs },
+        { SENSOR_ID_WIND_SPEED_SD,  ws.sdMs },
+        { SENSOR_ID_WIND_CALM_FRAC, ws.calmFraction },
+      };
+      for (const auto& e : extras) {
+        out[count].sensorId = e.id;
+        out[count].value    = e.val;
+        ++count;
+      }
+      Serial.printf("[SENS-WIND] appended ids=1203-1205 gust=%.2f sd=%.2f calm=%.2f\n",
+                    ws.gustMs, ws.sdMs, ws.calmFraction);
+    }
+  }
+
   return count;
 }
@@ -1,6 +1,7 @@
 #include <Arduino.h>
 
 #include "sensors_reed_wind.h"
+#include "reed_wind_stats.h"
 
 // ---------------------------------------------------------------------------
 // Configuration (overridable via build flags)
@@ -38,17 +39,54 @@
 #define REED_WIND_DEBOUNCE_MS 5    // reed bounce rejection window
 #endif
 
+#ifndef REED_WIND_BUCKET_MS
+#define REED_WIND_BUCKET_MS 1000   // statistics sub-interval; gust = 3 buckets
+#endif
+
+#ifndef REED_WIND_CALM_MS
+#define REED_WIND_CALM_MS 0.5f     // bucket speed below this counts as calm
+                                   // (under the WH-SP-WS01 ~0.5-0.8 m/s start)
+#endif
+
+#ifndef REED_WIND_RING_SIZE
+#define REED_WIND_RING_SIZE 64     // pulse timestamps buffered between drains;
+                                   // power of two. Drained every 50 ms, and the
+                                   // 5 ms debounce caps arrivals at 10 per drain
+#endif
+
+static_assert((REED_WIND_RING_SIZE & (REED_WIND_RING_SIZE - 1)) == 0,
+              "REED_WIND_RING_SIZE must be a power of two");
+
 namespace {
 
 volatile uint32_t g_edgeCount = 0;
 volatile unsigned long g_lastEdgeMs = 0;
 bool g_initialized = false;
 
+// Single-producer (ISR) / single-consumer (read loop) timestamp ring. The ISR
+// only ever advances g_ringHead and the reader only g_ringTail, so no lock is
+// needed; a full ring drops the timestamp (the edge is still counted for the
+// mean) and bumps g_ringDropped so the loss is visible in the log.
+volatile uint32_t g_ring[REED_WIND_RING_SIZE];
+volatile uint32_t g_ringHead = 0;
+volatile uint32_t g_ringTail = 0;
+volatile uint32_t g_ringDropped = 0;
+
+ReedWindAccumulator g_acc;
+ReedWindStats       g_stats{};
+
 void IRAM_ATTR onReedFalling() {
   unsigned long now = millis();
   if (now - g_lastEdgeMs >= REED_WIND_DEBOUNCE_MS) {
     g_lastEdgeMs = now;
     g_edgeCount++;
+    const uint32_t head = g_ringHead;
+    if (head - g_ringTail < REED_WIND_RING_SIZE) {
+      g_ring[head & (REED_WIND_RING_SIZE - 1)] = (uint32_t)now;
+      g_ringHead = head + 1;
+    } else {
+      g_ringDropped++;
+    }
   }
 }
 
@@ -56,9 +94,32 @@ void resetCount() {
   noInterrupts();
   g_edgeCount = 0;
   g_lastEdgeMs = 0;
+  g_ringHead = 0;
+  g_ringTail = 0;
+  g_ringDropped = 0;
   interrupts();
 }
 
+// Feed every buffered pulse timestamp into the statistics accumulator.
+void drainRing() {
+  uint32_t tail = g_ringTail;
+  const uint32_t head = g_ringHead;
+  while (tail != head) {
+    g_acc.addPulse(g_ring[tail & (REED_WIND_RING_SIZE - 1)]);
+    ++tail;
+  }
+  g_ringTail = tail;
+}
+
+// Wait out the window in 50 ms chunks (feeds the RTOS/idle watchdog) while
+// draining the ring, so statistics accrue incrementally during the wait.
+void waitDraining(uint32_t startMs, uint32_t windowMs) {
+  while (millis() - startMs < windowMs) {
+    delay(50);
+    drainRing();
+  }
+}
+
 uint32_t readCount() {
   noInterrupts();
   const uint32_t c = g_edgeCount;
@@ -95,29 +156,50 @@ const char* type(size_t index)  { return (index == 0) ? "WIND" : "UNKNOWN"; }
 bool read(size_t index, float& outValue) {
   if (index != 0 || !g_initialized) return false;
 
+  g_stats = ReedWindStats{};
   resetCount();
   const uint32_t startMs = millis();
+  g_acc.begin(startMs, REED_WIND_BUCKET_MS, REED_WIND_FACTOR, REED_WIND_OFFSET,
+              REED_WIND_CALM_MS);
 
-  // Probe: cheap first look. delay() is chunked so the RTOS/idle watchdog is fed.
-  while (millis() - startMs < (uint32_t)REED_WIND_PROBE_MS) delay(50);
+  // Probe: cheap first look.
+  waitDraining(startMs, (uint32_t)REED_WIND_PROBE_MS);
 
   if (readCount() < (uint32_t)REED_WIND_MIN_EDGES) {
-    // Calm, no anemometer wired, or a stray single glitch.
+    // Calm, no anemometer wired, or a stray single glitch. Report the
+    // statistics that match the 0 m/s mean rather than the stray pulse.
     outValue = 0.0f;
+    g_stats.buckets      = (uint16_t)(REED_WIND_PROBE_MS / REED_WIND_BUCKET_MS);
+    g_stats.calmFraction = 1.0f;
+    g_stats.valid        = true;
     return true;
   }
 
   // Rotation detected — extend to the full window for a stable frequency.
-  while (millis() - startMs < (uint32_t)REED_WIND_WINDOW_MS) delay(50);
+  // The statistics come from the same window; it is not lengthened for them.
+  waitDraining(startMs, (uint32_t)REED_WIND_WINDOW_MS);
+
+  const uint32_t endMs = millis();
+  drainRing();
+  g_acc.finish(endMs);
+  g_stats = g_acc.stats();
 
   const uint32_t edges = readCount();
-  const float elapsedS = (millis() - startMs) / 1000.0f;
+  const float elapsedS = (endMs - startMs) / 1000.0f;
   const float freqHz = (elapsedS > 0.0f) ? (edges / elapsedS) : 0.0f;
   outValue = REED_WIND_FACTOR * freqHz + REED_WIND_OFFSET;
 
   Serial.printf("[WIND] reed: %lu edges / %.2fs = %.2f Hz -> %.2f m/s\n",
                 (unsigned long)edges, elapsedS, freqHz, outValue);
+  Serial.printf("[WIND] reed stats: gust3s=%.2f sd=%.2f calm=%.2f buckets=%u "
+                "ring_dropped=%lu\n",
+                g_stats.gustMs, g_stats.sdMs, g_stats.calmFraction,
+                (unsigned)g_stats.buckets, (unsigned long)g_ringDropped);
   return true;
 }
 
+bool statsAvailable() { return g_initialized && g_stats.valid; }
+
+ReedWindStats getStats() { return g_stats; }
+
 }  // namespace reed_wind_backend
@@ -2,6 +2,8 @@
 
 #include <stddef.h>
 
+#include "reed_wind_stats.h"
+
 // Reed-switch cup anemometer backend (WH-SP-WS01) for the Node V2 sensor
 // registry. Speed-only (a cup anemometer has no direction).
 //
@@ -23,4 +25,12 @@ const char* label(size_t index);
 const char* type(size_t index);
 bool read(size_t index, float& outValue);
 
+// Gust (peak 3 s), SD and calm fraction from the window the last read() just
+// measured — the ISR timestamps each pulse into a ring that read() drains
+// incrementally. Like the spectral metadata these describe the one wind
+// measurement, so they ride the snapshot as extra readings rather than
+// registry slots. statsAvailable() is false until read() has run this wake.
+bool statsAvailable();
+ReedWindStats getStats();
+
 }  // namespace reed_wind_backend
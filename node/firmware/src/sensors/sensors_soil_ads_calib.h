@@ -14,6 +14,30 @@
 #define SOIL_ADC_INPUT_TO_SENSOR_VOLT_GAIN 1.0f
 #endif
 
+// Soil conversion data rate in SPS: 128, 250, 475 or 860. 128 SPS is the rate
+// the probes and the SH fits were characterised at. Faster rates shorten each
+// conversion but widen the ADS1115's digital filter, so every sample is
+// noisier; no field comparison against 128 SPS exists yet, so they are
+// opt-in, paired with a median batch, e.g.
+//   -D SOIL_ADS_SPS=860 -D SOIL_ADS_OVERSAMPLE_K=5   (~6.5 ms per channel)
+// and the [SOIL] spread= log is the noise figure to compare.
+#ifndef SOIL_ADS_SPS
+#define SOIL_ADS_SPS 128
+#endif
+
+// Batched acquisition: K single-shot conversions per channel, the median kept
+// (soil_adc_filter.h). K=1 is the historic single read. Must not exceed
+// kSoilAdcMaxBatch.
+#ifndef SOIL_ADS_OVERSAMPLE_K
+#define SOIL_ADS_OVERSAMPLE_K 1
+#endif
+
+// GPIO wired to the ADS1115 ALERT/RDY pin, or -1 for timed waits at the
+// configured data rate. Current node boards leave ALERT unconnected.
+#ifndef SOIL_ADS_RDY_PIN
+#define SOIL_ADS_RDY_PIN -1
+#endif
+
 // Moisture calibration is intentionally not performed on the node. Moisture
 // channels are emitted as sensor output volts so backend calibration can evolve
 // without reflashing field nodes.
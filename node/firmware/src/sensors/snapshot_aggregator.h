@@ -0,0 +1,219 @@
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// On-node statistical aggregation: fold N wake samples into one summary.
+//
+// Pure arithmetic — no Arduino, no NVS — so captureSensorsToQueue() and the
+// native host test (tests/test_snapshot_aggregator.cpp) run the same code.
+//
+// In aggregation mode the node still wakes at its (fast) wake interval, but
+// instead of queueing one snapshot per wake it folds each wake's readings into
+// a running per-channel state and queues ONE summary snapshot every
+// samplesPerReport wakes. The state is a flat POD so it can sit in RTC memory
+// and be mirrored to NVS on power-gated boards, where RTC memory does not
+// survive the PWR_HOLD cut between wakes (aggPersistedSize() bytes: only the
+// channels in use).
+//
+// Per channel the kernel keeps count / min / max and a Welford mean + M2 in
+// float. How a channel is summarised depends on its kind:
+//
+//   * Linear   — mean under the base id, plus min / max / sample SD (n-1; 0
+//                for a single sample) as separate aggregate readings;
+//   * MeanOnly — mean only (housekeeping such as spectral gain, or a channel
+//                the operator left out of the stats mask);
+//   * Peak     — the window maximum under the base id (gust, saturation flag:
+//                averaging them would hide exactly the event they report);
+//   * Circular — vector mean of an angle in degrees (wind direction), so
+//                350° and 10° average to 0°, not 180°.
+//
+// NaN values are skipped; a channel that never produced a finite value is
+// simply absent from the summary, exactly as a failed read is absent from a
+// normal snapshot.
+
+enum class AggKind : uint8_t {
+  Linear   = 0,
+  MeanOnly = 1,
+  Peak     = 2,
+  Circular = 3,
+};
+
+// Aggregate statistic selector for the caller's id mapping. Values match the
+// SENSOR_AGG_STAT_* multipliers in protocol.h (aggregate id = stat * 10000 +
+// base id).
+enum class AggStat : uint8_t {
+  Min = 1,
+  Max = 2,
+  Sd  = 3,
+};
+
+constexpr size_t   kAggMaxChannels = 33;          // == MAX_READINGS_PER_SNAPSHOT
+constexpr uint32_t kAggStateMagic  = 0x31474741u;  // "AGG1"
+
+struct AggChannel {
+  uint16_t sensorId;
+  uint8_t  kind;      // AggKind
+  uint8_t  reserved;
+  uint32_t n;         // finite samples folded in
+  float    min;
+  float    max;
+  float    mean;      // Welford mean; Circular: sum of sin
+  float    m2;        // Welford M2;   Circular: sum of cos
+};
+static_assert(sizeof(AggChannel) == 24, "AggChannel is persisted byte-for-byte");
+
+struct AggState {
+  uint32_t   magic;
+  uint16_t   samples;           // wakes folded into this window
+  uint8_t    samplesPerReport;  // N the window was opened with
+  uint8_t    channelCount;
+  uint32_t   windowStartUnix;   // first wake in the window
+  uint32_t   lastSampleUnix;    // most recent wake in the window
+  AggChannel ch[kAggMaxChannels];
+  uint32_t   checksum;          // FNV-1a over every byte above
+};
+
+inline uint32_t aggChecksum(const AggState& s) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(&s);
+  const size_t n = offsetof(AggState, checksum);
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < n; ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+inline void aggReset(AggState& s, uint8_t samplesPerReport) {
+  s = AggState{};
+  s.magic = kAggStateMagic;
+  s.samplesPerReport = samplesPerReport;
+}
+
+inline void aggSeal(AggState& s) { s.checksum = aggChecksum(s); }
+
+// Bytes of `s` that carry state: the header and the channels in use. Channel
+// slots past channelCount are always zero (aggReset() clears them and channels
+// are only appended), so a copy of this prefix plus the checksum rebuilds the
+// whole struct.
+constexpr size_t kAggHeaderBytes = offsetof(AggState, ch);
+inline size_t aggPersistedSize(const AggState& s) {
+  return kAggHeaderBytes + (size_t)s.channelCount * sizeof(AggChannel);
+}
+
+// True when `s` is an intact window (e.g. just read back from RTC or NVS).
+inline bool aggIsValid(const AggState& s) {
+  return s.magic == kAggStateMagic && s.channelCount <= kAggMaxChannels &&
+         s.checksum == aggChecksum(s);
+}
+
+inline void aggAddValue(AggState& s, uint16_t sensorId, float v, AggKind kind) {
+  if (isnan(v)) return;
+  AggChannel* c = nullptr;
+  for (uint8_t i = 0; i < s.channelCount; ++i) {
+    if (s.ch[i].sensorId == sensorId) { c = &s.ch[i]; break; }
+  }
+  if (!c) {
+    if (s.channelCount >= kAggMaxChannels) return;
+    c = &s.ch[s.channelCount++];
+    *c = AggChannel{};
+    c->sensorId = sensorId;
+    c->kind = (uint8_t)kind;
+    c->min = v;
+    c->max = v;
+  }
+  ++c->n;
+  if (v < c->min) c->min = v;
+  if (v > c->max) c->max = v;
+  if (c->kind == (uint8_t)AggKind::Circular) {
+    const float rad = v * (float)(M_PI / 180.0);
+    c->mean += sinf(rad);
+    c->m2   += cosf(rad);
+    return;
+  }
+  const float d = v - c->mean;
+  c->mean += d / (float)c->n;
+  c->m2   += d * (v - c->mean);
+}
+
+// Fold one wake's readings into the window. `Reading` is any type with
+// `sensorId` and `value` members (v2_reading_t on the node); `kindOf(id)`
+// classifies each channel the first time it is seen.
+template <typename Reading, typename KindFn>
+inline void aggAddSample(AggState& s, uint32_t nowUnix, const Reading* r,
+                         size_t count, KindFn kindOf) {
+  if (s.samples == 0) s.windowStartUnix = nowUnix;
+  for (size_t i = 0; i < count; ++i) {
+    aggAddValue(s, r[i].sensorId, r[i].value, kindOf(r[i].sensorId));
+  }
+  if (s.samples < 0xFFFF) ++s.samples;
+  s.lastSampleUnix = nowUnix;
+}
+
+inline bool aggWindowComplete(const AggState& s) {
+  return s.samplesPerReport > 0 && s.samples >= s.samplesPerReport;
+}
+
+inline float aggSd(const AggChannel& c) {
+  return c.n > 1 ? sqrtf(c.m2 / (float)(c.n - 1)) : 0.0f;
+}
+
+// Summary value published under the channel's base id.
+inline float aggHeadline(const AggChannel& c) {
+  switch ((AggKind)c.kind) {
+    case AggKind::Peak:
+      return c.max;
+    case AggKind::Circular: {
+      if (c.mean == 0.0f && c.m2 == 0.0f) return c.min;  // degenerate: all cancel
+      float deg = atan2f(c.mean, c.m2) * (float)(180.0 / M_PI);
+      if (deg < 0.0f) deg += 360.0f;
+      return deg;
+    }
+    case AggKind::Linear:
+    case AggKind::MeanOnly:
+    default:
+      return c.mean;
+  }
+}
+
+// Write the summary readings into `out` (capacity `cap`) and return how many
+// were written. Order is fixed so a short buffer degrades predictably:
+//
+//   1. one headline value per channel under its base id (what every existing
+//      consumer already reads);
+//   2. the window's sample count under `samplesId`;
+//   3. min / max / SD triples for Linear channels, in channel order, while a
+//      whole triple still fits — a channel never reports a partial set.
+//
+// `statId(baseId, AggStat)` maps to the wire id of an aggregate reading.
+// `statsDropped`, when given, receives the number of Linear channels whose
+// triple did not fit, so the caller can flag the summary as partial.
+template <typename Reading, typename StatIdFn>
+inline size_t aggEmit(const AggState& s, Reading* out, size_t cap,
+                      uint16_t samplesId, StatIdFn statId,
+                      size_t* statsDropped = nullptr) {
+  size_t n = 0;
+  for (uint8_t i = 0; i < s.channelCount && n < cap; ++i) {
+    out[n].sensorId = s.ch[i].sensorId;
+    out[n].value    = aggHeadline(s.ch[i]);
+    ++n;
+  }
+  if (n < cap) {
+    out[n].sensorId = samplesId;
+    out[n].value    = (float)s.samples;
+    ++n;
+  }
+  size_t dropped = 0;
+  for (uint8_t i = 0; i < s.channelCount; ++i) {
+    const AggChannel& c = s.ch[i];
+    if (c.kind != (uint8_t)AggKind::Linear) continue;
+    if (n + 3 > cap) { ++dropped; continue; }
+    out[n].sensorId = statId(c.sensorId, AggStat::Min); out[n].value = c.min;    ++n;
+    out[n].sensorId = statId(c.sensorId, AggStat::Max); out[n].value = c.max;    ++n;
+    out[n].sensorId = statId(c.sensorId, AggStat::Sd);  out[n].value = aggSd(c); ++n;
+  }
+  if (statsDropped) *statsDropped = dropped;
+  return n;
+}
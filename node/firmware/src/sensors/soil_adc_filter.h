@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Soil ADC batch filtering and fixed-point thermistor conversion.
+//
+// Pure integer arithmetic — no Arduino, no Wire — so the soil backend and the
+// native host test (tests/test_soil_adc_filter.cpp) run the exact same code.
+//
+// The batched ADS1115 path takes K back-to-back conversions per channel and
+// keeps the median: one I2C glitch, EMI spike or mux-settling sample cannot
+// move the result, which a mean of K would let through. K is small (<= 15), so
+// an insertion sort on a stack copy is cheaper than anything cleverer.
+
+constexpr size_t kSoilAdcMaxBatch = 15;
+
+// Median of `n` raw ADC codes (n clamped to kSoilAdcMaxBatch). For even n the
+// lower-middle sample is returned so the result is always a real conversion,
+// never an average that no sample produced. Returns 0 for n == 0.
+inline int16_t soilAdcMedian(const int16_t* samples, size_t n) {
+  if (!samples || n == 0) return 0;
+  if (n > kSoilAdcMaxBatch) n = kSoilAdcMaxBatch;
+  int16_t v[kSoilAdcMaxBatch];
+  for (size_t i = 0; i < n; ++i) {
+    const int16_t x = samples[i];
+    size_t j = i;
+    while (j > 0 && v[j - 1] > x) { v[j] = v[j - 1]; --j; }
+    v[j] = x;
+  }
+  return v[(n - 1) / 2];
+}
+
+// Spread (max - min) of the batch in raw codes: a cheap noise/outlier witness
+// for the log line, so a field node's ADC health is visible without a scope.
+inline uint16_t soilAdcSpread(const int16_t* samples, size_t n) {
+  if (!samples || n == 0) return 0;
+  int16_t lo = samples[0], hi = samples[0];
+  for (size_t i = 1; i < n; ++i) {
+    if (samples[i] < lo) lo = samples[i];
+    if (samples[i] > hi) hi = samples[i];
+  }
+  return (uint16_t)(hi - lo);
+}
+
+// ADS1115 code -> microvolts at the ADC input for a full-scale range given in
+// millivolts (4096 for the node's PGA=±4.096 V setting).
+inline int32_t soilAdcRawToUv(int16_t raw, int32_t fsrMv) {
+  return (int32_t)(((int64_t)raw * fsrMv * 1000) / 32768);
+}
+
+// ---------------------------------------------------------------------------
+// Fixed-point Steinhart–Hart
+// ---------------------------------------------------------------------------
+// 1/T = A + B·ln(R) + C·ln(R)^3. Coefficients are carried in Q40 (C ~ 1e-6
+// still has ~21 significant bits), ln(R) in Q24. Every product fits int64 for
+// R up to 2^27 Ω, and the result is returned in centi-degrees C.
+
+struct SoilShFixed {
+  int64_t aQ40;
+  int64_t bQ40;
+  int64_t cQ40;
+};
+
+// Coefficient conversion happens once at build/init time, so floating point
+// is fine here; the per-sample path below is integer-only.
+constexpr int64_t soilShToQ40(double c) {
+  return (int64_t)(c * 1099511627776.0 + (c >= 0 ? 0.5 : -0.5));
+}
+
+constexpr SoilShFixed soilShMakeFixed(double a, double b, double c) {
+  return SoilShFixed{soilShToQ40(a), soilShToQ40(b), soilShToQ40(c)};
+}
+
+// ln(x) for x >= 1 in Q24. Integer part via the bit length, fraction via the
+// classic square-and-compare log2 on a Q30 mantissa, then scaled by ln 2.
+inline int32_t soilLnQ24(uint32_t x) {
+  if (x <= 1) return 0;
+  int e = 31;
+  while (!(x & (1u << e))) --e;
+  // Mantissa in [1, 2) as Q30.
+  uint64_t m = (e >= 30) ? ((uint64_t)x >> (e - 30)) : ((uint64_t)x << (30 - e));
+  uint32_t frac = 0;  // log2 fraction, Q24
+  for (int bit = 23; bit >= 0; --bit) {
+    m = (m * m) >> 30;
+    if (m >= (2ull << 30)) {
+      m >>= 1;
+      frac |= (1u << bit);
+    }
+  }
+  const int64_t log2Q24 = ((int64_t)e << 24) + frac;
+  constexpr int64_t kLn2Q24 = 11629080;  // ln(2) * 2^24
+  return (int32_t)((log2Q24 * kLn2Q24) >> 24);
+}
+
+// Thermistor resistance from a divider node voltage: NTC on the low side,
+// r_fixed to the supply. Mirrors the float r_from_vnode() clamps (1 mV from
+// either rail) so a floating input cannot divide by zero. Returned in Q4 ohms
+// (1/16 Ω): whole ohms alone cost ~0.03 °C at the hot end of the curve, where
+// the thermistor is only a kilohm or two.
+constexpr int kSoilOhmFracBits = 4;
+
+inline uint32_t soilDividerOhmsQ4(int32_t vnodeUv, int32_t vsupUv, uint32_t rFixedOhm) {
+  if (vnodeUv < 1000) vnodeUv = 1000;
+  if (vnodeUv > vsupUv - 1000) vnodeUv = vsupUv - 1000;
+  const int64_t num = ((int64_t)rFixedOhm * (vsupUv - vnodeUv)) << kSoilOhmFracBits;
+  const int64_t r = (num + vnodeUv / 2) / vnodeUv;
+  return r > 0x7FFFFFFF ? 0x7FFFFFFFu : (uint32_t)r;
+}
+
+// Steinhart–Hart temperature in centi-degrees C from a Q4 resistance.
+// Returns INT32_MIN when the coefficients give a non-positive 1/T (a
+// resistance outside the fit).
+inline int32_t soilShCentiC(uint32_t rOhmQ4, const SoilShFixed& k) {
+  constexpr int64_t kLn16Q24 = 46516320;  // ln(2^kSoilOhmFracBits) * 2^24
+  const int64_t L  = (int64_t)soilLnQ24(rOhmQ4) - kLn16Q24;  // Q24, ln(ohms)
+  const int64_t L3 = (((L * L) >> 24) * L) >> 24;     // Q24
+  const int64_t invT = k.aQ40 + ((k.bQ40 * L) >> 24) + ((k.cQ40 * L3) >> 24);  // Q40
+  if (invT <= 0) return INT32_MIN;
+  const int64_t centiK = ((100ll << 40) + invT / 2) / invT;  // rounded
+  return (int32_t)(centiK - 27315);
+}
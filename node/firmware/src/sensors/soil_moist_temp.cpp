@@ -6,6 +6,7 @@
 #include "soil_moist_temp.h"
 #include "../drivers/ads1115_helper.h"
 #include "sensors_soil_ads_calib.h"
+#include "soil_adc_filter.h"
 
 // Use the same I2C bus as RTC / rest of sensors.
 extern TwoWire WireRtc;
@@ -20,19 +21,28 @@ constexpr uint8_t CH_SOIL2_TEMP  = 3;
 // One global ADS instance on the root I2C bus.
 static ADS1115 ads(WireRtc);
 
-// Legacy thermistor divider + Steinhart-Hart from older probe setup.
-constexpr float V_DIV_SUPPLY = 4.910f;
-constexpr float R_FIXED_A0   = 9880.0f;  // A0 -> soil1 NTC
-constexpr float R_FIXED_A3   = 9970.0f;  // A3 -> soil2 NTC
+static_assert(SOIL_ADS_OVERSAMPLE_K >= 1 && SOIL_ADS_OVERSAMPLE_K <= kSoilAdcMaxBatch,
+              "SOIL_ADS_OVERSAMPLE_K must be 1..kSoilAdcMaxBatch");
+static_assert(SOIL_ADS_SPS == 128 || SOIL_ADS_SPS == 250 || SOIL_ADS_SPS == 475 ||
+              SOIL_ADS_SPS == 860, "SOIL_ADS_SPS must be 128, 250, 475 or 860");
+
+constexpr uint16_t ADS_DATA_RATE =
+    SOIL_ADS_SPS == 860 ? ADS1115::DR_860SPS :
+    SOIL_ADS_SPS == 475 ? ADS1115::DR_475SPS :
+    SOIL_ADS_SPS == 250 ? ADS1115::DR_250SPS : ADS1115::DR_128SPS;
+
+// ADS1115 full-scale range at the driver's PGA setting, in mV.
+constexpr int32_t ADS_FSR_MV = 4096;
 
-// Fallback SH coefficients from fit on prior logs.
-constexpr float A0_A = -0.0036485006f;
-constexpr float A0_B =  0.00096359095f;
-constexpr float A0_C = -2.4188805e-06f;
+// Legacy thermistor divider + Steinhart-Hart from older probe setup.
+// Integer units so the conversion runs in soil_adc_filter.h fixed point.
+constexpr int32_t  V_DIV_SUPPLY_UV = 4910000;
+constexpr uint32_t R_FIXED_A0      = 9880;  // A0 -> soil1 NTC
+constexpr uint32_t R_FIXED_A3      = 9970;  // A3 -> soil2 NTC
 
-constexpr float A3_A = -0.0047102991f;
-constexpr float A3_B =  0.00112009362f;
-constexpr float A3_C = -2.9164770e-06f;
+// Fallback SH coefficients from fit on prior logs (Q40 at compile time).
+constexpr SoilShFixed SH_A0 = soilShMakeFixed(-0.0036485006, 0.00096359095, -2.4188805e-06);
+constexpr SoilShFixed SH_A3 = soilShMakeFixed(-0.0047102991, 0.00112009362, -2.9164770e-06);
 
 constexpr float A0_TRIM_GAIN = 1.000f;
 constexpr float A0_TRIM_OFF  = 0.0f;
@@ -48,18 +58,24 @@ float    lastMoist2V   = NAN;  // SOIL2_VWC legacy channel: sensor volts
 float    lastTemp1C    = NAN;  // SOIL1_TEMP
 float    lastTemp2C    = NAN;  // SOIL2_TEMP
 
-float r_from_vnode(float vnode_v, float vsup_v, float r_fixed_ohm) {
-  float v = vnode_v;
-  if (v < 0.001f) v = 0.001f;
-  if (v > vsup_v - 0.001f) v = vsup_v - 0.001f;
-  return r_fixed_ohm * ((vsup_v - v) / v);
+#if !SOIL_CWT_THA_MODE
+float legacy_temp_c(int16_t raw, uint32_t rFixedOhm, const SoilShFixed& sh) {
+  const int32_t  vnodeUv = soilAdcRawToUv(raw, ADS_FSR_MV);
+  const uint32_t rQ4     = soilDividerOhmsQ4(vnodeUv, V_DIV_SUPPLY_UV, rFixedOhm);
+  const int32_t  centiC  = soilShCentiC(rQ4, sh);
+  return (centiC == INT32_MIN) ? NAN : centiC / 100.0f;
 }
+#endif
 
-float sh_temp_c(float R_ohm, float A, float B, float C) {
-  float lnR  = logf(R_ohm);
-  float invT = A + B * lnR + C * lnR * lnR * lnR;
-  float T    = 1.0f / invT;
-  return T - 273.15f;
+// K conversions of one channel, median kept. `spreadOut` is max-min of the
+// batch in raw codes, logged so ADC noise on a field node is visible.
+bool readChannelFiltered(uint8_t ch, int16_t& rawOut, float& mvOut, uint16_t& spreadOut) {
+  int16_t batch[SOIL_ADS_OVERSAMPLE_K];
+  if (!ads.readChannelBatchRaw(ch, batch, SOIL_ADS_OVERSAMPLE_K, ADS_DATA_RATE)) return false;
+  rawOut    = soilAdcMedian(batch, SOIL_ADS_OVERSAMPLE_K);
+  spreadOut = soilAdcSpread(batch, SOIL_ADS_OVERSAMPLE_K);
+  mvOut     = ads.rawToMv(rawOut);
+  return true;
 }
 
 void sampleAdsIfNeeded() {
@@ -77,13 +93,16 @@ void sampleAdsIfNeeded() {
     return;
   }
 
-  int16_t raw0, raw1, raw2, raw3;
-  float   mv0,  mv1,  mv2,  mv3;
+  int16_t  raw0, raw1, raw2, raw3;
+  float    mv0,  mv1,  mv2,  mv3;
+  uint16_t sp0,  sp1,  sp2,  sp3;
 
-  bool ok0 = ads.readChannelMv(CH_SOIL1_TEMP,  raw0, mv0);  // SOIL1 temperature
-  bool ok1 = ads.readChannelMv(CH_SOIL1_MOIST, raw1, mv1);  // SOIL1 moisture voltage
-  bool ok2 = ads.readChannelMv(CH_SOIL2_MOIST, raw2, mv2);  // SOIL2 moisture voltage
-  bool ok3 = ads.readChannelMv(CH_SOIL2_TEMP,  raw3, mv3);  // SOIL2 temperature
+  const uint32_t acqStartMs = millis();
+  bool ok0 = readChannelFiltered(CH_SOIL1_TEMP,  raw0, mv0, sp0);  // SOIL1 temperature
+  bool ok1 = readChannelFiltered(CH_SOIL1_MOIST, raw1, mv1, sp1);  // SOIL1 moisture voltage
+  bool ok2 = readChannelFiltered(CH_SOIL2_MOIST, raw2, mv2, sp2);  // SOIL2 moisture voltage
+  bool ok3 = readChannelFiltered(CH_SOIL2_TEMP,  raw3, mv3, sp3);  // SOIL2 temperature
+  const uint32_t acqMs = millis() - acqStartMs;
 
   if (!ok0 || !ok1 || !ok2 || !ok3) {
     Serial.println(F("[SOIL] ADS1115 read failed on one or more channels"));
@@ -139,24 +158,24 @@ void sampleAdsIfNeeded() {
     lastMoist2V = NAN;
   }
 #else
-  // Legacy thermistor model.
-  float r0 = r_from_vnode(mv0 / 1000.0f, V_DIV_SUPPLY, R_FIXED_A0);
-  float t0 = sh_temp_c(r0, A0_A, A0_B, A0_C);
+  // Legacy thermistor model, integer divider + Steinhart-Hart.
+  float t0 = legacy_temp_c(raw0, R_FIXED_A0, SH_A0);
   lastTemp1C = A0_TRIM_GAIN * t0 + A0_TRIM_OFF;
 
-  float r3 = r_from_vnode(mv3 / 1000.0f, V_DIV_SUPPLY, R_FIXED_A3);
-  float t3 = sh_temp_c(r3, A3_A, A3_B, A3_C);
+  float t3 = legacy_temp_c(raw3, R_FIXED_A3, SH_A3);
   lastTemp2C = A3_TRIM_GAIN * t3 + A3_TRIM_OFF;
 #endif
 
-  Serial.printf("[SOIL] ch0 raw=%d mv=%.1f sensorV=%.4fV -> Tsoil1=%.2f C\n",
-                raw0, mv0, v0, lastTemp1C);
-  Serial.printf("[SOIL] ch1 raw=%d mv=%.1f sensorV=%.4fV -> soil1_voltage=%.4fV\n",
-                raw1, mv1, v1, lastMoist1V);
-  Serial.printf("[SOIL] ch2 raw=%d mv=%.1f sensorV=%.4fV -> soil2_voltage=%.4fV\n",
-                raw2, mv2, v2, lastMoist2V);
-  Serial.printf("[SOIL] ch3 raw=%d mv=%.1f sensorV=%.4fV -> Tsoil2=%.2f C\n",
-                raw3, mv3, v3, lastTemp2C);
+  Serial.printf("[SOIL] ch0 raw=%d spread=%u mv=%.1f sensorV=%.4fV -> Tsoil1=%.2f C\n",
+                raw0, sp0, mv0, v0, lastTemp1C);
+  Serial.printf("[SOIL] ch1 raw=%d spread=%u mv=%.1f sensorV=%.4fV -> soil1_voltage=%.4fV\n",
+                raw1, sp1, mv1, v1, lastMoist1V);
+  Serial.printf("[SOIL] ch2 raw=%d spread=%u mv=%.1f sensorV=%.4fV -> soil2_voltage=%.4fV\n",
+                raw2, sp2, mv2, v2, lastMoist2V);
+  Serial.printf("[SOIL] ch3 raw=%d spread=%u mv=%.1f sensorV=%.4fV -> Tsoil2=%.2f C\n",
+                raw3, sp3, mv3, v3, lastTemp2C);
+  Serial.printf("[SOIL] acquisition K=%d @%d SPS x4 ch in %lu ms\n",
+                SOIL_ADS_OVERSAMPLE_K, SOIL_ADS_SPS, (unsigned long)acqMs);
 
   haveSample   = true;
   lastSampleMs = now;
@@ -168,6 +187,7 @@ namespace soil_moist_temp_backend {
 
 bool init() {
   Serial.println(F("[SOIL] soil_moist_temp_backend::init() - probing ADS1115 on WireRtc"));
+  ads.setReadyPin(SOIL_ADS_RDY_PIN);
   if (!ads.begin()) {
     Serial.println(F("[SOIL] ADS1115 not found at 0x48 on WireRtc"));
     return false;
@@ -0,0 +1,77 @@
+#include "agg_state_store.h"
+
+#include <Preferences.h>
+#include <string.h>
+
+namespace {
+
+static constexpr const char* kNamespace = "node_agg";
+static constexpr const char* kStateKey = "state";
+
+RTC_DATA_ATTR AggState g_rtcState;
+
+// NVS record: aggPersistedSize() bytes of the state, then its checksum. A
+// window with few channels costs a fraction of the full 816-byte struct on
+// every wake.
+uint8_t g_nvsBuf[sizeof(AggState)];
+
+bool loadNvs(AggState& out) {
+  Preferences p;
+  if (!p.begin(kNamespace, true)) return false;
+  bool ok = false;
+  const size_t len = p.getBytesLength(kStateKey);
+  if (len >= kAggHeaderBytes + sizeof(uint32_t) && len <= sizeof(g_nvsBuf) &&
+      p.getBytes(kStateKey, g_nvsBuf, len) == len) {
+    const size_t body = len - sizeof(uint32_t);
+    out = AggState{};
+    memcpy(&out, g_nvsBuf, body);
+    memcpy(&out.checksum, g_nvsBuf + body, sizeof(uint32_t));
+    ok = aggIsValid(out) && aggPersistedSize(out) == body;
+  }
+  p.end();
+  return ok;
+}
+
+}  // namespace
+
+namespace agg_state_store {
+
+bool load(AggState& out, uint8_t samplesPerReport) {
+  if (aggIsValid(g_rtcState)) {
+    memcpy(&out, &g_rtcState, sizeof(out));
+    return true;
+  }
+  if (loadNvs(out)) {
+    memcpy(&g_rtcState, &out, sizeof(out));
+    return true;
+  }
+  aggReset(out, samplesPerReport);
+  return false;
+}
+
+bool save(AggState& state, bool mirrorToNvs) {
+  aggSeal(state);
+  memcpy(&g_rtcState, &state, sizeof(state));
+  if (!mirrorToNvs) return true;
+
+  const size_t body = aggPersistedSize(state);
+  memcpy(g_nvsBuf, &state, body);
+  memcpy(g_nvsBuf + body, &state.checksum, sizeof(uint32_t));
+  const size_t len = body + sizeof(uint32_t);
+
+  Preferences p;
+  if (!p.begin(kNamespace, false)) return false;
+  const size_t written = p.putBytes(kStateKey, g_nvsBuf, len);
+  p.end();
+  return written == len;
+}
+
+void clear() {
+  memset(&g_rtcState, 0, sizeof(g_rtcState));
+  Preferences p;
+  if (!p.begin(kNamespace, false)) return;
+  p.remove(kStateKey);
+  p.end();
+}
+
+}  // namespace agg_state_store
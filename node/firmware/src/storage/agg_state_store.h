@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../sensors/snapshot_aggregator.h"
+
+namespace agg_state_store {
+
+// Persistence for the aggregation-mode running window (snapshot_aggregator.h).
+//
+// The working copy lives in RTC memory, which survives deep sleep. Boards that
+// power-gate through PWR_HOLD lose RTC memory at every wake, so there the
+// caller also mirrors each update to NVS — only the header and the channels in
+// use, 16 + 24 per channel + 4 bytes; load() prefers an intact RTC copy and
+// falls back to NVS. Both copies are checksummed — a torn or stale window
+// reads back as "no window" and the next wake simply starts a fresh one.
+
+// Load the open window into `out`. Returns false (and leaves `out` reset to
+// `samplesPerReport`) when neither copy is intact.
+bool load(AggState& out, uint8_t samplesPerReport);
+
+// Seal and store `state`. The NVS mirror is written only when `mirrorToNvs`.
+bool save(AggState& state, bool mirrorToNvs);
+
+// Discard any open window (unpair, new deployment, aggregation turned off).
+void clear();
+
+}  // namespace agg_state_store
@@ -0,0 +1,57 @@
+#include "fota_state_store.h"
+
+#include <Preferences.h>
+#include <string.h>
+
+namespace {
+
+static constexpr const char* kNamespace = "node_fota";
+static constexpr const char* kStateKey = "state";
+static constexpr const char* kInstalledSeqKey = "instSeq";
+
+}  // namespace
+
+namespace fota_state_store {
+
+bool load(FotaRxState& out) {
+  Preferences p;
+  bool ok = false;
+  if (p.begin(kNamespace, true)) {
+    if (p.getBytesLength(kStateKey) == sizeof(out)) {
+      ok = p.getBytes(kStateKey, &out, sizeof(out)) == sizeof(out) && fotaRxIsValid(out);
+    }
+    p.end();
+  }
+  if (!ok) fotaRxReset(out);
+  return ok;
+}
+
+bool save(FotaRxState& state) {
+  fotaRxSeal(state);
+  Preferences p;
+  if (!p.begin(kNamespace, false)) return false;
+  const size_t written = p.putBytes(kStateKey, &state, sizeof(state));
+  p.end();
+  return written == sizeof(state);
+}
+
+uint32_t loadInstalledSequence() {
+  Preferences p;
+  if (!p.begin(kNamespace, true)) return 0;
+  const uint32_t seq = p.getULong(kInstalledSeqKey, 0);
+  p.end();
+  return seq;
+}
+
+bool saveInstalledSequence(uint32_t sequence) {
+  Preferences p;
+  if (!p.begin(kNamespace, false)) return false;
+  bool ok = true;
+  if (sequence > p.getULong(kInstalledSeqKey, 0)) {
+    ok = p.putULong(kInstalledSeqKey, sequence) == sizeof(uint32_t);
+  }
+  p.end();
+  return ok;
+}
+
+}  // namespace fota_state_store
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+#include "fleet_ota.h"
+
+namespace fota_state_store {
+
+// Persistence for the fleet OTA receiver (fleet_ota.h FotaRxState): which
+// image is being collected, its received-chunk and erased-sector bitmaps, and
+// whether an armed/installed/failed outcome still has to be reported.
+//
+// NVS only. The state must outlive the power cut at the end of every wake and
+// the reboot into a freshly armed image, neither of which RTC memory survives.
+// A missing or corrupt copy reads back idle: the next OTA_OFFER restarts the
+// download from chunk 0, which is slow but always correct (every sector is
+// erased again before its first write). Progress is keyed by the image's
+// SHA-256, not by the mothership, so it deliberately survives re-pairing.
+
+// Load into `out`. Returns false (and leaves `out` reset) when no intact copy exists.
+bool load(FotaRxState& out);
+
+// Seal and store `state`.
+bool save(FotaRxState& state);
+
+// Release sequence of the fleet image this node last confirmed running (0 when
+// none: factory or cable-flashed firmware). Kept apart from the receiver state,
+// which every new download resets. Offers older than it are declined.
+uint32_t loadInstalledSequence();
+
+// Record a newly confirmed image. Never moves the stored sequence backwards.
+bool saveInstalledSequence(uint32_t sequence);
+
+}  // namespace fota_state_store
@@ -9,6 +9,14 @@ static constexpr const char* kNamespace = "node_cfg";
 static constexpr const char* kSlotA = "node_cfg_a";
 static constexpr const char* kSlotB = "node_cfg_b";
 static constexpr const char* kDeploymentEpochKey = "depEpoch";
+static constexpr const char* kAggSamplesKey = "aggN";
+static constexpr const char* kAggStatsMaskKey = "aggMask";
+static constexpr const char* kRbeSilenceKey = "rbeSil";
+static constexpr const char* kRbeDeadbandKey = "rbeDb";
+static constexpr const char* kUrgentFlagsKey = "urgF";
+static constexpr const char* kUrgentAirKey = "urgAir";
+static constexpr const char* kUrgentSoilKey = "urgSoil";
+static constexpr const char* kUrgentStateKey = "urgSt";
 static constexpr uint32_t kMagic = 0x4E434647UL;  // "NCFG"
 static constexpr uint16_t kSchema = 1;
 
@@ -293,6 +301,86 @@ bool nodeDeploymentEpochSave(uint16_t epoch) {
   return written == sizeof(epoch);
 }
 
+NodeAggConfig nodeAggConfigLoad() {
+  NodeAggConfig cfg{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return cfg;
+  cfg.samplesPerReport = prefs.getUChar(kAggSamplesKey, 0);
+  cfg.statsMask = prefs.getUShort(kAggStatsMaskKey, 0);
+  prefs.end();
+  return cfg;
+}
+
+bool nodeAggConfigSave(const NodeAggConfig& cfg) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const size_t wroteN = prefs.putUChar(kAggSamplesKey, cfg.samplesPerReport);
+  const size_t wroteMask = prefs.putUShort(kAggStatsMaskKey, cfg.statsMask);
+  prefs.end();
+  return wroteN == sizeof(cfg.samplesPerReport) && wroteMask == sizeof(cfg.statsMask);
+}
+
+NodeRbeConfig nodeRbeConfigLoad() {
+  NodeRbeConfig cfg{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return cfg;
+  cfg.maxSilenceMin = prefs.getUShort(kRbeSilenceKey, 0);
+  cfg.deadbandTenths = prefs.getUChar(kRbeDeadbandKey, 0);
+  prefs.end();
+  return cfg;
+}
+
+bool nodeRbeConfigSave(const NodeRbeConfig& cfg) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const size_t wroteSilence = prefs.putUShort(kRbeSilenceKey, cfg.maxSilenceMin);
+  const size_t wroteBand = prefs.putUChar(kRbeDeadbandKey, cfg.deadbandTenths);
+  prefs.end();
+  return wroteSilence == sizeof(cfg.maxSilenceMin) && wroteBand == sizeof(cfg.deadbandTenths);
+}
+
+NodeUrgentConfig nodeUrgentConfigLoad() {
+  NodeUrgentConfig cfg{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return cfg;
+  cfg.flags = prefs.getUChar(kUrgentFlagsKey, 0);
+  cfg.airBelowCenti = prefs.getShort(kUrgentAirKey, 0);
+  cfg.soilAboveMv = prefs.getUShort(kUrgentSoilKey, 0);
+  prefs.end();
+  return cfg;
+}
+
+bool nodeUrgentConfigSave(const NodeUrgentConfig& cfg) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const size_t wroteFlags = prefs.putUChar(kUrgentFlagsKey, cfg.flags);
+  const size_t wroteAir = prefs.putShort(kUrgentAirKey, cfg.airBelowCenti);
+  const size_t wroteSoil = prefs.putUShort(kUrgentSoilKey, cfg.soilAboveMv);
+  prefs.end();
+  return wroteFlags == sizeof(cfg.flags) && wroteAir == sizeof(cfg.airBelowCenti) &&
+         wroteSoil == sizeof(cfg.soilAboveMv);
+}
+
+urgent_listen::State nodeUrgentStateLoad() {
+  urgent_listen::State st{};
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, true)) return st;
+  const uint16_t packed = prefs.getUShort(kUrgentStateKey, 0);
+  prefs.end();
+  st.active = (uint8_t)(packed & 0xFF);
+  st.delivered = (uint8_t)(packed >> 8);
+  return st;
+}
+
+bool nodeUrgentStateSave(const urgent_listen::State& st) {
+  Preferences prefs;
+  if (!prefs.begin(kNamespace, false)) return false;
+  const uint16_t packed = (uint16_t)(st.active | ((uint16_t)st.delivered << 8));
+  const size_t wrote = prefs.putUShort(kUrgentStateKey, packed);
+  prefs.end();
+  return wrote == sizeof(packed);
+}
+
 #ifdef NODE_CONFIG_STORE_TESTING
 void nodeConfigStoreResetForTest() {
   g_generation = 0;
@@ -2,6 +2,8 @@
 
 #include <Arduino.h>
 
+#include "urgent_listen.h"
+
 struct NodeConfigStoreRecord {
   uint8_t mothershipMac[6];
   uint8_t state;
@@ -42,6 +44,39 @@ bool     nodeSensorMaskSave(uint16_t mask);
 uint16_t nodeDeploymentEpochLoad();
 bool     nodeDeploymentEpochSave(uint16_t epoch);
 
+// Aggregation mode (NODE_CONFIG aggSamplesPerReport / aggStatsMask). Standalone
+// keys for the same reason as the sensor mask. samplesPerReport 0 = off.
+struct NodeAggConfig {
+  uint8_t  samplesPerReport;
+  uint16_t statsMask;
+};
+
+NodeAggConfig nodeAggConfigLoad();
+bool          nodeAggConfigSave(const NodeAggConfig& cfg);
+
+// Report-by-exception (NODE_CONFIG rbeMaxSilenceMin / rbeDeadbandTenths).
+// maxSilenceMin 0 = off; deadbandTenths scales the node's per-channel
+// deadband table (10 = as built, 0 = default).
+struct NodeRbeConfig {
+  uint16_t maxSilenceMin;
+  uint8_t  deadbandTenths;
+};
+
+NodeRbeConfig nodeRbeConfigLoad();
+bool          nodeRbeConfigSave(const NodeRbeConfig& cfg);
+
+// Urgent thresholds (NODE_CONFIG urgentFlags / urgentAirBelowCenti /
+// urgentSoilAboveMv). flags 0 = off; see urgent_listen.h.
+using NodeUrgentConfig = urgent_listen::Thresholds;
+
+NodeUrgentConfig nodeUrgentConfigLoad();
+bool             nodeUrgentConfigSave(const NodeUrgentConfig& cfg);
+
+// Alarm state across wakes (the node is power-cut between them). Written only
+// when it changes, i.e. on a crossing, its delivery and its clearing.
+urgent_listen::State nodeUrgentStateLoad();
+bool                 nodeUrgentStateSave(const urgent_listen::State& st);
+
 #ifdef NODE_CONFIG_STORE_TESTING
 void nodeConfigStoreResetForTest();
 bool nodeConfigStoreCorruptActiveForTest();
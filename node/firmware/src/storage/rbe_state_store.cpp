@@ -0,0 +1,61 @@
+#include "rbe_state_store.h"
+
+#include <Preferences.h>
+#include <string.h>
+
+namespace {
+
+static constexpr const char* kNamespace = "node_rbe";
+static constexpr const char* kStateKey = "state";
+
+RTC_DATA_ATTR RbeState g_rtcState;
+
+bool loadNvs(RbeState& out) {
+  Preferences p;
+  if (!p.begin(kNamespace, true)) return false;
+  bool ok = false;
+  if (p.getBytesLength(kStateKey) == sizeof(out)) {
+    ok = p.getBytes(kStateKey, &out, sizeof(out)) == sizeof(out) && rbeIsValid(out);
+  }
+  p.end();
+  return ok;
+}
+
+}  // namespace
+
+namespace rbe_state_store {
+
+bool load(RbeState& out) {
+  if (rbeIsValid(g_rtcState)) {
+    memcpy(&out, &g_rtcState, sizeof(out));
+    return true;
+  }
+  if (loadNvs(out)) {
+    memcpy(&g_rtcState, &out, sizeof(out));
+    return true;
+  }
+  rbeReset(out);
+  return false;
+}
+
+bool save(RbeState& state, bool mirrorToNvs) {
+  rbeSeal(state);
+  memcpy(&g_rtcState, &state, sizeof(state));
+  if (!mirrorToNvs) return true;
+
+  Preferences p;
+  if (!p.begin(kNamespace, false)) return false;
+  const size_t written = p.putBytes(kStateKey, &state, sizeof(state));
+  p.end();
+  return written == sizeof(state);
+}
+
+void clear() {
+  memset(&g_rtcState, 0, sizeof(g_rtcState));
+  Preferences p;
+  if (!p.begin(kNamespace, false)) return;
+  p.remove(kStateKey);
+  p.end();
+}
+
+}  // namespace rbe_state_store
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+#include "../sensors/report_by_exception.h"
+
+namespace rbe_state_store {
+
+// Persistence for the report-by-exception reference set (report_by_exception.h):
+// the value last sent for each channel and the time of the last full snapshot.
+//
+// Same RTC-first / NVS-mirror scheme as agg_state_store. The set only changes
+// when something is sent, so a suppressed wake costs no flash write. A missing
+// or corrupt copy reads back empty, which makes the next wake a full snapshot.
+
+// Load the reference set into `out`. Returns false (and leaves `out` reset)
+// when neither copy is intact.
+bool load(RbeState& out);
+
+// Seal and store `state`. The NVS mirror is written only when `mirrorToNvs`.
+bool save(RbeState& state, bool mirrorToNvs);
+
+// Forget the reference set so the next capture is sent in full (pairing,
+// new deployment, config change, or queued records dropped for capacity).
+void clear();
+
+}  // namespace rbe_state_store
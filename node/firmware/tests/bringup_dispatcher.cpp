@@ -2,7 +2,8 @@
 //
 // Proves the Phase 2 core (plan §4.2/§4.3) in isolation on the node bench:
 // compare-and-set revisioning, idempotent replay, supersession, validation,
-// pause-node desired state, convergence, and reboot persistence (NVS).
+// pause-node desired state, convergence, a full CMD_MAX_NODES table, and
+// reboot persistence (NVS).
 //
 // Menu @115200:
 //   r  - submit a marker command then reboot (proves NVS persistence)
@@ -88,8 +89,50 @@ static void runSuite() {
         dispatcherResultFor("C", &cStored) && cStored.outcome == OUT_CONVERGED);
   check("N1 config now wake 30", dispatcherNodeConfig("N1")->wakeIntervalMin == 30);
 
+  // 8) Fill the table, then time one 8-command batch against it. Before the
+  //    per-node NVS records every accept rewrote the whole table.
+  dispatcherResetForTest();
+  char id[CMD_ID_LEN], node[CMD_NODEID_LEN];
+  bool filled = true;
+  for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
+    snprintf(id, sizeof id, "fill-%u", i);
+    snprintf(node, sizeof node, "ENV_%04u", i);
+    filled = dispatcherSubmit(mkCfg(id, SRC_DASHBOARD, dispatcherRevision(),
+                                    node, 5, 2)).outcome == OUT_ACCEPTED && filled;
+  }
+  check("table fills to CMD_MAX_NODES", filled && dispatcherRevision() == CMD_MAX_NODES);
+  check("node past CMD_MAX_NODES refused",
+        dispatcherSubmit(mkCfg("over", SRC_DASHBOARD, dispatcherRevision(),
+                               "ENV_XTRA", 5, 2)).outcome != OUT_ACCEPTED);
+
+  DispatchBatchItem batch[CMD_MAX_RESULTS]{};
+  for (uint8_t i = 0; i < CMD_MAX_RESULTS; ++i) {
+    snprintf(id, sizeof id, "bench-%u", i);
+    snprintf(node, sizeof node, "ENV_%04u", (unsigned)((i * 7) % CMD_MAX_NODES));
+    batch[i].command = mkCfg(id, SRC_DASHBOARD, dispatcherRevision(), node, 10, 2);
+    batch[i].outcome = OUT_ACCEPTED;
+  }
+  CommandResult batchOut[CMD_MAX_RESULTS];
+  const bool batched = dispatcherSubmitBatch(batch, CMD_MAX_RESULTS,
+                                             dispatcherRevision(), batchOut);
+  check("8-command batch accepted on a full table", batched);
+
+  // 9) Reload from NVS as a reboot would: every node and the batch survive.
+  const uint32_t revBefore = dispatcherRevision();
+  dispatcherInit();
+  bool reloaded = dispatcherRevision() == revBefore;
+  for (uint8_t i = 0; i < CMD_MAX_NODES; ++i) {
+    snprintf(node, sizeof node, "ENV_%04u", i);
+    const DispatchNodeConfig* cfg = dispatcherNodeConfig(node);
+    const uint8_t wake = (i % 7 == 0 && i / 7 < CMD_MAX_RESULTS) ? 10 : 5;
+    reloaded = reloaded && cfg && cfg->wakeIntervalMin == wake;
+  }
+  check("full table reloads from per-node records", reloaded);
+  check("reloaded state verifies durable", dispatcherEnsureDurable());
+
   Serial.printf("=== SUITE: %d passed, %d failed (revision=%u) ===\n",
                 gPass, gFail, dispatcherRevision());
+  dispatcherResetForTest();  // leave room for the 'r' persistence marker
 }
 
 void setup() {
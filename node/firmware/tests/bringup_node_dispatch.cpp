@@ -146,6 +146,80 @@ void setup() {
                                        reinterpret_cast<uint8_t*>(&release),
                                        sizeof(release), "ENV_TEST"));
 
+  fota_offer_message_t offer{};
+  strncpy(offer.command, "OTA_OFFER", sizeof(offer.command) - 1);
+  strncpy(offer.mothership_id, "M001", sizeof(offer.mothership_id) - 1);
+  strncpy(offer.version, "0.2.0", sizeof(offer.version) - 1);
+  strncpy(offer.hwTarget, "node-v3", sizeof(offer.hwTarget) - 1);
+  report("OTA_OFFER classified as a fleet broadcast",
+         classifyIncomingMessage(reinterpret_cast<uint8_t*>(&offer), sizeof(offer)) ==
+             IncomingMessageType::OTA_OFFER &&
+         incomingMessageTextFieldsTerminated(IncomingMessageType::OTA_OFFER,
+                                             reinterpret_cast<uint8_t*>(&offer),
+                                             sizeof(offer)));
+  memset(offer.version, 'x', sizeof(offer.version));
+  report("OTA_OFFER with unterminated version rejected",
+         !incomingMessageTextFieldsTerminated(IncomingMessageType::OTA_OFFER,
+                                              reinterpret_cast<uint8_t*>(&offer),
+                                              sizeof(offer)));
+
+  fota_chunk_message_t chunk{};
+  strncpy(chunk.command, "OTA_CHUNK", sizeof(chunk.command) - 1);
+  report("OTA_CHUNK classified only at its exact size",
+         classifyIncomingMessage(reinterpret_cast<uint8_t*>(&chunk), sizeof(chunk)) ==
+             IncomingMessageType::OTA_CHUNK &&
+         classifyIncomingMessage(reinterpret_cast<uint8_t*>(&chunk), sizeof(chunk) - 1) ==
+             IncomingMessageType::INVALID);
+
+  clock_reply_message_t clockReply{};
+  strncpy(clockReply.command, "CLOCK_REPLY", sizeof(clockReply.command) - 1);
+  strncpy(clockReply.nodeId, "ENV_TEST", sizeof(clockReply.nodeId) - 1);
+  clockReply.sessionId = 1234;
+  report("CLOCK_REPLY classified and targeted",
+         classifyIncomingMessage(reinterpret_cast<uint8_t*>(&clockReply), sizeof(clockReply)) ==
+             IncomingMessageType::CLOCK_REPLY &&
+         incomingMessageHasValidTarget(IncomingMessageType::CLOCK_REPLY,
+                                       reinterpret_cast<uint8_t*>(&clockReply),
+                                       sizeof(clockReply), "ENV_TEST") &&
+         !incomingMessageHasValidTarget(IncomingMessageType::CLOCK_REPLY,
+                                        reinterpret_cast<uint8_t*>(&clockReply),
+                                        sizeof(clockReply), "ENV_OTHER"));
+
+  config_digest_message_t digest{};
+  strncpy(digest.command, "CONFIG_DIGEST", sizeof(digest.command) - 1);
+  digest.pages = 1;
+  digest.count = 2;
+  digest.entries[0] = {configDigestShortId("ENV_PEER"), 3};
+  digest.entries[1] = {configDigestShortId("ENV_TEST"), 7};
+  const size_t digestLen = CONFIG_DIGEST_HEADER_SIZE + 2 * sizeof(config_digest_entry_t);
+  uint16_t digestVersion = 0;
+  report("CONFIG_DIGEST sized by count and targeted by listing",
+         classifyIncomingMessage(reinterpret_cast<uint8_t*>(&digest), digestLen) ==
+             IncomingMessageType::CONFIG_DIGEST &&
+         classifyIncomingMessage(reinterpret_cast<uint8_t*>(&digest), digestLen + 4) ==
+             IncomingMessageType::INVALID &&
+         configDigestVersionFor(reinterpret_cast<uint8_t*>(&digest), digestLen,
+                                "ENV_TEST", digestVersion) &&
+         digestVersion == 7 &&
+         !incomingMessageHasValidTarget(IncomingMessageType::CONFIG_DIGEST,
+                                        reinterpret_cast<uint8_t*>(&digest),
+                                        digestLen, "ENV_OTHER"));
+
+  // ENV_81000 hashes to ENV_TEST's shortId; its lower version listed first
+  // must not hide ENV_TEST's newer one.
+  config_digest_message_t collided{};
+  strncpy(collided.command, "CONFIG_DIGEST", sizeof(collided.command) - 1);
+  collided.pages = 1;
+  collided.count = 2;
+  collided.entries[0] = {configDigestShortId("ENV_81000"), 2};
+  collided.entries[1] = {configDigestShortId("ENV_TEST"), 7};
+  uint16_t collidedVersion = 0;
+  report("CONFIG_DIGEST shortId collision yields the highest version",
+         configDigestShortId("ENV_81000") == configDigestShortId("ENV_TEST") &&
+         configDigestVersionFor(reinterpret_cast<uint8_t*>(&collided), digestLen,
+                                "ENV_TEST", collidedVersion) &&
+         collidedVersion == 7);
+
   Serial.printf("RESULT: %s\n", g_pass ? "PASS" : "FAIL");
 }
 
@@ -0,0 +1,21 @@
+#pragma once
+
+// Pass/fail fixture shared by the native host tests (the `platform = native`
+// envs). Output follows the on-device suites: one [PASS]/[FAIL] line per
+// check, then a single OVERALL line; main() returns checkSummary(), so the
+// process exit code is the failure count.
+
+#include <stdio.h>
+
+static int gPass = 0;
+static int gFail = 0;
+
+static inline void check(bool cond, const char* label) {
+  if (cond) { printf("[PASS] %s\n", label); ++gPass; }
+  else      { printf("[FAIL] %s\n", label); ++gFail; }
+}
+
+static inline int checkSummary() {
+  printf("\nOVERALL: %s (%d passed, %d failed)\n", gFail ? "FAIL" : "PASS", gPass, gFail);
+  return gFail;
+}
@@ -0,0 +1,115 @@
+// Two-way clock exchange arithmetic — native host test.
+//
+// Drives clock_sync.h (the offset/delay/drift maths shared by the node and
+// the mothership) through symmetric and asymmetric round trips, stale or
+// reordered replies, best-of-N selection, drift estimation, aging-register
+// feedback and the mothership's skew bound. No Arduino, no radio:
+//
+//   pio run -e native-clock-sync -t exec
+
+#include <stdio.h>
+
+#include "clock_sync.h"
+#include "native_check.h"
+
+using namespace clock_sync;
+
+static const int64_t kBase = 1760000000000LL;  // unix ms, autumn 2025
+
+static void testSymmetricExchange() {
+  // Node 1.5 s behind; 10 ms each way; mothership turnaround 3 ms.
+  const int64_t t1 = kBase;
+  const int64_t t2 = t1 + 1500 + 10;
+  const int64_t t3 = t2 + 3;
+  const int64_t t4 = t3 - 1500 + 10;
+  const Sample s = sampleFrom(t1, t2, t3, t4);
+  check(s.valid && s.offsetMs == 1500 && s.delayMs == 20,
+        "symmetric: offset and delay recovered exactly");
+  check(residualMs(s) == 12, "symmetric: residual is half the delay plus read-out");
+}
+
+static void testNodeAhead() {
+  const int64_t t1 = kBase;
+  const int64_t t2 = t1 - 742 + 6;
+  const int64_t t3 = t2 + 1;
+  const int64_t t4 = t3 + 742 + 6;
+  const Sample s = sampleFrom(t1, t2, t3, t4);
+  check(s.valid && s.offsetMs == -742 && s.delayMs == 12,
+        "node ahead: offset is negative");
+}
+
+static void testAsymmetryBoundedByDelay() {
+  // 2 ms out, 30 ms back: the offset error is at most half the delay.
+  const int64_t t1 = kBase;
+  const int64_t t2 = t1 + 2;
+  const int64_t t3 = t2;
+  const int64_t t4 = t3 + 30;
+  const Sample s = sampleFrom(t1, t2, t3, t4);
+  const int32_t err = s.offsetMs < 0 ? -s.offsetMs : s.offsetMs;
+  check(s.valid && (uint32_t)err <= s.delayMs / 2 + 1,
+        "asymmetric: offset error stays within half the round trip");
+}
+
+static void testRejections() {
+  check(!sampleFrom(kBase, kBase + 5, kBase + 6, kBase - 1).valid,
+        "reject: t4 before t1 (node clock stepped mid-probe)");
+  check(!sampleFrom(kBase, kBase + 5, kBase + 4, kBase + 20).valid,
+        "reject: t3 before t2");
+  check(!sampleFrom(kBase, kBase + 200, kBase + 200, kBase + 400).valid,
+        "reject: round trip longer than kMaxDelayMs");
+  const Sample r = sampleFrom(kBase, kBase + 10, kBase + 30, kBase + 19);
+  check(r.valid && r.delayMs == 0,
+        "clamp: ms rounding that makes delay negative reads as zero");
+}
+
+static void testBestOfN() {
+  Sample best;
+  keepBest(best, sampleFrom(kBase, kBase + 40, kBase + 41, kBase + 80));
+  keepBest(best, sampleFrom(kBase, kBase + 8, kBase + 9, kBase + 13));
+  keepBest(best, Sample{});
+  keepBest(best, sampleFrom(kBase, kBase + 20, kBase + 22, kBase + 50));
+  check(best.valid && best.delayMs == 12, "best-of-N: lowest delay wins, invalid ignored");
+}
+
+static void testDrift() {
+  int16_t d = 0;
+  check(!driftCentiPpm(-50, kMinDriftSpanSec - 1, d),
+        "drift: too short a span gives no estimate");
+  // 86.4 ms/day fast = +1.00 ppm.
+  check(driftCentiPpm(-86, 86400, d) && d >= 99 && d <= 100,
+        "drift: 86 ms/day ahead reads as +1 ppm");
+  check(driftCentiPpm(173, 86400, d) && d <= -200 && d >= -201,
+        "drift: 173 ms/day behind reads as -2 ppm");
+  check(driftCentiPpm(-2000000, kMinDriftSpanSec, d) && d == INT16_MAX,
+        "drift: absurd offsets saturate");
+}
+
+static void testAging() {
+  check(nextAgingOffset(0, 100) == 5, "aging: +1 ppm fast -> +5 LSB (half-step)");
+  check(nextAgingOffset(10, -60) == 7, "aging: slow node lowers the register");
+  check(nextAgingOffset(0, 3000) == kMaxAgingStep, "aging: step is clamped");
+  check(nextAgingOffset(120, 3000) == 127, "aging: register range is respected");
+  check(nextAgingOffset(-3, 15) == -3, "aging: sub-LSB error leaves it alone");
+}
+
+static void testSkewBound() {
+  check(skewBoundMs(10, false, 0, 3600) == 10 + 8,
+        "bound: unknown drift assumes 2 ppm");
+  check(skewBoundMs(10, true, -30, 3600) == 10 + 3,
+        "bound: known drift plus margin");
+  check(skewBoundMs(10, true, 900, 3600) == 10 + 8,
+        "bound: measured drift never exceeds the unknown-drift rate");
+  check(skewBoundMs(0, false, 0, 0) == 0, "bound: zero elapsed, zero residual");
+}
+
+int main() {
+  testSymmetricExchange();
+  testNodeAhead();
+  testAsymmetryBoundedByDelay();
+  testRejections();
+  testBestOfN();
+  testDrift();
+  testAging();
+  testSkewBound();
+  return checkSummary();
+}
@@ -0,0 +1,94 @@
+// ESP-NOW in-flight send tracker — native host test.
+//
+// Drives TxTracker (the bookkeeping espnow_tx.cpp uses to tie each send
+// callback back to its ticket) through pipelined sends, a lost callback,
+// overdue frames, a refused send and driver re-init. No Arduino, no radio:
+//
+//   pio run -e native-espnow-tx-tracker -t exec
+
+#include <stdio.h>
+
+#include "espnow_tx_tracker.h"
+#include "native_check.h"
+
+static const uint8_t kHub[6]   = {0x24, 0x6F, 0x28, 0x01, 0x02, 0x03};
+static const uint8_t kBcast[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+static void testPipelinedInOrder() {
+  TxTracker t;
+  const uint32_t a = t.push(kHub, 1000, 250);
+  const uint32_t b = t.push(kBcast, 1100, 250);
+  check(a != 0 && b != 0 && a != b && t.count == 2,
+        "pipeline: a second frame queues behind one awaiting its MAC ACK");
+
+  TxCompletion out[kTxMaxInFlight];
+  size_t n = t.complete(kHub, true, 4000, out);
+  check(n == 1 && out[0].ticket == a && out[0].outcome == TxOutcome::Acked &&
+        out[0].latencyUs == 3000,
+        "pipeline: first callback resolves the first ticket with its latency");
+  n = t.complete(kBcast, false, 5100, out);
+  check(n == 1 && out[0].ticket == b && out[0].outcome == TxOutcome::Failed,
+        "pipeline: second callback resolves the second ticket");
+  check(t.count == 0, "pipeline: nothing left in flight");
+}
+
+static void testSameDestinationTwice() {
+  TxTracker t;
+  const uint32_t a = t.push(kHub, 0, 350);
+  const uint32_t b = t.push(kHub, 10, 350);
+  TxCompletion out[kTxMaxInFlight];
+  t.complete(kHub, true, 500, out);
+  check(out[0].ticket == a, "same MAC: callbacks match oldest first");
+  t.complete(kHub, true, 900, out);
+  check(out[0].ticket == b, "same MAC: then the next one");
+}
+
+static void testLostCallbackDoesNotShift() {
+  TxTracker t;
+  const uint32_t a = t.push(kBcast, 0, 250);
+  const uint32_t b = t.push(kHub, 0, 250);
+  TxCompletion out[kTxMaxInFlight];
+  const size_t n = t.complete(kHub, true, 800, out);
+  check(n == 2 && out[0].ticket == a && out[0].outcome == TxOutcome::Lost &&
+        out[1].ticket == b && out[1].outcome == TxOutcome::Acked,
+        "lost callback: the skipped frame is retired as lost, the match acked");
+  check(t.complete(kBcast, true, 900, out) == 0,
+        "lost callback: a stale callback for a retired frame matches nothing");
+}
+
+static void testCapacityCancelExpire() {
+  TxTracker t;
+  uint32_t last = 0;
+  for (uint8_t i = 0; i < kTxMaxInFlight; ++i) last = t.push(kHub, 0, 100 + i);
+  check(t.full() && t.push(kHub, 0, 500) == 0,
+        "capacity: push refuses past kTxMaxInFlight");
+  check(t.cancel(last) && t.count == kTxMaxInFlight - 1,
+        "cancel: a refused esp_now_send() gives its slot back");
+  check(!t.cancel(1), "cancel: only the newest slot can be withdrawn");
+
+  TxCompletion out[kTxMaxInFlight];
+  check(t.expire(99, out) == 0, "expire: nothing retired before its deadline");
+  const size_t n = t.expire(101, out);
+  check(n == 2 && out[0].outcome == TxOutcome::Lost && t.count == 1,
+        "expire: overdue frames are retired from the front");
+  check(t.retireAll(out) == 1 && t.count == 0,
+        "reset: re-init retires whatever is left");
+}
+
+static void testTicketWrap() {
+  TxTracker t;
+  t.nextTicket = 0xFFFFFFFFu;
+  const uint32_t a = t.push(kHub, 0, 100);
+  const uint32_t b = t.push(kHub, 0, 100);
+  check(a == 0xFFFFFFFFu && b == 1, "ticket: wraps past 0, which means no ticket");
+}
+
+int main() {
+  printf("=== ESP-NOW TX tracker (native) ===\n");
+  testPipelinedInOrder();
+  testSameDestinationTwice();
+  testLostCallbackDoesNotShift();
+  testCapacityCancelExpire();
+  testTicketWrap();
+  return checkSummary();
+}
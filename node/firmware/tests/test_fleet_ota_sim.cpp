@@ -0,0 +1,432 @@
+// Fleet firmware distribution — native host simulation.
+//
+// Runs the shared fleet_ota.h state machines (the same code the node receiver
+// and the mothership distributor use) for a whole fleet over many simulated
+// sync sessions: lossy broadcast, nodes that miss sessions, and power cuts
+// that throw away everything a node had not persisted yet. Flash is an
+// in-memory NOR model (erase sets 0xFF, program can only clear bits) seeded
+// with garbage, so a missed erase or a misplaced write shows up as a wrong
+// byte. No Arduino, no radio:
+//
+//   pio run -e native-fleet-ota-sim -t exec
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "fleet_ota.h"
+#include "native_check.h"
+
+// Deterministic xorshift32 so every run sees the same losses.
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+  bool chance(uint32_t percent) { return next() % 100u < percent; }
+};
+
+struct NorFlash {
+  std::vector<uint8_t> bytes;
+  uint32_t erases = 0;
+  explicit NorFlash(size_t size, Rng& rng) : bytes(size) {
+    for (auto& b : bytes) b = (uint8_t)rng.next();
+  }
+  bool eraseSector(uint32_t sector) {
+    const size_t off = (size_t)sector * FOTA_SECTOR_BYTES;
+    if (off >= bytes.size()) return false;
+    const size_t n = bytes.size() - off < FOTA_SECTOR_BYTES ? bytes.size() - off
+                                                            : FOTA_SECTOR_BYTES;
+    memset(&bytes[off], 0xFF, n);
+    ++erases;
+    return true;
+  }
+  bool write(uint32_t offset, const uint8_t* data, size_t len) {
+    if (offset + len > bytes.size()) return false;
+    for (size_t i = 0; i < len; ++i) bytes[offset + i] &= data[i];
+    return true;
+  }
+};
+
+static const char* kHw = "node-v3";
+static const char* kOldVersion = "0.1.0";
+static const char* kNewVersion = "0.2.0";
+static constexpr uint32_t kSlotBytes = 0x140000;
+
+static std::vector<uint8_t> makeImage(uint32_t size, Rng& rng) {
+  std::vector<uint8_t> img(size);
+  for (auto& b : img) b = (uint8_t)rng.next();
+  return img;
+}
+
+static fota_offer_message_t makeOffer(const std::vector<uint8_t>& img) {
+  fota_offer_message_t o;
+  memset(&o, 0, sizeof(o));
+  strncpy(o.command, "OTA_OFFER", sizeof(o.command));
+  // Stand-in digest: the kernel only needs sha256[0..3] to derive imageId.
+  for (size_t i = 0; i < sizeof(o.sha256); ++i) o.sha256[i] = img[i * 7 % img.size()] ^ (uint8_t)i;
+  o.imageId = fotaImageIdOf(o.sha256);
+  o.imageSize = (uint32_t)img.size();
+  o.chunkCount = fotaChunkCountFor(o.imageSize);
+  o.chunkBytes = FOTA_CHUNK_BYTES;
+  strncpy(o.version, kNewVersion, sizeof(o.version) - 1);
+  strncpy(o.hwTarget, kHw, sizeof(o.hwTarget) - 1);
+  o.releaseSequence = 12;
+  return o;
+}
+
+static fota_chunk_message_t makeChunk(const std::vector<uint8_t>& img,
+                                      uint32_t imageId, uint16_t index) {
+  fota_chunk_message_t c;
+  memset(&c, 0, sizeof(c));
+  strncpy(c.command, "OTA_CHUNK", sizeof(c.command));
+  c.imageId = imageId;
+  c.index = index;
+  c.length = fotaChunkLength((uint32_t)img.size(), index);
+  memcpy(c.data, &img[(size_t)index * FOTA_CHUNK_BYTES], c.length);
+  return c;
+}
+
+static fota_need_message_t buildNeed(const FotaRxState& s, uint32_t sessionId) {
+  fota_need_message_t n;
+  memset(&n, 0, sizeof(n));
+  strncpy(n.command, "OTA_NEED", sizeof(n.command));
+  n.sessionId = sessionId;
+  n.imageId = s.imageId;
+  n.chunksHave = s.chunksHave;
+  n.rangeCount = (uint8_t)fotaRxMissingRanges(s, n.ranges, FOTA_NEED_MAX_RANGES);
+  return n;
+}
+
+// One simulated node: RAM state, the copy last written to "NVS", and flash.
+struct SimNode {
+  FotaRxState ram;
+  FotaRxState nvs;
+  NorFlash flash;
+  uint32_t storedSincePersist = 0;
+  SimNode(Rng& rng) : flash(kSlotBytes, rng) {
+    fotaRxReset(ram);
+    fotaRxSeal(ram);
+    nvs = ram;
+  }
+  void persist() {
+    fotaRxSeal(ram);
+    nvs = ram;
+    storedSincePersist = 0;
+  }
+  // Power cut: RAM is gone, the next boot reloads the NVS copy. Flash keeps
+  // whatever was written, including chunks the bitmap no longer lists.
+  void powerCut() {
+    ram = fotaRxIsValid(nvs) ? nvs : FotaRxState{};
+    if (!fotaRxIsValid(ram)) { fotaRxReset(ram); fotaRxSeal(ram); }
+    storedSincePersist = 0;
+  }
+};
+
+struct SimResult {
+  uint32_t sessions = 0;
+  uint32_t broadcasts = 0;
+  uint32_t complete = 0;
+  bool flashMatches = true;
+};
+
+// Fleet run. Per session: nodes that are awake hear the offer, answer with a
+// NEED (which may be lost), then the mothership sends the wanted union for up
+// to `chunkBudget` chunks per round and repeats OFFER/NEED rounds.
+static SimResult runFleet(size_t nodeCount, uint32_t seed, uint32_t lossPercent,
+                          uint32_t missSessionPercent, uint32_t powerCutPercent,
+                          uint32_t imageSize, uint32_t chunkBudget) {
+  Rng rng{seed};
+  const std::vector<uint8_t> img = makeImage(imageSize, rng);
+  const fota_offer_message_t offer = makeOffer(img);
+  std::vector<SimNode> nodes;
+  nodes.reserve(nodeCount);
+  for (size_t i = 0; i < nodeCount; ++i) nodes.emplace_back(rng);
+
+  SimResult r;
+  FotaSender sender;
+  for (uint32_t session = 1; session <= 200 && r.complete < nodeCount; ++session) {
+    ++r.sessions;
+    std::vector<bool> awake(nodeCount);
+    for (size_t i = 0; i < nodeCount; ++i) awake[i] = !rng.chance(missSessionPercent);
+
+    for (uint32_t round = 0; round < 4; ++round) {
+      fotaSenderReset(sender, offer.imageId, offer.chunkCount);
+      for (size_t i = 0; i < nodeCount; ++i) {
+        if (!awake[i] || rng.chance(lossPercent)) continue;  // offer lost
+        SimNode& n = nodes[i];
+        const FotaOfferVerdict v =
+            fotaRxConsiderOffer(n.ram, offer, kOldVersion, kHw, kSlotBytes, 0);
+        if (v == FotaOfferVerdict::Start) fotaRxStart(n.ram, offer);
+        if (v != FotaOfferVerdict::Start && v != FotaOfferVerdict::Resume) continue;
+        const fota_need_message_t need = buildNeed(n.ram, session);
+        if (need.rangeCount == 0 || rng.chance(lossPercent)) continue;  // NEED lost
+        fotaSenderMergeNeed(sender, need);
+      }
+      uint16_t index;
+      uint32_t sent = 0;
+      while (sent < chunkBudget && fotaSenderNext(sender, index)) {
+        const fota_chunk_message_t c = makeChunk(img, offer.imageId, index);
+        ++sent;
+        ++r.broadcasts;
+        for (size_t i = 0; i < nodeCount; ++i) {
+          if (!awake[i] || rng.chance(lossPercent)) continue;
+          SimNode& n = nodes[i];
+          if (fotaRxAcceptChunk(n.ram, c, n.flash) == FotaChunkResult::Stored &&
+              ++n.storedSincePersist >= 64) {
+            n.persist();
+          }
+        }
+      }
+      if (sent == 0) break;
+    }
+
+    for (size_t i = 0; i < nodeCount; ++i) {
+      if (!awake[i]) continue;
+      SimNode& n = nodes[i];
+      if (rng.chance(powerCutPercent)) { n.powerCut(); continue; }
+      if (fotaRxComplete(n.ram)) {
+        n.ram.phase = (uint8_t)FotaRxPhase::Armed;
+        n.ram.resultPending = 1;
+      }
+      n.persist();
+    }
+    r.complete = 0;
+    for (auto& n : nodes) {
+      if (n.nvs.phase == (uint8_t)FotaRxPhase::Armed) ++r.complete;
+    }
+  }
+
+  for (auto& n : nodes) {
+    if (memcmp(n.flash.bytes.data(), img.data(), img.size()) != 0) r.flashMatches = false;
+  }
+  return r;
+}
+
+static void testFleetConverges() {
+  const uint32_t size = 120 * 1024 + 77;  // odd tail chunk on purpose
+  const uint32_t chunks = fotaChunkCountFor(size);
+  const SimResult fleet = runFleet(30, 0xC0FFEEu, 15, 20, 10, size, 250);
+  check(fleet.complete == 30, "fleet: all 30 nodes armed the image");
+  check(fleet.flashMatches, "fleet: every node's slot matches the image byte-for-byte");
+  // Per-node unicast would need 30 copies plus repairs. Broadcast repairs grow
+  // with the union of losses (15% per receiver misses nearly every chunk for
+  // SOMEONE on the first pass), not with the node count.
+  check(fleet.broadcasts <= 8u * chunks,
+        "fleet: total chunk broadcasts stay within 8x the chunk count (unicast: 30x+)");
+  printf("       30 nodes: %u sessions, %u broadcasts for %u chunks (%.2fx)\n",
+         (unsigned)fleet.sessions, (unsigned)fleet.broadcasts, (unsigned)chunks,
+         (double)fleet.broadcasts / chunks);
+
+  const SimResult single = runFleet(1, 0xC0FFEEu, 15, 20, 10, size, 250);
+  check(single.complete == 1 && single.flashMatches, "single: one node converges too");
+  check(fleet.broadcasts <= 6u * single.broadcasts,
+        "scaling: 30 nodes cost under 6x the airtime of one, not 30x");
+  printf("       1 node: %u broadcasts (fleet/single %.2fx)\n",
+         (unsigned)single.broadcasts, (double)fleet.broadcasts / single.broadcasts);
+}
+
+static void testOfferDecisions() {
+  Rng rng{7};
+  const std::vector<uint8_t> img = makeImage(10000, rng);
+  fota_offer_message_t offer = makeOffer(img);
+  FotaRxState s;
+  fotaRxReset(s);
+
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 0) == FotaOfferVerdict::Start,
+        "offer: a new image for this hardware starts a download");
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, "node-v2", kSlotBytes, 0) ==
+            FotaOfferVerdict::Decline,
+        "offer: another hardware target is declined");
+  check(fotaRxConsiderOffer(s, offer, kNewVersion, kHw, kSlotBytes, 0) ==
+            FotaOfferVerdict::Decline,
+        "offer: the version already running is declined");
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, 8192, 0) == FotaOfferVerdict::Decline,
+        "offer: an image larger than the slot is declined");
+  fota_offer_message_t bad = offer;
+  bad.chunkCount = (uint16_t)(bad.chunkCount + 1);
+  check(fotaRxConsiderOffer(s, bad, kOldVersion, kHw, kSlotBytes, 0) == FotaOfferVerdict::Decline,
+        "offer: an inconsistent chunk count is declined");
+
+  fotaRxStart(s, offer);
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 0) == FotaOfferVerdict::Resume,
+        "offer: the same image mid-download resumes");
+  s.phase = (uint8_t)FotaRxPhase::Armed;
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 0) == FotaOfferVerdict::Hold,
+        "offer: an armed image is held, nothing requested");
+  s.phase = (uint8_t)FotaRxPhase::Failed;
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 0) == FotaOfferVerdict::Decline,
+        "offer: an image that failed (or rolled back) is not fetched again");
+
+  // Replay of an older, validly signed release.
+  fotaRxReset(s);
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 13) ==
+            FotaOfferVerdict::Decline,
+        "offer: an older release sequence than the installed one is declined");
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 12) ==
+                FotaOfferVerdict::Start &&
+            fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 11) ==
+                FotaOfferVerdict::Start,
+        "offer: the installed sequence or newer is accepted");
+  fota_offer_message_t newer = makeOffer(makeImage(12000, rng));
+  newer.releaseSequence = 14;
+  fotaRxStart(s, newer);
+  check(fotaRxConsiderOffer(s, offer, kOldVersion, kHw, kSlotBytes, 0) ==
+            FotaOfferVerdict::Decline,
+        "offer: a download in progress is not abandoned for an older release");
+}
+
+// The signed statement must match scripts/release_sign.py fleet_statement()
+// byte for byte, and a node re-checking from its persisted state must rebuild
+// the statement it checked the offer against.
+static void testOfferStatement() {
+  Rng rng{11};
+  const std::vector<uint8_t> img = makeImage(0x12345, rng);
+  fota_offer_message_t offer = makeOffer(img);
+  for (size_t i = 0; i < sizeof(offer.signature); ++i) offer.signature[i] = (uint8_t)i;
+
+  uint8_t a[FOTA_STATEMENT_BYTES];
+  fotaOfferStatement(a, offer.imageSize, offer.sha256, offer.version, offer.hwTarget,
+                     offer.releaseSequence);
+  check(memcmp(a, "FMFOTA2\0", 8) == 0 && a[8] == 0x45 && a[9] == 0x23 && a[10] == 0x01 &&
+            a[11] == 0x00 && memcmp(a + 12, offer.sha256, 32) == 0,
+        "statement: magic, little-endian size and hash at their offsets");
+  check(memcmp(a + 44, "0.2.0\0\0\0\0\0\0\0", 12) == 0 &&
+            memcmp(a + 56, "node-v3\0\0\0\0\0\0\0\0\0", 16) == 0,
+        "statement: version and hardware target NUL-padded to field width");
+  check(a[72] == 12 && a[73] == 0 && a[74] == 0 && a[75] == 0,
+        "statement: little-endian release sequence last");
+
+  uint8_t b[FOTA_STATEMENT_BYTES];
+  fota_offer_message_t forged = offer;
+  forged.sha256[31] ^= 1;
+  fotaOfferStatement(b, forged.imageSize, forged.sha256, forged.version, forged.hwTarget,
+                     forged.releaseSequence);
+  const bool shaCovered = memcmp(a, b, sizeof(a)) != 0;
+  forged = offer;
+  forged.imageSize -= 1;
+  fotaOfferStatement(b, forged.imageSize, forged.sha256, forged.version, forged.hwTarget,
+                     forged.releaseSequence);
+  const bool sizeCovered = memcmp(a, b, sizeof(a)) != 0;
+  forged = offer;
+  strncpy(forged.version, "9.9.9", sizeof(forged.version));
+  fotaOfferStatement(b, forged.imageSize, forged.sha256, forged.version, forged.hwTarget,
+                     forged.releaseSequence);
+  const bool versionCovered = memcmp(a, b, sizeof(a)) != 0;
+  forged = offer;
+  forged.releaseSequence = 11;
+  fotaOfferStatement(b, forged.imageSize, forged.sha256, forged.version, forged.hwTarget,
+                     forged.releaseSequence);
+  check(shaCovered && sizeCovered && versionCovered && memcmp(a, b, sizeof(a)) != 0,
+        "statement: hash, size, version and release sequence are all covered by the signature");
+
+  FotaRxState s;
+  fotaRxReset(s);
+  fotaRxStart(s, offer);
+  fotaOfferStatement(b, s.imageSize, s.sha256, s.version, kHw, s.releaseSequence);
+  check(memcmp(a, b, sizeof(a)) == 0 &&
+            memcmp(s.signature, offer.signature, sizeof(s.signature)) == 0,
+        "statement: persisted state re-derives the offer's statement and signature");
+}
+
+static void testChunkValidation() {
+  Rng rng{11};
+  const std::vector<uint8_t> img = makeImage(5050, rng);  // 50-byte tail chunk
+  const fota_offer_message_t offer = makeOffer(img);
+  NorFlash flash(kSlotBytes, rng);
+  FotaRxState s;
+  fotaRxReset(s);
+  fotaRxStart(s, offer);
+
+  fota_chunk_message_t c = makeChunk(img, offer.imageId, 3);
+  check(fotaRxAcceptChunk(s, c, flash) == FotaChunkResult::Stored && s.chunksHave == 1,
+        "chunk: a wanted chunk is stored");
+  check(fotaRxAcceptChunk(s, c, flash) == FotaChunkResult::Duplicate && s.chunksHave == 1,
+        "chunk: a repeat is counted once");
+  check(flash.erases == 1, "chunk: the sector is erased once, on first touch");
+
+  fota_chunk_message_t foreign = makeChunk(img, offer.imageId ^ 1u, 4);
+  check(fotaRxAcceptChunk(s, foreign, flash) == FotaChunkResult::Foreign,
+        "chunk: another image's chunk is ignored");
+  fota_chunk_message_t past = makeChunk(img, offer.imageId, 4);
+  past.index = offer.chunkCount;
+  check(fotaRxAcceptChunk(s, past, flash) == FotaChunkResult::Foreign,
+        "chunk: an index past the end is ignored");
+  fota_chunk_message_t shortTail = makeChunk(img, offer.imageId, (uint16_t)(offer.chunkCount - 1));
+  shortTail.length = FOTA_CHUNK_BYTES;
+  check(fotaRxAcceptChunk(s, shortTail, flash) == FotaChunkResult::Foreign,
+        "chunk: a wrong length for the tail chunk is ignored");
+}
+
+static void testNeedRanges() {
+  FotaRxState s;
+  fotaRxReset(s);
+  s.phase = (uint8_t)FotaRxPhase::Receiving;
+  s.chunkCount = 1000;
+  for (uint32_t i = 0; i < 1000; ++i) {
+    if (i % 2 == 0) fotaBitSet(s.chunkBits, i);
+  }
+  fota_range_t r[FOTA_NEED_MAX_RANGES];
+  const size_t n = fotaRxMissingRanges(s, r, FOTA_NEED_MAX_RANGES);
+  check(n == FOTA_NEED_MAX_RANGES && r[0].first == 1 && r[0].count == 1,
+        "need: gaps are listed individually while there is room");
+  check(r[n - 1].first + r[n - 1].count == 1000,
+        "need: the last range runs to the end when gaps overflow the frame");
+
+  FotaSender f;
+  fotaSenderReset(f, 42, 1000);
+  fota_need_message_t a;
+  memset(&a, 0, sizeof(a));
+  a.imageId = 42;
+  a.rangeCount = 1;
+  a.ranges[0] = {10, 5};
+  fota_need_message_t b = a;
+  b.ranges[0] = {12, 10};
+  fotaSenderMergeNeed(f, a);
+  fotaSenderMergeNeed(f, b);
+  check(f.wantedCount == 12, "sender: overlapping NEEDs merge into one union");
+  b.imageId = 43;
+  check(!fotaSenderMergeNeed(f, b), "sender: a NEED for another image is refused");
+  uint16_t idx = 0;
+  uint32_t sent = 0;
+  bool ordered = true;
+  uint16_t prev = 0;
+  while (fotaSenderNext(f, idx)) {
+    if (sent && idx <= prev) ordered = false;
+    prev = idx;
+    ++sent;
+  }
+  check(sent == 12 && ordered, "sender: each wanted chunk goes out once, in order");
+}
+
+static void testChecksum() {
+  FotaRxState s;
+  fotaRxReset(s);
+  s.phase = (uint8_t)FotaRxPhase::Receiving;
+  s.chunkCount = 10;
+  fotaBitSet(s.chunkBits, 3);
+  s.chunksHave = 1;
+  fotaRxSeal(s);
+  check(fotaRxIsValid(s), "persist: a sealed state validates");
+  FotaRxState copy = s;
+  fotaBitSet(copy.chunkBits, 4);
+  check(!fotaRxIsValid(copy), "persist: a flipped bitmap bit is rejected");
+  FotaRxState zero;
+  memset(&zero, 0, sizeof(zero));
+  check(!fotaRxIsValid(zero), "persist: zeroed (erased) state is rejected");
+}
+
+int main() {
+  printf("=== Fleet OTA distribution (native simulation) ===\n");
+  testOfferDecisions();
+  testOfferStatement();
+  testChunkValidation();
+  testNeedRanges();
+  testChecksum();
+  testFleetConverges();
+  return checkSummary();
+}
@@ -0,0 +1,135 @@
+// Reed anemometer gust/turbulence kernel — native host test.
+//
+// Feeds synthetic pulse trains straight into ReedWindAccumulator (the pure
+// kernel reed_wind_backend::read() uses on the node) and checks mean, SD,
+// peak 3 s gust and calm fraction against hand-computed values. No Arduino,
+// no ISR, no hardware:
+//
+//   pio run -e native-reed-wind-stats -t exec
+
+#include <math.h>
+#include <stdio.h>
+
+#include "reed_wind_stats.h"
+#include "native_check.h"
+
+static bool near(float got, float want, float tol = 0.01f) {
+  return fabsf(got - want) <= tol;
+}
+
+// WH-SP-WS01 calibration used by the node build.
+static constexpr float kFactor = 0.6667f;
+static constexpr float kCalm   = 0.5f;
+
+// Emit `hz` evenly spaced pulses per second for `seconds` starting at t0.
+static void steadyTrain(ReedWindAccumulator& acc, uint32_t t0,
+                        uint32_t seconds, uint32_t hz) {
+  for (uint32_t s = 0; s < seconds; ++s)
+    for (uint32_t k = 0; k < hz; ++k)
+      acc.addPulse(t0 + s * 1000 + (k * 1000) / hz + 1);
+}
+
+static void testSteadyWind() {
+  ReedWindAccumulator acc;
+  acc.begin(5000, 1000, kFactor, 0.0f, kCalm);
+  steadyTrain(acc, 5000, 10, 6);  // 6 Hz for 10 s -> 4.0 m/s
+  acc.finish(15000);
+  const ReedWindStats s = acc.stats();
+  check(s.valid && s.buckets == 10, "steady: 10 buckets closed");
+  check(near(s.meanMs, 6 * kFactor), "steady: mean = 6 Hz * factor");
+  check(near(s.sdMs, 0.0f), "steady: SD is zero");
+  check(near(s.gustMs, s.meanMs), "steady: gust equals mean");
+  check(near(s.calmFraction, 0.0f), "steady: no calm buckets");
+}
+
+static void testSingleGust() {
+  // 2 Hz background with a 3 s burst at 10 Hz in seconds 4-6.
+  ReedWindAccumulator acc;
+  acc.begin(0, 1000, kFactor, 0.0f, kCalm);
+  const uint32_t rate[10] = {2, 2, 2, 2, 10, 10, 10, 2, 2, 2};
+  for (uint32_t s = 0; s < 10; ++s)
+    for (uint32_t k = 0; k < rate[s]; ++k)
+      acc.addPulse(s * 1000 + (k * 1000) / rate[s] + 1);
+  acc.finish(10000);
+  const ReedWindStats s = acc.stats();
+
+  // Reference: the speeds {2,2,2,2,10,10,10,2,2,2} * factor.
+  const float mean = (7 * 2 + 3 * 10) / 10.0f * kFactor;
+  float m2 = 0.0f;
+  for (uint32_t v : rate) m2 += (v * kFactor - mean) * (v * kFactor - mean);
+  const float sd = sqrtf(m2 / 9.0f);
+
+  check(near(s.meanMs, mean), "gust: Welford mean matches two-pass mean");
+  check(near(s.sdMs, sd), "gust: Welford SD matches two-pass sample SD");
+  check(near(s.gustMs, 10 * kFactor), "gust: peak 3 s = burst speed");
+  check(s.gustMs > s.meanMs, "gust: gust above mean");
+}
+
+static void testCalmFraction() {
+  // Pulses only in seconds 0, 1 and 5 (3 Hz); the other 7 seconds are still.
+  ReedWindAccumulator acc;
+  acc.begin(1000, 1000, kFactor, 0.0f, kCalm);
+  const uint32_t active[3] = {0, 1, 5};
+  for (uint32_t a : active)
+    for (uint32_t k = 0; k < 3; ++k) acc.addPulse(1000 + a * 1000 + k * 300 + 1);
+  acc.finish(11000);
+  const ReedWindStats s = acc.stats();
+  check(s.buckets == 10, "calm: 10 buckets closed");
+  check(near(s.calmFraction, 0.7f), "calm: 7 of 10 buckets calm");
+  check(near(s.gustMs, (3 + 3 + 0) / 3.0f * kFactor),
+        "calm: gust is the best 3 s run (seconds 0-2)");
+}
+
+static void testTrailingPartialDropped() {
+  // 10.4 s window: the 0.4 s tail must not become an 11th (biased) bucket.
+  ReedWindAccumulator acc;
+  acc.begin(0, 1000, kFactor, 0.0f, kCalm);
+  steadyTrain(acc, 0, 10, 4);
+  acc.addPulse(10100);
+  acc.finish(10400);
+  const ReedWindStats s = acc.stats();
+  check(s.buckets == 10, "partial: trailing partial bucket discarded");
+  check(near(s.sdMs, 0.0f), "partial: SD unaffected by the tail");
+}
+
+static void testShortWindowGust() {
+  // Only two buckets close: gust must fall back to their mean, not zero.
+  ReedWindAccumulator acc;
+  acc.begin(0, 1000, kFactor, 0.0f, kCalm);
+  steadyTrain(acc, 0, 2, 3);
+  acc.finish(2000);
+  const ReedWindStats s = acc.stats();
+  check(s.buckets == 2, "short: 2 buckets closed");
+  check(near(s.gustMs, 3 * kFactor), "short: gust falls back to window mean");
+}
+
+static void testNoBuckets() {
+  ReedWindAccumulator acc;
+  acc.begin(0, 1000, kFactor, 0.0f, kCalm);
+  acc.addPulse(100);
+  acc.finish(900);
+  check(!acc.stats().valid, "empty: no closed bucket -> stats invalid");
+}
+
+static void testMillisWrap() {
+  // A window straddling the 32-bit millis() wrap behaves like any other.
+  ReedWindAccumulator acc;
+  const uint32_t t0 = 0xFFFFF000u;  // 4.096 s before wrap
+  acc.begin(t0, 1000, kFactor, 0.0f, kCalm);
+  steadyTrain(acc, t0, 10, 5);
+  acc.finish(t0 + 10000);
+  const ReedWindStats s = acc.stats();
+  check(s.buckets == 10 && near(s.meanMs, 5 * kFactor), "wrap: stats survive millis() wrap");
+}
+
+int main() {
+  printf("=== Reed wind statistics kernel (native) ===\n");
+  testSteadyWind();
+  testSingleGust();
+  testCalmFraction();
+  testTrailingPartialDropped();
+  testShortWindowGust();
+  testNoBuckets();
+  testMillisWrap();
+  return checkSummary();
+}
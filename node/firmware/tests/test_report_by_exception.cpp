@@ -0,0 +1,163 @@
+// Report-by-exception kernel — native host test.
+//
+// Drives RbeState (the pure kernel captureSensorsToQueue() uses when
+// report-by-exception is configured) through heartbeat, deadband, drift,
+// suppression and went-missing cases and checks which readings survive. No
+// Arduino, no NVS:
+//
+//   pio run -e native-report-by-exception -t exec
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "report_by_exception.h"
+#include "native_check.h"
+
+// Stand-in for v2_reading_t and the protocol.h id scheme.
+struct Reading {
+  uint16_t sensorId;
+  float    value;
+};
+
+static constexpr uint16_t kAirTemp  = 1001;
+static constexpr uint16_t kAirRh    = 1002;
+static constexpr uint16_t kSpectral = 1101;
+static constexpr uint16_t kSoilV    = 2001;
+
+static constexpr uint32_t kSilence = 3600;
+
+static float deadbandOf(uint16_t id) {
+  switch (id) {
+    case kAirTemp: return 0.2f;
+    case kAirRh:   return 1.0f;
+    case kSoilV:   return 0.01f;
+    default:       return -1.0f;  // always sent
+  }
+}
+
+static RbeDecision step(RbeState& s, uint32_t now, Reading* r, size_t& n) {
+  return rbeFilter(s, now, r, n, 8, deadbandOf, kSilence);
+}
+
+static void testFirstWakeIsFull() {
+  RbeState s;
+  rbeReset(s);
+  Reading r[8] = {{kAirTemp, 20.0f}, {kAirRh, 55.0f}, {kSoilV, 1.20f}};
+  size_t n = 3;
+  check(step(s, 1000, r, n) == RbeDecision::Full && n == 3,
+        "first wake: no reference yet, everything is sent");
+  check(s.channelCount == 3 && s.lastFullUnix == 1000,
+        "first wake: reference set and heartbeat time recorded");
+}
+
+static void testDeadbandAndDrift() {
+  RbeState s;
+  rbeReset(s);
+  Reading r[8] = {{kAirTemp, 20.0f}, {kAirRh, 55.0f}, {kSoilV, 1.20f}};
+  size_t n = 3;
+  step(s, 1000, r, n);
+
+  Reading a[8] = {{kAirTemp, 20.1f}, {kAirRh, 55.5f}, {kSoilV, 1.205f}};
+  n = 3;
+  check(step(s, 1300, a, n) == RbeDecision::Suppress && n == 0,
+        "deadband: every channel inside its band suppresses the snapshot");
+
+  Reading b[8] = {{kAirTemp, 20.15f}, {kAirRh, 56.2f}, {kSoilV, 1.207f}};
+  n = 3;
+  check(step(s, 1600, b, n) == RbeDecision::Delta && n == 1 &&
+        b[0].sensorId == kAirRh,
+        "deadband: only the channel past its band is sent");
+
+  // Temperature crept 0.1 per wake; the reference did not move, so the third
+  // step (20.25 vs the sent 20.0) crosses the 0.2 band.
+  Reading c[8] = {{kAirTemp, 20.25f}, {kAirRh, 56.2f}, {kSoilV, 1.207f}};
+  n = 3;
+  check(step(s, 1900, c, n) == RbeDecision::Delta && n == 1 &&
+        c[0].sensorId == kAirTemp,
+        "drift: a slow creep is reported once it accumulates past the band");
+  check(rbeFind(s, kAirTemp)->value == 20.25f,
+        "drift: the reference moves only when a value is sent");
+}
+
+static void testAlwaysSentChannel() {
+  RbeState s;
+  rbeReset(s);
+  Reading r[8] = {{kAirTemp, 20.0f}, {kSpectral, 100.0f}};
+  size_t n = 2;
+  step(s, 1000, r, n);
+  Reading a[8] = {{kAirTemp, 20.0f}, {kSpectral, 100.0f}};
+  n = 2;
+  check(step(s, 1300, a, n) == RbeDecision::Delta && n == 1 &&
+        a[0].sensorId == kSpectral,
+        "no deadband: the channel is sent every wake and blocks suppression");
+}
+
+static void testWentMissing() {
+  RbeState s;
+  rbeReset(s);
+  Reading r[8] = {{kAirTemp, 20.0f}, {kSoilV, 1.20f}};
+  size_t n = 2;
+  step(s, 1000, r, n);
+
+  Reading a[8] = {{kAirTemp, 20.0f}};
+  n = 1;
+  check(step(s, 1300, a, n) == RbeDecision::Delta && n == 1 &&
+        a[0].sensorId == kSoilV && isnan(a[0].value),
+        "missing: a channel that stopped reading is listed as NaN");
+  check(!rbeFind(s, kSoilV), "missing: and dropped from the reference set");
+
+  Reading b[8] = {{kAirTemp, 20.0f}, {kSoilV, 1.20f}};
+  n = 2;
+  check(step(s, 1600, b, n) == RbeDecision::Delta && n == 1 &&
+        b[0].sensorId == kSoilV && b[0].value == 1.20f,
+        "missing: a returning channel is sent even though its value is unchanged");
+}
+
+static void testHeartbeat() {
+  RbeState s;
+  rbeReset(s);
+  Reading r[8] = {{kAirTemp, 20.0f}};
+  size_t n = 1;
+  step(s, 1000, r, n);
+  Reading a[8] = {{kAirTemp, 20.0f}};
+  n = 1;
+  check(step(s, 1000 + kSilence - 1, a, n) == RbeDecision::Suppress,
+        "heartbeat: silence just under the limit stays suppressed");
+  n = 1;
+  a[0] = {kAirTemp, 20.0f};
+  check(step(s, 1000 + kSilence, a, n) == RbeDecision::Full && n == 1,
+        "heartbeat: at the limit an unchanged snapshot is sent in full");
+  n = 1;
+  a[0] = {kAirTemp, 20.0f};
+  check(step(s, 500, a, n) == RbeDecision::Full,
+        "heartbeat: a clock step backwards forces a full snapshot");
+}
+
+static void testChecksum() {
+  RbeState s;
+  rbeReset(s);
+  Reading r[8] = {{kAirTemp, 20.0f}};
+  size_t n = 1;
+  step(s, 1000, r, n);
+  rbeSeal(s);
+  check(rbeIsValid(s), "persist: a sealed state validates");
+  RbeState copy;
+  memcpy(&copy, &s, sizeof(copy));
+  copy.ch[0].value = 21.0f;
+  check(!rbeIsValid(copy), "persist: a corrupted reference is rejected");
+  RbeState zero;
+  memset(&zero, 0, sizeof(zero));
+  check(!rbeIsValid(zero), "persist: zeroed (cold-boot) memory is rejected");
+}
+
+int main() {
+  printf("=== Report-by-exception kernel (native) ===\n");
+  testFirstWakeIsFull();
+  testDeadbandAndDrift();
+  testAlwaysSentChannel();
+  testWentMissing();
+  testHeartbeat();
+  testChecksum();
+  return checkSummary();
+}
@@ -0,0 +1,190 @@
+// On-node snapshot aggregation kernel — native host test.
+//
+// Folds synthetic wake samples into an AggState (the pure kernel
+// captureSensorsToQueue() uses in aggregation mode) and checks the summary
+// readings — headline values, sample count, min/max/SD triples, emit order and
+// the persistence checksum — against hand-computed values. No Arduino, no NVS:
+//
+//   pio run -e native-snapshot-aggregator -t exec
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "snapshot_aggregator.h"
+#include "native_check.h"
+
+static bool near(float got, float want, float tol = 0.001f) {
+  return fabsf(got - want) <= tol;
+}
+
+// Stand-in for v2_reading_t and the protocol.h id scheme.
+struct Reading {
+  uint16_t sensorId;
+  float    value;
+};
+
+static constexpr uint16_t kAirTemp = 1001;
+static constexpr uint16_t kAirRh   = 1002;
+static constexpr uint16_t kGain    = 1111;
+static constexpr uint16_t kWindDir = 1202;
+static constexpr uint16_t kGust    = 1203;
+static constexpr uint16_t kSamples = 4002;
+
+static AggKind kindOf(uint16_t id) {
+  switch (id) {
+    case kWindDir: return AggKind::Circular;
+    case kGust:    return AggKind::Peak;
+    case kGain:    return AggKind::MeanOnly;
+    default:       return AggKind::Linear;
+  }
+}
+
+static uint16_t statId(uint16_t base, AggStat st) {
+  return (uint16_t)((uint16_t)st * 10000u + base);
+}
+
+static const Reading* findId(const Reading* r, size_t n, uint16_t id) {
+  for (size_t i = 0; i < n; ++i)
+    if (r[i].sensorId == id) return &r[i];
+  return nullptr;
+}
+
+static void testLinearStats() {
+  AggState s;
+  aggReset(s, 4);
+  const float temps[4] = {10.0f, 12.0f, 11.0f, 15.0f};
+  for (int i = 0; i < 4; ++i) {
+    const Reading r[1] = {{kAirTemp, temps[i]}};
+    aggAddSample(s, 1000 + 60 * i, r, 1, kindOf);
+  }
+  check(aggWindowComplete(s), "linear: window completes after N samples");
+  check(s.windowStartUnix == 1000 && s.lastSampleUnix == 1180,
+        "linear: window start/end timestamps tracked");
+
+  Reading out[8];
+  const size_t n = aggEmit(s, out, 8, kSamples, statId);
+  // Two-pass reference: mean 12, SD sqrt(14/3).
+  check(n == 5, "linear: mean + samples + min/max/sd = 5 readings");
+  check(out[0].sensorId == kAirTemp && near(out[0].value, 12.0f),
+        "linear: mean under the base id, first");
+  check(out[1].sensorId == kSamples && near(out[1].value, 4.0f),
+        "linear: sample count follows the headline values");
+  check(out[2].sensorId == 11001 && near(out[2].value, 10.0f), "linear: min id/value");
+  check(out[3].sensorId == 21001 && near(out[3].value, 15.0f), "linear: max id/value");
+  check(out[4].sensorId == 31001 && near(out[4].value, sqrtf(14.0f / 3.0f)),
+        "linear: Welford SD matches two-pass sample SD");
+}
+
+static void testSingleSampleSd() {
+  AggState s;
+  aggReset(s, 3);
+  const Reading r[1] = {{kAirRh, 55.0f}};
+  aggAddSample(s, 5, r, 1, kindOf);
+  Reading out[8];
+  const size_t n = aggEmit(s, out, 8, kSamples, statId);
+  const Reading* sd = findId(out, n, statId(kAirRh, AggStat::Sd));
+  check(!aggWindowComplete(s), "partial: 1 of 3 samples is not complete");
+  check(sd && sd->value == 0.0f, "partial: SD of a single sample is 0, not NaN");
+}
+
+static void testKinds() {
+  AggState s;
+  aggReset(s, 3);
+  const float dirs[3]  = {350.0f, 10.0f, 20.0f};
+  const float gusts[3] = {3.0f, 9.5f, 4.0f};
+  const float gains[3] = {4.0f, 8.0f, 6.0f};
+  for (int i = 0; i < 3; ++i) {
+    const Reading r[3] = {{kWindDir, dirs[i]}, {kGust, gusts[i]}, {kGain, gains[i]}};
+    aggAddSample(s, 100 + i, r, 3, kindOf);
+  }
+  Reading out[16];
+  const size_t n = aggEmit(s, out, 16, kSamples, statId);
+  const Reading* dir  = findId(out, n, kWindDir);
+  const Reading* gust = findId(out, n, kGust);
+  const Reading* gain = findId(out, n, kGain);
+  check(dir && near(dir->value, 6.6f, 0.2f),
+        "circular: 350/10/20 deg vector-mean to ~6.6 deg, not 126.7");
+  check(gust && near(gust->value, 9.5f), "peak: gust headline is the window max");
+  check(gain && near(gain->value, 6.0f), "mean-only: gain is averaged");
+  check(n == 4, "non-linear kinds emit no min/max/sd triples");
+}
+
+static void testNanSkipped() {
+  AggState s;
+  aggReset(s, 3);
+  const Reading a[2] = {{kAirTemp, 20.0f}, {kAirRh, NAN}};
+  const Reading b[2] = {{kAirTemp, NAN},   {kAirRh, NAN}};
+  const Reading c[2] = {{kAirTemp, 22.0f}, {kAirRh, NAN}};
+  aggAddSample(s, 1, a, 2, kindOf);
+  aggAddSample(s, 2, b, 2, kindOf);
+  aggAddSample(s, 3, c, 2, kindOf);
+  Reading out[8];
+  const size_t n = aggEmit(s, out, 8, kSamples, statId);
+  check(!findId(out, n, kAirRh), "nan: an all-NaN channel is absent from the summary");
+  const Reading* t = findId(out, n, kAirTemp);
+  check(t && near(t->value, 21.0f), "nan: NaN samples do not drag the mean");
+  const Reading* cnt = findId(out, n, kSamples);
+  check(cnt && near(cnt->value, 3.0f), "nan: sample count still counts every wake");
+}
+
+static void testCapacityDropsWholeTriples() {
+  AggState s;
+  aggReset(s, 2);
+  for (int i = 0; i < 2; ++i) {
+    const Reading r[3] = {{1001, 1.0f + i}, {1002, 2.0f + i}, {1003, 3.0f + i}};
+    aggAddSample(s, 10 + i, r, 3, kindOf);
+  }
+  // 3 means + samples + one full triple = 7; an 8-slot buffer must not start
+  // a second triple it cannot finish.
+  Reading out[8];
+  size_t dropped = 99;
+  const size_t n = aggEmit(s, out, 8, kSamples, statId, &dropped);
+  check(n == 7, "capacity: only whole min/max/sd triples are emitted");
+  check(dropped == 2, "capacity: channels whose triple did not fit are counted");
+  check(out[4].sensorId == 11001 && out[6].sensorId == 31001,
+        "capacity: triples follow channel order");
+
+  Reading tiny[2];
+  check(aggEmit(s, tiny, 2, kSamples, statId) == 2,
+        "capacity: headline values take priority over everything else");
+}
+
+static void testChecksum() {
+  AggState s;
+  aggReset(s, 5);
+  const Reading r[1] = {{kAirTemp, 18.0f}};
+  aggAddSample(s, 77, r, 1, kindOf);
+  aggSeal(s);
+  check(aggIsValid(s), "persist: a sealed state validates");
+
+  AggState copy;
+  memcpy(&copy, &s, sizeof(copy));
+  check(aggIsValid(copy), "persist: a byte copy (RTC/NVS round trip) validates");
+  copy.ch[0].mean += 1.0f;
+  check(!aggIsValid(copy), "persist: a corrupted channel is rejected");
+
+  AggState zero;
+  memset(&zero, 0, sizeof(zero));
+  check(!aggIsValid(zero), "persist: zeroed (cold-boot) memory is rejected");
+
+  // NVS keeps only the header and the channels in use, plus the checksum.
+  const size_t body = aggPersistedSize(s);
+  check(body == kAggHeaderBytes + sizeof(AggChannel), "persist: one channel -> header + 24 bytes");
+  AggState rebuilt{};
+  memcpy(&rebuilt, &s, body);
+  rebuilt.checksum = s.checksum;
+  check(aggIsValid(rebuilt) && memcmp(&rebuilt, &s, sizeof(s)) == 0,
+        "persist: the trimmed record rebuilds the full state");
+}
+
+int main() {
+  printf("=== Snapshot aggregation kernel (native) ===\n");
+  testLinearStats();
+  testSingleSampleSd();
+  testKinds();
+  testNanSkipped();
+  testCapacityDropsWholeTriples();
+  testChecksum();
+  return checkSummary();
+}
@@ -0,0 +1,127 @@
+// Soil ADC batch filter + fixed-point Steinhart–Hart — native host test.
+//
+// Checks the median-of-K outlier rejection and the integer Steinhart–Hart
+// path used by the batched ADS1115 soil pipeline against the float reference
+// (the legacy sh_temp_c() / r_from_vnode() math). No Arduino, no hardware:
+//
+//   pio run -e native-soil-adc-filter -t exec
+
+#include <math.h>
+#include <stdio.h>
+
+#include "soil_adc_filter.h"
+#include "native_check.h"
+
+// Float reference — verbatim from soil_moist_temp.cpp.
+static float r_from_vnode(float vnode_v, float vsup_v, float r_fixed_ohm) {
+  float v = vnode_v;
+  if (v < 0.001f) v = 0.001f;
+  if (v > vsup_v - 0.001f) v = vsup_v - 0.001f;
+  return r_fixed_ohm * ((vsup_v - v) / v);
+}
+
+static float sh_temp_c(float R_ohm, float A, float B, float C) {
+  float lnR  = logf(R_ohm);
+  float invT = A + B * lnR + C * lnR * lnR * lnR;
+  return 1.0f / invT - 273.15f;
+}
+
+// soil1 (A0) fit from soil_moist_temp.cpp.
+static constexpr double kA = -0.0036485006;
+static constexpr double kB =  0.00096359095;
+static constexpr double kC = -2.4188805e-06;
+
+static void testMedianRejectsOutliers() {
+  const int16_t spike[5] = {12000, 12003, 32767, 11998, 12001};
+  check(soilAdcMedian(spike, 5) == 12001, "median: a full-scale spike is rejected");
+
+  const int16_t twoBad[5] = {-32768, 8000, 8002, 8001, 32767};
+  check(soilAdcMedian(twoBad, 5) == 8001, "median: one low + one high outlier rejected");
+
+  const int16_t even[4] = {40, 10, 30, 20};
+  check(soilAdcMedian(even, 4) == 20, "median: even K returns the lower-middle real sample");
+
+  const int16_t one[1] = {-7};
+  check(soilAdcMedian(one, 1) == -7, "median: K=1 is the sample itself");
+  check(soilAdcMedian(nullptr, 0) == 0, "median: empty batch is 0");
+
+  check(soilAdcSpread(spike, 5) == 32767 - 11998, "spread: max-min over the batch");
+}
+
+static void testMedianNoiseReduction() {
+  // Deterministic pseudo-noise: +-40 codes around 10000 with a 1-in-7 spike.
+  uint32_t lcg = 12345;
+  double errMean = 0.0, errMedian = 0.0;
+  const int kTrials = 200;
+  for (int t = 0; t < kTrials; ++t) {
+    int16_t batch[5];
+    long sum = 0;
+    for (int i = 0; i < 5; ++i) {
+      lcg = lcg * 1103515245u + 12345u;
+      int noise = (int)((lcg >> 16) % 81) - 40;
+      if (((lcg >> 8) % 7) == 0) noise += 3000;  // impulse outlier
+      batch[i] = (int16_t)(10000 + noise);
+      sum += batch[i];
+    }
+    errMean   += fabs(sum / 5.0 - 10000.0);
+    errMedian += fabs(soilAdcMedian(batch, 5) - 10000.0);
+  }
+  check(errMedian < errMean / 4.0, "median-of-5 beats mean-of-5 under impulse noise");
+}
+
+static void testRawToUv() {
+  check(soilAdcRawToUv(32767, 4096) == 4095875, "uv: +full scale at 4.096 V");
+  check(soilAdcRawToUv(16384, 4096) == 2048000, "uv: half scale");
+  check(soilAdcRawToUv(-16384, 4096) == -2048000, "uv: negative code");
+}
+
+static void testLnQ24() {
+  bool ok = true;
+  const uint32_t xs[] = {2, 3, 10, 1000, 9880, 33000, 100000, 1000000, 2000000000u};
+  for (uint32_t x : xs) {
+    const double got = soilLnQ24(x) / 16777216.0;
+    if (fabs(got - log((double)x)) > 2e-6) {
+      printf("  ln(%u): got %.7f want %.7f\n", (unsigned)x, got, log((double)x));
+      ok = false;
+    }
+  }
+  check(ok, "lnQ24: within 2e-6 of log() from 2 to 2e9");
+}
+
+static void testShMatchesFloat() {
+  const SoilShFixed k = soilShMakeFixed(kA, kB, kC);
+  const float vsup = 4.910f;
+  const float rFixed = 9880.0f;
+  float worst = 0.0f;
+  // Sweep the divider across the whole plausible soil range.
+  for (int mv = 600; mv <= 4300; mv += 25) {
+    const float rF = r_from_vnode(mv / 1000.0f, vsup, rFixed);
+    const float tF = sh_temp_c(rF, (float)kA, (float)kB, (float)kC);
+    const uint32_t rI = soilDividerOhmsQ4(mv * 1000, 4910000, 9880);
+    const int32_t tI = soilShCentiC(rI, k);
+    const float err = fabsf(tI / 100.0f - tF);
+    if (err > worst) worst = err;
+  }
+  printf("  worst fixed-vs-float error: %.4f C\n", worst);
+  check(worst <= 0.01f, "sh: fixed point within 0.01 C of float over 0.6-4.3 V");
+}
+
+static void testDividerClamps() {
+  check(soilDividerOhmsQ4(0, 4910000, 9880) == (uint32_t)(9880ll * (4910000 - 1000) * 16 / 1000),
+        "divider: 0 V clamps to 1 mV instead of dividing by zero");
+  check(soilDividerOhmsQ4(5000000, 4910000, 9880) == 32u,  // 9880*1000*16/4909000 = 32.2
+        "divider: above-rail clamps to supply-1 mV (rounded Q4)");
+  check(soilDividerOhmsQ4(2455000, 4910000, 9880) == 9880u * 16,
+        "divider: mid-rail is r_fixed");
+}
+
+int main() {
+  printf("=== Soil ADC filter + fixed-point Steinhart-Hart (native) ===\n");
+  testMedianRejectsOutliers();
+  testMedianNoiseReduction();
+  testRawToUv();
+  testLnQ24();
+  testShMatchesFloat();
+  testDividerClamps();
+  return checkSummary();
+}
@@ -0,0 +1,269 @@
+// Low-latency listening — native host simulation.
+//
+// Runs the shared urgent_listen.h code (the same the node and the mothership
+// use) over simulated days: nodes on 1- to 60-minute aligned wakes cross a
+// frost line at night and a flood line after rain, send URGENT frames, and
+// the mothership wakes for listen windows between its sync slots. Some frames
+// are lost on air. Checks the threshold hysteresis, that every crossing is
+// delivered, that end-to-end latency stays within the worst-case model, that
+// listen windows keep clear of sync wakes, and that the power budget counts
+// the wakes the schedule actually makes. No Arduino, no radio:
+//
+//   pio run -e native-urgent-listen-sim -t exec
+
+#include <math.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "urgent_listen.h"
+#include "native_check.h"
+
+using namespace urgent_listen;
+
+// Deterministic xorshift32 so every run sees the same losses.
+struct Rng {
+  uint32_t s;
+  uint32_t next() {
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+  }
+  bool chance(uint32_t percent) { return next() % 100u < percent; }
+  uint32_t range(uint32_t lo, uint32_t hi) { return lo + next() % (hi - lo + 1u); }
+};
+
+static const uint32_t kDay0 = 1760054400UL;  // midnight UTC
+static const float kNaN = NAN;
+
+static void testHysteresis() {
+  const Thresholds t{kFrost | kFlood, 0, 2200};
+  State s{0, 0};
+  check(evaluate(t, 1.0f, 1.0f, s) == 0, "hysteresis: above the frost line is quiet");
+  check(evaluate(t, -0.1f, 1.0f, s) == kFrost, "hysteresis: crossing below trips frost");
+  check(evaluate(t, -0.3f, 1.0f, s) == kFrost, "hysteresis: undelivered alarm is resent");
+  markDelivered(s, kFrost);
+  check(evaluate(t, 0.2f, 1.0f, s) == 0, "hysteresis: hovering on the line stays delivered");
+  check(evaluate(t, -0.2f, 1.0f, s) == 0, "hysteresis: dipping again sends nothing new");
+  check(evaluate(t, kNaN, kNaN, s) == 0 && (s.active & kFrost),
+        "hysteresis: a missing reading keeps the alarm");
+  check(evaluate(t, 0.6f, 1.0f, s) == 0 && !(s.active & kFrost),
+        "hysteresis: clearing past 0.5 C re-arms frost");
+  check(evaluate(t, -0.1f, 1.0f, s) == kFrost, "hysteresis: next crossing trips again");
+  check(evaluate(t, -0.1f, 2.3f, s) == (kFrost | kFlood), "hysteresis: alarms are independent");
+  const Thresholds off{0, 0, 2200};
+  check(evaluate(off, -5.0f, 3.0f, s) == 0 && s.active == 0,
+        "hysteresis: thresholds off clears everything");
+}
+
+static void testListenInterval() {
+  const uint8_t a[] = {10, 20, 30};
+  const uint8_t b[] = {1, 10};
+  const uint8_t c[] = {20, 30};
+  const uint8_t d[] = {60};
+  check(listenIntervalMin(a, 3) == 10, "interval: gcd of 10/20/30 is 10");
+  check(listenIntervalMin(b, 2) == kMinListenIntervalMin, "interval: 1-minute nodes floor at 5");
+  check(listenIntervalMin(c, 2) == 10, "interval: 20 and 30 share every 10th minute");
+  check(listenIntervalMin(d, 1) == 60, "interval: a single hourly node");
+  check(listenIntervalMin(nullptr, 0) == 0, "interval: nobody to listen for");
+}
+
+static void testNextListenWake() {
+  const uint32_t sync = kDay0 + 3600u - 10u;  // hourly sync, 10 s pre-roll
+  check(nextListenWake(kDay0 + 60u, 10, sync) == kDay0 + 600u - kListenLeadSec,
+        "wake: next boundary less the lead");
+  check(nextListenWake(kDay0 + 600u - kListenLeadSec - 2u, 10, sync) ==
+            kDay0 + 1200u - kListenLeadSec,
+        "wake: too close to arm moves on a boundary");
+  check(nextListenWake(kDay0 + 3000u, 10, sync) == 0,
+        "wake: a window running into the sync wake is skipped");
+  check(nextListenWake(kDay0 + 60u, 10, 0) == kDay0 + 600u - kListenLeadSec,
+        "wake: daily sync mode (no interval wake) still listens");
+  bool clear = true;
+  for (uint32_t now = kDay0; now < kDay0 + 86400u; now += 37u) {
+    const uint32_t nextSync = kDay0 + ((now - kDay0) / 1800u + 1u) * 1800u;
+    const uint32_t w = nextListenWake(now, 5, nextSync);
+    if (w == 0) continue;
+    if (w < now + 5u || (w + kListenLeadSec) % 300u != 0 ||
+        w + kListenWindowSec + kSyncGuardSec > nextSync) {
+      clear = false;
+    }
+  }
+  check(clear, "wake: every window is aligned, in the future and clear of sync");
+}
+
+struct SimNode {
+  uint32_t wakeMin;
+  float phase;          // local weather offset, radians
+  uint32_t floodAt;     // rain event: soil probe jumps above the line
+  State state;
+  uint32_t pendingSince;  // capture time of the first undelivered crossing
+};
+
+struct SimResult {
+  size_t crossings;
+  size_t delivered;
+  size_t viaSync;
+  uint32_t worstLatency;
+  uint32_t worstBound;
+  double meanLatency;
+  double meanSyncOnly;  // the same crossings waiting for the next sync upload
+  uint32_t listenWakes;
+  bool windowsClear;
+};
+
+// Sync session: the hub receives for kSessionSec after its wake, then uploads.
+static const uint32_t kSessionSec = 120;
+static const uint32_t kUploadSec = 60;
+
+static SimResult simulate(const std::vector<uint32_t>& wakeMins, uint32_t syncMin,
+                          uint32_t lossPct, uint32_t days, uint32_t seed) {
+  Rng rng{seed};
+  std::vector<SimNode> nodes;
+  std::vector<uint8_t> intervals;
+  for (size_t i = 0; i < wakeMins.size(); ++i) {
+    SimNode n{};
+    n.wakeMin = wakeMins[i];
+    n.phase = (float)(rng.next() % 628u) / 100.0f;
+    n.floodAt = kDay0 + rng.range(3600u, days * 86400u - 7200u);
+    nodes.push_back(n);
+    intervals.push_back((uint8_t)wakeMins[i]);
+  }
+  const uint32_t listenMin = listenIntervalMin(intervals.data(), intervals.size());
+  const uint32_t syncPeriod = syncMin * 60u;
+  const uint32_t syncPhase = kDay0 + 120u;  // sync slots a couple of minutes past the hour
+  const Thresholds t{kFrost | kFlood, 0, 2200};
+
+  // Hub schedule: each wake arms the earlier of the next listen window and the
+  // next sync wake, exactly as the mothership does after every session.
+  struct Window { uint32_t open, close, postDone; bool sync; };
+  std::vector<Window> windows;
+  SimResult r{};
+  r.windowsClear = true;
+  uint32_t now = kDay0;
+  while (now < kDay0 + days * 86400u) {
+    const uint32_t nextSync = syncPhase - 10u +
+        ((now + 10u - syncPhase) / syncPeriod + 1u) * syncPeriod;
+    const uint32_t listen = nextListenWake(now, listenMin, nextSync);
+    if (listen != 0) {
+      const uint32_t close = listen + kListenWindowSec;
+      windows.push_back({listen, close, close + (uint32_t)kUrgentPostSec, false});
+      if (close + kSyncGuardSec > nextSync) r.windowsClear = false;
+      r.listenWakes++;
+      now = close + (uint32_t)kUrgentPostSec;
+    } else {
+      const uint32_t close = nextSync + kSessionSec;
+      windows.push_back({nextSync, close, close + kUploadSec, true});
+      now = close + kUploadSec;
+    }
+  }
+
+  double latencySum = 0, syncOnlySum = 0;
+  for (auto& n : nodes) {
+    const uint32_t period = n.wakeMin * 60u;
+    for (uint32_t wake = kDay0 + period; wake < kDay0 + days * 86400u - 7200u; wake += period) {
+      const float hours = (float)(wake - kDay0) / 3600.0f;
+      const float air = 2.5f + 4.0f * sinf(hours * 6.2831853f / 24.0f + n.phase) +
+                        (float)(rng.next() % 100u) / 200.0f;
+      const float soil = wake >= n.floodAt && wake < n.floodAt + 6u * 3600u ? 2.6f : 1.4f;
+      const uint8_t due = evaluate(t, air, soil, n.state);
+      if (!due) continue;
+      const uint32_t capture = wake + rng.range(2u, 15u);
+      if (n.pendingSince == 0) {
+        n.pendingSince = capture;
+        r.crossings++;
+      }
+      const Window* heard = nullptr;
+      for (const auto& w : windows) {
+        if (w.open <= capture && capture < w.close) { heard = &w; break; }
+        if (w.open > capture) break;
+      }
+      if (!heard || rng.chance(lossPct)) continue;
+      markDelivered(n.state, due);
+      const uint32_t latency = heard->postDone - n.pendingSince;
+      uint32_t syncUpload = 0;
+      for (const auto& w : windows) {
+        if (w.sync && w.close > n.pendingSince) { syncUpload = w.postDone; break; }
+      }
+      const uint32_t bound = worstLatencySec(n.wakeMin, listenMin);
+      if (latency > r.worstLatency) {
+        r.worstLatency = latency;
+        r.worstBound = bound;
+      }
+      latencySum += latency;
+      syncOnlySum += syncUpload > n.pendingSince ? syncUpload - n.pendingSince : 0;
+      r.delivered++;
+      if (heard->sync) r.viaSync++;
+      n.pendingSince = 0;
+    }
+    if (n.pendingSince != 0) r.crossings--;  // still in flight when the run ended
+  }
+  r.meanLatency = r.delivered ? latencySum / r.delivered : 0;
+  r.meanSyncOnly = r.delivered ? syncOnlySum / r.delivered : 0;
+  return r;
+}
+
+static void runScenario(const char* name, const std::vector<uint32_t>& wakeMins,
+                        uint32_t syncMin, uint32_t lossPct, uint32_t seed) {
+  const uint32_t days = 4;
+  const SimResult r = simulate(wakeMins, syncMin, lossPct, days, seed);
+  std::vector<uint8_t> intervals(wakeMins.begin(), wakeMins.end());
+  const uint32_t listenMin = listenIntervalMin(intervals.data(), intervals.size());
+  uint32_t bound = 0;
+  for (uint32_t w : wakeMins) bound = std::max(bound, worstLatencySec(w, listenMin));
+  const PowerBudget b = estimateBudget(listenMin, syncMin, kDay0 + 120u, 4.0f);
+
+  printf("  %-22s listen=%2umin sync=%2umin loss=%2u%%: crossings=%u delivered=%u "
+         "(sync %u) latency mean=%.0fs worst=%us (bound %us) vs sync-only mean=%.0fs; "
+         "listen wakes/day=%u duty=%.1f%% %.1f mAh/day\n",
+         name, (unsigned)listenMin, (unsigned)syncMin, (unsigned)lossPct,
+         (unsigned)r.crossings, (unsigned)r.delivered, (unsigned)r.viaSync,
+         r.meanLatency, (unsigned)r.worstLatency, (unsigned)r.worstBound, r.meanSyncOnly,
+         (unsigned)b.listenWakesPerDay, b.dutyPercent, b.totalMahPerDay);
+
+  char label[112];
+  snprintf(label, sizeof(label), "sim %s: every crossing delivered", name);
+  check(r.crossings > 0 && r.delivered == r.crossings, label);
+  snprintf(label, sizeof(label), "sim %s: listen windows clear the sync wakes", name);
+  check(r.windowsClear, label);
+  snprintf(label, sizeof(label), "sim %s: urgent beats waiting for sync", name);
+  check(r.meanLatency < r.meanSyncOnly, label);
+  if (lossPct == 0) {
+    snprintf(label, sizeof(label), "sim %s: latency within the worst-case model", name);
+    check(r.worstLatency <= bound, label);
+  }
+  // The budget walks the same schedule the simulated hub followed.
+  snprintf(label, sizeof(label), "sim %s: budget counts the scheduled wakes", name);
+  const uint32_t perDay = r.listenWakes / days;
+  check(b.listenWakesPerDay + 1 >= perDay && b.listenWakesPerDay <= perDay + 1, label);
+}
+
+static void testBudget() {
+  const PowerBudget off = estimateBudget(0, 60, kDay0, 0.0f);
+  check(off.listenWakesPerDay == 0 && off.totalMahPerDay == 0.0f,
+        "budget: no urgent nodes costs nothing");
+  const PowerBudget five = estimateBudget(5, 60, kDay0, 0.0f);
+  const PowerBudget ten = estimateBudget(10, 60, kDay0, 0.0f);
+  check(five.listenWakesPerDay > ten.listenWakesPerDay &&
+            five.listenWakesPerDay < 288u,
+        "budget: sync slots replace some listen windows");
+  check(five.dutyPercent < 15.0f, "budget: 5-minute listening stays under 15% duty");
+  const PowerBudget posts = estimateBudget(10, 60, kDay0, 10.0f);
+  check(posts.totalMahPerDay > ten.totalMahPerDay + 9.0f * posts.postMahEach,
+        "budget: urgent POSTs are charged per event");
+}
+
+int main() {
+  testHysteresis();
+  testListenInterval();
+  testNextListenWake();
+  testBudget();
+  runScenario("10-min fleet", {10, 10, 10, 10, 10, 10}, 60, 0, 0x1234u);
+  runScenario("mixed 10/20/30", {10, 20, 30, 20, 30, 10}, 60, 0, 0x2345u);
+  runScenario("1-min nodes", {1, 1, 5, 10}, 30, 0, 0x3456u);
+  runScenario("hourly lossy", {60, 60, 60, 30}, 120, 15, 0x4567u);
+  runScenario("mixed lossy", {5, 10, 20, 30, 60, 1}, 60, 15, 0x5678u);
+  return checkSummary();
+}
@@ -26,7 +26,7 @@ Requires a bench keypair at scripts/ota-bench/bench-key.json. Generate one with
   python scripts/release_sign.py keygen --out-dir scripts/ota-bench/keys
 and rename/convert to bench-key.json as {"privateKey": "<64 hex>", "publicKey": "<64 hex>"}.
 The matching public key must be pasted into kReleasePubKey in
-mothership_selfupdate.cpp for the bench build.
+node/firmware/shared/release_pubkey.h for the bench build.
 
 Usage:
   python scripts/ota-bench/publish_bench_release.py \\
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Generate the mothership config portal's static assets header.
+
+Reads mothership/firmware/v2/web/portal.css and web/portal.js and writes
+src/config/portal_assets.h with, for each file:
+    PORTAL_<NAME>      the text, for clients that do not accept gzip
+    PORTAL_<NAME>_GZ   the same bytes gzipped (level 9, mtime 0: reproducible)
+    PORTAL_<NAME>_ETAG quoted ETag, the first 16 hex digits of its SHA-256
+    PORTAL_<NAME>_VER  the same digits unquoted, for the ?v= cache buster
+
+The header is committed so a build without this hook still compiles. Run by
+the mothership main env via:
+    extra_scripts = pre:../../../scripts/portal_assets.py
+or by hand after editing web/:
+    python3 scripts/portal_assets.py
+It only rewrites the header when the output changes.
+"""
+import gzip
+import hashlib
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__)) if "__file__" in globals() else os.getcwd()
+V2 = os.path.join(HERE, "..", "mothership", "firmware", "v2")
+
+ASSETS = [
+    ("CSS", "portal.css"),
+    ("JS", "portal.js"),
+]
+
+
+def _bytes_literal(data):
+    lines = []
+    for i in range(0, len(data), 20):
+        lines.append("  " + ",".join("0x%02x" % b for b in data[i:i + 20]) + ",")
+    return "\n".join(lines)
+
+
+def render(v2_dir):
+    out = [
+        "#pragma once",
+        "",
+        "// Generated by scripts/portal_assets.py from web/ — do not edit; edit the",
+        "// source file and rebuild (or run the script).",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+    for name, fname in ASSETS:
+        with open(os.path.join(v2_dir, "web", fname), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        ver = hashlib.sha256(raw).hexdigest()[:16]
+        delim = "FMASSET"
+        assert (")" + delim + '"').encode() not in raw
+        out += [
+            "// web/%s: %u bytes, %u gzipped" % (fname, len(raw), len(gz)),
+            'static const char PORTAL_%s_VER[] = "%s";' % (name, ver),
+            'static const char PORTAL_%s_ETAG[] = "\\"%s\\"";' % (name, ver),
+            'static const char PORTAL_%s[] PROGMEM = R"%s(%s)%s";' % (name, delim, raw.decode("utf-8"), delim),
+            "static const uint8_t PORTAL_%s_GZ[] PROGMEM = {" % name,
+            _bytes_literal(gz),
+            "};",
+            "",
+        ]
+    return "\n".join(out)
+
+
+def generate(v2_dir=V2):
+    text = render(v2_dir)
+    path = os.path.join(v2_dir, "src", "config", "portal_assets.h")
+    try:
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return False
+    except OSError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    return True
+
+
+try:
+    Import("env")  # noqa: F821  (injected by PlatformIO/SCons)
+    _v2 = env.subst("$PROJECT_DIR")  # noqa: F821
+    print("[portal_assets] %s" % ("regenerated" if generate(_v2) else "up to date"))
+except NameError:
+    if __name__ == "__main__":
+        print("[portal_assets] %s" % ("regenerated" if generate() else "up to date"))
@@ -22,12 +22,26 @@ Usage:
                           --out-dir release/
   release_sign.py sign    --key keys/fieldmesh_ed25519.pem \\
                           --manifest release/manifest.json
+
+Delta patches: add from=<old.bin>[|<older.bin>] to an --artifact spec and
+`make` also writes patch-<first 16 hex of the old image's SHA-256>.bin for each
+base image, listed under the artifact's "patches" (fromSha256, fromSize,
+sha256, size). A device running one of those images downloads the patch
+instead of the full image. Patches larger than --max-patch-ratio of the image
+are dropped; the full image is always published as the fallback.
   release_sign.py pubkey  --key keys/fieldmesh_ed25519.pem   # C array for firmware
+
+Fleet OTA: a role=node artifact also gets "fleetSig", the signature over the
+fixed-layout image statement in node/firmware/shared/fleet_ota.h
+(fotaOfferStatement), which includes --sequence so nodes can refuse replays of
+older releases. The mothership relays it in every ESP-NOW OTA_OFFER and
+nodes verify it against the same public key before downloading or arming.
 """
 import argparse
 import hashlib
 import json
 import os
+import struct
 import sys
 
 from cryptography.hazmat.primitives.asymmetric.ed25519 import (
@@ -69,7 +83,140 @@ def cmd_keygen(args):
     print(f"public key (embed in firmware): {pub_hex}")
 
 
-def _parse_artifact(spec, sign_priv):
+# --- FMDP delta patches (decoded on device by src/ota/ota_delta_patch.h) ---
+#
+#   header  b"FMDP" | version=1 | 3 reserved | sourceSize | targetSize
+#           | sha256(source) | sha256(target)                         (80 B)
+#   ops     0x01 COPY srcOffset, length | 0x02 INSERT length, bytes | 0x00 END
+#
+# Matching: every PATCH_STRIDE-aligned PATCH_BLOCK-byte block of the old image
+# is indexed; the new image is scanned byte by byte and each hit is extended
+# both ways. A run shared by both images of at least PATCH_BLOCK + PATCH_STRIDE
+# bytes is always found.
+PATCH_MAGIC = b"FMDP"
+PATCH_VERSION = 1
+PATCH_BLOCK = 32
+PATCH_STRIDE = 16
+OP_END, OP_COPY, OP_INSERT = 0, 1, 2
+
+
+def _match_len(a, ai, b, bi):
+    n = 0
+    limit = min(len(a) - ai, len(b) - bi)
+    while n < limit:
+        step = min(256, limit - n)
+        if a[ai + n:ai + n + step] == b[bi + n:bi + n + step]:
+            n += step
+            continue
+        while n < limit and a[ai + n] == b[bi + n]:
+            n += 1
+        break
+    return n
+
+
+def make_patch(old, new):
+    index = {}
+    for off in range(0, len(old) - PATCH_BLOCK + 1, PATCH_STRIDE):
+        index.setdefault(old[off:off + PATCH_BLOCK], off)
+
+    out = bytearray(PATCH_MAGIC + bytes([PATCH_VERSION, 0, 0, 0]))
+    out += struct.pack("<II", len(old), len(new))
+    out += hashlib.sha256(old).digest() + hashlib.sha256(new).digest()
+
+    def insert(lo, hi):
+        if hi > lo:
+            out.extend(struct.pack("<BI", OP_INSERT, hi - lo))
+            out.extend(new[lo:hi])
+
+    i = lit = 0
+    while i + PATCH_BLOCK <= len(new):
+        src = index.get(new[i:i + PATCH_BLOCK])
+        if src is None:
+            i += 1
+            continue
+        n = _match_len(new, i, old, src)
+        back = 0
+        while i - back > lit and src - back > 0 and new[i - back - 1] == old[src - back - 1]:
+            back += 1
+        i, src, n = i - back, src - back, n + back
+        insert(lit, i)
+        out.extend(struct.pack("<BII", OP_COPY, src, n))
+        i += n
+        lit = i
+    insert(lit, len(new))
+    out.append(OP_END)
+    return bytes(out)
+
+
+def apply_patch(old, patch):
+    # Reference decoder; make() round-trips every patch through it.
+    if patch[:4] != PATCH_MAGIC or patch[4] != PATCH_VERSION:
+        raise ValueError("not an FMDP v1 patch")
+    src_size, dst_size = struct.unpack_from("<II", patch, 8)
+    if src_size != len(old):
+        raise ValueError("patch is for a different base image")
+    out = bytearray()
+    p = 80
+    while True:
+        op = patch[p]; p += 1
+        if op == OP_END:
+            break
+        if op == OP_COPY:
+            off, n = struct.unpack_from("<II", patch, p); p += 8
+            if off + n > len(old):
+                raise ValueError("COPY outside base image")
+            out += old[off:off + n]
+        elif op == OP_INSERT:
+            (n,) = struct.unpack_from("<I", patch, p); p += 4
+            out += patch[p:p + n]; p += n
+        else:
+            raise ValueError(f"bad opcode {op:#x}")
+    if p != len(patch) or len(out) != dst_size:
+        raise ValueError("patch length mismatch")
+    return bytes(out)
+
+
+def patch_file_name(from_sha256_hex):
+    return f"patch-{from_sha256_hex[:16]}.bin"
+
+
+def _build_patches(kv, data, out_dir, max_ratio):
+    patches = []
+    for path in [p for p in kv.get("from", "").split("|") if p]:
+        with open(path, "rb") as f:
+            old = f.read()
+        patch = make_patch(old, data)
+        if apply_patch(old, patch) != data:
+            raise SystemExit(f"patch round trip failed for {path}")
+        from_sha = hashlib.sha256(old).hexdigest()
+        if len(patch) > max_ratio * len(data):
+            print(f"  skip patch from {path}: {len(patch)} B is over "
+                  f"{max_ratio:.0%} of the {len(data)} B image")
+            continue
+        name = patch_file_name(from_sha)
+        with open(os.path.join(out_dir, name), "wb") as f:
+            f.write(patch)
+        print(f"  patch {name}: {len(patch)} B vs {len(data)} B full image "
+              f"({100.0 * (1 - len(patch) / len(data)):.1f}% less to download)")
+        patches.append({
+            "fromSha256": from_sha,
+            "fromSize": len(old),
+            "sha256": hashlib.sha256(patch).hexdigest(),
+            "size": len(patch),
+        })
+    return patches
+
+
+def fleet_statement(size, sha256_hex, version, hw_target, sequence):
+    """Bytes a node checks the OTA_OFFER signature over (fleet_ota.h)."""
+    if len(version.encode()) >= 12 or len(hw_target.encode()) >= 16:
+        raise SystemExit(f"node version {version!r} / hw {hw_target!r} too long for OTA_OFFER")
+    return (b"FMFOTA2\0" + struct.pack("<I", size) + bytes.fromhex(sha256_hex) +
+            version.encode().ljust(12, b"\0") + hw_target.encode().ljust(16, b"\0") +
+            struct.pack("<I", sequence))
+
+
+def _parse_artifact(spec, out_dir, max_ratio, priv, sequence):
     kv = dict(part.split("=", 1) for part in spec.split(","))
     with open(kv["bin"], "rb") as f:
         data = f.read()
@@ -84,19 +231,28 @@ def _parse_artifact(spec, sign_priv):
     }
     if "min-mothership" in kv:
         art["minMothershipVersion"] = kv["min-mothership"]
+    patches = _build_patches(kv, data, out_dir, max_ratio)
+    if patches:
+        art["patches"] = patches
+    if art["role"] == "node":
+        # Nodes are offered the first hardware target (node_image_cache.cpp).
+        stmt = fleet_statement(art["size"], art["sha256"], art["version"],
+                               art["hwTargets"][0], sequence)
+        art["fleetSig"] = priv.sign(stmt).hex()
     return art
 
 
 def cmd_make(args):
     priv = _load_key(args.key)
-    artifacts = [_parse_artifact(a, priv) for a in args.artifact]
+    os.makedirs(args.out_dir, exist_ok=True)
+    artifacts = [_parse_artifact(a, args.out_dir, args.max_patch_ratio, priv, args.sequence)
+                 for a in args.artifact]
     manifest = {
         "schemaVersion": 1,
         "releaseId": args.release_id,
         "releaseSequence": args.sequence,
         "artifacts": artifacts,
     }
-    os.makedirs(args.out_dir, exist_ok=True)
     man_path = os.path.join(args.out_dir, "manifest.json")
     raw = _canonical(manifest)
     with open(man_path, "wb") as f:
@@ -140,8 +296,11 @@ def main():
     m.add_argument("--release-id", required=True)
     m.add_argument("--sequence", type=int, required=True)
     m.add_argument("--artifact", action="append", required=True,
-                   help="role=..,version=..,hw=a|b,proto=..,min-mothership=..,bin=path")
+                   help="role=..,version=..,hw=a|b,proto=..,min-mothership=..,bin=path"
+                        "[,from=old.bin|older.bin]")
     m.add_argument("--out-dir", default="release")
+    m.add_argument("--max-patch-ratio", type=float, default=0.6,
+                   help="drop a delta patch larger than this fraction of the image")
     m.set_defaults(func=cmd_make)
 
     s = sub.add_parser("sign")